@@ -0,0 +1 @@
+int main(int ac, char **av){ return 0; }
@@ -159,6 +159,8 @@ R_API void r_anal_free(RAnal *a) {
 	}
 	/* TODO: Free anals here */
 	free (a->pincmd);
+	r_anal_prefetch_clear (a);
+	r_anal_opcache_setup (a, 0);
 	r_list_free (a->fcns);
 	ht_up_free (a->ht_addr_fun);
 	ht_pp_free (a->ht_name_fun);
@@ -177,8 +179,7 @@ R_API void r_anal_free(RAnal *a) {
 	r_anal_pin_fini (a);
 	r_syscall_free (a->syscall);
 	r_reg_free (a->reg);
-	ht_up_free (a->dict_refs);
-	ht_up_free (a->dict_xrefs);
+	r_anal_xrefs_fini (a);
 	r_list_free (a->threads);
 	r_list_free (a->leaddrs);
 	sdb_free (a->sdb);
@@ -0,0 +1,241 @@
+// SDB-CGEN V1.9.4
+// gcc -DMAIN=1 types_darwin.c ; ./a.out > types_darwin.h
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+struct kv { const char *name; const char *value; };
+static const struct kv kvs[] = {
+  {"func.__libc_start_main.arg.6","void *,stack_end"}, 
+  {"func.__libc_start_main.arg.4","func,fini"}, 
+  {"func._Exit.ret","void"}, 
+  {"func.atexit.arg.0","func,function"}, 
+  {"func.__libc_start_main.arg.5","func,rtld_fini"}, 
+  {"func.__libc_start_main.arg.2","char **,ubp_av"}, 
+  {"func.__libc_start_main.arg.3","func,init"}, 
+  {"func.__libc_start_main.arg.0","func,main"}, 
+  {"func.__libc_start_main.arg.1","int,argc"}, 
+  {"func._Exit.arg.0","int,status"}, 
+  {"func.getsockopt.ret","int"}, 
+  {"func.__assert_rtn.cc","amd64"}, 
+  {"func.select.arg.1","fd_set *,readfds"}, 
+  {"func.select.arg.0","int,nfds"}, 
+  {"func.atexit.args","1"}, 
+  {"func.select.arg.3","fd_set *,exceptfds"}, 
+  {"func.select.arg.2","fd_set *,writefds"}, 
+  {"func.select.arg.4","struct timeval *,timeout"}, 
+  {"func.__libc_init.args","3"}, 
+  {"func.prctl.args","5"}, 
+  {"abort","func"}, 
+  {"func._exit.ret","void"}, 
+  {"func.sigaction.args","3"}, 
+  {"func.__uClibc_main.arg.6","void *,stack_end"}, 
+  {"func.errc.ret","void"}, 
+  {"func.__uClibc_main.arg.5","func,rtld_fini"}, 
+  {"func.wait.arg.0","int *,wstatus"}, 
+  {"func.__uClibc_main.arg.4","func,app_fini"}, 
+  {"__assert_rtn","func"}, 
+  {"func.__uClibc_main.arg.3","func,app_init"}, 
+  {"func.exit.noreturn","true"}, 
+  {"func.__uClibc_main.arg.2","char **,argv"}, 
+  {"func.__uClibc_main.arg.1","int,argc"}, 
+  {"func.__uClibc_main.arg.0","func,main"}, 
+  {"func.__libc_init.ret","void"}, 
+  {"__uClibc_main","func"}, 
+  {"struct.NSString.len.meta","4"}, 
+  {"getsockname","func"}, 
+  {"func.xalloc_die.args","0"}, 
+  {"func.select.ret","int"}, 
+  {"func.acl_free.arg.0","void *,obj_p"}, 
+  {"NSString","struct"}, 
+  {"_exit","func"}, 
+  {"func.errx.arg.0","int,eval"}, 
+  {"func.getsockname.ret","int"}, 
+  {"setsockopt","func"}, 
+  {"func.errx.arg.1","const char *,fmt"}, 
+  {"func.__libc_start_main.noreturn","true"}, 
+  {"func.__libc_init_array.ret","void"}, 
+  {"func.recvfrom.ret","ssize_t"}, 
+  {"func.select.args","5"}, 
+  {"func.setsockopt.ret","int"}, 
+  {"func.getsockname.args","3"}, 
+  {"recvfrom","func"}, 
+  {"func.waitid.arg.3","int,options"}, 
+  {"func.abort.noreturn","true"}, 
+  {"func.waitid.arg.2","siginfo_t *,infop"}, 
+  {"func.waitid.arg.1","id_t,id"}, 
+  {"struct.NSString.str","char *,0,0"}, 
+  {"func.__uClibc_main.ret","int"}, 
+  {"func.waitid.arg.0","idtype_t,idtype"}, 
+  {"func.waitpid.ret","pid_t"}, 
+  {"func.xalloc_die.ret","void"}, 
+  {"select","func"}, 
+  {"waitid","func"}, 
+  {"getsockopt","func"}, 
+  {"func.__assert_rtn.noreturn","true"}, 
+  {"func.prctl.ret","int"}, 
+  {"func.__libc_init.noreturn","true"}, 
+  {"struct.NSString.len","int,0,0"}, 
+  {"func.getsockopt.arg.0","int,sockfd"}, 
+  {"func.getsockopt.arg.1","int,level"}, 
+  {"func.__assert_rtn.ret","void"}, 
+  {"func.getsockopt.arg.2","int,optname"}, 
+  {"func.getsockopt.arg.3","void *,optval"}, 
+  {"func.getsockopt.arg.4","socklen_t *,optlen"}, 
+  {"struct.NSString.p0","void *,0,0"}, 
+  {"err","func"}, 
+  {"struct.NSString.p1","size_t,0,0"}, 
+  {"acl_free","func"}, 
+  {"func.prctl.arg.0","int,option"}, 
+  {"func.prctl.arg.1","unsigned long,v2"}, 
+  {"func.waitpid.args","3"}, 
+  {"func.prctl.arg.2","unsigned long,v3"}, 
+  {"func.prctl.arg.3","unsigned long,v4"}, 
+  {"func.prctl.arg.4","unsigned long,v5"}, 
+  {"prctl","func"}, 
+  {"func.exit.ret","void"}, 
+  {"func.__libc_init_array.args","0"}, 
+  {"func.acl_free.args","1"}, 
+  {"__libc_init_array","func"}, 
+  {"exit","func"}, 
+  {"func.waitid.args","4"}, 
+  {"func.err.arg.0","int,eval"}, 
+  {"func.tputs.arg.2","void *,putc"}, 
+  {"func.err.arg.1","const char *,fmt"}, 
+  {"struct.NSString.p0.meta","4"}, 
+  {"func.access.arg.1","int,mode"}, 
+  {"func.tputs.arg.1","int,affcnt"}, 
+  {"func.access.arg.0","const char *,path"}, 
+  {"func.tputs.arg.0","const char *,str"}, 
+  {"func.exit.arg.0","int,status"}, 
+  {"func.errc.args","1"}, 
+  {"__stack_chk_fail","func"}, 
+  {"func.abort.args","0"}, 
+  {"func.abort.ret","void"}, 
+  {"func._Exit.args","1"}, 
+  {"func.recvfrom.args","4"}, 
+  {"func.getsockname.arg.0","int,sockfd"}, 
+  {"func.getsockname.arg.1","struct sockaddr *,addr"}, 
+  {"wait","func"}, 
+  {"func.wait.args","1"}, 
+  {"func.getsockname.arg.2","socklen_t *,addrlen"}, 
+  {"func.__stack_chk_fail.ret","void"}, 
+  {"struct.NSString.str.meta","4"}, 
+  {"func.__libc_start_main.args","7"}, 
+  {"func._exit.arg.0","int,status"}, 
+  {"func.sigaction.arg.2","struct sigaction *,oldact"}, 
+  {"tputs","func"}, 
+  {"func.__assert_fail.ret","void"}, 
+  {"nanosleep","func"}, 
+  {"func.sigaction.arg.0","int,signum"}, 
+  {"func.recvfrom.arg.1","void *,buffer"}, 
+  {"__libc_start_main","func"}, 
+  {"func.setsockopt.arg.4","socklen_t,optlen"}, 
+  {"func.sigaction.arg.1","const struct sigaction *,act"}, 
+  {"func.recvfrom.arg.0","int,socket"}, 
+  {"sigaction","func"}, 
+  {"xalloc_die","func"}, 
+  {"func.recvfrom.arg.3","int,flags"}, 
+  {"func.recvfrom.arg.2","size_t,length"}, 
+  {"func.setsockopt.arg.0","int,sockfd"}, 
+  {"func.setsockopt.arg.1","int,level"}, 
+  {"func.__stack_chk_fail.args","0"}, 
+  {"func.setsockopt.arg.2","int,optname"}, 
+  {"func.setsockopt.arg.3","void *,optval"}, 
+  {"func.exit.args","1"}, 
+  {"func.err.args","1"}, 
+  {"func.errx.ret","void"}, 
+  {"struct.NSString.p1.meta","4"}, 
+  {"func.__assert_fail.arg.2","unsigned int,line"}, 
+  {"__libc_init","func"}, 
+  {"func.__assert_fail.arg.3","const char *,function"}, 
+  {"func.__assert_fail.arg.0","const char *,assertion"}, 
+  {"func.__assert_fail.arg.1","const char *,file"}, 
+  {"func.__assert_fail.args","4"}, 
+  {"func.xalloc_die.noreturn","true"}, 
+  {"func.nanosleep.ret","int"}, 
+  {"func.getsockopt.args","5"}, 
+  {"func.errx.args","1"}, 
+  {"func._exit.args","1"}, 
+  {"errc","func"}, 
+  {"func.access.ret","int"}, 
+  {"func.errx.noreturn","true"}, 
+  {"func.nanosleep.arg.0","const struct timespec *,req"}, 
+  {"func.__uClibc_main.args","7"}, 
+  {"func.nanosleep.arg.1","struct timespec *,rem"}, 
+  {"func.acl_free.ret","int"}, 
+  {"func.errc.noreturn","true"}, 
+  {"_Exit","func"}, 
+  {"func.__libc_init.arg.0","int,argc"}, 
+  {"func.__libc_init.arg.1","char **,argv"}, 
+  {"func.__libc_init.arg.2","char **,envp"}, 
+  {"__assert_fail","func"}, 
+  {"func.nanosleep.args","2"}, 
+  {"func._exit.noreturn","true"}, 
+  {"func.err.ret","void"}, 
+  {"func.waitid.ret","int"}, 
+  {"func.__assert_fail.noreturn","true"}, 
+  {"func.__assert_rtn.args","4"}, 
+  {"func.tputs.ret","int"}, 
+  {"errx","func"}, 
+  {"func._Exit.noreturn","true"}, 
+  {"func.__assert_rtn.arg.0","const char *,assertion"}, 
+  {"func.access.args","2"}, 
+  {"func.tputs.args","3"}, 
+  {"func.__assert_rtn.arg.1","const char *,file"}, 
+  {"func.setsockopt.args","5"}, 
+  {"func.__assert_rtn.arg.2","unsigned int,line"}, 
+  {"func.__assert_rtn.arg.3","const char *,function"}, 
+  {"struct.NSString","p0,p1,str,len"}, 
+  {"func.__libc_start_main.ret","int"}, 
+  {"waitpid","func"}, 
+  {"func.errc.arg.2","const char *,fmt"}, 
+  {"func.atexit.ret","int"}, 
+  {"func.errc.arg.1","int,code"}, 
+  {"func.wait.ret","pid_t"}, 
+  {"func.errc.arg.0","int,eval"}, 
+  {"func.__stack_chk_fail.noreturn","true"}, 
+  {"atexit","func"}, 
+  {"func.sigaction.ret","int"}, 
+  {"func.err.noreturn","true"}, 
+  {"func.waitpid.arg.2","int,options"}, 
+  {"func.waitpid.arg.1","int *,wstatus"}, 
+  {"func.waitpid.arg.0","pid_t,pid"}, 
+  {"access","func"}, 
+  {"func.__uClibc_main.noreturn","true"}, 
+  {NULL, NULL}
+};
+// 0x55ca59ba8170
+// TODO
+typedef int (*GperfForeachCallback)(void *user, const char *k, const char *v);
+int gperf_types_darwin_foreach(GperfForeachCallback cb, void *user) {
+  int i = 0; while (kvs[i].name) {
+  cb (user, kvs[i].name, kvs[i].value);
+  i++;}
+  return 0;
+}
+const char *gperf_types_darwin_get(const char *s) {
+  int i = 0; while (kvs[i].name) {
+  if (!strcmp (s, kvs[i].name)) return kvs[i].value;
+  i++;}
+  return NULL;
+}
+#define sdb_hash_c_types_darwin(x,y) gperf_types_darwin_hash(x)
+const unsigned int gperf_types_darwin_hash(const char *s) {
+  int sum = strlen (s);
+  while (*s) { sum += *s; s++; }
+  return sum;
+}
+struct {const char *name;void *get;void *hash;void *foreach;} gperf_types_darwin = {
+  .name = "types-darwin",
+  .get = &gperf_types_darwin_get,
+  .hash = &gperf_types_darwin_hash,
+  .foreach = &gperf_types_darwin_foreach
+};
+
+#if MAIN
+int main () {
+	const char *s = ((char*(*)(char*))gperf_types_darwin.get)("foo");
+	printf ("%s\n", s);
+}
+#endif
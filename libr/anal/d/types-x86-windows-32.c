@@ -0,0 +1,4879 @@
+// SDB-CGEN V1.9.4
+// gcc -DMAIN=1 types_x86_windows_32.c ; ./a.out > types_x86_windows_32.h
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+struct kv { const char *name; const char *value; };
+static const struct kv kvs[] = {
+  {"func.CryptContextAddRef.cc","stdcall"}, 
+  {"func.StartTraceW.cc","stdcall"}, 
+  {"func.BCryptProcessMultiOperations.cc","stdcall"}, 
+  {"func.BCryptDeriveKeyCapi.cc","stdcall"}, 
+  {"func.ImageRvaToSection.cc","stdcall"}, 
+  {"func.GetDefaultUserProfileDirectoryA.cc","stdcall"}, 
+  {"func.CM_Get_Parent.cc","stdcall"}, 
+  {"func.WSCGetProviderInfo32.cc","stdcall"}, 
+  {"func.SHOpenRegStream2A.cc","stdcall"}, 
+  {"func.SymEnumSourceFileTokens.cc","stdcall"}, 
+  {"func.GetSidSubAuthorityCount.cc","stdcall"}, 
+  {"func.GetRegisteredRawInputDevices.cc","stdcall"}, 
+  {"func.GetAtomNameW.cc","stdcall"}, 
+  {"func.RegOpenKeyA.cc","stdcall"}, 
+  {"func.PathSkipRootW.cc","stdcall"}, 
+  {"func.inet_addr.cc","stdcall"}, 
+  {"func.RegisterClassExA.cc","stdcall"}, 
+  {"func.IsDebuggerPresent.cc","stdcall"}, 
+  {"func.RegUnLoadKeyA.cc","stdcall"}, 
+  {"func.LeaveCriticalSection.cc","stdcall"}, 
+  {"func.CryptAcquireContextA.cc","stdcall"}, 
+  {"func.ReportEventW.cc","stdcall"}, 
+  {"func.CredIsMarshaledCredentialW.cc","stdcall"}, 
+  {"func.ldap_dn2ufnA.cc","cdecl"}, 
+  {"func.CredProtectW.cc","stdcall"}, 
+  {"func.WSAGetServiceClassInfoA.cc","stdcall"}, 
+  {"func.GetFileSecurityA.cc","stdcall"}, 
+  {"func.GetFileType.cc","stdcall"}, 
+  {"func.DeleteAppContainerProfile.cc","stdcall"}, 
+  {"func.SHFormatDateTimeW.cc","stdcall"}, 
+  {"func.VarUI4FromR4.cc","stdcall"}, 
+  {"func.RegDeleteKeyExA.cc","stdcall"}, 
+  {"func.SHRegDeleteEmptyUSKeyW.cc","stdcall"}, 
+  {"func.GetTypeByNameW.cc","stdcall"}, 
+  {"func.VarDateFromUI4.cc","stdcall"}, 
+  {"func.WideCharToMultiByte.cc","stdcall"}, 
+  {"func.CryptExportPublicKeyInfoFromBCryptKeyHandle.cc","stdcall"}, 
+  {"func.IsCharSpaceW.cc","stdcall"}, 
+  {"func.QueryServiceConfigW.cc","stdcall"}, 
+  {"func.LookupPrivilegeDisplayNameA.cc","stdcall"}, 
+  {"func.BeginPaint.cc","stdcall"}, 
+  {"func.RegQueryInfoKeyW.cc","stdcall"}, 
+  {"func.LHashValOfNameSys.cc","stdcall"}, 
+  {"func.CreateStatusWindowA.cc","stdcall"}, 
+  {"func.ShowHideMenuCtl.cc","stdcall"}, 
+  {"func.VarR8FromUI8.cc","stdcall"}, 
+  {"func.GetClipboardFormatNameW.cc","stdcall"}, 
+  {"func.UnDecorateSymbolName.cc","stdcall"}, 
+  {"func.K32InitializeProcessForWsWatch.cc","stdcall"}, 
+  {"func.SymEnumSymbols.cc","stdcall"}, 
+  {"func.CM_Set_DevNode_Property_ExW.cc","stdcall"}, 
+  {"func.UnmapViewOfFile.cc","stdcall"}, 
+  {"func.SetConsoleWindowInfo.cc","stdcall"}, 
+  {"func.EqualSid.cc","stdcall"}, 
+  {"func.ImageList_Merge.cc","stdcall"}, 
+  {"func.GetLastActivePopup.cc","stdcall"}, 
+  {"func.ImageList_Duplicate.cc","stdcall"}, 
+  {"func.VarR8FromI1.cc","stdcall"}, 
+  {"func.TrackPopupMenuEx.cc","stdcall"}, 
+  {"func.LookupPrivilegeValueW.cc","stdcall"}, 
+  {"func.GetTraceEnableLevel.cc","stdcall"}, 
+  {"func.CryptCloseAsyncHandle.cc","stdcall"}, 
+  {"func.PathIsDirectoryEmptyW.cc","stdcall"}, 
+  {"func.CryptInstallDefaultContext.cc","stdcall"}, 
+  {"func.UrlIsOpaqueW.cc","stdcall"}, 
+  {"func.WinHttpGetProxySettingsVersion.cc","stdcall"}, 
+  {"func.FlushInstructionCache.cc","stdcall"}, 
+  {"func.DrawEdge.cc","stdcall"}, 
+  {"func.NotifyServiceStatusChangeW.cc","stdcall"}, 
+  {"func.LoadAcceleratorsW.cc","stdcall"}, 
+  {"func.SymAddSymbol.cc","stdcall"}, 
+  {"func.GetStringScripts.cc","stdcall"}, 
+  {"func.EnableNonClientDpiScaling.cc","stdcall"}, 
+  {"func.UnregisterWaitEx.cc","stdcall"}, 
+  {"func.GetUserDefaultLocaleName.cc","stdcall"}, 
+  {"func.ldap_check_filterW.cc","cdecl"}, 
+  {"func.DosDateTimeToVariantTime.cc","stdcall"}, 
+  {"func.SafeArrayGetVartype.cc","stdcall"}, 
+  {"func.DeleteTimerQueueEx.cc","stdcall"}, 
+  {"func.SetCalendarInfoA.cc","stdcall"}, 
+  {"func.RegisterPowerSettingNotification.cc","stdcall"}, 
+  {"func.VarCyFromUI2.cc","stdcall"}, 
+  {"func.GetQueueStatus.cc","stdcall"}, 
+  {"func.ldap_first_attributeW.cc","cdecl"}, 
+  {"func.CallNamedPipeW.cc","stdcall"}, 
+  {"func.MapVirtualKeyW.cc","stdcall"}, 
+  {"func.RegQueryInfoKeyA.cc","stdcall"}, 
+  {"func.GetFileInformationByHandle.cc","stdcall"}, 
+  {"func.PathGetDriveNumberA.cc","stdcall"}, 
+  {"func.EnumProtocolsA.cc","stdcall"}, 
+  {"func.PathIsContentTypeW.cc","stdcall"}, 
+  {"func.EnumSystemLanguageGroupsW.cc","stdcall"}, 
+  {"func.WPUCloseSocketHandle.cc","stdcall"}, 
+  {"func.AddAuditAccessObjectAce.cc","stdcall"}, 
+  {"func.SymEnumTypes.cc","stdcall"}, 
+  {"func.IsTouchWindow.cc","stdcall"}, 
+  {"func.WSAImpersonateSocketPeer.cc","stdcall"}, 
+  {"func.DrawFocusRect.cc","stdcall"}, 
+  {"func.QueryActCtxSettingsW.cc","stdcall"}, 
+  {"func.UrlUnescapeW.cc","stdcall"}, 
+  {"func.RtlVirtualUnwind.cc","stdcall"}, 
+  {"func.VirtualUnlockEx.cc","stdcall"}, 
+  {"func.CloseWindowStation.cc","stdcall"}, 
+  {"func.RegOpenKeyExA.cc","stdcall"}, 
+  {"type.PVOID.size","32"}, 
+  {"func.ColorRGBToHLS.cc","stdcall"}, 
+  {"func.QueryIdleProcessorCycleTime.cc","stdcall"}, 
+  {"func.CryptSIPRetrieveSubjectGuid.cc","stdcall"}, 
+  {"func.CompareStringOrdinal.cc","stdcall"}, 
+  {"func.ReleaseSRWLockShared.cc","stdcall"}, 
+  {"func.CoIncrementMTAUsage.cc","stdcall"}, 
+  {"func.VarI8FromStr.cc","stdcall"}, 
+  {"func.HideCaret.cc","stdcall"}, 
+  {"func.WinHttpCreateProxyResolver.cc","stdcall"}, 
+  {"func.SetWindowLongW.cc","stdcall"}, 
+  {"func.CM_Set_DevNode_Registry_PropertyA.cc","stdcall"}, 
+  {"func.GetCommMask.cc","stdcall"}, 
+  {"func.CertEnumCTLsInStore.cc","stdcall"}, 
+  {"func.CryptDestroyHash.cc","stdcall"}, 
+  {"func.CM_Open_Device_Interface_KeyA.cc","stdcall"}, 
+  {"func.QueryProtectedPolicy.cc","stdcall"}, 
+  {"func.IdnToUnicode.cc","stdcall"}, 
+  {"func.MapVirtualKeyA.cc","stdcall"}, 
+  {"func.IsValidLocale.cc","stdcall"}, 
+  {"func.IStream_WritePidl.cc","stdcall"}, 
+  {"func.VarImp.cc","stdcall"}, 
+  {"func.PathGetDriveNumberW.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_Registry_Property_ExA.cc","stdcall"}, 
+  {"func.SHQueryInfoKeyA.cc","stdcall"}, 
+  {"func.SymPrev.cc","stdcall"}, 
+  {"func.OpenSemaphoreA.cc","stdcall"}, 
+  {"func.SetThreadErrorMode.cc","stdcall"}, 
+  {"func.VarUI8FromR8.cc","stdcall"}, 
+  {"func.DispCallFunc.cc","stdcall"}, 
+  {"func.CheckNameLegalDOS8Dot3W.cc","stdcall"}, 
+  {"func.ldap_search_extA.cc","cdecl"}, 
+  {"func.FindFirstStreamW.cc","stdcall"}, 
+  {"func.CredWriteW.cc","stdcall"}, 
+  {"func.SymGetSymNext64.cc","stdcall"}, 
+  {"func.K32GetDeviceDriverBaseNameW.cc","stdcall"}, 
+  {"func.LoadResource.cc","stdcall"}, 
+  {"func.SetThreadDescription.cc","stdcall"}, 
+  {"func.PathFindOnPathA.cc","stdcall"}, 
+  {"func.VarR4CmpR8.cc","stdcall"}, 
+  {"func.ldap_modrdn_sA.cc","cdecl"}, 
+  {"func.PathFindSuffixArrayA.cc","stdcall"}, 
+  {"func.VarBstrFromDisp.cc","stdcall"}, 
+  {"func.RegisterClassA.cc","stdcall"}, 
+  {"func.CM_Get_Class_Registry_PropertyA.cc","stdcall"}, 
+  {"func.GetCalendarInfoW.cc","stdcall"}, 
+  {"func.VarUI8FromUI2.cc","stdcall"}, 
+  {"func.DeleteUmsCompletionList.cc","stdcall"}, 
+  {"func.SymGetLinePrevW64.cc","stdcall"}, 
+  {"func.GetConsoleTitleW.cc","stdcall"}, 
+  {"func.EventAccessRemove.cc","stdcall"}, 
+  {"func.GetAppliedGPOListA.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_Property_Keys_ExW.cc","stdcall"}, 
+  {"func.BeginUpdateResourceA.cc","stdcall"}, 
+  {"func.SHAnsiToUnicode.cc","stdcall"}, 
+  {"func.lstrcmpW.cc","stdcall"}, 
+  {"func.AccessCheckByTypeResultListAndAuditAlarmByHandleA.cc","stdcall"}, 
+  {"func.VarR8FromStr.cc","stdcall"}, 
+  {"func.ldap_compare.cc","cdecl"}, 
+  {"func.CoGetMalloc.cc","stdcall"}, 
+  {"func.UnregisterPointerInputTarget.cc","stdcall"}, 
+  {"func.SymFromIndex.cc","stdcall"}, 
+  {"func.MapWindowPoints.cc","stdcall"}, 
+  {"func.NCryptFreeObject.cc","stdcall"}, 
+  {"func.CoImpersonateClient.cc","stdcall"}, 
+  {"func.PathAppendA.cc","stdcall"}, 
+  {"func.GetOsSafeBootMode.cc","stdcall"}, 
+  {"func.AddVectoredContinueHandler.cc","stdcall"}, 
+  {"func.QueryThreadProfiling.cc","stdcall"}, 
+  {"func.FreeConsole.cc","stdcall"}, 
+  {"func.VarFormatDateTime.cc","stdcall"}, 
+  {"func.EnumResourceLanguagesExA.cc","stdcall"}, 
+  {"func.GetWindowDisplayAffinity.cc","stdcall"}, 
+  {"func.CM_Set_Class_Registry_PropertyW.cc","stdcall"}, 
+  {"func.CredReadW.cc","stdcall"}, 
+  {"func.EnumWindowStationsW.cc","stdcall"}, 
+  {"func.ldap_stop_tls_s.cc","cdecl"}, 
+  {"func.ldap_parse_sort_control.cc","cdecl"}, 
+  {"func.UnregisterClassA.cc","stdcall"}, 
+  {"func.CredWriteDomainCredentialsA.cc","stdcall"}, 
+  {"func.InternalGetWindowText.cc","stdcall"}, 
+  {"func.SendMessageCallbackA.cc","stdcall"}, 
+  {"func.CryptUpdateProtectedState.cc","stdcall"}, 
+  {"func.ShutdownBlockReasonCreate.cc","stdcall"}, 
+  {"func.CoSetProxyBlanket.cc","stdcall"}, 
+  {"func.EnumDynamicTimeZoneInformation.cc","stdcall"}, 
+  {"func.GetSubMenu.cc","stdcall"}, 
+  {"func.LoadIconMetric.cc","stdcall"}, 
+  {"func.CloseServiceHandle.cc","stdcall"}, 
+  {"func.BeginUpdateResourceW.cc","stdcall"}, 
+  {"func.CoResumeClassObjects.cc","stdcall"}, 
+  {"func.GetFileVersionInfoW.cc","stdcall"}, 
+  {"func.WSASetEvent.cc","stdcall"}, 
+  {"func.CreateStdDispatch.cc","stdcall"}, 
+  {"func.LockSetForegroundWindow.cc","stdcall"}, 
+  {"func.SwapMouseButton.cc","stdcall"}, 
+  {"func.FlatSB_SetScrollPos.cc","stdcall"}, 
+  {"func.ProgIDFromCLSID.cc","stdcall"}, 
+  {"func.GetNumaProximityNodeEx.cc","stdcall"}, 
+  {"func.ldap_compare_ext_sA.cc","cdecl"}, 
+  {"func.IdnToAscii.cc","stdcall"}, 
+  {"func.DeleteProfileW.cc","stdcall"}, 
+  {"func.SetThreadGroupAffinity.cc","stdcall"}, 
+  {"func.SetScrollRange.cc","stdcall"}, 
+  {"func.ldap_search_init_pageA.cc","cdecl"}, 
+  {"func.SHRegQueryInfoUSKeyA.cc","stdcall"}, 
+  {"func.WinHttpGetProxyForUrlEx2.cc","stdcall"}, 
+  {"func.SHDeleteValueW.cc","stdcall"}, 
+  {"func.SHGetFileInfoA.cc","stdcall"}, 
+  {"func.CM_Delete_DevNode_Key_Ex.cc","stdcall"}, 
+  {"func.CM_Get_Child_Ex.cc","stdcall"}, 
+  {"func.SymGetSymPrev.cc","stdcall"}, 
+  {"func.RemovePropW.cc","stdcall"}, 
+  {"func.VarUI8FromI4.cc","stdcall"}, 
+  {"func.GetGPOListA.cc","stdcall"}, 
+  {"func.TranslateAcceleratorW.cc","stdcall"}, 
+  {"func.ldap_delete_s.cc","cdecl"}, 
+  {"func.MsgWaitForMultipleObjectsEx.cc","stdcall"}, 
+  {"func.PathUndecorateW.cc","stdcall"}, 
+  {"func.RegQueryMultipleValuesA.cc","stdcall"}, 
+  {"func.GetSystemMetrics.cc","stdcall"}, 
+  {"func.GetUserDefaultGeoName.cc","stdcall"}, 
+  {"func.FrameRect.cc","stdcall"}, 
+  {"func.GetSystemTimeAsFileTime.cc","stdcall"}, 
+  {"func.CredReadA.cc","stdcall"}, 
+  {"func.HIMAGELIST_QueryInterface.cc","stdcall"}, 
+  {"func.CryptAcquireContextW.cc","stdcall"}, 
+  {"func.GetProcessImageFileNameW.cc","stdcall"}, 
+  {"func.RegCreateKeyExW.cc","stdcall"}, 
+  {"func.EnumTimeFormatsEx.cc","stdcall"}, 
+  {"func.VarBoolFromStr.cc","stdcall"}, 
+  {"func.DllUnregisterServer.cc","stdcall"}, 
+  {"func.CertGetPublicKeyLength.cc","stdcall"}, 
+  {"func.DestroyWindow.cc","stdcall"}, 
+  {"func.ImageList_SetOverlayImage.cc","stdcall"}, 
+  {"func.CryptMsgGetParam.cc","stdcall"}, 
+  {"func.PathCchIsRoot.cc","stdcall"}, 
+  {"func.SHLoadIndirectString.cc","stdcall"}, 
+  {"func.FreeLibraryAndExitThread.cc","stdcall"}, 
+  {"func.RegGetValueA.cc","stdcall"}, 
+  {"func.IsDlgButtonChecked.cc","stdcall"}, 
+  {"func.CredUICmdLinePromptForCredentialsW.cc","stdcall"}, 
+  {"func.LocaleNameToLCID.cc","stdcall"}, 
+  {"func.RegDeleteKeyExW.cc","stdcall"}, 
+  {"func.WSASendMsg.cc","stdcall"}, 
+  {"func.CM_Invert_Range_List.cc","stdcall"}, 
+  {"func.GlobalCompact.cc","stdcall"}, 
+  {"func.CM_Get_Next_Res_Des.cc","stdcall"}, 
+  {"func.QueryServiceConfigA.cc","stdcall"}, 
+  {"func.PathCchAppend.cc","stdcall"}, 
+  {"func.DrawMenuBar.cc","stdcall"}, 
+  {"func.SymFindExecutableImageW.cc","stdcall"}, 
+  {"func.EnumDependentServicesA.cc","stdcall"}, 
+  {"func.ImageList_Create.cc","stdcall"}, 
+  {"func.CM_Request_Device_EjectA.cc","stdcall"}, 
+  {"func.GetConsoleOriginalTitleW.cc","stdcall"}, 
+  {"func.QueryUnbiasedInterruptTime.cc","stdcall"}, 
+  {"func.SetActiveWindow.cc","stdcall"}, 
+  {"func.SafeArrayAccessData.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_Status.cc","stdcall"}, 
+  {"func.VarUdateFromDate.cc","stdcall"}, 
+  {"func.TranslateMessage.cc","stdcall"}, 
+  {"func.LCMapStringA.cc","stdcall"}, 
+  {"func.GlobalDeleteAtom.cc","stdcall"}, 
+  {"func.CredFindBestCredentialW.cc","stdcall"}, 
+  {"func.VkKeyScanExA.cc","stdcall"}, 
+  {"func.InitializeProcessForWsWatch.cc","stdcall"}, 
+  {"func.GetCommPorts.cc","stdcall"}, 
+  {"func.VarI1FromUI1.cc","stdcall"}, 
+  {"func.RegisterGPNotification.cc","stdcall"}, 
+  {"func.ldap_compare_sW.cc","cdecl"}, 
+  {"func.DrawStatusTextA.cc","stdcall"}, 
+  {"func.GetUserGeoID.cc","stdcall"}, 
+  {"func.CertIsValidCRLForCertificate.cc","stdcall"}, 
+  {"func.SymGetModuleInfo64.cc","stdcall"}, 
+  {"func.IStream_Copy.cc","stdcall"}, 
+  {"func.ldap_free_controls.cc","cdecl"}, 
+  {"func.SymGetLineFromInlineContext.cc","stdcall"}, 
+  {"func.PathUnmakeSystemFolderA.cc","stdcall"}, 
+  {"func.CreateFile2.cc","stdcall"}, 
+  {"func.ObjectDeleteAuditAlarmA.cc","stdcall"}, 
+  {"func.ldap_modifyW.cc","cdecl"}, 
+  {"func.SetDynamicTimeZoneInformation.cc","stdcall"}, 
+  {"func.GetMessagePos.cc","stdcall"}, 
+  {"func.VarI1FromUI2.cc","stdcall"}, 
+  {"func.WSAAddressToStringW.cc","stdcall"}, 
+  {"func.UpdateResourceW.cc","stdcall"}, 
+  {"func.OutputDebugStringW.cc","stdcall"}, 
+  {"func.ldap_next_reference.cc","cdecl"}, 
+  {"func.DeleteUmsThreadContext.cc","stdcall"}, 
+  {"func.WSAEnumNameSpaceProvidersExW.cc","stdcall"}, 
+  {"func.GetActiveObject.cc","stdcall"}, 
+  {"func.PathIsRelativeW.cc","stdcall"}, 
+  {"func.PathUnquoteSpacesA.cc","stdcall"}, 
+  {"func.SHGetPropertyStoreFromParsingName.cc","stdcall"}, 
+  {"func.UnregisterTraceGuids.cc","stdcall"}, 
+  {"func.VarI4FromR8.cc","stdcall"}, 
+  {"func.EnumDependentServicesW.cc","stdcall"}, 
+  {"func.InitializeFlatSB.cc","stdcall"}, 
+  {"func.BCryptGenRandom.cc","stdcall"}, 
+  {"func.StrCSpnIW.cc","stdcall"}, 
+  {"func.SetMessageQueue.cc","stdcall"}, 
+  {"func.ldap_start_tls_sA.cc","cdecl"}, 
+  {"func.CertDeleteCTLFromStore.cc","stdcall"}, 
+  {"func.QueryAllTracesW.cc","stdcall"}, 
+  {"func.CM_Enable_DevNode.cc","stdcall"}, 
+  {"func.GetKeyboardLayout.cc","stdcall"}, 
+  {"func.SymGetLineNextW64.cc","stdcall"}, 
+  {"func.IsWow64Message.cc","stdcall"}, 
+  {"func.SymEnumSymbolsEx.cc","stdcall"}, 
+  {"func.AddAccessAllowedAceEx.cc","stdcall"}, 
+  {"func.CM_Reenumerate_DevNode.cc","stdcall"}, 
+  {"func.WaitForMultipleObjects.cc","stdcall"}, 
+  {"func.GetFocus.cc","stdcall"}, 
+  {"func.RegCreateKeyTransactedW.cc","stdcall"}, 
+  {"func.ControlTraceW.cc","stdcall"}, 
+  {"func.OpenEncryptedFileRawA.cc","stdcall"}, 
+  {"func.VarUI1FromR8.cc","stdcall"}, 
+  {"func.InvertRect.cc","stdcall"}, 
+  {"func.SymSetHomeDirectory.cc","stdcall"}, 
+  {"func.CertGetNameStringA.cc","stdcall"}, 
+  {"func.listen.cc","stdcall"}, 
+  {"func.CryptGetDefaultProviderW.cc","stdcall"}, 
+  {"func.CertDuplicateCertificateContext.cc","stdcall"}, 
+  {"func.GetDeviceDriverFileNameA.cc","stdcall"}, 
+  {"func.CM_Query_Arbitrator_Free_Data_Ex.cc","stdcall"}, 
+  {"func.NCryptExportKey.cc","stdcall"}, 
+  {"func.PathIsRelativeA.cc","stdcall"}, 
+  {"func.BCryptSetContextFunctionProperty.cc","stdcall"}, 
+  {"func.CertGetEnhancedKeyUsage.cc","stdcall"}, 
+  {"func.LookupAccountNameLocalA.cc","stdcall"}, 
+  {"func.SafeArrayLock.cc","stdcall"}, 
+  {"func.SHCopyKeyA.cc","stdcall"}, 
+  {"func.WriteConsoleOutputCharacterA.cc","stdcall"}, 
+  {"func.CryptFreeOIDFunctionAddress.cc","stdcall"}, 
+  {"func.GetThreadInformation.cc","stdcall"}, 
+  {"func.GetUserObjectInformationW.cc","stdcall"}, 
+  {"func.StrCmpIW.cc","stdcall"}, 
+  {"func.ImageList_Destroy.cc","stdcall"}, 
+  {"func.ShellExecuteA.cc","stdcall"}, 
+  {"func.InvalidateRgn.cc","stdcall"}, 
+  {"func.CM_Query_Remove_SubTree.cc","stdcall"}, 
+  {"func.BCryptUnregisterConfigChangeNotify.cc","stdcall"}, 
+  {"func.LockFile.cc","stdcall"}, 
+  {"func.CreateTypeLib.cc","stdcall"}, 
+  {"func.ShellAboutW.cc","stdcall"}, 
+  {"func.QueryProcessCycleTime.cc","stdcall"}, 
+  {"func.SetFileValidData.cc","stdcall"}, 
+  {"func.PathQuoteSpacesA.cc","stdcall"}, 
+  {"func.CoCreateInstanceEx.cc","stdcall"}, 
+  {"func.CoInitialize.cc","stdcall"}, 
+  {"func.GetMessageW.cc","stdcall"}, 
+  {"func.CryptImportPKCS8.cc","stdcall"}, 
+  {"func.FindResourceExA.cc","stdcall"}, 
+  {"func.ImageList_GetBkColor.cc","stdcall"}, 
+  {"func.WSCSetProviderInfo32.cc","stdcall"}, 
+  {"func.ChangeDisplaySettingsExW.cc","stdcall"}, 
+  {"func.GetAutoRotationState.cc","stdcall"}, 
+  {"func.PropVariantCopy.cc","stdcall"}, 
+  {"func.CreateFiberEx.cc","stdcall"}, 
+  {"func.ImageList_Read.cc","stdcall"}, 
+  {"func.LeaveCriticalSectionWhenCallbackReturns.cc","stdcall"}, 
+  {"func.SubtractRect.cc","stdcall"}, 
+  {"type.HMONITOR.size","32"}, 
+  {"func.Shell_NotifyIconW.cc","stdcall"}, 
+  {"func.SetEndOfFile.cc","stdcall"}, 
+  {"func.SetThreadpoolThreadMaximum.cc","stdcall"}, 
+  {"func.SHGlobalCounterGetValue.cc","stdcall"}, 
+  {"func.RegisterShellHookWindow.cc","stdcall"}, 
+  {"func.DebugBreak.cc","stdcall"}, 
+  {"func.CM_Get_Class_NameW.cc","stdcall"}, 
+  {"func.SymNextW.cc","stdcall"}, 
+  {"func.ldap_search_stA.cc","cdecl"}, 
+  {"func.GetScaleFactorForDevice.cc","stdcall"}, 
+  {"func.SHGetAssocKeys.cc","stdcall"}, 
+  {"func.PathAppendW.cc","stdcall"}, 
+  {"func.CryptSetKeyIdentifierProperty.cc","stdcall"}, 
+  {"func.VarIdiv.cc","stdcall"}, 
+  {"func.LoadLibraryA.cc","stdcall"}, 
+  {"func.VarDecFromI2.cc","stdcall"}, 
+  {"func.CredPackAuthenticationBufferA.cc","stdcall"}, 
+  {"func.CopyAcceleratorTableW.cc","stdcall"}, 
+  {"func.ldap_search_ext.cc","cdecl"}, 
+  {"func.GetSystemDefaultLocaleName.cc","stdcall"}, 
+  {"func.BroadcastSystemMessage.cc","stdcall"}, 
+  {"func.CoGetCallContext.cc","stdcall"}, 
+  {"func.GetClassWord.cc","stdcall"}, 
+  {"func.FindExecutableImage.cc","stdcall"}, 
+  {"func.RegFlushKey.cc","stdcall"}, 
+  {"func.SetSystemTimeAdjustment.cc","stdcall"}, 
+  {"func.CertAddEncodedCertificateToStore.cc","stdcall"}, 
+  {"func.VarUI2FromR4.cc","stdcall"}, 
+  {"func.IsInternetESCEnabled.cc","stdcall"}, 
+  {"func.ldap_compare_ext_s.cc","cdecl"}, 
+  {"func.CoAddRefServerProcess.cc","stdcall"}, 
+  {"func.WSCEnumNameSpaceProviders32.cc","stdcall"}, 
+  {"func.GetNLSVersionEx.cc","stdcall"}, 
+  {"func.ldap_first_attribute.cc","cdecl"}, 
+  {"func.IsCharAlphaW.cc","stdcall"}, 
+  {"func.WaitForThreadpoolIoCallbacks.cc","stdcall"}, 
+  {"func.TrackPopupMenu.cc","stdcall"}, 
+  {"func.InitOnceExecuteOnce.cc","stdcall"}, 
+  {"func.WriteProcessMemory.cc","stdcall"}, 
+  {"func.PathIsFileSpecA.cc","stdcall"}, 
+  {"func.CertStrToNameA.cc","stdcall"}, 
+  {"func.GetAddrInfoW.cc","stdcall"}, 
+  {"func.WPUSetEvent.cc","stdcall"}, 
+  {"func.BCryptQueryProviderRegistration.cc","stdcall"}, 
+  {"func.RegisterScaleChangeNotifications.cc","stdcall"}, 
+  {"func.GetConsoleOutputCP.cc","stdcall"}, 
+  {"func.UpdateLayeredWindow.cc","stdcall"}, 
+  {"func.GetFileAttributesExA.cc","stdcall"}, 
+  {"func.GetPrivateProfileStructW.cc","stdcall"}, 
+  {"func.GetSystemWow64DirectoryW.cc","stdcall"}, 
+  {"func.CM_Get_Log_Conf_Priority.cc","stdcall"}, 
+  {"func.SetEnvironmentVariableA.cc","stdcall"}, 
+  {"func.GetMaximumProcessorCount.cc","stdcall"}, 
+  {"func.CertEnumSubjectInSortedCTL.cc","stdcall"}, 
+  {"func.StopTraceW.cc","stdcall"}, 
+  {"func.GetProfileIntW.cc","stdcall"}, 
+  {"func.UnregisterSuspendResumeNotification.cc","stdcall"}, 
+  {"func.GetKeyboardType.cc","stdcall"}, 
+  {"func.VarDecSub.cc","stdcall"}, 
+  {"func.CoSwitchCallContext.cc","stdcall"}, 
+  {"func.NCryptNotifyChangeKey.cc","stdcall"}, 
+  {"func.GetDiskFreeSpaceExW.cc","stdcall"}, 
+  {"func.FindNLSString.cc","stdcall"}, 
+  {"func.ExtractIconA.cc","stdcall"}, 
+  {"func.SetProcessMitigationPolicy.cc","stdcall"}, 
+  {"func.CM_Get_Class_Name_ExA.cc","stdcall"}, 
+  {"func.DeleteFiber.cc","stdcall"}, 
+  {"func.RemoveMenu.cc","stdcall"}, 
+  {"func.VarUI4FromBool.cc","stdcall"}, 
+  {"func.ImageDirectoryEntryToData.cc","stdcall"}, 
+  {"func.SetWindowWord.cc","stdcall"}, 
+  {"func.SetFileApisToOEM.cc","stdcall"}, 
+  {"func.VirtualAllocFromApp.cc","stdcall"}, 
+  {"func.GetUserProfileDirectoryA.cc","stdcall"}, 
+  {"func.ntohf.cc","stdcall"}, 
+  {"func.FreeAddrInfoW.cc","stdcall"}, 
+  {"func.ImageList_DragMove.cc","stdcall"}, 
+  {"func.SystemTimeToTzSpecificLocalTime.cc","stdcall"}, 
+  {"func.PathAllocCanonicalize.cc","stdcall"}, 
+  {"func.CancelIoEx.cc","stdcall"}, 
+  {"func.OpenFileMappingFromApp.cc","stdcall"}, 
+  {"func.SetTapePosition.cc","stdcall"}, 
+  {"func.CM_Modify_Res_Des_Ex.cc","stdcall"}, 
+  {"func.MoveFileWithProgressA.cc","stdcall"}, 
+  {"func.PathIsFileSpecW.cc","stdcall"}, 
+  {"func.IsDialogMessageW.cc","stdcall"}, 
+  {"func.CertAddCertificateLinkToStore.cc","stdcall"}, 
+  {"func.GetNameByTypeW.cc","stdcall"}, 
+  {"func.UrlApplySchemeW.cc","stdcall"}, 
+  {"func.PostThreadMessageA.cc","stdcall"}, 
+  {"func.CM_Merge_Range_List.cc","stdcall"}, 
+  {"func.OemToCharW.cc","stdcall"}, 
+  {"func.IsWow64Process2.cc","stdcall"}, 
+  {"func.VerQueryValueA.cc","stdcall"}, 
+  {"func.TraceEventInstance.cc","stdcall"}, 
+  {"func.VarI4FromUI4.cc","stdcall"}, 
+  {"func.RegisterRawInputDevices.cc","stdcall"}, 
+  {"func.EnableTraceEx.cc","stdcall"}, 
+  {"func.BackupEventLogW.cc","stdcall"}, 
+  {"func.ber_skip_tag.cc","cdecl"}, 
+  {"func.RegQueryValueW.cc","stdcall"}, 
+  {"func.GetGestureInfo.cc","stdcall"}, 
+  {"type.HPALETTE.size","32"}, 
+  {"func.GetThreadTimes.cc","stdcall"}, 
+  {"func.ldap_sasl_bind_sW.cc","cdecl"}, 
+  {"func.ArrangeIconicWindows.cc","stdcall"}, 
+  {"func.SHGetLocalizedName.cc","stdcall"}, 
+  {"func.SetCaretPos.cc","stdcall"}, 
+  {"func.ldap_get_values_lenW.cc","cdecl"}, 
+  {"func.LoadIconA.cc","stdcall"}, 
+  {"func.WriteProfileStringA.cc","stdcall"}, 
+  {"func.CM_Register_Device_Interface_ExA.cc","stdcall"}, 
+  {"func.SymGetSymFromName64.cc","stdcall"}, 
+  {"func.EnumerateLoadedModules.cc","stdcall"}, 
+  {"func.SymSetHomeDirectoryW.cc","stdcall"}, 
+  {"func.OaBuildVersion.cc","stdcall"}, 
+  {"func.GetPointerPenInfoHistory.cc","stdcall"}, 
+  {"func.GetAddrInfoExW.cc","stdcall"}, 
+  {"func.CryptHashCertificate.cc","stdcall"}, 
+  {"func.PathUnExpandEnvStringsA.cc","stdcall"}, 
+  {"func.CM_Register_Device_Driver_Ex.cc","stdcall"}, 
+  {"func.LeaveCriticalPolicySection.cc","stdcall"}, 
+  {"func.VarI2FromBool.cc","stdcall"}, 
+  {"func.EncryptFileA.cc","stdcall"}, 
+  {"func.GetDpiForMonitor.cc","stdcall"}, 
+  {"func.SymEnumerateSymbols.cc","stdcall"}, 
+  {"func.WSAAddressToStringA.cc","stdcall"}, 
+  {"func.UrlApplySchemeA.cc","stdcall"}, 
+  {"func.PathIsPrefixA.cc","stdcall"}, 
+  {"func.CertEnumCRLsInStore.cc","stdcall"}, 
+  {"func.PostThreadMessageW.cc","stdcall"}, 
+  {"func.DlgDirSelectExW.cc","stdcall"}, 
+  {"func.CreateWaitableTimerExW.cc","stdcall"}, 
+  {"func.InitializeConditionVariable.cc","stdcall"}, 
+  {"func.GetProcessGroupAffinity.cc","stdcall"}, 
+  {"func.SetPriorityClass.cc","stdcall"}, 
+  {"func.NCryptFinalizeKey.cc","stdcall"}, 
+  {"func.VarI2FromDec.cc","stdcall"}, 
+  {"func.SetWindowTextW.cc","stdcall"}, 
+  {"func.KillTimer.cc","stdcall"}, 
+  {"func.UnhandledExceptionFilter.cc","stdcall"}, 
+  {"func.RegLoadKeyA.cc","stdcall"}, 
+  {"func.AccessCheck.cc","stdcall"}, 
+  {"func.DeleteCriticalSection.cc","stdcall"}, 
+  {"func.SetComputerNameEx2W.cc","stdcall"}, 
+  {"func.GetPointerFrameInfoHistory.cc","stdcall"}, 
+  {"func.ldap_memfreeA.cc","cdecl"}, 
+  {"func.K32GetMappedFileNameA.cc","stdcall"}, 
+  {"func.SHLoadNonloadedIconOverlayIdentifiers.cc","stdcall"}, 
+  {"func.SetSystemCursor.cc","stdcall"}, 
+  {"func.VarUI4FromDec.cc","stdcall"}, 
+  {"func.WSACreateEvent.cc","stdcall"}, 
+  {"func.SHCreateItemInKnownFolder.cc","stdcall"}, 
+  {"func.GlobalWire.cc","stdcall"}, 
+  {"func.CopyRect.cc","stdcall"}, 
+  {"func.GlobalAddAtomExA.cc","stdcall"}, 
+  {"func.WriteFileGather.cc","stdcall"}, 
+  {"func.EnumUILanguagesW.cc","stdcall"}, 
+  {"func.VarI1FromStr.cc","stdcall"}, 
+  {"func.EventEnabled.cc","stdcall"}, 
+  {"func.SetPropA.cc","stdcall"}, 
+  {"func.CryptSetProviderExW.cc","stdcall"}, 
+  {"func.CryptGenKey.cc","stdcall"}, 
+  {"func.ldap_rename_ext_s.cc","cdecl"}, 
+  {"func.ReadConsoleOutputW.cc","stdcall"}, 
+  {"func.VarUI8FromDisp.cc","stdcall"}, 
+  {"func.VarBstrFromR4.cc","stdcall"}, 
+  {"func.CryptUnprotectMemory.cc","stdcall"}, 
+  {"func.ldap_delete.cc","cdecl"}, 
+  {"func.PeekConsoleInputW.cc","stdcall"}, 
+  {"func.VarR4FromStr.cc","stdcall"}, 
+  {"func.GetCPInfoExA.cc","stdcall"}, 
+  {"func.ldap_set_optionW.cc","cdecl"}, 
+  {"func.CM_Free_Log_Conf_Handle.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_ListA.cc","stdcall"}, 
+  {"func.CreateDirectoryTransactedA.cc","stdcall"}, 
+  {"func.ldap_count_entries.cc","cdecl"}, 
+  {"func.GetProcessPriorityBoost.cc","stdcall"}, 
+  {"func.VarDecFromBool.cc","stdcall"}, 
+  {"func.ldap_modrdn2_s.cc","cdecl"}, 
+  {"func.CM_Request_Eject_PC_Ex.cc","stdcall"}, 
+  {"func.InitiateShutdownA.cc","stdcall"}, 
+  {"func.LoadLibraryExW.cc","stdcall"}, 
+  {"func.GetMessageA.cc","stdcall"}, 
+  {"func.CryptMsgOpenToDecode.cc","stdcall"}, 
+  {"func.StrFormatByteSizeA.cc","stdcall"}, 
+  {"func.CryptMemFree.cc","stdcall"}, 
+  {"func.GetWindowLongW.cc","stdcall"}, 
+  {"func.CoReleaseServerProcess.cc","stdcall"}, 
+  {"func.LocalFree.cc","stdcall"}, 
+  {"func.CryptExportKey.cc","stdcall"}, 
+  {"func.StrRChrA.cc","stdcall"}, 
+  {"func.OleLoadPicturePath.cc","stdcall"}, 
+  {"func.GetProfilesDirectoryA.cc","stdcall"}, 
+  {"func.ldap_cleanup.cc","cdecl"}, 
+  {"func.CM_Get_DevNode_Custom_PropertyA.cc","stdcall"}, 
+  {"func.AssocGetPerceivedType.cc","stdcall"}, 
+  {"func.SetLastErrorEx.cc","stdcall"}, 
+  {"func.ShowWindow.cc","stdcall"}, 
+  {"type.HHOOK.size","32"}, 
+  {"func.CancelShutdown.cc","stdcall"}, 
+  {"func.CertGetSubjectCertificateFromStore.cc","stdcall"}, 
+  {"func.SafeArrayGetLBound.cc","stdcall"}, 
+  {"func.ImageList_Add.cc","stdcall"}, 
+  {"func.CryptDeriveKey.cc","stdcall"}, 
+  {"func.VarR8FromDate.cc","stdcall"}, 
+  {"func.CredUIConfirmCredentialsW.cc","stdcall"}, 
+  {"func.StrFromTimeIntervalW.cc","stdcall"}, 
+  {"func.RtlAddGrowableFunctionTable.cc","stdcall"}, 
+  {"func.SymPrevW.cc","stdcall"}, 
+  {"func.PathIsUNCW.cc","stdcall"}, 
+  {"func.CertCreateContext.cc","stdcall"}, 
+  {"func.CertFindChainInStore.cc","stdcall"}, 
+  {"func.GetLocaleInfoA.cc","stdcall"}, 
+  {"func.VarI1FromDisp.cc","stdcall"}, 
+  {"func.StartTraceA.cc","stdcall"}, 
+  {"func.PFXVerifyPassword.cc","stdcall"}, 
+  {"func.AreAnyAccessesGranted.cc","stdcall"}, 
+  {"type.HALF_PTR.size","16"}, 
+  {"func.CertRetrieveLogoOrBiometricInfo.cc","stdcall"}, 
+  {"func.StrToIntExW.cc","stdcall"}, 
+  {"func.EqualPrefixSid.cc","stdcall"}, 
+  {"func.UrlCombineA.cc","stdcall"}, 
+  {"func.WSAAsyncSelect.cc","stdcall"}, 
+  {"func.VirtualProtectEx.cc","stdcall"}, 
+  {"func.GetModuleHandleExA.cc","stdcall"}, 
+  {"func.MoveWindow.cc","stdcall"}, 
+  {"func.CM_Get_Global_State.cc","stdcall"}, 
+  {"func.CertVerifyCRLTimeValidity.cc","stdcall"}, 
+  {"func.SetKernelObjectSecurity.cc","stdcall"}, 
+  {"func.GetSystemDefaultUILanguage.cc","stdcall"}, 
+  {"func.VarR8FromUI1.cc","stdcall"}, 
+  {"func.CM_Get_Depth_Ex.cc","stdcall"}, 
+  {"func.SHSendMessageBroadcastA.cc","stdcall"}, 
+  {"func.ImageList_SetBkColor.cc","stdcall"}, 
+  {"func.OpenFile.cc","stdcall"}, 
+  {"func.QueryWorkingSetEx.cc","stdcall"}, 
+  {"func.EnableMouseInPointerForThread.cc","stdcall"}, 
+  {"func.CM_Intersect_Range_List.cc","stdcall"}, 
+  {"func.VarUI1FromUI4.cc","stdcall"}, 
+  {"func.InterlockedFlushSList.cc","stdcall"}, 
+  {"func.CoGetClassObject.cc","stdcall"}, 
+  {"func.ldap_free_controlsW.cc","cdecl"}, 
+  {"func.VarUI4FromStr.cc","stdcall"}, 
+  {"func.VarI8FromR8.cc","stdcall"}, 
+  {"func.EnumSystemCodePagesW.cc","stdcall"}, 
+  {"type.HRESULT.size","32"}, 
+  {"func.SHSetValueA.cc","stdcall"}, 
+  {"func.SetProcessWorkingSetSize.cc","stdcall"}, 
+  {"func.GetFileAttributesExW.cc","stdcall"}, 
+  {"func.SHDeleteKeyA.cc","stdcall"}, 
+  {"func.VarR4FromUI2.cc","stdcall"}, 
+  {"func.GetHGlobalFromStream.cc","stdcall"}, 
+  {"func.GetSystemDEPPolicy.cc","stdcall"}, 
+  {"func.IsMouseInPointerEnabled.cc","stdcall"}, 
+  {"func.CM_Get_Class_Property_Keys.cc","stdcall"}, 
+  {"func.RegEnableReflectionKey.cc","stdcall"}, 
+  {"func.PathCanonicalizeW.cc","stdcall"}, 
+  {"func.WSCEnableNSProvider.cc","stdcall"}, 
+  {"func.GetCompressedFileSizeTransactedA.cc","stdcall"}, 
+  {"func.CoRegisterPSClsid.cc","stdcall"}, 
+  {"func.CoGetStdMarshalEx.cc","stdcall"}, 
+  {"func.SoundSentry.cc","stdcall"}, 
+  {"func.WSAIsBlocking.cc","stdcall"}, 
+  {"func.DeleteEnclave.cc","stdcall"}, 
+  {"func.WritePrivateProfileSectionW.cc","stdcall"}, 
+  {"func.FlatSB_SetScrollInfo.cc","stdcall"}, 
+  {"func.StrStrNW.cc","stdcall"}, 
+  {"func.SetConsoleTitleW.cc","stdcall"}, 
+  {"func.ImageList_GetImageCount.cc","stdcall"}, 
+  {"func.UrlIsNoHistoryA.cc","stdcall"}, 
+  {"func.GetComputerNameExW.cc","stdcall"}, 
+  {"func.K32GetModuleInformation.cc","stdcall"}, 
+  {"func.SetWindowDisplayAffinity.cc","stdcall"}, 
+  {"func.GetServiceDisplayNameW.cc","stdcall"}, 
+  {"func.GetProcessPreferredUILanguages.cc","stdcall"}, 
+  {"func.ldap_rename_ext_sA.cc","cdecl"}, 
+  {"func.AddAuditAccessAceEx.cc","stdcall"}, 
+  {"func.GetActiveProcessorCount.cc","stdcall"}, 
+  {"func.MonikerCommonPrefixWith.cc","stdcall"}, 
+  {"func.VarUI1FromDate.cc","stdcall"}, 
+  {"func.InheritWindowMonitor.cc","stdcall"}, 
+  {"func.SHDeleteKeyW.cc","stdcall"}, 
+  {"func.CM_Get_Class_Key_NameW.cc","stdcall"}, 
+  {"func.VarI4FromDec.cc","stdcall"}, 
+  {"func.SetScrollPos.cc","stdcall"}, 
+  {"func.GetClipboardOwner.cc","stdcall"}, 
+  {"func.FreeLibraryWhenCallbackReturns.cc","stdcall"}, 
+  {"func.UrlFixupW.cc","stdcall"}, 
+  {"func.SymGetModuleInfoW.cc","stdcall"}, 
+  {"func.WinHttpReceiveResponse.cc","stdcall"}, 
+  {"func.EnumProtocolsW.cc","stdcall"}, 
+  {"func.EnumSystemFirmwareTables.cc","stdcall"}, 
+  {"func.VarUI2FromUI4.cc","stdcall"}, 
+  {"func._lopen.cc","stdcall"}, 
+  {"func.VarUI8FromUI4.cc","stdcall"}, 
+  {"func.K32QueryWorkingSet.cc","stdcall"}, 
+  {"func.WinHttpWriteData.cc","stdcall"}, 
+  {"func.CryptGetTimeValidObject.cc","stdcall"}, 
+  {"func.CoLockObjectExternal.cc","stdcall"}, 
+  {"func.CM_Free_Res_Des_Handle.cc","stdcall"}, 
+  {"func.StrCatBuffW.cc","stdcall"}, 
+  {"func.RegisterApplicationRecoveryCallback.cc","stdcall"}, 
+  {"func.ResetWriteWatch.cc","stdcall"}, 
+  {"func.CM_Set_HW_Prof_Flags_ExA.cc","stdcall"}, 
+  {"func.ldap_sslinitW.cc","cdecl"}, 
+  {"func.EnumTimeFormatsA.cc","stdcall"}, 
+  {"func.ldap_modify_ext_sA.cc","cdecl"}, 
+  {"func.InterlockedPopEntrySList.cc","stdcall"}, 
+  {"func.LookupPrivilegeNameW.cc","stdcall"}, 
+  {"func.IStream_WriteStr.cc","stdcall"}, 
+  {"func.SymGetSearchPath.cc","stdcall"}, 
+  {"func.VarDateFromStr.cc","stdcall"}, 
+  {"func.SymSetExtendedOption.cc","stdcall"}, 
+  {"func.CryptUnregisterOIDFunction.cc","stdcall"}, 
+  {"func.DialogBoxParamW.cc","stdcall"}, 
+  {"func.WriteProfileStringW.cc","stdcall"}, 
+  {"func.CertAddStoreToCollection.cc","stdcall"}, 
+  {"func.wvnsprintfA.cc","stdcall"}, 
+  {"func.VarUI1FromI1.cc","stdcall"}, 
+  {"func.GetComputerNameExA.cc","stdcall"}, 
+  {"func.GetPrivateProfileSectionW.cc","stdcall"}, 
+  {"func.SymMatchFileNameW.cc","stdcall"}, 
+  {"func.EnumSystemGeoID.cc","stdcall"}, 
+  {"func.FindDebugInfoFileEx.cc","stdcall"}, 
+  {"func.ChangeClipboardChain.cc","stdcall"}, 
+  {"func.GetAltMonthNames.cc","stdcall"}, 
+  {"func.PathUnExpandEnvStringsW.cc","stdcall"}, 
+  {"func.SHRegSetUSValueA.cc","stdcall"}, 
+  {"func.GetKeyboardLayoutList.cc","stdcall"}, 
+  {"func.ldap_parse_page_controlA.cc","cdecl"}, 
+  {"func.GetFirmwareEnvironmentVariableExW.cc","stdcall"}, 
+  {"func.GetEnvironmentStringsW.cc","stdcall"}, 
+  {"func.ldap_create_sort_control.cc","cdecl"}, 
+  {"func.ldap_open.cc","cdecl"}, 
+  {"func.DefMDIChildProcW.cc","stdcall"}, 
+  {"func.GenerateConsoleCtrlEvent.cc","stdcall"}, 
+  {"func.GetWindowThreadProcessId.cc","stdcall"}, 
+  {"func.GetUILanguageInfo.cc","stdcall"}, 
+  {"func.DestroyCursor.cc","stdcall"}, 
+  {"func.CertAlgIdToOID.cc","stdcall"}, 
+  {"func.SysReAllocString.cc","stdcall"}, 
+  {"func.DeleteFileTransactedW.cc","stdcall"}, 
+  {"func.StrCmpW.cc","stdcall"}, 
+  {"func.SymGetLineFromAddr.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_Registry_Property_ExW.cc","stdcall"}, 
+  {"func.WSCEnumNameSpaceProvidersEx32.cc","stdcall"}, 
+  {"func.GetNamedPipeClientProcessId.cc","stdcall"}, 
+  {"func.CopyIcon.cc","stdcall"}, 
+  {"func.StrCmpCW.cc","stdcall"}, 
+  {"func.ldap_add_sW.cc","cdecl"}, 
+  {"func.ldap_search_extW.cc","cdecl"}, 
+  {"func.K32GetDeviceDriverBaseNameA.cc","stdcall"}, 
+  {"func.CreateDesktopExA.cc","stdcall"}, 
+  {"func.CM_Delete_Range.cc","stdcall"}, 
+  {"func.QueryInterruptTime.cc","stdcall"}, 
+  {"func.ImpersonateSelf.cc","stdcall"}, 
+  {"func.GetPointerInputTransform.cc","stdcall"}, 
+  {"func.ConvertSidToStringSidW.cc","stdcall"}, 
+  {"func.ExpandEnvironmentStringsForUserA.cc","stdcall"}, 
+  {"func.CharUpperBuffW.cc","stdcall"}, 
+  {"func.CreateRemoteThread.cc","stdcall"}, 
+  {"func.VarBoolFromUI1.cc","stdcall"}, 
+  {"func.DebugSetProcessKillOnExit.cc","stdcall"}, 
+  {"func.EventWriteTransfer.cc","stdcall"}, 
+  {"func.ldap_modrdn2_sW.cc","cdecl"}, 
+  {"func.SHEmptyRecycleBinW.cc","stdcall"}, 
+  {"func.VarUI2FromCy.cc","stdcall"}, 
+  {"func.CreateHardLinkTransactedA.cc","stdcall"}, 
+  {"func.FindActCtxSectionStringW.cc","stdcall"}, 
+  {"func.ldap_get_valuesA.cc","cdecl"}, 
+  {"func.OpenMutexW.cc","stdcall"}, 
+  {"func.UrlCompareW.cc","stdcall"}, 
+  {"func.SysReAllocStringLen.cc","stdcall"}, 
+  {"func.CreateSymbolicLinkW.cc","stdcall"}, 
+  {"func.LookupAccountSidW.cc","stdcall"}, 
+  {"func.CreateThreadpoolWait.cc","stdcall"}, 
+  {"func.DispatchMessageA.cc","stdcall"}, 
+  {"func.DisassociateCurrentThreadFromCallback.cc","stdcall"}, 
+  {"func.DefMDIChildProcA.cc","stdcall"}, 
+  {"func.Beep.cc","stdcall"}, 
+  {"func.PowerSettingUnregisterNotification.cc","stdcall"}, 
+  {"func.GetGUIThreadInfo.cc","stdcall"}, 
+  {"func.SetCommConfig.cc","stdcall"}, 
+  {"func.GetCurrentInputMessageSource.cc","stdcall"}, 
+  {"func.VarBstrFromCy.cc","stdcall"}, 
+  {"func.DuplicateHandle.cc","stdcall"}, 
+  {"func.ldap_parse_result.cc","cdecl"}, 
+  {"func.CryptDecodeObject.cc","stdcall"}, 
+  {"func.PowerRegisterSuspendResumeNotification.cc","stdcall"}, 
+  {"func.WinHttpSetOption.cc","stdcall"}, 
+  {"func.CompareFileTime.cc","stdcall"}, 
+  {"func.CreatePrivateObjectSecurityEx.cc","stdcall"}, 
+  {"func.CoWaitForMultipleObjects.cc","stdcall"}, 
+  {"func.ImageList_Replace.cc","stdcall"}, 
+  {"func.ldap_add_sA.cc","cdecl"}, 
+  {"func.DosDateTimeToFileTime.cc","stdcall"}, 
+  {"func.InitializeSRWLock.cc","stdcall"}, 
+  {"func.GetLocaleInfoEx.cc","stdcall"}, 
+  {"func.InitiateShutdownW.cc","stdcall"}, 
+  {"func.QueryServiceDynamicInformation.cc","stdcall"}, 
+  {"func.CryptBinaryToStringA.cc","stdcall"}, 
+  {"func.SetProcessInformation.cc","stdcall"}, 
+  {"func.ldap_search_init_page.cc","cdecl"}, 
+  {"func.UrlGetLocationA.cc","stdcall"}, 
+  {"func.PathRemoveArgsW.cc","stdcall"}, 
+  {"func.GetFileVersionInfoExA.cc","stdcall"}, 
+  {"func.DeferWindowPos.cc","stdcall"}, 
+  {"func.ber_peek_tag.cc","cdecl"}, 
+  {"func.GetDlgItem.cc","stdcall"}, 
+  {"func.CryptRegisterOIDFunction.cc","stdcall"}, 
+  {"type.HICON.size","32"}, 
+  {"func.GetSystemTimes.cc","stdcall"}, 
+  {"func.VarAbs.cc","stdcall"}, 
+  {"func.ldap_deleteW.cc","cdecl"}, 
+  {"func.RegDisablePredefinedCache.cc","stdcall"}, 
+  {"func.SymGetSymFromName.cc","stdcall"}, 
+  {"func.CM_Get_Class_Property_Keys_Ex.cc","stdcall"}, 
+  {"func.DnsHostnameToComputerNameW.cc","stdcall"}, 
+  {"func.SendMessageCallbackW.cc","stdcall"}, 
+  {"func.CryptFindOIDInfo.cc","stdcall"}, 
+  {"func.AllocConsole.cc","stdcall"}, 
+  {"func.GetWindowInfo.cc","stdcall"}, 
+  {"func.LookupIconIdFromDirectoryEx.cc","stdcall"}, 
+  {"func.SymGetSourceVarFromToken.cc","stdcall"}, 
+  {"func.LoadCursorW.cc","stdcall"}, 
+  {"func.CM_Connect_MachineA.cc","stdcall"}, 
+  {"func.ImageList_SetImageCount.cc","stdcall"}, 
+  {"func.VarBstrFromUI2.cc","stdcall"}, 
+  {"func.Decompress.cc","stdcall"}, 
+  {"func.WriteConsoleW.cc","stdcall"}, 
+  {"func.WSAWaitForMultipleEvents.cc","stdcall"}, 
+  {"func.CoCreateInstance.cc","stdcall"}, 
+  {"func.IntlStrEqWorkerW.cc","stdcall"}, 
+  {"func.GetMenuState.cc","stdcall"}, 
+  {"func.StrCmpICW.cc","stdcall"}, 
+  {"func.UnmapViewOfFile2.cc","stdcall"}, 
+  {"func.SHDeleteValueA.cc","stdcall"}, 
+  {"func.CM_Set_DevNode_PropertyW.cc","stdcall"}, 
+  {"func.BCryptVerifySignature.cc","stdcall"}, 
+  {"func.ParseURLA.cc","stdcall"}, 
+  {"func.GetSecurityDescriptorRMControl.cc","stdcall"}, 
+  {"func.CM_Setup_DevNode_Ex.cc","stdcall"}, 
+  {"func.GetProcessId.cc","stdcall"}, 
+  {"func.SetTapeParameters.cc","stdcall"}, 
+  {"func.VarDateFromR8.cc","stdcall"}, 
+  {"func.ldap_get_dnW.cc","cdecl"}, 
+  {"func.UrlCombineW.cc","stdcall"}, 
+  {"func.RemoveDirectoryW.cc","stdcall"}, 
+  {"func.K32EnumPageFilesA.cc","stdcall"}, 
+  {"func.OemToCharBuffA.cc","stdcall"}, 
+  {"func.SHStripMneumonicW.cc","stdcall"}, 
+  {"func.SymSrvIsStoreW.cc","stdcall"}, 
+  {"func.GetAddrInfoExCancel.cc","stdcall"}, 
+  {"func.VarI2FromI8.cc","stdcall"}, 
+  {"func.GetSystemTimeAdjustmentPrecise.cc","stdcall"}, 
+  {"func.SHDeleteEmptyKeyA.cc","stdcall"}, 
+  {"func.MkParseDisplayName.cc","stdcall"}, 
+  {"func.CM_Get_HW_Prof_FlagsW.cc","stdcall"}, 
+  {"func.SafeArrayAllocData.cc","stdcall"}, 
+  {"func.GetUserDefaultLCID.cc","stdcall"}, 
+  {"func.VarBoolFromR8.cc","stdcall"}, 
+  {"func.CM_Connect_MachineW.cc","stdcall"}, 
+  {"func.GetApplicationRecoveryCallback.cc","stdcall"}, 
+  {"func.SymGetSymbolFile.cc","stdcall"}, 
+  {"func.QueryDosDeviceA.cc","stdcall"}, 
+  {"func.StgOpenAsyncDocfileOnIFillLockBytes.cc","stdcall"}, 
+  {"func.IsWow64GuestMachineSupported.cc","stdcall"}, 
+  {"func.CertFreeCertificateChain.cc","stdcall"}, 
+  {"func.ldap_addW.cc","cdecl"}, 
+  {"func.WriteConsoleA.cc","stdcall"}, 
+  {"func.QueryInformationJobObject.cc","stdcall"}, 
+  {"func.RegLoadMUIStringA.cc","stdcall"}, 
+  {"func.GetFileAttributesTransactedW.cc","stdcall"}, 
+  {"func.GetXStateFeaturesMask.cc","stdcall"}, 
+  {"func.CM_Get_Res_Des_Data.cc","stdcall"}, 
+  {"func.ldap_controls_freeA.cc","cdecl"}, 
+  {"func.CryptSignMessage.cc","stdcall"}, 
+  {"func.EraseTape.cc","stdcall"}, 
+  {"func.GetVolumeInformationByHandleW.cc","stdcall"}, 
+  {"func.FileTimeToSystemTime.cc","stdcall"}, 
+  {"func.SetConsoleCursorPosition.cc","stdcall"}, 
+  {"func.FatalAppExitA.cc","stdcall"}, 
+  {"func.MoveFileTransactedW.cc","stdcall"}, 
+  {"func.NSPStartup.cc","stdcall"}, 
+  {"func.OpenEventA.cc","stdcall"}, 
+  {"func.WinHttpCrackUrl.cc","stdcall"}, 
+  {"func.ldap_connect.cc","cdecl"}, 
+  {"func.IStream_ReadPidl.cc","stdcall"}, 
+  {"func.NotifyChangeEventLog.cc","stdcall"}, 
+  {"func.SetGestureConfig.cc","stdcall"}, 
+  {"func.NCryptVerifySignature.cc","stdcall"}, 
+  {"func.SetConsoleTitleA.cc","stdcall"}, 
+  {"func.PhysicalToLogicalPointForPerMonitorDPI.cc","stdcall"}, 
+  {"func.SHStripMneumonicA.cc","stdcall"}, 
+  {"func.ldap_first_entry.cc","cdecl"}, 
+  {"func.SymGetLineFromAddr64.cc","stdcall"}, 
+  {"func.SetErrorInfo.cc","stdcall"}, 
+  {"func.BCryptSetProperty.cc","stdcall"}, 
+  {"func.ResetDecompressor.cc","stdcall"}, 
+  {"func.EncodePointer.cc","stdcall"}, 
+  {"func.CertAddRefServerOcspResponseContext.cc","stdcall"}, 
+  {"func.CryptRegisterDefaultOIDFunction.cc","stdcall"}, 
+  {"func.VarCyFromUI1.cc","stdcall"}, 
+  {"func.ImageList_SetDragCursorImage.cc","stdcall"}, 
+  {"func.CertDuplicateStore.cc","stdcall"}, 
+  {"func.VarI1FromI8.cc","stdcall"}, 
+  {"func.SetThreadDesktop.cc","stdcall"}, 
+  {"func.ConvertStringSecurityDescriptorToSecurityDescriptorW.cc","stdcall"}, 
+  {"func.WSASetBlockingHook.cc","stdcall"}, 
+  {"func.CredIsMarshaledCredentialA.cc","stdcall"}, 
+  {"func.GetGeoInfoEx.cc","stdcall"}, 
+  {"func.K32GetWsChangesEx.cc","stdcall"}, 
+  {"func.StartServiceCtrlDispatcherA.cc","stdcall"}, 
+  {"func.WSCUpdateProvider.cc","stdcall"}, 
+  {"func.WSARecv.cc","stdcall"}, 
+  {"func.PostMessageW.cc","stdcall"}, 
+  {"func.VarUI1FromBool.cc","stdcall"}, 
+  {"func.VarUI4FromUI1.cc","stdcall"}, 
+  {"func.WSCEnumProtocols32.cc","stdcall"}, 
+  {"func.DlgDirSelectComboBoxExW.cc","stdcall"}, 
+  {"func.GetModuleFileNameW.cc","stdcall"}, 
+  {"func.RemoveTraceCallback.cc","stdcall"}, 
+  {"func.GetFileSize.cc","stdcall"}, 
+  {"func.AreAllAccessesGranted.cc","stdcall"}, 
+  {"func.GetProcessInformation.cc","stdcall"}, 
+  {"func.PathCreateFromUrlW.cc","stdcall"}, 
+  {"func.EvaluateProximityToPolygon.cc","stdcall"}, 
+  {"func.ldap_start_tls_sW.cc","cdecl"}, 
+  {"func.RegDeleteKeyTransactedA.cc","stdcall"}, 
+  {"func.WSAJoinLeaf.cc","stdcall"}, 
+  {"func.EnumCalendarInfoExW.cc","stdcall"}, 
+  {"func.CM_Get_Sibling_Ex.cc","stdcall"}, 
+  {"func.StrCatBuffA.cc","stdcall"}, 
+  {"func.PowerWriteACValueIndex.cc","stdcall"}, 
+  {"func.SignalObjectAndWait.cc","stdcall"}, 
+  {"func.QueryDisplayConfig.cc","stdcall"}, 
+  {"func.SymSetParentWindow.cc","stdcall"}, 
+  {"func.GlobalFindAtomW.cc","stdcall"}, 
+  {"func.AbortSystemShutdownW.cc","stdcall"}, 
+  {"func.Wow64DisableWow64FsRedirection.cc","stdcall"}, 
+  {"func.CreateRemoteThreadEx.cc","stdcall"}, 
+  {"func.CoLoadLibrary.cc","stdcall"}, 
+  {"func.wvnsprintfW.cc","stdcall"}, 
+  {"func.SymSrvDeltaName.cc","stdcall"}, 
+  {"func.ReadConsoleOutputCharacterW.cc","stdcall"}, 
+  {"func.PowerGetActiveScheme.cc","stdcall"}, 
+  {"func.CreateJobSet.cc","stdcall"}, 
+  {"func.CoRegisterActivationFilter.cc","stdcall"}, 
+  {"func.WSCInstallProviderAndChains64_32.cc","stdcall"}, 
+  {"func.SymGetHomeDirectory.cc","stdcall"}, 
+  {"func.SetCalendarInfoW.cc","stdcall"}, 
+  {"func.IsHungAppWindow.cc","stdcall"}, 
+  {"func.EnumDirTreeW.cc","stdcall"}, 
+  {"func.IsWindow.cc","stdcall"}, 
+  {"func.GetClassLongPtrW.cc","stdcall"}, 
+  {"func.CreateThreadpoolTimer.cc","stdcall"}, 
+  {"func.EnumWindows.cc","stdcall"}, 
+  {"func.CreateThreadpool.cc","stdcall"}, 
+  {"func.GetProcessDefaultLayout.cc","stdcall"}, 
+  {"func.SymAddSymbolW.cc","stdcall"}, 
+  {"func.SymGetModuleBase64.cc","stdcall"}, 
+  {"func.SymEnumSourceFiles.cc","stdcall"}, 
+  {"func.CM_Query_And_Remove_SubTreeW.cc","stdcall"}, 
+  {"func.CoGetObjectContext.cc","stdcall"}, 
+  {"func.EnumSystemLanguageGroupsA.cc","stdcall"}, 
+  {"func.SHRegGetPathW.cc","stdcall"}, 
+  {"func.GetEnvironmentVariableW.cc","stdcall"}, 
+  {"func.UrlEscapeA.cc","stdcall"}, 
+  {"func.GetDC.cc","stdcall"}, 
+  {"func.MenuItemFromPoint.cc","stdcall"}, 
+  {"func.EventWriteString.cc","stdcall"}, 
+  {"func.getservbyname.cc","stdcall"}, 
+  {"func.GetDoubleClickTime.cc","stdcall"}, 
+  {"func.SymGetOptions.cc","stdcall"}, 
+  {"func.SetFileAttributesTransactedA.cc","stdcall"}, 
+  {"func.SetSecurityDescriptorGroup.cc","stdcall"}, 
+  {"func.CreateFileMappingNumaA.cc","stdcall"}, 
+  {"func.GetNamedPipeServerProcessId.cc","stdcall"}, 
+  {"func.CreateDesktopExW.cc","stdcall"}, 
+  {"func.VarCyInt.cc","stdcall"}, 
+  {"func.CloseEventLog.cc","stdcall"}, 
+  {"func.SetFilePointerEx.cc","stdcall"}, 
+  {"func.CoReleaseMarshalData.cc","stdcall"}, 
+  {"func.CM_Free_Res_Des.cc","stdcall"}, 
+  {"func.ReadConsoleOutputCharacterA.cc","stdcall"}, 
+  {"func.SymFindFileInPath.cc","stdcall"}, 
+  {"func.ldap_modify_sW.cc","cdecl"}, 
+  {"func.VarCySub.cc","stdcall"}, 
+  {"func.VarI4FromUI1.cc","stdcall"}, 
+  {"func.SymGetLineFromInlineContextW.cc","stdcall"}, 
+  {"func.VarCyFix.cc","stdcall"}, 
+  {"func.CredReadDomainCredentialsA.cc","stdcall"}, 
+  {"func.CM_Find_Range.cc","stdcall"}, 
+  {"func.DispInvoke.cc","stdcall"}, 
+  {"func.RegisterTraceGuidsW.cc","stdcall"}, 
+  {"func.CryptGetKeyParam.cc","stdcall"}, 
+  {"func.WinHttpWriteProxySettings.cc","stdcall"}, 
+  {"func.CreateUmsThreadContext.cc","stdcall"}, 
+  {"func.CreateFileMoniker.cc","stdcall"}, 
+  {"func.DefDlgProcW.cc","stdcall"}, 
+  {"func.WritePrivateProfileStructA.cc","stdcall"}, 
+  {"func.VarUI1FromI2.cc","stdcall"}, 
+  {"func.SetNamedPipeHandleState.cc","stdcall"}, 
+  {"func.CM_Get_Device_ID_List_Size_ExA.cc","stdcall"}, 
+  {"func.OpenPrivateNamespaceA.cc","stdcall"}, 
+  {"func.WSASetServiceW.cc","stdcall"}, 
+  {"func.SetConsoleTextAttribute.cc","stdcall"}, 
+  {"func.LookupAccountSidA.cc","stdcall"}, 
+  {"func.IsMenu.cc","stdcall"}, 
+  {"func.Shell_NotifyIconA.cc","stdcall"}, 
+  {"func.ChangeWindowMessageFilterEx.cc","stdcall"}, 
+  {"func.SHRegCloseUSKey.cc","stdcall"}, 
+  {"func.GetProcessIdOfThread.cc","stdcall"}, 
+  {"func.CM_Query_And_Remove_SubTreeA.cc","stdcall"}, 
+  {"func.PowerDeterminePlatformRoleEx.cc","stdcall"}, 
+  {"func.ntohd.cc","stdcall"}, 
+  {"func.VariantCopyInd.cc","stdcall"}, 
+  {"func.QueryThreadCycleTime.cc","stdcall"}, 
+  {"func.WaitForSingleObject.cc","stdcall"}, 
+  {"func.InsertMenuA.cc","stdcall"}, 
+  {"func.InitializeCriticalSectionAndSpinCount.cc","stdcall"}, 
+  {"func.LoadMenuIndirectA.cc","stdcall"}, 
+  {"func.SymGetSourceFileFromTokenW.cc","stdcall"}, 
+  {"func.RegOpenKeyTransactedA.cc","stdcall"}, 
+  {"func.SetErrorMode.cc","stdcall"}, 
+  {"func.PathFindExtensionA.cc","stdcall"}, 
+  {"func.RtlDeleteGrowableFunctionTable.cc","stdcall"}, 
+  {"func.CM_Get_Log_Conf_Priority_Ex.cc","stdcall"}, 
+  {"func.RegisterServiceCtrlHandlerExA.cc","stdcall"}, 
+  {"func.NCryptStreamOpenToUnprotectEx.cc","stdcall"}, 
+  {"func.VarCyAbs.cc","stdcall"}, 
+  {"func.GetComputerNameA.cc","stdcall"}, 
+  {"func.PathCombineW.cc","stdcall"}, 
+  {"func.SetEnvironmentStringsA.cc","stdcall"}, 
+  {"func.GetFileInformationByHandleEx.cc","stdcall"}, 
+  {"func.CertControlStore.cc","stdcall"}, 
+  {"func.CheckTokenCapability.cc","stdcall"}, 
+  {"func.WaitForThreadpoolWorkCallbacks.cc","stdcall"}, 
+  {"func.EnableThreadProfiling.cc","stdcall"}, 
+  {"func.WSAEnumNameSpaceProvidersA.cc","stdcall"}, 
+  {"func.ldap_init.cc","cdecl"}, 
+  {"func.GetConsoleTitleA.cc","stdcall"}, 
+  {"func.GetFileAttributesA.cc","stdcall"}, 
+  {"func.CM_MapCrToWin32Err.cc","stdcall"}, 
+  {"func.CreateStdProgressIndicator.cc","stdcall"}, 
+  {"func.ldap_set_option.cc","cdecl"}, 
+  {"func.ExtractAssociatedIconW.cc","stdcall"}, 
+  {"func.GetCurrentThreadStackLimits.cc","stdcall"}, 
+  {"func.ldap_escape_filter_elementA.cc","cdecl"}, 
+  {"func.LoadBitmapA.cc","stdcall"}, 
+  {"func.CertEnumCRLContextProperties.cc","stdcall"}, 
+  {"func.GetConsoleCP.cc","stdcall"}, 
+  {"func.StrFormatKBSizeW.cc","stdcall"}, 
+  {"func.keybd_event.cc","stdcall"}, 
+  {"type.HKEY.size","32"}, 
+  {"func.CertGetCTLContextProperty.cc","stdcall"}, 
+  {"func.Wow64RevertWow64FsRedirection.cc","stdcall"}, 
+  {"func.RegDeleteTreeW.cc","stdcall"}, 
+  {"func.VarUI8FromI1.cc","stdcall"}, 
+  {"func.WSAAdvertiseProvider.cc","stdcall"}, 
+  {"func.GetDiskFreeSpaceA.cc","stdcall"}, 
+  {"func.GetPointerDeviceRects.cc","stdcall"}, 
+  {"func.VarUI8FromStr.cc","stdcall"}, 
+  {"func.SHSetThreadRef.cc","stdcall"}, 
+  {"func.FindResourceW.cc","stdcall"}, 
+  {"func.WinHttpQueryAuthSchemes.cc","stdcall"}, 
+  {"func.MultiByteToWideChar.cc","stdcall"}, 
+  {"func.EndDialog.cc","stdcall"}, 
+  {"func.WinHttpIsHostInProxyBypassList.cc","stdcall"}, 
+  {"func.VariantTimeToSystemTime.cc","stdcall"}, 
+  {"func.DefineDosDeviceW.cc","stdcall"}, 
+  {"func.LocalUnlock.cc","stdcall"}, 
+  {"func.FindFirstStreamTransactedW.cc","stdcall"}, 
+  {"func.ldap_add_extA.cc","cdecl"}, 
+  {"func.VarI1FromCy.cc","stdcall"}, 
+  {"func.GetProcessMemoryInfo.cc","stdcall"}, 
+  {"func.SafeArrayDestroy.cc","stdcall"}, 
+  {"func.GetTimeFormatEx.cc","stdcall"}, 
+  {"func.GetStringTypeExA.cc","stdcall"}, 
+  {"type.HFONT.size","32"}, 
+  {"func.htonf.cc","stdcall"}, 
+  {"func.SHRegWriteUSValueA.cc","stdcall"}, 
+  {"func.SymGetModuleInfo.cc","stdcall"}, 
+  {"func.CM_Get_Device_ID_ListA.cc","stdcall"}, 
+  {"func.EnumServicesStatusW.cc","stdcall"}, 
+  {"func.CryptEnumOIDInfo.cc","stdcall"}, 
+  {"func.CreateStreamOnHGlobal.cc","stdcall"}, 
+  {"func.SetVolumeLabelW.cc","stdcall"}, 
+  {"func.ReleaseMutex.cc","stdcall"}, 
+  {"func.GetLongPathNameTransactedW.cc","stdcall"}, 
+  {"func.CreateDialogIndirectParamW.cc","stdcall"}, 
+  {"func.StrChrIW.cc","stdcall"}, 
+  {"func.VirtualFree.cc","stdcall"}, 
+  {"func.VarI2FromUI1.cc","stdcall"}, 
+  {"func.RegReplaceKeyW.cc","stdcall"}, 
+  {"func.WSAProviderCompleteAsyncCall.cc","stdcall"}, 
+  {"func.SHQueryValueExW.cc","stdcall"}, 
+  {"func.CreateProcessWithLogonW.cc","stdcall"}, 
+  {"func.TaskDialog.cc","stdcall"}, 
+  {"func.QueryDosDeviceW.cc","stdcall"}, 
+  {"func.VarI8FromI1.cc","stdcall"}, 
+  {"func.GetBinaryTypeW.cc","stdcall"}, 
+  {"func.QueryServiceConfig2W.cc","stdcall"}, 
+  {"func.closesocket.cc","stdcall"}, 
+  {"func.CreatePrivateObjectSecurity.cc","stdcall"}, 
+  {"func.LCMapStringEx.cc","stdcall"}, 
+  {"func.LoadCursorFromFileA.cc","stdcall"}, 
+  {"func.GetProcessTimes.cc","stdcall"}, 
+  {"func.WindowFromDC.cc","stdcall"}, 
+  {"func.BCryptDeleteContext.cc","stdcall"}, 
+  {"func.SHRegQueryInfoUSKeyW.cc","stdcall"}, 
+  {"func.VarBstrFromUI1.cc","stdcall"}, 
+  {"func.CredEnumerateW.cc","stdcall"}, 
+  {"func.GetProcessMitigationPolicy.cc","stdcall"}, 
+  {"func.VarI8FromI2.cc","stdcall"}, 
+  {"func.GetAllUsersProfileDirectoryA.cc","stdcall"}, 
+  {"func.MessageBoxExA.cc","stdcall"}, 
+  {"func.ldap_compare_extA.cc","cdecl"}, 
+  {"func.CM_Uninstall_DevNode.cc","stdcall"}, 
+  {"func.CreatePipe.cc","stdcall"}, 
+  {"func.PathIsSystemFolderA.cc","stdcall"}, 
+  {"func.SetWindowsHookA.cc","stdcall"}, 
+  {"func.SHCreateThreadWithHandle.cc","stdcall"}, 
+  {"type.HRSRC.size","32"}, 
+  {"func.SetRectEmpty.cc","stdcall"}, 
+  {"func.SymFromAddr.cc","stdcall"}, 
+  {"func.CM_Free_Res_Des_Ex.cc","stdcall"}, 
+  {"func.BstrFromVector.cc","stdcall"}, 
+  {"func.VarCyAdd.cc","stdcall"}, 
+  {"func.RegReplaceKeyA.cc","stdcall"}, 
+  {"func.CryptVerifyDetachedMessageHash.cc","stdcall"}, 
+  {"func.ImpersonateNamedPipeClient.cc","stdcall"}, 
+  {"func.CredUnPackAuthenticationBufferA.cc","stdcall"}, 
+  {"func.SafeArrayReleaseDescriptor.cc","stdcall"}, 
+  {"func.SetEventWhenCallbackReturns.cc","stdcall"}, 
+  {"func.FreePropVariantArray.cc","stdcall"}, 
+  {"func.QueryUnbiasedInterruptTimePrecise.cc","stdcall"}, 
+  {"func.PathRemoveBlanksA.cc","stdcall"}, 
+  {"func.InSendMessageEx.cc","stdcall"}, 
+  {"func.CreateWindowStationA.cc","stdcall"}, 
+  {"func.ImageDirectoryEntryToDataEx.cc","stdcall"}, 
+  {"func.GetShortPathNameW.cc","stdcall"}, 
+  {"func.CM_Set_Class_Property_ExW.cc","stdcall"}, 
+  {"func.VarUI4FromR8.cc","stdcall"}, 
+  {"func.SystemParametersInfoW.cc","stdcall"}, 
+  {"func.DebugBreakProcess.cc","stdcall"}, 
+  {"func.ldap_count_values.cc","cdecl"}, 
+  {"func.VarDateFromUI8.cc","stdcall"}, 
+  {"func.LoadCursorFromFileW.cc","stdcall"}, 
+  {"func.CallMsgFilterA.cc","stdcall"}, 
+  {"func.K32EnumProcessModulesEx.cc","stdcall"}, 
+  {"func.RegSetValueW.cc","stdcall"}, 
+  {"func.CoGetObject.cc","stdcall"}, 
+  {"func.PathRemoveExtensionW.cc","stdcall"}, 
+  {"func.DlgDirSelectComboBoxExA.cc","stdcall"}, 
+  {"func.VarPow.cc","stdcall"}, 
+  {"func.EnumResourceTypesA.cc","stdcall"}, 
+  {"func.CryptEncodeObjectEx.cc","stdcall"}, 
+  {"func.CreateErrorInfo.cc","stdcall"}, 
+  {"func.K32GetModuleFileNameExW.cc","stdcall"}, 
+  {"type.HCOLORSPACE.size","32"}, 
+  {"func.VarR8FromUI4.cc","stdcall"}, 
+  {"func.PathCchRemoveBackslash.cc","stdcall"}, 
+  {"func.ldap_control_free.cc","cdecl"}, 
+  {"func.PathCreateFromUrlA.cc","stdcall"}, 
+  {"func.EnumLanguageGroupLocalesW.cc","stdcall"}, 
+  {"func.CertFreeCertificateChainEngine.cc","stdcall"}, 
+  {"func.GetACP.cc","stdcall"}, 
+  {"func.InitializeSid.cc","stdcall"}, 
+  {"func.SetCursorPos.cc","stdcall"}, 
+  {"func.CallbackMayRunLong.cc","stdcall"}, 
+  {"func.CryptFlushTimeValidObject.cc","stdcall"}, 
+  {"func.VarParseNumFromStr.cc","stdcall"}, 
+  {"func.MakeSelfRelativeSD.cc","stdcall"}, 
+  {"func.GetTraceEnableFlags.cc","stdcall"}, 
+  {"func.freeaddrinfo.cc","stdcall"}, 
+  {"func.VarOr.cc","stdcall"}, 
+  {"func.ldap_memfreeW.cc","cdecl"}, 
+  {"func.LoadUserProfileW.cc","stdcall"}, 
+  {"func.VariantClear.cc","stdcall"}, 
+  {"func.RegLoadAppKeyW.cc","stdcall"}, 
+  {"func.FlatSB_GetScrollInfo.cc","stdcall"}, 
+  {"func.VarUI4FromI1.cc","stdcall"}, 
+  {"func.EnumDisplayMonitors.cc","stdcall"}, 
+  {"func.WSCUnInstallNameSpace32.cc","stdcall"}, 
+  {"func.SymGetFileLineOffsets64.cc","stdcall"}, 
+  {"func.SetClipboardData.cc","stdcall"}, 
+  {"func.GetCurrentProcessId.cc","stdcall"}, 
+  {"func.RegisterPointerDeviceNotifications.cc","stdcall"}, 
+  {"func.GetStdHandle.cc","stdcall"}, 
+  {"func.VarDateFromUdate.cc","stdcall"}, 
+  {"func.ldap_controls_free.cc","cdecl"}, 
+  {"func.SHGetTemporaryPropertyForItem.cc","stdcall"}, 
+  {"func.ldap_rename_ext.cc","cdecl"}, 
+  {"func.ChangeServiceConfigA.cc","stdcall"}, 
+  {"func.SetPropW.cc","stdcall"}, 
+  {"func.WTSGetActiveConsoleSessionId.cc","stdcall"}, 
+  {"func.ColorHLSToRGB.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_Alias_ExW.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_Property_KeysW.cc","stdcall"}, 
+  {"func.WSCSetApplicationCategory.cc","stdcall"}, 
+  {"func.ExtractIconExW.cc","stdcall"}, 
+  {"func.CM_Enumerate_EnumeratorsA.cc","stdcall"}, 
+  {"func.VarDecAbs.cc","stdcall"}, 
+  {"func.WinHttpWebSocketSend.cc","stdcall"}, 
+  {"func.UrlEscapeW.cc","stdcall"}, 
+  {"func.IsLFNDriveW.cc","stdcall"}, 
+  {"func.PathCchAddBackslash.cc","stdcall"}, 
+  {"func.TraceMessageVa.cc","stdcall"}, 
+  {"func.CloseThreadpool.cc","stdcall"}, 
+  {"func.SetCurrentDirectoryA.cc","stdcall"}, 
+  {"func.GetCPInfoExW.cc","stdcall"}, 
+  {"func.EnumerateLoadedModulesEx.cc","stdcall"}, 
+  {"func.PathIsURLA.cc","stdcall"}, 
+  {"func.SendMessageTimeoutA.cc","stdcall"}, 
+  {"func.SymEnumSourceFilesW.cc","stdcall"}, 
+  {"func.VarUI4FromUI2.cc","stdcall"}, 
+  {"func.CertAddEncodedCRLToStore.cc","stdcall"}, 
+  {"func.SHRegGetUSValueW.cc","stdcall"}, 
+  {"func.CM_Add_Range.cc","stdcall"}, 
+  {"func.RestoreLastError.cc","stdcall"}, 
+  {"func.VarCyFromI2.cc","stdcall"}, 
+  {"func.SymSetScopeFromIndex.cc","stdcall"}, 
+  {"func.EndDeferWindowPos.cc","stdcall"}, 
+  {"func.ImageList_LoadImageW.cc","stdcall"}, 
+  {"func.ScrollWindowEx.cc","stdcall"}, 
+  {"func.GetLargestConsoleWindowSize.cc","stdcall"}, 
+  {"func.CryptImportKey.cc","stdcall"}, 
+  {"func.WSACancelBlockingCall.cc","stdcall"}, 
+  {"func.WPUFDIsSet.cc","stdcall"}, 
+  {"func.QueryCompressorInformation.cc","stdcall"}, 
+  {"func.EnumDirTree.cc","stdcall"}, 
+  {"func.DecodeSystemPointer.cc","stdcall"}, 
+  {"func.VarDecFromStr.cc","stdcall"}, 
+  {"func.SHGetImageList.cc","stdcall"}, 
+  {"func.VarCyFromI1.cc","stdcall"}, 
+  {"func.ReadFileScatter.cc","stdcall"}, 
+  {"func.IsWinEventHookInstalled.cc","stdcall"}, 
+  {"func.ldap_search_init_pageW.cc","cdecl"}, 
+  {"func.getprotobyname.cc","stdcall"}, 
+  {"func.StrToInt64ExA.cc","stdcall"}, 
+  {"func.OleLoadPictureFileEx.cc","stdcall"}, 
+  {"func.GetInputState.cc","stdcall"}, 
+  {"func.StrFromTimeIntervalA.cc","stdcall"}, 
+  {"func.CM_Free_Resource_Conflict_Handle.cc","stdcall"}, 
+  {"func.GetVersionExA.cc","stdcall"}, 
+  {"func.StgGetIFillLockBytesOnILockBytes.cc","stdcall"}, 
+  {"func.GetMenuInfo.cc","stdcall"}, 
+  {"func.PathIsURLW.cc","stdcall"}, 
+  {"func.VarUI8FromR4.cc","stdcall"}, 
+  {"func.SizeofResource.cc","stdcall"}, 
+  {"func.FindFirstFileExA.cc","stdcall"}, 
+  {"func.WSAAsyncGetHostByAddr.cc","stdcall"}, 
+  {"func.TransactNamedPipe.cc","stdcall"}, 
+  {"func.SkipPointerFrameMessages.cc","stdcall"}, 
+  {"func.MapDialogRect.cc","stdcall"}, 
+  {"func.DlgDirListW.cc","stdcall"}, 
+  {"func.CM_Set_HW_Prof.cc","stdcall"}, 
+  {"func.GetDynamicTimeZoneInformation.cc","stdcall"}, 
+  {"func.SystemParametersInfoForDpi.cc","stdcall"}, 
+  {"func.SymUnDName64.cc","stdcall"}, 
+  {"func.SetDlgItemTextW.cc","stdcall"}, 
+  {"func.ldap_delete_ext_s.cc","cdecl"}, 
+  {"func.RegCloseKey.cc","stdcall"}, 
+  {"func.SetCoalescableTimer.cc","stdcall"}, 
+  {"func.GetGuiResources.cc","stdcall"}, 
+  {"func.ldap_encode_sort_controlA.cc","cdecl"}, 
+  {"func.CoRegisterChannelHook.cc","stdcall"}, 
+  {"type.LPTSTR.size","32"}, 
+  {"func.VariantInit.cc","stdcall"}, 
+  {"func.GetMenuItemID.cc","stdcall"}, 
+  {"func.QueryPerformanceFrequency.cc","stdcall"}, 
+  {"func.PathIsNetworkPathW.cc","stdcall"}, 
+  {"func.InitializeEnclave.cc","stdcall"}, 
+  {"func.CoCopyProxy.cc","stdcall"}, 
+  {"func.ValidateRgn.cc","stdcall"}, 
+  {"func.BuildCommDCBA.cc","stdcall"}, 
+  {"func.GetWindowTextW.cc","stdcall"}, 
+  {"func.CertRegisterPhysicalStore.cc","stdcall"}, 
+  {"func.ldap_delete_ext_sW.cc","cdecl"}, 
+  {"func.CharNextExA.cc","stdcall"}, 
+  {"func.GetVolumePathNamesForVolumeNameW.cc","stdcall"}, 
+  {"func.GetModuleHandleW.cc","stdcall"}, 
+  {"func.GetTapeParameters.cc","stdcall"}, 
+  {"func.CM_Get_Resource_Conflict_DetailsW.cc","stdcall"}, 
+  {"func.GetSidIdentifierAuthority.cc","stdcall"}, 
+  {"func.BCryptImportKey.cc","stdcall"}, 
+  {"func.UrlIsA.cc","stdcall"}, 
+  {"func.EventSetInformation.cc","stdcall"}, 
+  {"func.AdjustWindowRectEx.cc","stdcall"}, 
+  {"func.CertFindSubjectInCTL.cc","stdcall"}, 
+  {"func.OpenProcessToken.cc","stdcall"}, 
+  {"func.CopyFileTransactedA.cc","stdcall"}, 
+  {"func.VarR4FromBool.cc","stdcall"}, 
+  {"func.PathIsLFNFileSpecW.cc","stdcall"}, 
+  {"func.EnumSystemLocalesA.cc","stdcall"}, 
+  {"func.HashData.cc","stdcall"}, 
+  {"func.TerminateThread.cc","stdcall"}, 
+  {"func.CoEnableCallCancellation.cc","stdcall"}, 
+  {"func.GetThreadIOPendingFlag.cc","stdcall"}, 
+  {"func.SetCaretBlinkTime.cc","stdcall"}, 
+  {"func.CM_Request_Device_Eject_ExW.cc","stdcall"}, 
+  {"func.SHRegGetBoolValueFromHKCUHKLM.cc","stdcall"}, 
+  {"func.ber_flatten.cc","cdecl"}, 
+  {"func.SetFileShortNameW.cc","stdcall"}, 
+  {"func.SymSetOptions.cc","stdcall"}, 
+  {"func.GetDllDirectoryA.cc","stdcall"}, 
+  {"func.SymRegisterCallback.cc","stdcall"}, 
+  {"func.GetCachedSigningLevel.cc","stdcall"}, 
+  {"func.SHGetInverseCMAP.cc","stdcall"}, 
+  {"func.CertRegisterSystemStore.cc","stdcall"}, 
+  {"func.CloseTrace.cc","stdcall"}, 
+  {"func.CM_Add_Empty_Log_Conf_Ex.cc","stdcall"}, 
+  {"func.ImageList_ReplaceIcon.cc","stdcall"}, 
+  {"func.connect.cc","stdcall"}, 
+  {"func.GetMappedFileNameW.cc","stdcall"}, 
+  {"func.ldap_search_st.cc","cdecl"}, 
+  {"func.EndTask.cc","stdcall"}, 
+  {"func.ldap_encode_sort_controlW.cc","cdecl"}, 
+  {"func.GetNextDlgTabItem.cc","stdcall"}, 
+  {"func.SymGetSearchPathW.cc","stdcall"}, 
+  {"func.SetWaitableTimer.cc","stdcall"}, 
+  {"func.WinHttpGetProxyForUrl.cc","stdcall"}, 
+  {"func.PathCompactPathExW.cc","stdcall"}, 
+  {"func.ldap_compare_s.cc","cdecl"}, 
+  {"func.SymEnumLines.cc","stdcall"}, 
+  {"func.ShowOwnedPopups.cc","stdcall"}, 
+  {"func.NCryptIsKeyHandle.cc","stdcall"}, 
+  {"func.GetDlgItemInt.cc","stdcall"}, 
+  {"func.ldap_count_references.cc","cdecl"}, 
+  {"func.LocalFileTimeToFileTime.cc","stdcall"}, 
+  {"func.PathCchAddBackslashEx.cc","stdcall"}, 
+  {"func.PathStripPathA.cc","stdcall"}, 
+  {"func.GetDefaultCommConfigW.cc","stdcall"}, 
+  {"func.CryptMsgSignCTL.cc","stdcall"}, 
+  {"func.GetFreeSpace.cc","stdcall"}, 
+  {"func.HeapSetInformation.cc","stdcall"}, 
+  {"func.ldap_value_freeW.cc","cdecl"}, 
+  {"func.DeleteTimerQueue.cc","stdcall"}, 
+  {"func.SetDllDirectoryA.cc","stdcall"}, 
+  {"func.DeleteVolumeMountPointA.cc","stdcall"}, 
+  {"func.WriteConsoleOutputW.cc","stdcall"}, 
+  {"func.MessageBoxExW.cc","stdcall"}, 
+  {"func.LookupAccountSidLocalW.cc","stdcall"}, 
+  {"func.PathStripToRootW.cc","stdcall"}, 
+  {"func.VarDateFromDec.cc","stdcall"}, 
+  {"func.MulDiv.cc","stdcall"}, 
+  {"func.CM_Set_HW_Prof_FlagsA.cc","stdcall"}, 
+  {"func.CM_Open_Class_Key_ExA.cc","stdcall"}, 
+  {"func.K32QueryWorkingSetEx.cc","stdcall"}, 
+  {"func.ReadFileEx.cc","stdcall"}, 
+  {"func.FindWindowExW.cc","stdcall"}, 
+  {"func.GetFileBandwidthReservation.cc","stdcall"}, 
+  {"func.VirtualLock.cc","stdcall"}, 
+  {"func.GetUserDefaultLangID.cc","stdcall"}, 
+  {"func.mouse_event.cc","stdcall"}, 
+  {"func.EnumTimeFormatsW.cc","stdcall"}, 
+  {"func.CM_Get_Class_Property_ExW.cc","stdcall"}, 
+  {"func.ConvertToAutoInheritPrivateObjectSecurity.cc","stdcall"}, 
+  {"func.GetFirmwareType.cc","stdcall"}, 
+  {"func.ReadDirectoryChangesExW.cc","stdcall"}, 
+  {"func.WinHttpReadData.cc","stdcall"}, 
+  {"func.CM_Get_Version_Ex.cc","stdcall"}, 
+  {"func.AddVectoredExceptionHandler.cc","stdcall"}, 
+  {"func.AddConditionalAce.cc","stdcall"}, 
+  {"func.FillConsoleOutputAttribute.cc","stdcall"}, 
+  {"func.CloseDecompressor.cc","stdcall"}, 
+  {"func.CharPrevW.cc","stdcall"}, 
+  {"func.SetSystemFileCacheSize.cc","stdcall"}, 
+  {"func.CM_Locate_DevNode_ExA.cc","stdcall"}, 
+  {"func.GetTickCount.cc","stdcall"}, 
+  {"func.CertDuplicateCTLContext.cc","stdcall"}, 
+  {"func.SHCreateStreamOnFileA.cc","stdcall"}, 
+  {"func.CertGetServerOcspResponseContext.cc","stdcall"}, 
+  {"func.RegisterEventSourceA.cc","stdcall"}, 
+  {"func.SetWindowFeedbackSetting.cc","stdcall"}, 
+  {"func.FindNextVolumeMountPointW.cc","stdcall"}, 
+  {"func.CreateTimerQueue.cc","stdcall"}, 
+  {"func.VarCyFromStr.cc","stdcall"}, 
+  {"func.ldap_dn2ufn.cc","cdecl"}, 
+  {"func.htond.cc","stdcall"}, 
+  {"func.CoRegisterSurrogate.cc","stdcall"}, 
+  {"func.QueryAuxiliaryCounterFrequency.cc","stdcall"}, 
+  {"func.PathFindNextComponentW.cc","stdcall"}, 
+  {"func.CertSerializeCertificateStoreElement.cc","stdcall"}, 
+  {"func.CM_Disconnect_Machine.cc","stdcall"}, 
+  {"func.DeleteTimerQueueTimer.cc","stdcall"}, 
+  {"func.SHEvaluateSystemCommandTemplate.cc","stdcall"}, 
+  {"func.VarBstrFromI8.cc","stdcall"}, 
+  {"func.RsopSetPolicySettingStatus.cc","stdcall"}, 
+  {"func.SetClassLongPtrW.cc","stdcall"}, 
+  {"func.GetKeyboardLayoutNameA.cc","stdcall"}, 
+  {"type.HDWP.size","32"}, 
+  {"func.LookupAccountNameA.cc","stdcall"}, 
+  {"func.ImageList_WriteEx.cc","stdcall"}, 
+  {"func.EnterCriticalSection.cc","stdcall"}, 
+  {"func.GetProcessorSystemCycleTime.cc","stdcall"}, 
+  {"func.PathBuildRootA.cc","stdcall"}, 
+  {"func.DefRawInputProc.cc","stdcall"}, 
+  {"func.SafeArrayGetElemsize.cc","stdcall"}, 
+  {"func.GetModuleInformation.cc","stdcall"}, 
+  {"func.LoadUserProfileA.cc","stdcall"}, 
+  {"func.DeriveCapabilitySidsFromName.cc","stdcall"}, 
+  {"func.SymInitializeW.cc","stdcall"}, 
+  {"func.CreateWaitableTimerA.cc","stdcall"}, 
+  {"func.UnregisterScaleChangeEvent.cc","stdcall"}, 
+  {"func.CM_Get_Device_ID_Size_Ex.cc","stdcall"}, 
+  {"func.UnDecorateSymbolNameW.cc","stdcall"}, 
+  {"func.ExpandEnvironmentStringsForUserW.cc","stdcall"}, 
+  {"func.TraceSetInformation.cc","stdcall"}, 
+  {"func.GetTempFileNameA.cc","stdcall"}, 
+  {"func.NeedCurrentDirectoryForExePathW.cc","stdcall"}, 
+  {"func.SafeArrayCopy.cc","stdcall"}, 
+  {"func.CertVerifyCRLRevocation.cc","stdcall"}, 
+  {"func.PackTouchHitTestingProximityEvaluation.cc","stdcall"}, 
+  {"func.VarDecRound.cc","stdcall"}, 
+  {"func.CreateHardLinkTransactedW.cc","stdcall"}, 
+  {"func.FindActCtxSectionStringA.cc","stdcall"}, 
+  {"func.SymLoadModuleEx.cc","stdcall"}, 
+  {"func.SetUserGeoID.cc","stdcall"}, 
+  {"func.ldap_get_valuesW.cc","cdecl"}, 
+  {"func.FindNextVolumeMountPointA.cc","stdcall"}, 
+  {"func.RegisterTouchWindow.cc","stdcall"}, 
+  {"func.CreateSymbolicLinkA.cc","stdcall"}, 
+  {"func.Wow64SetThreadDefaultGuestMachine.cc","stdcall"}, 
+  {"func.WSANSPIoctl.cc","stdcall"}, 
+  {"func.CertEnumCertificateContextProperties.cc","stdcall"}, 
+  {"func.PFXImportCertStore.cc","stdcall"}, 
+  {"func.GetModuleBaseNameA.cc","stdcall"}, 
+  {"func.SetLocaleInfoW.cc","stdcall"}, 
+  {"func.CM_Locate_DevNodeW.cc","stdcall"}, 
+  {"func.CryptHashToBeSigned.cc","stdcall"}, 
+  {"func.SetCurrentDirectoryW.cc","stdcall"}, 
+  {"func.InterlockedPushListSListEx.cc","stdcall"}, 
+  {"func.GetMenuStringW.cc","stdcall"}, 
+  {"func.ColorAdjustLuma.cc","stdcall"}, 
+  {"func.RegisterServiceCtrlHandlerA.cc","stdcall"}, 
+  {"func.BCryptEnumContexts.cc","stdcall"}, 
+  {"func.GetAddressByNameW.cc","stdcall"}, 
+  {"func.GetThreadSelectorEntry.cc","stdcall"}, 
+  {"func.SHGlobalCounterDecrement.cc","stdcall"}, 
+  {"func.RegNotifyChangeKeyValue.cc","stdcall"}, 
+  {"func.PathBuildRootW.cc","stdcall"}, 
+  {"func.ApplicationRecoveryFinished.cc","stdcall"}, 
+  {"func.CryptSetProvParam.cc","stdcall"}, 
+  {"func.EncodeRemotePointer.cc","stdcall"}, 
+  {"func.CreateTypeLib2.cc","stdcall"}, 
+  {"func.EnumerateLoadedModulesExW.cc","stdcall"}, 
+  {"func.FileTimeToDosDateTime.cc","stdcall"}, 
+  {"func.CompareStringEx.cc","stdcall"}, 
+  {"func.CM_Get_HW_Prof_Flags_ExA.cc","stdcall"}, 
+  {"func.TlsGetValue.cc","stdcall"}, 
+  {"func.SHLockShared.cc","stdcall"}, 
+  {"func.AllocateUserPhysicalPagesNuma.cc","stdcall"}, 
+  {"func.FindNextFileA.cc","stdcall"}, 
+  {"func.ldap_unbind_s.cc","cdecl"}, 
+  {"func.StrToInt64ExW.cc","stdcall"}, 
+  {"func.CertEnumSystemStoreLocation.cc","stdcall"}, 
+  {"func.StrCmpNIA.cc","stdcall"}, 
+  {"func.CM_Set_DevNode_Problem.cc","stdcall"}, 
+  {"func.StrCmpICA.cc","stdcall"}, 
+  {"func.CM_Enumerate_Enumerators_ExA.cc","stdcall"}, 
+  {"func.UnlockFileEx.cc","stdcall"}, 
+  {"func.DeregisterEventSource.cc","stdcall"}, 
+  {"func.SetDlgItemInt.cc","stdcall"}, 
+  {"func.CertSetEnhancedKeyUsage.cc","stdcall"}, 
+  {"func.VarI2FromDisp.cc","stdcall"}, 
+  {"func.GetFinalPathNameByHandleW.cc","stdcall"}, 
+  {"func.SwitchToFiber.cc","stdcall"}, 
+  {"func.VarUI2FromI8.cc","stdcall"}, 
+  {"func.WSCEnumProtocols.cc","stdcall"}, 
+  {"func.DecodePointer.cc","stdcall"}, 
+  {"func.GetWindowTextLengthW.cc","stdcall"}, 
+  {"func.PathCchStripToRoot.cc","stdcall"}, 
+  {"func.VarI1FromDec.cc","stdcall"}, 
+  {"func.ParseURLW.cc","stdcall"}, 
+  {"func.GetUserNameExA.cc","stdcall"}, 
+  {"func.GetCurrentDirectoryA.cc","stdcall"}, 
+  {"func.DisplayConfigGetDeviceInfo.cc","stdcall"}, 
+  {"func.RemoveSecureMemoryCacheCallback.cc","stdcall"}, 
+  {"func.GetCommandLineA.cc","stdcall"}, 
+  {"func.CM_Disable_DevNode_Ex.cc","stdcall"}, 
+  {"func.EnumDateFormatsExA.cc","stdcall"}, 
+  {"func.PathCompactPathW.cc","stdcall"}, 
+  {"func.RefreshPolicyEx.cc","stdcall"}, 
+  {"func.CM_Get_Device_IDA.cc","stdcall"}, 
+  {"func.CredUIPromptForCredentialsA.cc","stdcall"}, 
+  {"func.SendDlgItemMessageA.cc","stdcall"}, 
+  {"func.RegQueryReflectionKey.cc","stdcall"}, 
+  {"func.CryptHashCertificate2.cc","stdcall"}, 
+  {"func.ldap_parse_page_control.cc","cdecl"}, 
+  {"func.CreateProcessAsUserW.cc","stdcall"}, 
+  {"func.GetPointerDeviceCursors.cc","stdcall"}, 
+  {"func.ber_first_element.cc","cdecl"}, 
+  {"func.PathIsRootA.cc","stdcall"}, 
+  {"type.HMODULE.size","32"}, 
+  {"func.SetCursor.cc","stdcall"}, 
+  {"func.CreateServiceA.cc","stdcall"}, 
+  {"func.GetDevicePowerState.cc","stdcall"}, 
+  {"func.CreatePrivateNamespaceA.cc","stdcall"}, 
+  {"func.SymFromNameW.cc","stdcall"}, 
+  {"func.StrRChrW.cc","stdcall"}, 
+  {"func.ConvertThreadToFiber.cc","stdcall"}, 
+  {"func.SymFindDebugInfoFile.cc","stdcall"}, 
+  {"func.getpeername.cc","stdcall"}, 
+  {"func.GetMonitorInfoA.cc","stdcall"}, 
+  {"func.GetListBoxInfo.cc","stdcall"}, 
+  {"func.SetProcessPreferredUILanguages.cc","stdcall"}, 
+  {"func.AssocQueryKeyW.cc","stdcall"}, 
+  {"func.SetFileTime.cc","stdcall"}, 
+  {"func.CalculatePopupWindowPosition.cc","stdcall"}, 
+  {"func.CommConfigDialogW.cc","stdcall"}, 
+  {"func.AssocQueryStringA.cc","stdcall"}, 
+  {"func.GetCurrentProcess.cc","stdcall"}, 
+  {"func.CertFindCertificateInCRL.cc","stdcall"}, 
+  {"func.GetDialogBaseUnits.cc","stdcall"}, 
+  {"func.VarI8FromUI2.cc","stdcall"}, 
+  {"func.CredGetTargetInfoW.cc","stdcall"}, 
+  {"func.WSASetLastError.cc","stdcall"}, 
+  {"func.lstrlenA.cc","stdcall"}, 
+  {"func.Wow64SetThreadContext.cc","stdcall"}, 
+  {"func.StrCmpNICA.cc","stdcall"}, 
+  {"func.RegisterClipboardFormatA.cc","stdcall"}, 
+  {"func.GetUserNameExW.cc","stdcall"}, 
+  {"func.CryptGetOIDFunctionValue.cc","stdcall"}, 
+  {"func.VarR8FromI8.cc","stdcall"}, 
+  {"func.FatalAppExitW.cc","stdcall"}, 
+  {"func.GetGestureExtraArgs.cc","stdcall"}, 
+  {"func.ldap_add_s.cc","cdecl"}, 
+  {"func.StrToIntExA.cc","stdcall"}, 
+  {"func.VerInstallFileW.cc","stdcall"}, 
+  {"func.gethostname.cc","stdcall"}, 
+  {"func.GetCurrentUmsThread.cc","stdcall"}, 
+  {"func.SetClassLongW.cc","stdcall"}, 
+  {"func.NCryptEnumAlgorithms.cc","stdcall"}, 
+  {"func.EnumDisplaySettingsExA.cc","stdcall"}, 
+  {"func.GetAppContainerAce.cc","stdcall"}, 
+  {"func.GetConsoleMode.cc","stdcall"}, 
+  {"func.ldap_parse_vlv_controlW.cc","cdecl"}, 
+  {"func.GlobalUnWire.cc","stdcall"}, 
+  {"func.ber_init.cc","cdecl"}, 
+  {"func.AddSecureMemoryCacheCallback.cc","stdcall"}, 
+  {"func.WritePrivateProfileStringA.cc","stdcall"}, 
+  {"func.GetNextUmsListItem.cc","stdcall"}, 
+  {"func.VarI4FromBool.cc","stdcall"}, 
+  {"func.CryptDecodeObjectEx.cc","stdcall"}, 
+  {"func.GetDesktopWindow.cc","stdcall"}, 
+  {"func.CryptInstallOIDFunctionAddress.cc","stdcall"}, 
+  {"func.GetAce.cc","stdcall"}, 
+  {"func.lstrcatW.cc","stdcall"}, 
+  {"func.ScrollWindow.cc","stdcall"}, 
+  {"func.WSALookupServiceNextW.cc","stdcall"}, 
+  {"func.GetMonitorInfoW.cc","stdcall"}, 
+  {"func.BringWindowToTop.cc","stdcall"}, 
+  {"func.VarI8FromDec.cc","stdcall"}, 
+  {"func.CreateDesktopA.cc","stdcall"}, 
+  {"func.CompareStringA.cc","stdcall"}, 
+  {"func.PeekMessageW.cc","stdcall"}, 
+  {"func.GetProcAddress.cc","stdcall"}, 
+  {"func.CryptAcquireCertificatePrivateKey.cc","stdcall"}, 
+  {"func.VarI8FromDisp.cc","stdcall"}, 
+  {"func.CreateHardLinkW.cc","stdcall"}, 
+  {"func.lstrcpyW.cc","stdcall"}, 
+  {"func.GetDeviceDriverBaseNameW.cc","stdcall"}, 
+  {"func.ControlServiceExW.cc","stdcall"}, 
+  {"func.WriteConsoleOutputA.cc","stdcall"}, 
+  {"func.GetCompressedFileSizeTransactedW.cc","stdcall"}, 
+  {"func.FindFirstFileW.cc","stdcall"}, 
+  {"func.ldap_search_ext_sA.cc","cdecl"}, 
+  {"func.PathStripToRootA.cc","stdcall"}, 
+  {"func.GetCompressedFileSizeW.cc","stdcall"}, 
+  {"func.LoadImageW.cc","stdcall"}, 
+  {"func.SetProcessDPIAware.cc","stdcall"}, 
+  {"func.CreateActCtxA.cc","stdcall"}, 
+  {"func.GetQueuedCompletionStatus.cc","stdcall"}, 
+  {"func.FindWindowExA.cc","stdcall"}, 
+  {"func.VarI8FromDate.cc","stdcall"}, 
+  {"func.LCIDToLocaleName.cc","stdcall"}, 
+  {"func.ShellMessageBoxW.cc","cdecl"}, 
+  {"func.SymFromAddrW.cc","stdcall"}, 
+  {"func.CM_Get_Device_ID_Size.cc","stdcall"}, 
+  {"func.WinHttpWebSocketClose.cc","stdcall"}, 
+  {"func.SymEnumSymbolsW.cc","stdcall"}, 
+  {"func.VarR8Pow.cc","stdcall"}, 
+  {"func.VarR4FromI1.cc","stdcall"}, 
+  {"func.NCryptDeleteKey.cc","stdcall"}, 
+  {"func.SHCreateThreadRef.cc","stdcall"}, 
+  {"func.LocalSize.cc","stdcall"}, 
+  {"func.GetComboBoxInfo.cc","stdcall"}, 
+  {"func.StrNCatA.cc","stdcall"}, 
+  {"func.OpenClipboard.cc","stdcall"}, 
+  {"func.ImageList_Remove.cc","stdcall"}, 
+  {"func.FindStringOrdinal.cc","stdcall"}, 
+  {"func.CM_Locate_DevNode_ExW.cc","stdcall"}, 
+  {"func.SafeArrayRedim.cc","stdcall"}, 
+  {"func.ConvertStringSidToSidA.cc","stdcall"}, 
+  {"func.CoFileTimeToDosDateTime.cc","stdcall"}, 
+  {"func.ldap_rename_extW.cc","cdecl"}, 
+  {"func.VarCyMulI8.cc","stdcall"}, 
+  {"func.CertAddEncodedCertificateToSystemStoreA.cc","stdcall"}, 
+  {"func.GetThreadId.cc","stdcall"}, 
+  {"func.SymSrvGetFileIndexes.cc","stdcall"}, 
+  {"func._llseek.cc","stdcall"}, 
+  {"func.ldap_escape_filter_element.cc","cdecl"}, 
+  {"func.OleCreateFontIndirect.cc","stdcall"}, 
+  {"func.WaitNamedPipeA.cc","stdcall"}, 
+  {"func.VarI2FromStr.cc","stdcall"}, 
+  {"func.GetWindowsDirectoryW.cc","stdcall"}, 
+  {"func.GetDeviceDriverBaseNameA.cc","stdcall"}, 
+  {"func.WinHttpFreeProxyResultEx.cc","stdcall"}, 
+  {"func.StrRStrIW.cc","stdcall"}, 
+  {"func.ldap_modrdnW.cc","cdecl"}, 
+  {"func.PathRemoveBackslashA.cc","stdcall"}, 
+  {"func.MonikerRelativePathTo.cc","stdcall"}, 
+  {"func.BCryptResolveProviders.cc","stdcall"}, 
+  {"func.ldap_perror.cc","cdecl"}, 
+  {"func.ber_next_element.cc","cdecl"}, 
+  {"func.CreateActCtxW.cc","stdcall"}, 
+  {"func.BeginDeferWindowPos.cc","stdcall"}, 
+  {"func.VarBoolFromUI4.cc","stdcall"}, 
+  {"func.OpenSCManagerA.cc","stdcall"}, 
+  {"func.CreateProcessA.cc","stdcall"}, 
+  {"func.VirtualUnlock.cc","stdcall"}, 
+  {"func.CreateWaitableTimerW.cc","stdcall"}, 
+  {"func.CM_Remove_SubTree_Ex.cc","stdcall"}, 
+  {"func.BCryptGenerateSymmetricKey.cc","stdcall"}, 
+  {"func.SymRefreshModuleList.cc","stdcall"}, 
+  {"func.CM_Get_Global_State_Ex.cc","stdcall"}, 
+  {"func.CertVerifyValidityNesting.cc","stdcall"}, 
+  {"func.DllRegisterServer.cc","stdcall"}, 
+  {"func.RtlUnwind.cc","stdcall"}, 
+  {"func.UrlHashW.cc","stdcall"}, 
+  {"func.BCryptConfigureContext.cc","stdcall"}, 
+  {"func.GetNumberOfConsoleInputEvents.cc","stdcall"}, 
+  {"func.SHGetViewStatePropertyBag.cc","stdcall"}, 
+  {"func.ImageList_ReadEx.cc","stdcall"}, 
+  {"func.GetFirmwareEnvironmentVariableExA.cc","stdcall"}, 
+  {"func.ImageList_Write.cc","stdcall"}, 
+  {"func.Wow64SuspendThread.cc","stdcall"}, 
+  {"func.CM_Get_Device_ID_List_Size_ExW.cc","stdcall"}, 
+  {"func.UrlGetPartA.cc","stdcall"}, 
+  {"func.DisableThreadProfiling.cc","stdcall"}, 
+  {"func.VarBstrFromDec.cc","stdcall"}, 
+  {"func.GetMenuItemInfoA.cc","stdcall"}, 
+  {"func.SetDisplayConfig.cc","stdcall"}, 
+  {"func.LoadMenuIndirectW.cc","stdcall"}, 
+  {"func.StrCmpCA.cc","stdcall"}, 
+  {"func.RegOpenKeyTransactedW.cc","stdcall"}, 
+  {"func.ldap_bind_s.cc","cdecl"}, 
+  {"func.GetAddressByNameA.cc","stdcall"}, 
+  {"func.TryAcquireSRWLockExclusive.cc","stdcall"}, 
+  {"func.WinHttpWebSocketQueryCloseStatus.cc","stdcall"}, 
+  {"func.BCryptGenerateKeyPair.cc","stdcall"}, 
+  {"func.GetKeyboardState.cc","stdcall"}, 
+  {"func.GetMenu.cc","stdcall"}, 
+  {"func.VarI4FromDisp.cc","stdcall"}, 
+  {"func.VarDateFromI2.cc","stdcall"}, 
+  {"func.CreateDirectoryExA.cc","stdcall"}, 
+  {"func.ControlService.cc","stdcall"}, 
+  {"func.GetComputerNameW.cc","stdcall"}, 
+  {"func.SHRegOpenUSKeyA.cc","stdcall"}, 
+  {"func.WSAEnumProtocolsA.cc","stdcall"}, 
+  {"func.WinHttpResetAutoProxy.cc","stdcall"}, 
+  {"func.CancelTimerQueueTimer.cc","stdcall"}, 
+  {"func.wvsprintfA.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_AliasW.cc","stdcall"}, 
+  {"func.SetDoubleClickTime.cc","stdcall"}, 
+  {"func.ChangeDisplaySettingsW.cc","stdcall"}, 
+  {"func.GetNamedPipeInfo.cc","stdcall"}, 
+  {"func.EnumPageFilesW.cc","stdcall"}, 
+  {"func.SymEnumerateModules64.cc","stdcall"}, 
+  {"func.DialogBoxIndirectParamA.cc","stdcall"}, 
+  {"func.GetFileAttributesW.cc","stdcall"}, 
+  {"func.VerifyScripts.cc","stdcall"}, 
+  {"func.CertCreateCTLEntryFromCertificateContextProperties.cc","stdcall"}, 
+  {"func.GetDurationFormatEx.cc","stdcall"}, 
+  {"func.EnableTrace.cc","stdcall"}, 
+  {"func.WinHttpGetDefaultProxyConfiguration.cc","stdcall"}, 
+  {"func.FreeSid.cc","stdcall"}, 
+  {"func.CM_Is_Version_Available.cc","stdcall"}, 
+  {"func.CertOpenServerOcspResponse.cc","stdcall"}, 
+  {"func.WinHttpSetDefaultProxyConfiguration.cc","stdcall"}, 
+  {"func.MapUserPhysicalPagesScatter.cc","stdcall"}, 
+  {"func.SymGetHomeDirectoryW.cc","stdcall"}, 
+  {"func.SetFilePointer.cc","stdcall"}, 
+  {"func.ldap_delete_sW.cc","cdecl"}, 
+  {"func.SetCurrentProcessExplicitAppUserModelID.cc","stdcall"}, 
+  {"func.SetWindowLongPtrA.cc","stdcall"}, 
+  {"func.GetDlgCtrlID.cc","stdcall"}, 
+  {"func.NCryptQueryProtectionDescriptorName.cc","stdcall"}, 
+  {"func.PathIsUNCServerW.cc","stdcall"}, 
+  {"func.CM_Free_Log_Conf.cc","stdcall"}, 
+  {"func.VarCyCmpR8.cc","stdcall"}, 
+  {"func.CopyImage.cc","stdcall"}, 
+  {"func.IsNLSDefinedString.cc","stdcall"}, 
+  {"func.SetServiceStatus.cc","stdcall"}, 
+  {"func.EnumDateFormatsExW.cc","stdcall"}, 
+  {"func.OpenFileMappingA.cc","stdcall"}, 
+  {"func.CredUIPromptForCredentialsW.cc","stdcall"}, 
+  {"func.ReadConsoleA.cc","stdcall"}, 
+  {"func.GetAppContainerNamedObjectPath.cc","stdcall"}, 
+  {"func.EnumResourceNamesExW.cc","stdcall"}, 
+  {"func.EnumServicesStatusA.cc","stdcall"}, 
+  {"func.recvfrom.cc","stdcall"}, 
+  {"func.FreeEnvironmentStringsW.cc","stdcall"}, 
+  {"func.SetLastError.cc","stdcall"}, 
+  {"func.GlobalGetAtomNameW.cc","stdcall"}, 
+  {"func.VarR8FromUI2.cc","stdcall"}, 
+  {"func.IsValidSid.cc","stdcall"}, 
+  {"func.StrStrW.cc","stdcall"}, 
+  {"func.CertCreateCRLContext.cc","stdcall"}, 
+  {"func.ldap_parse_sort_controlA.cc","cdecl"}, 
+  {"func.CertFindCertificateInStore.cc","stdcall"}, 
+  {"func.SetFileSecurityW.cc","stdcall"}, 
+  {"func.RsopAccessCheckByType.cc","stdcall"}, 
+  {"func.RegisterHotKey.cc","stdcall"}, 
+  {"func.PathMakePrettyW.cc","stdcall"}, 
+  {"func.GetBinaryTypeA.cc","stdcall"}, 
+  {"func.AnimateWindow.cc","stdcall"}, 
+  {"func.IntlStrEqWorkerA.cc","stdcall"}, 
+  {"func.SleepConditionVariableSRW.cc","stdcall"}, 
+  {"func.CryptDecodeMessage.cc","stdcall"}, 
+  {"func.WSAPoll.cc","stdcall"}, 
+  {"func.SHGlobalCounterIncrement.cc","stdcall"}, 
+  {"func.CryptFindLocalizedName.cc","stdcall"}, 
+  {"func.AccessCheckByTypeResultListAndAuditAlarmA.cc","stdcall"}, 
+  {"func.UnionRect.cc","stdcall"}, 
+  {"func.CryptGetKeyIdentifierProperty.cc","stdcall"}, 
+  {"func.CM_Dup_Range_List.cc","stdcall"}, 
+  {"func.GetTapeStatus.cc","stdcall"}, 
+  {"func.GetAllUsersProfileDirectoryW.cc","stdcall"}, 
+  {"func.EnableWindow.cc","stdcall"}, 
+  {"func.EnumDateFormatsExEx.cc","stdcall"}, 
+  {"func.CM_Get_Res_Des_Data_Ex.cc","stdcall"}, 
+  {"func.GetNumaHighestNodeNumber.cc","stdcall"}, 
+  {"func.CreateAcceleratorTableA.cc","stdcall"}, 
+  {"func.SetFileBandwidthReservation.cc","stdcall"}, 
+  {"func.PathIsUNCServerA.cc","stdcall"}, 
+  {"func.SafeArrayUnlock.cc","stdcall"}, 
+  {"func.GetSecurityDescriptorDacl.cc","stdcall"}, 
+  {"func.UnregisterTouchWindow.cc","stdcall"}, 
+  {"func.ldap_ufn2dnW.cc","cdecl"}, 
+  {"func.StrIsIntlEqualA.cc","stdcall"}, 
+  {"func.TerminateProcessOnMemoryExhaustion.cc","stdcall"}, 
+  {"func.StringFromCLSID.cc","stdcall"}, 
+  {"func.K32EnumPageFilesW.cc","stdcall"}, 
+  {"func.GetSystemFirmwareTable.cc","stdcall"}, 
+  {"func.OpenJobObjectA.cc","stdcall"}, 
+  {"func.CM_Add_ID_ExW.cc","stdcall"}, 
+  {"func.StartServiceA.cc","stdcall"}, 
+  {"func.CertSerializeCTLStoreElement.cc","stdcall"}, 
+  {"func.CreateFileMappingA.cc","stdcall"}, 
+  {"func.OpenDesktopA.cc","stdcall"}, 
+  {"func.CryptCreateAsyncHandle.cc","stdcall"}, 
+  {"func.InitiateSystemShutdownExA.cc","stdcall"}, 
+  {"func.MapVirtualKeyExA.cc","stdcall"}, 
+  {"func.FlushFileBuffers.cc","stdcall"}, 
+  {"func.SafeArraySetIID.cc","stdcall"}, 
+  {"func.WSALookupServiceNextA.cc","stdcall"}, 
+  {"func.GetCommConfig.cc","stdcall"}, 
+  {"func.SymCompareInlineTrace.cc","stdcall"}, 
+  {"func.MonitorFromPoint.cc","stdcall"}, 
+  {"func.WSCInstallNameSpace32.cc","stdcall"}, 
+  {"func.CertCreateCertificateChainEngine.cc","stdcall"}, 
+  {"func.IdnToNameprepUnicode.cc","stdcall"}, 
+  {"func.VarUI1FromDisp.cc","stdcall"}, 
+  {"func.K32GetProcessImageFileNameA.cc","stdcall"}, 
+  {"func.GetSysColorBrush.cc","stdcall"}, 
+  {"func.IsWindowEnabled.cc","stdcall"}, 
+  {"func.CertAddCertificateContextToStore.cc","stdcall"}, 
+  {"func.GetNumaProcessorNodeEx.cc","stdcall"}, 
+  {"func.InitOnceBeginInitialize.cc","stdcall"}, 
+  {"func.StrPBrkA.cc","stdcall"}, 
+  {"func.SymSrvGetFileIndexInfo.cc","stdcall"}, 
+  {"func.MapViewOfFileEx.cc","stdcall"}, 
+  {"func.EnumResourceLanguagesW.cc","stdcall"}, 
+  {"func.GetWindowRect.cc","stdcall"}, 
+  {"func.CertFindCRLInStore.cc","stdcall"}, 
+  {"func.WSCEnableNSProvider32.cc","stdcall"}, 
+  {"func.RegOpenUserClassesRoot.cc","stdcall"}, 
+  {"func.EndPaint.cc","stdcall"}, 
+  {"func.ConvertThreadToFiberEx.cc","stdcall"}, 
+  {"func.ChangeWindowMessageFilter.cc","stdcall"}, 
+  {"func.ldap_ufn2dnA.cc","cdecl"}, 
+  {"func.StrIsIntlEqualW.cc","stdcall"}, 
+  {"func.PrivateExtractIconsA.cc","stdcall"}, 
+  {"func.GetWsChangesEx.cc","stdcall"}, 
+  {"func.CloseThreadpoolIo.cc","stdcall"}, 
+  {"func.SetLocalTime.cc","stdcall"}, 
+  {"func.StartServiceW.cc","stdcall"}, 
+  {"func.CreateEventExW.cc","stdcall"}, 
+  {"func.RegLoadAppKeyA.cc","stdcall"}, 
+  {"func.SymGetScope.cc","stdcall"}, 
+  {"func.EnumerateTraceGuidsEx.cc","stdcall"}, 
+  {"func.UnhookWinEvent.cc","stdcall"}, 
+  {"func.GetUserDefaultUILanguage.cc","stdcall"}, 
+  {"func.SHReleaseThreadRef.cc","stdcall"}, 
+  {"func.GetTapePosition.cc","stdcall"}, 
+  {"func.CertResyncCertificateChainEngine.cc","stdcall"}, 
+  {"func.CM_Get_Next_Log_Conf.cc","stdcall"}, 
+  {"func.GetFullPathNameTransactedW.cc","stdcall"}, 
+  {"func.DefWindowProcA.cc","stdcall"}, 
+  {"func.WinHttpOpenRequest.cc","stdcall"}, 
+  {"func.GetIconInfoExW.cc","stdcall"}, 
+  {"func.SetWindowsHookExA.cc","stdcall"}, 
+  {"func.QueryDecompressorInformation.cc","stdcall"}, 
+  {"func.WSAStartup.cc","stdcall"}, 
+  {"func.WPUOpenCurrentThread.cc","stdcall"}, 
+  {"func.RsopFileAccessCheck.cc","stdcall"}, 
+  {"func.VarCyFromBool.cc","stdcall"}, 
+  {"func.CM_Get_Device_ID_List_ExA.cc","stdcall"}, 
+  {"func.VirtualQuery.cc","stdcall"}, 
+  {"func.DisableProcessWindowsGhosting.cc","stdcall"}, 
+  {"func.WSANtohs.cc","stdcall"}, 
+  {"func.DragDetect.cc","stdcall"}, 
+  {"func.CertCloseStore.cc","stdcall"}, 
+  {"func.GetApplicationRestartSettings.cc","stdcall"}, 
+  {"func.GetProcessShutdownParameters.cc","stdcall"}, 
+  {"func.QueryTraceProcessingHandle.cc","stdcall"}, 
+  {"func.CreateCompressor.cc","stdcall"}, 
+  {"func.StrRChrIA.cc","stdcall"}, 
+  {"func.InitializeAcl.cc","stdcall"}, 
+  {"func.IIDFromString.cc","stdcall"}, 
+  {"func.SymSetSearchPath.cc","stdcall"}, 
+  {"func.SymGetModuleBase.cc","stdcall"}, 
+  {"func.PrivilegedServiceAuditAlarmW.cc","stdcall"}, 
+  {"func.GetSystemWow64Directory2A.cc","stdcall"}, 
+  {"func.PathRenameExtensionA.cc","stdcall"}, 
+  {"func.SubmitThreadpoolWork.cc","stdcall"}, 
+  {"func.SetKeyboardState.cc","stdcall"}, 
+  {"func.SafeArrayReleaseData.cc","stdcall"}, 
+  {"func.IStream_Read.cc","stdcall"}, 
+  {"func.BCryptConfigureContextFunction.cc","stdcall"}, 
+  {"func.SymEnumerateSymbolsW64.cc","stdcall"}, 
+  {"func.SHStrDupW.cc","stdcall"}, 
+  {"func.CertEnumCertificatesInStore.cc","stdcall"}, 
+  {"func.CreateSymbolicLinkTransactedA.cc","stdcall"}, 
+  {"func.AssocCreateForClasses.cc","stdcall"}, 
+  {"func.K32GetDeviceDriverFileNameW.cc","stdcall"}, 
+  {"func.AccessCheckByTypeAndAuditAlarmW.cc","stdcall"}, 
+  {"func.ImageNtHeader.cc","stdcall"}, 
+  {"func.IsBadHugeReadPtr.cc","stdcall"}, 
+  {"func.StrRetToBSTR.cc","stdcall"}, 
+  {"func.SetComputerNameExA.cc","stdcall"}, 
+  {"func.RegGetKeySecurity.cc","stdcall"}, 
+  {"func.StrCmpNCA.cc","stdcall"}, 
+  {"func.GetFullPathNameTransactedA.cc","stdcall"}, 
+  {"func.CM_Delete_Class_Key.cc","stdcall"}, 
+  {"func.SafeArrayCreateVectorEx.cc","stdcall"}, 
+  {"func.EnumPropsW.cc","stdcall"}, 
+  {"func.RegConnectRegistryExW.cc","stdcall"}, 
+  {"func.GetThreadGroupAffinity.cc","stdcall"}, 
+  {"func.VarBstrFromDate.cc","stdcall"}, 
+  {"func.VarCyRound.cc","stdcall"}, 
+  {"func.UrlGetPartW.cc","stdcall"}, 
+  {"func.CertEnumSystemStore.cc","stdcall"}, 
+  {"func.CryptImportPublicKeyInfoEx.cc","stdcall"}, 
+  {"func.RegisterBadMemoryNotification.cc","stdcall"}, 
+  {"func.ClearEventLogW.cc","stdcall"}, 
+  {"func.CloseThreadpoolCleanupGroup.cc","stdcall"}, 
+  {"func.CryptEnumOIDFunction.cc","stdcall"}, 
+  {"func.CM_Get_Class_Key_Name_ExA.cc","stdcall"}, 
+  {"func.CM_Enable_DevNode_Ex.cc","stdcall"}, 
+  {"func.QueryServiceObjectSecurity.cc","stdcall"}, 
+  {"func.FormatMessageW.cc","stdcall"}, 
+  {"func.IsChild.cc","stdcall"}, 
+  {"func.CoTestCancel.cc","stdcall"}, 
+  {"func.IsValidNLSVersion.cc","stdcall"}, 
+  {"func.GetVolumeInformationA.cc","stdcall"}, 
+  {"func.SymGetTypeInfoEx.cc","stdcall"}, 
+  {"func.SafeArrayUnaccessData.cc","stdcall"}, 
+  {"func.NCryptKeyDerivation.cc","stdcall"}, 
+  {"func.HeapLock.cc","stdcall"}, 
+  {"func.EnumPageFilesA.cc","stdcall"}, 
+  {"func.socket.cc","stdcall"}, 
+  {"func.VarUI8FromI2.cc","stdcall"}, 
+  {"func.SHUnicodeToAnsi.cc","stdcall"}, 
+  {"func.GlobalReAlloc.cc","stdcall"}, 
+  {"func.SetFileCompletionNotificationModes.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_List_ExW.cc","stdcall"}, 
+  {"func.SetCriticalSectionSpinCount.cc","stdcall"}, 
+  {"func.CreateBindCtx.cc","stdcall"}, 
+  {"func.BCryptEnumRegisteredProviders.cc","stdcall"}, 
+  {"func.WPUResetEvent.cc","stdcall"}, 
+  {"func.SHRegCreateUSKeyA.cc","stdcall"}, 
+  {"func.RegCreateKeyA.cc","stdcall"}, 
+  {"func.CertUnregisterPhysicalStore.cc","stdcall"}, 
+  {"func.ReadConsoleInputA.cc","stdcall"}, 
+  {"func.EventAccessControl.cc","stdcall"}, 
+  {"func.MonitorFromRect.cc","stdcall"}, 
+  {"func.SafeArrayAddRef.cc","stdcall"}, 
+  {"func.TabbedTextOutA.cc","stdcall"}, 
+  {"func.GetDurationFormat.cc","stdcall"}, 
+  {"func.SendInput.cc","stdcall"}, 
+  {"func.CreateFileTransactedW.cc","stdcall"}, 
+  {"func.OpenInputDesktop.cc","stdcall"}, 
+  {"func.SymSearch.cc","stdcall"}, 
+  {"func.CoMarshalInterface.cc","stdcall"}, 
+  {"func.SymSrvGetSupplement.cc","stdcall"}, 
+  {"func.CM_Uninstall_DevNode_Ex.cc","stdcall"}, 
+  {"func.GetSystemDirectoryW.cc","stdcall"}, 
+  {"func.GetFullPathNameW.cc","stdcall"}, 
+  {"func.NCryptTranslateHandle.cc","stdcall"}, 
+  {"func.SymRegisterFunctionEntryCallback64.cc","stdcall"}, 
+  {"func.ReadDirectoryChangesW.cc","stdcall"}, 
+  {"func.CreateTimerQueueTimer.cc","stdcall"}, 
+  {"func.EnterCriticalPolicySection.cc","stdcall"}, 
+  {"func.GetRunningObjectTable.cc","stdcall"}, 
+  {"func.RegisterWaitForSingleObject.cc","stdcall"}, 
+  {"func.CryptSignHashA.cc","stdcall"}, 
+  {"type.HGDIOBJ.size","32"}, 
+  {"func.SymEnumTypesW.cc","stdcall"}, 
+  {"func.WaitForThreadpoolWaitCallbacks.cc","stdcall"}, 
+  {"func.OleLoadPictureFile.cc","stdcall"}, 
+  {"func.WSAHtons.cc","stdcall"}, 
+  {"func.SetVolumeMountPointA.cc","stdcall"}, 
+  {"func.CertNameToStrW.cc","stdcall"}, 
+  {"func.WTSIsServerContainer.cc","stdcall"}, 
+  {"func.FindNextVolumeW.cc","stdcall"}, 
+  {"func.ResetCompressor.cc","stdcall"}, 
+  {"func.PathFindFileNameW.cc","stdcall"}, 
+  {"func.SetPhysicalCursorPos.cc","stdcall"}, 
+  {"func.CloseDesktop.cc","stdcall"}, 
+  {"func._hwrite.cc","stdcall"}, 
+  {"func.CryptStringToBinaryA.cc","stdcall"}, 
+  {"func.EnumThreadWindows.cc","stdcall"}, 
+  {"func.BCryptHash.cc","stdcall"}, 
+  {"func.WSAGetServiceClassNameByClassIdA.cc","stdcall"}, 
+  {"func.DeleteProcThreadAttributeList.cc","stdcall"}, 
+  {"func.CertRDNValueToStrW.cc","stdcall"}, 
+  {"func.SymRegisterCallbackW64.cc","stdcall"}, 
+  {"func.WPUCloseThread.cc","stdcall"}, 
+  {"func.UnregisterApplicationRestart.cc","stdcall"}, 
+  {"func.SetUmsThreadInformation.cc","stdcall"}, 
+  {"func.GetDpiForWindow.cc","stdcall"}, 
+  {"type.LPCTSTR.size","32"}, 
+  {"func.CloseCompressor.cc","stdcall"}, 
+  {"func.SHCreateMemStream.cc","stdcall"}, 
+  {"func.CM_Free_Log_Conf_Ex.cc","stdcall"}, 
+  {"func.GenerateGPNotification.cc","stdcall"}, 
+  {"func.VarDateFromR4.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_PropertyW.cc","stdcall"}, 
+  {"func.WSAConnectByNameW.cc","stdcall"}, 
+  {"func.CoDisconnectObject.cc","stdcall"}, 
+  {"func.GetTypeByNameA.cc","stdcall"}, 
+  {"func.CryptMemAlloc.cc","stdcall"}, 
+  {"func.ldap_count_valuesA.cc","cdecl"}, 
+  {"func.WinHttpQueryDataAvailable.cc","stdcall"}, 
+  {"func.CryptMsgControl.cc","stdcall"}, 
+  {"func.CreateDialogIndirectParamA.cc","stdcall"}, 
+  {"func.VirtualAllocEx.cc","stdcall"}, 
+  {"func.WriteTapemark.cc","stdcall"}, 
+  {"func.FindNextVolumeA.cc","stdcall"}, 
+  {"func.PathMatchSpecW.cc","stdcall"}, 
+  {"func.GetDpiFromDpiAwarenessContext.cc","stdcall"}, 
+  {"func.CM_Query_Remove_SubTree_Ex.cc","stdcall"}, 
+  {"func.CharPrevA.cc","stdcall"}, 
+  {"func.SetPrivateObjectSecurityEx.cc","stdcall"}, 
+  {"func.ReadEncryptedFileRaw.cc","stdcall"}, 
+  {"func.ldap_search_abandon_page.cc","cdecl"}, 
+  {"func.VarDecFromUI8.cc","stdcall"}, 
+  {"func.UnregisterPowerSettingNotification.cc","stdcall"}, 
+  {"func.BCryptSecretAgreement.cc","stdcall"}, 
+  {"func.InitializeTouchInjection.cc","stdcall"}, 
+  {"func.EnumerateTraceGuids.cc","stdcall"}, 
+  {"func.SymGetLinePrev64.cc","stdcall"}, 
+  {"func.GetPrivateProfileStringW.cc","stdcall"}, 
+  {"func.LoadRegTypeLib.cc","stdcall"}, 
+  {"func.SafeArrayCreateVector.cc","stdcall"}, 
+  {"func.AllowSetForegroundWindow.cc","stdcall"}, 
+  {"func.LBItemFromPt.cc","stdcall"}, 
+  {"func.PathRelativePathToW.cc","stdcall"}, 
+  {"func.CryptFindCertificateKeyProvInfo.cc","stdcall"}, 
+  {"func.ImageList_EndDrag.cc","stdcall"}, 
+  {"func.GetNumberFormatA.cc","stdcall"}, 
+  {"func.CertOpenSystemStoreA.cc","stdcall"}, 
+  {"func.ldap_compare_extW.cc","cdecl"}, 
+  {"func.SetProcessWindowStation.cc","stdcall"}, 
+  {"func.ImageRvaToVa.cc","stdcall"}, 
+  {"func.StrRetToStrW.cc","stdcall"}, 
+  {"func.GetAtomNameA.cc","stdcall"}, 
+  {"func.UnmapDebugInformation.cc","stdcall"}, 
+  {"func.EnumCalendarInfoExEx.cc","stdcall"}, 
+  {"func.VarUI4FromI2.cc","stdcall"}, 
+  {"func.QueryOptionalDelayLoadedAPI.cc","stdcall"}, 
+  {"func.SetWindowsHookW.cc","stdcall"}, 
+  {"func.getaddrinfo.cc","stdcall"}, 
+  {"func.VarI4FromR4.cc","stdcall"}, 
+  {"func.WSAAccept.cc","stdcall"}, 
+  {"func.PropVariantClear.cc","stdcall"}, 
+  {"func.GetSysColor.cc","stdcall"}, 
+  {"func.CreateEventExA.cc","stdcall"}, 
+  {"func.GetProcessIoCounters.cc","stdcall"}, 
+  {"func.SymGetTypeFromNameW.cc","stdcall"}, 
+  {"func.ldap_set_dbg_routine.cc","cdecl"}, 
+  {"func.CM_Open_Device_Interface_Key_ExW.cc","stdcall"}, 
+  {"func.WSASendTo.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_List_Size_ExA.cc","stdcall"}, 
+  {"func.SetSecurityDescriptorOwner.cc","stdcall"}, 
+  {"func.BCryptQueryContextFunctionProperty.cc","stdcall"}, 
+  {"func.QueryFullProcessImageNameW.cc","stdcall"}, 
+  {"func.SHGetValueA.cc","stdcall"}, 
+  {"func.CreateThreadpoolWork.cc","stdcall"}, 
+  {"func.SymFindFileInPathW.cc","stdcall"}, 
+  {"func.SetWindowsHookExW.cc","stdcall"}, 
+  {"func.IsWindowUnicode.cc","stdcall"}, 
+  {"func.RegisterScaleChangeEvent.cc","stdcall"}, 
+  {"func.DuplicateTokenEx.cc","stdcall"}, 
+  {"func.VarUI1FromR4.cc","stdcall"}, 
+  {"func.IsCharSpaceA.cc","stdcall"}, 
+  {"func.VerFindFileA.cc","stdcall"}, 
+  {"func.EnumDesktopsW.cc","stdcall"}, 
+  {"func.GetMenuDefaultItem.cc","stdcall"}, 
+  {"func.VarBoolFromI8.cc","stdcall"}, 
+  {"func.CM_Locate_DevNodeA.cc","stdcall"}, 
+  {"func.CoSetCancelObject.cc","stdcall"}, 
+  {"func.FindNextFileNameW.cc","stdcall"}, 
+  {"func.GetConsoleScreenBufferInfoEx.cc","stdcall"}, 
+  {"func.CryptCreateKeyIdentifierFromCSP.cc","stdcall"}, 
+  {"func.BCryptRemoveContextFunction.cc","stdcall"}, 
+  {"func.GetThreadPriorityBoost.cc","stdcall"}, 
+  {"func.SetSecurityDescriptorDacl.cc","stdcall"}, 
+  {"func.StackWalkEx.cc","stdcall"}, 
+  {"func.UrlCanonicalizeA.cc","stdcall"}, 
+  {"func.ConvertSecurityDescriptorToStringSecurityDescriptorA.cc","stdcall"}, 
+  {"func.AssocIsDangerous.cc","stdcall"}, 
+  {"func.UrlIsOpaqueA.cc","stdcall"}, 
+  {"func.ExtractAssociatedIconA.cc","stdcall"}, 
+  {"func.GetMouseMovePointsEx.cc","stdcall"}, 
+  {"func.HeapDestroy.cc","stdcall"}, 
+  {"func.CharUpperA.cc","stdcall"}, 
+  {"func.WSACloseEvent.cc","stdcall"}, 
+  {"func.CredUIParseUserNameA.cc","stdcall"}, 
+  {"func.CertOpenStore.cc","stdcall"}, 
+  {"func.MapViewOfFileNuma2.cc","stdcall"}, 
+  {"func.SafeArrayGetIID.cc","stdcall"}, 
+  {"func.AccessCheckByTypeAndAuditAlarmA.cc","stdcall"}, 
+  {"func.DebugActiveProcess.cc","stdcall"}, 
+  {"func.EnumCalendarInfoW.cc","stdcall"}, 
+  {"func.SearchTreeForFile.cc","stdcall"}, 
+  {"func.VarDecFromI4.cc","stdcall"}, 
+  {"func.GetCurrencyFormatW.cc","stdcall"}, 
+  {"func.SHAssocEnumHandlersForProtocolByApplication.cc","stdcall"}, 
+  {"func.ldap_openW.cc","cdecl"}, 
+  {"func.BCryptDuplicateKey.cc","stdcall"}, 
+  {"func.ldap_get_next_page.cc","cdecl"}, 
+  {"func.IsIconic.cc","stdcall"}, 
+  {"func.CM_Get_Class_Registry_PropertyW.cc","stdcall"}, 
+  {"func.GetWindowDpiHostingBehavior.cc","stdcall"}, 
+  {"func.EnumPropsA.cc","stdcall"}, 
+  {"func.EnumDisplaySettingsA.cc","stdcall"}, 
+  {"func.LoadStringA.cc","stdcall"}, 
+  {"func.LoadKeyboardLayoutW.cc","stdcall"}, 
+  {"func.GetMessageExtraInfo.cc","stdcall"}, 
+  {"func.PathIsContentTypeA.cc","stdcall"}, 
+  {"func.TryAcquireSRWLockShared.cc","stdcall"}, 
+  {"func.TranslateNameW.cc","stdcall"}, 
+  {"func.CryptSIPAddProvider.cc","stdcall"}, 
+  {"func.GetFinalPathNameByHandleA.cc","stdcall"}, 
+  {"func.SetConsoleCursorInfo.cc","stdcall"}, 
+  {"func.CertAddEncodedCTLToStore.cc","stdcall"}, 
+  {"func.IsBadHugeWritePtr.cc","stdcall"}, 
+  {"func.FreeGPOListA.cc","stdcall"}, 
+  {"func.SafeArrayDestroyDescriptor.cc","stdcall"}, 
+  {"func.SHIsLowMemoryMachine.cc","stdcall"}, 
+  {"func.RegQueryValueExA.cc","stdcall"}, 
+  {"func.OpenBackupEventLogW.cc","stdcall"}, 
+  {"func.CM_Run_Detection_Ex.cc","stdcall"}, 
+  {"func.IsTextUnicode.cc","stdcall"}, 
+  {"func.ldap_initW.cc","cdecl"}, 
+  {"func.WaitMessage.cc","stdcall"}, 
+  {"func.QueryProcessAffinityUpdateMode.cc","stdcall"}, 
+  {"func.EnumResourceLanguagesExW.cc","stdcall"}, 
+  {"func.GetLogicalProcessorInformation.cc","stdcall"}, 
+  {"func.CommandLineToArgvW.cc","stdcall"}, 
+  {"func.DeleteAtom.cc","stdcall"}, 
+  {"func.RegCreateKeyW.cc","stdcall"}, 
+  {"func.CM_Open_Device_Interface_KeyW.cc","stdcall"}, 
+  {"func.CryptSetAsyncParam.cc","stdcall"}, 
+  {"func.AdjustWindowRect.cc","stdcall"}, 
+  {"func.InterlockedPushEntrySList.cc","stdcall"}, 
+  {"func.UninitializeFlatSB.cc","stdcall"}, 
+  {"func.SymGetOmaps.cc","stdcall"}, 
+  {"func.ldap_search_sA.cc","cdecl"}, 
+  {"func.WSAInstallServiceClassA.cc","stdcall"}, 
+  {"func.ldap_startup.cc","cdecl"}, 
+  {"func.SHSkipJunction.cc","stdcall"}, 
+  {"func.SetProcessDefaultLayout.cc","stdcall"}, 
+  {"func.GetCursor.cc","stdcall"}, 
+  {"func.OpenEventLogW.cc","stdcall"}, 
+  {"func.SymGetSourceFile.cc","stdcall"}, 
+  {"func.lstrlenW.cc","stdcall"}, 
+  {"func.EnumerateLoadedModulesW64.cc","stdcall"}, 
+  {"func.CheckNameLegalDOS8Dot3A.cc","stdcall"}, 
+  {"func.SymSearchW.cc","stdcall"}, 
+  {"func.GetCursorPos.cc","stdcall"}, 
+  {"func.DeleteProfileA.cc","stdcall"}, 
+  {"func.IStream_Size.cc","stdcall"}, 
+  {"func.SetMenuInfo.cc","stdcall"}, 
+  {"func.ImageList_DrawIndirect.cc","stdcall"}, 
+  {"func.SHQueryRecycleBinA.cc","stdcall"}, 
+  {"func.SetVolumeMountPointW.cc","stdcall"}, 
+  {"func.CreateMailslotW.cc","stdcall"}, 
+  {"type.HRGN.size","32"}, 
+  {"func.CertSaveStore.cc","stdcall"}, 
+  {"func.CryptGetObjectUrl.cc","stdcall"}, 
+  {"func.DisconnectNamedPipe.cc","stdcall"}, 
+  {"func.ldap_parse_resultA.cc","cdecl"}, 
+  {"func.GetDlgItemTextA.cc","stdcall"}, 
+  {"func.PathCreateFromUrlAlloc.cc","stdcall"}, 
+  {"func.GetWindowLongPtrW.cc","stdcall"}, 
+  {"func.EnableScrollBar.cc","stdcall"}, 
+  {"func.ExitWindowsEx.cc","stdcall"}, 
+  {"func.CertRDNValueToStrA.cc","stdcall"}, 
+  {"func.SetThreadStackGuarantee.cc","stdcall"}, 
+  {"func.BuildCommDCBW.cc","stdcall"}, 
+  {"func.StrChrA.cc","stdcall"}, 
+  {"func.WriteFileEx.cc","stdcall"}, 
+  {"func.SHRegSetPathA.cc","stdcall"}, 
+  {"func.CertEnumCTLContextProperties.cc","stdcall"}, 
+  {"func.SetUserObjectInformationA.cc","stdcall"}, 
+  {"func.EnterUmsSchedulingMode.cc","stdcall"}, 
+  {"func.VectorFromBstr.cc","stdcall"}, 
+  {"func.GlobalUnlock.cc","stdcall"}, 
+  {"func.CheckForHiberboot.cc","stdcall"}, 
+  {"func.SetStdHandle.cc","stdcall"}, 
+  {"func.BCryptCreateHash.cc","stdcall"}, 
+  {"func.DeregisterShellHookWindow.cc","stdcall"}, 
+  {"func.SetEvent.cc","stdcall"}, 
+  {"func.LoadImageA.cc","stdcall"}, 
+  {"func.GrayStringW.cc","stdcall"}, 
+  {"func.IsEnclaveTypeSupported.cc","stdcall"}, 
+  {"func.GetLogicalDriveStringsA.cc","stdcall"}, 
+  {"func.VarI4FromUI8.cc","stdcall"}, 
+  {"func.GetThreadDpiAwarenessContext.cc","stdcall"}, 
+  {"func.ldap_count_valuesW.cc","cdecl"}, 
+  {"func.CM_Request_Device_EjectW.cc","stdcall"}, 
+  {"func.SetConsoleScreenBufferSize.cc","stdcall"}, 
+  {"func.ShellMessageBoxA.cc","cdecl"}, 
+  {"func.ChrCmpIW.cc","stdcall"}, 
+  {"type.HSZ.size","32"}, 
+  {"func.ExitProcess.cc","stdcall"}, 
+  {"func.VarUI8FromDate.cc","stdcall"}, 
+  {"func.CoGetCurrentProcess.cc","stdcall"}, 
+  {"func.StrCmpLogicalW.cc","stdcall"}, 
+  {"func.PathGetCharTypeW.cc","stdcall"}, 
+  {"func.VarUI8FromCy.cc","stdcall"}, 
+  {"func.ImageList_DrawEx.cc","stdcall"}, 
+  {"func.VarUI2FromDisp.cc","stdcall"}, 
+  {"func.CertCloseServerOcspResponse.cc","stdcall"}, 
+  {"func.PathSetDlgItemPathA.cc","stdcall"}, 
+  {"func.OpenIcon.cc","stdcall"}, 
+  {"func.QueueUserWorkItem.cc","stdcall"}, 
+  {"func.GetTimestampForLoadedLibrary.cc","stdcall"}, 
+  {"func.StrSpnA.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_Custom_Property_ExA.cc","stdcall"}, 
+  {"func.GetLengthSid.cc","stdcall"}, 
+  {"func.StrStrNIW.cc","stdcall"}, 
+  {"func.GlobalHandle.cc","stdcall"}, 
+  {"func.QueryServiceLockStatusW.cc","stdcall"}, 
+  {"func.SHMessageBoxCheckA.cc","stdcall"}, 
+  {"func.CredProtectA.cc","stdcall"}, 
+  {"func.GlobalUnfix.cc","stdcall"}, 
+  {"func.OutputDebugStringA.cc","stdcall"}, 
+  {"func.CM_Register_Notification.cc","stdcall"}, 
+  {"func.WSAEnumNameSpaceProvidersExA.cc","stdcall"}, 
+  {"func.StackWalk64.cc","stdcall"}, 
+  {"func.GetPropW.cc","stdcall"}, 
+  {"func.WinHttpTimeToSystemTime.cc","stdcall"}, 
+  {"func.CM_Open_Class_Key_ExW.cc","stdcall"}, 
+  {"func.CloseThreadpoolWait.cc","stdcall"}, 
+  {"func.SetHandleCount.cc","stdcall"}, 
+  {"func.CM_Get_Class_PropertyW.cc","stdcall"}, 
+  {"func.FindDebugInfoFileExW.cc","stdcall"}, 
+  {"func.VirtualAlloc.cc","stdcall"}, 
+  {"func.OpenSCManagerW.cc","stdcall"}, 
+  {"func.WSCInstallProvider.cc","stdcall"}, 
+  {"func.SymSrvGetFileIndexString.cc","stdcall"}, 
+  {"func.VarUI2FromBool.cc","stdcall"}, 
+  {"func.FlatSB_GetScrollRange.cc","stdcall"}, 
+  {"func.ldap_extended_operationW.cc","cdecl"}, 
+  {"func.BroadcastSystemMessageExA.cc","stdcall"}, 
+  {"func.FlushConsoleInputBuffer.cc","stdcall"}, 
+  {"func.ResolveLocaleName.cc","stdcall"}, 
+  {"func.GetAltTabInfoA.cc","stdcall"}, 
+  {"func.CredRenameW.cc","stdcall"}, 
+  {"func.RegisterWindowMessageW.cc","stdcall"}, 
+  {"func.NCryptEnumKeys.cc","stdcall"}, 
+  {"func.CharLowerBuffA.cc","stdcall"}, 
+  {"func.PostQuitMessage.cc","stdcall"}, 
+  {"func.CryptHashMessage.cc","stdcall"}, 
+  {"func.GetClassLongW.cc","stdcall"}, 
+  {"func.SetHandleInformation.cc","stdcall"}, 
+  {"func.FindFirstFreeAce.cc","stdcall"}, 
+  {"func.SetPrivateObjectSecurity.cc","stdcall"}, 
+  {"func.RegEnumKeyExW.cc","stdcall"}, 
+  {"func.GetCommModemStatus.cc","stdcall"}, 
+  {"func.FreeAddrInfoExW.cc","stdcall"}, 
+  {"func.OleLoadPicture.cc","stdcall"}, 
+  {"func.CloseHandle.cc","stdcall"}, 
+  {"func.CloseWindow.cc","stdcall"}, 
+  {"func.CertFreeCertificateChainList.cc","stdcall"}, 
+  {"func.PathFindNextComponentA.cc","stdcall"}, 
+  {"func.VerFindFileW.cc","stdcall"}, 
+  {"func.BuildCommDCBAndTimeoutsW.cc","stdcall"}, 
+  {"func.ReleaseDC.cc","stdcall"}, 
+  {"func.SymGetTypeFromName.cc","stdcall"}, 
+  {"func.GetComputerObjectNameW.cc","stdcall"}, 
+  {"func.GetRawInputDeviceList.cc","stdcall"}, 
+  {"func.CertIsWeakHash.cc","stdcall"}, 
+  {"func.EventAccessQuery.cc","stdcall"}, 
+  {"func.ApplicationRecoveryInProgress.cc","stdcall"}, 
+  {"func.LockResource.cc","stdcall"}, 
+  {"func.CloseThreadpoolTimer.cc","stdcall"}, 
+  {"func.GetPropA.cc","stdcall"}, 
+  {"func.SHOpenRegStream2W.cc","stdcall"}, 
+  {"func.WSCInstallNameSpace.cc","stdcall"}, 
+  {"func.ConvertPerformanceCounterToAuxiliaryCounter.cc","stdcall"}, 
+  {"func.SetDefaultDllDirectories.cc","stdcall"}, 
+  {"func.SHGetIDListFromObject.cc","stdcall"}, 
+  {"func.ConvertFiberToThread.cc","stdcall"}, 
+  {"func.PtInRect.cc","stdcall"}, 
+  {"func.WriteConsoleOutputCharacterW.cc","stdcall"}, 
+  {"func.StrCmpNA.cc","stdcall"}, 
+  {"func.ldap_simple_bind_s.cc","cdecl"}, 
+  {"func.OpenTraceA.cc","stdcall"}, 
+  {"func.ldap_extended_operationA.cc","cdecl"}, 
+  {"func.FindAtomW.cc","stdcall"}, 
+  {"func.GetClipCursor.cc","stdcall"}, 
+  {"func.UpdateTraceA.cc","stdcall"}, 
+  {"func.VarI2FromUI8.cc","stdcall"}, 
+  {"func.CoInitializeEx.cc","stdcall"}, 
+  {"func.CryptMsgOpenToEncode.cc","stdcall"}, 
+  {"func.ReleaseCapture.cc","stdcall"}, 
+  {"func.CM_Get_Res_Des_Data_Size.cc","stdcall"}, 
+  {"func.AttachConsole.cc","stdcall"}, 
+  {"func.CoGetDefaultContext.cc","stdcall"}, 
+  {"func.CredUIStoreSSOCredW.cc","stdcall"}, 
+  {"func.CreateCaret.cc","stdcall"}, 
+  {"func.send.cc","stdcall"}, 
+  {"func.ShellAboutA.cc","stdcall"}, 
+  {"func.CryptMsgUpdate.cc","stdcall"}, 
+  {"func.GetNumaProximityNode.cc","stdcall"}, 
+  {"func.BCryptDeriveKey.cc","stdcall"}, 
+  {"func.BackupWrite.cc","stdcall"}, 
+  {"type.HDC.size","32"}, 
+  {"func.RedrawWindow.cc","stdcall"}, 
+  {"func.GetModuleBaseNameW.cc","stdcall"}, 
+  {"func.GetAcceptLanguagesA.cc","stdcall"}, 
+  {"func.AllocateAndInitializeSid.cc","stdcall"}, 
+  {"func.EnableMenuItem.cc","stdcall"}, 
+  {"func.GetWindowModuleFileNameW.cc","stdcall"}, 
+  {"func.GetComputerObjectNameA.cc","stdcall"}, 
+  {"type.HACCEL.size","32"}, 
+  {"func.CM_Unregister_Device_InterfaceA.cc","stdcall"}, 
+  {"func.VarUI8FromDec.cc","stdcall"}, 
+  {"func.EscapeCommFunction.cc","stdcall"}, 
+  {"func.ldap_count_values_len.cc","cdecl"}, 
+  {"func.GetPointerInfo.cc","stdcall"}, 
+  {"func.NCryptStreamUpdate.cc","stdcall"}, 
+  {"func.InitOnceComplete.cc","stdcall"}, 
+  {"func.EventWrite.cc","stdcall"}, 
+  {"func.LdapGetLastError.cc","cdecl"}, 
+  {"type.HMENU.size","32"}, 
+  {"func.SHEnumValueW.cc","stdcall"}, 
+  {"func.VarDecFromI1.cc","stdcall"}, 
+  {"func.GetTitleBarInfo.cc","stdcall"}, 
+  {"func.CertFreeServerOcspResponseContext.cc","stdcall"}, 
+  {"func.SafeArrayGetDim.cc","stdcall"}, 
+  {"func.InSendMessage.cc","stdcall"}, 
+  {"func.ProcessIdToSessionId.cc","stdcall"}, 
+  {"func.OpenTraceW.cc","stdcall"}, 
+  {"func.OpenFileMappingW.cc","stdcall"}, 
+  {"func.VarR4FromUI4.cc","stdcall"}, 
+  {"func.CreateAntiMoniker.cc","stdcall"}, 
+  {"func.GetCurrentActCtx.cc","stdcall"}, 
+  {"func.ControlTraceA.cc","stdcall"}, 
+  {"func.CreateObjrefMoniker.cc","stdcall"}, 
+  {"func.RtlGrowFunctionTable.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_Property_Keys_Ex.cc","stdcall"}, 
+  {"func._hread.cc","stdcall"}, 
+  {"func.ldap_initA.cc","cdecl"}, 
+  {"func.RtlLookupFunctionEntry.cc","stdcall"}, 
+  {"func.IsBadStringPtrA.cc","stdcall"}, 
+  {"func.OpenEncryptedFileRawW.cc","stdcall"}, 
+  {"func.SymMatchFileName.cc","stdcall"}, 
+  {"func.ldap_add_ext.cc","cdecl"}, 
+  {"func.VariantChangeTypeEx.cc","stdcall"}, 
+  {"func.StrStrA.cc","stdcall"}, 
+  {"func.EnumResourceNamesA.cc","stdcall"}, 
+  {"func.CM_Create_DevNode_ExA.cc","stdcall"}, 
+  {"func.PathFindOnPathW.cc","stdcall"}, 
+  {"func.ldap_parse_referenceW.cc","cdecl"}, 
+  {"func.VarDateFromUI1.cc","stdcall"}, 
+  {"func.GetDeviceDriverFileNameW.cc","stdcall"}, 
+  {"func.GlobalAddAtomW.cc","stdcall"}, 
+  {"func.ldap_extended_operation_sW.cc","cdecl"}, 
+  {"func.CloseEncryptedFileRaw.cc","stdcall"}, 
+  {"func.BroadcastSystemMessageA.cc","stdcall"}, 
+  {"func.PowerSetActiveScheme.cc","stdcall"}, 
+  {"func.IUnknown_GetSite.cc","stdcall"}, 
+  {"func.ldap_err2string.cc","cdecl"}, 
+  {"func.RtlCaptureContext.cc","stdcall"}, 
+  {"func.VarUI1FromUI8.cc","stdcall"}, 
+  {"func.OpenEventLogA.cc","stdcall"}, 
+  {"func.CryptProtectData.cc","stdcall"}, 
+  {"func.AccessCheckByTypeResultListAndAuditAlarmW.cc","stdcall"}, 
+  {"func.CoGetStandardMarshal.cc","stdcall"}, 
+  {"func.CreateUpDownControl.cc","stdcall"}, 
+  {"func.GetCurrentDirectoryW.cc","stdcall"}, 
+  {"func.SHEnumValueA.cc","stdcall"}, 
+  {"func.GetProfileStringW.cc","stdcall"}, 
+  {"func.CryptVerifyMessageSignature.cc","stdcall"}, 
+  {"func.RemoveVectoredContinueHandler.cc","stdcall"}, 
+  {"func.GetCommandLineW.cc","stdcall"}, 
+  {"func.SetProcessRestrictionExemption.cc","stdcall"}, 
+  {"func.LocateXStateFeature.cc","stdcall"}, 
+  {"func.PowerCreateRequest.cc","stdcall"}, 
+  {"func.CM_Create_Range_List.cc","stdcall"}, 
+  {"func.CM_Remove_SubTree.cc","stdcall"}, 
+  {"func.IsThreadpoolTimerSet.cc","stdcall"}, 
+  {"func.SymGetSymNext.cc","stdcall"}, 
+  {"func.CM_Add_ID_ExA.cc","stdcall"}, 
+  {"func.SetSearchPathMode.cc","stdcall"}, 
+  {"func.IsProcessCritical.cc","stdcall"}, 
+  {"func.BCryptDestroySecret.cc","stdcall"}, 
+  {"func.CharToOemBuffW.cc","stdcall"}, 
+  {"func.GetPointerType.cc","stdcall"}, 
+  {"func.ldap_msgfree.cc","cdecl"}, 
+  {"func.getprotobynumber.cc","stdcall"}, 
+  {"func.OperationStart.cc","stdcall"}, 
+  {"func.CryptSIPLoad.cc","stdcall"}, 
+  {"func.SetFileIoOverlappedRange.cc","stdcall"}, 
+  {"func.QueryVirtualMemoryInformation.cc","stdcall"}, 
+  {"func.GetUserProfileDirectoryW.cc","stdcall"}, 
+  {"func.SetServiceA.cc","stdcall"}, 
+  {"func.GetOpenClipboardWindow.cc","stdcall"}, 
+  {"func.VarUI2FromStr.cc","stdcall"}, 
+  {"func.SetUserObjectInformationW.cc","stdcall"}, 
+  {"func.CM_Query_And_Remove_SubTree_ExW.cc","stdcall"}, 
+  {"func.GetFileMUIInfo.cc","stdcall"}, 
+  {"func.VarI4FromI8.cc","stdcall"}, 
+  {"func.WSCDeinstallProvider32.cc","stdcall"}, 
+  {"func.CryptExportPKCS8Ex.cc","stdcall"}, 
+  {"func.GetStringTypeW.cc","stdcall"}, 
+  {"func.SymGetSourceFileChecksum.cc","stdcall"}, 
+  {"func.GetCurrentHwProfileA.cc","stdcall"}, 
+  {"func.CM_Unregister_Notification.cc","stdcall"}, 
+  {"func.ldap_err2stringA.cc","cdecl"}, 
+  {"func.CreateFiber.cc","stdcall"}, 
+  {"func.GetFileVersionInfoSizeW.cc","stdcall"}, 
+  {"func.LoadLibraryW.cc","stdcall"}, 
+  {"func.MapDebugInformation.cc","stdcall"}, 
+  {"func.ReadEventLogW.cc","stdcall"}, 
+  {"func.GetScrollBarInfo.cc","stdcall"}, 
+  {"func.VarCyFromDisp.cc","stdcall"}, 
+  {"func.SHGetFileInfoW.cc","stdcall"}, 
+  {"func.GetThreadPreferredUILanguages.cc","stdcall"}, 
+  {"func.GetStartupInfoW.cc","stdcall"}, 
+  {"func.VarUI2FromUI8.cc","stdcall"}, 
+  {"func.RemovePropA.cc","stdcall"}, 
+  {"func.IsTokenRestricted.cc","stdcall"}, 
+  {"func.GetGPOListW.cc","stdcall"}, 
+  {"func.VarDecDiv.cc","stdcall"}, 
+  {"func.VarR8FromDec.cc","stdcall"}, 
+  {"func.CryptSetProviderW.cc","stdcall"}, 
+  {"func.LogonUserExW.cc","stdcall"}, 
+  {"func.EventWriteEx.cc","stdcall"}, 
+  {"func.CM_Set_Device_Interface_Property_ExW.cc","stdcall"}, 
+  {"func.WinHelpW.cc","stdcall"}, 
+  {"func.GlobalLock.cc","stdcall"}, 
+  {"func.WaitCommEvent.cc","stdcall"}, 
+  {"func.LoadIconW.cc","stdcall"}, 
+  {"func.ResumeThread.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_PropertyW.cc","stdcall"}, 
+  {"func.MapViewOfFile3.cc","stdcall"}, 
+  {"func.CreateDesktopW.cc","stdcall"}, 
+  {"func.lstrcmpA.cc","stdcall"}, 
+  {"func.GetProcessImageFileNameA.cc","stdcall"}, 
+  {"func.SetDebugErrorLevel.cc","stdcall"}, 
+  {"func.GetVolumePathNameA.cc","stdcall"}, 
+  {"func.StrCatChainW.cc","stdcall"}, 
+  {"func.SetEnvironmentVariableW.cc","stdcall"}, 
+  {"func.GetThreadDpiHostingBehavior.cc","stdcall"}, 
+  {"func.VarR4FromI8.cc","stdcall"}, 
+  {"func.GetThreadContext.cc","stdcall"}, 
+  {"func.InitiateSystemShutdownW.cc","stdcall"}, 
+  {"func.ber_bvdup.cc","cdecl"}, 
+  {"func.CryptImportPublicKeyInfo.cc","stdcall"}, 
+  {"func.SHMessageBoxCheckW.cc","stdcall"}, 
+  {"func.ldap_modrdn2.cc","cdecl"}, 
+  {"func.ValidateRect.cc","stdcall"}, 
+  {"func.RegRestoreKeyW.cc","stdcall"}, 
+  {"func.RegGetValueW.cc","stdcall"}, 
+  {"func.FindFirstFileNameW.cc","stdcall"}, 
+  {"func.IStream_Write.cc","stdcall"}, 
+  {"func.NCryptIsAlgSupported.cc","stdcall"}, 
+  {"func.WSAAsyncGetServByPort.cc","stdcall"}, 
+  {"func.GetAddrInfoExOverlappedResult.cc","stdcall"}, 
+  {"func.wsprintfW.cc","cdecl"}, 
+  {"func.SetWindowTextA.cc","stdcall"}, 
+  {"func.SetCachedSigningLevel.cc","stdcall"}, 
+  {"func.PaintDesktop.cc","stdcall"}, 
+  {"func.GetCurrentProcessExplicitAppUserModelID.cc","stdcall"}, 
+  {"func.ChangeMenuA.cc","stdcall"}, 
+  {"func.InsertMenuItemA.cc","stdcall"}, 
+  {"func.WSCRemoveQOSTemplate.cc","stdcall"}, 
+  {"func.UnregisterBadMemoryNotification.cc","stdcall"}, 
+  {"func.ldap_rename_extA.cc","cdecl"}, 
+  {"func.SetComputerNameExW.cc","stdcall"}, 
+  {"func.CertAddEncodedCertificateToSystemStoreW.cc","stdcall"}, 
+  {"func.VirtualAlloc2FromApp.cc","stdcall"}, 
+  {"func.VarI2FromCy.cc","stdcall"}, 
+  {"func.BCryptKeyDerivation.cc","stdcall"}, 
+  {"func.GetVolumePathNameW.cc","stdcall"}, 
+  {"func.UnmapViewOfFileEx.cc","stdcall"}, 
+  {"func.BCryptDestroyHash.cc","stdcall"}, 
+  {"func.SetProcessValidCallTargets.cc","stdcall"}, 
+  {"func.BuildCommDCBAndTimeoutsA.cc","stdcall"}, 
+  {"func.RegisterSuspendResumeNotification.cc","stdcall"}, 
+  {"func.GetWindowsDirectoryA.cc","stdcall"}, 
+  {"func.CM_Register_Device_InterfaceA.cc","stdcall"}, 
+  {"func.UpdateResourceA.cc","stdcall"}, 
+  {"func.RegSetValueExA.cc","stdcall"}, 
+  {"func.accept.cc","stdcall"}, 
+  {"func.SHFileOperationW.cc","stdcall"}, 
+  {"func.CryptSetProviderExA.cc","stdcall"}, 
+  {"func.EnumProcessModules.cc","stdcall"}, 
+  {"func.CompareObjectHandles.cc","stdcall"}, 
+  {"func.CreateUmsCompletionList.cc","stdcall"}, 
+  {"func.VarBstrFromUI4.cc","stdcall"}, 
+  {"func.ReadConsoleOutputA.cc","stdcall"}, 
+  {"func.WSCGetProviderPath32.cc","stdcall"}, 
+  {"func.CredIsProtectedW.cc","stdcall"}, 
+  {"func.SHGetThreadRef.cc","stdcall"}, 
+  {"func.StrCSpnIA.cc","stdcall"}, 
+  {"func.ldap_get_values_lenA.cc","cdecl"}, 
+  {"func.GlobalFix.cc","stdcall"}, 
+  {"func.ResetEvent.cc","stdcall"}, 
+  {"func.StgOpenLayoutDocfile.cc","stdcall"}, 
+  {"func.NCryptRegisterProtectionDescriptorName.cc","stdcall"}, 
+  {"func.CM_Run_Detection.cc","stdcall"}, 
+  {"func.PulseEvent.cc","stdcall"}, 
+  {"func.CloseGestureInfoHandle.cc","stdcall"}, 
+  {"func.GetTempPathA.cc","stdcall"}, 
+  {"func.CertFreeCRLContext.cc","stdcall"}, 
+  {"func.PathCchCanonicalizeEx.cc","stdcall"}, 
+  {"func.WPUCloseEvent.cc","stdcall"}, 
+  {"func.ChangeMenuW.cc","stdcall"}, 
+  {"func.SetServiceObjectSecurity.cc","stdcall"}, 
+  {"func.SetThreadDpiHostingBehavior.cc","stdcall"}, 
+  {"func.UnloadUserProfile.cc","stdcall"}, 
+  {"func.CredUICmdLinePromptForCredentialsA.cc","stdcall"}, 
+  {"func.IsValidDpiAwarenessContext.cc","stdcall"}, 
+  {"func.UpdateProcThreadAttribute.cc","stdcall"}, 
+  {"func.VarR8FromR4.cc","stdcall"}, 
+  {"func.SetProcessDpiAwareness.cc","stdcall"}, 
+  {"func.SleepEx.cc","stdcall"}, 
+  {"func.PathIsUNCServerShareW.cc","stdcall"}, 
+  {"func.CertGetNameStringW.cc","stdcall"}, 
+  {"func.UnRegisterTypeLib.cc","stdcall"}, 
+  {"func.SetDefaultCommConfigW.cc","stdcall"}, 
+  {"func.CredMarshalCredentialW.cc","stdcall"}, 
+  {"func.PathAllocCombine.cc","stdcall"}, 
+  {"func.AllocateUserPhysicalPages.cc","stdcall"}, 
+  {"func.CM_Get_Device_ID_ExA.cc","stdcall"}, 
+  {"func.GetMenuItemInfoW.cc","stdcall"}, 
+  {"func.AddAccessDeniedObjectAce.cc","stdcall"}, 
+  {"func.SetMenuItemInfoA.cc","stdcall"}, 
+  {"func.TraceQueryInformation.cc","stdcall"}, 
+  {"func.EnumChildWindows.cc","stdcall"}, 
+  {"func.GetHandleInformation.cc","stdcall"}, 
+  {"func.GetUpdatedClipboardFormats.cc","stdcall"}, 
+  {"func.SendNotifyMessageW.cc","stdcall"}, 
+  {"func.SymEnumLinesW.cc","stdcall"}, 
+  {"func.K32GetMappedFileNameW.cc","stdcall"}, 
+  {"func.MoveFileExW.cc","stdcall"}, 
+  {"func.ldap_bind.cc","cdecl"}, 
+  {"type.HPEN.size","32"}, 
+  {"func.HeapCompact.cc","stdcall"}, 
+  {"func.WSAAsyncGetServByName.cc","stdcall"}, 
+  {"func.PathCchAppendEx.cc","stdcall"}, 
+  {"func.CharLowerW.cc","stdcall"}, 
+  {"func.ConvertAuxiliaryCounterToPerformanceCounter.cc","stdcall"}, 
+  {"func.CoGetCancelObject.cc","stdcall"}, 
+  {"func.GetDateFormatW.cc","stdcall"}, 
+  {"func.VarDecFromDisp.cc","stdcall"}, 
+  {"func.CryptEncodeObject.cc","stdcall"}, 
+  {"func.CreateJobObjectA.cc","stdcall"}, 
+  {"func.WSCInstallNameSpaceEx32.cc","stdcall"}, 
+  {"func.WSADeleteSocketPeerTargetName.cc","stdcall"}, 
+  {"func.TerminateJobObject.cc","stdcall"}, 
+  {"func.BCryptDestroyKey.cc","stdcall"}, 
+  {"func.ber_scanf.cc","cdecl"}, 
+  {"func.VariantChangeType.cc","stdcall"}, 
+  {"func.GetFileVersionInfoSizeExA.cc","stdcall"}, 
+  {"func.VarUI4FromI4.cc","stdcall"}, 
+  {"func.CryptVerifyCertificateSignature.cc","stdcall"}, 
+  {"func.GlobalAddAtomA.cc","stdcall"}, 
+  {"func.EnumUILanguagesA.cc","stdcall"}, 
+  {"func.WSAGetServiceClassNameByClassIdW.cc","stdcall"}, 
+  {"func.VarFix.cc","stdcall"}, 
+  {"func.CharToOemA.cc","stdcall"}, 
+  {"func.MiniDumpWriteDump.cc","stdcall"}, 
+  {"func.VarBstrFromI1.cc","stdcall"}, 
+  {"func.__WSAFDIsSet.cc","stdcall"}, 
+  {"func.ldap_next_attributeA.cc","cdecl"}, 
+  {"func.SetThreadpoolTimer.cc","stdcall"}, 
+  {"func.FlushTraceA.cc","stdcall"}, 
+  {"func.SetProcessWorkingSetSizeEx.cc","stdcall"}, 
+  {"func.CryptUninstallDefaultContext.cc","stdcall"}, 
+  {"func.DeriveAppContainerSidFromAppContainerName.cc","stdcall"}, 
+  {"func.SymCleanup.cc","stdcall"}, 
+  {"func.TaskDialogIndirect.cc","stdcall"}, 
+  {"func.VarUI2FromI4.cc","stdcall"}, 
+  {"func.VarI8FromUI1.cc","stdcall"}, 
+  {"func.VarBoolFromR4.cc","stdcall"}, 
+  {"type.HBITMAP.size","32"}, 
+  {"func.WakeConditionVariable.cc","stdcall"}, 
+  {"func.CryptGetMessageCertificates.cc","stdcall"}, 
+  {"func.GetMenuCheckMarkDimensions.cc","stdcall"}, 
+  {"func.GetSidLengthRequired.cc","stdcall"}, 
+  {"func.CertSetCertificateContextProperty.cc","stdcall"}, 
+  {"func.CreateMenu.cc","stdcall"}, 
+  {"func.EnumSystemCodePagesA.cc","stdcall"}, 
+  {"func.ldap_bindW.cc","cdecl"}, 
+  {"func.ldap_get_optionW.cc","cdecl"}, 
+  {"func.inet_pton.cc","stdcall"}, 
+  {"func.TileWindows.cc","stdcall"}, 
+  {"func.CryptVerifyDetachedMessageSignature.cc","stdcall"}, 
+  {"func.NCryptCreatePersistedKey.cc","stdcall"}, 
+  {"func.CryptEnumProvidersA.cc","stdcall"}, 
+  {"func.MoveFileExA.cc","stdcall"}, 
+  {"func.CreateProcessWithTokenW.cc","stdcall"}, 
+  {"func.LockServiceDatabase.cc","stdcall"}, 
+  {"func.WSACancelAsyncRequest.cc","stdcall"}, 
+  {"func.GlobalSize.cc","stdcall"}, 
+  {"func.StrFormatByteSizeW.cc","stdcall"}, 
+  {"func.PathCommonPrefixA.cc","stdcall"}, 
+  {"func.IsValidLanguageGroup.cc","stdcall"}, 
+  {"func.DestroyCaret.cc","stdcall"}, 
+  {"func.RegCreateKeyTransactedA.cc","stdcall"}, 
+  {"func.GetAsyncKeyState.cc","stdcall"}, 
+  {"func.VarAdd.cc","stdcall"}, 
+  {"func.GetAclInformation.cc","stdcall"}, 
+  {"func.SymFindExecutableImage.cc","stdcall"}, 
+  {"func.ldap_compare_ext.cc","cdecl"}, 
+  {"func.SetThreadDpiAwarenessContext.cc","stdcall"}, 
+  {"func.WritePrivateProfileSectionA.cc","stdcall"}, 
+  {"func.LocalReAlloc.cc","stdcall"}, 
+  {"func.WriteConsoleInputA.cc","stdcall"}, 
+  {"func.CM_Query_Arbitrator_Free_Size.cc","stdcall"}, 
+  {"func.StrCSpnW.cc","stdcall"}, 
+  {"func.FileTimeToLocalFileTime.cc","stdcall"}, 
+  {"func.SetProcessAffinityUpdateMode.cc","stdcall"}, 
+  {"func.VarDateFromUdateEx.cc","stdcall"}, 
+  {"func.ldap_simple_bind.cc","cdecl"}, 
+  {"func.BCryptEnumProviders.cc","stdcall"}, 
+  {"func.setsockopt.cc","stdcall"}, 
+  {"func.GetFileVersionInfoSizeExW.cc","stdcall"}, 
+  {"func.GetActiveWindow.cc","stdcall"}, 
+  {"func.CertGetCertificateContextProperty.cc","stdcall"}, 
+  {"func.SetFirmwareEnvironmentVariableW.cc","stdcall"}, 
+  {"func.ConnectNamedPipe.cc","stdcall"}, 
+  {"func.GlobalFlags.cc","stdcall"}, 
+  {"func.CoAllowSetForegroundWindow.cc","stdcall"}, 
+  {"func.VarCyFromI4.cc","stdcall"}, 
+  {"func.CertDuplicateCRLContext.cc","stdcall"}, 
+  {"func.SymLoadModuleExW.cc","stdcall"}, 
+  {"func.CertGetCertificateChain.cc","stdcall"}, 
+  {"func.AdjustTokenGroups.cc","stdcall"}, 
+  {"func.GetPrivateProfileSectionNamesA.cc","stdcall"}, 
+  {"func.WSAResetEvent.cc","stdcall"}, 
+  {"func.CM_Query_Arbitrator_Free_Size_Ex.cc","stdcall"}, 
+  {"func.RegisterPointerInputTargetEx.cc","stdcall"}, 
+  {"func.NCryptVerifyClaim.cc","stdcall"}, 
+  {"func.GetCurrentHwProfileW.cc","stdcall"}, 
+  {"func.SetThreadpoolWaitEx.cc","stdcall"}, 
+  {"func.CoUnmarshalInterface.cc","stdcall"}, 
+  {"func.RegCopyTreeW.cc","stdcall"}, 
+  {"func.WaitServiceState.cc","stdcall"}, 
+  {"func.WSAConnectByList.cc","stdcall"}, 
+  {"func.GetStartupInfoA.cc","stdcall"}, 
+  {"func.ldap_extended_operation.cc","cdecl"}, 
+  {"func.CM_Set_Class_PropertyW.cc","stdcall"}, 
+  {"func.ldap_delete_ext.cc","cdecl"}, 
+  {"func.SymGetExtendedOption.cc","stdcall"}, 
+  {"func.WPUCreateSocketHandle.cc","stdcall"}, 
+  {"func.WriteConsoleInputW.cc","stdcall"}, 
+  {"func.QueryDepthSList.cc","stdcall"}, 
+  {"func.MapVirtualKeyExW.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_List_Size_ExW.cc","stdcall"}, 
+  {"func.CM_Get_Class_Name_ExW.cc","stdcall"}, 
+  {"func.GetProfileSectionW.cc","stdcall"}, 
+  {"func.ldap_modify_ext_sW.cc","cdecl"}, 
+  {"func.CreateClassMoniker.cc","stdcall"}, 
+  {"type.HCONVLIST.size","32"}, 
+  {"func.DialogBoxParamA.cc","stdcall"}, 
+  {"func.VarR4FromDate.cc","stdcall"}, 
+  {"func.IsThreadAFiber.cc","stdcall"}, 
+  {"func.cldap_openA.cc","cdecl"}, 
+  {"func.CM_Get_First_Log_Conf_Ex.cc","stdcall"}, 
+  {"func.GetScaleFactorForMonitor.cc","stdcall"}, 
+  {"func.GetRecordInfoFromTypeInfo.cc","stdcall"}, 
+  {"func.StrPBrkW.cc","stdcall"}, 
+  {"func.PathIsSameRootA.cc","stdcall"}, 
+  {"func.CoCreateFreeThreadedMarshaler.cc","stdcall"}, 
+  {"func.CM_Get_Class_NameA.cc","stdcall"}, 
+  {"func.ldap_search_stW.cc","cdecl"}, 
+  {"func.ldap_get_dn.cc","cdecl"}, 
+  {"func.GetNameByTypeA.cc","stdcall"}, 
+  {"func.CoFreeAllLibraries.cc","stdcall"}, 
+  {"func.CoRevokeInitializeSpy.cc","stdcall"}, 
+  {"func.CM_Disable_DevNode.cc","stdcall"}, 
+  {"func.CM_Enumerate_Classes.cc","stdcall"}, 
+  {"func.MapViewOfFileFromApp.cc","stdcall"}, 
+  {"func.UrlCanonicalizeW.cc","stdcall"}, 
+  {"func.DeleteFileTransactedA.cc","stdcall"}, 
+  {"func.EnumResourceTypesExW.cc","stdcall"}, 
+  {"func.VirtualFreeEx.cc","stdcall"}, 
+  {"func.SymUnDName.cc","stdcall"}, 
+  {"func.WSCInstallProviderAndChains.cc","stdcall"}, 
+  {"func.VarDateFromBool.cc","stdcall"}, 
+  {"func.IsOS.cc","stdcall"}, 
+  {"func.GetSystemWindowsDirectoryA.cc","stdcall"}, 
+  {"func.ExecuteUmsThread.cc","stdcall"}, 
+  {"func.VarCyMul.cc","stdcall"}, 
+  {"func.CancelDeviceWakeupRequest.cc","stdcall"}, 
+  {"func.CM_Test_Range_Available.cc","stdcall"}, 
+  {"func.CertEnumPhysicalStore.cc","stdcall"}, 
+  {"func.GetNumaProcessorNode.cc","stdcall"}, 
+  {"func.CM_Unregister_Device_Interface_ExA.cc","stdcall"}, 
+  {"func.ldap_modrdn2A.cc","cdecl"}, 
+  {"func.GetWriteWatch.cc","stdcall"}, 
+  {"func.GetRawInputDeviceInfoW.cc","stdcall"}, 
+  {"func.CM_First_Range.cc","stdcall"}, 
+  {"func.CreateDirectoryA.cc","stdcall"}, 
+  {"func.K32EnumProcessModules.cc","stdcall"}, 
+  {"func.DllGetClassObject.cc","stdcall"}, 
+  {"func.ldap_explode_dnW.cc","cdecl"}, 
+  {"func.SymGetLineFromName.cc","stdcall"}, 
+  {"func.CreateThreadpoolCleanupGroup.cc","stdcall"}, 
+  {"func.SymGetSourceFileChecksumW.cc","stdcall"}, 
+  {"func.CM_Is_Dock_Station_Present.cc","stdcall"}, 
+  {"func.SymGetLineNext.cc","stdcall"}, 
+  {"func.GetPrivateProfileStructA.cc","stdcall"}, 
+  {"func.GetUpdateRect.cc","stdcall"}, 
+  {"func.SHCreateThread.cc","stdcall"}, 
+  {"func.CreateTapePartition.cc","stdcall"}, 
+  {"func.CryptExportPKCS8.cc","stdcall"}, 
+  {"func.IsProcessInJob.cc","stdcall"}, 
+  {"func.CheckMenuRadioItem.cc","stdcall"}, 
+  {"func.GetProfileIntA.cc","stdcall"}, 
+  {"func.GetDiskFreeSpaceExA.cc","stdcall"}, 
+  {"func.StrRChrIW.cc","stdcall"}, 
+  {"func.CoCreateInstanceFromApp.cc","stdcall"}, 
+  {"func.ldap_add_ext_s.cc","cdecl"}, 
+  {"func.PathMatchSpecExW.cc","stdcall"}, 
+  {"func.CoGetCallerTID.cc","stdcall"}, 
+  {"func.ObjectPrivilegeAuditAlarmW.cc","stdcall"}, 
+  {"func.NCryptDecrypt.cc","stdcall"}, 
+  {"func.CheckTokenMembership.cc","stdcall"}, 
+  {"func.VarDateFromI1.cc","stdcall"}, 
+  {"func.CryptCancelAsyncRetrieval.cc","stdcall"}, 
+  {"func.CM_Get_Device_ID_List_SizeA.cc","stdcall"}, 
+  {"func.Compress.cc","stdcall"}, 
+  {"func.StrRetToBufA.cc","stdcall"}, 
+  {"func.IsWellKnownSid.cc","stdcall"}, 
+  {"func.VarR8FromCy.cc","stdcall"}, 
+  {"func.RegRenameKey.cc","stdcall"}, 
+  {"func.CM_Open_DevNode_Key.cc","stdcall"}, 
+  {"func.CM_Unregister_Device_Interface_ExW.cc","stdcall"}, 
+  {"func.VkKeyScanA.cc","stdcall"}, 
+  {"func.CM_Detect_Resource_Conflict_Ex.cc","stdcall"}, 
+  {"func.HeapUnlock.cc","stdcall"}, 
+  {"func.ldap_create_page_control.cc","cdecl"}, 
+  {"func.ActivateKeyboardLayout.cc","stdcall"}, 
+  {"func.CryptBinaryToStringW.cc","stdcall"}, 
+  {"func.PathParseIconLocationW.cc","stdcall"}, 
+  {"func.CM_Get_Next_Log_Conf_Ex.cc","stdcall"}, 
+  {"func.DrawIcon.cc","stdcall"}, 
+  {"func.ScreenToClient.cc","stdcall"}, 
+  {"func.FlushViewOfFile.cc","stdcall"}, 
+  {"func.SetTimeZoneInformation.cc","stdcall"}, 
+  {"func.GetClassFile.cc","stdcall"}, 
+  {"func.gethostbyname.cc","stdcall"}, 
+  {"func.SymEnumerateSymbolsW.cc","stdcall"}, 
+  {"func.FindDebugInfoFile.cc","stdcall"}, 
+  {"func.OaEnablePerUserTLibRegistration.cc","stdcall"}, 
+  {"func.TzSpecificLocalTimeToSystemTime.cc","stdcall"}, 
+  {"func.RegSaveKeyW.cc","stdcall"}, 
+  {"func.ProcessGroupPolicyCompletedEx.cc","stdcall"}, 
+  {"func.BackupEventLogA.cc","stdcall"}, 
+  {"func.CryptDestroyKey.cc","stdcall"}, 
+  {"func.StringFromGUID2.cc","stdcall"}, 
+  {"func.SetMenuItemInfoW.cc","stdcall"}, 
+  {"func.QueryServiceStatusEx.cc","stdcall"}, 
+  {"func.NCryptSignHash.cc","stdcall"}, 
+  {"func.GetSystemMenu.cc","stdcall"}, 
+  {"func.CoRegisterInitializeSpy.cc","stdcall"}, 
+  {"func.CertDuplicateCertificateChain.cc","stdcall"}, 
+  {"func.GetClipboardViewer.cc","stdcall"}, 
+  {"func.FreeMemoryJobObject.cc","stdcall"}, 
+  {"func.CreateDialogParamA.cc","stdcall"}, 
+  {"func.SendNotifyMessageA.cc","stdcall"}, 
+  {"func.FormatMessageA.cc","stdcall"}, 
+  {"func.VarUI1FromCy.cc","stdcall"}, 
+  {"func.LocalHandle.cc","stdcall"}, 
+  {"func.PeekConsoleInputA.cc","stdcall"}, 
+  {"func.CM_Get_Device_ID_List_SizeW.cc","stdcall"}, 
+  {"func.CoGetCurrentLogicalThreadId.cc","stdcall"}, 
+  {"func.PathFileExistsW.cc","stdcall"}, 
+  {"type.HANDLE.size","32"}, 
+  {"func.StrRetToBufW.cc","stdcall"}, 
+  {"func.SymSrvStoreFile.cc","stdcall"}, 
+  {"func.SymSrvStoreSupplementW.cc","stdcall"}, 
+  {"func.VarCat.cc","stdcall"}, 
+  {"func.ObjectCloseAuditAlarmW.cc","stdcall"}, 
+  {"func.AddAtomA.cc","stdcall"}, 
+  {"func.PathCchAddExtension.cc","stdcall"}, 
+  {"func.UnregisterGPNotification.cc","stdcall"}, 
+  {"func.VkKeyScanW.cc","stdcall"}, 
+  {"func.GetCommState.cc","stdcall"}, 
+  {"func.SymEnumSourceLines.cc","stdcall"}, 
+  {"func.TerminateProcess.cc","stdcall"}, 
+  {"func.CopySid.cc","stdcall"}, 
+  {"func.SHRegCreateUSKeyW.cc","stdcall"}, 
+  {"func.EndMenu.cc","stdcall"}, 
+  {"func.HeapFree.cc","stdcall"}, 
+  {"func.InitializeSListHead.cc","stdcall"}, 
+  {"func.CryptSIPRemoveProvider.cc","stdcall"}, 
+  {"func.ldap_next_attributeW.cc","cdecl"}, 
+  {"func.RegSaveKeyExW.cc","stdcall"}, 
+  {"func.WSAGetServiceClassInfoW.cc","stdcall"}, 
+  {"func.AddClipboardFormatListener.cc","stdcall"}, 
+  {"func.InitializeCriticalSection.cc","stdcall"}, 
+  {"func.InitializeSecurityDescriptor.cc","stdcall"}, 
+  {"func.GetPhysicalCursorPos.cc","stdcall"}, 
+  {"func.MakeSureDirectoryPathExists.cc","stdcall"}, 
+  {"func.GetFileAttributesTransactedA.cc","stdcall"}, 
+  {"func.GetModuleFileNameExA.cc","stdcall"}, 
+  {"func.PowerClearRequest.cc","stdcall"}, 
+  {"func.LoadTypeLibEx.cc","stdcall"}, 
+  {"func.CreateIconFromResource.cc","stdcall"}, 
+  {"func.PathFileExistsA.cc","stdcall"}, 
+  {"func.CryptRetrieveObjectByUrlW.cc","stdcall"}, 
+  {"func.HeapQueryInformation.cc","stdcall"}, 
+  {"func.SHAppBarMessage.cc","stdcall"}, 
+  {"func.GetWindow.cc","stdcall"}, 
+  {"func.MoveFileTransactedA.cc","stdcall"}, 
+  {"func.VarI1FromUI8.cc","stdcall"}, 
+  {"func.CertNameToStrA.cc","stdcall"}, 
+  {"func.SetComputerNameW.cc","stdcall"}, 
+  {"func.WSCInstallNameSpaceEx.cc","stdcall"}, 
+  {"func.IntersectRect.cc","stdcall"}, 
+  {"func.RegConnectRegistryW.cc","stdcall"}, 
+  {"func.PathFindFileNameA.cc","stdcall"}, 
+  {"func.WindowFromPoint.cc","stdcall"}, 
+  {"func.DeactivateActCtx.cc","stdcall"}, 
+  {"func.WSCUnInstallNameSpace.cc","stdcall"}, 
+  {"func.SHCreateItemFromRelativeName.cc","stdcall"}, 
+  {"func.GetLargePageMinimum.cc","stdcall"}, 
+  {"func.GetKeyNameTextW.cc","stdcall"}, 
+  {"func.CM_Add_Empty_Log_Conf.cc","stdcall"}, 
+  {"func.GetDpiForSystem.cc","stdcall"}, 
+  {"func.GetSystemPreferredUILanguages.cc","stdcall"}, 
+  {"func.GetMenuItemCount.cc","stdcall"}, 
+  {"func.ImageList_Draw.cc","stdcall"}, 
+  {"func.VarCyCmp.cc","stdcall"}, 
+  {"func.WinHttpAddRequestHeaders.cc","stdcall"}, 
+  {"func.WinExec.cc","stdcall"}, 
+  {"func.QueryServiceLockStatusA.cc","stdcall"}, 
+  {"func.WSAGetQOSByName.cc","stdcall"}, 
+  {"func.CM_Get_Child.cc","stdcall"}, 
+  {"func.CopyFileW.cc","stdcall"}, 
+  {"func.WSARevertImpersonation.cc","stdcall"}, 
+  {"func.CM_Get_Hardware_Profile_Info_ExW.cc","stdcall"}, 
+  {"func.VarFormat.cc","stdcall"}, 
+  {"func.VarDecCmp.cc","stdcall"}, 
+  {"func.FindNextStreamW.cc","stdcall"}, 
+  {"func.lstrcmpiW.cc","stdcall"}, 
+  {"func.SHRemoveLocalizedName.cc","stdcall"}, 
+  {"func.WSADuplicateSocketA.cc","stdcall"}, 
+  {"func.SymGetSymFromAddr.cc","stdcall"}, 
+  {"func.SetSystemPowerState.cc","stdcall"}, 
+  {"func.EqualDomainSid.cc","stdcall"}, 
+  {"func.NCryptGetProperty.cc","stdcall"}, 
+  {"func.CryptSetKeyParam.cc","stdcall"}, 
+  {"func.PowerReadACValue.cc","stdcall"}, 
+  {"func.EnumCalendarInfoExA.cc","stdcall"}, 
+  {"func.SetComputerNameA.cc","stdcall"}, 
+  {"func.SHRegEnumUSKeyW.cc","stdcall"}, 
+  {"func.shutdown.cc","stdcall"}, 
+  {"func.GetProfileSectionA.cc","stdcall"}, 
+  {"func.UrlUnescapeA.cc","stdcall"}, 
+  {"func.FindNextChangeNotification.cc","stdcall"}, 
+  {"func.ioctlsocket.cc","stdcall"}, 
+  {"func.NCryptFreeBuffer.cc","stdcall"}, 
+  {"func.WinHttpTimeFromSystemTime.cc","stdcall"}, 
+  {"func.SetCapture.cc","stdcall"}, 
+  {"func.CoCancelCall.cc","stdcall"}, 
+  {"func.LocalLock.cc","stdcall"}, 
+  {"func.GetSecurityDescriptorOwner.cc","stdcall"}, 
+  {"func.VirtualProtectFromApp.cc","stdcall"}, 
+  {"func.CredUIConfirmCredentialsA.cc","stdcall"}, 
+  {"func.CreateMDIWindowW.cc","stdcall"}, 
+  {"func.ldap_simple_bind_sW.cc","cdecl"}, 
+  {"func.CoInitializeSecurity.cc","stdcall"}, 
+  {"func.PathIsUNCA.cc","stdcall"}, 
+  {"func.ldap_controls_freeW.cc","cdecl"}, 
+  {"func.GetLocaleInfoW.cc","stdcall"}, 
+  {"func.PathIsSameRootW.cc","stdcall"}, 
+  {"func.CryptGenRandom.cc","stdcall"}, 
+  {"func.CoTaskMemRealloc.cc","stdcall"}, 
+  {"func.ldap_rename_ext_sW.cc","cdecl"}, 
+  {"func.GetNumberFormatW.cc","stdcall"}, 
+  {"func.CopyFileA.cc","stdcall"}, 
+  {"func.CertGetValidUsages.cc","stdcall"}, 
+  {"func.GetDisplayAutoRotationPreferences.cc","stdcall"}, 
+  {"func.CertRemoveEnhancedKeyUsageIdentifier.cc","stdcall"}, 
+  {"func.GetFileMUIPath.cc","stdcall"}, 
+  {"func.FlatSB_GetScrollProp.cc","stdcall"}, 
+  {"func.AccessCheckByType.cc","stdcall"}, 
+  {"func.UnhookWindowsHookEx.cc","stdcall"}, 
+  {"func.WinHttpOpen.cc","stdcall"}, 
+  {"func.GetSidSubAuthority.cc","stdcall"}, 
+  {"func.AddAccessAllowedObjectAce.cc","stdcall"}, 
+  {"func.CheckMenuItem.cc","stdcall"}, 
+  {"func.ntohll.cc","stdcall"}, 
+  {"func.OemKeyScan.cc","stdcall"}, 
+  {"func.IsTokenUntrusted.cc","stdcall"}, 
+  {"func.DoEnvironmentSubstW.cc","stdcall"}, 
+  {"func.SetTraceCallback.cc","stdcall"}, 
+  {"func.CM_Delete_Device_Interface_KeyW.cc","stdcall"}, 
+  {"func.CM_Set_HW_Prof_Flags_ExW.cc","stdcall"}, 
+  {"func.BCryptDeriveKeyPBKDF2.cc","stdcall"}, 
+  {"func.ldap_modrdn2W.cc","cdecl"}, 
+  {"func.LookupPrivilegeNameA.cc","stdcall"}, 
+  {"func.LoadMenuW.cc","stdcall"}, 
+  {"func.RealGetWindowClassW.cc","stdcall"}, 
+  {"func.ldap_explode_dnA.cc","cdecl"}, 
+  {"func.CM_Detect_Resource_Conflict.cc","stdcall"}, 
+  {"func.CM_Is_Version_Available_Ex.cc","stdcall"}, 
+  {"func.ldap_modify_sA.cc","cdecl"}, 
+  {"func.CryptMsgClose.cc","stdcall"}, 
+  {"func.PathFindSuffixArrayW.cc","stdcall"}, 
+  {"func.RtlCaptureStackBackTrace.cc","stdcall"}, 
+  {"func.SHRegSetUSValueW.cc","stdcall"}, 
+  {"func.CoInstall.cc","stdcall"}, 
+  {"func.GetWindowModuleFileNameA.cc","stdcall"}, 
+  {"func.GetServiceKeyNameW.cc","stdcall"}, 
+  {"func.SetThreadpoolTimerEx.cc","stdcall"}, 
+  {"func.WritePrivateProfileStructW.cc","stdcall"}, 
+  {"func.CryptSIPRetrieveSubjectGuidForCatalogFile.cc","stdcall"}, 
+  {"func.CM_Unregister_Device_InterfaceW.cc","stdcall"}, 
+  {"func.SetWindowPlacement.cc","stdcall"}, 
+  {"func.ldap_set_dbg_flags.cc","cdecl"}, 
+  {"func.CoUnmarshalHresult.cc","stdcall"}, 
+  {"func.CertGetIssuerCertificateFromStore.cc","stdcall"}, 
+  {"func.SetProcessReference.cc","stdcall"}, 
+  {"func.ToUnicodeEx.cc","stdcall"}, 
+  {"func.AccessCheckByTypeResultListAndAuditAlarmByHandleW.cc","stdcall"}, 
+  {"func.ObjectPrivilegeAuditAlarmA.cc","stdcall"}, 
+  {"func.PathCchStripPrefix.cc","stdcall"}, 
+  {"func.DestroyMenu.cc","stdcall"}, 
+  {"func.PowerRegisterForEffectivePowerModeNotifications.cc","stdcall"}, 
+  {"func.ShowWindowAsync.cc","stdcall"}, 
+  {"func.SHQueryUserNotificationState.cc","stdcall"}, 
+  {"func.GetPrivateObjectSecurity.cc","stdcall"}, 
+  {"func.RegisterActiveObject.cc","stdcall"}, 
+  {"func.CoFreeUnusedLibraries.cc","stdcall"}, 
+  {"func.InsertMenuW.cc","stdcall"}, 
+  {"func.QueueUserAPC.cc","stdcall"}, 
+  {"func.CM_Create_DevNodeW.cc","stdcall"}, 
+  {"func.VarI4FromStr.cc","stdcall"}, 
+  {"func.IsBadStringPtrW.cc","stdcall"}, 
+  {"func.FlsGetValue.cc","stdcall"}, 
+  {"func.SetWindowLongA.cc","stdcall"}, 
+  {"func.VarI1FromDate.cc","stdcall"}, 
+  {"func.NCryptSecretAgreement.cc","stdcall"}, 
+  {"func.CreateWellKnownSid.cc","stdcall"}, 
+  {"func.WSASendDisconnect.cc","stdcall"}, 
+  {"func.ldap_result2error.cc","cdecl"}, 
+  {"func.PhysicalToLogicalPoint.cc","stdcall"}, 
+  {"func.SymGetSymPrev64.cc","stdcall"}, 
+  {"func.CM_Get_Class_Key_NameA.cc","stdcall"}, 
+  {"func.SymEnumTypesByName.cc","stdcall"}, 
+  {"func.CopyFileExA.cc","stdcall"}, 
+  {"func.LoadBitmapW.cc","stdcall"}, 
+  {"func.VarEqv.cc","stdcall"}, 
+  {"func.OpenProcess.cc","stdcall"}, 
+  {"func.GetNamedPipeHandleStateA.cc","stdcall"}, 
+  {"func.StrFormatKBSizeA.cc","stdcall"}, 
+  {"func.TranslateNameA.cc","stdcall"}, 
+  {"func.EnableTraceEx2.cc","stdcall"}, 
+  {"func.GetClassInfoExW.cc","stdcall"}, 
+  {"func.bind.cc","stdcall"}, 
+  {"func.MoveFileA.cc","stdcall"}, 
+  {"func.AddMandatoryAce.cc","stdcall"}, 
+  {"func.TlsFree.cc","stdcall"}, 
+  {"func.SearchTreeForFileW.cc","stdcall"}, 
+  {"func.CreateDialogParamW.cc","stdcall"}, 
+  {"func.OleCreatePropertyFrame.cc","stdcall"}, 
+  {"func.RegDeleteKeyValueA.cc","stdcall"}, 
+  {"func.CredWriteA.cc","stdcall"}, 
+  {"func.SetWindowRgn.cc","stdcall"}, 
+  {"func.CryptHashData.cc","stdcall"}, 
+  {"func.SetThreadToken.cc","stdcall"}, 
+  {"func.ldap_modrdn.cc","cdecl"}, 
+  {"func.GetSecurityDescriptorSacl.cc","stdcall"}, 
+  {"func.DrawFrameControl.cc","stdcall"}, 
+  {"func.ObjectCloseAuditAlarmA.cc","stdcall"}, 
+  {"func.TranslateAcceleratorA.cc","stdcall"}, 
+  {"func.CryptMsgEncodeAndSignCTL.cc","stdcall"}, 
+  {"func.CertVerifyRevocation.cc","stdcall"}, 
+  {"func.GetClipboardSequenceNumber.cc","stdcall"}, 
+  {"func.CryptVerifySignatureA.cc","stdcall"}, 
+  {"func.CryptDecryptMessage.cc","stdcall"}, 
+  {"func.CoRevertToSelf.cc","stdcall"}, 
+  {"func.GetLongPathNameTransactedA.cc","stdcall"}, 
+  {"func.StrTrimA.cc","stdcall"}, 
+  {"func.GetCaretBlinkTime.cc","stdcall"}, 
+  {"func.AddAce.cc","stdcall"}, 
+  {"func.SetServiceW.cc","stdcall"}, 
+  {"func.NotifyWinEvent.cc","stdcall"}, 
+  {"func.SetFileAttributesW.cc","stdcall"}, 
+  {"func.WSAInstallServiceClassW.cc","stdcall"}, 
+  {"func.SetDecompressorInformation.cc","stdcall"}, 
+  {"func.RegSetKeyValueW.cc","stdcall"}, 
+  {"func.FindFirstVolumeMountPointA.cc","stdcall"}, 
+  {"func.GetClassInfoExA.cc","stdcall"}, 
+  {"func.CoCreateStandardMalloc.cc","stdcall"}, 
+  {"func.StrStrIW.cc","stdcall"}, 
+  {"func.GetSystemTimeAdjustment.cc","stdcall"}, 
+  {"func.CM_Delete_Device_Interface_Key_ExA.cc","stdcall"}, 
+  {"func.SetThreadIdealProcessorEx.cc","stdcall"}, 
+  {"func.GetFileVersionInfoSizeA.cc","stdcall"}, 
+  {"func.SymMatchString.cc","stdcall"}, 
+  {"func.PrintWindow.cc","stdcall"}, 
+  {"func.RegDeleteKeyValueW.cc","stdcall"}, 
+  {"func.RegisterServiceCtrlHandlerExW.cc","stdcall"}, 
+  {"func.CryptEnumProviderTypesW.cc","stdcall"}, 
+  {"func.CryptMsgDuplicate.cc","stdcall"}, 
+  {"func.SetThreadInformation.cc","stdcall"}, 
+  {"func.AdjustWindowRectExForDpi.cc","stdcall"}, 
+  {"func.UnhookWindowsHook.cc","stdcall"}, 
+  {"func.GetConsoleOriginalTitleA.cc","stdcall"}, 
+  {"func.GetDefaultUserProfileDirectoryW.cc","stdcall"}, 
+  {"func.ldap_modrdn2_sA.cc","cdecl"}, 
+  {"func.CreateMailslotA.cc","stdcall"}, 
+  {"func.LogonUserExA.cc","stdcall"}, 
+  {"func.LCMapStringW.cc","stdcall"}, 
+  {"func.ldap_modify_extW.cc","cdecl"}, 
+  {"func.GetFileVersionInfoA.cc","stdcall"}, 
+  {"func.SetProcessDEPPolicy.cc","stdcall"}, 
+  {"func.RegOverridePredefKey.cc","stdcall"}, 
+  {"func.CM_Get_HW_Prof_FlagsA.cc","stdcall"}, 
+  {"func.EnumProcesses.cc","stdcall"}, 
+  {"func.SymGetLineFromName64.cc","stdcall"}, 
+  {"func.PathUnmakeSystemFolderW.cc","stdcall"}, 
+  {"func.GetForegroundWindow.cc","stdcall"}, 
+  {"func.ldap_compare_ext_sW.cc","cdecl"}, 
+  {"func.SetFileAttributesA.cc","stdcall"}, 
+  {"func.CancelWaitableTimer.cc","stdcall"}, 
+  {"func.ldap_abandon.cc","cdecl"}, 
+  {"func.GetScrollPos.cc","stdcall"}, 
+  {"func.VarBoolFromDisp.cc","stdcall"}, 
+  {"func.CoDisableCallCancellation.cc","stdcall"}, 
+  {"func.GetWindowFeedbackSetting.cc","stdcall"}, 
+  {"func.CancelSynchronousIo.cc","stdcall"}, 
+  {"func.SymSetScopeFromAddr.cc","stdcall"}, 
+  {"func.GetTokenInformation.cc","stdcall"}, 
+  {"func.GetFileSecurityW.cc","stdcall"}, 
+  {"func.SHFormatDateTimeA.cc","stdcall"}, 
+  {"func.GetNumberFormatEx.cc","stdcall"}, 
+  {"func.CertFindSubjectInSortedCTL.cc","stdcall"}, 
+  {"func.ldap_add_extW.cc","cdecl"}, 
+  {"func.CryptSIPRemoveSignedDataMsg.cc","stdcall"}, 
+  {"func.GetLogicalDriveStringsW.cc","stdcall"}, 
+  {"func.GetMenuContextHelpId.cc","stdcall"}, 
+  {"func.K32GetModuleFileNameExA.cc","stdcall"}, 
+  {"func.VarBstrFromI4.cc","stdcall"}, 
+  {"func.SHOpenRegStreamW.cc","stdcall"}, 
+  {"func.GetFileVersionInfoExW.cc","stdcall"}, 
+  {"func.ReadThreadProfilingData.cc","stdcall"}, 
+  {"func.OpenWaitableTimerW.cc","stdcall"}, 
+  {"func.QueryAllTracesA.cc","stdcall"}, 
+  {"func.SHRegQueryUSValueA.cc","stdcall"}, 
+  {"func.PowerSetRequest.cc","stdcall"}, 
+  {"func.AddAccessDeniedAceEx.cc","stdcall"}, 
+  {"func.CryptInitOIDFunctionSet.cc","stdcall"}, 
+  {"func.GetRecordInfoFromGuids.cc","stdcall"}, 
+  {"func.SymFromTokenW.cc","stdcall"}, 
+  {"func.SHIsFileAvailableOffline.cc","stdcall"}, 
+  {"func.SHCreateItemFromParsingName.cc","stdcall"}, 
+  {"func.IsZoomed.cc","stdcall"}, 
+  {"func.RevokeActiveObject.cc","stdcall"}, 
+  {"func.VarBoolFromCy.cc","stdcall"}, 
+  {"func.WSAStringToAddressA.cc","stdcall"}, 
+  {"func.CoRevokeClassObject.cc","stdcall"}, 
+  {"func.CryptReleaseContext.cc","stdcall"}, 
+  {"func.CancelThreadpoolIo.cc","stdcall"}, 
+  {"func.SHCreateShellItemArray.cc","stdcall"}, 
+  {"func.ldap_delete_extW.cc","cdecl"}, 
+  {"func.CertVerifySubjectCertificateContext.cc","stdcall"}, 
+  {"func.VarI4FromCy.cc","stdcall"}, 
+  {"func.SHFileOperationA.cc","stdcall"}, 
+  {"func.RemoveDirectoryA.cc","stdcall"}, 
+  {"func.ldap_searchW.cc","cdecl"}, 
+  {"func.CredUIReadSSOCredW.cc","stdcall"}, 
+  {"func.PostMessageA.cc","stdcall"}, 
+  {"func.ExtractIconExA.cc","stdcall"}, 
+  {"func.RegOpenKeyW.cc","stdcall"}, 
+  {"func.CredIsProtectedA.cc","stdcall"}, 
+  {"func.SetSecurityDescriptorControl.cc","stdcall"}, 
+  {"func.GetCommTimeouts.cc","stdcall"}, 
+  {"func.SHOpenRegStreamA.cc","stdcall"}, 
+  {"func.DefFrameProcW.cc","stdcall"}, 
+  {"func.RegisterClassExW.cc","stdcall"}, 
+  {"func.ldap_compare_sA.cc","cdecl"}, 
+  {"func.RegUnLoadKeyW.cc","stdcall"}, 
+  {"func.CreateSemaphoreA.cc","stdcall"}, 
+  {"func.GetAltTabInfoW.cc","stdcall"}, 
+  {"func.SHEnumKeyExA.cc","stdcall"}, 
+  {"func.PFXExportCertStore.cc","stdcall"}, 
+  {"func.SymAddSourceStream.cc","stdcall"}, 
+  {"func.CredRenameA.cc","stdcall"}, 
+  {"func.CertSetCRLContextProperty.cc","stdcall"}, 
+  {"func.VarUI2FromI2.cc","stdcall"}, 
+  {"func.DoEnvironmentSubstA.cc","stdcall"}, 
+  {"func.CM_Delete_Device_Interface_KeyA.cc","stdcall"}, 
+  {"func.LoadMenuA.cc","stdcall"}, 
+  {"func.WSCGetApplicationCategory.cc","stdcall"}, 
+  {"func.CertAddEnhancedKeyUsageIdentifier.cc","stdcall"}, 
+  {"func.RegOpenKeyExW.cc","stdcall"}, 
+  {"func.ImageList_LoadImageA.cc","stdcall"}, 
+  {"func.ldap_addA.cc","cdecl"}, 
+  {"func.CheckDlgButton.cc","stdcall"}, 
+  {"func.GetAppContainerRegistryLocation.cc","stdcall"}, 
+  {"func.MakeAbsoluteSD.cc","stdcall"}, 
+  {"func.UmsThreadYield.cc","stdcall"}, 
+  {"func.CreateGenericComposite.cc","stdcall"}, 
+  {"func.RegEnumKeyExA.cc","stdcall"}, 
+  {"func.GetMessageTime.cc","stdcall"}, 
+  {"func.WSAStringToAddressW.cc","stdcall"}, 
+  {"func.GetErrorMode.cc","stdcall"}, 
+  {"func.CreateDispTypeInfo.cc","stdcall"}, 
+  {"func.IsNativeVhdBoot.cc","stdcall"}, 
+  {"func.WriteEncryptedFileRaw.cc","stdcall"}, 
+  {"func.VarCyFromR4.cc","stdcall"}, 
+  {"func.CreateConsoleScreenBuffer.cc","stdcall"}, 
+  {"func.VarBoolFromI4.cc","stdcall"}, 
+  {"func.GetNumaNodeProcessorMaskEx.cc","stdcall"}, 
+  {"func.OpenEventW.cc","stdcall"}, 
+  {"func.ImageList_Copy.cc","stdcall"}, 
+  {"func.AddScopedPolicyIDAce.cc","stdcall"}, 
+  {"func.InitOnceInitialize.cc","stdcall"}, 
+  {"func.PowerUnregisterFromEffectivePowerModeNotifications.cc","stdcall"}, 
+  {"func.ClearCommBreak.cc","stdcall"}, 
+  {"func.SymSrvIsStore.cc","stdcall"}, 
+  {"func.VirtualQueryEx.cc","stdcall"}, 
+  {"func.CLSIDFromProgID.cc","stdcall"}, 
+  {"func.CM_Open_DevNode_Key_Ex.cc","stdcall"}, 
+  {"func.OpenSemaphoreW.cc","stdcall"}, 
+  {"func.CryptUnprotectData.cc","stdcall"}, 
+  {"func.InvalidateRect.cc","stdcall"}, 
+  {"func.WindowFromPhysicalPoint.cc","stdcall"}, 
+  {"func.WaitForDebugEventEx.cc","stdcall"}, 
+  {"func.CM_Create_DevNodeA.cc","stdcall"}, 
+  {"func.NotifyServiceStatusChangeA.cc","stdcall"}, 
+  {"func.FlatSB_SetScrollRange.cc","stdcall"}, 
+  {"func.MonitorFromWindow.cc","stdcall"}, 
+  {"func.VarI8FromUI8.cc","stdcall"}, 
+  {"func.GetDateFormatA.cc","stdcall"}, 
+  {"func.BCryptFinalizeKeyPair.cc","stdcall"}, 
+  {"func.SymFromInlineContextW.cc","stdcall"}, 
+  {"func.VirtualAllocExNuma.cc","stdcall"}, 
+  {"func.FreeResource.cc","stdcall"}, 
+  {"func.CreateJobObjectW.cc","stdcall"}, 
+  {"func.VarR8FromI2.cc","stdcall"}, 
+  {"func.WPUCompleteOverlappedRequest.cc","stdcall"}, 
+  {"func.VarDecFromUI1.cc","stdcall"}, 
+  {"func.SymSrvGetSupplementW.cc","stdcall"}, 
+  {"func.VarDecFromI8.cc","stdcall"}, 
+  {"func.TrySubmitThreadpoolCallback.cc","stdcall"}, 
+  {"func.ChangeServiceConfigW.cc","stdcall"}, 
+  {"func.AcquireSRWLockExclusive.cc","stdcall"}, 
+  {"func.PathAddBackslashA.cc","stdcall"}, 
+  {"func.DrawAnimatedRects.cc","stdcall"}, 
+  {"func.sendto.cc","stdcall"}, 
+  {"func.CallNamedPipeA.cc","stdcall"}, 
+  {"func.CallNextHookEx.cc","stdcall"}, 
+  {"func.GetAcceptLanguagesW.cc","stdcall"}, 
+  {"func.RegisterClassW.cc","stdcall"}, 
+  {"func.PathCchCanonicalize.cc","stdcall"}, 
+  {"func.ExcludeUpdateRgn.cc","stdcall"}, 
+  {"func.FindVolumeClose.cc","stdcall"}, 
+  {"func.WSASetServiceA.cc","stdcall"}, 
+  {"func.CertAddCRLLinkToStore.cc","stdcall"}, 
+  {"func.SymSetScopeFromInlineContext.cc","stdcall"}, 
+  {"func.GetPriorityClipboardFormat.cc","stdcall"}, 
+  {"func.SHUnicodeToUnicode.cc","stdcall"}, 
+  {"func.GetRawInputBuffer.cc","stdcall"}, 
+  {"func.RealChildWindowFromPoint.cc","stdcall"}, 
+  {"func.ClearCustData.cc","stdcall"}, 
+  {"func.SysAddRefString.cc","stdcall"}, 
+  {"func.AbortSystemShutdownA.cc","stdcall"}, 
+  {"func.GetConsoleScreenBufferInfo.cc","stdcall"}, 
+  {"func.GetWsChanges.cc","stdcall"}, 
+  {"func.SHRegGetValueA.cc","stdcall"}, 
+  {"func.SHRegDeleteUSValueA.cc","stdcall"}, 
+  {"func.PathSearchAndQualifyA.cc","stdcall"}, 
+  {"func.VarUI4FromCy.cc","stdcall"}, 
+  {"func.FindResourceExW.cc","stdcall"}, 
+  {"func.PathCchFindExtension.cc","stdcall"}, 
+  {"func.CertSetCertificateContextPropertiesFromCTLEntry.cc","stdcall"}, 
+  {"func.EnumSystemLocalesW.cc","stdcall"}, 
+  {"func.PrepareTape.cc","stdcall"}, 
+  {"func.SleepConditionVariableCS.cc","stdcall"}, 
+  {"func.CryptDecryptAndVerifyMessageSignature.cc","stdcall"}, 
+  {"func.SetSecurityDescriptorRMControl.cc","stdcall"}, 
+  {"func.ldap_get_values.cc","cdecl"}, 
+  {"func.SymUnloadModule.cc","stdcall"}, 
+  {"func.CM_Create_DevNode_ExW.cc","stdcall"}, 
+  {"func.GetNameInfoW.cc","stdcall"}, 
+  {"func.IStream_Reset.cc","stdcall"}, 
+  {"func.RevokeScaleChangeNotifications.cc","stdcall"}, 
+  {"func.GetVolumeNameForVolumeMountPointA.cc","stdcall"}, 
+  {"func.FindExecutableA.cc","stdcall"}, 
+  {"func.ldap_create_page_controlA.cc","cdecl"}, 
+  {"func.CM_Set_Class_Registry_PropertyA.cc","stdcall"}, 
+  {"func.WSCUpdateProvider32.cc","stdcall"}, 
+  {"func.VarDecFromDate.cc","stdcall"}, 
+  {"func.DuplicateToken.cc","stdcall"}, 
+  {"func.WSASend.cc","stdcall"}, 
+  {"func.CryptGetDefaultOIDFunctionAddress.cc","stdcall"}, 
+  {"func.FlsSetValue.cc","stdcall"}, 
+  {"func.CM_Set_Device_Interface_PropertyW.cc","stdcall"}, 
+  {"func.WinHttpGetProxyResultEx.cc","stdcall"}, 
+  {"func.GetMappedFileNameA.cc","stdcall"}, 
+  {"func.SHGetStockIconInfo.cc","stdcall"}, 
+  {"func.ShellExecuteExA.cc","stdcall"}, 
+  {"func.ntohl.cc","stdcall"}, 
+  {"func.PathIsDirectoryA.cc","stdcall"}, 
+  {"func.GetNumaNodeNumberFromHandle.cc","stdcall"}, 
+  {"func.IsDialogMessageA.cc","stdcall"}, 
+  {"func.CryptMsgGetAndVerifySigner.cc","stdcall"}, 
+  {"func.CertSerializeCRLStoreElement.cc","stdcall"}, 
+  {"func.SHAssocEnumHandlers.cc","stdcall"}, 
+  {"func.DispGetIDsOfNames.cc","stdcall"}, 
+  {"func.WSARemoveServiceClass.cc","stdcall"}, 
+  {"func.GetProfileStringA.cc","stdcall"}, 
+  {"func.SHGetNewLinkInfoA.cc","stdcall"}, 
+  {"func.CryptVerifyMessageSignatureWithKey.cc","stdcall"}, 
+  {"func.CreateFileMappingNumaW.cc","stdcall"}, 
+  {"func.SetFileInformationByHandle.cc","stdcall"}, 
+  {"func.CryptEnumProviderTypesA.cc","stdcall"}, 
+  {"func.PathStripPathW.cc","stdcall"}, 
+  {"func.CoDecodeProxy.cc","stdcall"}, 
+  {"func.SHCreateShellPalette.cc","stdcall"}, 
+  {"func.VarR8FromBool.cc","stdcall"}, 
+  {"func.ldap_modify_ext.cc","cdecl"}, 
+  {"func.ReadFile.cc","stdcall"}, 
+  {"func.VarBstrCmp.cc","stdcall"}, 
+  {"func.AccessCheckAndAuditAlarmA.cc","stdcall"}, 
+  {"func.DisplayConfigSetDeviceInfo.cc","stdcall"}, 
+  {"func.LdapMapErrorToWin32.cc","cdecl"}, 
+  {"func.NCryptImportKey.cc","stdcall"}, 
+  {"func.SetParent.cc","stdcall"}, 
+  {"func.CertComparePublicKeyInfo.cc","stdcall"}, 
+  {"func.PathUndecorateA.cc","stdcall"}, 
+  {"func.VarUI1FromI8.cc","stdcall"}, 
+  {"func.GetProcessWorkingSetSize.cc","stdcall"}, 
+  {"func.WSAQuerySocketSecurity.cc","stdcall"}, 
+  {"func.NotifyBootConfigStatus.cc","stdcall"}, 
+  {"func.CreateFileMappingFromApp.cc","stdcall"}, 
+  {"func.DefDlgProcA.cc","stdcall"}, 
+  {"func.ldap_create_vlv_controlW.cc","cdecl"}, 
+  {"func.GetThreadPriority.cc","stdcall"}, 
+  {"func.FindExecutableW.cc","stdcall"}, 
+  {"func.CreateRestrictedToken.cc","stdcall"}, 
+  {"func.MsgWaitForMultipleObjects.cc","stdcall"}, 
+  {"func.CM_Set_HW_Prof_Ex.cc","stdcall"}, 
+  {"func.GetWindowTextA.cc","stdcall"}, 
+  {"func.WSCInstallQOSTemplate.cc","stdcall"}, 
+  {"func.CreateIoCompletionPort.cc","stdcall"}, 
+  {"func.SymEnumSymbolsForAddrW.cc","stdcall"}, 
+  {"func.ShellExecuteExW.cc","stdcall"}, 
+  {"func.DestroyAcceleratorTable.cc","stdcall"}, 
+  {"func.CM_Get_Resource_Conflict_DetailsA.cc","stdcall"}, 
+  {"func.CM_Query_And_Remove_SubTree_ExA.cc","stdcall"}, 
+  {"func.SHCreateStreamOnFileW.cc","stdcall"}, 
+  {"func.PathCchRemoveFileSpec.cc","stdcall"}, 
+  {"func.Wow64EnableWow64FsRedirection.cc","stdcall"}, 
+  {"func.LoadEnclaveData.cc","stdcall"}, 
+  {"func.PathFindExtensionW.cc","stdcall"}, 
+  {"func.PathIsPrefixW.cc","stdcall"}, 
+  {"func.WinHttpQueryHeaders.cc","stdcall"}, 
+  {"func.getsockname.cc","stdcall"}, 
+  {"func.WSARecvFrom.cc","stdcall"}, 
+  {"func.ProcessTrace.cc","stdcall"}, 
+  {"func.SysAllocStringByteLen.cc","stdcall"}, 
+  {"func.WSAUnadvertiseProvider.cc","stdcall"}, 
+  {"func.BCryptCreateMultiHash.cc","stdcall"}, 
+  {"func.ntohs.cc","stdcall"}, 
+  {"func.CM_Request_Device_Eject_ExA.cc","stdcall"}, 
+  {"func.SetEnvironmentStringsW.cc","stdcall"}, 
+  {"func.SHRegDuplicateHKey.cc","stdcall"}, 
+  {"func.GetExitCodeProcess.cc","stdcall"}, 
+  {"func.AddAccessDeniedAce.cc","stdcall"}, 
+  {"func.VarDecFromR4.cc","stdcall"}, 
+  {"func.GetThreadDesktop.cc","stdcall"}, 
+  {"func.IsBadCodePtr.cc","stdcall"}, 
+  {"func.Sleep.cc","stdcall"}, 
+  {"func.PathIsSystemFolderW.cc","stdcall"}, 
+  {"func.CreateThread.cc","stdcall"}, 
+  {"func.ldap_escape_filter_elementW.cc","cdecl"}, 
+  {"func.VarBoolFromUI8.cc","stdcall"}, 
+  {"func.WinHelpA.cc","stdcall"}, 
+  {"func.WinHttpWebSocketReceive.cc","stdcall"}, 
+  {"func.ldap_create_sort_controlA.cc","cdecl"}, 
+  {"type.HFILE.size","32"}, 
+  {"func.NCryptOpenStorageProvider.cc","stdcall"}, 
+  {"func.VarDateFromI8.cc","stdcall"}, 
+  {"func.RegDeleteTreeA.cc","stdcall"}, 
+  {"func.FindResourceA.cc","stdcall"}, 
+  {"func.VarBstrFromBool.cc","stdcall"}, 
+  {"func.BCryptGetProperty.cc","stdcall"}, 
+  {"func.CoTaskMemFree.cc","stdcall"}, 
+  {"func.CoGetPSClsid.cc","stdcall"}, 
+  {"func.DeleteVolumeMountPointW.cc","stdcall"}, 
+  {"func.SymFromName.cc","stdcall"}, 
+  {"func.RegQueryMultipleValuesW.cc","stdcall"}, 
+  {"func.CM_Add_Res_Des_Ex.cc","stdcall"}, 
+  {"func.PathRemoveExtensionA.cc","stdcall"}, 
+  {"func.DeviceIoControl.cc","stdcall"}, 
+  {"func.SymEnumProcesses.cc","stdcall"}, 
+  {"type.DWORD_PTE.size","32"}, 
+  {"func.CreateEnclave.cc","stdcall"}, 
+  {"func.VarUI1FromStr.cc","stdcall"}, 
+  {"func.DefFrameProcA.cc","stdcall"}, 
+  {"func.ldap_sasl_bindW.cc","cdecl"}, 
+  {"func.WSCSetProviderInfo.cc","stdcall"}, 
+  {"func.VarTokenizeFormatString.cc","stdcall"}, 
+  {"func.SHEnumKeyExW.cc","stdcall"}, 
+  {"func.BindIoCompletionCallback.cc","stdcall"}, 
+  {"func.EnumServicesStatusExA.cc","stdcall"}, 
+  {"func.VarR4FromCy.cc","stdcall"}, 
+  {"func.SHQueryValueExA.cc","stdcall"}, 
+  {"func.BCryptGetFipsAlgorithmMode.cc","stdcall"}, 
+  {"func.VarI2FromI1.cc","stdcall"}, 
+  {"func.GetGeoInfoW.cc","stdcall"}, 
+  {"func.GetPointerInfoHistory.cc","stdcall"}, 
+  {"func.RegisterEventSourceW.cc","stdcall"}, 
+  {"func.QueryServiceConfig2A.cc","stdcall"}, 
+  {"func.DragFinish.cc","stdcall"}, 
+  {"func.DebugActiveProcessStop.cc","stdcall"}, 
+  {"func.GetWindowLongA.cc","stdcall"}, 
+  {"func.RegDisableReflectionKey.cc","stdcall"}, 
+  {"func.EmptyWorkingSet.cc","stdcall"}, 
+  {"func.DlgDirSelectExA.cc","stdcall"}, 
+  {"func.CharPrevExA.cc","stdcall"}, 
+  {"func.VarUI4FromDisp.cc","stdcall"}, 
+  {"func.ImagehlpApiVersion.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_Registry_PropertyA.cc","stdcall"}, 
+  {"func.FoldStringA.cc","stdcall"}, 
+  {"func.TrackMouseEvent.cc","stdcall"}, 
+  {"func.GetClassInfoA.cc","stdcall"}, 
+  {"func.CryptGetDefaultProviderA.cc","stdcall"}, 
+  {"func.CryptSetHashParam.cc","stdcall"}, 
+  {"func.CoAllowUnmarshalerCLSID.cc","stdcall"}, 
+  {"func.HiliteMenuItem.cc","stdcall"}, 
+  {"func.EnumSystemLocalesEx.cc","stdcall"}, 
+  {"func.WSALookupServiceBeginW.cc","stdcall"}, 
+  {"func.WSARecvDisconnect.cc","stdcall"}, 
+  {"func.RegisterDeviceNotificationA.cc","stdcall"}, 
+  {"func.CM_Enumerate_EnumeratorsW.cc","stdcall"}, 
+  {"func.IsLFNDriveA.cc","stdcall"}, 
+  {"func.PathRemoveFileSpecW.cc","stdcall"}, 
+  {"func.WSCGetProviderInfo.cc","stdcall"}, 
+  {"func.VarI2FromUI4.cc","stdcall"}, 
+  {"func.GetUserPreferredUILanguages.cc","stdcall"}, 
+  {"func.SetSystemTime.cc","stdcall"}, 
+  {"func.SendMessageTimeoutW.cc","stdcall"}, 
+  {"func.ObjectDeleteAuditAlarmW.cc","stdcall"}, 
+  {"func.LdapUTF8ToUnicode.cc","cdecl"}, 
+  {"func.EnumServicesStatusExW.cc","stdcall"}, 
+  {"func.EnumPropsExW.cc","stdcall"}, 
+  {"func.GetTempPathW.cc","stdcall"}, 
+  {"func.UnregisterWait.cc","stdcall"}, 
+  {"func.AnyPopup.cc","stdcall"}, 
+  {"func.SendDlgItemMessageW.cc","stdcall"}, 
+  {"func.GetShortPathNameA.cc","stdcall"}, 
+  {"func.InitAtomTable.cc","stdcall"}, 
+  {"func.VarUI2FromI1.cc","stdcall"}, 
+  {"func.CallWindowProcW.cc","stdcall"}, 
+  {"func.PathAddBackslashW.cc","stdcall"}, 
+  {"func.CertCreateCertificateContext.cc","stdcall"}, 
+  {"func.CM_Get_Version.cc","stdcall"}, 
+  {"func.CredGetSessionTypes.cc","stdcall"}, 
+  {"func.PathUnquoteSpacesW.cc","stdcall"}, 
+  {"func.GetLongPathNameA.cc","stdcall"}, 
+  {"func.PathCchRemoveExtension.cc","stdcall"}, 
+  {"func.CoRegisterClassObject.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_Registry_PropertyW.cc","stdcall"}, 
+  {"func.FoldStringW.cc","stdcall"}, 
+  {"func.MapViewOfFileExNuma.cc","stdcall"}, 
+  {"func.GetMemoryErrorHandlingCapabilities.cc","stdcall"}, 
+  {"func.SetSystemTimeAdjustmentPrecise.cc","stdcall"}, 
+  {"func.VarI1FromI2.cc","stdcall"}, 
+  {"func.GetCPInfo.cc","stdcall"}, 
+  {"func.EventRegister.cc","stdcall"}, 
+  {"func.CoQueryProxyBlanket.cc","stdcall"}, 
+  {"func.RegisterDeviceNotificationW.cc","stdcall"}, 
+  {"func.GetNumaNodeProcessorMask.cc","stdcall"}, 
+  {"func.EncodeSystemPointer.cc","stdcall"}, 
+  {"func.InstallELAMCertificateInfo.cc","stdcall"}, 
+  {"func.CoFreeLibrary.cc","stdcall"}, 
+  {"func.SetThreadpoolWait.cc","stdcall"}, 
+  {"func.DcomChannelSetHResult.cc","stdcall"}, 
+  {"func.LoadLibraryExA.cc","stdcall"}, 
+  {"func.SetConsoleOutputCP.cc","stdcall"}, 
+  {"func.CoBuildVersion.cc","stdcall"}, 
+  {"func.PathCanonicalizeA.cc","stdcall"}, 
+  {"func.VarR4FromUI8.cc","stdcall"}, 
+  {"func.SymDeleteSymbolW.cc","stdcall"}, 
+  {"func.ldap_modify_ext_s.cc","cdecl"}, 
+  {"func.VarXor.cc","stdcall"}, 
+  {"func.CM_Move_DevNode_Ex.cc","stdcall"}, 
+  {"func.SetUserObjectSecurity.cc","stdcall"}, 
+  {"func.SetWinEventHook.cc","stdcall"}, 
+  {"func.ldap_control_freeW.cc","cdecl"}, 
+  {"func.VarSub.cc","stdcall"}, 
+  {"func.FindFirstFileExW.cc","stdcall"}, 
+  {"func.SetAddrInfoExA.cc","stdcall"}, 
+  {"func.SHRegEnumUSValueW.cc","stdcall"}, 
+  {"func.PathCchCombine.cc","stdcall"}, 
+  {"func.SymEnumerateSymbols64.cc","stdcall"}, 
+  {"func.SHFreeShared.cc","stdcall"}, 
+  {"func.EnumClipboardFormats.cc","stdcall"}, 
+  {"func.VarCyFromUI8.cc","stdcall"}, 
+  {"func.UrlCreateFromPathW.cc","stdcall"}, 
+  {"func.GetVolumeNameForVolumeMountPointW.cc","stdcall"}, 
+  {"func.SymQueryInlineTrace.cc","stdcall"}, 
+  {"func.Shell_NotifyIconGetRect.cc","stdcall"}, 
+  {"func.CreateThreadpoolIo.cc","stdcall"}, 
+  {"func.GetPriorityClass.cc","stdcall"}, 
+  {"func.CertAddSerializedElementToStore.cc","stdcall"}, 
+  {"func.IUnknown_AtomicRelease.cc","stdcall"}, 
+  {"func.DlgDirListA.cc","stdcall"}, 
+  {"func.NCryptCloseProtectionDescriptor.cc","stdcall"}, 
+  {"func.RtlPcToFileHeader.cc","stdcall"}, 
+  {"func.SwitchDesktop.cc","stdcall"}, 
+  {"func.SetSecurityAccessMask.cc","stdcall"}, 
+  {"func.IsGUIThread.cc","stdcall"}, 
+  {"func.IsDBCSLeadByte.cc","stdcall"}, 
+  {"type.HINSTANCE.size","32"}, 
+  {"func.VarI8FromCy.cc","stdcall"}, 
+  {"func.EnumSystemGeoNames.cc","stdcall"}, 
+  {"func.WPUQueryBlockingCallback.cc","stdcall"}, 
+  {"func.VarUI4FromUI8.cc","stdcall"}, 
+  {"func.CoGetInstanceFromIStorage.cc","stdcall"}, 
+  {"func.CreateCursor.cc","stdcall"}, 
+  {"func.CertAddCTLContextToStore.cc","stdcall"}, 
+  {"func.GetVolumePathNamesForVolumeNameA.cc","stdcall"}, 
+  {"func.SafeArrayPutElement.cc","stdcall"}, 
+  {"func.CM_Get_Hardware_Profile_Info_ExA.cc","stdcall"}, 
+  {"func.SetAclInformation.cc","stdcall"}, 
+  {"func.PathCompactPathA.cc","stdcall"}, 
+  {"func.SetWindowPos.cc","stdcall"}, 
+  {"func.CreateHardLinkA.cc","stdcall"}, 
+  {"func.BCryptHashData.cc","stdcall"}, 
+  {"func.lstrcpyA.cc","stdcall"}, 
+  {"func.CryptGetHashParam.cc","stdcall"}, 
+  {"func.StopTraceA.cc","stdcall"}, 
+  {"func.GetModuleHandleExW.cc","stdcall"}, 
+  {"func.PathIsRootW.cc","stdcall"}, 
+  {"func.FindFirstVolumeA.cc","stdcall"}, 
+  {"func.ldap_control_freeA.cc","cdecl"}, 
+  {"func.WinHttpWebSocketShutdown.cc","stdcall"}, 
+  {"func.ChangeDisplaySettingsExA.cc","stdcall"}, 
+  {"func.DestroyPrivateObjectSecurity.cc","stdcall"}, 
+  {"func.CoGetApartmentType.cc","stdcall"}, 
+  {"func.GetCompressedFileSizeA.cc","stdcall"}, 
+  {"func.CM_Add_Res_Des.cc","stdcall"}, 
+  {"func.CM_Get_First_Log_Conf.cc","stdcall"}, 
+  {"func.CM_Next_Range.cc","stdcall"}, 
+  {"func.ExtractIconW.cc","stdcall"}, 
+  {"func.VarWeekdayName.cc","stdcall"}, 
+  {"func.QueryActCtxW.cc","stdcall"}, 
+  {"type.HKL.size","32"}, 
+  {"func.SymLoadModule.cc","stdcall"}, 
+  {"func.GetServiceW.cc","stdcall"}, 
+  {"type.HGLOBAL.size","32"}, 
+  {"func.VarFormatPercent.cc","stdcall"}, 
+  {"func.SetFirmwareEnvironmentVariableA.cc","stdcall"}, 
+  {"func.SetProcessPriorityBoost.cc","stdcall"}, 
+  {"func.SymEnumSourceLinesW.cc","stdcall"}, 
+  {"func.SHSetValueW.cc","stdcall"}, 
+  {"func.ldap_explode_dn.cc","cdecl"}, 
+  {"func.DeleteService.cc","stdcall"}, 
+  {"func.CryptGetDefaultOIDDllList.cc","stdcall"}, 
+  {"func.ldap_compareW.cc","cdecl"}, 
+  {"func.OleTranslateColor.cc","stdcall"}, 
+  {"func.BlockInput.cc","stdcall"}, 
+  {"func.CertGetCRLContextProperty.cc","stdcall"}, 
+  {"func.GetMaximumProcessorGroupCount.cc","stdcall"}, 
+  {"func.GetVersionExW.cc","stdcall"}, 
+  {"func.BCryptAddContextFunction.cc","stdcall"}, 
+  {"func.SetProcessAffinityMask.cc","stdcall"}, 
+  {"func.CertAddCRLContextToStore.cc","stdcall"}, 
+  {"func.PathCompactPathExA.cc","stdcall"}, 
+  {"func.CertIsStrongHashToSign.cc","stdcall"}, 
+  {"func.VerInstallFileA.cc","stdcall"}, 
+  {"func.RtlLookupFunctionEntryCHPE.cc","stdcall"}, 
+  {"func.ber_alloc_t.cc","cdecl"}, 
+  {"func.WaitNamedPipeW.cc","stdcall"}, 
+  {"func.CopyAcceleratorTableA.cc","stdcall"}, 
+  {"func.EnumDisplaySettingsExW.cc","stdcall"}, 
+  {"func.GetDefaultCommConfigA.cc","stdcall"}, 
+  {"func.StrRStrIA.cc","stdcall"}, 
+  {"func.RegQueryValueA.cc","stdcall"}, 
+  {"func.SymEnumSymbolsForAddr.cc","stdcall"}, 
+  {"func.FlashWindow.cc","stdcall"}, 
+  {"func.UrlIsNoHistoryW.cc","stdcall"}, 
+  {"func.OperationEnd.cc","stdcall"}, 
+  {"func.VarUI8FromBool.cc","stdcall"}, 
+  {"func.SendMessageA.cc","stdcall"}, 
+  {"func.WinHttpSendRequest.cc","stdcall"}, 
+  {"func.CharNextA.cc","stdcall"}, 
+  {"func.SymSetContext.cc","stdcall"}, 
+  {"func.SymRegisterFunctionEntryCallback.cc","stdcall"}, 
+  {"func.CreateMappedBitmap.cc","stdcall"}, 
+  {"func.ldap_sasl_bind_sA.cc","cdecl"}, 
+  {"func.ChangeServiceConfig2W.cc","stdcall"}, 
+  {"func.GetServiceA.cc","stdcall"}, 
+  {"func.ClearCommError.cc","stdcall"}, 
+  {"func.ImagehlpApiVersionEx.cc","stdcall"}, 
+  {"func.CheckTokenMembershipEx.cc","stdcall"}, 
+  {"func.GetScrollRange.cc","stdcall"}, 
+  {"func.GetSystemMetricsForDpi.cc","stdcall"}, 
+  {"func.CM_Register_Device_Interface_ExW.cc","stdcall"}, 
+  {"func.ConvertSidToStringSidA.cc","stdcall"}, 
+  {"func.GetProcessHeaps.cc","stdcall"}, 
+  {"func.GetUmsSystemThreadInformation.cc","stdcall"}, 
+  {"func.OffsetRect.cc","stdcall"}, 
+  {"func.QueryIoRateControlInformationJobObject.cc","stdcall"}, 
+  {"func.GetModuleHandleA.cc","stdcall"}, 
+  {"func.GetProductInfo.cc","stdcall"}, 
+  {"func.UrlIsW.cc","stdcall"}, 
+  {"func.ControlServiceExA.cc","stdcall"}, 
+  {"func.WPUQueueApc.cc","stdcall"}, 
+  {"func.VarUI8FromI8.cc","stdcall"}, 
+  {"func.PathMakeSystemFolderW.cc","stdcall"}, 
+  {"func.GetKBCodePage.cc","stdcall"}, 
+  {"func.VarUI4FromDate.cc","stdcall"}, 
+  {"func.WaitForDebugEvent.cc","stdcall"}, 
+  {"func.WSAProviderConfigChange.cc","stdcall"}, 
+  {"func.DrawCaption.cc","stdcall"}, 
+  {"func.VarUI1FromDec.cc","stdcall"}, 
+  {"func.GetDisplayConfigBufferSizes.cc","stdcall"}, 
+  {"func.WinHttpCloseHandle.cc","stdcall"}, 
+  {"func.SymGetLinePrev.cc","stdcall"}, 
+  {"func.CryptGetMessageSignerCount.cc","stdcall"}, 
+  {"func.BCryptQueryContextFunctionConfiguration.cc","stdcall"}, 
+  {"func.ldap_sasl_bindA.cc","cdecl"}, 
+  {"func.GetWindowsAccountDomainSid.cc","stdcall"}, 
+  {"func.SetTimerQueueTimer.cc","stdcall"}, 
+  {"func._TrackMouseEvent.cc","stdcall"}, 
+  {"func.SymGetLineFromNameW64.cc","stdcall"}, 
+  {"func.LookupAccountNameW.cc","stdcall"}, 
+  {"func.LoadStringByReference.cc","stdcall"}, 
+  {"func.WSAAsyncGetProtoByNumber.cc","stdcall"}, 
+  {"func.QueryPerformanceCounter.cc","stdcall"}, 
+  {"func.LogonUserW.cc","stdcall"}, 
+  {"func.ChangeServiceConfig2A.cc","stdcall"}, 
+  {"func.GetGeoInfoA.cc","stdcall"}, 
+  {"func.RtlCompareMemory.cc","stdcall"}, 
+  {"func.IsBadWritePtr.cc","stdcall"}, 
+  {"func.InitializeContext.cc","stdcall"}, 
+  {"func.htonl.cc","stdcall"}, 
+  {"func.OemToCharA.cc","stdcall"}, 
+  {"func.wvsprintfW.cc","stdcall"}, 
+  {"func.RevertToSelf.cc","stdcall"}, 
+  {"func.SHAllocShared.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_AliasA.cc","stdcall"}, 
+  {"type.HDROP.size","32"}, 
+  {"func.CloseThreadpoolCleanupGroupMembers.cc","stdcall"}, 
+  {"func.InjectTouchInput.cc","stdcall"}, 
+  {"func.CertCompareCertificateName.cc","stdcall"}, 
+  {"func.ldap_value_freeA.cc","cdecl"}, 
+  {"func.VarI2FromR4.cc","stdcall"}, 
+  {"func.RemoveDllDirectory.cc","stdcall"}, 
+  {"func.CopyFileExW.cc","stdcall"}, 
+  {"func.SysStringByteLen.cc","stdcall"}, 
+  {"func.UnlockServiceDatabase.cc","stdcall"}, 
+  {"func.SysFreeString.cc","stdcall"}, 
+  {"func.VarDateFromCy.cc","stdcall"}, 
+  {"func.MakeDragList.cc","stdcall"}, 
+  {"func.AssocQueryStringByKeyA.cc","stdcall"}, 
+  {"func.IsRectEmpty.cc","stdcall"}, 
+  {"func.MoveFileW.cc","stdcall"}, 
+  {"func.VarBstrFromUI8.cc","stdcall"}, 
+  {"func.WSALookupServiceBeginA.cc","stdcall"}, 
+  {"func.CheckRadioButton.cc","stdcall"}, 
+  {"func.SetThreadPriorityBoost.cc","stdcall"}, 
+  {"func.CreateNamedPipeA.cc","stdcall"}, 
+  {"func.GetSystemTimePreciseAsFileTime.cc","stdcall"}, 
+  {"func.VirtualProtect.cc","stdcall"}, 
+  {"func.ldap_delete_sA.cc","cdecl"}, 
+  {"func.CreateMutexExW.cc","stdcall"}, 
+  {"func.SetConsoleCP.cc","stdcall"}, 
+  {"func.GetLayeredWindowAttributes.cc","stdcall"}, 
+  {"type.LPFILETIME.size","32"}, 
+  {"func.CM_Get_Device_Interface_ListW.cc","stdcall"}, 
+  {"func.RegisterServiceCtrlHandlerW.cc","stdcall"}, 
+  {"func.GetClassNameA.cc","stdcall"}, 
+  {"func.SHEmptyRecycleBinA.cc","stdcall"}, 
+  {"func.CryptGetOIDFunctionAddress.cc","stdcall"}, 
+  {"func.CoTreatAsClass.cc","stdcall"}, 
+  {"func.SHRegGetBoolUSValueA.cc","stdcall"}, 
+  {"func.CryptVerifySignatureW.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_Property_ExW.cc","stdcall"}, 
+  {"func.ReadConsoleW.cc","stdcall"}, 
+  {"func.SHCreateItemFromIDList.cc","stdcall"}, 
+  {"func.EmptyClipboard.cc","stdcall"}, 
+  {"func.VariantCopy.cc","stdcall"}, 
+  {"func.GetClipboardData.cc","stdcall"}, 
+  {"func.DrawStateA.cc","stdcall"}, 
+  {"func.QueryServiceStatus.cc","stdcall"}, 
+  {"func.SymGetSymFromAddr64.cc","stdcall"}, 
+  {"func.GetPointerFramePenInfo.cc","stdcall"}, 
+  {"func.VarBstrFromI2.cc","stdcall"}, 
+  {"func.SysAllocString.cc","stdcall"}, 
+  {"func.ldap_simple_bindA.cc","cdecl"}, 
+  {"func.RegEnumValueW.cc","stdcall"}, 
+  {"func.StrTrimW.cc","stdcall"}, 
+  {"func.GetProfilesDirectoryW.cc","stdcall"}, 
+  {"func.CM_Query_Resource_Conflict_List.cc","stdcall"}, 
+  {"func.ChildWindowFromPointEx.cc","stdcall"}, 
+  {"func.ldap_add.cc","cdecl"}, 
+  {"func.IsValidLocaleName.cc","stdcall"}, 
+  {"func.UnregisterPointerInputTargetEx.cc","stdcall"}, 
+  {"func.FindNextFileW.cc","stdcall"}, 
+  {"func.SetThreadIdealProcessor.cc","stdcall"}, 
+  {"func.SetFileSecurityA.cc","stdcall"}, 
+  {"func.FindFirstVolumeMountPointW.cc","stdcall"}, 
+  {"func.GetCIMSSM.cc","stdcall"}, 
+  {"func.StrCmpNIW.cc","stdcall"}, 
+  {"func.WaitForMultipleObjectsEx.cc","stdcall"}, 
+  {"func.SHGetPropertyStoreFromIDList.cc","stdcall"}, 
+  {"func.LoadEnclaveImageA.cc","stdcall"}, 
+  {"func.SymSrvStoreSupplement.cc","stdcall"}, 
+  {"func.CryptSIPGetCaps.cc","stdcall"}, 
+  {"func.BCryptFinishHash.cc","stdcall"}, 
+  {"func.GetPointerTouchInfo.cc","stdcall"}, 
+  {"func.SafeArrayGetElement.cc","stdcall"}, 
+  {"func.CM_Delete_Device_Interface_Key_ExW.cc","stdcall"}, 
+  {"func.GetTabbedTextExtentW.cc","stdcall"}, 
+  {"func.CreateDirectoryExW.cc","stdcall"}, 
+  {"func.StringFromIID.cc","stdcall"}, 
+  {"func.SetMenuDefaultItem.cc","stdcall"}, 
+  {"func.VarR8Round.cc","stdcall"}, 
+  {"func.lstrcpynA.cc","stdcall"}, 
+  {"func.GetWindowTextLengthA.cc","stdcall"}, 
+  {"func.PathRemoveArgsA.cc","stdcall"}, 
+  {"func.RtlRaiseException.cc","stdcall"}, 
+  {"func.SetAddrInfoExW.cc","stdcall"}, 
+  {"func.SHRegEnumUSValueA.cc","stdcall"}, 
+  {"func.AddAtomW.cc","stdcall"}, 
+  {"func.SetThreadUILanguage.cc","stdcall"}, 
+  {"func.LocalCompact.cc","stdcall"}, 
+  {"func.FindWindowW.cc","stdcall"}, 
+  {"func.DialogBoxIndirectParamW.cc","stdcall"}, 
+  {"func.PathIsUNCEx.cc","stdcall"}, 
+  {"func.UrlCreateFromPathA.cc","stdcall"}, 
+  {"func.ldap_modify_extA.cc","cdecl"}, 
+  {"func.ldap_get_paged_count.cc","cdecl"}, 
+  {"func.IsNormalizedString.cc","stdcall"}, 
+  {"func.CoDisconnectContext.cc","stdcall"}, 
+  {"func.BCryptQueryContextConfiguration.cc","stdcall"}, 
+  {"func.AppendMenuW.cc","stdcall"}, 
+  {"func.WriteProfileSectionA.cc","stdcall"}, 
+  {"func.GetProcessReference.cc","stdcall"}, 
+  {"func.ConvertStringSecurityDescriptorToSecurityDescriptorA.cc","stdcall"}, 
+  {"func.WSCInstallProvider64_32.cc","stdcall"}, 
+  {"func.GetIconInfo.cc","stdcall"}, 
+  {"func.VerLanguageNameA.cc","stdcall"}, 
+  {"func.PathAddExtensionW.cc","stdcall"}, 
+  {"func.ldap_free_controlsA.cc","cdecl"}, 
+  {"func.VarDecFromUI4.cc","stdcall"}, 
+  {"func.FillConsoleOutputCharacterA.cc","stdcall"}, 
+  {"func.DlgDirListComboBoxA.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_List_SizeW.cc","stdcall"}, 
+  {"func.getsockopt.cc","stdcall"}, 
+  {"func.ReOpenFile.cc","stdcall"}, 
+  {"func.ldap_get_dnA.cc","cdecl"}, 
+  {"func.OleSavePictureFile.cc","stdcall"}, 
+  {"func.SetSysColors.cc","stdcall"}, 
+  {"func.GetUmsCompletionListEvent.cc","stdcall"}, 
+  {"func.DisableThreadLibraryCalls.cc","stdcall"}, 
+  {"func.OemToCharBuffW.cc","stdcall"}, 
+  {"func.lstrcpynW.cc","stdcall"}, 
+  {"type.HDESK.size","32"}, 
+  {"func.FreeEnvironmentStringsA.cc","stdcall"}, 
+  {"func.SetConsoleCtrlHandler.cc","stdcall"}, 
+  {"func.VarDecInt.cc","stdcall"}, 
+  {"func.SymRegisterCallback64.cc","stdcall"}, 
+  {"func.SetClipboardViewer.cc","stdcall"}, 
+  {"func.CertGetStoreProperty.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_Custom_PropertyW.cc","stdcall"}, 
+  {"func.CM_Get_HW_Prof_Flags_ExW.cc","stdcall"}, 
+  {"func.WaitForThreadpoolTimerCallbacks.cc","stdcall"}, 
+  {"func.IStream_ReadStr.cc","stdcall"}, 
+  {"func.DragQueryPoint.cc","stdcall"}, 
+  {"func.ProcessGroupPolicyCompleted.cc","stdcall"}, 
+  {"func.CryptSIPCreateIndirectData.cc","stdcall"}, 
+  {"func.CM_Set_DevNode_Problem_Ex.cc","stdcall"}, 
+  {"func.SystemTimeToFileTime.cc","stdcall"}, 
+  {"func.RegLoadMUIStringW.cc","stdcall"}, 
+  {"func.VerLanguageNameW.cc","stdcall"}, 
+  {"func.AddResourceAttributeAce.cc","stdcall"}, 
+  {"func.ldap_delete_extA.cc","cdecl"}, 
+  {"func.getservbyport.cc","stdcall"}, 
+  {"func.DefWindowProcW.cc","stdcall"}, 
+  {"func.QISearch.cc","stdcall"}, 
+  {"func.CertOIDToAlgId.cc","stdcall"}, 
+  {"func.K32EnumDeviceDrivers.cc","stdcall"}, 
+  {"func.GetRawPointerDeviceData.cc","stdcall"}, 
+  {"func.ldap_searchA.cc","cdecl"}, 
+  {"func.SHCreateShellItemArrayFromDataObject.cc","stdcall"}, 
+  {"func.MessageBoxA.cc","stdcall"}, 
+  {"func.GetCommProperties.cc","stdcall"}, 
+  {"func.WSADuplicateSocketW.cc","stdcall"}, 
+  {"func.GetTickCount64.cc","stdcall"}, 
+  {"func.FindFirstChangeNotificationA.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_Property_Keys.cc","stdcall"}, 
+  {"func.SymGetSourceFileToken.cc","stdcall"}, 
+  {"func.CreateIcon.cc","stdcall"}, 
+  {"func.VarUI2FromR8.cc","stdcall"}, 
+  {"func.CreateServiceW.cc","stdcall"}, 
+  {"func.SysAllocStringLen.cc","stdcall"}, 
+  {"func.ber_printf.cc","cdecl"}, 
+  {"func.ToUnicode.cc","stdcall"}, 
+  {"func.SafeArrayGetRecordInfo.cc","stdcall"}, 
+  {"func.CreateIconIndirect.cc","stdcall"}, 
+  {"func.SHRegEnumUSKeyA.cc","stdcall"}, 
+  {"func.CreateAppContainerProfile.cc","stdcall"}, 
+  {"func.SHSendMessageBroadcastW.cc","stdcall"}, 
+  {"func.SymNext.cc","stdcall"}, 
+  {"func.CancelIo.cc","stdcall"}, 
+  {"func.ldap_sslinitA.cc","cdecl"}, 
+  {"func.ClipCursor.cc","stdcall"}, 
+  {"func.GetSystemWow64Directory2W.cc","stdcall"}, 
+  {"func.PathRenameExtensionW.cc","stdcall"}, 
+  {"func.IsBadReadPtr.cc","stdcall"}, 
+  {"func.NCryptEncrypt.cc","stdcall"}, 
+  {"func.GetUserNameW.cc","stdcall"}, 
+  {"type.HENHMETAFILE.size","32"}, 
+  {"func.QueryUmsThreadInformation.cc","stdcall"}, 
+  {"func.GetSystemTime.cc","stdcall"}, 
+  {"func.BCryptCreateContext.cc","stdcall"}, 
+  {"func.GetPointerPenInfo.cc","stdcall"}, 
+  {"func.SetUnhandledExceptionFilter.cc","stdcall"}, 
+  {"func.StrNCatW.cc","stdcall"}, 
+  {"func.GetPrivateProfileSectionA.cc","stdcall"}, 
+  {"func.CreateMDIWindowA.cc","stdcall"}, 
+  {"func.CommConfigDialogA.cc","stdcall"}, 
+  {"func.StartServiceCtrlDispatcherW.cc","stdcall"}, 
+  {"func.K32GetDeviceDriverFileNameA.cc","stdcall"}, 
+  {"func.ldap_parse_page_controlW.cc","cdecl"}, 
+  {"func.DecryptFileW.cc","stdcall"}, 
+  {"func.SubscribeServiceChangeNotifications.cc","stdcall"}, 
+  {"func.SetProtectedPolicy.cc","stdcall"}, 
+  {"func.WaitForInputIdle.cc","stdcall"}, 
+  {"func.GlobalFree.cc","stdcall"}, 
+  {"func.FillRect.cc","stdcall"}, 
+  {"func.PathMakeSystemFolderA.cc","stdcall"}, 
+  {"func.RegDeleteKeyTransactedW.cc","stdcall"}, 
+  {"func.HeapSize.cc","stdcall"}, 
+  {"func.SetClassLongA.cc","stdcall"}, 
+  {"func.CryptSetOIDFunctionValue.cc","stdcall"}, 
+  {"func.PrivateExtractIconsW.cc","stdcall"}, 
+  {"func.FindFirstChangeNotificationW.cc","stdcall"}, 
+  {"func.SetWindowContextHelpId.cc","stdcall"}, 
+  {"func.ldap_close_extended_op.cc","cdecl"}, 
+  {"func.DnsHostnameToComputerNameExW.cc","stdcall"}, 
+  {"func.RtlRestoreContext.cc","cdecl"}, 
+  {"func.PostQueuedCompletionStatus.cc","stdcall"}, 
+  {"func.PathRemoveBackslashW.cc","stdcall"}, 
+  {"func.SHGetNameFromIDList.cc","stdcall"}, 
+  {"func.GetEnvironmentStrings.cc","stdcall"}, 
+  {"func.lstrcatA.cc","stdcall"}, 
+  {"func.OleCreatePictureIndirect.cc","stdcall"}, 
+  {"func.InitializeCriticalSectionEx.cc","stdcall"}, 
+  {"func.LogonUserA.cc","stdcall"}, 
+  {"func.ldap_get_values_len.cc","cdecl"}, 
+  {"func.ExpandEnvironmentStringsA.cc","stdcall"}, 
+  {"func.SymFunctionTableAccess.cc","stdcall"}, 
+  {"func.TlsSetValue.cc","stdcall"}, 
+  {"func.PowerReadDCValue.cc","stdcall"}, 
+  {"func.CopyCursor.cc","stdcall"}, 
+  {"func.OpenThreadToken.cc","stdcall"}, 
+  {"func.ldap_search.cc","cdecl"}, 
+  {"func.WSAEnumNameSpaceProvidersW.cc","stdcall"}, 
+  {"func.SymGetModuleInfoW64.cc","stdcall"}, 
+  {"func.GetEnabledXStateFeatures.cc","stdcall"}, 
+  {"func.GetLogicalProcessorInformationEx.cc","stdcall"}, 
+  {"func.InitCommonControls.cc","stdcall"}, 
+  {"func.GetClassLongPtrA.cc","stdcall"}, 
+  {"func.ldap_next_attribute.cc","cdecl"}, 
+  {"func.SHCreateItemWithParent.cc","stdcall"}, 
+  {"func.DecryptFileA.cc","stdcall"}, 
+  {"func.SystemTimeToTzSpecificLocalTimeEx.cc","stdcall"}, 
+  {"func._lclose.cc","stdcall"}, 
+  {"func.ToAscii.cc","stdcall"}, 
+  {"func.SetThreadExecutionState.cc","stdcall"}, 
+  {"func.VarFormatFromTokens.cc","stdcall"}, 
+  {"func.ReplaceFileW.cc","stdcall"}, 
+  {"func.GetOsManufacturingMode.cc","stdcall"}, 
+  {"func.CryptDuplicateKey.cc","stdcall"}, 
+  {"func.RaiseCustomSystemEventTrigger.cc","stdcall"}, 
+  {"func.CoSuspendClassObjects.cc","stdcall"}, 
+  {"func.DragObject.cc","stdcall"}, 
+  {"func.ScrollConsoleScreenBufferA.cc","stdcall"}, 
+  {"func.CreateNamedPipeW.cc","stdcall"}, 
+  {"func.VarUI2FromDate.cc","stdcall"}, 
+  {"func.GetPwrCapabilities.cc","stdcall"}, 
+  {"func.WinHttpFreeProxySettings.cc","stdcall"}, 
+  {"func.NCryptSetProperty.cc","stdcall"}, 
+  {"func.SymGetSymbolFileW.cc","stdcall"}, 
+  {"func.AccessCheckByTypeResultList.cc","stdcall"}, 
+  {"func.SymGetSourceFileFromToken.cc","stdcall"}, 
+  {"func.GetSystemDirectoryA.cc","stdcall"}, 
+  {"func.GetPointerFrameTouchInfo.cc","stdcall"}, 
+  {"func.ldap_first_reference.cc","cdecl"}, 
+  {"func.SHUnlockShared.cc","stdcall"}, 
+  {"func.ldap_modify_s.cc","cdecl"}, 
+  {"func.GetUnpredictedMessagePos.cc","stdcall"}, 
+  {"func.CredReadDomainCredentialsW.cc","stdcall"}, 
+  {"func.RegisterTraceGuidsA.cc","stdcall"}, 
+  {"func.VarBoolFromDec.cc","stdcall"}, 
+  {"func.SetXStateFeaturesMask.cc","stdcall"}, 
+  {"func.ConvertStringSidToSidW.cc","stdcall"}, 
+  {"func.VarI8FromBool.cc","stdcall"}, 
+  {"func.GetStringTypeExW.cc","stdcall"}, 
+  {"func.ExpandEnvironmentStringsW.cc","stdcall"}, 
+  {"func.CryptSignHashW.cc","stdcall"}, 
+  {"func.GetWindowDpiAwarenessContext.cc","stdcall"}, 
+  {"func.StrCpyNW.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_Status_Ex.cc","stdcall"}, 
+  {"func.GlobalMemoryStatusEx.cc","stdcall"}, 
+  {"func.AddDllDirectory.cc","stdcall"}, 
+  {"func.DrawTextExW.cc","stdcall"}, 
+  {"func.WSACleanup.cc","stdcall"}, 
+  {"func.ldap_ufn2dn.cc","cdecl"}, 
+  {"func.CryptMemRealloc.cc","stdcall"}, 
+  {"func.GetSystemDefaultLangID.cc","stdcall"}, 
+  {"func.SetCompressorInformation.cc","stdcall"}, 
+  {"func.CreateTraceInstanceId.cc","stdcall"}, 
+  {"func.CertCreateCTLContext.cc","stdcall"}, 
+  {"func.ScrollDC.cc","stdcall"}, 
+  {"func.QueryThreadpoolStackInformation.cc","stdcall"}, 
+  {"func.CM_Enumerate_Classes_Ex.cc","stdcall"}, 
+  {"func.CryptStringToBinaryW.cc","stdcall"}, 
+  {"func.CertUnregisterSystemStore.cc","stdcall"}, 
+  {"func.ReplaceFileA.cc","stdcall"}, 
+  {"func.PathIsDirectoryW.cc","stdcall"}, 
+  {"func.SafeArrayCreate.cc","stdcall"}, 
+  {"func.AreDpiAwarenessContextsEqual.cc","stdcall"}, 
+  {"func.BackupSeek.cc","stdcall"}, 
+  {"func.SHGetNewLinkInfoW.cc","stdcall"}, 
+  {"func.ConvertDefaultLocale.cc","stdcall"}, 
+  {"func.VarI1FromR4.cc","stdcall"}, 
+  {"func.CreateProfile.cc","stdcall"}, 
+  {"func.PathCombineA.cc","stdcall"}, 
+  {"func.LocalFlags.cc","stdcall"}, 
+  {"func.ldap_search_s.cc","cdecl"}, 
+  {"func.ldap_parse_extended_resultA.cc","cdecl"}, 
+  {"func.IsProcessDPIAware.cc","stdcall"}, 
+  {"func.CharUpperBuffA.cc","stdcall"}, 
+  {"func.IsDBCSLeadByteEx.cc","stdcall"}, 
+  {"type.INT_PTR.size","32"}, 
+  {"func.GetPointerFrameTouchInfoHistory.cc","stdcall"}, 
+  {"func.CryptSIPGetSignedDataMsg.cc","stdcall"}, 
+  {"func.GetEffectiveClientRect.cc","stdcall"}, 
+  {"func.inet_ntoa.cc","stdcall"}, 
+  {"func.StrFormatByteSize64A.cc","stdcall"}, 
+  {"func.CreateMemoryResourceNotification.cc","stdcall"}, 
+  {"func.OpenMutexA.cc","stdcall"}, 
+  {"func.UrlCompareA.cc","stdcall"}, 
+  {"func.VariantTimeToDosDateTime.cc","stdcall"}, 
+  {"func.AppendMenuA.cc","stdcall"}, 
+  {"func.DispatchMessageW.cc","stdcall"}, 
+  {"func.PathMatchSpecA.cc","stdcall"}, 
+  {"func.GetDiskFreeSpaceW.cc","stdcall"}, 
+  {"func.ObjectOpenAuditAlarmA.cc","stdcall"}, 
+  {"func.CertGetIntendedKeyUsage.cc","stdcall"}, 
+  {"func.CryptGetUserKey.cc","stdcall"}, 
+  {"func.htons.cc","stdcall"}, 
+  {"func.PathAddExtensionA.cc","stdcall"}, 
+  {"func.CreateFileTransactedA.cc","stdcall"}, 
+  {"func.Wow64GetThreadContext.cc","stdcall"}, 
+  {"func.StrStrIA.cc","stdcall"}, 
+  {"func.DefineDosDeviceA.cc","stdcall"}, 
+  {"func.CryptEnumKeyIdentifierProperties.cc","stdcall"}, 
+  {"func.DlgDirListComboBoxW.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_List_SizeA.cc","stdcall"}, 
+  {"func.StrFormatByteSizeEx.cc","stdcall"}, 
+  {"func.GetFullPathNameA.cc","stdcall"}, 
+  {"func.SystemParametersInfoA.cc","stdcall"}, 
+  {"func.SetTimer.cc","stdcall"}, 
+  {"func.RegSetValueA.cc","stdcall"}, 
+  {"func.GetSystemDpiForProcess.cc","stdcall"}, 
+  {"func.SHRegWriteUSValueW.cc","stdcall"}, 
+  {"func.ldap_parse_extended_resultW.cc","cdecl"}, 
+  {"func.StrChrNW.cc","stdcall"}, 
+  {"func.GetAncestor.cc","stdcall"}, 
+  {"func.CreateAcceleratorTableW.cc","stdcall"}, 
+  {"func.SetVolumeLabelA.cc","stdcall"}, 
+  {"func.VarI1FromUI4.cc","stdcall"}, 
+  {"func.DnsHostnameToComputerNameA.cc","stdcall"}, 
+  {"func.GetQueuedCompletionStatusEx.cc","stdcall"}, 
+  {"func.SHRegGetValueFromHKCUHKLM.cc","stdcall"}, 
+  {"func.LoadCursorA.cc","stdcall"}, 
+  {"func.ldap_create_sort_controlW.cc","cdecl"}, 
+  {"func.CredUIPromptForWindowsCredentialsA.cc","stdcall"}, 
+  {"func.CM_Get_Depth.cc","stdcall"}, 
+  {"func.GetSecurityDescriptorGroup.cc","stdcall"}, 
+  {"func.K32EmptyWorkingSet.cc","stdcall"}, 
+  {"func.AcquireSRWLockShared.cc","stdcall"}, 
+  {"func.DeleteFileA.cc","stdcall"}, 
+  {"func.SetMenuItemBitmaps.cc","stdcall"}, 
+  {"func.SymFunctionTableAccess64.cc","stdcall"}, 
+  {"func.CoCreateGuid.cc","stdcall"}, 
+  {"func.QueryFullProcessImageNameA.cc","stdcall"}, 
+  {"func.CredEnumerateA.cc","stdcall"}, 
+  {"func.ExtractAssociatedIconExW.cc","stdcall"}, 
+  {"func.LdapUnicodeToUTF8.cc","cdecl"}, 
+  {"func.CertFreeCertificateContext.cc","stdcall"}, 
+  {"func.GetNamedPipeClientComputerNameW.cc","stdcall"}, 
+  {"func.SetFirmwareEnvironmentVariableExW.cc","stdcall"}, 
+  {"func.GetSystemFileCacheSize.cc","stdcall"}, 
+  {"func.CryptEncrypt.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_Alias_ExA.cc","stdcall"}, 
+  {"func.EnumDesktopsA.cc","stdcall"}, 
+  {"func.FlashWindowEx.cc","stdcall"}, 
+  {"func.TranslateMDISysAccel.cc","stdcall"}, 
+  {"func.SetInformationJobObject.cc","stdcall"}, 
+  {"func.CoMarshalInterThreadInterfaceInStream.cc","stdcall"}, 
+  {"func.VarBoolFromI2.cc","stdcall"}, 
+  {"func.ActivateActCtx.cc","stdcall"}, 
+  {"func.SymSrvGetFileIndexesW.cc","stdcall"}, 
+  {"func.DragQueryFileA.cc","stdcall"}, 
+  {"func.IsWow64Process.cc","stdcall"}, 
+  {"func.WSASocketW.cc","stdcall"}, 
+  {"func.UnregisterHotKey.cc","stdcall"}, 
+  {"func.QuerySecurityAccessMask.cc","stdcall"}, 
+  {"func.ShutdownBlockReasonDestroy.cc","stdcall"}, 
+  {"func.PathCchSkipRoot.cc","stdcall"}, 
+  {"func.CredUnPackAuthenticationBufferW.cc","stdcall"}, 
+  {"func.LockFileEx.cc","stdcall"}, 
+  {"func.SHRegGetUSValueA.cc","stdcall"}, 
+  {"func.PathRemoveBlanksW.cc","stdcall"}, 
+  {"func.GlobalFindAtomA.cc","stdcall"}, 
+  {"func.IsCharUpperW.cc","stdcall"}, 
+  {"func.VarBoolFromI1.cc","stdcall"}, 
+  {"func.CreateWindowStationW.cc","stdcall"}, 
+  {"func.CredUIPromptForWindowsCredentialsW.cc","stdcall"}, 
+  {"func.GetWindowDC.cc","stdcall"}, 
+  {"func.GetParent.cc","stdcall"}, 
+  {"func.VarI8FromR4.cc","stdcall"}, 
+  {"func.DequeueUmsCompletionListItems.cc","stdcall"}, 
+  {"func.GetThreadErrorMode.cc","stdcall"}, 
+  {"func.CallMsgFilterW.cc","stdcall"}, 
+  {"func.ShowScrollBar.cc","stdcall"}, 
+  {"func.LookupIconIdFromDirectory.cc","stdcall"}, 
+  {"func.EnumResourceTypesW.cc","stdcall"}, 
+  {"func.FlatSB_GetScrollPos.cc","stdcall"}, 
+  {"func.WinHttpGetProxyForUrlEx.cc","stdcall"}, 
+  {"func.GetCurrencyFormatA.cc","stdcall"}, 
+  {"func.ExtractAssociatedIconExA.cc","stdcall"}, 
+  {"func.VarBstrCat.cc","stdcall"}, 
+  {"func.WriteConsoleOutputAttribute.cc","stdcall"}, 
+  {"func.EnumLanguageGroupLocalesA.cc","stdcall"}, 
+  {"func.NCryptStreamOpenToProtect.cc","stdcall"}, 
+  {"func.CreateDataCache.cc","stdcall"}, 
+  {"func.ldap_openA.cc","cdecl"}, 
+  {"func.CM_Get_Device_ID_List_ExW.cc","stdcall"}, 
+  {"func.WPUGetProviderPath.cc","stdcall"}, 
+  {"func.EnumDisplaySettingsW.cc","stdcall"}, 
+  {"func.K32GetWsChanges.cc","stdcall"}, 
+  {"func.OpenServiceW.cc","stdcall"}, 
+  {"func.CertDeleteCRLFromStore.cc","stdcall"}, 
+  {"func.CallNtPowerInformation.cc","stdcall"}, 
+  {"func.GetCurrentThreadId.cc","stdcall"}, 
+  {"func.SHRegGetPathA.cc","stdcall"}, 
+  {"func.ldap_get_option.cc","cdecl"}, 
+  {"func.CreateSemaphoreW.cc","stdcall"}, 
+  {"func.CryptExportPublicKeyInfoEx.cc","stdcall"}, 
+  {"func.DragQueryFileW.cc","stdcall"}, 
+  {"func.SetFileAttributesTransactedW.cc","stdcall"}, 
+  {"func.WPUPostMessage.cc","stdcall"}, 
+  {"func.EnumDisplayDevicesA.cc","stdcall"}, 
+  {"func.ldap_search_ext_s.cc","cdecl"}, 
+  {"func.DestroyIcon.cc","stdcall"}, 
+  {"func.RegQueryValueExW.cc","stdcall"}, 
+  {"func.OpenBackupEventLogA.cc","stdcall"}, 
+  {"func.SetMailslotInfo.cc","stdcall"}, 
+  {"func.ConnectToConnectionPoint.cc","stdcall"}, 
+  {"func.K32GetProcessImageFileNameW.cc","stdcall"}, 
+  {"func.CryptProtectMemory.cc","stdcall"}, 
+  {"func.CallWindowProcA.cc","stdcall"}, 
+  {"func.MessageBeep.cc","stdcall"}, 
+  {"func.BCryptImportKeyPair.cc","stdcall"}, 
+  {"func.CreateSymbolicLinkTransactedW.cc","stdcall"}, 
+  {"func.VarFormatNumber.cc","stdcall"}, 
+  {"func.SymDeleteSymbol.cc","stdcall"}, 
+  {"func.GetModuleFileNameA.cc","stdcall"}, 
+  {"func.SetTokenInformation.cc","stdcall"}, 
+  {"func.DrawIconEx.cc","stdcall"}, 
+  {"func.FreeUserPhysicalPages.cc","stdcall"}, 
+  {"func._lread.cc","stdcall"}, 
+  {"func.FindVolumeMountPointClose.cc","stdcall"}, 
+  {"func.NCryptProtectSecret.cc","stdcall"}, 
+  {"func.RequestWakeupLatency.cc","stdcall"}, 
+  {"func.GetPhysicallyInstalledSystemMemory.cc","stdcall"}, 
+  {"func.ldap_search_sW.cc","cdecl"}, 
+  {"type.HBRUSH.size","32"}, 
+  {"func.CertVerifyCertificateChainPolicy.cc","stdcall"}, 
+  {"func.GetCalendarInfoEx.cc","stdcall"}, 
+  {"func.CertVerifyTimeValidity.cc","stdcall"}, 
+  {"func.CM_Get_Class_Key_Name_ExW.cc","stdcall"}, 
+  {"func.CertGetCRLFromStore.cc","stdcall"}, 
+  {"func.CoRegisterMallocSpy.cc","stdcall"}, 
+  {"func.CLSIDFromProgIDEx.cc","stdcall"}, 
+  {"func.SetFileApisToANSI.cc","stdcall"}, 
+  {"func.DrawInsert.cc","stdcall"}, 
+  {"func.SymAddSourceStreamW.cc","stdcall"}, 
+  {"func.VerifyVersionInfoW.cc","stdcall"}, 
+  {"func.GetIconInfoExA.cc","stdcall"}, 
+  {"func.WinHttpDetectAutoProxyConfigUrl.cc","stdcall"}, 
+  {"func.BCryptEnumAlgorithms.cc","stdcall"}, 
+  {"func.NormalizeString.cc","stdcall"}, 
+  {"func.InflateRect.cc","stdcall"}, 
+  {"func.GetProcessVersion.cc","stdcall"}, 
+  {"func.GetVersion.cc","stdcall"}, 
+  {"func.WSAAsyncGetProtoByName.cc","stdcall"}, 
+  {"func.GetEnvironmentVariableA.cc","stdcall"}, 
+  {"func.UnregisterDeviceNotification.cc","stdcall"}, 
+  {"func.CryptEncryptMessage.cc","stdcall"}, 
+  {"func.SymFindDebugInfoFileW.cc","stdcall"}, 
+  {"func.GlobalMemoryStatus.cc","stdcall"}, 
+  {"func.ldap_modify.cc","cdecl"}, 
+  {"func.GetScrollInfo.cc","stdcall"}, 
+  {"func.GetNumaAvailableMemoryNodeEx.cc","stdcall"}, 
+  {"func.FreeLibrary.cc","stdcall"}, 
+  {"func.SHRegSetPathW.cc","stdcall"}, 
+  {"func.SymGetTypeInfo.cc","stdcall"}, 
+  {"func.SHRegGetValueW.cc","stdcall"}, 
+  {"func.GetPointerFrameInfo.cc","stdcall"}, 
+  {"func.SHRegDeleteUSValueW.cc","stdcall"}, 
+  {"func.IsValidCodePage.cc","stdcall"}, 
+  {"func.PathSearchAndQualifyW.cc","stdcall"}, 
+  {"func.VarDecFromCy.cc","stdcall"}, 
+  {"func.GetCurrencyFormatEx.cc","stdcall"}, 
+  {"func.GetPointerTouchInfoHistory.cc","stdcall"}, 
+  {"func.SetClassWord.cc","stdcall"}, 
+  {"func.SHStrDupA.cc","stdcall"}, 
+  {"func.SetMenuContextHelpId.cc","stdcall"}, 
+  {"func.CM_Set_HW_Prof_FlagsW.cc","stdcall"}, 
+  {"func.PowerUnregisterSuspendResumeNotification.cc","stdcall"}, 
+  {"func.VarCyFromDate.cc","stdcall"}, 
+  {"func.VarNot.cc","stdcall"}, 
+  {"func.CryptSIPPutSignedDataMsg.cc","stdcall"}, 
+  {"func.MiniDumpReadDumpStream.cc","stdcall"}, 
+  {"func.RegisterTypeLib.cc","stdcall"}, 
+  {"func.IsClipboardFormatAvailable.cc","stdcall"}, 
+  {"func.GetFileTime.cc","stdcall"}, 
+  {"func.CM_Get_Device_ID_ListW.cc","stdcall"}, 
+  {"func.ldap_create_page_controlW.cc","cdecl"}, 
+  {"func.VerifyVersionInfoA.cc","stdcall"}, 
+  {"func.TransmitCommChar.cc","stdcall"}, 
+  {"func.PathIsNetworkPathA.cc","stdcall"}, 
+  {"func.CoWaitForMultipleHandles.cc","stdcall"}, 
+  {"func.ClientToScreen.cc","stdcall"}, 
+  {"func.ldap_delete_ext_sA.cc","cdecl"}, 
+  {"func.RegConnectRegistryExA.cc","stdcall"}, 
+  {"func.CoTaskMemAlloc.cc","stdcall"}, 
+  {"func.GetProcessWindowStation.cc","stdcall"}, 
+  {"func.WSASetSocketSecurity.cc","stdcall"}, 
+  {"func.WinHttpWebSocketCompleteUpgrade.cc","stdcall"}, 
+  {"func.MapViewOfFile.cc","stdcall"}, 
+  {"func.VarR4FromI4.cc","stdcall"}, 
+  {"func.SHCreateShellItemArrayFromIDLists.cc","stdcall"}, 
+  {"func.wnsprintfW.cc","cdecl"}, 
+  {"func.SetClassLongPtrA.cc","stdcall"}, 
+  {"func.GetLastInputInfo.cc","stdcall"}, 
+  {"func.SetLayeredWindowAttributes.cc","stdcall"}, 
+  {"func.AccessCheckAndAuditAlarmW.cc","stdcall"}, 
+  {"func.SendMessageW.cc","stdcall"}, 
+  {"func.VarNumFromParseNum.cc","stdcall"}, 
+  {"func.IsWindowVisible.cc","stdcall"}, 
+  {"func.CharNextW.cc","stdcall"}, 
+  {"func.IsCharLowerW.cc","stdcall"}, 
+  {"func.ModifyMenuW.cc","stdcall"}, 
+  {"func.CoDosDateTimeToFileTime.cc","stdcall"}, 
+  {"func.ldap_create_vlv_controlA.cc","cdecl"}, 
+  {"func.VarI1FromBool.cc","stdcall"}, 
+  {"func.SafeArrayAllocDescriptor.cc","stdcall"}, 
+  {"func.GetSecurityDescriptorLength.cc","stdcall"}, 
+  {"func.CreateBoundaryDescriptorA.cc","stdcall"}, 
+  {"func.GetDlgItemTextW.cc","stdcall"}, 
+  {"func.CloseThreadpoolWork.cc","stdcall"}, 
+  {"func.MenuHelp.cc","stdcall"}, 
+  {"func.SHCreateShellItemArrayFromShellItem.cc","stdcall"}, 
+  {"func.FlsAlloc.cc","stdcall"}, 
+  {"func.CreatePrivateObjectSecurityWithMultipleInheritance.cc","stdcall"}, 
+  {"func.ldap_bind_sA.cc","cdecl"}, 
+  {"func.QueryPathOfRegTypeLib.cc","stdcall"}, 
+  {"func.RefreshPolicy.cc","stdcall"}, 
+  {"func.ldap_add_ext_sW.cc","cdecl"}, 
+  {"func.GetSecurityDescriptorControl.cc","stdcall"}, 
+  {"func.SetUserGeoName.cc","stdcall"}, 
+  {"func.SetThreadLocale.cc","stdcall"}, 
+  {"func.WaitForSingleObjectEx.cc","stdcall"}, 
+  {"func.VarR4FromDec.cc","stdcall"}, 
+  {"func.SetThreadPriority.cc","stdcall"}, 
+  {"func.OpenWindowStationW.cc","stdcall"}, 
+  {"func.SymGetLineFromAddrW64.cc","stdcall"}, 
+  {"func.RoGetAgileReference.cc","stdcall"}, 
+  {"func.SetFirmwareEnvironmentVariableExA.cc","stdcall"}, 
+  {"func.GetEventLogInformation.cc","stdcall"}, 
+  {"type.HCONV.size","32"}, 
+  {"func.QueryWorkingSet.cc","stdcall"}, 
+  {"func.GetPointerCursorId.cc","stdcall"}, 
+  {"func.LookupPrivilegeDisplayNameW.cc","stdcall"}, 
+  {"func.DispGetParam.cc","stdcall"}, 
+  {"func.CoGetInterfaceAndReleaseStream.cc","stdcall"}, 
+  {"func.GetPointerFramePenInfoHistory.cc","stdcall"}, 
+  {"func.SystemTimeToVariantTime.cc","stdcall"}, 
+  {"func.CM_Free_Range_List.cc","stdcall"}, 
+  {"func.GetClipboardFormatNameA.cc","stdcall"}, 
+  {"func.LogicalToPhysicalPoint.cc","stdcall"}, 
+  {"func.VarFormatCurrency.cc","stdcall"}, 
+  {"func.VarI2FromI4.cc","stdcall"}, 
+  {"func.SHInvokePrinterCommandA.cc","stdcall"}, 
+  {"func.CallEnclave.cc","stdcall"}, 
+  {"func.StrChrIA.cc","stdcall"}, 
+  {"func.GetThreadLocale.cc","stdcall"}, 
+  {"func.SHCreateProcessAsUserW.cc","stdcall"}, 
+  {"func.VarMonthName.cc","stdcall"}, 
+  {"func.CryptSignMessageWithKey.cc","stdcall"}, 
+  {"func.VarDecAdd.cc","stdcall"}, 
+  {"func.GetClientRect.cc","stdcall"}, 
+  {"func.ModifyMenuA.cc","stdcall"}, 
+  {"func.TryEnterCriticalSection.cc","stdcall"}, 
+  {"func.GetTouchInputInfo.cc","stdcall"}, 
+  {"type.HWINSTA.size","32"}, 
+  {"func.FindAtomA.cc","stdcall"}, 
+  {"func.PeekNamedPipe.cc","stdcall"}, 
+  {"func.CM_Open_Device_Interface_Key_ExA.cc","stdcall"}, 
+  {"func.CM_Reenumerate_DevNode_Ex.cc","stdcall"}, 
+  {"func.GetPerformanceInfo.cc","stdcall"}, 
+  {"func.VarI2FromUI2.cc","stdcall"}, 
+  {"func.GetNamedPipeClientSessionId.cc","stdcall"}, 
+  {"func.StrCpyW.cc","stdcall"}, 
+  {"func.CM_Get_DevNode_Custom_Property_ExW.cc","stdcall"}, 
+  {"func.SHGetDiskFreeSpaceExW.cc","stdcall"}, 
+  {"func.CredUnprotectW.cc","stdcall"}, 
+  {"func.ldap_check_filterA.cc","cdecl"}, 
+  {"func.EnumProcessModulesEx.cc","stdcall"}, 
+  {"func.CopyContext.cc","stdcall"}, 
+  {"func.GetTimeZoneInformation.cc","stdcall"}, 
+  {"func.CredDeleteW.cc","stdcall"}, 
+  {"func.WinHttpSetTimeouts.cc","stdcall"}, 
+  {"func.FlatSB_EnableScrollBar.cc","stdcall"}, 
+  {"func.CoQueryAuthenticationServices.cc","stdcall"}, 
+  {"func.OpenWindowStationA.cc","stdcall"}, 
+  {"func.CertFindExtension.cc","stdcall"}, 
+  {"func.GetSystemInfo.cc","stdcall"}, 
+  {"func.GetCapture.cc","stdcall"}, 
+  {"func.WSAConnectByNameA.cc","stdcall"}, 
+  {"func.ldap_first_attributeA.cc","cdecl"}, 
+  {"func.CryptHashSessionKey.cc","stdcall"}, 
+  {"func.SymFromIndexW.cc","stdcall"}, 
+  {"func.GetMenuBarInfo.cc","stdcall"}, 
+  {"func.GetNativeSystemInfo.cc","stdcall"}, 
+  {"func.SymGetLineNext64.cc","stdcall"}, 
+  {"func.SymEnumSymbolsExW.cc","stdcall"}, 
+  {"func.SetConsoleActiveScreenBuffer.cc","stdcall"}, 
+  {"func.CreateMutexExA.cc","stdcall"}, 
+  {"func.AssocCreate.cc","stdcall"}, 
+  {"func.VarDecCmpR8.cc","stdcall"}, 
+  {"func.CM_Is_Dock_Station_Present_Ex.cc","stdcall"}, 
+  {"func.EnumDisplayDevicesW.cc","stdcall"}, 
+  {"func.GetWindowContextHelpId.cc","stdcall"}, 
+  {"func.EnumDesktopWindows.cc","stdcall"}, 
+  {"func.VarI1FromI4.cc","stdcall"}, 
+  {"func.VarDecMul.cc","stdcall"}, 
+  {"func.WSAGetLastError.cc","stdcall"}, 
+  {"func.CoMarshalHresult.cc","stdcall"}, 
+  {"func.VarDecFromUI2.cc","stdcall"}, 
+  {"func.CreateDecompressor.cc","stdcall"}, 
+  {"func.QueryIdleProcessorCycleTimeEx.cc","stdcall"}, 
+  {"func.NCryptStreamOpenToUnprotect.cc","stdcall"}, 
+  {"func.BCryptDuplicateHash.cc","stdcall"}, 
+  {"func.NeedCurrentDirectoryForExePathA.cc","stdcall"}, 
+  {"func.TraceMessage.cc","stdcall"}, 
+  {"func.CreatePointerMoniker.cc","stdcall"}, 
+  {"func.SHRegGetBoolUSValueW.cc","stdcall"}, 
+  {"func.ReleaseActCtx.cc","stdcall"}, 
+  {"func.ReadConsoleOutputAttribute.cc","stdcall"}, 
+  {"func.K32GetModuleBaseNameW.cc","stdcall"}, 
+  {"func.VarDateFromUI2.cc","stdcall"}, 
+  {"func.FindActCtxSectionGuid.cc","stdcall"}, 
+  {"func.CoGetSystemSecurityPermissions.cc","stdcall"}, 
+  {"func.GetProcessWorkingSetSizeEx.cc","stdcall"}, 
+  {"func.GetTimeFormatW.cc","stdcall"}, 
+  {"func.ldap_modrdn_s.cc","cdecl"}, 
+  {"func.IsCharAlphaNumericW.cc","stdcall"}, 
+  {"func.SymSrvStoreFileW.cc","stdcall"}, 
+  {"func.VarCyFromR8.cc","stdcall"}, 
+  {"func.PathRelativePathToA.cc","stdcall"}, 
+  {"func.SetLocaleInfoA.cc","stdcall"}, 
+  {"func.ldap_simple_bindW.cc","cdecl"}, 
+  {"func.MapUserPhysicalPages.cc","stdcall"}, 
+  {"func.VarDecNeg.cc","stdcall"}, 
+  {"func.EnumResourceNamesW.cc","stdcall"}, 
+  {"func.WPUModifyIFSHandle.cc","stdcall"}, 
+  {"func.DragAcceptFiles.cc","stdcall"}, 
+  {"func.ReleaseSemaphoreWhenCallbackReturns.cc","stdcall"}, 
+  {"func.CertAddCTLLinkToStore.cc","stdcall"}, 
+  {"func.OleLoadPictureEx.cc","stdcall"}, 
+  {"func.VarR4FromR8.cc","stdcall"}, 
+  {"func.GetClassInfoW.cc","stdcall"}, 
+  {"func.AllocateLocallyUniqueId.cc","stdcall"}, 
+  {"func.VarUI4FromI8.cc","stdcall"}, 
+  {"func.WSCDeinstallProvider.cc","stdcall"}, 
+  {"func.CoIsHandlerConnected.cc","stdcall"}, 
+  {"func.WSANtohl.cc","stdcall"}, 
+  {"func.SetScrollInfo.cc","stdcall"}, 
+  {"func.FindClose.cc","stdcall"}, 
+  {"func.ImageList_BeginDrag.cc","stdcall"}, 
+  {"func.RegEnumKeyA.cc","stdcall"}, 
+  {"func.HeapReAlloc.cc","stdcall"}, 
+  {"func.PathRemoveFileSpecA.cc","stdcall"}, 
+  {"func.UpdateTraceW.cc","stdcall"}, 
+  {"func.CredGetTargetInfoA.cc","stdcall"}, 
+  {"func.SymGetSourceVarFromTokenW.cc","stdcall"}, 
+  {"func.CredUnmarshalCredentialW.cc","stdcall"}, 
+  {"func.RegisterClipboardFormatW.cc","stdcall"}, 
+  {"func.AdjustTokenPrivileges.cc","stdcall"}, 
+  {"func.IsValidAcl.cc","stdcall"}, 
+  {"func.VarMul.cc","stdcall"}, 
+  {"func.RegDeleteKeyA.cc","stdcall"}, 
+  {"func.LoadIconWithScaleDown.cc","stdcall"}, 
+  {"func.EnumPropsExA.cc","stdcall"}, 
+  {"func.GetMailslotInfo.cc","stdcall"}, 
+  {"func.FindWindowA.cc","stdcall"}, 
+  {"func.WinHttpConnect.cc","stdcall"}, 
+  {"func.CryptVerifyCertificateSignatureEx.cc","stdcall"}, 
+  {"func.FlatSB_SetScrollProp.cc","stdcall"}, 
+  {"func.CM_Set_DevNode_Registry_Property_ExW.cc","stdcall"}, 
+  {"func.K32EnumProcesses.cc","stdcall"}, 
+  {"func.LockWindowUpdate.cc","stdcall"}, 
+  {"func.ChangeTimerQueueTimer.cc","stdcall"}, 
+  {"func.SetMessageWaitingIndicator.cc","stdcall"}, 
+  {"func.CryptSignAndEncryptMessage.cc","stdcall"}, 
+  {"func.PrivilegeCheck.cc","stdcall"}, 
+  {"func.VarCyNeg.cc","stdcall"}, 
+  {"func.GetLongPathNameW.cc","stdcall"}, 
+  {"func.GetUserObjectSecurity.cc","stdcall"}, 
+  {"func.SuspendThread.cc","stdcall"}, 
+  {"func.GetNamedPipeServerSessionId.cc","stdcall"}, 
+  {"func.SetSymLoadError.cc","stdcall"}, 
+  {"func.CM_Delete_DevNode_Key.cc","stdcall"}, 
+  {"func.PeekMessageA.cc","stdcall"}, 
+  {"func.VarNeg.cc","stdcall"}, 
+  {"type.HDDEDATA.size","32"}, 
+  {"func.FileEncryptionStatusA.cc","stdcall"}, 
+  {"func.FillConsoleOutputCharacterW.cc","stdcall"}, 
+  {"func.ChildWindowFromPoint.cc","stdcall"}, 
+  {"func.VarCyFromI8.cc","stdcall"}, 
+  {"func.CreateSemaphoreExW.cc","stdcall"}, 
+  {"func.ConvertSecurityDescriptorToStringSecurityDescriptorW.cc","stdcall"}, 
+  {"func.StrToIntW.cc","stdcall"}, 
+  {"func.HeapCreate.cc","stdcall"}, 
+  {"func.SymSetSearchPathW.cc","stdcall"}, 
+  {"func.FindFirstFileNameTransactedW.cc","stdcall"}, 
+  {"func.GetSymLoadError.cc","stdcall"}, 
+  {"func.AddAccessAllowedAce.cc","stdcall"}, 
+  {"func.CryptUnregisterOIDInfo.cc","stdcall"}, 
+  {"func.RegEnumKeyW.cc","stdcall"}, 
+  {"func.CoIsOle1Class.cc","stdcall"}, 
+  {"func.SetThreadpoolThreadMinimum.cc","stdcall"}, 
+  {"func.SymSrvGetFileIndexInfoW.cc","stdcall"}, 
+  {"func.RsopResetPolicySettingStatus.cc","stdcall"}, 
+  {"func.CopyFileTransactedW.cc","stdcall"}, 
+  {"func.FlushProcessWriteBuffers.cc","stdcall"}, 
+  {"func.ldap_next_entry.cc","cdecl"}, 
+  {"func.PathIsLFNFileSpecA.cc","stdcall"}, 
+  {"func.LHashValOfNameSysA.cc","stdcall"}, 
+  {"func.VarR8FromDisp.cc","stdcall"}, 
+  {"func.ReadEventLogA.cc","stdcall"}, 
+  {"func.SetFileShortNameA.cc","stdcall"}, 
+  {"func.EnumCalendarInfoA.cc","stdcall"}, 
+  {"func.IUnknown_GetWindow.cc","stdcall"}, 
+  {"func.SetForegroundWindow.cc","stdcall"}, 
+  {"func.CM_Set_DevNode_Registry_Property_ExA.cc","stdcall"}, 
+  {"func.StgGetIFillLockBytesOnFile.cc","stdcall"}, 
+  {"func.CryptExportPublicKeyInfo.cc","stdcall"}, 
+  {"func.GetActiveProcessorGroupCount.cc","stdcall"}, 
+  {"func.EnableMouseInPointer.cc","stdcall"}, 
+  {"func.htonll.cc","stdcall"}, 
+  {"func.LoadModule.cc","stdcall"}, 
+  {"func.DeleteAce.cc","stdcall"}, 
+  {"func.FindExecutableImageEx.cc","stdcall"}, 
+  {"func.ldap_extended_operation_sA.cc","cdecl"}, 
+  {"func.BroadcastSystemMessageW.cc","stdcall"}, 
+  {"func.GetLogicalDrives.cc","stdcall"}, 
+  {"type.HWND.size","32"}, 
+  {"func.IUnknown_SetSite.cc","stdcall"}, 
+  {"func.EnumDateFormatsA.cc","stdcall"}, 
+  {"func.EventUnregister.cc","stdcall"}, 
+  {"func.DllInstall.cc","stdcall"}, 
+  {"func.PathCchCombineEx.cc","stdcall"}, 
+  {"func.NCryptEnumStorageProviders.cc","stdcall"}, 
+  {"func.SetMessageExtraInfo.cc","stdcall"}, 
+  {"func.ldap_parse_resultW.cc","cdecl"}, 
+  {"func.SHSetLocalizedName.cc","stdcall"}, 
+  {"func.GetConsoleCursorInfo.cc","stdcall"}, 
+  {"func.MapViewOfFile3FromApp.cc","stdcall"}, 
+  {"func.FileEncryptionStatusW.cc","stdcall"}, 
+  {"func.UnlockFile.cc","stdcall"}, 
+  {"func.StrChrW.cc","stdcall"}, 
+  {"func.StartThreadpoolIo.cc","stdcall"}, 
+  {"func.CertFindCTLInStore.cc","stdcall"}, 
+  {"func.CreateSemaphoreExA.cc","stdcall"}, 
+  {"func.wnsprintfA.cc","cdecl"}, 
+  {"func.RtlDeleteFunctionTable.cc","cdecl"}, 
+  {"func.SetDllDirectoryW.cc","stdcall"}, 
+  {"func.LookupAccountSidLocalA.cc","stdcall"}, 
+  {"func.ldap_modrdnA.cc","cdecl"}, 
+  {"func.CryptUninstallCancelRetrieval.cc","stdcall"}, 
+  {"func.FindFirstVolumeW.cc","stdcall"}, 
+  {"func.Wow64GetThreadSelectorEntry.cc","stdcall"}, 
+  {"func.SHAutoComplete.cc","stdcall"}, 
+  {"func.FreeAddrInfoEx.cc","stdcall"}, 
+  {"func.SetDlgItemTextA.cc","stdcall"}, 
+  {"func.OpenFileById.cc","stdcall"}, 
+  {"func.CoRevokeMallocSpy.cc","stdcall"}, 
+  {"func.VarUI1FromI4.cc","stdcall"}, 
+  {"func.EventActivityIdControl.cc","stdcall"}, 
+  {"func.VarI4FromDate.cc","stdcall"}, 
+  {"func.AddIntegrityLabelToBoundaryDescriptor.cc","stdcall"}, 
+  {"func.RegisterTypeLibForUser.cc","stdcall"}, 
+  {"func.SetThreadPreferredUILanguages.cc","stdcall"}, 
+  {"func.CoUninitialize.cc","stdcall"}, 
+  {"func.GetShellWindow.cc","stdcall"}, 
+  {"func.GetThreadDescription.cc","stdcall"}, 
+  {"func.CreateProcessW.cc","stdcall"}, 
+  {"func.VarInt.cc","stdcall"}, 
+  {"func.CryptDecrypt.cc","stdcall"}, 
+  {"func.RemoveDirectoryTransactedA.cc","stdcall"}, 
+  {"func.GetUserNameA.cc","stdcall"}, 
+  {"func.RegCreateKeyExA.cc","stdcall"}, 
+  {"func.ReleaseMutexWhenCallbackReturns.cc","stdcall"}, 
+  {"func.SetRect.cc","stdcall"}, 
+  {"func.ldap_compareA.cc","cdecl"}, 
+  {"func.CreateEventW.cc","stdcall"}, 
+  {"func.ldap_bind_sW.cc","cdecl"}, 
+  {"func.UrlHashA.cc","stdcall"}, 
+  {"func.SymLoadModule64.cc","stdcall"}, 
+  {"func.PathGetCharTypeA.cc","stdcall"}, 
+  {"func.ldap_add_ext_sA.cc","cdecl"}, 
+  {"func.GetProcessDEPPolicy.cc","stdcall"}, 
+  {"func.CertVerifyCTLUsage.cc","stdcall"}, 
+  {"func.AddRefActCtx.cc","stdcall"}, 
+  {"func.CryptSIPVerifyIndirectData.cc","stdcall"}, 
+  {"func.GetRawInputData.cc","stdcall"}, 
+  {"func.GetCurrentThread.cc","stdcall"}, 
+  {"func.SwitchToThisWindow.cc","stdcall"}, 
+  {"func.GetDllDirectoryW.cc","stdcall"}, 
+  {"func.FindExecutableImageExW.cc","stdcall"}, 
+  {"func.CM_Register_Device_InterfaceW.cc","stdcall"}, 
+  {"func.SwitchToThread.cc","stdcall"}, 
+  {"func.RtlUnwindEx.cc","stdcall"}, 
+  {"func.RegDisablePredefinedCacheEx.cc","stdcall"}, 
+  {"func.SetupComm.cc","stdcall"}, 
+  {"func.SHInvokePrinterCommandW.cc","stdcall"}, 
+  {"func.CryptInstallCancelRetrieval.cc","stdcall"}, 
+  {"func.TerminateEnclave.cc","stdcall"}, 
+  {"func.GetSystemDefaultLCID.cc","stdcall"}, 
+  {"func.FlsFree.cc","stdcall"}, 
+  {"func.WinHttpGetProxyResult.cc","stdcall"}, 
+  {"func.ldap_unbind.cc","cdecl"}, 
+  {"func.CryptSetProviderA.cc","stdcall"}, 
+  {"func.WTSGetServiceSessionId.cc","stdcall"}, 
+  {"func.GetKeyboardLayoutNameW.cc","stdcall"}, 
+  {"func.CreateFileA.cc","stdcall"}, 
+  {"func.GetCurrentProcessorNumber.cc","stdcall"}, 
+  {"func.StrCatW.cc","stdcall"}, 
+  {"func.ShowCaret.cc","stdcall"}, 
+  {"func.CredFindBestCredentialA.cc","stdcall"}, 
+  {"func.CLSIDFromString.cc","stdcall"}, 
+  {"func.QueryTraceW.cc","stdcall"}, 
+  {"func.WinHttpCheckPlatform.cc","stdcall"}, 
+  {"func.BroadcastSystemMessageExW.cc","stdcall"}, 
+  {"func.RegSetKeySecurity.cc","stdcall"}, 
+  {"func.DrawStatusTextW.cc","stdcall"}, 
+  {"func.SetThreadpoolStackInformation.cc","stdcall"}, 
+  {"func.VarUI2FromDec.cc","stdcall"}, 
+  {"func.GetWindowLongPtrA.cc","stdcall"}, 
+  {"func.CertSelectCertificateChains.cc","stdcall"}, 
+  {"func.VarRound.cc","stdcall"}, 
+  {"func._lwrite.cc","stdcall"}, 
+  {"func.WSAAsyncGetHostByName.cc","stdcall"}, 
+  {"func.SHGetDiskFreeSpaceExA.cc","stdcall"}, 
+  {"func.CharLowerBuffW.cc","stdcall"}, 
+  {"func.CryptHashPublicKeyInfo.cc","stdcall"}, 
+  {"func.GetClassLongA.cc","stdcall"}, 
+  {"func.ImpersonateAnonymousToken.cc","stdcall"}, 
+  {"func.GetUpdateRgn.cc","stdcall"}, 
+  {"func.InitCommonControlsEx.cc","stdcall"}, 
+  {"func.SHRegDeleteEmptyUSKeyA.cc","stdcall"}, 
+  {"func.CryptRegisterOIDInfo.cc","stdcall"}, 
+  {"func.SetThreadContext.cc","stdcall"}, 
+  {"func.UpdateWindow.cc","stdcall"}, 
+  {"func.UserHandleGrantAccess.cc","stdcall"}, 
+  {"func.GetProcessHandleCount.cc","stdcall"}, 
+  {"func.CertIsRDNAttrsInCertificateName.cc","stdcall"}, 
+  {"func.StrDupA.cc","stdcall"}, 
+  {"func.CredMarshalCredentialA.cc","stdcall"}, 
+  {"func.ReplacePartitionUnit.cc","stdcall"}, 
+  {"func.ChrCmpIA.cc","stdcall"}, 
+  {"func.DrawTextA.cc","stdcall"}, 
+  {"func.GetMenuStringA.cc","stdcall"}, 
+  {"type.HLOCAL.size","32"}, 
+  {"func.EndUpdateResourceA.cc","stdcall"}, 
+  {"func.QueryTraceA.cc","stdcall"}, 
+  {"func.LookupPrivilegeValueA.cc","stdcall"}, 
+  {"func.StrCmpNW.cc","stdcall"}, 
+  {"func.SetCommBreak.cc","stdcall"}, 
+  {"func.InsertMenuItemW.cc","stdcall"}, 
+  {"func.GlobalAlloc.cc","stdcall"}, 
+  {"func.K32GetModuleBaseNameA.cc","stdcall"}, 
+  {"func.SetConsoleMode.cc","stdcall"}, 
+  {"func.OpenCommPort.cc","stdcall"}, 
+  {"func.PathSetDlgItemPathW.cc","stdcall"}, 
+  {"func.LocalShrink.cc","stdcall"}, 
+  {"func.VarAnd.cc","stdcall"}, 
+  {"func.IsCharAlphaNumericA.cc","stdcall"}, 
+  {"func.SymEnumTypesByNameW.cc","stdcall"}, 
+  {"func.DrawTextExA.cc","stdcall"}, 
+  {"func.StrSpnW.cc","stdcall"}, 
+  {"func.IUnknown_QueryService.cc","stdcall"}, 
+  {"func.GetFirmwareEnvironmentVariableW.cc","stdcall"}, 
+  {"func.ldap_parse_sort_controlW.cc","cdecl"}, 
+  {"func.ExitThread.cc","stdcall"}, 
+  {"func.CharToOemW.cc","stdcall"}, 
+  {"func.GetTraceLoggerHandle.cc","stdcall"}, 
+  {"func.AssocQueryStringByKeyW.cc","stdcall"}, 
+  {"func.PathMakePrettyA.cc","stdcall"}, 
+  {"func.CreateToolbarEx.cc","stdcall"}, 
+  {"func.select.cc","stdcall"}, 
+  {"func.StrDupW.cc","stdcall"}, 
+  {"func.SymSrvDeltaNameW.cc","stdcall"}, 
+  {"func.CM_Enumerate_Enumerators_ExW.cc","stdcall"}, 
+  {"func.VarBstrFromR8.cc","stdcall"}, 
+  {"func.IUnknown_Set.cc","stdcall"}, 
+  {"func.WSAEnumProtocolsW.cc","stdcall"}, 
+  {"func.GetUserObjectInformationA.cc","stdcall"}, 
+  {"func.DrawTextW.cc","stdcall"}, 
+  {"func.RegisterWindowMessageA.cc","stdcall"}, 
+  {"func.PurgeComm.cc","stdcall"}, 
+  {"func.EndUpdateResourceW.cc","stdcall"}, 
+  {"func.GetClassNameW.cc","stdcall"}, 
+  {"func.GetTempFileNameW.cc","stdcall"}, 
+  {"func.GetWindowRgn.cc","stdcall"}, 
+  {"func.CryptEnumProvidersW.cc","stdcall"}, 
+  {"func.PathQuoteSpacesW.cc","stdcall"}, 
+  {"func.OpenJobObjectW.cc","stdcall"}, 
+  {"func.IsImmersiveProcess.cc","stdcall"}, 
+  {"func.cldap_open.cc","cdecl"}, 
+  {"func.GetAwarenessFromDpiAwarenessContext.cc","stdcall"}, 
+  {"func.PathCchRemoveBackslashEx.cc","stdcall"}, 
+  {"func.CreateFileMappingW.cc","stdcall"}, 
+  {"func.AttachThreadInput.cc","stdcall"}, 
+  {"func.FindCloseChangeNotification.cc","stdcall"}, 
+  {"func.DrawStateW.cc","stdcall"}, 
+  {"func.WriteFile.cc","stdcall"}, 
+  {"func.StrCSpnA.cc","stdcall"}, 
+  {"func.RegEnumValueA.cc","stdcall"}, 
+  {"func.RegisterTouchHitTestingWindow.cc","stdcall"}, 
+  {"func.TlsAlloc.cc","stdcall"}, 
+  {"func.CM_Get_Hardware_Profile_InfoW.cc","stdcall"}, 
+  {"func.CM_Set_DevNode_Registry_PropertyW.cc","stdcall"}, 
+  {"func.SHSetTemporaryPropertyForItem.cc","stdcall"}, 
+  {"func.WinHttpQueryAuthParams.cc","stdcall"}, 
+  {"func.VarDateFromDisp.cc","stdcall"}, 
+  {"func.CoQueryClientBlanket.cc","stdcall"}, 
+  {"func.RequestDeviceWakeup.cc","stdcall"}, 
+  {"func.CM_Add_IDW.cc","stdcall"}, 
+  {"func.CM_Get_Device_ID_ExW.cc","stdcall"}, 
+  {"func.SetWindowLongPtrW.cc","stdcall"}, 
+  {"func.AssocQueryKeyA.cc","stdcall"}, 
+  {"func.SHAnsiToAnsi.cc","stdcall"}, 
+  {"func.LoadEnclaveImageW.cc","stdcall"}, 
+  {"func.GetDisplayAutoRotationPreferencesByProcessId.cc","stdcall"}, 
+  {"func.SafeArrayDestroyData.cc","stdcall"}, 
+  {"func.GetThreadIdealProcessorEx.cc","stdcall"}, 
+  {"func.StrToIntA.cc","stdcall"}, 
+  {"func.DeleteMenu.cc","stdcall"}, 
+  {"func.CryptImportPublicKeyInfoEx2.cc","stdcall"}, 
+  {"func.CoFreeUnusedLibrariesEx.cc","stdcall"}, 
+  {"func.CveEventWrite.cc","stdcall"}, 
+  {"func.SHQueryInfoKeyW.cc","stdcall"}, 
+  {"func.GetTabbedTextExtentA.cc","stdcall"}, 
+  {"func.GetPrivateProfileSectionNamesW.cc","stdcall"}, 
+  {"func.StrCmpNICW.cc","stdcall"}, 
+  {"func.GetDpiForShellUIComponent.cc","stdcall"}, 
+  {"func.ldap_encode_sort_control.cc","cdecl"}, 
+  {"func.SymAddrIncludeInlineTrace.cc","stdcall"}, 
+  {"func.BCryptRegisterConfigChangeNotify.cc","stdcall"}, 
+  {"func.GlobalGetAtomNameA.cc","stdcall"}, 
+  {"func.CoInvalidateRemoteMachineBindings.cc","stdcall"}, 
+  {"func.SymUnloadModule64.cc","stdcall"}, 
+  {"func.RegCopyTreeA.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_Property_ExW.cc","stdcall"}, 
+  {"func.VarCyFromUI4.cc","stdcall"}, 
+  {"func.ldap_parse_vlv_controlA.cc","cdecl"}, 
+  {"func.CreateIconFromResourceEx.cc","stdcall"}, 
+  {"func.BCryptDecrypt.cc","stdcall"}, 
+  {"func.GetWindowRgnBox.cc","stdcall"}, 
+  {"func.WritePrivateProfileStringW.cc","stdcall"}, 
+  {"func.SetMenu.cc","stdcall"}, 
+  {"func.CertSetStoreProperty.cc","stdcall"}, 
+  {"func.GetDCEx.cc","stdcall"}, 
+  {"func.CM_Move_DevNode.cc","stdcall"}, 
+  {"func.WriteProfileSectionW.cc","stdcall"}, 
+  {"func.DeleteFileW.cc","stdcall"}, 
+  {"func.CharToOemBuffA.cc","stdcall"}, 
+  {"func.PowerWriteDCValueIndex.cc","stdcall"}, 
+  {"func.GetAppliedGPOListW.cc","stdcall"}, 
+  {"func.CM_Open_Class_KeyA.cc","stdcall"}, 
+  {"func.CM_Get_Hardware_Profile_InfoA.cc","stdcall"}, 
+  {"func.GetExitCodeThread.cc","stdcall"}, 
+  {"func.CertCreateSelfSignCertificate.cc","stdcall"}, 
+  {"func.CoRegisterMessageFilter.cc","stdcall"}, 
+  {"func.SafeArrayPtrOfIndex.cc","stdcall"}, 
+  {"func.ZombifyActCtx.cc","stdcall"}, 
+  {"func.GetDriveTypeA.cc","stdcall"}, 
+  {"func.CM_Add_IDA.cc","stdcall"}, 
+  {"func.GetProfileType.cc","stdcall"}, 
+  {"func.CascadeWindows.cc","stdcall"}, 
+  {"func.ldap_bindA.cc","cdecl"}, 
+  {"func.SHRegSetValue.cc","stdcall"}, 
+  {"func.GetFileSizeEx.cc","stdcall"}, 
+  {"func.SHRegGetIntW.cc","stdcall"}, 
+  {"func.GetSystemWow64DirectoryA.cc","stdcall"}, 
+  {"func.CM_Get_Device_IDW.cc","stdcall"}, 
+  {"func.ber_bvfree.cc","cdecl"}, 
+  {"func.CreateProcessAsUserA.cc","stdcall"}, 
+  {"func.GetStringTypeA.cc","stdcall"}, 
+  {"func.BCryptSignHash.cc","stdcall"}, 
+  {"func.FindFirstFileA.cc","stdcall"}, 
+  {"func.ldap_err2stringW.cc","cdecl"}, 
+  {"func.GetDynamicTimeZoneInformationEffectiveYears.cc","stdcall"}, 
+  {"func.CountClipboardFormats.cc","stdcall"}, 
+  {"func.WSASocketA.cc","stdcall"}, 
+  {"func.ImpersonateLoggedOnUser.cc","stdcall"}, 
+  {"func.ldap_parse_referenceA.cc","cdecl"}, 
+  {"func.CreateMutexW.cc","stdcall"}, 
+  {"func.SetFocus.cc","stdcall"}, 
+  {"func.IsCharUpperA.cc","stdcall"}, 
+  {"func.EnumWindowStationsA.cc","stdcall"}, 
+  {"func.RemoveDirectoryTransactedW.cc","stdcall"}, 
+  {"func.SafeArrayGetUBound.cc","stdcall"}, 
+  {"func.BCryptExportKey.cc","stdcall"}, 
+  {"func.GetErrorInfo.cc","stdcall"}, 
+  {"func.CM_Open_Class_KeyW.cc","stdcall"}, 
+  {"func.WinHttpQueryOption.cc","stdcall"}, 
+  {"func.GetRawInputDeviceInfoA.cc","stdcall"}, 
+  {"func.AssocQueryStringW.cc","stdcall"}, 
+  {"func.ldap_value_free_len.cc","cdecl"}, 
+  {"func.MoveFileWithProgressW.cc","stdcall"}, 
+  {"func.ImageList_DragEnter.cc","stdcall"}, 
+  {"func.BCryptOpenAlgorithmProvider.cc","stdcall"}, 
+  {"func.LoadTypeLib.cc","stdcall"}, 
+  {"func.VarR4FromUI1.cc","stdcall"}, 
+  {"func.LoadPackagedLibrary.cc","stdcall"}, 
+  {"func.OpenServiceA.cc","stdcall"}, 
+  {"func.BCryptEnumContextFunctionProviders.cc","stdcall"}, 
+  {"func.WSASetSocketPeerTargetName.cc","stdcall"}, 
+  {"func.MessageBoxW.cc","stdcall"}, 
+  {"func.RtlInstallFunctionTableCallback.cc","cdecl"}, 
+  {"func.NCryptCreateProtectionDescriptor.cc","stdcall"}, 
+  {"func.SafeArrayCreateEx.cc","stdcall"}, 
+  {"func.SetSecurityDescriptorSacl.cc","stdcall"}, 
+  {"func.GetCursorInfo.cc","stdcall"}, 
+  {"func.OpenThread.cc","stdcall"}, 
+  {"func.GetProcessHeap.cc","stdcall"}, 
+  {"func.CreateFileW.cc","stdcall"}, 
+  {"func.InitializeProcThreadAttributeList.cc","stdcall"}, 
+  {"func.SetProcessDpiAwarenessContext.cc","stdcall"}, 
+  {"func.VerSetConditionMask.cc","stdcall"}, 
+  {"func.GetTopWindow.cc","stdcall"}, 
+  {"func.WSAHtonl.cc","stdcall"}, 
+  {"func.wsprintfA.cc","cdecl"}, 
+  {"func.CompareStringW.cc","stdcall"}, 
+  {"func.cldap_openW.cc","cdecl"}, 
+  {"func.SafeArrayAllocDescriptorEx.cc","stdcall"}, 
+  {"func.NCryptGetProtectionDescriptorInfo.cc","stdcall"}, 
+  {"func.FatalExit.cc","stdcall"}, 
+  {"func.ldap_sslinit.cc","cdecl"}, 
+  {"func.GetAddrInfoExA.cc","stdcall"}, 
+  {"func.EncryptFileW.cc","stdcall"}, 
+  {"func.CryptCreateHash.cc","stdcall"}, 
+  {"func.CM_Setup_DevNode.cc","stdcall"}, 
+  {"func.SetIoRateControlInformationJobObject.cc","stdcall"}, 
+  {"func.NCryptStreamClose.cc","stdcall"}, 
+  {"func.ldap_search_ext_sW.cc","cdecl"}, 
+  {"func.CryptGetAsyncParam.cc","stdcall"}, 
+  {"func.RemoveVectoredExceptionHandler.cc","stdcall"}, 
+  {"func.CreateWaitableTimerExA.cc","stdcall"}, 
+  {"func.DeriveRestrictedAppContainerSidFromAppContainerSidAndRestrictedName.cc","stdcall"}, 
+  {"func.CertFreeCTLContext.cc","stdcall"}, 
+  {"func._lcreat.cc","stdcall"}, 
+  {"func.SysStringLen.cc","stdcall"}, 
+  {"func.RegSetValueExW.cc","stdcall"}, 
+  {"func.CloseTouchInputHandle.cc","stdcall"}, 
+  {"func.CheckRemoteDebuggerPresent.cc","stdcall"}, 
+  {"func.CryptQueryObject.cc","stdcall"}, 
+  {"func.WinHttpGetIEProxyConfigForCurrentUser.cc","stdcall"}, 
+  {"func.SymGetSourceFileW.cc","stdcall"}, 
+  {"func.CreateItemMoniker.cc","stdcall"}, 
+  {"func.CertFindAttribute.cc","stdcall"}, 
+  {"func.GetNextDlgGroupItem.cc","stdcall"}, 
+  {"func.VkKeyScanExW.cc","stdcall"}, 
+  {"func.VarBoolFromDate.cc","stdcall"}, 
+  {"func.SetProcessShutdownParameters.cc","stdcall"}, 
+  {"func.SHRegOpenUSKeyW.cc","stdcall"}, 
+  {"func.GetKernelObjectSecurity.cc","stdcall"}, 
+  {"func.CreatePopupMenu.cc","stdcall"}, 
+  {"func.GetNLSVersion.cc","stdcall"}, 
+  {"func.IsValidSecurityDescriptor.cc","stdcall"}, 
+  {"func.SetCommMask.cc","stdcall"}, 
+  {"func.GetNumaAvailableMemoryNode.cc","stdcall"}, 
+  {"func.recv.cc","stdcall"}, 
+  {"func.VarR4FromI2.cc","stdcall"}, 
+  {"func.FindNLSStringEx.cc","stdcall"}, 
+  {"func.ldap_modifyA.cc","cdecl"}, 
+  {"func.ChangeDisplaySettingsA.cc","stdcall"}, 
+  {"func.InitiateSystemShutdownA.cc","stdcall"}, 
+  {"func.GlobalAddAtomExW.cc","stdcall"}, 
+  {"func.CM_Get_Sibling.cc","stdcall"}, 
+  {"func.GetPrivateProfileIntW.cc","stdcall"}, 
+  {"func.VarI2FromR8.cc","stdcall"}, 
+  {"func.GetFirmwareEnvironmentVariableA.cc","stdcall"}, 
+  {"func.RegRestoreKeyA.cc","stdcall"}, 
+  {"func.RegDeleteValueA.cc","stdcall"}, 
+  {"func.ScrollConsoleScreenBufferW.cc","stdcall"}, 
+  {"func.PFXExportCertStoreEx.cc","stdcall"}, 
+  {"func.TzSpecificLocalTimeToSystemTimeEx.cc","stdcall"}, 
+  {"func.WSAGetOverlappedResult.cc","stdcall"}, 
+  {"type.HALF_PTR","w"}, 
+  {"func.GetVolumeInformationW.cc","stdcall"}, 
+  {"func.SetThreadAffinityMask.cc","stdcall"}, 
+  {"func.ShutdownBlockReasonQuery.cc","stdcall"}, 
+  {"func.GetNumberOfEventLogRecords.cc","stdcall"}, 
+  {"func.WakeAllConditionVariable.cc","stdcall"}, 
+  {"func.CoFileTimeNow.cc","stdcall"}, 
+  {"func.ReadProcessMemory.cc","stdcall"}, 
+  {"func.CreateDirectoryTransactedW.cc","stdcall"}, 
+  {"func.SetCommTimeouts.cc","stdcall"}, 
+  {"func.CryptSignCertificate.cc","stdcall"}, 
+  {"func.CryptGetProvParam.cc","stdcall"}, 
+  {"func.ReplyMessage.cc","stdcall"}, 
+  {"func.PathParseIconLocationA.cc","stdcall"}, 
+  {"func.SymMatchStringW.cc","stdcall"}, 
+  {"func.LogicalToPhysicalPointForPerMonitorDPI.cc","stdcall"}, 
+  {"func.EnumResourceNamesExA.cc","stdcall"}, 
+  {"func.SymFromInlineContext.cc","stdcall"}, 
+  {"func.CharLowerA.cc","stdcall"}, 
+  {"func.CreateDataAdviseHolder.cc","stdcall"}, 
+  {"func.MessageBoxIndirectW.cc","stdcall"}, 
+  {"func.ToAsciiEx.cc","stdcall"}, 
+  {"func.RegisterApplicationRestart.cc","stdcall"}, 
+  {"func.GetWindowPlacement.cc","stdcall"}, 
+  {"func.RtlAddFunctionTable.cc","cdecl"}, 
+  {"func.NCryptCreateClaim.cc","stdcall"}, 
+  {"func.RegConnectRegistryA.cc","stdcall"}, 
+  {"func.GetPrivateProfileIntA.cc","stdcall"}, 
+  {"func.SafeArrayCopyData.cc","stdcall"}, 
+  {"type.HCURSOR.size","32"}, 
+  {"func.CM_Get_Res_Des_Data_Size_Ex.cc","stdcall"}, 
+  {"func.DecodeRemotePointer.cc","stdcall"}, 
+  {"func.BCryptEncrypt.cc","stdcall"}, 
+  {"func.LookupAccountNameLocalW.cc","stdcall"}, 
+  {"func.BCryptFreeBuffer.cc","stdcall"}, 
+  {"func.RegisterPointerInputTarget.cc","stdcall"}, 
+  {"func.StrChrNIW.cc","stdcall"}, 
+  {"func.GetWindowWord.cc","stdcall"}, 
+  {"func.SHCopyKeyW.cc","stdcall"}, 
+  {"func.FlushTraceW.cc","stdcall"}, 
+  {"func.gethostbyaddr.cc","stdcall"}, 
+  {"func.BCryptEnumContextFunctions.cc","stdcall"}, 
+  {"func.GetCaretPos.cc","stdcall"}, 
+  {"func.GetPointerDevice.cc","stdcall"}, 
+  {"func.GetSystemRegistryQuota.cc","stdcall"}, 
+  {"func.HeapAlloc.cc","stdcall"}, 
+  {"func.SearchPathA.cc","stdcall"}, 
+  {"func.CoGetContextToken.cc","stdcall"}, 
+  {"func.CertOpenSystemStoreW.cc","stdcall"}, 
+  {"func.UnloadKeyboardLayout.cc","stdcall"}, 
+  {"func.ShellExecuteW.cc","stdcall"}, 
+  {"func.NotifyUILanguageChange.cc","stdcall"}, 
+  {"func.CredFree.cc","stdcall"}, 
+  {"func.PrefetchVirtualMemory.cc","stdcall"}, 
+  {"func.NCryptOpenKey.cc","stdcall"}, 
+  {"func.IsCharLowerA.cc","stdcall"}, 
+  {"func.SHCreateStreamOnFileEx.cc","stdcall"}, 
+  {"func.StrRetToStrA.cc","stdcall"}, 
+  {"func.WSALookupServiceEnd.cc","stdcall"}, 
+  {"func.AddAuditAccessAce.cc","stdcall"}, 
+  {"func.SetCommState.cc","stdcall"}, 
+  {"func.RaiseException.cc","stdcall"}, 
+  {"func.WPUCreateEvent.cc","stdcall"}, 
+  {"func.ContinueDebugEvent.cc","stdcall"}, 
+  {"func.SymSrvGetFileIndexStringW.cc","stdcall"}, 
+  {"func.ImageList_AddMasked.cc","stdcall"}, 
+  {"func.GetCurrentProcessorNumberEx.cc","stdcall"}, 
+  {"func.PathIsUNCServerShareA.cc","stdcall"}, 
+  {"func.OpenDesktopW.cc","stdcall"}, 
+  {"func.SetDefaultCommConfigA.cc","stdcall"}, 
+  {"func.CryptDuplicateHash.cc","stdcall"}, 
+  {"func.CloseClipboard.cc","stdcall"}, 
+  {"func.AssignProcessToJobObject.cc","stdcall"}, 
+  {"func.ObjectOpenAuditAlarmW.cc","stdcall"}, 
+  {"func.EventProviderEnabled.cc","stdcall"}, 
+  {"func.VarMod.cc","stdcall"}, 
+  {"func.GetDriveTypeW.cc","stdcall"}, 
+  {"func.SHGetValueW.cc","stdcall"}, 
+  {"func.GetMenuItemRect.cc","stdcall"}, 
+  {"func.ldap_simple_bind_sA.cc","cdecl"}, 
+  {"func.GetModuleFileNameExW.cc","stdcall"}, 
+  {"func.CryptFormatObject.cc","stdcall"}, 
+  {"func.LockWorkStation.cc","stdcall"}, 
+  {"func.VarCyFromDec.cc","stdcall"}, 
+  {"func.SHFreeNameMappings.cc","stdcall"}, 
+  {"func.SymGetScopeW.cc","stdcall"}, 
+  {"func.UnRegisterTypeLibForUser.cc","stdcall"}, 
+  {"func.ldap_memfree.cc","cdecl"}, 
+  {"func.CryptRetrieveObjectByUrlA.cc","stdcall"}, 
+  {"func.ReleaseSemaphore.cc","stdcall"}, 
+  {"func.EnumResourceLanguagesA.cc","stdcall"}, 
+  {"func.AreFileApisANSI.cc","stdcall"}, 
+  {"func.NCryptDeriveKey.cc","stdcall"}, 
+  {"func.UnsubscribeServiceChangeNotifications.cc","stdcall"}, 
+  {"func.GetDateFormatEx.cc","stdcall"}, 
+  {"func.CredPackAuthenticationBufferW.cc","stdcall"}, 
+  {"func.WSAConnect.cc","stdcall"}, 
+  {"func.CertCompareCertificate.cc","stdcall"}, 
+  {"func.TraceEvent.cc","stdcall"}, 
+  {"func.OleCreatePropertyFrameIndirect.cc","stdcall"}, 
+  {"func.CreateMutexA.cc","stdcall"}, 
+  {"func.PathSkipRootA.cc","stdcall"}, 
+  {"func.CreateWindowExA.cc","stdcall"}, 
+  {"func.CredUIParseUserNameW.cc","stdcall"}, 
+  {"func.SymInitialize.cc","stdcall"}, 
+  {"func.CryptSignAndEncodeCertificate.cc","stdcall"}, 
+  {"func.ldap_parse_reference.cc","cdecl"}, 
+  {"func.GetPrivateProfileStringA.cc","stdcall"}, 
+  {"func.ShowCursor.cc","stdcall"}, 
+  {"func.K32GetProcessMemoryInfo.cc","stdcall"}, 
+  {"func.ReportEventA.cc","stdcall"}, 
+  {"func.CredUnprotectA.cc","stdcall"}, 
+  {"func.IsCharAlphaA.cc","stdcall"}, 
+  {"func.BCryptCloseAlgorithmProvider.cc","stdcall"}, 
+  {"func.CredDeleteA.cc","stdcall"}, 
+  {"func.GetServiceDisplayNameA.cc","stdcall"}, 
+  {"func.PathGetArgsA.cc","stdcall"}, 
+  {"func.CertStrToNameW.cc","stdcall"}, 
+  {"func.FindFirstFileTransactedA.cc","stdcall"}, 
+  {"func.GetOverlappedResult.cc","stdcall"}, 
+  {"func.VarR8FromI4.cc","stdcall"}, 
+  {"func.CM_Get_Parent_Ex.cc","stdcall"}, 
+  {"func.ber_bvecfree.cc","cdecl"}, 
+  {"func.SafeArraySetRecordInfo.cc","stdcall"}, 
+  {"func.CryptVerifyMessageHash.cc","stdcall"}, 
+  {"func.StackWalk.cc","stdcall"}, 
+  {"func.GetNamedPipeClientComputerNameA.cc","stdcall"}, 
+  {"func.CryptMsgCalculateEncodedLength.cc","stdcall"}, 
+  {"func.GetPointerDeviceProperties.cc","stdcall"}, 
+  {"func.ReleaseSRWLockExclusive.cc","stdcall"}, 
+  {"func.QueryInterruptTimePrecise.cc","stdcall"}, 
+  {"func.lstrcmpiA.cc","stdcall"}, 
+  {"func.CryptUnregisterDefaultOIDFunction.cc","stdcall"}, 
+  {"func.CM_Query_Arbitrator_Free_Data.cc","stdcall"}, 
+  {"func.GetServiceKeyNameA.cc","stdcall"}, 
+  {"func.LoadKeyboardLayoutA.cc","stdcall"}, 
+  {"func.HeapWalk.cc","stdcall"}, 
+  {"func.PathCommonPrefixW.cc","stdcall"}, 
+  {"func.CreateStatusWindowW.cc","stdcall"}, 
+  {"func.VirtualAlloc2.cc","stdcall"}, 
+  {"func.GetGestureConfig.cc","stdcall"}, 
+  {"func.GetProcessDpiAwareness.cc","stdcall"}, 
+  {"func.EnumDeviceDrivers.cc","stdcall"}, 
+  {"func.SHGetItemFromObject.cc","stdcall"}, 
+  {"func.WPUQuerySocketHandleContext.cc","stdcall"}, 
+  {"func.InitiateSystemShutdownExW.cc","stdcall"}, 
+  {"func.SHGetPropertyStoreForWindow.cc","stdcall"}, 
+  {"func.VarUI1FromUI2.cc","stdcall"}, 
+  {"func.GetPointerDevices.cc","stdcall"}, 
+  {"func.GetOEMCP.cc","stdcall"}, 
+  {"func.FreeGPOListW.cc","stdcall"}, 
+  {"func.GetMenuPosFromID.cc","stdcall"}, 
+  {"func.GetOverlappedResultEx.cc","stdcall"}, 
+  {"func.CM_Request_Eject_PC.cc","stdcall"}, 
+  {"func.WSAIoctl.cc","stdcall"}, 
+  {"func.PrivilegedServiceAuditAlarmA.cc","stdcall"}, 
+  {"func.CopyFile2.cc","stdcall"}, 
+  {"func.MapGenericMask.cc","stdcall"}, 
+  {"func.PFXIsPFXBlob.cc","stdcall"}, 
+  {"func.GetSystemWindowsDirectoryW.cc","stdcall"}, 
+  {"func.CreateWindowExW.cc","stdcall"}, 
+  {"func.PathIsDirectoryEmptyA.cc","stdcall"}, 
+  {"func.SymEnumerateModules.cc","stdcall"}, 
+  {"func.LoadAcceleratorsA.cc","stdcall"}, 
+  {"func.GetTimeFormatA.cc","stdcall"}, 
+  {"func.VarI2FromDate.cc","stdcall"}, 
+  {"func.VarI8FromUI4.cc","stdcall"}, 
+  {"func.WinHttpFreeProxyResult.cc","stdcall"}, 
+  {"func.ldap_value_free.cc","cdecl"}, 
+  {"func.ImageList_GetIcon.cc","stdcall"}, 
+  {"func.CreateDirectoryW.cc","stdcall"}, 
+  {"func.PathGetArgsW.cc","stdcall"}, 
+  {"func.FindFirstFileTransactedW.cc","stdcall"}, 
+  {"func.SetStdHandleEx.cc","stdcall"}, 
+  {"func.StrCmpNCW.cc","stdcall"}, 
+  {"func.GetHostNameW.cc","stdcall"}, 
+  {"func.SetConsoleScreenBufferInfoEx.cc","stdcall"}, 
+  {"func.GetThreadUILanguage.cc","stdcall"}, 
+  {"func.DuplicateIcon.cc","stdcall"}, 
+  {"func.VerQueryValueW.cc","stdcall"}, 
+  {"func.ber_free.cc","cdecl"}, 
+  {"func.CM_Delete_Class_Key_Ex.cc","stdcall"}, 
+  {"func.OleIconToCursor.cc","stdcall"}, 
+  {"func.VarI4FromI1.cc","stdcall"}, 
+  {"func.SetDisplayAutoRotationPreferences.cc","stdcall"}, 
+  {"func.BindMoniker.cc","stdcall"}, 
+  {"func.ldap_conn_from_msg.cc","cdecl"}, 
+  {"func.CertSetCTLContextProperty.cc","stdcall"}, 
+  {"func.GetNamedPipeHandleStateW.cc","stdcall"}, 
+  {"func.ClearEventLogA.cc","stdcall"}, 
+  {"func.GetSystemPowerStatus.cc","stdcall"}, 
+  {"func.CredUnmarshalCredentialA.cc","stdcall"}, 
+  {"func.CharUpperW.cc","stdcall"}, 
+  {"type.HMETAFILE.size","32"}, 
+  {"func.VarI4FromI2.cc","stdcall"}, 
+  {"func.RegDeleteKeyW.cc","stdcall"}, 
+  {"func.VarUI2FromUI1.cc","stdcall"}, 
+  {"func.VarUI8FromUI1.cc","stdcall"}, 
+  {"func.EnumerateLoadedModules64.cc","stdcall"}, 
+  {"func.RealGetWindowClassA.cc","stdcall"}, 
+  {"func.IsSystemResumeAutomatic.cc","stdcall"}, 
+  {"func.WSCGetProviderPath.cc","stdcall"}, 
+  {"func.VarCyMulI4.cc","stdcall"}, 
+  {"func.ldap_get_next_page_s.cc","cdecl"}, 
+  {"func.CoDecrementMTAUsage.cc","stdcall"}, 
+  {"func.IsProcessorFeaturePresent.cc","stdcall"}, 
+  {"func.DllCanUnloadNow.cc","stdcall"}, 
+  {"func.NCryptUnprotectSecret.cc","stdcall"}, 
+  {"func.LoadStringW.cc","stdcall"}, 
+  {"func.RemoveClipboardFormatListener.cc","stdcall"}, 
+  {"func.SymEnumerateModulesW64.cc","stdcall"}, 
+  {"func.CoGetTreatAsClass.cc","stdcall"}, 
+  {"func.FlatSB_GetScrollPropPtr.cc","stdcall"}, 
+  {"func.CM_Modify_Res_Des.cc","stdcall"}, 
+  {"func.WinHttpReadProxySettings.cc","stdcall"}, 
+  {"func.SymFunctionTableAccess64AccessRoutines.cc","stdcall"}, 
+  {"func.VarR4FromDisp.cc","stdcall"}, 
+  {"func.RegDeleteValueW.cc","stdcall"}, 
+  {"func.ImageList_DragLeave.cc","stdcall"}, 
+  {"func.EnumResourceTypesExA.cc","stdcall"}, 
+  {"func.WinHttpSetCredentials.cc","stdcall"}, 
+  {"func.TabbedTextOutW.cc","stdcall"}, 
+  {"func.CoGetMarshalSizeMax.cc","stdcall"}, 
+  {"func.RegLoadKeyW.cc","stdcall"}, 
+  {"func.WinHttpCreateUrl.cc","stdcall"}, 
+  {"func.SysReleaseString.cc","stdcall"}, 
+  {"func.getnameinfo.cc","stdcall"}, 
+  {"func.EvaluateProximityToRect.cc","stdcall"}, 
+  {"func.UnregisterApplicationRecoveryCallback.cc","stdcall"}, 
+  {"func.CM_Register_Device_Driver.cc","stdcall"}, 
+  {"func.CoGetInstanceFromFile.cc","stdcall"}, 
+  {"func.GrayStringA.cc","stdcall"}, 
+  {"func.HeapValidate.cc","stdcall"}, 
+  {"func.K32GetPerformanceInfo.cc","stdcall"}, 
+  {"func.FlatSB_ShowScrollBar.cc","stdcall"}, 
+  {"func.UrlGetLocationW.cc","stdcall"}, 
+  {"func.ldap_modrdn_sW.cc","cdecl"}, 
+  {"func.MessageBoxIndirectA.cc","stdcall"}, 
+  {"func.GetLocalTime.cc","stdcall"}, 
+  {"func.VarI4FromUI2.cc","stdcall"}, 
+  {"func.ldap_deleteA.cc","cdecl"}, 
+  {"func.ldap_result.cc","cdecl"}, 
+  {"func.SHCreateAssociationRegistration.cc","stdcall"}, 
+  {"func.GetCalendarInfoA.cc","stdcall"}, 
+  {"func.GetProcessAffinityMask.cc","stdcall"}, 
+  {"func.BackupRead.cc","stdcall"}, 
+  {"func.EnumDateFormatsW.cc","stdcall"}, 
+  {"func.InitNetworkAddressControl.cc","stdcall"}, 
+  {"func.SymGetSourceFileTokenW.cc","stdcall"}, 
+  {"func.QueryMemoryResourceNotification.cc","stdcall"}, 
+  {"func.GetAppContainerFolderPath.cc","stdcall"}, 
+  {"func.WSPStartup.cc","stdcall"}, 
+  {"func.SymFromToken.cc","stdcall"}, 
+  {"func.PathMatchSpecExA.cc","stdcall"}, 
+  {"func.VarBoolFromUI2.cc","stdcall"}, 
+  {"func.CM_Get_Resource_Conflict_Count.cc","stdcall"}, 
+  {"func.GetLastError.cc","stdcall"}, 
+  {"func.PathCchRenameExtension.cc","stdcall"}, 
+  {"func.CM_Get_Next_Res_Des_Ex.cc","stdcall"}, 
+  {"func.CertRemoveStoreFromCollection.cc","stdcall"}, 
+  {"func.VarI1FromR8.cc","stdcall"}, 
+  {"func.ImageList_DragShowNolock.cc","stdcall"}, 
+  {"func.RegSaveKeyExA.cc","stdcall"}, 
+  {"func.EqualRect.cc","stdcall"}, 
+  {"func.PowerSettingRegisterNotification.cc","stdcall"}, 
+  {"func.SearchPathW.cc","stdcall"}, 
+  {"func.SHQueryRecycleBinW.cc","stdcall"}, 
+  {"func.VarDecFix.cc","stdcall"}, 
+  {"func.LocalAlloc.cc","stdcall"}, 
+  {"func.VarCmp.cc","stdcall"}, 
+  {"func.WhichPlatform.cc","stdcall"}, 
+  {"func.GetOldestEventLogRecord.cc","stdcall"}, 
+  {"func.RegOpenCurrentUser.cc","stdcall"}, 
+  {"func.CM_Get_Device_Interface_List_ExA.cc","stdcall"}, 
+  {"func.VarDecFromR8.cc","stdcall"}, 
+  {"func.SHDeleteEmptyKeyW.cc","stdcall"}, 
+  {"func.CertDeleteCertificateFromStore.cc","stdcall"}, 
+  {"func.UnregisterClassW.cc","stdcall"}, 
+  {"func.WSAEventSelect.cc","stdcall"}, 
+  {"func.CredWriteDomainCredentialsW.cc","stdcall"}, 
+  {"func.CertAddRefServerOcspResponse.cc","stdcall"}, 
+  {"func.WinHttpSetStatusCallback.cc","stdcall"}, 
+  {"func.OpenWaitableTimerA.cc","stdcall"}, 
+  {"func.ReadConsoleInputW.cc","stdcall"}, 
+  {"func.RegSaveKeyA.cc","stdcall"}, 
+  {"func.WSAUnhookBlockingHook.cc","stdcall"}, 
+  {"func.SHRegQueryUSValueW.cc","stdcall"}, 
+  {"func.VarDiv.cc","stdcall"}, 
+  {"func.CreateEventA.cc","stdcall"}, 
+  {"func.RaiseFailFastException.cc","stdcall"}, 
+  {"func.RegSetKeyValueA.cc","stdcall"}, 
+  {"func.ldap_dn2ufnW.cc","cdecl"}, 
+  {"func.UpdateLayeredWindowIndirect.cc","stdcall"}, 
+  {"func.VarDateFromI4.cc","stdcall"}, 
+  {"func.GetKeyNameTextA.cc","stdcall"}, 
+  {"func.WSAEnumNetworkEvents.cc","stdcall"}, 
+  {"func.CertFindRDNAttr.cc","stdcall"}, 
+  {"func.GetIntegratedDisplaySize.cc","stdcall"}, 
+  {"func.GetKeyState.cc","stdcall"}, 
+  {"func.SHSimpleIDListFromPath.cc","stdcall"}, 
+  {NULL, NULL}
+};
+// 0x5582ea45c1a0
+// TODO
+typedef int (*GperfForeachCallback)(void *user, const char *k, const char *v);
+int gperf_types_x86_windows_32_foreach(GperfForeachCallback cb, void *user) {
+  int i = 0; while (kvs[i].name) {
+  cb (user, kvs[i].name, kvs[i].value);
+  i++;}
+  return 0;
+}
+const char *gperf_types_x86_windows_32_get(const char *s) {
+  int i = 0; while (kvs[i].name) {
+  if (!strcmp (s, kvs[i].name)) return kvs[i].value;
+  i++;}
+  return NULL;
+}
+#define sdb_hash_c_types_x86_windows_32(x,y) gperf_types_x86_windows_32_hash(x)
+const unsigned int gperf_types_x86_windows_32_hash(const char *s) {
+  int sum = strlen (s);
+  while (*s) { sum += *s; s++; }
+  return sum;
+}
+struct {const char *name;void *get;void *hash;void *foreach;} gperf_types_x86_windows_32 = {
+  .name = "types-x86-windows-32",
+  .get = &gperf_types_x86_windows_32_get,
+  .hash = &gperf_types_x86_windows_32_hash,
+  .foreach = &gperf_types_x86_windows_32_foreach
+};
+
+#if MAIN
+int main () {
+	const char *s = ((char*(*)(char*))gperf_types_x86_windows_32.get)("foo");
+	printf ("%s\n", s);
+}
+#endif
@@ -0,0 +1,4885 @@
+// SDB-CGEN V1.9.4
+// gcc -DMAIN=1 types_x86_windows_64.c ; ./a.out > types_x86_windows_64.h
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+struct kv { const char *name; const char *value; };
+static const struct kv kvs[] = {
+  {"func.CryptContextAddRef.cc","ms"}, 
+  {"func.StartTraceW.cc","ms"}, 
+  {"func.BCryptProcessMultiOperations.cc","ms"}, 
+  {"func.BCryptDeriveKeyCapi.cc","ms"}, 
+  {"func.ImageRvaToSection.cc","ms"}, 
+  {"func.GetDefaultUserProfileDirectoryA.cc","ms"}, 
+  {"func.CM_Get_Parent.cc","ms"}, 
+  {"func.WSCGetProviderInfo32.cc","ms"}, 
+  {"func.SHOpenRegStream2A.cc","ms"}, 
+  {"func.SymEnumSourceFileTokens.cc","ms"}, 
+  {"func.GetSidSubAuthorityCount.cc","ms"}, 
+  {"func.GetRegisteredRawInputDevices.cc","ms"}, 
+  {"func.GetAtomNameW.cc","ms"}, 
+  {"func.RegOpenKeyA.cc","ms"}, 
+  {"func.PathSkipRootW.cc","ms"}, 
+  {"func.inet_addr.cc","ms"}, 
+  {"func.RegisterClassExA.cc","ms"}, 
+  {"func.IsDebuggerPresent.cc","ms"}, 
+  {"func.RegUnLoadKeyA.cc","ms"}, 
+  {"func.LeaveCriticalSection.cc","ms"}, 
+  {"func.CryptAcquireContextA.cc","ms"}, 
+  {"func.ReportEventW.cc","ms"}, 
+  {"func.CredIsMarshaledCredentialW.cc","ms"}, 
+  {"func.ldap_dn2ufnA.cc","ms"}, 
+  {"func.CredProtectW.cc","ms"}, 
+  {"func.WSAGetServiceClassInfoA.cc","ms"}, 
+  {"func.GetFileSecurityA.cc","ms"}, 
+  {"func.GetFileType.cc","ms"}, 
+  {"func.DeleteAppContainerProfile.cc","ms"}, 
+  {"func.SHFormatDateTimeW.cc","ms"}, 
+  {"func.VarUI4FromR4.cc","ms"}, 
+  {"func.RegDeleteKeyExA.cc","ms"}, 
+  {"func.SHRegDeleteEmptyUSKeyW.cc","ms"}, 
+  {"func.GetTypeByNameW.cc","ms"}, 
+  {"func.VarDateFromUI4.cc","ms"}, 
+  {"func.WideCharToMultiByte.cc","ms"}, 
+  {"func.CryptExportPublicKeyInfoFromBCryptKeyHandle.cc","ms"}, 
+  {"func.IsCharSpaceW.cc","ms"}, 
+  {"func.QueryServiceConfigW.cc","ms"}, 
+  {"func.LookupPrivilegeDisplayNameA.cc","ms"}, 
+  {"func.BeginPaint.cc","ms"}, 
+  {"func.RegQueryInfoKeyW.cc","ms"}, 
+  {"func.LHashValOfNameSys.cc","ms"}, 
+  {"func.CreateStatusWindowA.cc","ms"}, 
+  {"func.ShowHideMenuCtl.cc","ms"}, 
+  {"func.VarR8FromUI8.cc","ms"}, 
+  {"func.GetClipboardFormatNameW.cc","ms"}, 
+  {"func.UnDecorateSymbolName.cc","ms"}, 
+  {"func.K32InitializeProcessForWsWatch.cc","ms"}, 
+  {"func.SymEnumSymbols.cc","ms"}, 
+  {"func.CM_Set_DevNode_Property_ExW.cc","ms"}, 
+  {"func.UnmapViewOfFile.cc","ms"}, 
+  {"func.SetConsoleWindowInfo.cc","ms"}, 
+  {"func.EqualSid.cc","ms"}, 
+  {"func.ImageList_Merge.cc","ms"}, 
+  {"func.GetLastActivePopup.cc","ms"}, 
+  {"func.ImageList_Duplicate.cc","ms"}, 
+  {"func.VarR8FromI1.cc","ms"}, 
+  {"func.TrackPopupMenuEx.cc","ms"}, 
+  {"func.LookupPrivilegeValueW.cc","ms"}, 
+  {"func.GetTraceEnableLevel.cc","ms"}, 
+  {"func.CryptCloseAsyncHandle.cc","ms"}, 
+  {"func.PathIsDirectoryEmptyW.cc","ms"}, 
+  {"func.CryptInstallDefaultContext.cc","ms"}, 
+  {"func.UrlIsOpaqueW.cc","ms"}, 
+  {"func.WinHttpGetProxySettingsVersion.cc","ms"}, 
+  {"func.FlushInstructionCache.cc","ms"}, 
+  {"func.DrawEdge.cc","ms"}, 
+  {"func.NotifyServiceStatusChangeW.cc","ms"}, 
+  {"func.LoadAcceleratorsW.cc","ms"}, 
+  {"func.SymAddSymbol.cc","ms"}, 
+  {"func.GetStringScripts.cc","ms"}, 
+  {"func.EnableNonClientDpiScaling.cc","ms"}, 
+  {"func.UnregisterWaitEx.cc","ms"}, 
+  {"func.GetUserDefaultLocaleName.cc","ms"}, 
+  {"func.ldap_check_filterW.cc","ms"}, 
+  {"func.DosDateTimeToVariantTime.cc","ms"}, 
+  {"func.SafeArrayGetVartype.cc","ms"}, 
+  {"func.DeleteTimerQueueEx.cc","ms"}, 
+  {"func.SetCalendarInfoA.cc","ms"}, 
+  {"func.RegisterPowerSettingNotification.cc","ms"}, 
+  {"func.VarCyFromUI2.cc","ms"}, 
+  {"func.GetQueueStatus.cc","ms"}, 
+  {"func.ldap_first_attributeW.cc","ms"}, 
+  {"func.CallNamedPipeW.cc","ms"}, 
+  {"func.MapVirtualKeyW.cc","ms"}, 
+  {"func.RegQueryInfoKeyA.cc","ms"}, 
+  {"func.GetFileInformationByHandle.cc","ms"}, 
+  {"func.PathGetDriveNumberA.cc","ms"}, 
+  {"func.EnumProtocolsA.cc","ms"}, 
+  {"func.PathIsContentTypeW.cc","ms"}, 
+  {"func.EnumSystemLanguageGroupsW.cc","ms"}, 
+  {"func.WPUCloseSocketHandle.cc","ms"}, 
+  {"func.AddAuditAccessObjectAce.cc","ms"}, 
+  {"func.SymEnumTypes.cc","ms"}, 
+  {"func.IsTouchWindow.cc","ms"}, 
+  {"func.WSAImpersonateSocketPeer.cc","ms"}, 
+  {"func.DrawFocusRect.cc","ms"}, 
+  {"func.QueryActCtxSettingsW.cc","ms"}, 
+  {"func.UrlUnescapeW.cc","ms"}, 
+  {"func.RtlVirtualUnwind.cc","ms"}, 
+  {"func.VirtualUnlockEx.cc","ms"}, 
+  {"func.CloseWindowStation.cc","ms"}, 
+  {"func.RegOpenKeyExA.cc","ms"}, 
+  {"type.PVOID.size","64"}, 
+  {"func.ColorRGBToHLS.cc","ms"}, 
+  {"func.QueryIdleProcessorCycleTime.cc","ms"}, 
+  {"func.CryptSIPRetrieveSubjectGuid.cc","ms"}, 
+  {"func.CompareStringOrdinal.cc","ms"}, 
+  {"func.ReleaseSRWLockShared.cc","ms"}, 
+  {"func.CoIncrementMTAUsage.cc","ms"}, 
+  {"func.VarI8FromStr.cc","ms"}, 
+  {"func.HideCaret.cc","ms"}, 
+  {"func.WinHttpCreateProxyResolver.cc","ms"}, 
+  {"func.SetWindowLongW.cc","ms"}, 
+  {"func.CM_Set_DevNode_Registry_PropertyA.cc","ms"}, 
+  {"func.GetCommMask.cc","ms"}, 
+  {"func.CertEnumCTLsInStore.cc","ms"}, 
+  {"func.CryptDestroyHash.cc","ms"}, 
+  {"func.CM_Open_Device_Interface_KeyA.cc","ms"}, 
+  {"func.QueryProtectedPolicy.cc","ms"}, 
+  {"func.IdnToUnicode.cc","ms"}, 
+  {"func.MapVirtualKeyA.cc","ms"}, 
+  {"func.IsValidLocale.cc","ms"}, 
+  {"func.IStream_WritePidl.cc","ms"}, 
+  {"func.VarImp.cc","ms"}, 
+  {"func.PathGetDriveNumberW.cc","ms"}, 
+  {"func.CM_Get_DevNode_Registry_Property_ExA.cc","ms"}, 
+  {"func.SHQueryInfoKeyA.cc","ms"}, 
+  {"func.SymPrev.cc","ms"}, 
+  {"func.OpenSemaphoreA.cc","ms"}, 
+  {"func.SetThreadErrorMode.cc","ms"}, 
+  {"func.VarUI8FromR8.cc","ms"}, 
+  {"func.DispCallFunc.cc","ms"}, 
+  {"func.CheckNameLegalDOS8Dot3W.cc","ms"}, 
+  {"func.ldap_search_extA.cc","ms"}, 
+  {"func.FindFirstStreamW.cc","ms"}, 
+  {"func.CredWriteW.cc","ms"}, 
+  {"func.SymGetSymNext64.cc","ms"}, 
+  {"func.K32GetDeviceDriverBaseNameW.cc","ms"}, 
+  {"func.LoadResource.cc","ms"}, 
+  {"func.SetThreadDescription.cc","ms"}, 
+  {"func.PathFindOnPathA.cc","ms"}, 
+  {"func.VarR4CmpR8.cc","ms"}, 
+  {"func.ldap_modrdn_sA.cc","ms"}, 
+  {"func.PathFindSuffixArrayA.cc","ms"}, 
+  {"func.VarBstrFromDisp.cc","ms"}, 
+  {"func.RegisterClassA.cc","ms"}, 
+  {"func.CM_Get_Class_Registry_PropertyA.cc","ms"}, 
+  {"func.GetCalendarInfoW.cc","ms"}, 
+  {"func.VarUI8FromUI2.cc","ms"}, 
+  {"func.DeleteUmsCompletionList.cc","ms"}, 
+  {"func.SymGetLinePrevW64.cc","ms"}, 
+  {"func.GetConsoleTitleW.cc","ms"}, 
+  {"func.EventAccessRemove.cc","ms"}, 
+  {"func.GetAppliedGPOListA.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_Property_Keys_ExW.cc","ms"}, 
+  {"func.BeginUpdateResourceA.cc","ms"}, 
+  {"func.SHAnsiToUnicode.cc","ms"}, 
+  {"func.lstrcmpW.cc","ms"}, 
+  {"func.AccessCheckByTypeResultListAndAuditAlarmByHandleA.cc","ms"}, 
+  {"func.VarR8FromStr.cc","ms"}, 
+  {"func.ldap_compare.cc","ms"}, 
+  {"func.CoGetMalloc.cc","ms"}, 
+  {"func.UnregisterPointerInputTarget.cc","ms"}, 
+  {"func.SymFromIndex.cc","ms"}, 
+  {"func.MapWindowPoints.cc","ms"}, 
+  {"func.NCryptFreeObject.cc","ms"}, 
+  {"func.CoImpersonateClient.cc","ms"}, 
+  {"func.PathAppendA.cc","ms"}, 
+  {"func.GetOsSafeBootMode.cc","ms"}, 
+  {"func.AddVectoredContinueHandler.cc","ms"}, 
+  {"func.QueryThreadProfiling.cc","ms"}, 
+  {"func.FreeConsole.cc","ms"}, 
+  {"func.VarFormatDateTime.cc","ms"}, 
+  {"func.EnumResourceLanguagesExA.cc","ms"}, 
+  {"func.GetWindowDisplayAffinity.cc","ms"}, 
+  {"func.CM_Set_Class_Registry_PropertyW.cc","ms"}, 
+  {"func.CredReadW.cc","ms"}, 
+  {"func.EnumWindowStationsW.cc","ms"}, 
+  {"func.ldap_stop_tls_s.cc","ms"}, 
+  {"func.ldap_parse_sort_control.cc","ms"}, 
+  {"func.UnregisterClassA.cc","ms"}, 
+  {"func.CredWriteDomainCredentialsA.cc","ms"}, 
+  {"func.InternalGetWindowText.cc","ms"}, 
+  {"func.SendMessageCallbackA.cc","ms"}, 
+  {"func.CryptUpdateProtectedState.cc","ms"}, 
+  {"func.ShutdownBlockReasonCreate.cc","ms"}, 
+  {"func.CoSetProxyBlanket.cc","ms"}, 
+  {"func.EnumDynamicTimeZoneInformation.cc","ms"}, 
+  {"func.GetSubMenu.cc","ms"}, 
+  {"func.LoadIconMetric.cc","ms"}, 
+  {"func.CloseServiceHandle.cc","ms"}, 
+  {"func.BeginUpdateResourceW.cc","ms"}, 
+  {"func.CoResumeClassObjects.cc","ms"}, 
+  {"func.GetFileVersionInfoW.cc","ms"}, 
+  {"func.WSASetEvent.cc","ms"}, 
+  {"func.CreateStdDispatch.cc","ms"}, 
+  {"func.LockSetForegroundWindow.cc","ms"}, 
+  {"func.SwapMouseButton.cc","ms"}, 
+  {"func.FlatSB_SetScrollPos.cc","ms"}, 
+  {"func.ProgIDFromCLSID.cc","ms"}, 
+  {"func.GetNumaProximityNodeEx.cc","ms"}, 
+  {"func.ldap_compare_ext_sA.cc","ms"}, 
+  {"func.IdnToAscii.cc","ms"}, 
+  {"func.DeleteProfileW.cc","ms"}, 
+  {"func.SetThreadGroupAffinity.cc","ms"}, 
+  {"func.SetScrollRange.cc","ms"}, 
+  {"func.ldap_search_init_pageA.cc","ms"}, 
+  {"func.SHRegQueryInfoUSKeyA.cc","ms"}, 
+  {"func.WinHttpGetProxyForUrlEx2.cc","ms"}, 
+  {"func.SHDeleteValueW.cc","ms"}, 
+  {"func.SHGetFileInfoA.cc","ms"}, 
+  {"func.CM_Delete_DevNode_Key_Ex.cc","ms"}, 
+  {"func.CM_Get_Child_Ex.cc","ms"}, 
+  {"func.SymGetSymPrev.cc","ms"}, 
+  {"func.RemovePropW.cc","ms"}, 
+  {"func.VarUI8FromI4.cc","ms"}, 
+  {"func.GetGPOListA.cc","ms"}, 
+  {"func.TranslateAcceleratorW.cc","ms"}, 
+  {"func.ldap_delete_s.cc","ms"}, 
+  {"func.MsgWaitForMultipleObjectsEx.cc","ms"}, 
+  {"func.PathUndecorateW.cc","ms"}, 
+  {"func.RegQueryMultipleValuesA.cc","ms"}, 
+  {"func.GetSystemMetrics.cc","ms"}, 
+  {"func.GetUserDefaultGeoName.cc","ms"}, 
+  {"func.FrameRect.cc","ms"}, 
+  {"func.GetSystemTimeAsFileTime.cc","ms"}, 
+  {"func.CredReadA.cc","ms"}, 
+  {"func.HIMAGELIST_QueryInterface.cc","ms"}, 
+  {"func.CryptAcquireContextW.cc","ms"}, 
+  {"func.GetProcessImageFileNameW.cc","ms"}, 
+  {"func.RegCreateKeyExW.cc","ms"}, 
+  {"func.EnumTimeFormatsEx.cc","ms"}, 
+  {"func.VarBoolFromStr.cc","ms"}, 
+  {"func.DllUnregisterServer.cc","ms"}, 
+  {"func.CertGetPublicKeyLength.cc","ms"}, 
+  {"func.DestroyWindow.cc","ms"}, 
+  {"func.ImageList_SetOverlayImage.cc","ms"}, 
+  {"func.CryptMsgGetParam.cc","ms"}, 
+  {"func.PathCchIsRoot.cc","ms"}, 
+  {"func.SHLoadIndirectString.cc","ms"}, 
+  {"func.FreeLibraryAndExitThread.cc","ms"}, 
+  {"func.RegGetValueA.cc","ms"}, 
+  {"func.IsDlgButtonChecked.cc","ms"}, 
+  {"func.CredUICmdLinePromptForCredentialsW.cc","ms"}, 
+  {"func.LocaleNameToLCID.cc","ms"}, 
+  {"func.RegDeleteKeyExW.cc","ms"}, 
+  {"func.WSASendMsg.cc","ms"}, 
+  {"func.CM_Invert_Range_List.cc","ms"}, 
+  {"func.GlobalCompact.cc","ms"}, 
+  {"func.CM_Get_Next_Res_Des.cc","ms"}, 
+  {"func.QueryServiceConfigA.cc","ms"}, 
+  {"func.PathCchAppend.cc","ms"}, 
+  {"func.DrawMenuBar.cc","ms"}, 
+  {"func.SymFindExecutableImageW.cc","ms"}, 
+  {"func.EnumDependentServicesA.cc","ms"}, 
+  {"func.ImageList_Create.cc","ms"}, 
+  {"func.CM_Request_Device_EjectA.cc","ms"}, 
+  {"func.GetConsoleOriginalTitleW.cc","ms"}, 
+  {"func.QueryUnbiasedInterruptTime.cc","ms"}, 
+  {"func.SetActiveWindow.cc","ms"}, 
+  {"func.SafeArrayAccessData.cc","ms"}, 
+  {"func.CM_Get_DevNode_Status.cc","ms"}, 
+  {"func.VarUdateFromDate.cc","ms"}, 
+  {"func.TranslateMessage.cc","ms"}, 
+  {"func.LCMapStringA.cc","ms"}, 
+  {"func.GlobalDeleteAtom.cc","ms"}, 
+  {"func.CredFindBestCredentialW.cc","ms"}, 
+  {"func.VkKeyScanExA.cc","ms"}, 
+  {"func.InitializeProcessForWsWatch.cc","ms"}, 
+  {"func.GetCommPorts.cc","ms"}, 
+  {"func.VarI1FromUI1.cc","ms"}, 
+  {"func.RegisterGPNotification.cc","ms"}, 
+  {"func.ldap_compare_sW.cc","ms"}, 
+  {"func.DrawStatusTextA.cc","ms"}, 
+  {"func.GetUserGeoID.cc","ms"}, 
+  {"func.CertIsValidCRLForCertificate.cc","ms"}, 
+  {"func.SymGetModuleInfo64.cc","ms"}, 
+  {"func.IStream_Copy.cc","ms"}, 
+  {"func.ldap_free_controls.cc","ms"}, 
+  {"func.SymGetLineFromInlineContext.cc","ms"}, 
+  {"func.PathUnmakeSystemFolderA.cc","ms"}, 
+  {"func.CreateFile2.cc","ms"}, 
+  {"func.ObjectDeleteAuditAlarmA.cc","ms"}, 
+  {"func.ldap_modifyW.cc","ms"}, 
+  {"func.SetDynamicTimeZoneInformation.cc","ms"}, 
+  {"func.GetMessagePos.cc","ms"}, 
+  {"func.VarI1FromUI2.cc","ms"}, 
+  {"func.WSAAddressToStringW.cc","ms"}, 
+  {"func.UpdateResourceW.cc","ms"}, 
+  {"func.OutputDebugStringW.cc","ms"}, 
+  {"func.ldap_next_reference.cc","ms"}, 
+  {"func.DeleteUmsThreadContext.cc","ms"}, 
+  {"func.WSAEnumNameSpaceProvidersExW.cc","ms"}, 
+  {"func.GetActiveObject.cc","ms"}, 
+  {"func.PathIsRelativeW.cc","ms"}, 
+  {"func.PathUnquoteSpacesA.cc","ms"}, 
+  {"func.SHGetPropertyStoreFromParsingName.cc","ms"}, 
+  {"func.UnregisterTraceGuids.cc","ms"}, 
+  {"func.VarI4FromR8.cc","ms"}, 
+  {"func.EnumDependentServicesW.cc","ms"}, 
+  {"func.InitializeFlatSB.cc","ms"}, 
+  {"func.BCryptGenRandom.cc","ms"}, 
+  {"func.StrCSpnIW.cc","ms"}, 
+  {"func.SetMessageQueue.cc","ms"}, 
+  {"func.ldap_start_tls_sA.cc","ms"}, 
+  {"func.CertDeleteCTLFromStore.cc","ms"}, 
+  {"func.QueryAllTracesW.cc","ms"}, 
+  {"func.CM_Enable_DevNode.cc","ms"}, 
+  {"func.GetKeyboardLayout.cc","ms"}, 
+  {"func.SymGetLineNextW64.cc","ms"}, 
+  {"func.IsWow64Message.cc","ms"}, 
+  {"func.SymEnumSymbolsEx.cc","ms"}, 
+  {"func.AddAccessAllowedAceEx.cc","ms"}, 
+  {"func.CM_Reenumerate_DevNode.cc","ms"}, 
+  {"func.WaitForMultipleObjects.cc","ms"}, 
+  {"func.GetFocus.cc","ms"}, 
+  {"func.RegCreateKeyTransactedW.cc","ms"}, 
+  {"func.ControlTraceW.cc","ms"}, 
+  {"func.OpenEncryptedFileRawA.cc","ms"}, 
+  {"func.VarUI1FromR8.cc","ms"}, 
+  {"func.InvertRect.cc","ms"}, 
+  {"func.SymSetHomeDirectory.cc","ms"}, 
+  {"func.CertGetNameStringA.cc","ms"}, 
+  {"func.listen.cc","ms"}, 
+  {"func.CryptGetDefaultProviderW.cc","ms"}, 
+  {"func.CertDuplicateCertificateContext.cc","ms"}, 
+  {"func.GetDeviceDriverFileNameA.cc","ms"}, 
+  {"func.CM_Query_Arbitrator_Free_Data_Ex.cc","ms"}, 
+  {"func.NCryptExportKey.cc","ms"}, 
+  {"func.PathIsRelativeA.cc","ms"}, 
+  {"func.BCryptSetContextFunctionProperty.cc","ms"}, 
+  {"func.CertGetEnhancedKeyUsage.cc","ms"}, 
+  {"func.LookupAccountNameLocalA.cc","ms"}, 
+  {"func.SafeArrayLock.cc","ms"}, 
+  {"func.SHCopyKeyA.cc","ms"}, 
+  {"func.WriteConsoleOutputCharacterA.cc","ms"}, 
+  {"func.CryptFreeOIDFunctionAddress.cc","ms"}, 
+  {"func.GetThreadInformation.cc","ms"}, 
+  {"func.GetUserObjectInformationW.cc","ms"}, 
+  {"func.StrCmpIW.cc","ms"}, 
+  {"func.ImageList_Destroy.cc","ms"}, 
+  {"func.ShellExecuteA.cc","ms"}, 
+  {"func.InvalidateRgn.cc","ms"}, 
+  {"func.CM_Query_Remove_SubTree.cc","ms"}, 
+  {"func.BCryptUnregisterConfigChangeNotify.cc","ms"}, 
+  {"func.LockFile.cc","ms"}, 
+  {"func.CreateTypeLib.cc","ms"}, 
+  {"func.ShellAboutW.cc","ms"}, 
+  {"func.QueryProcessCycleTime.cc","ms"}, 
+  {"func.SetFileValidData.cc","ms"}, 
+  {"func.PathQuoteSpacesA.cc","ms"}, 
+  {"func.CoCreateInstanceEx.cc","ms"}, 
+  {"func.CoInitialize.cc","ms"}, 
+  {"func.GetMessageW.cc","ms"}, 
+  {"func.CryptImportPKCS8.cc","ms"}, 
+  {"func.FindResourceExA.cc","ms"}, 
+  {"func.ImageList_GetBkColor.cc","ms"}, 
+  {"func.WSCSetProviderInfo32.cc","ms"}, 
+  {"func.ChangeDisplaySettingsExW.cc","ms"}, 
+  {"func.GetAutoRotationState.cc","ms"}, 
+  {"func.PropVariantCopy.cc","ms"}, 
+  {"func.CreateFiberEx.cc","ms"}, 
+  {"func.ImageList_Read.cc","ms"}, 
+  {"func.LeaveCriticalSectionWhenCallbackReturns.cc","ms"}, 
+  {"func.SubtractRect.cc","ms"}, 
+  {"type.HMONITOR.size","64"}, 
+  {"func.Shell_NotifyIconW.cc","ms"}, 
+  {"func.SetEndOfFile.cc","ms"}, 
+  {"func.SetThreadpoolThreadMaximum.cc","ms"}, 
+  {"func.SHGlobalCounterGetValue.cc","ms"}, 
+  {"func.RegisterShellHookWindow.cc","ms"}, 
+  {"func.DebugBreak.cc","ms"}, 
+  {"func.CM_Get_Class_NameW.cc","ms"}, 
+  {"func.SymNextW.cc","ms"}, 
+  {"func.ldap_search_stA.cc","ms"}, 
+  {"func.GetScaleFactorForDevice.cc","ms"}, 
+  {"func.SHGetAssocKeys.cc","ms"}, 
+  {"func.PathAppendW.cc","ms"}, 
+  {"func.CryptSetKeyIdentifierProperty.cc","ms"}, 
+  {"func.VarIdiv.cc","ms"}, 
+  {"func.LoadLibraryA.cc","ms"}, 
+  {"func.VarDecFromI2.cc","ms"}, 
+  {"func.CredPackAuthenticationBufferA.cc","ms"}, 
+  {"func.CopyAcceleratorTableW.cc","ms"}, 
+  {"func.ldap_search_ext.cc","ms"}, 
+  {"func.GetSystemDefaultLocaleName.cc","ms"}, 
+  {"func.BroadcastSystemMessage.cc","ms"}, 
+  {"func.CoGetCallContext.cc","ms"}, 
+  {"func.GetClassWord.cc","ms"}, 
+  {"func.FindExecutableImage.cc","ms"}, 
+  {"func.RegFlushKey.cc","ms"}, 
+  {"func.SetSystemTimeAdjustment.cc","ms"}, 
+  {"func.CertAddEncodedCertificateToStore.cc","ms"}, 
+  {"func.VarUI2FromR4.cc","ms"}, 
+  {"func.IsInternetESCEnabled.cc","ms"}, 
+  {"func.ldap_compare_ext_s.cc","ms"}, 
+  {"func.CoAddRefServerProcess.cc","ms"}, 
+  {"func.WSCEnumNameSpaceProviders32.cc","ms"}, 
+  {"func.GetNLSVersionEx.cc","ms"}, 
+  {"func.ldap_first_attribute.cc","ms"}, 
+  {"func.IsCharAlphaW.cc","ms"}, 
+  {"func.WaitForThreadpoolIoCallbacks.cc","ms"}, 
+  {"func.TrackPopupMenu.cc","ms"}, 
+  {"func.InitOnceExecuteOnce.cc","ms"}, 
+  {"func.WriteProcessMemory.cc","ms"}, 
+  {"func.PathIsFileSpecA.cc","ms"}, 
+  {"func.CertStrToNameA.cc","ms"}, 
+  {"func.GetAddrInfoW.cc","ms"}, 
+  {"func.WPUSetEvent.cc","ms"}, 
+  {"func.BCryptQueryProviderRegistration.cc","ms"}, 
+  {"func.RegisterScaleChangeNotifications.cc","ms"}, 
+  {"func.GetConsoleOutputCP.cc","ms"}, 
+  {"func.UpdateLayeredWindow.cc","ms"}, 
+  {"func.GetFileAttributesExA.cc","ms"}, 
+  {"func.GetPrivateProfileStructW.cc","ms"}, 
+  {"func.GetSystemWow64DirectoryW.cc","ms"}, 
+  {"func.CM_Get_Log_Conf_Priority.cc","ms"}, 
+  {"func.SetEnvironmentVariableA.cc","ms"}, 
+  {"func.GetMaximumProcessorCount.cc","ms"}, 
+  {"func.CertEnumSubjectInSortedCTL.cc","ms"}, 
+  {"func.StopTraceW.cc","ms"}, 
+  {"func.GetProfileIntW.cc","ms"}, 
+  {"func.UnregisterSuspendResumeNotification.cc","ms"}, 
+  {"func.GetKeyboardType.cc","ms"}, 
+  {"func.VarDecSub.cc","ms"}, 
+  {"func.CoSwitchCallContext.cc","ms"}, 
+  {"func.NCryptNotifyChangeKey.cc","ms"}, 
+  {"func.GetDiskFreeSpaceExW.cc","ms"}, 
+  {"func.FindNLSString.cc","ms"}, 
+  {"func.ExtractIconA.cc","ms"}, 
+  {"func.SetProcessMitigationPolicy.cc","ms"}, 
+  {"func.CM_Get_Class_Name_ExA.cc","ms"}, 
+  {"func.DeleteFiber.cc","ms"}, 
+  {"func.RemoveMenu.cc","ms"}, 
+  {"func.VarUI4FromBool.cc","ms"}, 
+  {"func.ImageDirectoryEntryToData.cc","ms"}, 
+  {"func.SetWindowWord.cc","ms"}, 
+  {"func.SetFileApisToOEM.cc","ms"}, 
+  {"func.VirtualAllocFromApp.cc","ms"}, 
+  {"func.GetUserProfileDirectoryA.cc","ms"}, 
+  {"func.ntohf.cc","ms"}, 
+  {"func.FreeAddrInfoW.cc","ms"}, 
+  {"func.ImageList_DragMove.cc","ms"}, 
+  {"func.SystemTimeToTzSpecificLocalTime.cc","ms"}, 
+  {"func.PathAllocCanonicalize.cc","ms"}, 
+  {"func.CancelIoEx.cc","ms"}, 
+  {"func.OpenFileMappingFromApp.cc","ms"}, 
+  {"func.SetTapePosition.cc","ms"}, 
+  {"func.CM_Modify_Res_Des_Ex.cc","ms"}, 
+  {"func.MoveFileWithProgressA.cc","ms"}, 
+  {"func.PathIsFileSpecW.cc","ms"}, 
+  {"func.IsDialogMessageW.cc","ms"}, 
+  {"func.CertAddCertificateLinkToStore.cc","ms"}, 
+  {"func.GetNameByTypeW.cc","ms"}, 
+  {"func.UrlApplySchemeW.cc","ms"}, 
+  {"func.PostThreadMessageA.cc","ms"}, 
+  {"func.CM_Merge_Range_List.cc","ms"}, 
+  {"func.OemToCharW.cc","ms"}, 
+  {"func.IsWow64Process2.cc","ms"}, 
+  {"func.VerQueryValueA.cc","ms"}, 
+  {"func.TraceEventInstance.cc","ms"}, 
+  {"func.VarI4FromUI4.cc","ms"}, 
+  {"func.RegisterRawInputDevices.cc","ms"}, 
+  {"func.EnableTraceEx.cc","ms"}, 
+  {"func.BackupEventLogW.cc","ms"}, 
+  {"func.ber_skip_tag.cc","ms"}, 
+  {"func.RegQueryValueW.cc","ms"}, 
+  {"func.GetGestureInfo.cc","ms"}, 
+  {"type.HPALETTE.size","64"}, 
+  {"func.GetThreadTimes.cc","ms"}, 
+  {"func.ldap_sasl_bind_sW.cc","ms"}, 
+  {"func.ArrangeIconicWindows.cc","ms"}, 
+  {"func.SHGetLocalizedName.cc","ms"}, 
+  {"func.SetCaretPos.cc","ms"}, 
+  {"func.ldap_get_values_lenW.cc","ms"}, 
+  {"func.LoadIconA.cc","ms"}, 
+  {"func.WriteProfileStringA.cc","ms"}, 
+  {"func.CM_Register_Device_Interface_ExA.cc","ms"}, 
+  {"func.SymGetSymFromName64.cc","ms"}, 
+  {"func.EnumerateLoadedModules.cc","ms"}, 
+  {"func.SymSetHomeDirectoryW.cc","ms"}, 
+  {"func.OaBuildVersion.cc","ms"}, 
+  {"func.GetPointerPenInfoHistory.cc","ms"}, 
+  {"func.GetAddrInfoExW.cc","ms"}, 
+  {"func.CryptHashCertificate.cc","ms"}, 
+  {"func.PathUnExpandEnvStringsA.cc","ms"}, 
+  {"func.CM_Register_Device_Driver_Ex.cc","ms"}, 
+  {"func.LeaveCriticalPolicySection.cc","ms"}, 
+  {"func.VarI2FromBool.cc","ms"}, 
+  {"func.EncryptFileA.cc","ms"}, 
+  {"func.GetDpiForMonitor.cc","ms"}, 
+  {"func.SymEnumerateSymbols.cc","ms"}, 
+  {"func.WSAAddressToStringA.cc","ms"}, 
+  {"func.UrlApplySchemeA.cc","ms"}, 
+  {"func.PathIsPrefixA.cc","ms"}, 
+  {"func.CertEnumCRLsInStore.cc","ms"}, 
+  {"func.PostThreadMessageW.cc","ms"}, 
+  {"func.DlgDirSelectExW.cc","ms"}, 
+  {"func.CreateWaitableTimerExW.cc","ms"}, 
+  {"func.InitializeConditionVariable.cc","ms"}, 
+  {"func.GetProcessGroupAffinity.cc","ms"}, 
+  {"func.SetPriorityClass.cc","ms"}, 
+  {"func.NCryptFinalizeKey.cc","ms"}, 
+  {"func.VarI2FromDec.cc","ms"}, 
+  {"func.SetWindowTextW.cc","ms"}, 
+  {"func.KillTimer.cc","ms"}, 
+  {"func.UnhandledExceptionFilter.cc","ms"}, 
+  {"func.RegLoadKeyA.cc","ms"}, 
+  {"func.AccessCheck.cc","ms"}, 
+  {"func.DeleteCriticalSection.cc","ms"}, 
+  {"func.SetComputerNameEx2W.cc","ms"}, 
+  {"func.GetPointerFrameInfoHistory.cc","ms"}, 
+  {"func.ldap_memfreeA.cc","ms"}, 
+  {"func.K32GetMappedFileNameA.cc","ms"}, 
+  {"func.SHLoadNonloadedIconOverlayIdentifiers.cc","ms"}, 
+  {"func.SetSystemCursor.cc","ms"}, 
+  {"func.VarUI4FromDec.cc","ms"}, 
+  {"func.WSACreateEvent.cc","ms"}, 
+  {"func.SHCreateItemInKnownFolder.cc","ms"}, 
+  {"func.GlobalWire.cc","ms"}, 
+  {"func.CopyRect.cc","ms"}, 
+  {"func.GlobalAddAtomExA.cc","ms"}, 
+  {"func.WriteFileGather.cc","ms"}, 
+  {"func.EnumUILanguagesW.cc","ms"}, 
+  {"func.VarI1FromStr.cc","ms"}, 
+  {"func.EventEnabled.cc","ms"}, 
+  {"func.SetPropA.cc","ms"}, 
+  {"func.CryptSetProviderExW.cc","ms"}, 
+  {"func.CryptGenKey.cc","ms"}, 
+  {"func.ldap_rename_ext_s.cc","ms"}, 
+  {"func.ReadConsoleOutputW.cc","ms"}, 
+  {"func.VarUI8FromDisp.cc","ms"}, 
+  {"func.VarBstrFromR4.cc","ms"}, 
+  {"func.CryptUnprotectMemory.cc","ms"}, 
+  {"func.ldap_delete.cc","ms"}, 
+  {"func.PeekConsoleInputW.cc","ms"}, 
+  {"func.VarR4FromStr.cc","ms"}, 
+  {"func.GetCPInfoExA.cc","ms"}, 
+  {"func.ldap_set_optionW.cc","ms"}, 
+  {"func.CM_Free_Log_Conf_Handle.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_ListA.cc","ms"}, 
+  {"func.CreateDirectoryTransactedA.cc","ms"}, 
+  {"func.ldap_count_entries.cc","ms"}, 
+  {"func.GetProcessPriorityBoost.cc","ms"}, 
+  {"func.VarDecFromBool.cc","ms"}, 
+  {"func.ldap_modrdn2_s.cc","ms"}, 
+  {"func.CM_Request_Eject_PC_Ex.cc","ms"}, 
+  {"func.InitiateShutdownA.cc","ms"}, 
+  {"func.LoadLibraryExW.cc","ms"}, 
+  {"func.GetMessageA.cc","ms"}, 
+  {"func.CryptMsgOpenToDecode.cc","ms"}, 
+  {"func.StrFormatByteSizeA.cc","ms"}, 
+  {"func.CryptMemFree.cc","ms"}, 
+  {"func.GetWindowLongW.cc","ms"}, 
+  {"func.CoReleaseServerProcess.cc","ms"}, 
+  {"func.LocalFree.cc","ms"}, 
+  {"func.CryptExportKey.cc","ms"}, 
+  {"func.StrRChrA.cc","ms"}, 
+  {"func.OleLoadPicturePath.cc","ms"}, 
+  {"func.GetProfilesDirectoryA.cc","ms"}, 
+  {"func.ldap_cleanup.cc","ms"}, 
+  {"func.CM_Get_DevNode_Custom_PropertyA.cc","ms"}, 
+  {"func.AssocGetPerceivedType.cc","ms"}, 
+  {"func.SetLastErrorEx.cc","ms"}, 
+  {"func.ShowWindow.cc","ms"}, 
+  {"type.HHOOK.size","64"}, 
+  {"func.CancelShutdown.cc","ms"}, 
+  {"func.CertGetSubjectCertificateFromStore.cc","ms"}, 
+  {"func.SafeArrayGetLBound.cc","ms"}, 
+  {"func.ImageList_Add.cc","ms"}, 
+  {"func.CryptDeriveKey.cc","ms"}, 
+  {"func.VarR8FromDate.cc","ms"}, 
+  {"func.CredUIConfirmCredentialsW.cc","ms"}, 
+  {"func.StrFromTimeIntervalW.cc","ms"}, 
+  {"func.RtlAddGrowableFunctionTable.cc","ms"}, 
+  {"func.SymPrevW.cc","ms"}, 
+  {"func.PathIsUNCW.cc","ms"}, 
+  {"func.CertCreateContext.cc","ms"}, 
+  {"func.CertFindChainInStore.cc","ms"}, 
+  {"func.GetLocaleInfoA.cc","ms"}, 
+  {"func.VarI1FromDisp.cc","ms"}, 
+  {"func.StartTraceA.cc","ms"}, 
+  {"func.PFXVerifyPassword.cc","ms"}, 
+  {"func.AreAnyAccessesGranted.cc","ms"}, 
+  {"type.HALF_PTR.size","32"}, 
+  {"func.CertRetrieveLogoOrBiometricInfo.cc","ms"}, 
+  {"func.StrToIntExW.cc","ms"}, 
+  {"func.EqualPrefixSid.cc","ms"}, 
+  {"func.UrlCombineA.cc","ms"}, 
+  {"func.WSAAsyncSelect.cc","ms"}, 
+  {"func.VirtualProtectEx.cc","ms"}, 
+  {"func.GetModuleHandleExA.cc","ms"}, 
+  {"func.MoveWindow.cc","ms"}, 
+  {"func.CM_Get_Global_State.cc","ms"}, 
+  {"func.CertVerifyCRLTimeValidity.cc","ms"}, 
+  {"func.SetKernelObjectSecurity.cc","ms"}, 
+  {"func.GetSystemDefaultUILanguage.cc","ms"}, 
+  {"func.VarR8FromUI1.cc","ms"}, 
+  {"func.CM_Get_Depth_Ex.cc","ms"}, 
+  {"func.SHSendMessageBroadcastA.cc","ms"}, 
+  {"func.ImageList_SetBkColor.cc","ms"}, 
+  {"func.OpenFile.cc","ms"}, 
+  {"func.QueryWorkingSetEx.cc","ms"}, 
+  {"func.EnableMouseInPointerForThread.cc","ms"}, 
+  {"func.CM_Intersect_Range_List.cc","ms"}, 
+  {"func.VarUI1FromUI4.cc","ms"}, 
+  {"func.InterlockedFlushSList.cc","ms"}, 
+  {"func.CoGetClassObject.cc","ms"}, 
+  {"func.ldap_free_controlsW.cc","ms"}, 
+  {"func.VarUI4FromStr.cc","ms"}, 
+  {"func.VarI8FromR8.cc","ms"}, 
+  {"func.EnumSystemCodePagesW.cc","ms"}, 
+  {"type.HRESULT.size","64"}, 
+  {"func.SHSetValueA.cc","ms"}, 
+  {"func.SetProcessWorkingSetSize.cc","ms"}, 
+  {"func.GetFileAttributesExW.cc","ms"}, 
+  {"func.SHDeleteKeyA.cc","ms"}, 
+  {"func.VarR4FromUI2.cc","ms"}, 
+  {"func.GetHGlobalFromStream.cc","ms"}, 
+  {"func.GetSystemDEPPolicy.cc","ms"}, 
+  {"func.IsMouseInPointerEnabled.cc","ms"}, 
+  {"func.CM_Get_Class_Property_Keys.cc","ms"}, 
+  {"func.RegEnableReflectionKey.cc","ms"}, 
+  {"func.PathCanonicalizeW.cc","ms"}, 
+  {"func.WSCEnableNSProvider.cc","ms"}, 
+  {"func.GetCompressedFileSizeTransactedA.cc","ms"}, 
+  {"func.CoRegisterPSClsid.cc","ms"}, 
+  {"func.CoGetStdMarshalEx.cc","ms"}, 
+  {"func.SoundSentry.cc","ms"}, 
+  {"func.WSAIsBlocking.cc","ms"}, 
+  {"func.DeleteEnclave.cc","ms"}, 
+  {"func.WritePrivateProfileSectionW.cc","ms"}, 
+  {"func.FlatSB_SetScrollInfo.cc","ms"}, 
+  {"func.StrStrNW.cc","ms"}, 
+  {"func.SetConsoleTitleW.cc","ms"}, 
+  {"func.ImageList_GetImageCount.cc","ms"}, 
+  {"func.UrlIsNoHistoryA.cc","ms"}, 
+  {"func.GetComputerNameExW.cc","ms"}, 
+  {"func.K32GetModuleInformation.cc","ms"}, 
+  {"func.SetWindowDisplayAffinity.cc","ms"}, 
+  {"func.GetServiceDisplayNameW.cc","ms"}, 
+  {"func.GetProcessPreferredUILanguages.cc","ms"}, 
+  {"func.ldap_rename_ext_sA.cc","ms"}, 
+  {"func.AddAuditAccessAceEx.cc","ms"}, 
+  {"func.GetActiveProcessorCount.cc","ms"}, 
+  {"func.MonikerCommonPrefixWith.cc","ms"}, 
+  {"func.VarUI1FromDate.cc","ms"}, 
+  {"func.InheritWindowMonitor.cc","ms"}, 
+  {"func.SHDeleteKeyW.cc","ms"}, 
+  {"func.CM_Get_Class_Key_NameW.cc","ms"}, 
+  {"func.VarI4FromDec.cc","ms"}, 
+  {"func.SetScrollPos.cc","ms"}, 
+  {"func.GetClipboardOwner.cc","ms"}, 
+  {"func.FreeLibraryWhenCallbackReturns.cc","ms"}, 
+  {"func.UrlFixupW.cc","ms"}, 
+  {"func.SymGetModuleInfoW.cc","ms"}, 
+  {"func.WinHttpReceiveResponse.cc","ms"}, 
+  {"func.EnumProtocolsW.cc","ms"}, 
+  {"func.EnumSystemFirmwareTables.cc","ms"}, 
+  {"func.VarUI2FromUI4.cc","ms"}, 
+  {"func._lopen.cc","ms"}, 
+  {"func.VarUI8FromUI4.cc","ms"}, 
+  {"func.K32QueryWorkingSet.cc","ms"}, 
+  {"func.WinHttpWriteData.cc","ms"}, 
+  {"func.CryptGetTimeValidObject.cc","ms"}, 
+  {"func.CoLockObjectExternal.cc","ms"}, 
+  {"func.CM_Free_Res_Des_Handle.cc","ms"}, 
+  {"func.StrCatBuffW.cc","ms"}, 
+  {"func.RegisterApplicationRecoveryCallback.cc","ms"}, 
+  {"func.ResetWriteWatch.cc","ms"}, 
+  {"func.CM_Set_HW_Prof_Flags_ExA.cc","ms"}, 
+  {"func.ldap_sslinitW.cc","ms"}, 
+  {"func.EnumTimeFormatsA.cc","ms"}, 
+  {"func.ldap_modify_ext_sA.cc","ms"}, 
+  {"func.InterlockedPopEntrySList.cc","ms"}, 
+  {"func.LookupPrivilegeNameW.cc","ms"}, 
+  {"func.IStream_WriteStr.cc","ms"}, 
+  {"func.SymGetSearchPath.cc","ms"}, 
+  {"func.VarDateFromStr.cc","ms"}, 
+  {"func.SymSetExtendedOption.cc","ms"}, 
+  {"func.CryptUnregisterOIDFunction.cc","ms"}, 
+  {"func.DialogBoxParamW.cc","ms"}, 
+  {"func.WriteProfileStringW.cc","ms"}, 
+  {"func.CertAddStoreToCollection.cc","ms"}, 
+  {"func.wvnsprintfA.cc","ms"}, 
+  {"func.VarUI1FromI1.cc","ms"}, 
+  {"func.GetComputerNameExA.cc","ms"}, 
+  {"func.GetPrivateProfileSectionW.cc","ms"}, 
+  {"func.SymMatchFileNameW.cc","ms"}, 
+  {"func.EnumSystemGeoID.cc","ms"}, 
+  {"func.FindDebugInfoFileEx.cc","ms"}, 
+  {"func.ChangeClipboardChain.cc","ms"}, 
+  {"func.GetAltMonthNames.cc","ms"}, 
+  {"func.PathUnExpandEnvStringsW.cc","ms"}, 
+  {"func.SHRegSetUSValueA.cc","ms"}, 
+  {"func.GetKeyboardLayoutList.cc","ms"}, 
+  {"func.ldap_parse_page_controlA.cc","ms"}, 
+  {"func.GetFirmwareEnvironmentVariableExW.cc","ms"}, 
+  {"func.GetEnvironmentStringsW.cc","ms"}, 
+  {"func.ldap_create_sort_control.cc","ms"}, 
+  {"func.ldap_open.cc","ms"}, 
+  {"func.DefMDIChildProcW.cc","ms"}, 
+  {"func.GenerateConsoleCtrlEvent.cc","ms"}, 
+  {"func.GetWindowThreadProcessId.cc","ms"}, 
+  {"func.GetUILanguageInfo.cc","ms"}, 
+  {"func.DestroyCursor.cc","ms"}, 
+  {"func.CertAlgIdToOID.cc","ms"}, 
+  {"func.SysReAllocString.cc","ms"}, 
+  {"func.DeleteFileTransactedW.cc","ms"}, 
+  {"func.StrCmpW.cc","ms"}, 
+  {"func.SymGetLineFromAddr.cc","ms"}, 
+  {"func.CM_Get_DevNode_Registry_Property_ExW.cc","ms"}, 
+  {"func.WSCEnumNameSpaceProvidersEx32.cc","ms"}, 
+  {"func.GetNamedPipeClientProcessId.cc","ms"}, 
+  {"func.CopyIcon.cc","ms"}, 
+  {"func.StrCmpCW.cc","ms"}, 
+  {"func.ldap_add_sW.cc","ms"}, 
+  {"func.ldap_search_extW.cc","ms"}, 
+  {"func.K32GetDeviceDriverBaseNameA.cc","ms"}, 
+  {"func.CreateDesktopExA.cc","ms"}, 
+  {"func.CM_Delete_Range.cc","ms"}, 
+  {"func.QueryInterruptTime.cc","ms"}, 
+  {"func.ImpersonateSelf.cc","ms"}, 
+  {"func.GetPointerInputTransform.cc","ms"}, 
+  {"func.ConvertSidToStringSidW.cc","ms"}, 
+  {"func.ExpandEnvironmentStringsForUserA.cc","ms"}, 
+  {"func.CharUpperBuffW.cc","ms"}, 
+  {"func.CreateRemoteThread.cc","ms"}, 
+  {"func.VarBoolFromUI1.cc","ms"}, 
+  {"func.DebugSetProcessKillOnExit.cc","ms"}, 
+  {"func.EventWriteTransfer.cc","ms"}, 
+  {"func.ldap_modrdn2_sW.cc","ms"}, 
+  {"func.SHEmptyRecycleBinW.cc","ms"}, 
+  {"func.VarUI2FromCy.cc","ms"}, 
+  {"func.CreateHardLinkTransactedA.cc","ms"}, 
+  {"func.FindActCtxSectionStringW.cc","ms"}, 
+  {"func.ldap_get_valuesA.cc","ms"}, 
+  {"func.OpenMutexW.cc","ms"}, 
+  {"func.UrlCompareW.cc","ms"}, 
+  {"func.SysReAllocStringLen.cc","ms"}, 
+  {"func.CreateSymbolicLinkW.cc","ms"}, 
+  {"func.LookupAccountSidW.cc","ms"}, 
+  {"func.CreateThreadpoolWait.cc","ms"}, 
+  {"func.DispatchMessageA.cc","ms"}, 
+  {"func.DisassociateCurrentThreadFromCallback.cc","ms"}, 
+  {"func.DefMDIChildProcA.cc","ms"}, 
+  {"func.Beep.cc","ms"}, 
+  {"func.PowerSettingUnregisterNotification.cc","ms"}, 
+  {"func.GetGUIThreadInfo.cc","ms"}, 
+  {"func.SetCommConfig.cc","ms"}, 
+  {"func.GetCurrentInputMessageSource.cc","ms"}, 
+  {"func.VarBstrFromCy.cc","ms"}, 
+  {"func.DuplicateHandle.cc","ms"}, 
+  {"func.ldap_parse_result.cc","ms"}, 
+  {"func.CryptDecodeObject.cc","ms"}, 
+  {"func.PowerRegisterSuspendResumeNotification.cc","ms"}, 
+  {"func.WinHttpSetOption.cc","ms"}, 
+  {"func.CompareFileTime.cc","ms"}, 
+  {"func.CreatePrivateObjectSecurityEx.cc","ms"}, 
+  {"func.CoWaitForMultipleObjects.cc","ms"}, 
+  {"func.ImageList_Replace.cc","ms"}, 
+  {"func.ldap_add_sA.cc","ms"}, 
+  {"func.DosDateTimeToFileTime.cc","ms"}, 
+  {"func.InitializeSRWLock.cc","ms"}, 
+  {"func.GetLocaleInfoEx.cc","ms"}, 
+  {"func.InitiateShutdownW.cc","ms"}, 
+  {"func.QueryServiceDynamicInformation.cc","ms"}, 
+  {"func.CryptBinaryToStringA.cc","ms"}, 
+  {"func.SetProcessInformation.cc","ms"}, 
+  {"func.ldap_search_init_page.cc","ms"}, 
+  {"func.UrlGetLocationA.cc","ms"}, 
+  {"func.PathRemoveArgsW.cc","ms"}, 
+  {"func.GetFileVersionInfoExA.cc","ms"}, 
+  {"func.DeferWindowPos.cc","ms"}, 
+  {"func.ber_peek_tag.cc","ms"}, 
+  {"func.GetDlgItem.cc","ms"}, 
+  {"func.CryptRegisterOIDFunction.cc","ms"}, 
+  {"type.HICON.size","64"}, 
+  {"func.GetSystemTimes.cc","ms"}, 
+  {"func.VarAbs.cc","ms"}, 
+  {"func.ldap_deleteW.cc","ms"}, 
+  {"func.RegDisablePredefinedCache.cc","ms"}, 
+  {"func.SymGetSymFromName.cc","ms"}, 
+  {"func.CM_Get_Class_Property_Keys_Ex.cc","ms"}, 
+  {"func.DnsHostnameToComputerNameW.cc","ms"}, 
+  {"func.SendMessageCallbackW.cc","ms"}, 
+  {"func.CryptFindOIDInfo.cc","ms"}, 
+  {"func.AllocConsole.cc","ms"}, 
+  {"func.GetWindowInfo.cc","ms"}, 
+  {"func.LookupIconIdFromDirectoryEx.cc","ms"}, 
+  {"func.SymGetSourceVarFromToken.cc","ms"}, 
+  {"func.LoadCursorW.cc","ms"}, 
+  {"func.CM_Connect_MachineA.cc","ms"}, 
+  {"func.ImageList_SetImageCount.cc","ms"}, 
+  {"func.VarBstrFromUI2.cc","ms"}, 
+  {"func.Decompress.cc","ms"}, 
+  {"func.WriteConsoleW.cc","ms"}, 
+  {"func.WSAWaitForMultipleEvents.cc","ms"}, 
+  {"func.CoCreateInstance.cc","ms"}, 
+  {"func.IntlStrEqWorkerW.cc","ms"}, 
+  {"func.GetMenuState.cc","ms"}, 
+  {"func.StrCmpICW.cc","ms"}, 
+  {"func.UnmapViewOfFile2.cc","ms"}, 
+  {"func.SHDeleteValueA.cc","ms"}, 
+  {"func.CM_Set_DevNode_PropertyW.cc","ms"}, 
+  {"func.BCryptVerifySignature.cc","ms"}, 
+  {"func.ParseURLA.cc","ms"}, 
+  {"func.GetSecurityDescriptorRMControl.cc","ms"}, 
+  {"func.CM_Setup_DevNode_Ex.cc","ms"}, 
+  {"func.GetProcessId.cc","ms"}, 
+  {"func.SetTapeParameters.cc","ms"}, 
+  {"func.VarDateFromR8.cc","ms"}, 
+  {"func.ldap_get_dnW.cc","ms"}, 
+  {"func.UrlCombineW.cc","ms"}, 
+  {"func.RemoveDirectoryW.cc","ms"}, 
+  {"func.K32EnumPageFilesA.cc","ms"}, 
+  {"func.OemToCharBuffA.cc","ms"}, 
+  {"func.SHStripMneumonicW.cc","ms"}, 
+  {"func.SymSrvIsStoreW.cc","ms"}, 
+  {"func.GetAddrInfoExCancel.cc","ms"}, 
+  {"func.VarI2FromI8.cc","ms"}, 
+  {"func.GetSystemTimeAdjustmentPrecise.cc","ms"}, 
+  {"func.SHDeleteEmptyKeyA.cc","ms"}, 
+  {"func.MkParseDisplayName.cc","ms"}, 
+  {"func.CM_Get_HW_Prof_FlagsW.cc","ms"}, 
+  {"func.SafeArrayAllocData.cc","ms"}, 
+  {"func.GetUserDefaultLCID.cc","ms"}, 
+  {"func.VarBoolFromR8.cc","ms"}, 
+  {"func.CM_Connect_MachineW.cc","ms"}, 
+  {"func.GetApplicationRecoveryCallback.cc","ms"}, 
+  {"func.SymGetSymbolFile.cc","ms"}, 
+  {"func.QueryDosDeviceA.cc","ms"}, 
+  {"func.StgOpenAsyncDocfileOnIFillLockBytes.cc","ms"}, 
+  {"func.IsWow64GuestMachineSupported.cc","ms"}, 
+  {"func.CertFreeCertificateChain.cc","ms"}, 
+  {"func.ldap_addW.cc","ms"}, 
+  {"func.WriteConsoleA.cc","ms"}, 
+  {"func.QueryInformationJobObject.cc","ms"}, 
+  {"func.RegLoadMUIStringA.cc","ms"}, 
+  {"func.GetFileAttributesTransactedW.cc","ms"}, 
+  {"func.GetXStateFeaturesMask.cc","ms"}, 
+  {"func.CM_Get_Res_Des_Data.cc","ms"}, 
+  {"func.ldap_controls_freeA.cc","ms"}, 
+  {"func.CryptSignMessage.cc","ms"}, 
+  {"func.EraseTape.cc","ms"}, 
+  {"func.GetVolumeInformationByHandleW.cc","ms"}, 
+  {"func.FileTimeToSystemTime.cc","ms"}, 
+  {"func.SetConsoleCursorPosition.cc","ms"}, 
+  {"func.FatalAppExitA.cc","ms"}, 
+  {"func.MoveFileTransactedW.cc","ms"}, 
+  {"func.NSPStartup.cc","ms"}, 
+  {"func.OpenEventA.cc","ms"}, 
+  {"func.WinHttpCrackUrl.cc","ms"}, 
+  {"func.ldap_connect.cc","ms"}, 
+  {"func.IStream_ReadPidl.cc","ms"}, 
+  {"func.NotifyChangeEventLog.cc","ms"}, 
+  {"func.SetGestureConfig.cc","ms"}, 
+  {"func.NCryptVerifySignature.cc","ms"}, 
+  {"func.SetConsoleTitleA.cc","ms"}, 
+  {"func.PhysicalToLogicalPointForPerMonitorDPI.cc","ms"}, 
+  {"func.SHStripMneumonicA.cc","ms"}, 
+  {"func.ldap_first_entry.cc","ms"}, 
+  {"func.SymGetLineFromAddr64.cc","ms"}, 
+  {"func.SetErrorInfo.cc","ms"}, 
+  {"func.BCryptSetProperty.cc","ms"}, 
+  {"func.ResetDecompressor.cc","ms"}, 
+  {"func.EncodePointer.cc","ms"}, 
+  {"func.CertAddRefServerOcspResponseContext.cc","ms"}, 
+  {"func.CryptRegisterDefaultOIDFunction.cc","ms"}, 
+  {"func.VarCyFromUI1.cc","ms"}, 
+  {"func.ImageList_SetDragCursorImage.cc","ms"}, 
+  {"func.CertDuplicateStore.cc","ms"}, 
+  {"func.VarI1FromI8.cc","ms"}, 
+  {"func.SetThreadDesktop.cc","ms"}, 
+  {"func.ConvertStringSecurityDescriptorToSecurityDescriptorW.cc","ms"}, 
+  {"func.WSASetBlockingHook.cc","ms"}, 
+  {"func.CredIsMarshaledCredentialA.cc","ms"}, 
+  {"func.GetGeoInfoEx.cc","ms"}, 
+  {"func.K32GetWsChangesEx.cc","ms"}, 
+  {"func.StartServiceCtrlDispatcherA.cc","ms"}, 
+  {"func.WSCUpdateProvider.cc","ms"}, 
+  {"func.WSARecv.cc","ms"}, 
+  {"func.PostMessageW.cc","ms"}, 
+  {"func.VarUI1FromBool.cc","ms"}, 
+  {"func.VarUI4FromUI1.cc","ms"}, 
+  {"func.WSCEnumProtocols32.cc","ms"}, 
+  {"func.DlgDirSelectComboBoxExW.cc","ms"}, 
+  {"func.GetModuleFileNameW.cc","ms"}, 
+  {"func.RemoveTraceCallback.cc","ms"}, 
+  {"func.GetFileSize.cc","ms"}, 
+  {"func.AreAllAccessesGranted.cc","ms"}, 
+  {"func.GetProcessInformation.cc","ms"}, 
+  {"func.PathCreateFromUrlW.cc","ms"}, 
+  {"func.EvaluateProximityToPolygon.cc","ms"}, 
+  {"func.ldap_start_tls_sW.cc","ms"}, 
+  {"func.RegDeleteKeyTransactedA.cc","ms"}, 
+  {"func.WSAJoinLeaf.cc","ms"}, 
+  {"func.EnumCalendarInfoExW.cc","ms"}, 
+  {"func.CM_Get_Sibling_Ex.cc","ms"}, 
+  {"func.StrCatBuffA.cc","ms"}, 
+  {"func.PowerWriteACValueIndex.cc","ms"}, 
+  {"func.SignalObjectAndWait.cc","ms"}, 
+  {"func.QueryDisplayConfig.cc","ms"}, 
+  {"func.SymSetParentWindow.cc","ms"}, 
+  {"func.GlobalFindAtomW.cc","ms"}, 
+  {"func.AbortSystemShutdownW.cc","ms"}, 
+  {"func.Wow64DisableWow64FsRedirection.cc","ms"}, 
+  {"func.CreateRemoteThreadEx.cc","ms"}, 
+  {"func.CoLoadLibrary.cc","ms"}, 
+  {"func.wvnsprintfW.cc","ms"}, 
+  {"func.SymSrvDeltaName.cc","ms"}, 
+  {"func.ReadConsoleOutputCharacterW.cc","ms"}, 
+  {"func.PowerGetActiveScheme.cc","ms"}, 
+  {"func.CreateJobSet.cc","ms"}, 
+  {"func.CoRegisterActivationFilter.cc","ms"}, 
+  {"func.WSCInstallProviderAndChains64_32.cc","ms"}, 
+  {"func.SymGetHomeDirectory.cc","ms"}, 
+  {"func.SetCalendarInfoW.cc","ms"}, 
+  {"func.IsHungAppWindow.cc","ms"}, 
+  {"func.EnumDirTreeW.cc","ms"}, 
+  {"func.IsWindow.cc","ms"}, 
+  {"func.GetClassLongPtrW.cc","ms"}, 
+  {"func.CreateThreadpoolTimer.cc","ms"}, 
+  {"func.EnumWindows.cc","ms"}, 
+  {"func.CreateThreadpool.cc","ms"}, 
+  {"func.GetProcessDefaultLayout.cc","ms"}, 
+  {"func.SymAddSymbolW.cc","ms"}, 
+  {"func.SymGetModuleBase64.cc","ms"}, 
+  {"func.SymEnumSourceFiles.cc","ms"}, 
+  {"func.CM_Query_And_Remove_SubTreeW.cc","ms"}, 
+  {"func.CoGetObjectContext.cc","ms"}, 
+  {"func.EnumSystemLanguageGroupsA.cc","ms"}, 
+  {"func.SHRegGetPathW.cc","ms"}, 
+  {"func.GetEnvironmentVariableW.cc","ms"}, 
+  {"func.UrlEscapeA.cc","ms"}, 
+  {"func.GetDC.cc","ms"}, 
+  {"func.MenuItemFromPoint.cc","ms"}, 
+  {"func.EventWriteString.cc","ms"}, 
+  {"func.getservbyname.cc","ms"}, 
+  {"func.GetDoubleClickTime.cc","ms"}, 
+  {"func.SymGetOptions.cc","ms"}, 
+  {"func.SetFileAttributesTransactedA.cc","ms"}, 
+  {"func.SetSecurityDescriptorGroup.cc","ms"}, 
+  {"func.CreateFileMappingNumaA.cc","ms"}, 
+  {"func.GetNamedPipeServerProcessId.cc","ms"}, 
+  {"func.CreateDesktopExW.cc","ms"}, 
+  {"func.VarCyInt.cc","ms"}, 
+  {"func.CloseEventLog.cc","ms"}, 
+  {"func.SetFilePointerEx.cc","ms"}, 
+  {"func.CoReleaseMarshalData.cc","ms"}, 
+  {"func.CM_Free_Res_Des.cc","ms"}, 
+  {"func.ReadConsoleOutputCharacterA.cc","ms"}, 
+  {"func.SymFindFileInPath.cc","ms"}, 
+  {"func.ldap_modify_sW.cc","ms"}, 
+  {"func.VarCySub.cc","ms"}, 
+  {"func.VarI4FromUI1.cc","ms"}, 
+  {"func.SymGetLineFromInlineContextW.cc","ms"}, 
+  {"func.VarCyFix.cc","ms"}, 
+  {"func.CredReadDomainCredentialsA.cc","ms"}, 
+  {"func.CM_Find_Range.cc","ms"}, 
+  {"func.DispInvoke.cc","ms"}, 
+  {"func.RegisterTraceGuidsW.cc","ms"}, 
+  {"func.CryptGetKeyParam.cc","ms"}, 
+  {"func.WinHttpWriteProxySettings.cc","ms"}, 
+  {"func.CreateUmsThreadContext.cc","ms"}, 
+  {"func.CreateFileMoniker.cc","ms"}, 
+  {"func.DefDlgProcW.cc","ms"}, 
+  {"func.WritePrivateProfileStructA.cc","ms"}, 
+  {"func.VarUI1FromI2.cc","ms"}, 
+  {"func.SetNamedPipeHandleState.cc","ms"}, 
+  {"func.CM_Get_Device_ID_List_Size_ExA.cc","ms"}, 
+  {"func.OpenPrivateNamespaceA.cc","ms"}, 
+  {"func.WSASetServiceW.cc","ms"}, 
+  {"func.SetConsoleTextAttribute.cc","ms"}, 
+  {"func.LookupAccountSidA.cc","ms"}, 
+  {"func.IsMenu.cc","ms"}, 
+  {"func.Shell_NotifyIconA.cc","ms"}, 
+  {"func.ChangeWindowMessageFilterEx.cc","ms"}, 
+  {"func.SHRegCloseUSKey.cc","ms"}, 
+  {"func.GetProcessIdOfThread.cc","ms"}, 
+  {"func.CM_Query_And_Remove_SubTreeA.cc","ms"}, 
+  {"func.PowerDeterminePlatformRoleEx.cc","ms"}, 
+  {"func.ntohd.cc","ms"}, 
+  {"func.VariantCopyInd.cc","ms"}, 
+  {"func.QueryThreadCycleTime.cc","ms"}, 
+  {"func.WaitForSingleObject.cc","ms"}, 
+  {"func.InsertMenuA.cc","ms"}, 
+  {"func.InitializeCriticalSectionAndSpinCount.cc","ms"}, 
+  {"func.LoadMenuIndirectA.cc","ms"}, 
+  {"func.SymGetSourceFileFromTokenW.cc","ms"}, 
+  {"func.RegOpenKeyTransactedA.cc","ms"}, 
+  {"func.SetErrorMode.cc","ms"}, 
+  {"func.PathFindExtensionA.cc","ms"}, 
+  {"func.RtlDeleteGrowableFunctionTable.cc","ms"}, 
+  {"func.CM_Get_Log_Conf_Priority_Ex.cc","ms"}, 
+  {"func.RegisterServiceCtrlHandlerExA.cc","ms"}, 
+  {"func.NCryptStreamOpenToUnprotectEx.cc","ms"}, 
+  {"func.VarCyAbs.cc","ms"}, 
+  {"func.GetComputerNameA.cc","ms"}, 
+  {"func.PathCombineW.cc","ms"}, 
+  {"func.SetEnvironmentStringsA.cc","ms"}, 
+  {"func.GetFileInformationByHandleEx.cc","ms"}, 
+  {"func.CertControlStore.cc","ms"}, 
+  {"func.CheckTokenCapability.cc","ms"}, 
+  {"func.WaitForThreadpoolWorkCallbacks.cc","ms"}, 
+  {"func.EnableThreadProfiling.cc","ms"}, 
+  {"func.WSAEnumNameSpaceProvidersA.cc","ms"}, 
+  {"func.ldap_init.cc","ms"}, 
+  {"func.GetConsoleTitleA.cc","ms"}, 
+  {"func.GetFileAttributesA.cc","ms"}, 
+  {"func.CM_MapCrToWin32Err.cc","ms"}, 
+  {"func.CreateStdProgressIndicator.cc","ms"}, 
+  {"func.ldap_set_option.cc","ms"}, 
+  {"func.ExtractAssociatedIconW.cc","ms"}, 
+  {"func.GetCurrentThreadStackLimits.cc","ms"}, 
+  {"func.ldap_escape_filter_elementA.cc","ms"}, 
+  {"func.LoadBitmapA.cc","ms"}, 
+  {"func.CertEnumCRLContextProperties.cc","ms"}, 
+  {"func.GetConsoleCP.cc","ms"}, 
+  {"func.StrFormatKBSizeW.cc","ms"}, 
+  {"func.keybd_event.cc","ms"}, 
+  {"type.HKEY.size","64"}, 
+  {"func.CertGetCTLContextProperty.cc","ms"}, 
+  {"func.Wow64RevertWow64FsRedirection.cc","ms"}, 
+  {"func.RegDeleteTreeW.cc","ms"}, 
+  {"func.VarUI8FromI1.cc","ms"}, 
+  {"func.WSAAdvertiseProvider.cc","ms"}, 
+  {"func.GetDiskFreeSpaceA.cc","ms"}, 
+  {"func.GetPointerDeviceRects.cc","ms"}, 
+  {"func.VarUI8FromStr.cc","ms"}, 
+  {"func.SHSetThreadRef.cc","ms"}, 
+  {"func.FindResourceW.cc","ms"}, 
+  {"func.WinHttpQueryAuthSchemes.cc","ms"}, 
+  {"func.MultiByteToWideChar.cc","ms"}, 
+  {"func.EndDialog.cc","ms"}, 
+  {"func.WinHttpIsHostInProxyBypassList.cc","ms"}, 
+  {"func.VariantTimeToSystemTime.cc","ms"}, 
+  {"func.DefineDosDeviceW.cc","ms"}, 
+  {"func.LocalUnlock.cc","ms"}, 
+  {"func.FindFirstStreamTransactedW.cc","ms"}, 
+  {"func.ldap_add_extA.cc","ms"}, 
+  {"func.VarI1FromCy.cc","ms"}, 
+  {"func.GetProcessMemoryInfo.cc","ms"}, 
+  {"func.SafeArrayDestroy.cc","ms"}, 
+  {"func.GetTimeFormatEx.cc","ms"}, 
+  {"func.GetStringTypeExA.cc","ms"}, 
+  {"type.HFONT.size","64"}, 
+  {"func.htonf.cc","ms"}, 
+  {"func.SHRegWriteUSValueA.cc","ms"}, 
+  {"func.SymGetModuleInfo.cc","ms"}, 
+  {"func.CM_Get_Device_ID_ListA.cc","ms"}, 
+  {"func.EnumServicesStatusW.cc","ms"}, 
+  {"func.CryptEnumOIDInfo.cc","ms"}, 
+  {"func.CreateStreamOnHGlobal.cc","ms"}, 
+  {"func.SetVolumeLabelW.cc","ms"}, 
+  {"func.ReleaseMutex.cc","ms"}, 
+  {"func.GetLongPathNameTransactedW.cc","ms"}, 
+  {"func.CreateDialogIndirectParamW.cc","ms"}, 
+  {"func.StrChrIW.cc","ms"}, 
+  {"func.VirtualFree.cc","ms"}, 
+  {"func.VarI2FromUI1.cc","ms"}, 
+  {"func.RegReplaceKeyW.cc","ms"}, 
+  {"func.WSAProviderCompleteAsyncCall.cc","ms"}, 
+  {"func.SHQueryValueExW.cc","ms"}, 
+  {"func.CreateProcessWithLogonW.cc","ms"}, 
+  {"func.TaskDialog.cc","ms"}, 
+  {"func.QueryDosDeviceW.cc","ms"}, 
+  {"func.VarI8FromI1.cc","ms"}, 
+  {"func.GetBinaryTypeW.cc","ms"}, 
+  {"func.QueryServiceConfig2W.cc","ms"}, 
+  {"func.closesocket.cc","ms"}, 
+  {"func.CreatePrivateObjectSecurity.cc","ms"}, 
+  {"func.LCMapStringEx.cc","ms"}, 
+  {"func.LoadCursorFromFileA.cc","ms"}, 
+  {"func.GetProcessTimes.cc","ms"}, 
+  {"func.WindowFromDC.cc","ms"}, 
+  {"func.BCryptDeleteContext.cc","ms"}, 
+  {"func.SHRegQueryInfoUSKeyW.cc","ms"}, 
+  {"func.VarBstrFromUI1.cc","ms"}, 
+  {"func.CredEnumerateW.cc","ms"}, 
+  {"func.GetProcessMitigationPolicy.cc","ms"}, 
+  {"func.VarI8FromI2.cc","ms"}, 
+  {"func.GetAllUsersProfileDirectoryA.cc","ms"}, 
+  {"func.MessageBoxExA.cc","ms"}, 
+  {"func.ldap_compare_extA.cc","ms"}, 
+  {"func.CM_Uninstall_DevNode.cc","ms"}, 
+  {"func.CreatePipe.cc","ms"}, 
+  {"func.PathIsSystemFolderA.cc","ms"}, 
+  {"func.SetWindowsHookA.cc","ms"}, 
+  {"func.SHCreateThreadWithHandle.cc","ms"}, 
+  {"type.HRSRC.size","64"}, 
+  {"func.SetRectEmpty.cc","ms"}, 
+  {"func.SymFromAddr.cc","ms"}, 
+  {"func.CM_Free_Res_Des_Ex.cc","ms"}, 
+  {"func.BstrFromVector.cc","ms"}, 
+  {"func.VarCyAdd.cc","ms"}, 
+  {"func.RegReplaceKeyA.cc","ms"}, 
+  {"func.CryptVerifyDetachedMessageHash.cc","ms"}, 
+  {"func.ImpersonateNamedPipeClient.cc","ms"}, 
+  {"func.CredUnPackAuthenticationBufferA.cc","ms"}, 
+  {"func.SafeArrayReleaseDescriptor.cc","ms"}, 
+  {"func.SetEventWhenCallbackReturns.cc","ms"}, 
+  {"func.FreePropVariantArray.cc","ms"}, 
+  {"func.QueryUnbiasedInterruptTimePrecise.cc","ms"}, 
+  {"func.PathRemoveBlanksA.cc","ms"}, 
+  {"func.InSendMessageEx.cc","ms"}, 
+  {"func.CreateWindowStationA.cc","ms"}, 
+  {"func.ImageDirectoryEntryToDataEx.cc","ms"}, 
+  {"func.GetShortPathNameW.cc","ms"}, 
+  {"func.CM_Set_Class_Property_ExW.cc","ms"}, 
+  {"func.VarUI4FromR8.cc","ms"}, 
+  {"func.SystemParametersInfoW.cc","ms"}, 
+  {"func.DebugBreakProcess.cc","ms"}, 
+  {"func.ldap_count_values.cc","ms"}, 
+  {"func.VarDateFromUI8.cc","ms"}, 
+  {"func.LoadCursorFromFileW.cc","ms"}, 
+  {"func.CallMsgFilterA.cc","ms"}, 
+  {"func.K32EnumProcessModulesEx.cc","ms"}, 
+  {"func.RegSetValueW.cc","ms"}, 
+  {"func.CoGetObject.cc","ms"}, 
+  {"func.PathRemoveExtensionW.cc","ms"}, 
+  {"func.DlgDirSelectComboBoxExA.cc","ms"}, 
+  {"func.VarPow.cc","ms"}, 
+  {"func.EnumResourceTypesA.cc","ms"}, 
+  {"func.CryptEncodeObjectEx.cc","ms"}, 
+  {"func.CreateErrorInfo.cc","ms"}, 
+  {"func.K32GetModuleFileNameExW.cc","ms"}, 
+  {"type.HCOLORSPACE.size","64"}, 
+  {"func.VarR8FromUI4.cc","ms"}, 
+  {"func.PathCchRemoveBackslash.cc","ms"}, 
+  {"func.ldap_control_free.cc","ms"}, 
+  {"func.PathCreateFromUrlA.cc","ms"}, 
+  {"func.EnumLanguageGroupLocalesW.cc","ms"}, 
+  {"func.CertFreeCertificateChainEngine.cc","ms"}, 
+  {"func.GetACP.cc","ms"}, 
+  {"func.InitializeSid.cc","ms"}, 
+  {"func.SetCursorPos.cc","ms"}, 
+  {"func.CallbackMayRunLong.cc","ms"}, 
+  {"func.CryptFlushTimeValidObject.cc","ms"}, 
+  {"func.VarParseNumFromStr.cc","ms"}, 
+  {"func.MakeSelfRelativeSD.cc","ms"}, 
+  {"func.GetTraceEnableFlags.cc","ms"}, 
+  {"func.freeaddrinfo.cc","ms"}, 
+  {"func.VarOr.cc","ms"}, 
+  {"func.ldap_memfreeW.cc","ms"}, 
+  {"func.LoadUserProfileW.cc","ms"}, 
+  {"func.VariantClear.cc","ms"}, 
+  {"func.RegLoadAppKeyW.cc","ms"}, 
+  {"func.FlatSB_GetScrollInfo.cc","ms"}, 
+  {"func.VarUI4FromI1.cc","ms"}, 
+  {"func.EnumDisplayMonitors.cc","ms"}, 
+  {"func.WSCUnInstallNameSpace32.cc","ms"}, 
+  {"func.SymGetFileLineOffsets64.cc","ms"}, 
+  {"func.SetClipboardData.cc","ms"}, 
+  {"func.GetCurrentProcessId.cc","ms"}, 
+  {"func.RegisterPointerDeviceNotifications.cc","ms"}, 
+  {"func.GetStdHandle.cc","ms"}, 
+  {"func.VarDateFromUdate.cc","ms"}, 
+  {"func.ldap_controls_free.cc","ms"}, 
+  {"func.SHGetTemporaryPropertyForItem.cc","ms"}, 
+  {"func.ldap_rename_ext.cc","ms"}, 
+  {"func.ChangeServiceConfigA.cc","ms"}, 
+  {"func.SetPropW.cc","ms"}, 
+  {"func.WTSGetActiveConsoleSessionId.cc","ms"}, 
+  {"func.ColorHLSToRGB.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_Alias_ExW.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_Property_KeysW.cc","ms"}, 
+  {"func.WSCSetApplicationCategory.cc","ms"}, 
+  {"func.ExtractIconExW.cc","ms"}, 
+  {"func.CM_Enumerate_EnumeratorsA.cc","ms"}, 
+  {"func.VarDecAbs.cc","ms"}, 
+  {"func.WinHttpWebSocketSend.cc","ms"}, 
+  {"func.UrlEscapeW.cc","ms"}, 
+  {"func.IsLFNDriveW.cc","ms"}, 
+  {"func.PathCchAddBackslash.cc","ms"}, 
+  {"func.TraceMessageVa.cc","ms"}, 
+  {"func.CloseThreadpool.cc","ms"}, 
+  {"func.SetCurrentDirectoryA.cc","ms"}, 
+  {"func.GetCPInfoExW.cc","ms"}, 
+  {"func.EnumerateLoadedModulesEx.cc","ms"}, 
+  {"func.PathIsURLA.cc","ms"}, 
+  {"func.SendMessageTimeoutA.cc","ms"}, 
+  {"func.SymEnumSourceFilesW.cc","ms"}, 
+  {"func.VarUI4FromUI2.cc","ms"}, 
+  {"func.CertAddEncodedCRLToStore.cc","ms"}, 
+  {"func.SHRegGetUSValueW.cc","ms"}, 
+  {"func.CM_Add_Range.cc","ms"}, 
+  {"func.RestoreLastError.cc","ms"}, 
+  {"func.VarCyFromI2.cc","ms"}, 
+  {"func.SymSetScopeFromIndex.cc","ms"}, 
+  {"func.EndDeferWindowPos.cc","ms"}, 
+  {"func.ImageList_LoadImageW.cc","ms"}, 
+  {"func.ScrollWindowEx.cc","ms"}, 
+  {"func.GetLargestConsoleWindowSize.cc","ms"}, 
+  {"func.CryptImportKey.cc","ms"}, 
+  {"func.WSACancelBlockingCall.cc","ms"}, 
+  {"func.WPUFDIsSet.cc","ms"}, 
+  {"func.QueryCompressorInformation.cc","ms"}, 
+  {"func.EnumDirTree.cc","ms"}, 
+  {"func.DecodeSystemPointer.cc","ms"}, 
+  {"func.VarDecFromStr.cc","ms"}, 
+  {"func.SHGetImageList.cc","ms"}, 
+  {"func.VarCyFromI1.cc","ms"}, 
+  {"func.ReadFileScatter.cc","ms"}, 
+  {"func.IsWinEventHookInstalled.cc","ms"}, 
+  {"func.ldap_search_init_pageW.cc","ms"}, 
+  {"func.getprotobyname.cc","ms"}, 
+  {"func.StrToInt64ExA.cc","ms"}, 
+  {"func.OleLoadPictureFileEx.cc","ms"}, 
+  {"func.GetInputState.cc","ms"}, 
+  {"func.StrFromTimeIntervalA.cc","ms"}, 
+  {"func.CM_Free_Resource_Conflict_Handle.cc","ms"}, 
+  {"func.GetVersionExA.cc","ms"}, 
+  {"func.StgGetIFillLockBytesOnILockBytes.cc","ms"}, 
+  {"func.GetMenuInfo.cc","ms"}, 
+  {"func.PathIsURLW.cc","ms"}, 
+  {"func.VarUI8FromR4.cc","ms"}, 
+  {"func.SizeofResource.cc","ms"}, 
+  {"func.FindFirstFileExA.cc","ms"}, 
+  {"func.WSAAsyncGetHostByAddr.cc","ms"}, 
+  {"func.TransactNamedPipe.cc","ms"}, 
+  {"func.SkipPointerFrameMessages.cc","ms"}, 
+  {"func.MapDialogRect.cc","ms"}, 
+  {"func.DlgDirListW.cc","ms"}, 
+  {"func.CM_Set_HW_Prof.cc","ms"}, 
+  {"func.GetDynamicTimeZoneInformation.cc","ms"}, 
+  {"func.SystemParametersInfoForDpi.cc","ms"}, 
+  {"func.SymUnDName64.cc","ms"}, 
+  {"func.SetDlgItemTextW.cc","ms"}, 
+  {"func.ldap_delete_ext_s.cc","ms"}, 
+  {"func.RegCloseKey.cc","ms"}, 
+  {"func.SetCoalescableTimer.cc","ms"}, 
+  {"func.GetGuiResources.cc","ms"}, 
+  {"func.ldap_encode_sort_controlA.cc","ms"}, 
+  {"func.CoRegisterChannelHook.cc","ms"}, 
+  {"type.LPTSTR.size","64"}, 
+  {"func.VariantInit.cc","ms"}, 
+  {"func.GetMenuItemID.cc","ms"}, 
+  {"func.QueryPerformanceFrequency.cc","ms"}, 
+  {"func.PathIsNetworkPathW.cc","ms"}, 
+  {"func.InitializeEnclave.cc","ms"}, 
+  {"func.CoCopyProxy.cc","ms"}, 
+  {"func.ValidateRgn.cc","ms"}, 
+  {"func.BuildCommDCBA.cc","ms"}, 
+  {"func.GetWindowTextW.cc","ms"}, 
+  {"func.CertRegisterPhysicalStore.cc","ms"}, 
+  {"func.ldap_delete_ext_sW.cc","ms"}, 
+  {"func.CharNextExA.cc","ms"}, 
+  {"func.GetVolumePathNamesForVolumeNameW.cc","ms"}, 
+  {"func.GetModuleHandleW.cc","ms"}, 
+  {"func.GetTapeParameters.cc","ms"}, 
+  {"func.CM_Get_Resource_Conflict_DetailsW.cc","ms"}, 
+  {"func.GetSidIdentifierAuthority.cc","ms"}, 
+  {"func.BCryptImportKey.cc","ms"}, 
+  {"func.UrlIsA.cc","ms"}, 
+  {"func.EventSetInformation.cc","ms"}, 
+  {"func.AdjustWindowRectEx.cc","ms"}, 
+  {"func.CertFindSubjectInCTL.cc","ms"}, 
+  {"func.OpenProcessToken.cc","ms"}, 
+  {"func.CopyFileTransactedA.cc","ms"}, 
+  {"func.VarR4FromBool.cc","ms"}, 
+  {"func.PathIsLFNFileSpecW.cc","ms"}, 
+  {"func.EnumSystemLocalesA.cc","ms"}, 
+  {"func.HashData.cc","ms"}, 
+  {"func.TerminateThread.cc","ms"}, 
+  {"func.CoEnableCallCancellation.cc","ms"}, 
+  {"func.GetThreadIOPendingFlag.cc","ms"}, 
+  {"func.SetCaretBlinkTime.cc","ms"}, 
+  {"func.CM_Request_Device_Eject_ExW.cc","ms"}, 
+  {"func.SHRegGetBoolValueFromHKCUHKLM.cc","ms"}, 
+  {"func.ber_flatten.cc","ms"}, 
+  {"func.SetFileShortNameW.cc","ms"}, 
+  {"func.SymSetOptions.cc","ms"}, 
+  {"func.GetDllDirectoryA.cc","ms"}, 
+  {"func.SymRegisterCallback.cc","ms"}, 
+  {"func.GetCachedSigningLevel.cc","ms"}, 
+  {"func.SHGetInverseCMAP.cc","ms"}, 
+  {"func.CertRegisterSystemStore.cc","ms"}, 
+  {"func.CloseTrace.cc","ms"}, 
+  {"func.CM_Add_Empty_Log_Conf_Ex.cc","ms"}, 
+  {"func.ImageList_ReplaceIcon.cc","ms"}, 
+  {"func.connect.cc","ms"}, 
+  {"func.GetMappedFileNameW.cc","ms"}, 
+  {"func.ldap_search_st.cc","ms"}, 
+  {"func.EndTask.cc","ms"}, 
+  {"func.ldap_encode_sort_controlW.cc","ms"}, 
+  {"func.GetNextDlgTabItem.cc","ms"}, 
+  {"func.SymGetSearchPathW.cc","ms"}, 
+  {"func.SetWaitableTimer.cc","ms"}, 
+  {"func.WinHttpGetProxyForUrl.cc","ms"}, 
+  {"func.PathCompactPathExW.cc","ms"}, 
+  {"func.ldap_compare_s.cc","ms"}, 
+  {"func.SymEnumLines.cc","ms"}, 
+  {"func.ShowOwnedPopups.cc","ms"}, 
+  {"func.NCryptIsKeyHandle.cc","ms"}, 
+  {"func.GetDlgItemInt.cc","ms"}, 
+  {"func.ldap_count_references.cc","ms"}, 
+  {"func.LocalFileTimeToFileTime.cc","ms"}, 
+  {"func.PathCchAddBackslashEx.cc","ms"}, 
+  {"func.PathStripPathA.cc","ms"}, 
+  {"func.GetDefaultCommConfigW.cc","ms"}, 
+  {"func.CryptMsgSignCTL.cc","ms"}, 
+  {"func.GetFreeSpace.cc","ms"}, 
+  {"func.HeapSetInformation.cc","ms"}, 
+  {"func.ldap_value_freeW.cc","ms"}, 
+  {"func.DeleteTimerQueue.cc","ms"}, 
+  {"func.SetDllDirectoryA.cc","ms"}, 
+  {"func.DeleteVolumeMountPointA.cc","ms"}, 
+  {"func.WriteConsoleOutputW.cc","ms"}, 
+  {"func.MessageBoxExW.cc","ms"}, 
+  {"func.LookupAccountSidLocalW.cc","ms"}, 
+  {"func.PathStripToRootW.cc","ms"}, 
+  {"func.VarDateFromDec.cc","ms"}, 
+  {"func.MulDiv.cc","ms"}, 
+  {"func.CM_Set_HW_Prof_FlagsA.cc","ms"}, 
+  {"func.CM_Open_Class_Key_ExA.cc","ms"}, 
+  {"func.ReadFileEx.cc","ms"}, 
+  {"func.K32QueryWorkingSetEx.cc","ms"}, 
+  {"func.FindWindowExW.cc","ms"}, 
+  {"func.GetFileBandwidthReservation.cc","ms"}, 
+  {"func.VirtualLock.cc","ms"}, 
+  {"func.GetUserDefaultLangID.cc","ms"}, 
+  {"func.mouse_event.cc","ms"}, 
+  {"func.EnumTimeFormatsW.cc","ms"}, 
+  {"func.CM_Get_Class_Property_ExW.cc","ms"}, 
+  {"func.ConvertToAutoInheritPrivateObjectSecurity.cc","ms"}, 
+  {"func.GetFirmwareType.cc","ms"}, 
+  {"func.ReadDirectoryChangesExW.cc","ms"}, 
+  {"func.WinHttpReadData.cc","ms"}, 
+  {"func.CM_Get_Version_Ex.cc","ms"}, 
+  {"func.AddVectoredExceptionHandler.cc","ms"}, 
+  {"func.AddConditionalAce.cc","ms"}, 
+  {"func.FillConsoleOutputAttribute.cc","ms"}, 
+  {"func.CloseDecompressor.cc","ms"}, 
+  {"func.CharPrevW.cc","ms"}, 
+  {"func.SetSystemFileCacheSize.cc","ms"}, 
+  {"func.CM_Locate_DevNode_ExA.cc","ms"}, 
+  {"func.GetTickCount.cc","ms"}, 
+  {"func.CertDuplicateCTLContext.cc","ms"}, 
+  {"func.SHCreateStreamOnFileA.cc","ms"}, 
+  {"func.CertGetServerOcspResponseContext.cc","ms"}, 
+  {"func.RegisterEventSourceA.cc","ms"}, 
+  {"func.SetWindowFeedbackSetting.cc","ms"}, 
+  {"func.FindNextVolumeMountPointW.cc","ms"}, 
+  {"func.CreateTimerQueue.cc","ms"}, 
+  {"func.VarCyFromStr.cc","ms"}, 
+  {"func.ldap_dn2ufn.cc","ms"}, 
+  {"func.htond.cc","ms"}, 
+  {"func.CoRegisterSurrogate.cc","ms"}, 
+  {"func.QueryAuxiliaryCounterFrequency.cc","ms"}, 
+  {"func.PathFindNextComponentW.cc","ms"}, 
+  {"func.CertSerializeCertificateStoreElement.cc","ms"}, 
+  {"func.CM_Disconnect_Machine.cc","ms"}, 
+  {"func.DeleteTimerQueueTimer.cc","ms"}, 
+  {"func.SHEvaluateSystemCommandTemplate.cc","ms"}, 
+  {"func.VarBstrFromI8.cc","ms"}, 
+  {"func.RsopSetPolicySettingStatus.cc","ms"}, 
+  {"func.SetClassLongPtrW.cc","ms"}, 
+  {"func.GetKeyboardLayoutNameA.cc","ms"}, 
+  {"type.HDWP.size","64"}, 
+  {"func.LookupAccountNameA.cc","ms"}, 
+  {"func.ImageList_WriteEx.cc","ms"}, 
+  {"func.EnterCriticalSection.cc","ms"}, 
+  {"func.GetProcessorSystemCycleTime.cc","ms"}, 
+  {"func.PathBuildRootA.cc","ms"}, 
+  {"func.DefRawInputProc.cc","ms"}, 
+  {"func.SafeArrayGetElemsize.cc","ms"}, 
+  {"func.GetModuleInformation.cc","ms"}, 
+  {"func.LoadUserProfileA.cc","ms"}, 
+  {"func.DeriveCapabilitySidsFromName.cc","ms"}, 
+  {"func.SymInitializeW.cc","ms"}, 
+  {"func.CreateWaitableTimerA.cc","ms"}, 
+  {"func.UnregisterScaleChangeEvent.cc","ms"}, 
+  {"func.CM_Get_Device_ID_Size_Ex.cc","ms"}, 
+  {"func.UnDecorateSymbolNameW.cc","ms"}, 
+  {"func.ExpandEnvironmentStringsForUserW.cc","ms"}, 
+  {"func.TraceSetInformation.cc","ms"}, 
+  {"func.GetTempFileNameA.cc","ms"}, 
+  {"func.NeedCurrentDirectoryForExePathW.cc","ms"}, 
+  {"func.SafeArrayCopy.cc","ms"}, 
+  {"func.CertVerifyCRLRevocation.cc","ms"}, 
+  {"func.PackTouchHitTestingProximityEvaluation.cc","ms"}, 
+  {"func.VarDecRound.cc","ms"}, 
+  {"func.CreateHardLinkTransactedW.cc","ms"}, 
+  {"func.FindActCtxSectionStringA.cc","ms"}, 
+  {"func.SymLoadModuleEx.cc","ms"}, 
+  {"func.SetUserGeoID.cc","ms"}, 
+  {"func.ldap_get_valuesW.cc","ms"}, 
+  {"func.FindNextVolumeMountPointA.cc","ms"}, 
+  {"func.RegisterTouchWindow.cc","ms"}, 
+  {"func.CreateSymbolicLinkA.cc","ms"}, 
+  {"func.Wow64SetThreadDefaultGuestMachine.cc","ms"}, 
+  {"func.WSANSPIoctl.cc","ms"}, 
+  {"func.CertEnumCertificateContextProperties.cc","ms"}, 
+  {"func.PFXImportCertStore.cc","ms"}, 
+  {"func.GetModuleBaseNameA.cc","ms"}, 
+  {"func.SetLocaleInfoW.cc","ms"}, 
+  {"func.CM_Locate_DevNodeW.cc","ms"}, 
+  {"func.CryptHashToBeSigned.cc","ms"}, 
+  {"func.SetCurrentDirectoryW.cc","ms"}, 
+  {"func.InterlockedPushListSListEx.cc","ms"}, 
+  {"func.GetMenuStringW.cc","ms"}, 
+  {"func.ColorAdjustLuma.cc","ms"}, 
+  {"func.RegisterServiceCtrlHandlerA.cc","ms"}, 
+  {"func.BCryptEnumContexts.cc","ms"}, 
+  {"func.GetAddressByNameW.cc","ms"}, 
+  {"func.GetThreadSelectorEntry.cc","ms"}, 
+  {"func.SHGlobalCounterDecrement.cc","ms"}, 
+  {"func.RegNotifyChangeKeyValue.cc","ms"}, 
+  {"func.PathBuildRootW.cc","ms"}, 
+  {"func.ApplicationRecoveryFinished.cc","ms"}, 
+  {"func.CryptSetProvParam.cc","ms"}, 
+  {"func.EncodeRemotePointer.cc","ms"}, 
+  {"func.CreateTypeLib2.cc","ms"}, 
+  {"func.EnumerateLoadedModulesExW.cc","ms"}, 
+  {"func.FileTimeToDosDateTime.cc","ms"}, 
+  {"func.CompareStringEx.cc","ms"}, 
+  {"func.CreatePrivateNamespaceW.cc","ms"}, 
+  {"func.CM_Get_HW_Prof_Flags_ExA.cc","ms"}, 
+  {"func.TlsGetValue.cc","ms"}, 
+  {"func.SHLockShared.cc","ms"}, 
+  {"func.AllocateUserPhysicalPagesNuma.cc","ms"}, 
+  {"func.FindNextFileA.cc","ms"}, 
+  {"func.ldap_unbind_s.cc","ms"}, 
+  {"func.StrToInt64ExW.cc","ms"}, 
+  {"func.CertEnumSystemStoreLocation.cc","ms"}, 
+  {"func.StrCmpNIA.cc","ms"}, 
+  {"func.CM_Set_DevNode_Problem.cc","ms"}, 
+  {"func.StrCmpICA.cc","ms"}, 
+  {"func.CM_Enumerate_Enumerators_ExA.cc","ms"}, 
+  {"func.UnlockFileEx.cc","ms"}, 
+  {"func.DeregisterEventSource.cc","ms"}, 
+  {"func.SetDlgItemInt.cc","ms"}, 
+  {"func.CertSetEnhancedKeyUsage.cc","ms"}, 
+  {"func.VarI2FromDisp.cc","ms"}, 
+  {"func.GetFinalPathNameByHandleW.cc","ms"}, 
+  {"func.SwitchToFiber.cc","ms"}, 
+  {"func.VarUI2FromI8.cc","ms"}, 
+  {"func.WSCEnumProtocols.cc","ms"}, 
+  {"func.DecodePointer.cc","ms"}, 
+  {"func.GetWindowTextLengthW.cc","ms"}, 
+  {"func.PathCchStripToRoot.cc","ms"}, 
+  {"func.VarI1FromDec.cc","ms"}, 
+  {"func.ParseURLW.cc","ms"}, 
+  {"func.GetUserNameExA.cc","ms"}, 
+  {"func.GetCurrentDirectoryA.cc","ms"}, 
+  {"func.DisplayConfigGetDeviceInfo.cc","ms"}, 
+  {"func.RemoveSecureMemoryCacheCallback.cc","ms"}, 
+  {"func.GetCommandLineA.cc","ms"}, 
+  {"func.CM_Disable_DevNode_Ex.cc","ms"}, 
+  {"func.EnumDateFormatsExA.cc","ms"}, 
+  {"func.PathCompactPathW.cc","ms"}, 
+  {"func.RefreshPolicyEx.cc","ms"}, 
+  {"func.CM_Get_Device_IDA.cc","ms"}, 
+  {"func.CredUIPromptForCredentialsA.cc","ms"}, 
+  {"func.SendDlgItemMessageA.cc","ms"}, 
+  {"func.RegQueryReflectionKey.cc","ms"}, 
+  {"func.CryptHashCertificate2.cc","ms"}, 
+  {"func.ldap_parse_page_control.cc","ms"}, 
+  {"func.CreateProcessAsUserW.cc","ms"}, 
+  {"func.GetPointerDeviceCursors.cc","ms"}, 
+  {"func.ber_first_element.cc","ms"}, 
+  {"func.PathIsRootA.cc","ms"}, 
+  {"type.HMODULE.size","64"}, 
+  {"func.SetCursor.cc","ms"}, 
+  {"func.CreateServiceA.cc","ms"}, 
+  {"func.GetDevicePowerState.cc","ms"}, 
+  {"func.CreatePrivateNamespaceA.cc","ms"}, 
+  {"func.SymFromNameW.cc","ms"}, 
+  {"func.StrRChrW.cc","ms"}, 
+  {"func.ConvertThreadToFiber.cc","ms"}, 
+  {"func.SymFindDebugInfoFile.cc","ms"}, 
+  {"func.getpeername.cc","ms"}, 
+  {"func.GetMonitorInfoA.cc","ms"}, 
+  {"func.GetListBoxInfo.cc","ms"}, 
+  {"func.SetProcessPreferredUILanguages.cc","ms"}, 
+  {"func.AssocQueryKeyW.cc","ms"}, 
+  {"func.SetFileTime.cc","ms"}, 
+  {"func.CalculatePopupWindowPosition.cc","ms"}, 
+  {"func.CommConfigDialogW.cc","ms"}, 
+  {"func.AssocQueryStringA.cc","ms"}, 
+  {"func.GetCurrentProcess.cc","ms"}, 
+  {"func.CertFindCertificateInCRL.cc","ms"}, 
+  {"func.GetDialogBaseUnits.cc","ms"}, 
+  {"func.VarI8FromUI2.cc","ms"}, 
+  {"func.CredGetTargetInfoW.cc","ms"}, 
+  {"func.WSASetLastError.cc","ms"}, 
+  {"func.lstrlenA.cc","ms"}, 
+  {"func.Wow64SetThreadContext.cc","ms"}, 
+  {"func.StrCmpNICA.cc","ms"}, 
+  {"func.RegisterClipboardFormatA.cc","ms"}, 
+  {"func.GetUserNameExW.cc","ms"}, 
+  {"func.CryptGetOIDFunctionValue.cc","ms"}, 
+  {"func.VarR8FromI8.cc","ms"}, 
+  {"func.FatalAppExitW.cc","ms"}, 
+  {"func.GetGestureExtraArgs.cc","ms"}, 
+  {"func.ldap_add_s.cc","ms"}, 
+  {"func.StrToIntExA.cc","ms"}, 
+  {"func.VerInstallFileW.cc","ms"}, 
+  {"func.gethostname.cc","ms"}, 
+  {"func.GetCurrentUmsThread.cc","ms"}, 
+  {"func.SetClassLongW.cc","ms"}, 
+  {"func.NCryptEnumAlgorithms.cc","ms"}, 
+  {"func.EnumDisplaySettingsExA.cc","ms"}, 
+  {"func.GetAppContainerAce.cc","ms"}, 
+  {"func.GetConsoleMode.cc","ms"}, 
+  {"func.ldap_parse_vlv_controlW.cc","ms"}, 
+  {"func.GlobalUnWire.cc","ms"}, 
+  {"func.ber_init.cc","ms"}, 
+  {"func.AddSecureMemoryCacheCallback.cc","ms"}, 
+  {"func.WritePrivateProfileStringA.cc","ms"}, 
+  {"func.GetNextUmsListItem.cc","ms"}, 
+  {"func.VarI4FromBool.cc","ms"}, 
+  {"func.CryptDecodeObjectEx.cc","ms"}, 
+  {"func.GetDesktopWindow.cc","ms"}, 
+  {"func.CryptInstallOIDFunctionAddress.cc","ms"}, 
+  {"func.GetAce.cc","ms"}, 
+  {"func.lstrcatW.cc","ms"}, 
+  {"func.ScrollWindow.cc","ms"}, 
+  {"func.WSALookupServiceNextW.cc","ms"}, 
+  {"func.GetMonitorInfoW.cc","ms"}, 
+  {"func.BringWindowToTop.cc","ms"}, 
+  {"func.VarI8FromDec.cc","ms"}, 
+  {"func.CreateDesktopA.cc","ms"}, 
+  {"func.CompareStringA.cc","ms"}, 
+  {"func.PeekMessageW.cc","ms"}, 
+  {"func.GetProcAddress.cc","ms"}, 
+  {"func.CryptAcquireCertificatePrivateKey.cc","ms"}, 
+  {"func.VarI8FromDisp.cc","ms"}, 
+  {"func.CreateHardLinkW.cc","ms"}, 
+  {"func.lstrcpyW.cc","ms"}, 
+  {"func.GetDeviceDriverBaseNameW.cc","ms"}, 
+  {"func.ControlServiceExW.cc","ms"}, 
+  {"func.WriteConsoleOutputA.cc","ms"}, 
+  {"func.GetCompressedFileSizeTransactedW.cc","ms"}, 
+  {"func.FindFirstFileW.cc","ms"}, 
+  {"func.ldap_search_ext_sA.cc","ms"}, 
+  {"func.PathStripToRootA.cc","ms"}, 
+  {"func.GetCompressedFileSizeW.cc","ms"}, 
+  {"func.LoadImageW.cc","ms"}, 
+  {"func.SetProcessDPIAware.cc","ms"}, 
+  {"func.CreateActCtxA.cc","ms"}, 
+  {"func.GetQueuedCompletionStatus.cc","ms"}, 
+  {"func.FindWindowExA.cc","ms"}, 
+  {"func.VarI8FromDate.cc","ms"}, 
+  {"func.LCIDToLocaleName.cc","ms"}, 
+  {"func.ShellMessageBoxW.cc","ms"}, 
+  {"func.SymFromAddrW.cc","ms"}, 
+  {"func.CM_Get_Device_ID_Size.cc","ms"}, 
+  {"func.WinHttpWebSocketClose.cc","ms"}, 
+  {"func.SymEnumSymbolsW.cc","ms"}, 
+  {"func.VarR8Pow.cc","ms"}, 
+  {"func.VarR4FromI1.cc","ms"}, 
+  {"func.NCryptDeleteKey.cc","ms"}, 
+  {"func.SHCreateThreadRef.cc","ms"}, 
+  {"func.LocalSize.cc","ms"}, 
+  {"func.GetComboBoxInfo.cc","ms"}, 
+  {"func.StrNCatA.cc","ms"}, 
+  {"func.OpenClipboard.cc","ms"}, 
+  {"func.ImageList_Remove.cc","ms"}, 
+  {"func.FindStringOrdinal.cc","ms"}, 
+  {"func.CM_Locate_DevNode_ExW.cc","ms"}, 
+  {"func.SafeArrayRedim.cc","ms"}, 
+  {"func.ConvertStringSidToSidA.cc","ms"}, 
+  {"func.CoFileTimeToDosDateTime.cc","ms"}, 
+  {"func.ldap_rename_extW.cc","ms"}, 
+  {"func.VarCyMulI8.cc","ms"}, 
+  {"func.CertAddEncodedCertificateToSystemStoreA.cc","ms"}, 
+  {"func.GetThreadId.cc","ms"}, 
+  {"func.SymSrvGetFileIndexes.cc","ms"}, 
+  {"func._llseek.cc","ms"}, 
+  {"func.ldap_escape_filter_element.cc","ms"}, 
+  {"func.OleCreateFontIndirect.cc","ms"}, 
+  {"func.WaitNamedPipeA.cc","ms"}, 
+  {"func.VarI2FromStr.cc","ms"}, 
+  {"func.GetWindowsDirectoryW.cc","ms"}, 
+  {"func.GetDeviceDriverBaseNameA.cc","ms"}, 
+  {"func.WinHttpFreeProxyResultEx.cc","ms"}, 
+  {"func.StrRStrIW.cc","ms"}, 
+  {"func.ldap_modrdnW.cc","ms"}, 
+  {"func.PathRemoveBackslashA.cc","ms"}, 
+  {"func.MonikerRelativePathTo.cc","ms"}, 
+  {"func.BCryptResolveProviders.cc","ms"}, 
+  {"func.ldap_perror.cc","ms"}, 
+  {"func.ber_next_element.cc","ms"}, 
+  {"func.CreateActCtxW.cc","ms"}, 
+  {"func.BeginDeferWindowPos.cc","ms"}, 
+  {"func.VarBoolFromUI4.cc","ms"}, 
+  {"func.OpenSCManagerA.cc","ms"}, 
+  {"func.CreateProcessA.cc","ms"}, 
+  {"func.VirtualUnlock.cc","ms"}, 
+  {"func.CreateWaitableTimerW.cc","ms"}, 
+  {"func.CM_Remove_SubTree_Ex.cc","ms"}, 
+  {"func.BCryptGenerateSymmetricKey.cc","ms"}, 
+  {"func.SymRefreshModuleList.cc","ms"}, 
+  {"func.CM_Get_Global_State_Ex.cc","ms"}, 
+  {"func.CertVerifyValidityNesting.cc","ms"}, 
+  {"func.DllRegisterServer.cc","ms"}, 
+  {"func.RtlUnwind.cc","ms"}, 
+  {"func.UrlHashW.cc","ms"}, 
+  {"func.BCryptConfigureContext.cc","ms"}, 
+  {"func.GetNumberOfConsoleInputEvents.cc","ms"}, 
+  {"func.SHGetViewStatePropertyBag.cc","ms"}, 
+  {"func.ImageList_ReadEx.cc","ms"}, 
+  {"func.GetFirmwareEnvironmentVariableExA.cc","ms"}, 
+  {"func.ImageList_Write.cc","ms"}, 
+  {"func.Wow64SuspendThread.cc","ms"}, 
+  {"func.CM_Get_Device_ID_List_Size_ExW.cc","ms"}, 
+  {"func.UrlGetPartA.cc","ms"}, 
+  {"func.DisableThreadProfiling.cc","ms"}, 
+  {"func.VarBstrFromDec.cc","ms"}, 
+  {"func.GetMenuItemInfoA.cc","ms"}, 
+  {"func.SetDisplayConfig.cc","ms"}, 
+  {"func.LoadMenuIndirectW.cc","ms"}, 
+  {"func.StrCmpCA.cc","ms"}, 
+  {"func.RegOpenKeyTransactedW.cc","ms"}, 
+  {"func.ldap_bind_s.cc","ms"}, 
+  {"func.GetAddressByNameA.cc","ms"}, 
+  {"func.TryAcquireSRWLockExclusive.cc","ms"}, 
+  {"func.WinHttpWebSocketQueryCloseStatus.cc","ms"}, 
+  {"func.BCryptGenerateKeyPair.cc","ms"}, 
+  {"func.GetKeyboardState.cc","ms"}, 
+  {"func.GetMenu.cc","ms"}, 
+  {"func.VarI4FromDisp.cc","ms"}, 
+  {"func.VarDateFromI2.cc","ms"}, 
+  {"func.CreateDirectoryExA.cc","ms"}, 
+  {"func.ControlService.cc","ms"}, 
+  {"func.GetComputerNameW.cc","ms"}, 
+  {"func.SHRegOpenUSKeyA.cc","ms"}, 
+  {"func.WSAEnumProtocolsA.cc","ms"}, 
+  {"func.WinHttpResetAutoProxy.cc","ms"}, 
+  {"func.CancelTimerQueueTimer.cc","ms"}, 
+  {"func.wvsprintfA.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_AliasW.cc","ms"}, 
+  {"func.SetDoubleClickTime.cc","ms"}, 
+  {"func.ChangeDisplaySettingsW.cc","ms"}, 
+  {"func.GetNamedPipeInfo.cc","ms"}, 
+  {"func.EnumPageFilesW.cc","ms"}, 
+  {"func.SymEnumerateModules64.cc","ms"}, 
+  {"func.DialogBoxIndirectParamA.cc","ms"}, 
+  {"func.GetFileAttributesW.cc","ms"}, 
+  {"func.VerifyScripts.cc","ms"}, 
+  {"func.CertCreateCTLEntryFromCertificateContextProperties.cc","ms"}, 
+  {"func.GetDurationFormatEx.cc","ms"}, 
+  {"func.EnableTrace.cc","ms"}, 
+  {"func.WinHttpGetDefaultProxyConfiguration.cc","ms"}, 
+  {"func.FreeSid.cc","ms"}, 
+  {"func.CM_Is_Version_Available.cc","ms"}, 
+  {"func.CertOpenServerOcspResponse.cc","ms"}, 
+  {"func.WinHttpSetDefaultProxyConfiguration.cc","ms"}, 
+  {"func.MapUserPhysicalPagesScatter.cc","ms"}, 
+  {"func.SymGetHomeDirectoryW.cc","ms"}, 
+  {"func.SetFilePointer.cc","ms"}, 
+  {"func.ldap_delete_sW.cc","ms"}, 
+  {"func.SetCurrentProcessExplicitAppUserModelID.cc","ms"}, 
+  {"func.SetWindowLongPtrA.cc","ms"}, 
+  {"func.GetDlgCtrlID.cc","ms"}, 
+  {"func.NCryptQueryProtectionDescriptorName.cc","ms"}, 
+  {"func.PathIsUNCServerW.cc","ms"}, 
+  {"func.CM_Free_Log_Conf.cc","ms"}, 
+  {"func.VarCyCmpR8.cc","ms"}, 
+  {"func.CopyImage.cc","ms"}, 
+  {"func.IsNLSDefinedString.cc","ms"}, 
+  {"func.SetServiceStatus.cc","ms"}, 
+  {"func.EnumDateFormatsExW.cc","ms"}, 
+  {"func.OpenFileMappingA.cc","ms"}, 
+  {"func.CredUIPromptForCredentialsW.cc","ms"}, 
+  {"func.ReadConsoleA.cc","ms"}, 
+  {"func.GetAppContainerNamedObjectPath.cc","ms"}, 
+  {"func.EnumResourceNamesExW.cc","ms"}, 
+  {"func.EnumServicesStatusA.cc","ms"}, 
+  {"func.recvfrom.cc","ms"}, 
+  {"func.FreeEnvironmentStringsW.cc","ms"}, 
+  {"func.SetLastError.cc","ms"}, 
+  {"func.GlobalGetAtomNameW.cc","ms"}, 
+  {"func.VarR8FromUI2.cc","ms"}, 
+  {"func.IsValidSid.cc","ms"}, 
+  {"func.StrStrW.cc","ms"}, 
+  {"func.CertCreateCRLContext.cc","ms"}, 
+  {"func.ldap_parse_sort_controlA.cc","ms"}, 
+  {"func.CertFindCertificateInStore.cc","ms"}, 
+  {"func.SetFileSecurityW.cc","ms"}, 
+  {"func.RsopAccessCheckByType.cc","ms"}, 
+  {"func.RegisterHotKey.cc","ms"}, 
+  {"func.PathMakePrettyW.cc","ms"}, 
+  {"func.GetBinaryTypeA.cc","ms"}, 
+  {"func.AnimateWindow.cc","ms"}, 
+  {"func.IntlStrEqWorkerA.cc","ms"}, 
+  {"func.SleepConditionVariableSRW.cc","ms"}, 
+  {"func.CryptDecodeMessage.cc","ms"}, 
+  {"func.WSAPoll.cc","ms"}, 
+  {"func.SHGlobalCounterIncrement.cc","ms"}, 
+  {"func.CryptFindLocalizedName.cc","ms"}, 
+  {"func.AccessCheckByTypeResultListAndAuditAlarmA.cc","ms"}, 
+  {"func.UnionRect.cc","ms"}, 
+  {"func.CryptGetKeyIdentifierProperty.cc","ms"}, 
+  {"func.CM_Dup_Range_List.cc","ms"}, 
+  {"func.GetTapeStatus.cc","ms"}, 
+  {"func.GetAllUsersProfileDirectoryW.cc","ms"}, 
+  {"func.EnableWindow.cc","ms"}, 
+  {"func.EnumDateFormatsExEx.cc","ms"}, 
+  {"func.CM_Get_Res_Des_Data_Ex.cc","ms"}, 
+  {"func.GetNumaHighestNodeNumber.cc","ms"}, 
+  {"func.CreateAcceleratorTableA.cc","ms"}, 
+  {"func.SetFileBandwidthReservation.cc","ms"}, 
+  {"func.PathIsUNCServerA.cc","ms"}, 
+  {"func.SafeArrayUnlock.cc","ms"}, 
+  {"func.GetSecurityDescriptorDacl.cc","ms"}, 
+  {"func.UnregisterTouchWindow.cc","ms"}, 
+  {"func.ldap_ufn2dnW.cc","ms"}, 
+  {"func.StrIsIntlEqualA.cc","ms"}, 
+  {"func.TerminateProcessOnMemoryExhaustion.cc","ms"}, 
+  {"func.StringFromCLSID.cc","ms"}, 
+  {"func.K32EnumPageFilesW.cc","ms"}, 
+  {"func.GetSystemFirmwareTable.cc","ms"}, 
+  {"func.OpenJobObjectA.cc","ms"}, 
+  {"func.CM_Add_ID_ExW.cc","ms"}, 
+  {"func.StartServiceA.cc","ms"}, 
+  {"func.CertSerializeCTLStoreElement.cc","ms"}, 
+  {"func.CreateFileMappingA.cc","ms"}, 
+  {"func.OpenDesktopA.cc","ms"}, 
+  {"func.CryptCreateAsyncHandle.cc","ms"}, 
+  {"func.InitiateSystemShutdownExA.cc","ms"}, 
+  {"func.MapVirtualKeyExA.cc","ms"}, 
+  {"func.FlushFileBuffers.cc","ms"}, 
+  {"func.SafeArraySetIID.cc","ms"}, 
+  {"func.WSALookupServiceNextA.cc","ms"}, 
+  {"func.GetCommConfig.cc","ms"}, 
+  {"func.SymCompareInlineTrace.cc","ms"}, 
+  {"func.MonitorFromPoint.cc","ms"}, 
+  {"func.WSCInstallNameSpace32.cc","ms"}, 
+  {"func.CertCreateCertificateChainEngine.cc","ms"}, 
+  {"func.IdnToNameprepUnicode.cc","ms"}, 
+  {"func.VarUI1FromDisp.cc","ms"}, 
+  {"func.K32GetProcessImageFileNameA.cc","ms"}, 
+  {"func.GetSysColorBrush.cc","ms"}, 
+  {"func.IsWindowEnabled.cc","ms"}, 
+  {"func.CertAddCertificateContextToStore.cc","ms"}, 
+  {"func.GetNumaProcessorNodeEx.cc","ms"}, 
+  {"func.InitOnceBeginInitialize.cc","ms"}, 
+  {"func.StrPBrkA.cc","ms"}, 
+  {"func.SymSrvGetFileIndexInfo.cc","ms"}, 
+  {"func.MapViewOfFileEx.cc","ms"}, 
+  {"func.EnumResourceLanguagesW.cc","ms"}, 
+  {"func.GetWindowRect.cc","ms"}, 
+  {"func.CertFindCRLInStore.cc","ms"}, 
+  {"func.WSCEnableNSProvider32.cc","ms"}, 
+  {"func.RegOpenUserClassesRoot.cc","ms"}, 
+  {"func.EndPaint.cc","ms"}, 
+  {"func.ConvertThreadToFiberEx.cc","ms"}, 
+  {"func.ChangeWindowMessageFilter.cc","ms"}, 
+  {"func.ldap_ufn2dnA.cc","ms"}, 
+  {"func.StrIsIntlEqualW.cc","ms"}, 
+  {"func.PrivateExtractIconsA.cc","ms"}, 
+  {"func.GetWsChangesEx.cc","ms"}, 
+  {"func.CloseThreadpoolIo.cc","ms"}, 
+  {"func.SetLocalTime.cc","ms"}, 
+  {"func.StartServiceW.cc","ms"}, 
+  {"func.CreateEventExW.cc","ms"}, 
+  {"func.RegLoadAppKeyA.cc","ms"}, 
+  {"func.SymGetScope.cc","ms"}, 
+  {"func.EnumerateTraceGuidsEx.cc","ms"}, 
+  {"func.UnhookWinEvent.cc","ms"}, 
+  {"func.GetUserDefaultUILanguage.cc","ms"}, 
+  {"func.SHReleaseThreadRef.cc","ms"}, 
+  {"func.GetTapePosition.cc","ms"}, 
+  {"func.CertResyncCertificateChainEngine.cc","ms"}, 
+  {"func.CM_Get_Next_Log_Conf.cc","ms"}, 
+  {"func.GetFullPathNameTransactedW.cc","ms"}, 
+  {"func.DefWindowProcA.cc","ms"}, 
+  {"func.WinHttpOpenRequest.cc","ms"}, 
+  {"func.GetIconInfoExW.cc","ms"}, 
+  {"func.SetWindowsHookExA.cc","ms"}, 
+  {"func.QueryDecompressorInformation.cc","ms"}, 
+  {"func.WSAStartup.cc","ms"}, 
+  {"func.WPUOpenCurrentThread.cc","ms"}, 
+  {"func.RsopFileAccessCheck.cc","ms"}, 
+  {"func.VarCyFromBool.cc","ms"}, 
+  {"func.CM_Get_Device_ID_List_ExA.cc","ms"}, 
+  {"func.VirtualQuery.cc","ms"}, 
+  {"func.DisableProcessWindowsGhosting.cc","ms"}, 
+  {"func.WSANtohs.cc","ms"}, 
+  {"func.DragDetect.cc","ms"}, 
+  {"func.CertCloseStore.cc","ms"}, 
+  {"func.GetApplicationRestartSettings.cc","ms"}, 
+  {"func.GetProcessShutdownParameters.cc","ms"}, 
+  {"func.QueryTraceProcessingHandle.cc","ms"}, 
+  {"func.CreateCompressor.cc","ms"}, 
+  {"func.StrRChrIA.cc","ms"}, 
+  {"func.InitializeAcl.cc","ms"}, 
+  {"func.IIDFromString.cc","ms"}, 
+  {"func.SymSetSearchPath.cc","ms"}, 
+  {"func.SymGetModuleBase.cc","ms"}, 
+  {"func.PrivilegedServiceAuditAlarmW.cc","ms"}, 
+  {"func.GetSystemWow64Directory2A.cc","ms"}, 
+  {"func.PathRenameExtensionA.cc","ms"}, 
+  {"func.SubmitThreadpoolWork.cc","ms"}, 
+  {"func.SetKeyboardState.cc","ms"}, 
+  {"func.SafeArrayReleaseData.cc","ms"}, 
+  {"func.IStream_Read.cc","ms"}, 
+  {"func.BCryptConfigureContextFunction.cc","ms"}, 
+  {"func.SymEnumerateSymbolsW64.cc","ms"}, 
+  {"func.SHStrDupW.cc","ms"}, 
+  {"func.CertEnumCertificatesInStore.cc","ms"}, 
+  {"func.CreateSymbolicLinkTransactedA.cc","ms"}, 
+  {"func.AssocCreateForClasses.cc","ms"}, 
+  {"func.K32GetDeviceDriverFileNameW.cc","ms"}, 
+  {"func.AccessCheckByTypeAndAuditAlarmW.cc","ms"}, 
+  {"func.ImageNtHeader.cc","ms"}, 
+  {"func.IsBadHugeReadPtr.cc","ms"}, 
+  {"func.StrRetToBSTR.cc","ms"}, 
+  {"func.SetComputerNameExA.cc","ms"}, 
+  {"func.RegGetKeySecurity.cc","ms"}, 
+  {"func.StrCmpNCA.cc","ms"}, 
+  {"func.GetFullPathNameTransactedA.cc","ms"}, 
+  {"func.CM_Delete_Class_Key.cc","ms"}, 
+  {"func.SafeArrayCreateVectorEx.cc","ms"}, 
+  {"func.EnumPropsW.cc","ms"}, 
+  {"func.RegConnectRegistryExW.cc","ms"}, 
+  {"func.GetThreadGroupAffinity.cc","ms"}, 
+  {"func.VarBstrFromDate.cc","ms"}, 
+  {"func.VarCyRound.cc","ms"}, 
+  {"func.UrlGetPartW.cc","ms"}, 
+  {"func.CertEnumSystemStore.cc","ms"}, 
+  {"func.CryptImportPublicKeyInfoEx.cc","ms"}, 
+  {"func.RegisterBadMemoryNotification.cc","ms"}, 
+  {"func.ClearEventLogW.cc","ms"}, 
+  {"func.CloseThreadpoolCleanupGroup.cc","ms"}, 
+  {"func.CryptEnumOIDFunction.cc","ms"}, 
+  {"func.CM_Get_Class_Key_Name_ExA.cc","ms"}, 
+  {"func.CM_Enable_DevNode_Ex.cc","ms"}, 
+  {"func.QueryServiceObjectSecurity.cc","ms"}, 
+  {"func.FormatMessageW.cc","ms"}, 
+  {"func.IsChild.cc","ms"}, 
+  {"func.CoTestCancel.cc","ms"}, 
+  {"func.IsValidNLSVersion.cc","ms"}, 
+  {"func.GetVolumeInformationA.cc","ms"}, 
+  {"func.SymGetTypeInfoEx.cc","ms"}, 
+  {"func.SafeArrayUnaccessData.cc","ms"}, 
+  {"func.NCryptKeyDerivation.cc","ms"}, 
+  {"func.HeapLock.cc","ms"}, 
+  {"func.EnumPageFilesA.cc","ms"}, 
+  {"func.socket.cc","ms"}, 
+  {"func.VarUI8FromI2.cc","ms"}, 
+  {"func.SHUnicodeToAnsi.cc","ms"}, 
+  {"func.GlobalReAlloc.cc","ms"}, 
+  {"func.SetFileCompletionNotificationModes.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_List_ExW.cc","ms"}, 
+  {"func.SetCriticalSectionSpinCount.cc","ms"}, 
+  {"func.CreateBindCtx.cc","ms"}, 
+  {"func.BCryptEnumRegisteredProviders.cc","ms"}, 
+  {"func.WPUResetEvent.cc","ms"}, 
+  {"func.SHRegCreateUSKeyA.cc","ms"}, 
+  {"func.CreateBoundaryDescriptorW.cc","ms"}, 
+  {"func.RegCreateKeyA.cc","ms"}, 
+  {"func.CertUnregisterPhysicalStore.cc","ms"}, 
+  {"func.ReadConsoleInputA.cc","ms"}, 
+  {"func.EventAccessControl.cc","ms"}, 
+  {"func.MonitorFromRect.cc","ms"}, 
+  {"func.SafeArrayAddRef.cc","ms"}, 
+  {"func.TabbedTextOutA.cc","ms"}, 
+  {"func.GetDurationFormat.cc","ms"}, 
+  {"func.SendInput.cc","ms"}, 
+  {"func.CreateFileTransactedW.cc","ms"}, 
+  {"func.OpenInputDesktop.cc","ms"}, 
+  {"func.SymSearch.cc","ms"}, 
+  {"func.CoMarshalInterface.cc","ms"}, 
+  {"func.SymSrvGetSupplement.cc","ms"}, 
+  {"func.CM_Uninstall_DevNode_Ex.cc","ms"}, 
+  {"func.GetSystemDirectoryW.cc","ms"}, 
+  {"func.GetFullPathNameW.cc","ms"}, 
+  {"func.NCryptTranslateHandle.cc","ms"}, 
+  {"func.SymRegisterFunctionEntryCallback64.cc","ms"}, 
+  {"func.ReadDirectoryChangesW.cc","ms"}, 
+  {"func.CreateTimerQueueTimer.cc","ms"}, 
+  {"func.EnterCriticalPolicySection.cc","ms"}, 
+  {"func.GetRunningObjectTable.cc","ms"}, 
+  {"func.RegisterWaitForSingleObject.cc","ms"}, 
+  {"func.CryptSignHashA.cc","ms"}, 
+  {"type.HGDIOBJ.size","64"}, 
+  {"func.SymEnumTypesW.cc","ms"}, 
+  {"func.WaitForThreadpoolWaitCallbacks.cc","ms"}, 
+  {"func.OleLoadPictureFile.cc","ms"}, 
+  {"func.WSAHtons.cc","ms"}, 
+  {"func.SetVolumeMountPointA.cc","ms"}, 
+  {"func.CertNameToStrW.cc","ms"}, 
+  {"func.WTSIsServerContainer.cc","ms"}, 
+  {"func.FindNextVolumeW.cc","ms"}, 
+  {"func.ResetCompressor.cc","ms"}, 
+  {"func.PathFindFileNameW.cc","ms"}, 
+  {"func.SetPhysicalCursorPos.cc","ms"}, 
+  {"func.CloseDesktop.cc","ms"}, 
+  {"func._hwrite.cc","ms"}, 
+  {"func.CryptStringToBinaryA.cc","ms"}, 
+  {"func.EnumThreadWindows.cc","ms"}, 
+  {"func.BCryptHash.cc","ms"}, 
+  {"func.WSAGetServiceClassNameByClassIdA.cc","ms"}, 
+  {"func.DeleteProcThreadAttributeList.cc","ms"}, 
+  {"func.CertRDNValueToStrW.cc","ms"}, 
+  {"func.SymRegisterCallbackW64.cc","ms"}, 
+  {"func.WPUCloseThread.cc","ms"}, 
+  {"func.UnregisterApplicationRestart.cc","ms"}, 
+  {"func.SetUmsThreadInformation.cc","ms"}, 
+  {"func.GetDpiForWindow.cc","ms"}, 
+  {"type.LPCTSTR.size","64"}, 
+  {"func.CloseCompressor.cc","ms"}, 
+  {"func.SHCreateMemStream.cc","ms"}, 
+  {"func.CM_Free_Log_Conf_Ex.cc","ms"}, 
+  {"func.GenerateGPNotification.cc","ms"}, 
+  {"func.VarDateFromR4.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_PropertyW.cc","ms"}, 
+  {"func.WSAConnectByNameW.cc","ms"}, 
+  {"func.CoDisconnectObject.cc","ms"}, 
+  {"func.GetTypeByNameA.cc","ms"}, 
+  {"func.CryptMemAlloc.cc","ms"}, 
+  {"func.ldap_count_valuesA.cc","ms"}, 
+  {"func.WinHttpQueryDataAvailable.cc","ms"}, 
+  {"func.CryptMsgControl.cc","ms"}, 
+  {"func.CreateDialogIndirectParamA.cc","ms"}, 
+  {"func.VirtualAllocEx.cc","ms"}, 
+  {"func.WriteTapemark.cc","ms"}, 
+  {"func.FindNextVolumeA.cc","ms"}, 
+  {"func.PathMatchSpecW.cc","ms"}, 
+  {"func.GetDpiFromDpiAwarenessContext.cc","ms"}, 
+  {"func.CM_Query_Remove_SubTree_Ex.cc","ms"}, 
+  {"func.CharPrevA.cc","ms"}, 
+  {"func.SetPrivateObjectSecurityEx.cc","ms"}, 
+  {"func.ReadEncryptedFileRaw.cc","ms"}, 
+  {"func.ldap_search_abandon_page.cc","ms"}, 
+  {"func.VarDecFromUI8.cc","ms"}, 
+  {"func.UnregisterPowerSettingNotification.cc","ms"}, 
+  {"func.BCryptSecretAgreement.cc","ms"}, 
+  {"func.InitializeTouchInjection.cc","ms"}, 
+  {"func.EnumerateTraceGuids.cc","ms"}, 
+  {"func.SymGetLinePrev64.cc","ms"}, 
+  {"func.GetPrivateProfileStringW.cc","ms"}, 
+  {"func.LoadRegTypeLib.cc","ms"}, 
+  {"func.SafeArrayCreateVector.cc","ms"}, 
+  {"func.AllowSetForegroundWindow.cc","ms"}, 
+  {"func.LBItemFromPt.cc","ms"}, 
+  {"func.PathRelativePathToW.cc","ms"}, 
+  {"func.CryptFindCertificateKeyProvInfo.cc","ms"}, 
+  {"func.ImageList_EndDrag.cc","ms"}, 
+  {"func.GetNumberFormatA.cc","ms"}, 
+  {"func.CertOpenSystemStoreA.cc","ms"}, 
+  {"func.ldap_compare_extW.cc","ms"}, 
+  {"func.SetProcessWindowStation.cc","ms"}, 
+  {"func.ImageRvaToVa.cc","ms"}, 
+  {"func.StrRetToStrW.cc","ms"}, 
+  {"func.GetAtomNameA.cc","ms"}, 
+  {"func.UnmapDebugInformation.cc","ms"}, 
+  {"func.EnumCalendarInfoExEx.cc","ms"}, 
+  {"func.VarUI4FromI2.cc","ms"}, 
+  {"func.QueryOptionalDelayLoadedAPI.cc","ms"}, 
+  {"func.SetWindowsHookW.cc","ms"}, 
+  {"func.getaddrinfo.cc","ms"}, 
+  {"func.VarI4FromR4.cc","ms"}, 
+  {"func.WSAAccept.cc","ms"}, 
+  {"func.PropVariantClear.cc","ms"}, 
+  {"func.GetSysColor.cc","ms"}, 
+  {"func.CreateEventExA.cc","ms"}, 
+  {"func.GetProcessIoCounters.cc","ms"}, 
+  {"func.SymGetTypeFromNameW.cc","ms"}, 
+  {"func.ldap_set_dbg_routine.cc","ms"}, 
+  {"func.CM_Open_Device_Interface_Key_ExW.cc","ms"}, 
+  {"func.WSASendTo.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_List_Size_ExA.cc","ms"}, 
+  {"func.SetSecurityDescriptorOwner.cc","ms"}, 
+  {"func.BCryptQueryContextFunctionProperty.cc","ms"}, 
+  {"func.QueryFullProcessImageNameW.cc","ms"}, 
+  {"func.SHGetValueA.cc","ms"}, 
+  {"func.CreateThreadpoolWork.cc","ms"}, 
+  {"func.SymFindFileInPathW.cc","ms"}, 
+  {"func.SetWindowsHookExW.cc","ms"}, 
+  {"func.IsWindowUnicode.cc","ms"}, 
+  {"func.RegisterScaleChangeEvent.cc","ms"}, 
+  {"func.DuplicateTokenEx.cc","ms"}, 
+  {"func.VarUI1FromR4.cc","ms"}, 
+  {"func.IsCharSpaceA.cc","ms"}, 
+  {"func.VerFindFileA.cc","ms"}, 
+  {"func.EnumDesktopsW.cc","ms"}, 
+  {"func.GetMenuDefaultItem.cc","ms"}, 
+  {"func.VarBoolFromI8.cc","ms"}, 
+  {"func.CM_Locate_DevNodeA.cc","ms"}, 
+  {"func.CoSetCancelObject.cc","ms"}, 
+  {"func.FindNextFileNameW.cc","ms"}, 
+  {"func.GetConsoleScreenBufferInfoEx.cc","ms"}, 
+  {"func.CryptCreateKeyIdentifierFromCSP.cc","ms"}, 
+  {"func.BCryptRemoveContextFunction.cc","ms"}, 
+  {"func.GetThreadPriorityBoost.cc","ms"}, 
+  {"func.SetSecurityDescriptorDacl.cc","ms"}, 
+  {"func.StackWalkEx.cc","ms"}, 
+  {"func.UrlCanonicalizeA.cc","ms"}, 
+  {"func.ConvertSecurityDescriptorToStringSecurityDescriptorA.cc","ms"}, 
+  {"func.AssocIsDangerous.cc","ms"}, 
+  {"func.UrlIsOpaqueA.cc","ms"}, 
+  {"func.ExtractAssociatedIconA.cc","ms"}, 
+  {"func.GetMouseMovePointsEx.cc","ms"}, 
+  {"func.HeapDestroy.cc","ms"}, 
+  {"func.CharUpperA.cc","ms"}, 
+  {"func.WSACloseEvent.cc","ms"}, 
+  {"func.CredUIParseUserNameA.cc","ms"}, 
+  {"func.CertOpenStore.cc","ms"}, 
+  {"func.MapViewOfFileNuma2.cc","ms"}, 
+  {"func.SafeArrayGetIID.cc","ms"}, 
+  {"func.AccessCheckByTypeAndAuditAlarmA.cc","ms"}, 
+  {"func.DebugActiveProcess.cc","ms"}, 
+  {"func.EnumCalendarInfoW.cc","ms"}, 
+  {"func.SearchTreeForFile.cc","ms"}, 
+  {"func.VarDecFromI4.cc","ms"}, 
+  {"func.GetCurrencyFormatW.cc","ms"}, 
+  {"func.SHAssocEnumHandlersForProtocolByApplication.cc","ms"}, 
+  {"func.ldap_openW.cc","ms"}, 
+  {"func.BCryptDuplicateKey.cc","ms"}, 
+  {"func.ldap_get_next_page.cc","ms"}, 
+  {"func.IsIconic.cc","ms"}, 
+  {"func.CM_Get_Class_Registry_PropertyW.cc","ms"}, 
+  {"func.GetWindowDpiHostingBehavior.cc","ms"}, 
+  {"func.EnumPropsA.cc","ms"}, 
+  {"func.EnumDisplaySettingsA.cc","ms"}, 
+  {"func.LoadStringA.cc","ms"}, 
+  {"func.LoadKeyboardLayoutW.cc","ms"}, 
+  {"func.GetMessageExtraInfo.cc","ms"}, 
+  {"func.PathIsContentTypeA.cc","ms"}, 
+  {"func.TryAcquireSRWLockShared.cc","ms"}, 
+  {"func.TranslateNameW.cc","ms"}, 
+  {"func.CryptSIPAddProvider.cc","ms"}, 
+  {"func.GetFinalPathNameByHandleA.cc","ms"}, 
+  {"func.SetConsoleCursorInfo.cc","ms"}, 
+  {"func.CertAddEncodedCTLToStore.cc","ms"}, 
+  {"func.IsBadHugeWritePtr.cc","ms"}, 
+  {"func.FreeGPOListA.cc","ms"}, 
+  {"func.SafeArrayDestroyDescriptor.cc","ms"}, 
+  {"func.SHIsLowMemoryMachine.cc","ms"}, 
+  {"func.RegQueryValueExA.cc","ms"}, 
+  {"func.OpenBackupEventLogW.cc","ms"}, 
+  {"func.CM_Run_Detection_Ex.cc","ms"}, 
+  {"func.IsTextUnicode.cc","ms"}, 
+  {"func.ldap_initW.cc","ms"}, 
+  {"func.WaitMessage.cc","ms"}, 
+  {"func.QueryProcessAffinityUpdateMode.cc","ms"}, 
+  {"func.EnumResourceLanguagesExW.cc","ms"}, 
+  {"func.GetLogicalProcessorInformation.cc","ms"}, 
+  {"func.CommandLineToArgvW.cc","ms"}, 
+  {"func.DeleteAtom.cc","ms"}, 
+  {"func.RegCreateKeyW.cc","ms"}, 
+  {"func.CM_Open_Device_Interface_KeyW.cc","ms"}, 
+  {"func.CryptSetAsyncParam.cc","ms"}, 
+  {"func.AdjustWindowRect.cc","ms"}, 
+  {"func.InterlockedPushEntrySList.cc","ms"}, 
+  {"func.UninitializeFlatSB.cc","ms"}, 
+  {"func.SymGetOmaps.cc","ms"}, 
+  {"func.ldap_search_sA.cc","ms"}, 
+  {"func.WSAInstallServiceClassA.cc","ms"}, 
+  {"func.ldap_startup.cc","ms"}, 
+  {"func.SHSkipJunction.cc","ms"}, 
+  {"func.SetProcessDefaultLayout.cc","ms"}, 
+  {"func.GetCursor.cc","ms"}, 
+  {"func.OpenEventLogW.cc","ms"}, 
+  {"func.SymGetSourceFile.cc","ms"}, 
+  {"func.lstrlenW.cc","ms"}, 
+  {"func.EnumerateLoadedModulesW64.cc","ms"}, 
+  {"func.CheckNameLegalDOS8Dot3A.cc","ms"}, 
+  {"func.SymSearchW.cc","ms"}, 
+  {"func.GetCursorPos.cc","ms"}, 
+  {"func.DeleteProfileA.cc","ms"}, 
+  {"func.IStream_Size.cc","ms"}, 
+  {"func.SetMenuInfo.cc","ms"}, 
+  {"func.ImageList_DrawIndirect.cc","ms"}, 
+  {"func.SHQueryRecycleBinA.cc","ms"}, 
+  {"func.SetVolumeMountPointW.cc","ms"}, 
+  {"func.CreateMailslotW.cc","ms"}, 
+  {"type.HRGN.size","64"}, 
+  {"func.CertSaveStore.cc","ms"}, 
+  {"func.CryptGetObjectUrl.cc","ms"}, 
+  {"func.DisconnectNamedPipe.cc","ms"}, 
+  {"func.ldap_parse_resultA.cc","ms"}, 
+  {"func.GetDlgItemTextA.cc","ms"}, 
+  {"func.PathCreateFromUrlAlloc.cc","ms"}, 
+  {"func.GetWindowLongPtrW.cc","ms"}, 
+  {"func.EnableScrollBar.cc","ms"}, 
+  {"func.ExitWindowsEx.cc","ms"}, 
+  {"func.CertRDNValueToStrA.cc","ms"}, 
+  {"func.SetThreadStackGuarantee.cc","ms"}, 
+  {"func.BuildCommDCBW.cc","ms"}, 
+  {"func.StrChrA.cc","ms"}, 
+  {"func.WriteFileEx.cc","ms"}, 
+  {"func.SHRegSetPathA.cc","ms"}, 
+  {"func.CertEnumCTLContextProperties.cc","ms"}, 
+  {"func.SetUserObjectInformationA.cc","ms"}, 
+  {"func.EnterUmsSchedulingMode.cc","ms"}, 
+  {"func.VectorFromBstr.cc","ms"}, 
+  {"func.GlobalUnlock.cc","ms"}, 
+  {"func.CheckForHiberboot.cc","ms"}, 
+  {"func.SetStdHandle.cc","ms"}, 
+  {"func.BCryptCreateHash.cc","ms"}, 
+  {"func.DeregisterShellHookWindow.cc","ms"}, 
+  {"func.SetEvent.cc","ms"}, 
+  {"func.LoadImageA.cc","ms"}, 
+  {"func.GrayStringW.cc","ms"}, 
+  {"func.IsEnclaveTypeSupported.cc","ms"}, 
+  {"func.GetLogicalDriveStringsA.cc","ms"}, 
+  {"func.VarI4FromUI8.cc","ms"}, 
+  {"func.GetThreadDpiAwarenessContext.cc","ms"}, 
+  {"func.ldap_count_valuesW.cc","ms"}, 
+  {"func.CM_Request_Device_EjectW.cc","ms"}, 
+  {"func.SetConsoleScreenBufferSize.cc","ms"}, 
+  {"func.ShellMessageBoxA.cc","ms"}, 
+  {"func.ChrCmpIW.cc","ms"}, 
+  {"type.HSZ.size","64"}, 
+  {"func.ExitProcess.cc","ms"}, 
+  {"func.VarUI8FromDate.cc","ms"}, 
+  {"func.CoGetCurrentProcess.cc","ms"}, 
+  {"func.StrCmpLogicalW.cc","ms"}, 
+  {"func.PathGetCharTypeW.cc","ms"}, 
+  {"func.VarUI8FromCy.cc","ms"}, 
+  {"func.ImageList_DrawEx.cc","ms"}, 
+  {"func.VarUI2FromDisp.cc","ms"}, 
+  {"func.CertCloseServerOcspResponse.cc","ms"}, 
+  {"func.PathSetDlgItemPathA.cc","ms"}, 
+  {"func.OpenIcon.cc","ms"}, 
+  {"func.QueueUserWorkItem.cc","ms"}, 
+  {"func.GetTimestampForLoadedLibrary.cc","ms"}, 
+  {"func.StrSpnA.cc","ms"}, 
+  {"func.CM_Get_DevNode_Custom_Property_ExA.cc","ms"}, 
+  {"func.GetLengthSid.cc","ms"}, 
+  {"func.StrStrNIW.cc","ms"}, 
+  {"func.GlobalHandle.cc","ms"}, 
+  {"func.QueryServiceLockStatusW.cc","ms"}, 
+  {"func.SHMessageBoxCheckA.cc","ms"}, 
+  {"func.CredProtectA.cc","ms"}, 
+  {"func.GlobalUnfix.cc","ms"}, 
+  {"func.OutputDebugStringA.cc","ms"}, 
+  {"func.CM_Register_Notification.cc","ms"}, 
+  {"func.WSAEnumNameSpaceProvidersExA.cc","ms"}, 
+  {"func.StackWalk64.cc","ms"}, 
+  {"func.GetPropW.cc","ms"}, 
+  {"func.WinHttpTimeToSystemTime.cc","ms"}, 
+  {"func.CM_Open_Class_Key_ExW.cc","ms"}, 
+  {"func.CloseThreadpoolWait.cc","ms"}, 
+  {"func.SetHandleCount.cc","ms"}, 
+  {"func.CM_Get_Class_PropertyW.cc","ms"}, 
+  {"func.FindDebugInfoFileExW.cc","ms"}, 
+  {"func.VirtualAlloc.cc","ms"}, 
+  {"func.OpenSCManagerW.cc","ms"}, 
+  {"func.WSCInstallProvider.cc","ms"}, 
+  {"func.SymSrvGetFileIndexString.cc","ms"}, 
+  {"func.VarUI2FromBool.cc","ms"}, 
+  {"func.FlatSB_GetScrollRange.cc","ms"}, 
+  {"func.ldap_extended_operationW.cc","ms"}, 
+  {"func.BroadcastSystemMessageExA.cc","ms"}, 
+  {"func.FlushConsoleInputBuffer.cc","ms"}, 
+  {"func.ResolveLocaleName.cc","ms"}, 
+  {"func.GetAltTabInfoA.cc","ms"}, 
+  {"func.CredRenameW.cc","ms"}, 
+  {"func.RegisterWindowMessageW.cc","ms"}, 
+  {"func.NCryptEnumKeys.cc","ms"}, 
+  {"func.CharLowerBuffA.cc","ms"}, 
+  {"func.PostQuitMessage.cc","ms"}, 
+  {"func.CryptHashMessage.cc","ms"}, 
+  {"func.GetClassLongW.cc","ms"}, 
+  {"func.SetHandleInformation.cc","ms"}, 
+  {"func.FindFirstFreeAce.cc","ms"}, 
+  {"func.SetPrivateObjectSecurity.cc","ms"}, 
+  {"func.RegEnumKeyExW.cc","ms"}, 
+  {"func.GetCommModemStatus.cc","ms"}, 
+  {"func.FreeAddrInfoExW.cc","ms"}, 
+  {"func.OleLoadPicture.cc","ms"}, 
+  {"func.CloseHandle.cc","ms"}, 
+  {"func.CloseWindow.cc","ms"}, 
+  {"func.CertFreeCertificateChainList.cc","ms"}, 
+  {"func.PathFindNextComponentA.cc","ms"}, 
+  {"func.VerFindFileW.cc","ms"}, 
+  {"func.BuildCommDCBAndTimeoutsW.cc","ms"}, 
+  {"func.ReleaseDC.cc","ms"}, 
+  {"func.SymGetTypeFromName.cc","ms"}, 
+  {"func.GetComputerObjectNameW.cc","ms"}, 
+  {"func.GetRawInputDeviceList.cc","ms"}, 
+  {"func.CertIsWeakHash.cc","ms"}, 
+  {"func.EventAccessQuery.cc","ms"}, 
+  {"type.INT_PTE.size","64"}, 
+  {"func.ApplicationRecoveryInProgress.cc","ms"}, 
+  {"func.LockResource.cc","ms"}, 
+  {"func.CloseThreadpoolTimer.cc","ms"}, 
+  {"func.GetPropA.cc","ms"}, 
+  {"func.SHOpenRegStream2W.cc","ms"}, 
+  {"func.WSCInstallNameSpace.cc","ms"}, 
+  {"func.ConvertPerformanceCounterToAuxiliaryCounter.cc","ms"}, 
+  {"func.SetDefaultDllDirectories.cc","ms"}, 
+  {"func.SHGetIDListFromObject.cc","ms"}, 
+  {"func.ConvertFiberToThread.cc","ms"}, 
+  {"func.PtInRect.cc","ms"}, 
+  {"func.WriteConsoleOutputCharacterW.cc","ms"}, 
+  {"func.StrCmpNA.cc","ms"}, 
+  {"func.ldap_simple_bind_s.cc","ms"}, 
+  {"func.OpenTraceA.cc","ms"}, 
+  {"func.ldap_extended_operationA.cc","ms"}, 
+  {"func.FindAtomW.cc","ms"}, 
+  {"func.GetClipCursor.cc","ms"}, 
+  {"func.UpdateTraceA.cc","ms"}, 
+  {"func.VarI2FromUI8.cc","ms"}, 
+  {"func.CoInitializeEx.cc","ms"}, 
+  {"func.CryptMsgOpenToEncode.cc","ms"}, 
+  {"func.ReleaseCapture.cc","ms"}, 
+  {"func.CM_Get_Res_Des_Data_Size.cc","ms"}, 
+  {"func.AttachConsole.cc","ms"}, 
+  {"func.CoGetDefaultContext.cc","ms"}, 
+  {"func.CredUIStoreSSOCredW.cc","ms"}, 
+  {"func.CreateCaret.cc","ms"}, 
+  {"func.send.cc","ms"}, 
+  {"func.ShellAboutA.cc","ms"}, 
+  {"func.CryptMsgUpdate.cc","ms"}, 
+  {"func.GetNumaProximityNode.cc","ms"}, 
+  {"func.BCryptDeriveKey.cc","ms"}, 
+  {"func.BackupWrite.cc","ms"}, 
+  {"type.HDC.size","64"}, 
+  {"func.RedrawWindow.cc","ms"}, 
+  {"func.GetModuleBaseNameW.cc","ms"}, 
+  {"func.GetAcceptLanguagesA.cc","ms"}, 
+  {"func.AllocateAndInitializeSid.cc","ms"}, 
+  {"func.EnableMenuItem.cc","ms"}, 
+  {"func.GetWindowModuleFileNameW.cc","ms"}, 
+  {"func.GetComputerObjectNameA.cc","ms"}, 
+  {"type.HACCEL.size","64"}, 
+  {"func.CM_Unregister_Device_InterfaceA.cc","ms"}, 
+  {"func.VarUI8FromDec.cc","ms"}, 
+  {"func.EscapeCommFunction.cc","ms"}, 
+  {"func.ldap_count_values_len.cc","ms"}, 
+  {"func.GetPointerInfo.cc","ms"}, 
+  {"func.NCryptStreamUpdate.cc","ms"}, 
+  {"func.InitOnceComplete.cc","ms"}, 
+  {"func.EventWrite.cc","ms"}, 
+  {"func.LdapGetLastError.cc","ms"}, 
+  {"type.HMENU.size","64"}, 
+  {"func.SHEnumValueW.cc","ms"}, 
+  {"func.VarDecFromI1.cc","ms"}, 
+  {"func.GetTitleBarInfo.cc","ms"}, 
+  {"func.CertFreeServerOcspResponseContext.cc","ms"}, 
+  {"func.SafeArrayGetDim.cc","ms"}, 
+  {"func.InSendMessage.cc","ms"}, 
+  {"func.ProcessIdToSessionId.cc","ms"}, 
+  {"func.OpenTraceW.cc","ms"}, 
+  {"func.OpenFileMappingW.cc","ms"}, 
+  {"func.VarR4FromUI4.cc","ms"}, 
+  {"func.CreateAntiMoniker.cc","ms"}, 
+  {"func.GetCurrentActCtx.cc","ms"}, 
+  {"func.ControlTraceA.cc","ms"}, 
+  {"func.CreateObjrefMoniker.cc","ms"}, 
+  {"func.RtlGrowFunctionTable.cc","ms"}, 
+  {"func.CM_Get_DevNode_Property_Keys_Ex.cc","ms"}, 
+  {"func._hread.cc","ms"}, 
+  {"func.ldap_initA.cc","ms"}, 
+  {"func.RtlLookupFunctionEntry.cc","ms"}, 
+  {"func.IsBadStringPtrA.cc","ms"}, 
+  {"func.OpenEncryptedFileRawW.cc","ms"}, 
+  {"func.SymMatchFileName.cc","ms"}, 
+  {"func.ldap_add_ext.cc","ms"}, 
+  {"func.VariantChangeTypeEx.cc","ms"}, 
+  {"func.StrStrA.cc","ms"}, 
+  {"func.EnumResourceNamesA.cc","ms"}, 
+  {"func.CM_Create_DevNode_ExA.cc","ms"}, 
+  {"func.PathFindOnPathW.cc","ms"}, 
+  {"func.ldap_parse_referenceW.cc","ms"}, 
+  {"func.VarDateFromUI1.cc","ms"}, 
+  {"func.GetDeviceDriverFileNameW.cc","ms"}, 
+  {"func.GlobalAddAtomW.cc","ms"}, 
+  {"func.ldap_extended_operation_sW.cc","ms"}, 
+  {"func.CloseEncryptedFileRaw.cc","ms"}, 
+  {"func.BroadcastSystemMessageA.cc","ms"}, 
+  {"func.PowerSetActiveScheme.cc","ms"}, 
+  {"func.IUnknown_GetSite.cc","ms"}, 
+  {"func.ldap_err2string.cc","ms"}, 
+  {"func.RtlCaptureContext.cc","ms"}, 
+  {"func.VarUI1FromUI8.cc","ms"}, 
+  {"func.OpenEventLogA.cc","ms"}, 
+  {"func.CryptProtectData.cc","ms"}, 
+  {"func.AccessCheckByTypeResultListAndAuditAlarmW.cc","ms"}, 
+  {"func.CoGetStandardMarshal.cc","ms"}, 
+  {"func.CreateUpDownControl.cc","ms"}, 
+  {"func.GetCurrentDirectoryW.cc","ms"}, 
+  {"func.SHEnumValueA.cc","ms"}, 
+  {"func.GetProfileStringW.cc","ms"}, 
+  {"func.CryptVerifyMessageSignature.cc","ms"}, 
+  {"func.RemoveVectoredContinueHandler.cc","ms"}, 
+  {"func.GetCommandLineW.cc","ms"}, 
+  {"func.SetProcessRestrictionExemption.cc","ms"}, 
+  {"func.LocateXStateFeature.cc","ms"}, 
+  {"func.PowerCreateRequest.cc","ms"}, 
+  {"func.CM_Create_Range_List.cc","ms"}, 
+  {"func.CM_Remove_SubTree.cc","ms"}, 
+  {"func.IsThreadpoolTimerSet.cc","ms"}, 
+  {"func.SymGetSymNext.cc","ms"}, 
+  {"func.CM_Add_ID_ExA.cc","ms"}, 
+  {"func.SetSearchPathMode.cc","ms"}, 
+  {"func.IsProcessCritical.cc","ms"}, 
+  {"func.BCryptDestroySecret.cc","ms"}, 
+  {"func.CharToOemBuffW.cc","ms"}, 
+  {"func.GetPointerType.cc","ms"}, 
+  {"func.ldap_msgfree.cc","ms"}, 
+  {"func.getprotobynumber.cc","ms"}, 
+  {"func.OperationStart.cc","ms"}, 
+  {"func.CryptSIPLoad.cc","ms"}, 
+  {"func.SetFileIoOverlappedRange.cc","ms"}, 
+  {"func.QueryVirtualMemoryInformation.cc","ms"}, 
+  {"func.GetUserProfileDirectoryW.cc","ms"}, 
+  {"func.SetServiceA.cc","ms"}, 
+  {"func.GetOpenClipboardWindow.cc","ms"}, 
+  {"func.VarUI2FromStr.cc","ms"}, 
+  {"func.SetUserObjectInformationW.cc","ms"}, 
+  {"func.CM_Query_And_Remove_SubTree_ExW.cc","ms"}, 
+  {"func.GetFileMUIInfo.cc","ms"}, 
+  {"func.VarI4FromI8.cc","ms"}, 
+  {"func.WSCDeinstallProvider32.cc","ms"}, 
+  {"func.CryptExportPKCS8Ex.cc","ms"}, 
+  {"func.GetStringTypeW.cc","ms"}, 
+  {"func.SymGetSourceFileChecksum.cc","ms"}, 
+  {"func.GetCurrentHwProfileA.cc","ms"}, 
+  {"func.CM_Unregister_Notification.cc","ms"}, 
+  {"func.ldap_err2stringA.cc","ms"}, 
+  {"func.CreateFiber.cc","ms"}, 
+  {"func.GetFileVersionInfoSizeW.cc","ms"}, 
+  {"func.LoadLibraryW.cc","ms"}, 
+  {"func.MapDebugInformation.cc","ms"}, 
+  {"func.ReadEventLogW.cc","ms"}, 
+  {"func.GetScrollBarInfo.cc","ms"}, 
+  {"func.VarCyFromDisp.cc","ms"}, 
+  {"func.SHGetFileInfoW.cc","ms"}, 
+  {"func.GetThreadPreferredUILanguages.cc","ms"}, 
+  {"func.GetStartupInfoW.cc","ms"}, 
+  {"func.VarUI2FromUI8.cc","ms"}, 
+  {"func.RemovePropA.cc","ms"}, 
+  {"func.IsTokenRestricted.cc","ms"}, 
+  {"func.GetGPOListW.cc","ms"}, 
+  {"func.VarDecDiv.cc","ms"}, 
+  {"func.VarR8FromDec.cc","ms"}, 
+  {"func.CryptSetProviderW.cc","ms"}, 
+  {"func.LogonUserExW.cc","ms"}, 
+  {"func.EventWriteEx.cc","ms"}, 
+  {"func.CM_Set_Device_Interface_Property_ExW.cc","ms"}, 
+  {"func.WinHelpW.cc","ms"}, 
+  {"func.GlobalLock.cc","ms"}, 
+  {"func.WaitCommEvent.cc","ms"}, 
+  {"func.LoadIconW.cc","ms"}, 
+  {"func.ResumeThread.cc","ms"}, 
+  {"func.CM_Get_DevNode_PropertyW.cc","ms"}, 
+  {"func.MapViewOfFile3.cc","ms"}, 
+  {"func.CreateDesktopW.cc","ms"}, 
+  {"func.lstrcmpA.cc","ms"}, 
+  {"func.GetProcessImageFileNameA.cc","ms"}, 
+  {"func.SetDebugErrorLevel.cc","ms"}, 
+  {"func.GetVolumePathNameA.cc","ms"}, 
+  {"func.StrCatChainW.cc","ms"}, 
+  {"func.SetEnvironmentVariableW.cc","ms"}, 
+  {"func.GetThreadDpiHostingBehavior.cc","ms"}, 
+  {"func.VarR4FromI8.cc","ms"}, 
+  {"func.GetThreadContext.cc","ms"}, 
+  {"func.InitiateSystemShutdownW.cc","ms"}, 
+  {"func.ber_bvdup.cc","ms"}, 
+  {"func.CryptImportPublicKeyInfo.cc","ms"}, 
+  {"func.SHMessageBoxCheckW.cc","ms"}, 
+  {"func.ldap_modrdn2.cc","ms"}, 
+  {"func.ValidateRect.cc","ms"}, 
+  {"func.RegRestoreKeyW.cc","ms"}, 
+  {"func.RegGetValueW.cc","ms"}, 
+  {"func.FindFirstFileNameW.cc","ms"}, 
+  {"func.IStream_Write.cc","ms"}, 
+  {"func.NCryptIsAlgSupported.cc","ms"}, 
+  {"func.WSAAsyncGetServByPort.cc","ms"}, 
+  {"func.GetAddrInfoExOverlappedResult.cc","ms"}, 
+  {"func.wsprintfW.cc","ms"}, 
+  {"func.SetWindowTextA.cc","ms"}, 
+  {"func.SetCachedSigningLevel.cc","ms"}, 
+  {"func.PaintDesktop.cc","ms"}, 
+  {"func.GetCurrentProcessExplicitAppUserModelID.cc","ms"}, 
+  {"func.ChangeMenuA.cc","ms"}, 
+  {"func.InsertMenuItemA.cc","ms"}, 
+  {"func.WSCRemoveQOSTemplate.cc","ms"}, 
+  {"func.UnregisterBadMemoryNotification.cc","ms"}, 
+  {"func.ldap_rename_extA.cc","ms"}, 
+  {"func.SetComputerNameExW.cc","ms"}, 
+  {"func.CertAddEncodedCertificateToSystemStoreW.cc","ms"}, 
+  {"func.VirtualAlloc2FromApp.cc","ms"}, 
+  {"func.VarI2FromCy.cc","ms"}, 
+  {"func.BCryptKeyDerivation.cc","ms"}, 
+  {"func.GetVolumePathNameW.cc","ms"}, 
+  {"func.UnmapViewOfFileEx.cc","ms"}, 
+  {"func.BCryptDestroyHash.cc","ms"}, 
+  {"func.SetProcessValidCallTargets.cc","ms"}, 
+  {"func.BuildCommDCBAndTimeoutsA.cc","ms"}, 
+  {"func.RegisterSuspendResumeNotification.cc","ms"}, 
+  {"func.GetWindowsDirectoryA.cc","ms"}, 
+  {"func.CM_Register_Device_InterfaceA.cc","ms"}, 
+  {"func.UpdateResourceA.cc","ms"}, 
+  {"func.RegSetValueExA.cc","ms"}, 
+  {"func.accept.cc","ms"}, 
+  {"func.SHFileOperationW.cc","ms"}, 
+  {"func.CryptSetProviderExA.cc","ms"}, 
+  {"func.EnumProcessModules.cc","ms"}, 
+  {"func.CompareObjectHandles.cc","ms"}, 
+  {"func.CreateUmsCompletionList.cc","ms"}, 
+  {"func.VarBstrFromUI4.cc","ms"}, 
+  {"func.ReadConsoleOutputA.cc","ms"}, 
+  {"func.WSCGetProviderPath32.cc","ms"}, 
+  {"func.CredIsProtectedW.cc","ms"}, 
+  {"func.SHGetThreadRef.cc","ms"}, 
+  {"func.StrCSpnIA.cc","ms"}, 
+  {"func.ldap_get_values_lenA.cc","ms"}, 
+  {"func.GlobalFix.cc","ms"}, 
+  {"func.ResetEvent.cc","ms"}, 
+  {"func.StgOpenLayoutDocfile.cc","ms"}, 
+  {"func.NCryptRegisterProtectionDescriptorName.cc","ms"}, 
+  {"func.CM_Run_Detection.cc","ms"}, 
+  {"func.PulseEvent.cc","ms"}, 
+  {"func.CloseGestureInfoHandle.cc","ms"}, 
+  {"func.GetTempPathA.cc","ms"}, 
+  {"func.CertFreeCRLContext.cc","ms"}, 
+  {"func.PathCchCanonicalizeEx.cc","ms"}, 
+  {"func.WPUCloseEvent.cc","ms"}, 
+  {"func.ChangeMenuW.cc","ms"}, 
+  {"func.SetServiceObjectSecurity.cc","ms"}, 
+  {"func.SetThreadDpiHostingBehavior.cc","ms"}, 
+  {"func.UnloadUserProfile.cc","ms"}, 
+  {"func.CredUICmdLinePromptForCredentialsA.cc","ms"}, 
+  {"func.IsValidDpiAwarenessContext.cc","ms"}, 
+  {"func.UpdateProcThreadAttribute.cc","ms"}, 
+  {"func.VarR8FromR4.cc","ms"}, 
+  {"func.SetProcessDpiAwareness.cc","ms"}, 
+  {"func.SleepEx.cc","ms"}, 
+  {"func.PathIsUNCServerShareW.cc","ms"}, 
+  {"func.CertGetNameStringW.cc","ms"}, 
+  {"func.UnRegisterTypeLib.cc","ms"}, 
+  {"func.SetDefaultCommConfigW.cc","ms"}, 
+  {"func.CredMarshalCredentialW.cc","ms"}, 
+  {"func.PathAllocCombine.cc","ms"}, 
+  {"func.AllocateUserPhysicalPages.cc","ms"}, 
+  {"func.CM_Get_Device_ID_ExA.cc","ms"}, 
+  {"func.GetMenuItemInfoW.cc","ms"}, 
+  {"func.AddAccessDeniedObjectAce.cc","ms"}, 
+  {"func.SetMenuItemInfoA.cc","ms"}, 
+  {"func.TraceQueryInformation.cc","ms"}, 
+  {"func.EnumChildWindows.cc","ms"}, 
+  {"func.GetHandleInformation.cc","ms"}, 
+  {"func.GetUpdatedClipboardFormats.cc","ms"}, 
+  {"func.SendNotifyMessageW.cc","ms"}, 
+  {"func.SymEnumLinesW.cc","ms"}, 
+  {"func.K32GetMappedFileNameW.cc","ms"}, 
+  {"func.MoveFileExW.cc","ms"}, 
+  {"func.ldap_bind.cc","ms"}, 
+  {"type.HPEN.size","64"}, 
+  {"func.HeapCompact.cc","ms"}, 
+  {"func.WSAAsyncGetServByName.cc","ms"}, 
+  {"func.PathCchAppendEx.cc","ms"}, 
+  {"func.CharLowerW.cc","ms"}, 
+  {"func.ConvertAuxiliaryCounterToPerformanceCounter.cc","ms"}, 
+  {"func.CoGetCancelObject.cc","ms"}, 
+  {"func.GetDateFormatW.cc","ms"}, 
+  {"func.VarDecFromDisp.cc","ms"}, 
+  {"func.CryptEncodeObject.cc","ms"}, 
+  {"func.CreateJobObjectA.cc","ms"}, 
+  {"func.WSCInstallNameSpaceEx32.cc","ms"}, 
+  {"func.WSADeleteSocketPeerTargetName.cc","ms"}, 
+  {"func.TerminateJobObject.cc","ms"}, 
+  {"func.BCryptDestroyKey.cc","ms"}, 
+  {"func.ber_scanf.cc","ms"}, 
+  {"func.VariantChangeType.cc","ms"}, 
+  {"func.VarUI4FromI4.cc","ms"}, 
+  {"func.CryptVerifyCertificateSignature.cc","ms"}, 
+  {"func.GlobalAddAtomA.cc","ms"}, 
+  {"func.GetFileVersionInfoSizeExA.cc","ms"}, 
+  {"func.EnumUILanguagesA.cc","ms"}, 
+  {"func.WSAGetServiceClassNameByClassIdW.cc","ms"}, 
+  {"func.VarFix.cc","ms"}, 
+  {"func.CharToOemA.cc","ms"}, 
+  {"func.MiniDumpWriteDump.cc","ms"}, 
+  {"func.VarBstrFromI1.cc","ms"}, 
+  {"func.__WSAFDIsSet.cc","ms"}, 
+  {"func.ldap_next_attributeA.cc","ms"}, 
+  {"func.SetThreadpoolTimer.cc","ms"}, 
+  {"func.FlushTraceA.cc","ms"}, 
+  {"func.SetProcessWorkingSetSizeEx.cc","ms"}, 
+  {"func.CryptUninstallDefaultContext.cc","ms"}, 
+  {"func.DeriveAppContainerSidFromAppContainerName.cc","ms"}, 
+  {"func.SymCleanup.cc","ms"}, 
+  {"func.TaskDialogIndirect.cc","ms"}, 
+  {"func.VarUI2FromI4.cc","ms"}, 
+  {"func.VarI8FromUI1.cc","ms"}, 
+  {"func.VarBoolFromR4.cc","ms"}, 
+  {"type.HBITMAP.size","64"}, 
+  {"func.WakeConditionVariable.cc","ms"}, 
+  {"func.CryptGetMessageCertificates.cc","ms"}, 
+  {"func.GetMenuCheckMarkDimensions.cc","ms"}, 
+  {"func.GetSidLengthRequired.cc","ms"}, 
+  {"func.CertSetCertificateContextProperty.cc","ms"}, 
+  {"func.CreateMenu.cc","ms"}, 
+  {"func.EnumSystemCodePagesA.cc","ms"}, 
+  {"func.ldap_bindW.cc","ms"}, 
+  {"func.ldap_get_optionW.cc","ms"}, 
+  {"func.inet_pton.cc","ms"}, 
+  {"func.TileWindows.cc","ms"}, 
+  {"func.CryptVerifyDetachedMessageSignature.cc","ms"}, 
+  {"func.NCryptCreatePersistedKey.cc","ms"}, 
+  {"func.CryptEnumProvidersA.cc","ms"}, 
+  {"func.MoveFileExA.cc","ms"}, 
+  {"func.CreateProcessWithTokenW.cc","ms"}, 
+  {"func.LockServiceDatabase.cc","ms"}, 
+  {"func.WSACancelAsyncRequest.cc","ms"}, 
+  {"func.GlobalSize.cc","ms"}, 
+  {"func.StrFormatByteSizeW.cc","ms"}, 
+  {"func.PathCommonPrefixA.cc","ms"}, 
+  {"func.IsValidLanguageGroup.cc","ms"}, 
+  {"func.DestroyCaret.cc","ms"}, 
+  {"func.RegCreateKeyTransactedA.cc","ms"}, 
+  {"func.GetAsyncKeyState.cc","ms"}, 
+  {"func.VarAdd.cc","ms"}, 
+  {"func.GetAclInformation.cc","ms"}, 
+  {"func.SymFindExecutableImage.cc","ms"}, 
+  {"func.ldap_compare_ext.cc","ms"}, 
+  {"func.SetThreadDpiAwarenessContext.cc","ms"}, 
+  {"func.WritePrivateProfileSectionA.cc","ms"}, 
+  {"func.LocalReAlloc.cc","ms"}, 
+  {"func.WriteConsoleInputA.cc","ms"}, 
+  {"func.CM_Query_Arbitrator_Free_Size.cc","ms"}, 
+  {"func.StrCSpnW.cc","ms"}, 
+  {"func.FileTimeToLocalFileTime.cc","ms"}, 
+  {"func.SetProcessAffinityUpdateMode.cc","ms"}, 
+  {"func.VarDateFromUdateEx.cc","ms"}, 
+  {"func.ldap_simple_bind.cc","ms"}, 
+  {"func.BCryptEnumProviders.cc","ms"}, 
+  {"func.setsockopt.cc","ms"}, 
+  {"func.GetFileVersionInfoSizeExW.cc","ms"}, 
+  {"func.GetActiveWindow.cc","ms"}, 
+  {"func.CertGetCertificateContextProperty.cc","ms"}, 
+  {"func.SetFirmwareEnvironmentVariableW.cc","ms"}, 
+  {"func.ConnectNamedPipe.cc","ms"}, 
+  {"func.GlobalFlags.cc","ms"}, 
+  {"func.CoAllowSetForegroundWindow.cc","ms"}, 
+  {"func.VarCyFromI4.cc","ms"}, 
+  {"func.CertDuplicateCRLContext.cc","ms"}, 
+  {"func.SymLoadModuleExW.cc","ms"}, 
+  {"func.CertGetCertificateChain.cc","ms"}, 
+  {"func.AdjustTokenGroups.cc","ms"}, 
+  {"func.GetPrivateProfileSectionNamesA.cc","ms"}, 
+  {"func.WSAResetEvent.cc","ms"}, 
+  {"func.CM_Query_Arbitrator_Free_Size_Ex.cc","ms"}, 
+  {"func.RegisterPointerInputTargetEx.cc","ms"}, 
+  {"func.NCryptVerifyClaim.cc","ms"}, 
+  {"func.GetCurrentHwProfileW.cc","ms"}, 
+  {"func.SetThreadpoolWaitEx.cc","ms"}, 
+  {"func.CoUnmarshalInterface.cc","ms"}, 
+  {"func.RegCopyTreeW.cc","ms"}, 
+  {"func.WaitServiceState.cc","ms"}, 
+  {"func.WSAConnectByList.cc","ms"}, 
+  {"func.GetStartupInfoA.cc","ms"}, 
+  {"func.ldap_extended_operation.cc","ms"}, 
+  {"func.CM_Set_Class_PropertyW.cc","ms"}, 
+  {"func.ldap_delete_ext.cc","ms"}, 
+  {"func.SymGetExtendedOption.cc","ms"}, 
+  {"func.WPUCreateSocketHandle.cc","ms"}, 
+  {"func.WriteConsoleInputW.cc","ms"}, 
+  {"func.QueryDepthSList.cc","ms"}, 
+  {"func.MapVirtualKeyExW.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_List_Size_ExW.cc","ms"}, 
+  {"func.CM_Get_Class_Name_ExW.cc","ms"}, 
+  {"func.GetProfileSectionW.cc","ms"}, 
+  {"func.ldap_modify_ext_sW.cc","ms"}, 
+  {"func.CreateClassMoniker.cc","ms"}, 
+  {"type.HCONVLIST.size","64"}, 
+  {"func.DialogBoxParamA.cc","ms"}, 
+  {"func.VarR4FromDate.cc","ms"}, 
+  {"func.IsThreadAFiber.cc","ms"}, 
+  {"func.cldap_openA.cc","ms"}, 
+  {"func.CM_Get_First_Log_Conf_Ex.cc","ms"}, 
+  {"func.GetScaleFactorForMonitor.cc","ms"}, 
+  {"func.GetRecordInfoFromTypeInfo.cc","ms"}, 
+  {"func.StrPBrkW.cc","ms"}, 
+  {"func.PathIsSameRootA.cc","ms"}, 
+  {"func.CoCreateFreeThreadedMarshaler.cc","ms"}, 
+  {"func.CM_Get_Class_NameA.cc","ms"}, 
+  {"func.ldap_search_stW.cc","ms"}, 
+  {"func.ldap_get_dn.cc","ms"}, 
+  {"func.GetNameByTypeA.cc","ms"}, 
+  {"func.CoFreeAllLibraries.cc","ms"}, 
+  {"func.CoRevokeInitializeSpy.cc","ms"}, 
+  {"func.CM_Disable_DevNode.cc","ms"}, 
+  {"func.CM_Enumerate_Classes.cc","ms"}, 
+  {"func.MapViewOfFileFromApp.cc","ms"}, 
+  {"func.UrlCanonicalizeW.cc","ms"}, 
+  {"func.DeleteFileTransactedA.cc","ms"}, 
+  {"func.EnumResourceTypesExW.cc","ms"}, 
+  {"func.VirtualFreeEx.cc","ms"}, 
+  {"func.SymUnDName.cc","ms"}, 
+  {"func.WSCInstallProviderAndChains.cc","ms"}, 
+  {"func.VarDateFromBool.cc","ms"}, 
+  {"func.IsOS.cc","ms"}, 
+  {"func.GetSystemWindowsDirectoryA.cc","ms"}, 
+  {"func.ExecuteUmsThread.cc","ms"}, 
+  {"func.VarCyMul.cc","ms"}, 
+  {"func.CancelDeviceWakeupRequest.cc","ms"}, 
+  {"func.CM_Test_Range_Available.cc","ms"}, 
+  {"func.CertEnumPhysicalStore.cc","ms"}, 
+  {"func.GetNumaProcessorNode.cc","ms"}, 
+  {"func.CM_Unregister_Device_Interface_ExA.cc","ms"}, 
+  {"func.ldap_modrdn2A.cc","ms"}, 
+  {"func.GetWriteWatch.cc","ms"}, 
+  {"func.GetRawInputDeviceInfoW.cc","ms"}, 
+  {"func.CM_First_Range.cc","ms"}, 
+  {"func.CreateDirectoryA.cc","ms"}, 
+  {"func.K32EnumProcessModules.cc","ms"}, 
+  {"func.DllGetClassObject.cc","ms"}, 
+  {"func.ldap_explode_dnW.cc","ms"}, 
+  {"func.SymGetLineFromName.cc","ms"}, 
+  {"func.CreateThreadpoolCleanupGroup.cc","ms"}, 
+  {"func.SymGetSourceFileChecksumW.cc","ms"}, 
+  {"func.CM_Is_Dock_Station_Present.cc","ms"}, 
+  {"func.SymGetLineNext.cc","ms"}, 
+  {"func.GetPrivateProfileStructA.cc","ms"}, 
+  {"func.GetUpdateRect.cc","ms"}, 
+  {"func.SHCreateThread.cc","ms"}, 
+  {"func.CreateTapePartition.cc","ms"}, 
+  {"func.CryptExportPKCS8.cc","ms"}, 
+  {"func.IsProcessInJob.cc","ms"}, 
+  {"func.CheckMenuRadioItem.cc","ms"}, 
+  {"func.GetProfileIntA.cc","ms"}, 
+  {"func.GetDiskFreeSpaceExA.cc","ms"}, 
+  {"func.StrRChrIW.cc","ms"}, 
+  {"func.CoCreateInstanceFromApp.cc","ms"}, 
+  {"func.ldap_add_ext_s.cc","ms"}, 
+  {"func.PathMatchSpecExW.cc","ms"}, 
+  {"func.CoGetCallerTID.cc","ms"}, 
+  {"func.ObjectPrivilegeAuditAlarmW.cc","ms"}, 
+  {"func.NCryptDecrypt.cc","ms"}, 
+  {"func.CheckTokenMembership.cc","ms"}, 
+  {"func.VarDateFromI1.cc","ms"}, 
+  {"func.CryptCancelAsyncRetrieval.cc","ms"}, 
+  {"func.CM_Get_Device_ID_List_SizeA.cc","ms"}, 
+  {"func.Compress.cc","ms"}, 
+  {"func.StrRetToBufA.cc","ms"}, 
+  {"func.IsWellKnownSid.cc","ms"}, 
+  {"func.VarR8FromCy.cc","ms"}, 
+  {"func.RegRenameKey.cc","ms"}, 
+  {"func.CM_Open_DevNode_Key.cc","ms"}, 
+  {"func.CM_Unregister_Device_Interface_ExW.cc","ms"}, 
+  {"func.VkKeyScanA.cc","ms"}, 
+  {"func.CM_Detect_Resource_Conflict_Ex.cc","ms"}, 
+  {"func.HeapUnlock.cc","ms"}, 
+  {"func.ldap_create_page_control.cc","ms"}, 
+  {"func.ActivateKeyboardLayout.cc","ms"}, 
+  {"func.CryptBinaryToStringW.cc","ms"}, 
+  {"func.PathParseIconLocationW.cc","ms"}, 
+  {"func.CM_Get_Next_Log_Conf_Ex.cc","ms"}, 
+  {"func.DrawIcon.cc","ms"}, 
+  {"func.ScreenToClient.cc","ms"}, 
+  {"func.FlushViewOfFile.cc","ms"}, 
+  {"func.SetTimeZoneInformation.cc","ms"}, 
+  {"func.GetClassFile.cc","ms"}, 
+  {"func.gethostbyname.cc","ms"}, 
+  {"func.SymEnumerateSymbolsW.cc","ms"}, 
+  {"func.FindDebugInfoFile.cc","ms"}, 
+  {"func.OaEnablePerUserTLibRegistration.cc","ms"}, 
+  {"func.TzSpecificLocalTimeToSystemTime.cc","ms"}, 
+  {"func.RegSaveKeyW.cc","ms"}, 
+  {"func.ProcessGroupPolicyCompletedEx.cc","ms"}, 
+  {"func.BackupEventLogA.cc","ms"}, 
+  {"func.CryptDestroyKey.cc","ms"}, 
+  {"func.StringFromGUID2.cc","ms"}, 
+  {"func.SetMenuItemInfoW.cc","ms"}, 
+  {"func.QueryServiceStatusEx.cc","ms"}, 
+  {"func.NCryptSignHash.cc","ms"}, 
+  {"func.GetSystemMenu.cc","ms"}, 
+  {"func.CoRegisterInitializeSpy.cc","ms"}, 
+  {"func.CertDuplicateCertificateChain.cc","ms"}, 
+  {"func.GetClipboardViewer.cc","ms"}, 
+  {"func.FreeMemoryJobObject.cc","ms"}, 
+  {"func.CreateDialogParamA.cc","ms"}, 
+  {"func.SendNotifyMessageA.cc","ms"}, 
+  {"func.FormatMessageA.cc","ms"}, 
+  {"func.VarUI1FromCy.cc","ms"}, 
+  {"func.LocalHandle.cc","ms"}, 
+  {"func.PeekConsoleInputA.cc","ms"}, 
+  {"func.CM_Get_Device_ID_List_SizeW.cc","ms"}, 
+  {"func.CoGetCurrentLogicalThreadId.cc","ms"}, 
+  {"func.PathFileExistsW.cc","ms"}, 
+  {"type.HANDLE.size","64"}, 
+  {"func.StrRetToBufW.cc","ms"}, 
+  {"func.SymSrvStoreFile.cc","ms"}, 
+  {"func.SymSrvStoreSupplementW.cc","ms"}, 
+  {"func.VarCat.cc","ms"}, 
+  {"func.ObjectCloseAuditAlarmW.cc","ms"}, 
+  {"func.AddAtomA.cc","ms"}, 
+  {"func.PathCchAddExtension.cc","ms"}, 
+  {"func.UnregisterGPNotification.cc","ms"}, 
+  {"func.VkKeyScanW.cc","ms"}, 
+  {"func.GetCommState.cc","ms"}, 
+  {"func.SymEnumSourceLines.cc","ms"}, 
+  {"func.TerminateProcess.cc","ms"}, 
+  {"func.CopySid.cc","ms"}, 
+  {"func.SHRegCreateUSKeyW.cc","ms"}, 
+  {"func.EndMenu.cc","ms"}, 
+  {"func.HeapFree.cc","ms"}, 
+  {"func.InitializeSListHead.cc","ms"}, 
+  {"func.CryptSIPRemoveProvider.cc","ms"}, 
+  {"func.ldap_next_attributeW.cc","ms"}, 
+  {"func.RegSaveKeyExW.cc","ms"}, 
+  {"func.WSAGetServiceClassInfoW.cc","ms"}, 
+  {"func.AddClipboardFormatListener.cc","ms"}, 
+  {"func.InitializeCriticalSection.cc","ms"}, 
+  {"func.InitializeSecurityDescriptor.cc","ms"}, 
+  {"func.GetPhysicalCursorPos.cc","ms"}, 
+  {"func.MakeSureDirectoryPathExists.cc","ms"}, 
+  {"func.GetFileAttributesTransactedA.cc","ms"}, 
+  {"func.GetModuleFileNameExA.cc","ms"}, 
+  {"func.PowerClearRequest.cc","ms"}, 
+  {"func.LoadTypeLibEx.cc","ms"}, 
+  {"func.CreateIconFromResource.cc","ms"}, 
+  {"func.PathFileExistsA.cc","ms"}, 
+  {"func.CryptRetrieveObjectByUrlW.cc","ms"}, 
+  {"func.HeapQueryInformation.cc","ms"}, 
+  {"func.SHAppBarMessage.cc","ms"}, 
+  {"func.GetWindow.cc","ms"}, 
+  {"func.MoveFileTransactedA.cc","ms"}, 
+  {"func.VarI1FromUI8.cc","ms"}, 
+  {"func.CertNameToStrA.cc","ms"}, 
+  {"func.SetComputerNameW.cc","ms"}, 
+  {"func.WSCInstallNameSpaceEx.cc","ms"}, 
+  {"func.IntersectRect.cc","ms"}, 
+  {"func.RegConnectRegistryW.cc","ms"}, 
+  {"func.PathFindFileNameA.cc","ms"}, 
+  {"func.WindowFromPoint.cc","ms"}, 
+  {"func.DeactivateActCtx.cc","ms"}, 
+  {"func.WSCUnInstallNameSpace.cc","ms"}, 
+  {"func.SHCreateItemFromRelativeName.cc","ms"}, 
+  {"func.GetLargePageMinimum.cc","ms"}, 
+  {"func.GetKeyNameTextW.cc","ms"}, 
+  {"func.CM_Add_Empty_Log_Conf.cc","ms"}, 
+  {"func.GetDpiForSystem.cc","ms"}, 
+  {"func.GetSystemPreferredUILanguages.cc","ms"}, 
+  {"func.GetMenuItemCount.cc","ms"}, 
+  {"func.ImageList_Draw.cc","ms"}, 
+  {"func.VarCyCmp.cc","ms"}, 
+  {"func.WinHttpAddRequestHeaders.cc","ms"}, 
+  {"func.WinExec.cc","ms"}, 
+  {"func.QueryServiceLockStatusA.cc","ms"}, 
+  {"func.WSAGetQOSByName.cc","ms"}, 
+  {"func.CM_Get_Child.cc","ms"}, 
+  {"func.CopyFileW.cc","ms"}, 
+  {"func.WSARevertImpersonation.cc","ms"}, 
+  {"func.CM_Get_Hardware_Profile_Info_ExW.cc","ms"}, 
+  {"func.VarFormat.cc","ms"}, 
+  {"func.VarDecCmp.cc","ms"}, 
+  {"func.FindNextStreamW.cc","ms"}, 
+  {"func.lstrcmpiW.cc","ms"}, 
+  {"func.SHRemoveLocalizedName.cc","ms"}, 
+  {"func.WSADuplicateSocketA.cc","ms"}, 
+  {"func.SymGetSymFromAddr.cc","ms"}, 
+  {"func.SetSystemPowerState.cc","ms"}, 
+  {"func.EqualDomainSid.cc","ms"}, 
+  {"func.NCryptGetProperty.cc","ms"}, 
+  {"func.CryptSetKeyParam.cc","ms"}, 
+  {"func.PowerReadACValue.cc","ms"}, 
+  {"func.EnumCalendarInfoExA.cc","ms"}, 
+  {"func.SetComputerNameA.cc","ms"}, 
+  {"func.SHRegEnumUSKeyW.cc","ms"}, 
+  {"func.shutdown.cc","ms"}, 
+  {"func.GetProfileSectionA.cc","ms"}, 
+  {"func.UrlUnescapeA.cc","ms"}, 
+  {"func.FindNextChangeNotification.cc","ms"}, 
+  {"func.ioctlsocket.cc","ms"}, 
+  {"func.NCryptFreeBuffer.cc","ms"}, 
+  {"func.WinHttpTimeFromSystemTime.cc","ms"}, 
+  {"func.SetCapture.cc","ms"}, 
+  {"func.CoCancelCall.cc","ms"}, 
+  {"func.LocalLock.cc","ms"}, 
+  {"func.GetSecurityDescriptorOwner.cc","ms"}, 
+  {"func.VirtualProtectFromApp.cc","ms"}, 
+  {"func.CredUIConfirmCredentialsA.cc","ms"}, 
+  {"func.CreateMDIWindowW.cc","ms"}, 
+  {"func.ldap_simple_bind_sW.cc","ms"}, 
+  {"func.CoInitializeSecurity.cc","ms"}, 
+  {"func.PathIsUNCA.cc","ms"}, 
+  {"func.ldap_controls_freeW.cc","ms"}, 
+  {"func.GetLocaleInfoW.cc","ms"}, 
+  {"func.PathIsSameRootW.cc","ms"}, 
+  {"func.CryptGenRandom.cc","ms"}, 
+  {"func.CoTaskMemRealloc.cc","ms"}, 
+  {"func.ldap_rename_ext_sW.cc","ms"}, 
+  {"func.GetNumberFormatW.cc","ms"}, 
+  {"func.CopyFileA.cc","ms"}, 
+  {"func.CertGetValidUsages.cc","ms"}, 
+  {"func.GetDisplayAutoRotationPreferences.cc","ms"}, 
+  {"func.CertRemoveEnhancedKeyUsageIdentifier.cc","ms"}, 
+  {"func.GetFileMUIPath.cc","ms"}, 
+  {"func.FlatSB_GetScrollProp.cc","ms"}, 
+  {"func.AccessCheckByType.cc","ms"}, 
+  {"func.UnhookWindowsHookEx.cc","ms"}, 
+  {"func.WinHttpOpen.cc","ms"}, 
+  {"func.GetSidSubAuthority.cc","ms"}, 
+  {"func.AddAccessAllowedObjectAce.cc","ms"}, 
+  {"func.CheckMenuItem.cc","ms"}, 
+  {"func.ntohll.cc","ms"}, 
+  {"func.OemKeyScan.cc","ms"}, 
+  {"func.IsTokenUntrusted.cc","ms"}, 
+  {"func.DoEnvironmentSubstW.cc","ms"}, 
+  {"func.SetTraceCallback.cc","ms"}, 
+  {"func.CM_Delete_Device_Interface_KeyW.cc","ms"}, 
+  {"func.CM_Set_HW_Prof_Flags_ExW.cc","ms"}, 
+  {"func.BCryptDeriveKeyPBKDF2.cc","ms"}, 
+  {"func.ldap_modrdn2W.cc","ms"}, 
+  {"func.LookupPrivilegeNameA.cc","ms"}, 
+  {"func.LoadMenuW.cc","ms"}, 
+  {"func.RealGetWindowClassW.cc","ms"}, 
+  {"func.ldap_explode_dnA.cc","ms"}, 
+  {"func.CM_Detect_Resource_Conflict.cc","ms"}, 
+  {"func.CM_Is_Version_Available_Ex.cc","ms"}, 
+  {"func.ldap_modify_sA.cc","ms"}, 
+  {"func.CryptMsgClose.cc","ms"}, 
+  {"func.PathFindSuffixArrayW.cc","ms"}, 
+  {"func.RtlCaptureStackBackTrace.cc","ms"}, 
+  {"func.SHRegSetUSValueW.cc","ms"}, 
+  {"func.CoInstall.cc","ms"}, 
+  {"func.GetWindowModuleFileNameA.cc","ms"}, 
+  {"func.GetServiceKeyNameW.cc","ms"}, 
+  {"func.SetThreadpoolTimerEx.cc","ms"}, 
+  {"func.WritePrivateProfileStructW.cc","ms"}, 
+  {"func.CryptSIPRetrieveSubjectGuidForCatalogFile.cc","ms"}, 
+  {"func.CM_Unregister_Device_InterfaceW.cc","ms"}, 
+  {"func.SetWindowPlacement.cc","ms"}, 
+  {"func.ldap_set_dbg_flags.cc","ms"}, 
+  {"func.CoUnmarshalHresult.cc","ms"}, 
+  {"func.CertGetIssuerCertificateFromStore.cc","ms"}, 
+  {"func.SetProcessReference.cc","ms"}, 
+  {"func.ToUnicodeEx.cc","ms"}, 
+  {"func.AccessCheckByTypeResultListAndAuditAlarmByHandleW.cc","ms"}, 
+  {"func.ObjectPrivilegeAuditAlarmA.cc","ms"}, 
+  {"func.PathCchStripPrefix.cc","ms"}, 
+  {"func.DestroyMenu.cc","ms"}, 
+  {"func.PowerRegisterForEffectivePowerModeNotifications.cc","ms"}, 
+  {"func.ShowWindowAsync.cc","ms"}, 
+  {"func.SHQueryUserNotificationState.cc","ms"}, 
+  {"func.GetPrivateObjectSecurity.cc","ms"}, 
+  {"func.RegisterActiveObject.cc","ms"}, 
+  {"func.CoFreeUnusedLibraries.cc","ms"}, 
+  {"func.InsertMenuW.cc","ms"}, 
+  {"func.QueueUserAPC.cc","ms"}, 
+  {"func.CM_Create_DevNodeW.cc","ms"}, 
+  {"func.VarI4FromStr.cc","ms"}, 
+  {"func.IsBadStringPtrW.cc","ms"}, 
+  {"func.FlsGetValue.cc","ms"}, 
+  {"func.SetWindowLongA.cc","ms"}, 
+  {"func.VarI1FromDate.cc","ms"}, 
+  {"func.NCryptSecretAgreement.cc","ms"}, 
+  {"func.CreateWellKnownSid.cc","ms"}, 
+  {"func.WSASendDisconnect.cc","ms"}, 
+  {"func.ldap_result2error.cc","ms"}, 
+  {"func.PhysicalToLogicalPoint.cc","ms"}, 
+  {"func.SymGetSymPrev64.cc","ms"}, 
+  {"func.CM_Get_Class_Key_NameA.cc","ms"}, 
+  {"func.SymEnumTypesByName.cc","ms"}, 
+  {"func.CopyFileExA.cc","ms"}, 
+  {"func.LoadBitmapW.cc","ms"}, 
+  {"func.VarEqv.cc","ms"}, 
+  {"func.OpenProcess.cc","ms"}, 
+  {"func.GetNamedPipeHandleStateA.cc","ms"}, 
+  {"func.StrFormatKBSizeA.cc","ms"}, 
+  {"func.TranslateNameA.cc","ms"}, 
+  {"func.EnableTraceEx2.cc","ms"}, 
+  {"func.GetClassInfoExW.cc","ms"}, 
+  {"func.bind.cc","ms"}, 
+  {"func.MoveFileA.cc","ms"}, 
+  {"func.AddMandatoryAce.cc","ms"}, 
+  {"func.TlsFree.cc","ms"}, 
+  {"func.SearchTreeForFileW.cc","ms"}, 
+  {"func.CreateDialogParamW.cc","ms"}, 
+  {"func.OleCreatePropertyFrame.cc","ms"}, 
+  {"func.RegDeleteKeyValueA.cc","ms"}, 
+  {"func.CredWriteA.cc","ms"}, 
+  {"func.SetWindowRgn.cc","ms"}, 
+  {"func.CryptHashData.cc","ms"}, 
+  {"func.SetThreadToken.cc","ms"}, 
+  {"func.ldap_modrdn.cc","ms"}, 
+  {"func.GetSecurityDescriptorSacl.cc","ms"}, 
+  {"func.DrawFrameControl.cc","ms"}, 
+  {"func.ObjectCloseAuditAlarmA.cc","ms"}, 
+  {"func.TranslateAcceleratorA.cc","ms"}, 
+  {"func.CryptMsgEncodeAndSignCTL.cc","ms"}, 
+  {"func.CertVerifyRevocation.cc","ms"}, 
+  {"func.GetClipboardSequenceNumber.cc","ms"}, 
+  {"func.CryptVerifySignatureA.cc","ms"}, 
+  {"func.CryptDecryptMessage.cc","ms"}, 
+  {"func.CoRevertToSelf.cc","ms"}, 
+  {"func.GetLongPathNameTransactedA.cc","ms"}, 
+  {"func.StrTrimA.cc","ms"}, 
+  {"func.GetCaretBlinkTime.cc","ms"}, 
+  {"func.AddAce.cc","ms"}, 
+  {"func.SetServiceW.cc","ms"}, 
+  {"func.NotifyWinEvent.cc","ms"}, 
+  {"func.SetFileAttributesW.cc","ms"}, 
+  {"func.WSAInstallServiceClassW.cc","ms"}, 
+  {"func.SetDecompressorInformation.cc","ms"}, 
+  {"func.RegSetKeyValueW.cc","ms"}, 
+  {"func.FindFirstVolumeMountPointA.cc","ms"}, 
+  {"func.GetClassInfoExA.cc","ms"}, 
+  {"func.CoCreateStandardMalloc.cc","ms"}, 
+  {"func.StrStrIW.cc","ms"}, 
+  {"func.GetSystemTimeAdjustment.cc","ms"}, 
+  {"func.CM_Delete_Device_Interface_Key_ExA.cc","ms"}, 
+  {"func.SetThreadIdealProcessorEx.cc","ms"}, 
+  {"func.GetFileVersionInfoSizeA.cc","ms"}, 
+  {"func.SymMatchString.cc","ms"}, 
+  {"func.PrintWindow.cc","ms"}, 
+  {"func.RegDeleteKeyValueW.cc","ms"}, 
+  {"func.RegisterServiceCtrlHandlerExW.cc","ms"}, 
+  {"func.CryptEnumProviderTypesW.cc","ms"}, 
+  {"func.CryptMsgDuplicate.cc","ms"}, 
+  {"func.SetThreadInformation.cc","ms"}, 
+  {"func.AdjustWindowRectExForDpi.cc","ms"}, 
+  {"func.UnhookWindowsHook.cc","ms"}, 
+  {"func.GetConsoleOriginalTitleA.cc","ms"}, 
+  {"func.GetDefaultUserProfileDirectoryW.cc","ms"}, 
+  {"func.ldap_modrdn2_sA.cc","ms"}, 
+  {"func.CreateMailslotA.cc","ms"}, 
+  {"func.LogonUserExA.cc","ms"}, 
+  {"func.LCMapStringW.cc","ms"}, 
+  {"func.ldap_modify_extW.cc","ms"}, 
+  {"func.SetProcessDEPPolicy.cc","ms"}, 
+  {"func.GetFileVersionInfoA.cc","ms"}, 
+  {"func.RegOverridePredefKey.cc","ms"}, 
+  {"func.CM_Get_HW_Prof_FlagsA.cc","ms"}, 
+  {"func.EnumProcesses.cc","ms"}, 
+  {"func.SymGetLineFromName64.cc","ms"}, 
+  {"func.PathUnmakeSystemFolderW.cc","ms"}, 
+  {"func.GetForegroundWindow.cc","ms"}, 
+  {"func.ldap_compare_ext_sW.cc","ms"}, 
+  {"func.SetFileAttributesA.cc","ms"}, 
+  {"func.CancelWaitableTimer.cc","ms"}, 
+  {"func.ldap_abandon.cc","ms"}, 
+  {"func.GetScrollPos.cc","ms"}, 
+  {"func.VarBoolFromDisp.cc","ms"}, 
+  {"func.CoDisableCallCancellation.cc","ms"}, 
+  {"func.GetWindowFeedbackSetting.cc","ms"}, 
+  {"func.CancelSynchronousIo.cc","ms"}, 
+  {"func.SymSetScopeFromAddr.cc","ms"}, 
+  {"func.GetTokenInformation.cc","ms"}, 
+  {"func.GetFileSecurityW.cc","ms"}, 
+  {"func.SHFormatDateTimeA.cc","ms"}, 
+  {"func.GetNumberFormatEx.cc","ms"}, 
+  {"func.CertFindSubjectInSortedCTL.cc","ms"}, 
+  {"func.ldap_add_extW.cc","ms"}, 
+  {"func.CryptSIPRemoveSignedDataMsg.cc","ms"}, 
+  {"func.GetLogicalDriveStringsW.cc","ms"}, 
+  {"func.GetMenuContextHelpId.cc","ms"}, 
+  {"func.K32GetModuleFileNameExA.cc","ms"}, 
+  {"func.VarBstrFromI4.cc","ms"}, 
+  {"func.SHOpenRegStreamW.cc","ms"}, 
+  {"func.GetFileVersionInfoExW.cc","ms"}, 
+  {"func.ReadThreadProfilingData.cc","ms"}, 
+  {"func.OpenWaitableTimerW.cc","ms"}, 
+  {"func.QueryAllTracesA.cc","ms"}, 
+  {"func.SHRegQueryUSValueA.cc","ms"}, 
+  {"func.PowerSetRequest.cc","ms"}, 
+  {"func.AddAccessDeniedAceEx.cc","ms"}, 
+  {"func.CryptInitOIDFunctionSet.cc","ms"}, 
+  {"func.GetRecordInfoFromGuids.cc","ms"}, 
+  {"func.SymFromTokenW.cc","ms"}, 
+  {"func.SHIsFileAvailableOffline.cc","ms"}, 
+  {"func.SHCreateItemFromParsingName.cc","ms"}, 
+  {"func.IsZoomed.cc","ms"}, 
+  {"func.RevokeActiveObject.cc","ms"}, 
+  {"func.VarBoolFromCy.cc","ms"}, 
+  {"func.WSAStringToAddressA.cc","ms"}, 
+  {"func.CoRevokeClassObject.cc","ms"}, 
+  {"func.CryptReleaseContext.cc","ms"}, 
+  {"func.CancelThreadpoolIo.cc","ms"}, 
+  {"func.SHCreateShellItemArray.cc","ms"}, 
+  {"func.ldap_delete_extW.cc","ms"}, 
+  {"func.CertVerifySubjectCertificateContext.cc","ms"}, 
+  {"func.VarI4FromCy.cc","ms"}, 
+  {"func.SHFileOperationA.cc","ms"}, 
+  {"func.RemoveDirectoryA.cc","ms"}, 
+  {"func.ldap_searchW.cc","ms"}, 
+  {"func.CredUIReadSSOCredW.cc","ms"}, 
+  {"func.PostMessageA.cc","ms"}, 
+  {"func.ExtractIconExA.cc","ms"}, 
+  {"func.RegOpenKeyW.cc","ms"}, 
+  {"func.CredIsProtectedA.cc","ms"}, 
+  {"func.SetSecurityDescriptorControl.cc","ms"}, 
+  {"func.GetCommTimeouts.cc","ms"}, 
+  {"func.SHOpenRegStreamA.cc","ms"}, 
+  {"func.DefFrameProcW.cc","ms"}, 
+  {"func.RegisterClassExW.cc","ms"}, 
+  {"func.ldap_compare_sA.cc","ms"}, 
+  {"func.RegUnLoadKeyW.cc","ms"}, 
+  {"func.CreateSemaphoreA.cc","ms"}, 
+  {"func.GetAltTabInfoW.cc","ms"}, 
+  {"func.SHEnumKeyExA.cc","ms"}, 
+  {"func.PFXExportCertStore.cc","ms"}, 
+  {"func.SymAddSourceStream.cc","ms"}, 
+  {"func.CredRenameA.cc","ms"}, 
+  {"func.CertSetCRLContextProperty.cc","ms"}, 
+  {"func.VarUI2FromI2.cc","ms"}, 
+  {"func.DoEnvironmentSubstA.cc","ms"}, 
+  {"func.CM_Delete_Device_Interface_KeyA.cc","ms"}, 
+  {"func.LoadMenuA.cc","ms"}, 
+  {"func.WSCGetApplicationCategory.cc","ms"}, 
+  {"func.CertAddEnhancedKeyUsageIdentifier.cc","ms"}, 
+  {"func.RegOpenKeyExW.cc","ms"}, 
+  {"func.ImageList_LoadImageA.cc","ms"}, 
+  {"func.ldap_addA.cc","ms"}, 
+  {"func.CheckDlgButton.cc","ms"}, 
+  {"func.GetAppContainerRegistryLocation.cc","ms"}, 
+  {"func.MakeAbsoluteSD.cc","ms"}, 
+  {"func.UmsThreadYield.cc","ms"}, 
+  {"func.CreateGenericComposite.cc","ms"}, 
+  {"func.RegEnumKeyExA.cc","ms"}, 
+  {"func.GetMessageTime.cc","ms"}, 
+  {"func.WSAStringToAddressW.cc","ms"}, 
+  {"func.GetErrorMode.cc","ms"}, 
+  {"func.CreateDispTypeInfo.cc","ms"}, 
+  {"func.IsNativeVhdBoot.cc","ms"}, 
+  {"func.WriteEncryptedFileRaw.cc","ms"}, 
+  {"func.VarCyFromR4.cc","ms"}, 
+  {"func.CreateConsoleScreenBuffer.cc","ms"}, 
+  {"func.VarBoolFromI4.cc","ms"}, 
+  {"func.GetNumaNodeProcessorMaskEx.cc","ms"}, 
+  {"func.OpenEventW.cc","ms"}, 
+  {"func.ImageList_Copy.cc","ms"}, 
+  {"func.AddScopedPolicyIDAce.cc","ms"}, 
+  {"func.InitOnceInitialize.cc","ms"}, 
+  {"func.ClosePrivateNamespace.cc","ms"}, 
+  {"func.PowerUnregisterFromEffectivePowerModeNotifications.cc","ms"}, 
+  {"func.ClearCommBreak.cc","ms"}, 
+  {"func.SymSrvIsStore.cc","ms"}, 
+  {"func.VirtualQueryEx.cc","ms"}, 
+  {"func.CLSIDFromProgID.cc","ms"}, 
+  {"func.CM_Open_DevNode_Key_Ex.cc","ms"}, 
+  {"func.OpenSemaphoreW.cc","ms"}, 
+  {"func.CryptUnprotectData.cc","ms"}, 
+  {"func.InvalidateRect.cc","ms"}, 
+  {"func.WindowFromPhysicalPoint.cc","ms"}, 
+  {"func.WaitForDebugEventEx.cc","ms"}, 
+  {"func.CM_Create_DevNodeA.cc","ms"}, 
+  {"func.NotifyServiceStatusChangeA.cc","ms"}, 
+  {"func.FlatSB_SetScrollRange.cc","ms"}, 
+  {"func.MonitorFromWindow.cc","ms"}, 
+  {"func.VarI8FromUI8.cc","ms"}, 
+  {"func.GetDateFormatA.cc","ms"}, 
+  {"func.BCryptFinalizeKeyPair.cc","ms"}, 
+  {"func.SymFromInlineContextW.cc","ms"}, 
+  {"func.VirtualAllocExNuma.cc","ms"}, 
+  {"func.FreeResource.cc","ms"}, 
+  {"func.CreateJobObjectW.cc","ms"}, 
+  {"func.VarR8FromI2.cc","ms"}, 
+  {"func.WPUCompleteOverlappedRequest.cc","ms"}, 
+  {"func.VarDecFromUI1.cc","ms"}, 
+  {"func.SymSrvGetSupplementW.cc","ms"}, 
+  {"func.VarDecFromI8.cc","ms"}, 
+  {"func.TrySubmitThreadpoolCallback.cc","ms"}, 
+  {"func.ChangeServiceConfigW.cc","ms"}, 
+  {"func.AcquireSRWLockExclusive.cc","ms"}, 
+  {"func.PathAddBackslashA.cc","ms"}, 
+  {"func.DrawAnimatedRects.cc","ms"}, 
+  {"func.sendto.cc","ms"}, 
+  {"func.CallNamedPipeA.cc","ms"}, 
+  {"func.CallNextHookEx.cc","ms"}, 
+  {"func.GetAcceptLanguagesW.cc","ms"}, 
+  {"func.RegisterClassW.cc","ms"}, 
+  {"func.PathCchCanonicalize.cc","ms"}, 
+  {"func.ExcludeUpdateRgn.cc","ms"}, 
+  {"func.FindVolumeClose.cc","ms"}, 
+  {"func.WSASetServiceA.cc","ms"}, 
+  {"func.CertAddCRLLinkToStore.cc","ms"}, 
+  {"func.SymSetScopeFromInlineContext.cc","ms"}, 
+  {"func.GetPriorityClipboardFormat.cc","ms"}, 
+  {"func.SHUnicodeToUnicode.cc","ms"}, 
+  {"func.GetRawInputBuffer.cc","ms"}, 
+  {"func.RealChildWindowFromPoint.cc","ms"}, 
+  {"func.ClearCustData.cc","ms"}, 
+  {"func.SysAddRefString.cc","ms"}, 
+  {"func.AbortSystemShutdownA.cc","ms"}, 
+  {"func.GetConsoleScreenBufferInfo.cc","ms"}, 
+  {"func.GetWsChanges.cc","ms"}, 
+  {"func.SHRegGetValueA.cc","ms"}, 
+  {"func.SHRegDeleteUSValueA.cc","ms"}, 
+  {"func.PathSearchAndQualifyA.cc","ms"}, 
+  {"func.VarUI4FromCy.cc","ms"}, 
+  {"func.FindResourceExW.cc","ms"}, 
+  {"func.PathCchFindExtension.cc","ms"}, 
+  {"func.CertSetCertificateContextPropertiesFromCTLEntry.cc","ms"}, 
+  {"func.EnumSystemLocalesW.cc","ms"}, 
+  {"func.PrepareTape.cc","ms"}, 
+  {"func.SleepConditionVariableCS.cc","ms"}, 
+  {"func.CryptDecryptAndVerifyMessageSignature.cc","ms"}, 
+  {"func.SetSecurityDescriptorRMControl.cc","ms"}, 
+  {"func.ldap_get_values.cc","ms"}, 
+  {"func.SymUnloadModule.cc","ms"}, 
+  {"func.CM_Create_DevNode_ExW.cc","ms"}, 
+  {"func.GetNameInfoW.cc","ms"}, 
+  {"func.IStream_Reset.cc","ms"}, 
+  {"func.RevokeScaleChangeNotifications.cc","ms"}, 
+  {"func.GetVolumeNameForVolumeMountPointA.cc","ms"}, 
+  {"func.FindExecutableA.cc","ms"}, 
+  {"func.ldap_create_page_controlA.cc","ms"}, 
+  {"func.CM_Set_Class_Registry_PropertyA.cc","ms"}, 
+  {"func.WSCUpdateProvider32.cc","ms"}, 
+  {"func.VarDecFromDate.cc","ms"}, 
+  {"func.DuplicateToken.cc","ms"}, 
+  {"func.WSASend.cc","ms"}, 
+  {"func.CryptGetDefaultOIDFunctionAddress.cc","ms"}, 
+  {"func.FlsSetValue.cc","ms"}, 
+  {"func.CM_Set_Device_Interface_PropertyW.cc","ms"}, 
+  {"func.WinHttpGetProxyResultEx.cc","ms"}, 
+  {"func.GetMappedFileNameA.cc","ms"}, 
+  {"func.SHGetStockIconInfo.cc","ms"}, 
+  {"func.ShellExecuteExA.cc","ms"}, 
+  {"func.ntohl.cc","ms"}, 
+  {"func.PathIsDirectoryA.cc","ms"}, 
+  {"func.GetNumaNodeNumberFromHandle.cc","ms"}, 
+  {"func.IsDialogMessageA.cc","ms"}, 
+  {"func.CryptMsgGetAndVerifySigner.cc","ms"}, 
+  {"func.CertSerializeCRLStoreElement.cc","ms"}, 
+  {"func.SHAssocEnumHandlers.cc","ms"}, 
+  {"func.DispGetIDsOfNames.cc","ms"}, 
+  {"func.WSARemoveServiceClass.cc","ms"}, 
+  {"func.GetProfileStringA.cc","ms"}, 
+  {"func.SHGetNewLinkInfoA.cc","ms"}, 
+  {"func.CryptVerifyMessageSignatureWithKey.cc","ms"}, 
+  {"func.CreateFileMappingNumaW.cc","ms"}, 
+  {"func.SetFileInformationByHandle.cc","ms"}, 
+  {"func.CryptEnumProviderTypesA.cc","ms"}, 
+  {"func.PathStripPathW.cc","ms"}, 
+  {"func.CoDecodeProxy.cc","ms"}, 
+  {"func.SHCreateShellPalette.cc","ms"}, 
+  {"func.VarR8FromBool.cc","ms"}, 
+  {"func.ldap_modify_ext.cc","ms"}, 
+  {"func.ReadFile.cc","ms"}, 
+  {"func.VarBstrCmp.cc","ms"}, 
+  {"func.AccessCheckAndAuditAlarmA.cc","ms"}, 
+  {"func.DisplayConfigSetDeviceInfo.cc","ms"}, 
+  {"func.LdapMapErrorToWin32.cc","ms"}, 
+  {"func.NCryptImportKey.cc","ms"}, 
+  {"func.SetParent.cc","ms"}, 
+  {"func.CertComparePublicKeyInfo.cc","ms"}, 
+  {"func.PathUndecorateA.cc","ms"}, 
+  {"func.VarUI1FromI8.cc","ms"}, 
+  {"func.GetProcessWorkingSetSize.cc","ms"}, 
+  {"func.WSAQuerySocketSecurity.cc","ms"}, 
+  {"func.NotifyBootConfigStatus.cc","ms"}, 
+  {"func.CreateFileMappingFromApp.cc","ms"}, 
+  {"func.DefDlgProcA.cc","ms"}, 
+  {"func.ldap_create_vlv_controlW.cc","ms"}, 
+  {"func.GetThreadPriority.cc","ms"}, 
+  {"func.FindExecutableW.cc","ms"}, 
+  {"func.CreateRestrictedToken.cc","ms"}, 
+  {"func.MsgWaitForMultipleObjects.cc","ms"}, 
+  {"func.CM_Set_HW_Prof_Ex.cc","ms"}, 
+  {"func.GetWindowTextA.cc","ms"}, 
+  {"func.WSCInstallQOSTemplate.cc","ms"}, 
+  {"func.CreateIoCompletionPort.cc","ms"}, 
+  {"func.SymEnumSymbolsForAddrW.cc","ms"}, 
+  {"func.ShellExecuteExW.cc","ms"}, 
+  {"func.DestroyAcceleratorTable.cc","ms"}, 
+  {"func.CM_Get_Resource_Conflict_DetailsA.cc","ms"}, 
+  {"func.CM_Query_And_Remove_SubTree_ExA.cc","ms"}, 
+  {"func.SHCreateStreamOnFileW.cc","ms"}, 
+  {"func.PathCchRemoveFileSpec.cc","ms"}, 
+  {"func.Wow64EnableWow64FsRedirection.cc","ms"}, 
+  {"func.LoadEnclaveData.cc","ms"}, 
+  {"func.PathFindExtensionW.cc","ms"}, 
+  {"func.PathIsPrefixW.cc","ms"}, 
+  {"func.WinHttpQueryHeaders.cc","ms"}, 
+  {"func.getsockname.cc","ms"}, 
+  {"func.WSARecvFrom.cc","ms"}, 
+  {"func.ProcessTrace.cc","ms"}, 
+  {"func.SysAllocStringByteLen.cc","ms"}, 
+  {"func.WSAUnadvertiseProvider.cc","ms"}, 
+  {"func.BCryptCreateMultiHash.cc","ms"}, 
+  {"func.ntohs.cc","ms"}, 
+  {"func.CM_Request_Device_Eject_ExA.cc","ms"}, 
+  {"func.SetEnvironmentStringsW.cc","ms"}, 
+  {"func.SHRegDuplicateHKey.cc","ms"}, 
+  {"func.GetExitCodeProcess.cc","ms"}, 
+  {"func.AddAccessDeniedAce.cc","ms"}, 
+  {"func.VarDecFromR4.cc","ms"}, 
+  {"func.GetThreadDesktop.cc","ms"}, 
+  {"func.IsBadCodePtr.cc","ms"}, 
+  {"func.Sleep.cc","ms"}, 
+  {"func.PathIsSystemFolderW.cc","ms"}, 
+  {"func.CreateThread.cc","ms"}, 
+  {"func.ldap_escape_filter_elementW.cc","ms"}, 
+  {"func.VarBoolFromUI8.cc","ms"}, 
+  {"func.WinHelpA.cc","ms"}, 
+  {"func.WinHttpWebSocketReceive.cc","ms"}, 
+  {"func.ldap_create_sort_controlA.cc","ms"}, 
+  {"type.HFILE.size","64"}, 
+  {"func.NCryptOpenStorageProvider.cc","ms"}, 
+  {"func.VarDateFromI8.cc","ms"}, 
+  {"func.RegDeleteTreeA.cc","ms"}, 
+  {"func.FindResourceA.cc","ms"}, 
+  {"func.VarBstrFromBool.cc","ms"}, 
+  {"func.BCryptGetProperty.cc","ms"}, 
+  {"func.CoTaskMemFree.cc","ms"}, 
+  {"func.CoGetPSClsid.cc","ms"}, 
+  {"func.DeleteVolumeMountPointW.cc","ms"}, 
+  {"func.SymFromName.cc","ms"}, 
+  {"func.RegQueryMultipleValuesW.cc","ms"}, 
+  {"func.CM_Add_Res_Des_Ex.cc","ms"}, 
+  {"func.PathRemoveExtensionA.cc","ms"}, 
+  {"func.DeviceIoControl.cc","ms"}, 
+  {"func.SymEnumProcesses.cc","ms"}, 
+  {"type.DWORD_PTE.size","64"}, 
+  {"func.CreateEnclave.cc","ms"}, 
+  {"func.VarUI1FromStr.cc","ms"}, 
+  {"func.DefFrameProcA.cc","ms"}, 
+  {"func.ldap_sasl_bindW.cc","ms"}, 
+  {"func.WSCSetProviderInfo.cc","ms"}, 
+  {"func.VarTokenizeFormatString.cc","ms"}, 
+  {"func.SHEnumKeyExW.cc","ms"}, 
+  {"func.BindIoCompletionCallback.cc","ms"}, 
+  {"func.EnumServicesStatusExA.cc","ms"}, 
+  {"func.VarR4FromCy.cc","ms"}, 
+  {"func.SHQueryValueExA.cc","ms"}, 
+  {"func.BCryptGetFipsAlgorithmMode.cc","ms"}, 
+  {"func.VarI2FromI1.cc","ms"}, 
+  {"func.GetGeoInfoW.cc","ms"}, 
+  {"func.GetPointerInfoHistory.cc","ms"}, 
+  {"func.RegisterEventSourceW.cc","ms"}, 
+  {"func.QueryServiceConfig2A.cc","ms"}, 
+  {"func.DragFinish.cc","ms"}, 
+  {"func.DebugActiveProcessStop.cc","ms"}, 
+  {"func.GetWindowLongA.cc","ms"}, 
+  {"func.RegDisableReflectionKey.cc","ms"}, 
+  {"func.EmptyWorkingSet.cc","ms"}, 
+  {"func.DlgDirSelectExA.cc","ms"}, 
+  {"func.CharPrevExA.cc","ms"}, 
+  {"func.VarUI4FromDisp.cc","ms"}, 
+  {"func.ImagehlpApiVersion.cc","ms"}, 
+  {"func.CM_Get_DevNode_Registry_PropertyA.cc","ms"}, 
+  {"func.FoldStringA.cc","ms"}, 
+  {"func.TrackMouseEvent.cc","ms"}, 
+  {"func.GetClassInfoA.cc","ms"}, 
+  {"func.CryptGetDefaultProviderA.cc","ms"}, 
+  {"func.CryptSetHashParam.cc","ms"}, 
+  {"func.CoAllowUnmarshalerCLSID.cc","ms"}, 
+  {"func.HiliteMenuItem.cc","ms"}, 
+  {"func.EnumSystemLocalesEx.cc","ms"}, 
+  {"func.WSALookupServiceBeginW.cc","ms"}, 
+  {"func.WSARecvDisconnect.cc","ms"}, 
+  {"func.RegisterDeviceNotificationA.cc","ms"}, 
+  {"func.CM_Enumerate_EnumeratorsW.cc","ms"}, 
+  {"func.IsLFNDriveA.cc","ms"}, 
+  {"func.PathRemoveFileSpecW.cc","ms"}, 
+  {"func.WSCGetProviderInfo.cc","ms"}, 
+  {"func.VarI2FromUI4.cc","ms"}, 
+  {"func.GetUserPreferredUILanguages.cc","ms"}, 
+  {"func.SetSystemTime.cc","ms"}, 
+  {"func.SendMessageTimeoutW.cc","ms"}, 
+  {"func.ObjectDeleteAuditAlarmW.cc","ms"}, 
+  {"func.LdapUTF8ToUnicode.cc","ms"}, 
+  {"func.EnumServicesStatusExW.cc","ms"}, 
+  {"func.EnumPropsExW.cc","ms"}, 
+  {"func.GetTempPathW.cc","ms"}, 
+  {"func.UnregisterWait.cc","ms"}, 
+  {"func.AnyPopup.cc","ms"}, 
+  {"func.SendDlgItemMessageW.cc","ms"}, 
+  {"func.GetShortPathNameA.cc","ms"}, 
+  {"func.InitAtomTable.cc","ms"}, 
+  {"func.VarUI2FromI1.cc","ms"}, 
+  {"func.CallWindowProcW.cc","ms"}, 
+  {"func.PathAddBackslashW.cc","ms"}, 
+  {"func.CertCreateCertificateContext.cc","ms"}, 
+  {"func.CM_Get_Version.cc","ms"}, 
+  {"func.CredGetSessionTypes.cc","ms"}, 
+  {"func.PathUnquoteSpacesW.cc","ms"}, 
+  {"func.GetLongPathNameA.cc","ms"}, 
+  {"func.PathCchRemoveExtension.cc","ms"}, 
+  {"func.CoRegisterClassObject.cc","ms"}, 
+  {"func.CM_Get_DevNode_Registry_PropertyW.cc","ms"}, 
+  {"func.FoldStringW.cc","ms"}, 
+  {"func.MapViewOfFileExNuma.cc","ms"}, 
+  {"func.GetMemoryErrorHandlingCapabilities.cc","ms"}, 
+  {"func.SetSystemTimeAdjustmentPrecise.cc","ms"}, 
+  {"func.VarI1FromI2.cc","ms"}, 
+  {"func.GetCPInfo.cc","ms"}, 
+  {"func.EventRegister.cc","ms"}, 
+  {"func.CoQueryProxyBlanket.cc","ms"}, 
+  {"func.RegisterDeviceNotificationW.cc","ms"}, 
+  {"func.GetNumaNodeProcessorMask.cc","ms"}, 
+  {"func.EncodeSystemPointer.cc","ms"}, 
+  {"func.InstallELAMCertificateInfo.cc","ms"}, 
+  {"func.CoFreeLibrary.cc","ms"}, 
+  {"func.SetThreadpoolWait.cc","ms"}, 
+  {"func.DcomChannelSetHResult.cc","ms"}, 
+  {"func.LoadLibraryExA.cc","ms"}, 
+  {"func.SetConsoleOutputCP.cc","ms"}, 
+  {"func.CoBuildVersion.cc","ms"}, 
+  {"func.PathCanonicalizeA.cc","ms"}, 
+  {"func.VarR4FromUI8.cc","ms"}, 
+  {"func.SymDeleteSymbolW.cc","ms"}, 
+  {"func.ldap_modify_ext_s.cc","ms"}, 
+  {"func.VarXor.cc","ms"}, 
+  {"func.CM_Move_DevNode_Ex.cc","ms"}, 
+  {"func.SetUserObjectSecurity.cc","ms"}, 
+  {"func.SetWinEventHook.cc","ms"}, 
+  {"func.ldap_control_freeW.cc","ms"}, 
+  {"func.VarSub.cc","ms"}, 
+  {"func.FindFirstFileExW.cc","ms"}, 
+  {"func.SetAddrInfoExA.cc","ms"}, 
+  {"func.SHRegEnumUSValueW.cc","ms"}, 
+  {"func.PathCchCombine.cc","ms"}, 
+  {"func.SymEnumerateSymbols64.cc","ms"}, 
+  {"func.SHFreeShared.cc","ms"}, 
+  {"func.EnumClipboardFormats.cc","ms"}, 
+  {"func.VarCyFromUI8.cc","ms"}, 
+  {"func.UrlCreateFromPathW.cc","ms"}, 
+  {"func.GetVolumeNameForVolumeMountPointW.cc","ms"}, 
+  {"func.SymQueryInlineTrace.cc","ms"}, 
+  {"func.Shell_NotifyIconGetRect.cc","ms"}, 
+  {"func.CreateThreadpoolIo.cc","ms"}, 
+  {"func.GetPriorityClass.cc","ms"}, 
+  {"func.CertAddSerializedElementToStore.cc","ms"}, 
+  {"func.IUnknown_AtomicRelease.cc","ms"}, 
+  {"func.DlgDirListA.cc","ms"}, 
+  {"func.NCryptCloseProtectionDescriptor.cc","ms"}, 
+  {"func.RtlPcToFileHeader.cc","ms"}, 
+  {"func.SwitchDesktop.cc","ms"}, 
+  {"func.SetSecurityAccessMask.cc","ms"}, 
+  {"func.IsGUIThread.cc","ms"}, 
+  {"func.IsDBCSLeadByte.cc","ms"}, 
+  {"type.HINSTANCE.size","64"}, 
+  {"func.VarI8FromCy.cc","ms"}, 
+  {"func.EnumSystemGeoNames.cc","ms"}, 
+  {"func.WPUQueryBlockingCallback.cc","ms"}, 
+  {"func.VarUI4FromUI8.cc","ms"}, 
+  {"func.CoGetInstanceFromIStorage.cc","ms"}, 
+  {"func.CreateCursor.cc","ms"}, 
+  {"func.CertAddCTLContextToStore.cc","ms"}, 
+  {"func.GetVolumePathNamesForVolumeNameA.cc","ms"}, 
+  {"func.SafeArrayPutElement.cc","ms"}, 
+  {"func.CM_Get_Hardware_Profile_Info_ExA.cc","ms"}, 
+  {"func.SetAclInformation.cc","ms"}, 
+  {"func.PathCompactPathA.cc","ms"}, 
+  {"func.SetWindowPos.cc","ms"}, 
+  {"func.CreateHardLinkA.cc","ms"}, 
+  {"func.BCryptHashData.cc","ms"}, 
+  {"func.lstrcpyA.cc","ms"}, 
+  {"func.CryptGetHashParam.cc","ms"}, 
+  {"func.StopTraceA.cc","ms"}, 
+  {"func.GetModuleHandleExW.cc","ms"}, 
+  {"func.PathIsRootW.cc","ms"}, 
+  {"func.FindFirstVolumeA.cc","ms"}, 
+  {"func.ldap_control_freeA.cc","ms"}, 
+  {"func.WinHttpWebSocketShutdown.cc","ms"}, 
+  {"func.ChangeDisplaySettingsExA.cc","ms"}, 
+  {"func.DestroyPrivateObjectSecurity.cc","ms"}, 
+  {"func.CoGetApartmentType.cc","ms"}, 
+  {"func.GetCompressedFileSizeA.cc","ms"}, 
+  {"func.CM_Add_Res_Des.cc","ms"}, 
+  {"func.CM_Get_First_Log_Conf.cc","ms"}, 
+  {"func.CM_Next_Range.cc","ms"}, 
+  {"func.ExtractIconW.cc","ms"}, 
+  {"func.VarWeekdayName.cc","ms"}, 
+  {"func.QueryActCtxW.cc","ms"}, 
+  {"type.HKL.size","64"}, 
+  {"func.SymLoadModule.cc","ms"}, 
+  {"func.GetServiceW.cc","ms"}, 
+  {"type.HGLOBAL.size","64"}, 
+  {"func.VarFormatPercent.cc","ms"}, 
+  {"func.SetFirmwareEnvironmentVariableA.cc","ms"}, 
+  {"func.SetProcessPriorityBoost.cc","ms"}, 
+  {"func.SymEnumSourceLinesW.cc","ms"}, 
+  {"func.SHSetValueW.cc","ms"}, 
+  {"func.ldap_explode_dn.cc","ms"}, 
+  {"func.DeleteService.cc","ms"}, 
+  {"func.CryptGetDefaultOIDDllList.cc","ms"}, 
+  {"func.ldap_compareW.cc","ms"}, 
+  {"func.OleTranslateColor.cc","ms"}, 
+  {"func.BlockInput.cc","ms"}, 
+  {"func.CertGetCRLContextProperty.cc","ms"}, 
+  {"func.GetMaximumProcessorGroupCount.cc","ms"}, 
+  {"func.GetVersionExW.cc","ms"}, 
+  {"func.BCryptAddContextFunction.cc","ms"}, 
+  {"func.SetProcessAffinityMask.cc","ms"}, 
+  {"func.CertAddCRLContextToStore.cc","ms"}, 
+  {"func.PathCompactPathExA.cc","ms"}, 
+  {"func.CertIsStrongHashToSign.cc","ms"}, 
+  {"func.VerInstallFileA.cc","ms"}, 
+  {"func.RtlLookupFunctionEntryCHPE.cc","ms"}, 
+  {"func.ber_alloc_t.cc","ms"}, 
+  {"func.WaitNamedPipeW.cc","ms"}, 
+  {"func.CopyAcceleratorTableA.cc","ms"}, 
+  {"func.EnumDisplaySettingsExW.cc","ms"}, 
+  {"func.GetDefaultCommConfigA.cc","ms"}, 
+  {"func.StrRStrIA.cc","ms"}, 
+  {"func.RegQueryValueA.cc","ms"}, 
+  {"func.SymEnumSymbolsForAddr.cc","ms"}, 
+  {"func.FlashWindow.cc","ms"}, 
+  {"func.UrlIsNoHistoryW.cc","ms"}, 
+  {"func.OperationEnd.cc","ms"}, 
+  {"func.VarUI8FromBool.cc","ms"}, 
+  {"func.SendMessageA.cc","ms"}, 
+  {"func.WinHttpSendRequest.cc","ms"}, 
+  {"func.CharNextA.cc","ms"}, 
+  {"func.SymSetContext.cc","ms"}, 
+  {"func.SymRegisterFunctionEntryCallback.cc","ms"}, 
+  {"func.CreateMappedBitmap.cc","ms"}, 
+  {"func.ldap_sasl_bind_sA.cc","ms"}, 
+  {"func.ChangeServiceConfig2W.cc","ms"}, 
+  {"func.GetServiceA.cc","ms"}, 
+  {"func.ClearCommError.cc","ms"}, 
+  {"func.ImagehlpApiVersionEx.cc","ms"}, 
+  {"func.CheckTokenMembershipEx.cc","ms"}, 
+  {"func.GetScrollRange.cc","ms"}, 
+  {"func.GetSystemMetricsForDpi.cc","ms"}, 
+  {"func.CM_Register_Device_Interface_ExW.cc","ms"}, 
+  {"func.ConvertSidToStringSidA.cc","ms"}, 
+  {"func.GetProcessHeaps.cc","ms"}, 
+  {"func.GetUmsSystemThreadInformation.cc","ms"}, 
+  {"func.OffsetRect.cc","ms"}, 
+  {"func.QueryIoRateControlInformationJobObject.cc","ms"}, 
+  {"func.GetModuleHandleA.cc","ms"}, 
+  {"func.GetProductInfo.cc","ms"}, 
+  {"func.UrlIsW.cc","ms"}, 
+  {"func.ControlServiceExA.cc","ms"}, 
+  {"func.WPUQueueApc.cc","ms"}, 
+  {"func.VarUI8FromI8.cc","ms"}, 
+  {"func.PathMakeSystemFolderW.cc","ms"}, 
+  {"func.GetKBCodePage.cc","ms"}, 
+  {"func.VarUI4FromDate.cc","ms"}, 
+  {"func.WaitForDebugEvent.cc","ms"}, 
+  {"func.WSAProviderConfigChange.cc","ms"}, 
+  {"func.DrawCaption.cc","ms"}, 
+  {"func.VarUI1FromDec.cc","ms"}, 
+  {"func.GetDisplayConfigBufferSizes.cc","ms"}, 
+  {"func.WinHttpCloseHandle.cc","ms"}, 
+  {"func.SymGetLinePrev.cc","ms"}, 
+  {"func.CryptGetMessageSignerCount.cc","ms"}, 
+  {"func.BCryptQueryContextFunctionConfiguration.cc","ms"}, 
+  {"func.ldap_sasl_bindA.cc","ms"}, 
+  {"func.GetWindowsAccountDomainSid.cc","ms"}, 
+  {"func.SetTimerQueueTimer.cc","ms"}, 
+  {"func._TrackMouseEvent.cc","ms"}, 
+  {"func.SymGetLineFromNameW64.cc","ms"}, 
+  {"func.LookupAccountNameW.cc","ms"}, 
+  {"func.LoadStringByReference.cc","ms"}, 
+  {"func.WSAAsyncGetProtoByNumber.cc","ms"}, 
+  {"func.QueryPerformanceCounter.cc","ms"}, 
+  {"func.LogonUserW.cc","ms"}, 
+  {"func.ChangeServiceConfig2A.cc","ms"}, 
+  {"func.GetGeoInfoA.cc","ms"}, 
+  {"func.RtlCompareMemory.cc","ms"}, 
+  {"func.IsBadWritePtr.cc","ms"}, 
+  {"func.InitializeContext.cc","ms"}, 
+  {"func.htonl.cc","ms"}, 
+  {"func.OemToCharA.cc","ms"}, 
+  {"func.wvsprintfW.cc","ms"}, 
+  {"func.RevertToSelf.cc","ms"}, 
+  {"func.SHAllocShared.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_AliasA.cc","ms"}, 
+  {"type.HDROP.size","64"}, 
+  {"func.CloseThreadpoolCleanupGroupMembers.cc","ms"}, 
+  {"func.InjectTouchInput.cc","ms"}, 
+  {"func.CertCompareCertificateName.cc","ms"}, 
+  {"func.ldap_value_freeA.cc","ms"}, 
+  {"func.VarI2FromR4.cc","ms"}, 
+  {"func.RemoveDllDirectory.cc","ms"}, 
+  {"func.CopyFileExW.cc","ms"}, 
+  {"func.SysStringByteLen.cc","ms"}, 
+  {"func.UnlockServiceDatabase.cc","ms"}, 
+  {"func.SysFreeString.cc","ms"}, 
+  {"func.VarDateFromCy.cc","ms"}, 
+  {"func.MakeDragList.cc","ms"}, 
+  {"func.AssocQueryStringByKeyA.cc","ms"}, 
+  {"func.IsRectEmpty.cc","ms"}, 
+  {"func.MoveFileW.cc","ms"}, 
+  {"func.VarBstrFromUI8.cc","ms"}, 
+  {"func.WSALookupServiceBeginA.cc","ms"}, 
+  {"func.CheckRadioButton.cc","ms"}, 
+  {"func.SetThreadPriorityBoost.cc","ms"}, 
+  {"func.CreateNamedPipeA.cc","ms"}, 
+  {"func.GetSystemTimePreciseAsFileTime.cc","ms"}, 
+  {"func.VirtualProtect.cc","ms"}, 
+  {"func.ldap_delete_sA.cc","ms"}, 
+  {"func.CreateMutexExW.cc","ms"}, 
+  {"func.SetConsoleCP.cc","ms"}, 
+  {"func.GetLayeredWindowAttributes.cc","ms"}, 
+  {"type.LPFILETIME.size","64"}, 
+  {"func.CM_Get_Device_Interface_ListW.cc","ms"}, 
+  {"func.RegisterServiceCtrlHandlerW.cc","ms"}, 
+  {"func.GetClassNameA.cc","ms"}, 
+  {"func.SHEmptyRecycleBinA.cc","ms"}, 
+  {"func.CryptGetOIDFunctionAddress.cc","ms"}, 
+  {"func.CoTreatAsClass.cc","ms"}, 
+  {"func.SHRegGetBoolUSValueA.cc","ms"}, 
+  {"func.CryptVerifySignatureW.cc","ms"}, 
+  {"func.CM_Get_DevNode_Property_ExW.cc","ms"}, 
+  {"func.ReadConsoleW.cc","ms"}, 
+  {"func.SHCreateItemFromIDList.cc","ms"}, 
+  {"func.EmptyClipboard.cc","ms"}, 
+  {"func.VariantCopy.cc","ms"}, 
+  {"func.GetClipboardData.cc","ms"}, 
+  {"func.DrawStateA.cc","ms"}, 
+  {"func.QueryServiceStatus.cc","ms"}, 
+  {"func.SymGetSymFromAddr64.cc","ms"}, 
+  {"func.GetPointerFramePenInfo.cc","ms"}, 
+  {"func.VarBstrFromI2.cc","ms"}, 
+  {"func.SysAllocString.cc","ms"}, 
+  {"func.ldap_simple_bindA.cc","ms"}, 
+  {"func.RegEnumValueW.cc","ms"}, 
+  {"func.StrTrimW.cc","ms"}, 
+  {"func.GetProfilesDirectoryW.cc","ms"}, 
+  {"func.CM_Query_Resource_Conflict_List.cc","ms"}, 
+  {"func.ChildWindowFromPointEx.cc","ms"}, 
+  {"func.ldap_add.cc","ms"}, 
+  {"func.IsValidLocaleName.cc","ms"}, 
+  {"func.UnregisterPointerInputTargetEx.cc","ms"}, 
+  {"func.FindNextFileW.cc","ms"}, 
+  {"func.SetThreadIdealProcessor.cc","ms"}, 
+  {"func.SetFileSecurityA.cc","ms"}, 
+  {"func.FindFirstVolumeMountPointW.cc","ms"}, 
+  {"func.GetCIMSSM.cc","ms"}, 
+  {"func.StrCmpNIW.cc","ms"}, 
+  {"func.WaitForMultipleObjectsEx.cc","ms"}, 
+  {"func.SHGetPropertyStoreFromIDList.cc","ms"}, 
+  {"func.LoadEnclaveImageA.cc","ms"}, 
+  {"func.SymSrvStoreSupplement.cc","ms"}, 
+  {"func.CryptSIPGetCaps.cc","ms"}, 
+  {"func.BCryptFinishHash.cc","ms"}, 
+  {"func.GetPointerTouchInfo.cc","ms"}, 
+  {"func.SafeArrayGetElement.cc","ms"}, 
+  {"func.CM_Delete_Device_Interface_Key_ExW.cc","ms"}, 
+  {"func.GetTabbedTextExtentW.cc","ms"}, 
+  {"func.CreateDirectoryExW.cc","ms"}, 
+  {"func.StringFromIID.cc","ms"}, 
+  {"func.SetMenuDefaultItem.cc","ms"}, 
+  {"func.VarR8Round.cc","ms"}, 
+  {"func.lstrcpynA.cc","ms"}, 
+  {"func.GetWindowTextLengthA.cc","ms"}, 
+  {"func.PathRemoveArgsA.cc","ms"}, 
+  {"func.RtlRaiseException.cc","ms"}, 
+  {"func.SetAddrInfoExW.cc","ms"}, 
+  {"func.SHRegEnumUSValueA.cc","ms"}, 
+  {"func.AddAtomW.cc","ms"}, 
+  {"func.SetThreadUILanguage.cc","ms"}, 
+  {"func.LocalCompact.cc","ms"}, 
+  {"func.FindWindowW.cc","ms"}, 
+  {"func.DialogBoxIndirectParamW.cc","ms"}, 
+  {"func.PathIsUNCEx.cc","ms"}, 
+  {"func.UrlCreateFromPathA.cc","ms"}, 
+  {"func.ldap_modify_extA.cc","ms"}, 
+  {"func.ldap_get_paged_count.cc","ms"}, 
+  {"func.IsNormalizedString.cc","ms"}, 
+  {"func.CoDisconnectContext.cc","ms"}, 
+  {"func.BCryptQueryContextConfiguration.cc","ms"}, 
+  {"func.AppendMenuW.cc","ms"}, 
+  {"func.WriteProfileSectionA.cc","ms"}, 
+  {"func.GetProcessReference.cc","ms"}, 
+  {"func.ConvertStringSecurityDescriptorToSecurityDescriptorA.cc","ms"}, 
+  {"func.WSCInstallProvider64_32.cc","ms"}, 
+  {"func.GetIconInfo.cc","ms"}, 
+  {"func.VerLanguageNameA.cc","ms"}, 
+  {"func.PathAddExtensionW.cc","ms"}, 
+  {"func.ldap_free_controlsA.cc","ms"}, 
+  {"func.VarDecFromUI4.cc","ms"}, 
+  {"func.FillConsoleOutputCharacterA.cc","ms"}, 
+  {"func.DlgDirListComboBoxA.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_List_SizeW.cc","ms"}, 
+  {"func.getsockopt.cc","ms"}, 
+  {"func.ReOpenFile.cc","ms"}, 
+  {"func.ldap_get_dnA.cc","ms"}, 
+  {"func.OleSavePictureFile.cc","ms"}, 
+  {"func.SetSysColors.cc","ms"}, 
+  {"func.GetUmsCompletionListEvent.cc","ms"}, 
+  {"func.DisableThreadLibraryCalls.cc","ms"}, 
+  {"func.OemToCharBuffW.cc","ms"}, 
+  {"func.lstrcpynW.cc","ms"}, 
+  {"type.HDESK.size","64"}, 
+  {"func.FreeEnvironmentStringsA.cc","ms"}, 
+  {"func.SetConsoleCtrlHandler.cc","ms"}, 
+  {"func.VarDecInt.cc","ms"}, 
+  {"func.SymRegisterCallback64.cc","ms"}, 
+  {"func.SetClipboardViewer.cc","ms"}, 
+  {"func.CertGetStoreProperty.cc","ms"}, 
+  {"func.CM_Get_DevNode_Custom_PropertyW.cc","ms"}, 
+  {"func.CM_Get_HW_Prof_Flags_ExW.cc","ms"}, 
+  {"func.WaitForThreadpoolTimerCallbacks.cc","ms"}, 
+  {"func.IStream_ReadStr.cc","ms"}, 
+  {"func.DragQueryPoint.cc","ms"}, 
+  {"func.ProcessGroupPolicyCompleted.cc","ms"}, 
+  {"func.CryptSIPCreateIndirectData.cc","ms"}, 
+  {"func.CM_Set_DevNode_Problem_Ex.cc","ms"}, 
+  {"func.SystemTimeToFileTime.cc","ms"}, 
+  {"func.RegLoadMUIStringW.cc","ms"}, 
+  {"func.VerLanguageNameW.cc","ms"}, 
+  {"func.AddResourceAttributeAce.cc","ms"}, 
+  {"func.ldap_delete_extA.cc","ms"}, 
+  {"func.getservbyport.cc","ms"}, 
+  {"func.DefWindowProcW.cc","ms"}, 
+  {"func.QISearch.cc","ms"}, 
+  {"func.CertOIDToAlgId.cc","ms"}, 
+  {"func.K32EnumDeviceDrivers.cc","ms"}, 
+  {"func.GetRawPointerDeviceData.cc","ms"}, 
+  {"func.ldap_searchA.cc","ms"}, 
+  {"func.SHCreateShellItemArrayFromDataObject.cc","ms"}, 
+  {"func.MessageBoxA.cc","ms"}, 
+  {"func.GetCommProperties.cc","ms"}, 
+  {"func.WSADuplicateSocketW.cc","ms"}, 
+  {"func.GetTickCount64.cc","ms"}, 
+  {"func.FindFirstChangeNotificationA.cc","ms"}, 
+  {"func.CM_Get_DevNode_Property_Keys.cc","ms"}, 
+  {"func.SymGetSourceFileToken.cc","ms"}, 
+  {"func.CreateIcon.cc","ms"}, 
+  {"func.VarUI2FromR8.cc","ms"}, 
+  {"func.CreateServiceW.cc","ms"}, 
+  {"func.SysAllocStringLen.cc","ms"}, 
+  {"func.ber_printf.cc","ms"}, 
+  {"func.ToUnicode.cc","ms"}, 
+  {"func.SafeArrayGetRecordInfo.cc","ms"}, 
+  {"func.CreateIconIndirect.cc","ms"}, 
+  {"func.SHRegEnumUSKeyA.cc","ms"}, 
+  {"func.CreateAppContainerProfile.cc","ms"}, 
+  {"func.SHSendMessageBroadcastW.cc","ms"}, 
+  {"func.SymNext.cc","ms"}, 
+  {"func.CancelIo.cc","ms"}, 
+  {"func.ldap_sslinitA.cc","ms"}, 
+  {"func.ClipCursor.cc","ms"}, 
+  {"func.GetSystemWow64Directory2W.cc","ms"}, 
+  {"func.PathRenameExtensionW.cc","ms"}, 
+  {"func.IsBadReadPtr.cc","ms"}, 
+  {"func.NCryptEncrypt.cc","ms"}, 
+  {"func.GetUserNameW.cc","ms"}, 
+  {"type.HENHMETAFILE.size","64"}, 
+  {"func.QueryUmsThreadInformation.cc","ms"}, 
+  {"func.GetSystemTime.cc","ms"}, 
+  {"func.BCryptCreateContext.cc","ms"}, 
+  {"func.GetPointerPenInfo.cc","ms"}, 
+  {"func.SetUnhandledExceptionFilter.cc","ms"}, 
+  {"func.StrNCatW.cc","ms"}, 
+  {"func.GetPrivateProfileSectionA.cc","ms"}, 
+  {"func.CreateMDIWindowA.cc","ms"}, 
+  {"func.CommConfigDialogA.cc","ms"}, 
+  {"func.StartServiceCtrlDispatcherW.cc","ms"}, 
+  {"func.K32GetDeviceDriverFileNameA.cc","ms"}, 
+  {"func.ldap_parse_page_controlW.cc","ms"}, 
+  {"func.DecryptFileW.cc","ms"}, 
+  {"func.SubscribeServiceChangeNotifications.cc","ms"}, 
+  {"func.SetProtectedPolicy.cc","ms"}, 
+  {"func.WaitForInputIdle.cc","ms"}, 
+  {"func.GlobalFree.cc","ms"}, 
+  {"func.FillRect.cc","ms"}, 
+  {"func.PathMakeSystemFolderA.cc","ms"}, 
+  {"func.RegDeleteKeyTransactedW.cc","ms"}, 
+  {"func.HeapSize.cc","ms"}, 
+  {"func.SetClassLongA.cc","ms"}, 
+  {"func.CryptSetOIDFunctionValue.cc","ms"}, 
+  {"func.PrivateExtractIconsW.cc","ms"}, 
+  {"func.FindFirstChangeNotificationW.cc","ms"}, 
+  {"func.SetWindowContextHelpId.cc","ms"}, 
+  {"func.ldap_close_extended_op.cc","ms"}, 
+  {"func.DnsHostnameToComputerNameExW.cc","ms"}, 
+  {"func.RtlRestoreContext.cc","ms"}, 
+  {"func.PostQueuedCompletionStatus.cc","ms"}, 
+  {"func.PathRemoveBackslashW.cc","ms"}, 
+  {"func.SHGetNameFromIDList.cc","ms"}, 
+  {"func.GetEnvironmentStrings.cc","ms"}, 
+  {"func.lstrcatA.cc","ms"}, 
+  {"func.OleCreatePictureIndirect.cc","ms"}, 
+  {"func.InitializeCriticalSectionEx.cc","ms"}, 
+  {"func.LogonUserA.cc","ms"}, 
+  {"func.ldap_get_values_len.cc","ms"}, 
+  {"func.ExpandEnvironmentStringsA.cc","ms"}, 
+  {"func.SymFunctionTableAccess.cc","ms"}, 
+  {"func.TlsSetValue.cc","ms"}, 
+  {"func.PowerReadDCValue.cc","ms"}, 
+  {"func.CopyCursor.cc","ms"}, 
+  {"func.OpenThreadToken.cc","ms"}, 
+  {"func.ldap_search.cc","ms"}, 
+  {"func.WSAEnumNameSpaceProvidersW.cc","ms"}, 
+  {"func.SymGetModuleInfoW64.cc","ms"}, 
+  {"func.GetEnabledXStateFeatures.cc","ms"}, 
+  {"func.GetLogicalProcessorInformationEx.cc","ms"}, 
+  {"func.InitCommonControls.cc","ms"}, 
+  {"func.GetClassLongPtrA.cc","ms"}, 
+  {"func.ldap_next_attribute.cc","ms"}, 
+  {"func.SHCreateItemWithParent.cc","ms"}, 
+  {"func.DecryptFileA.cc","ms"}, 
+  {"func.SystemTimeToTzSpecificLocalTimeEx.cc","ms"}, 
+  {"func._lclose.cc","ms"}, 
+  {"func.ToAscii.cc","ms"}, 
+  {"func.SetThreadExecutionState.cc","ms"}, 
+  {"func.VarFormatFromTokens.cc","ms"}, 
+  {"func.ReplaceFileW.cc","ms"}, 
+  {"func.GetOsManufacturingMode.cc","ms"}, 
+  {"func.CryptDuplicateKey.cc","ms"}, 
+  {"func.RaiseCustomSystemEventTrigger.cc","ms"}, 
+  {"func.CoSuspendClassObjects.cc","ms"}, 
+  {"func.DragObject.cc","ms"}, 
+  {"func.ScrollConsoleScreenBufferA.cc","ms"}, 
+  {"func.CreateNamedPipeW.cc","ms"}, 
+  {"func.VarUI2FromDate.cc","ms"}, 
+  {"func.GetPwrCapabilities.cc","ms"}, 
+  {"func.WinHttpFreeProxySettings.cc","ms"}, 
+  {"func.NCryptSetProperty.cc","ms"}, 
+  {"func.SymGetSymbolFileW.cc","ms"}, 
+  {"func.AccessCheckByTypeResultList.cc","ms"}, 
+  {"func.SymGetSourceFileFromToken.cc","ms"}, 
+  {"func.GetSystemDirectoryA.cc","ms"}, 
+  {"func.GetPointerFrameTouchInfo.cc","ms"}, 
+  {"func.ldap_first_reference.cc","ms"}, 
+  {"func.SHUnlockShared.cc","ms"}, 
+  {"func.ldap_modify_s.cc","ms"}, 
+  {"func.GetUnpredictedMessagePos.cc","ms"}, 
+  {"func.CredReadDomainCredentialsW.cc","ms"}, 
+  {"func.RegisterTraceGuidsA.cc","ms"}, 
+  {"func.VarBoolFromDec.cc","ms"}, 
+  {"func.SetXStateFeaturesMask.cc","ms"}, 
+  {"func.ConvertStringSidToSidW.cc","ms"}, 
+  {"func.VarI8FromBool.cc","ms"}, 
+  {"func.GetStringTypeExW.cc","ms"}, 
+  {"func.ExpandEnvironmentStringsW.cc","ms"}, 
+  {"func.CryptSignHashW.cc","ms"}, 
+  {"func.GetWindowDpiAwarenessContext.cc","ms"}, 
+  {"func.StrCpyNW.cc","ms"}, 
+  {"func.CM_Get_DevNode_Status_Ex.cc","ms"}, 
+  {"func.GlobalMemoryStatusEx.cc","ms"}, 
+  {"func.AddDllDirectory.cc","ms"}, 
+  {"func.DrawTextExW.cc","ms"}, 
+  {"func.OpenPrivateNamespaceW.cc","ms"}, 
+  {"func.WSACleanup.cc","ms"}, 
+  {"func.ldap_ufn2dn.cc","ms"}, 
+  {"func.CryptMemRealloc.cc","ms"}, 
+  {"func.GetSystemDefaultLangID.cc","ms"}, 
+  {"func.SetCompressorInformation.cc","ms"}, 
+  {"func.CreateTraceInstanceId.cc","ms"}, 
+  {"func.CertCreateCTLContext.cc","ms"}, 
+  {"func.ScrollDC.cc","ms"}, 
+  {"func.QueryThreadpoolStackInformation.cc","ms"}, 
+  {"func.CM_Enumerate_Classes_Ex.cc","ms"}, 
+  {"func.CryptStringToBinaryW.cc","ms"}, 
+  {"func.CertUnregisterSystemStore.cc","ms"}, 
+  {"func.ReplaceFileA.cc","ms"}, 
+  {"func.PathIsDirectoryW.cc","ms"}, 
+  {"func.SafeArrayCreate.cc","ms"}, 
+  {"func.AreDpiAwarenessContextsEqual.cc","ms"}, 
+  {"func.BackupSeek.cc","ms"}, 
+  {"func.SHGetNewLinkInfoW.cc","ms"}, 
+  {"func.ConvertDefaultLocale.cc","ms"}, 
+  {"func.VarI1FromR4.cc","ms"}, 
+  {"func.CreateProfile.cc","ms"}, 
+  {"func.PathCombineA.cc","ms"}, 
+  {"func.LocalFlags.cc","ms"}, 
+  {"func.ldap_search_s.cc","ms"}, 
+  {"func.ldap_parse_extended_resultA.cc","ms"}, 
+  {"func.IsProcessDPIAware.cc","ms"}, 
+  {"func.CharUpperBuffA.cc","ms"}, 
+  {"func.IsDBCSLeadByteEx.cc","ms"}, 
+  {"func.GetPointerFrameTouchInfoHistory.cc","ms"}, 
+  {"func.CryptSIPGetSignedDataMsg.cc","ms"}, 
+  {"func.GetEffectiveClientRect.cc","ms"}, 
+  {"func.inet_ntoa.cc","ms"}, 
+  {"func.StrFormatByteSize64A.cc","ms"}, 
+  {"func.CreateMemoryResourceNotification.cc","ms"}, 
+  {"func.OpenMutexA.cc","ms"}, 
+  {"func.UrlCompareA.cc","ms"}, 
+  {"func.VariantTimeToDosDateTime.cc","ms"}, 
+  {"func.AppendMenuA.cc","ms"}, 
+  {"func.DispatchMessageW.cc","ms"}, 
+  {"func.PathMatchSpecA.cc","ms"}, 
+  {"func.GetDiskFreeSpaceW.cc","ms"}, 
+  {"func.ObjectOpenAuditAlarmA.cc","ms"}, 
+  {"func.CertGetIntendedKeyUsage.cc","ms"}, 
+  {"func.CryptGetUserKey.cc","ms"}, 
+  {"func.htons.cc","ms"}, 
+  {"func.PathAddExtensionA.cc","ms"}, 
+  {"func.CreateFileTransactedA.cc","ms"}, 
+  {"func.Wow64GetThreadContext.cc","ms"}, 
+  {"func.StrStrIA.cc","ms"}, 
+  {"func.DefineDosDeviceA.cc","ms"}, 
+  {"func.CryptEnumKeyIdentifierProperties.cc","ms"}, 
+  {"func.DlgDirListComboBoxW.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_List_SizeA.cc","ms"}, 
+  {"func.StrFormatByteSizeEx.cc","ms"}, 
+  {"func.GetFullPathNameA.cc","ms"}, 
+  {"func.SystemParametersInfoA.cc","ms"}, 
+  {"func.SetTimer.cc","ms"}, 
+  {"func.RegSetValueA.cc","ms"}, 
+  {"func.GetSystemDpiForProcess.cc","ms"}, 
+  {"func.SHRegWriteUSValueW.cc","ms"}, 
+  {"func.ldap_parse_extended_resultW.cc","ms"}, 
+  {"func.StrChrNW.cc","ms"}, 
+  {"func.GetAncestor.cc","ms"}, 
+  {"func.CreateAcceleratorTableW.cc","ms"}, 
+  {"func.SetVolumeLabelA.cc","ms"}, 
+  {"func.VarI1FromUI4.cc","ms"}, 
+  {"func.DnsHostnameToComputerNameA.cc","ms"}, 
+  {"func.GetQueuedCompletionStatusEx.cc","ms"}, 
+  {"func.SHRegGetValueFromHKCUHKLM.cc","ms"}, 
+  {"func.LoadCursorA.cc","ms"}, 
+  {"func.ldap_create_sort_controlW.cc","ms"}, 
+  {"func.CredUIPromptForWindowsCredentialsA.cc","ms"}, 
+  {"func.CM_Get_Depth.cc","ms"}, 
+  {"func.GetSecurityDescriptorGroup.cc","ms"}, 
+  {"func.K32EmptyWorkingSet.cc","ms"}, 
+  {"func.AcquireSRWLockShared.cc","ms"}, 
+  {"func.DeleteFileA.cc","ms"}, 
+  {"func.SetMenuItemBitmaps.cc","ms"}, 
+  {"func.SymFunctionTableAccess64.cc","ms"}, 
+  {"func.CoCreateGuid.cc","ms"}, 
+  {"func.QueryFullProcessImageNameA.cc","ms"}, 
+  {"func.CredEnumerateA.cc","ms"}, 
+  {"func.ExtractAssociatedIconExW.cc","ms"}, 
+  {"func.LdapUnicodeToUTF8.cc","ms"}, 
+  {"func.CertFreeCertificateContext.cc","ms"}, 
+  {"func.GetNamedPipeClientComputerNameW.cc","ms"}, 
+  {"func.SetFirmwareEnvironmentVariableExW.cc","ms"}, 
+  {"func.GetSystemFileCacheSize.cc","ms"}, 
+  {"func.CryptEncrypt.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_Alias_ExA.cc","ms"}, 
+  {"func.EnumDesktopsA.cc","ms"}, 
+  {"func.FlashWindowEx.cc","ms"}, 
+  {"func.TranslateMDISysAccel.cc","ms"}, 
+  {"func.SetInformationJobObject.cc","ms"}, 
+  {"func.CoMarshalInterThreadInterfaceInStream.cc","ms"}, 
+  {"func.VarBoolFromI2.cc","ms"}, 
+  {"func.ActivateActCtx.cc","ms"}, 
+  {"func.SymSrvGetFileIndexesW.cc","ms"}, 
+  {"func.DragQueryFileA.cc","ms"}, 
+  {"func.IsWow64Process.cc","ms"}, 
+  {"func.WSASocketW.cc","ms"}, 
+  {"func.UnregisterHotKey.cc","ms"}, 
+  {"func.QuerySecurityAccessMask.cc","ms"}, 
+  {"func.ShutdownBlockReasonDestroy.cc","ms"}, 
+  {"func.PathCchSkipRoot.cc","ms"}, 
+  {"func.CredUnPackAuthenticationBufferW.cc","ms"}, 
+  {"func.LockFileEx.cc","ms"}, 
+  {"func.SHRegGetUSValueA.cc","ms"}, 
+  {"func.PathRemoveBlanksW.cc","ms"}, 
+  {"func.GlobalFindAtomA.cc","ms"}, 
+  {"func.IsCharUpperW.cc","ms"}, 
+  {"func.VarBoolFromI1.cc","ms"}, 
+  {"func.CreateWindowStationW.cc","ms"}, 
+  {"func.CredUIPromptForWindowsCredentialsW.cc","ms"}, 
+  {"func.GetWindowDC.cc","ms"}, 
+  {"func.GetParent.cc","ms"}, 
+  {"func.VarI8FromR4.cc","ms"}, 
+  {"func.DequeueUmsCompletionListItems.cc","ms"}, 
+  {"func.GetThreadErrorMode.cc","ms"}, 
+  {"func.CallMsgFilterW.cc","ms"}, 
+  {"func.ShowScrollBar.cc","ms"}, 
+  {"func.LookupIconIdFromDirectory.cc","ms"}, 
+  {"func.EnumResourceTypesW.cc","ms"}, 
+  {"func.FlatSB_GetScrollPos.cc","ms"}, 
+  {"func.WinHttpGetProxyForUrlEx.cc","ms"}, 
+  {"func.GetCurrencyFormatA.cc","ms"}, 
+  {"func.ExtractAssociatedIconExA.cc","ms"}, 
+  {"func.VarBstrCat.cc","ms"}, 
+  {"func.WriteConsoleOutputAttribute.cc","ms"}, 
+  {"func.EnumLanguageGroupLocalesA.cc","ms"}, 
+  {"func.NCryptStreamOpenToProtect.cc","ms"}, 
+  {"func.CreateDataCache.cc","ms"}, 
+  {"func.ldap_openA.cc","ms"}, 
+  {"func.CM_Get_Device_ID_List_ExW.cc","ms"}, 
+  {"func.WPUGetProviderPath.cc","ms"}, 
+  {"func.EnumDisplaySettingsW.cc","ms"}, 
+  {"func.K32GetWsChanges.cc","ms"}, 
+  {"func.OpenServiceW.cc","ms"}, 
+  {"func.CertDeleteCRLFromStore.cc","ms"}, 
+  {"func.CallNtPowerInformation.cc","ms"}, 
+  {"func.GetCurrentThreadId.cc","ms"}, 
+  {"func.SHRegGetPathA.cc","ms"}, 
+  {"func.ldap_get_option.cc","ms"}, 
+  {"func.CreateSemaphoreW.cc","ms"}, 
+  {"func.CryptExportPublicKeyInfoEx.cc","ms"}, 
+  {"func.DragQueryFileW.cc","ms"}, 
+  {"func.SetFileAttributesTransactedW.cc","ms"}, 
+  {"func.WPUPostMessage.cc","ms"}, 
+  {"func.EnumDisplayDevicesA.cc","ms"}, 
+  {"func.ldap_search_ext_s.cc","ms"}, 
+  {"func.DestroyIcon.cc","ms"}, 
+  {"func.RegQueryValueExW.cc","ms"}, 
+  {"func.OpenBackupEventLogA.cc","ms"}, 
+  {"func.SetMailslotInfo.cc","ms"}, 
+  {"func.ConnectToConnectionPoint.cc","ms"}, 
+  {"func.K32GetProcessImageFileNameW.cc","ms"}, 
+  {"func.CryptProtectMemory.cc","ms"}, 
+  {"func.CallWindowProcA.cc","ms"}, 
+  {"func.MessageBeep.cc","ms"}, 
+  {"func.BCryptImportKeyPair.cc","ms"}, 
+  {"func.CreateSymbolicLinkTransactedW.cc","ms"}, 
+  {"func.VarFormatNumber.cc","ms"}, 
+  {"func.SymDeleteSymbol.cc","ms"}, 
+  {"func.GetModuleFileNameA.cc","ms"}, 
+  {"func.SetTokenInformation.cc","ms"}, 
+  {"func.DrawIconEx.cc","ms"}, 
+  {"func.FreeUserPhysicalPages.cc","ms"}, 
+  {"func._lread.cc","ms"}, 
+  {"func.FindVolumeMountPointClose.cc","ms"}, 
+  {"func.NCryptProtectSecret.cc","ms"}, 
+  {"func.RequestWakeupLatency.cc","ms"}, 
+  {"func.GetPhysicallyInstalledSystemMemory.cc","ms"}, 
+  {"func.ldap_search_sW.cc","ms"}, 
+  {"type.HBRUSH.size","64"}, 
+  {"func.AddSIDToBoundaryDescriptor.cc","ms"}, 
+  {"func.CertVerifyCertificateChainPolicy.cc","ms"}, 
+  {"func.GetCalendarInfoEx.cc","ms"}, 
+  {"func.CertVerifyTimeValidity.cc","ms"}, 
+  {"func.CM_Get_Class_Key_Name_ExW.cc","ms"}, 
+  {"func.CertGetCRLFromStore.cc","ms"}, 
+  {"func.CoRegisterMallocSpy.cc","ms"}, 
+  {"func.CLSIDFromProgIDEx.cc","ms"}, 
+  {"func.SetFileApisToANSI.cc","ms"}, 
+  {"func.DrawInsert.cc","ms"}, 
+  {"func.SymAddSourceStreamW.cc","ms"}, 
+  {"func.VerifyVersionInfoW.cc","ms"}, 
+  {"func.GetIconInfoExA.cc","ms"}, 
+  {"func.WinHttpDetectAutoProxyConfigUrl.cc","ms"}, 
+  {"func.BCryptEnumAlgorithms.cc","ms"}, 
+  {"func.NormalizeString.cc","ms"}, 
+  {"func.InflateRect.cc","ms"}, 
+  {"func.GetProcessVersion.cc","ms"}, 
+  {"func.GetVersion.cc","ms"}, 
+  {"func.WSAAsyncGetProtoByName.cc","ms"}, 
+  {"func.GetEnvironmentVariableA.cc","ms"}, 
+  {"func.UnregisterDeviceNotification.cc","ms"}, 
+  {"func.CryptEncryptMessage.cc","ms"}, 
+  {"func.SymFindDebugInfoFileW.cc","ms"}, 
+  {"func.GlobalMemoryStatus.cc","ms"}, 
+  {"func.ldap_modify.cc","ms"}, 
+  {"func.GetScrollInfo.cc","ms"}, 
+  {"func.GetNumaAvailableMemoryNodeEx.cc","ms"}, 
+  {"func.FreeLibrary.cc","ms"}, 
+  {"func.SHRegSetPathW.cc","ms"}, 
+  {"func.SymGetTypeInfo.cc","ms"}, 
+  {"func.SHRegGetValueW.cc","ms"}, 
+  {"func.GetPointerFrameInfo.cc","ms"}, 
+  {"func.SHRegDeleteUSValueW.cc","ms"}, 
+  {"func.IsValidCodePage.cc","ms"}, 
+  {"func.PathSearchAndQualifyW.cc","ms"}, 
+  {"func.VarDecFromCy.cc","ms"}, 
+  {"func.GetCurrencyFormatEx.cc","ms"}, 
+  {"func.GetPointerTouchInfoHistory.cc","ms"}, 
+  {"func.SetClassWord.cc","ms"}, 
+  {"func.SHStrDupA.cc","ms"}, 
+  {"func.SetMenuContextHelpId.cc","ms"}, 
+  {"func.CM_Set_HW_Prof_FlagsW.cc","ms"}, 
+  {"func.PowerUnregisterSuspendResumeNotification.cc","ms"}, 
+  {"func.VarCyFromDate.cc","ms"}, 
+  {"func.VarNot.cc","ms"}, 
+  {"func.CryptSIPPutSignedDataMsg.cc","ms"}, 
+  {"func.MiniDumpReadDumpStream.cc","ms"}, 
+  {"func.RegisterTypeLib.cc","ms"}, 
+  {"func.IsClipboardFormatAvailable.cc","ms"}, 
+  {"func.GetFileTime.cc","ms"}, 
+  {"func.CM_Get_Device_ID_ListW.cc","ms"}, 
+  {"func.ldap_create_page_controlW.cc","ms"}, 
+  {"func.VerifyVersionInfoA.cc","ms"}, 
+  {"func.TransmitCommChar.cc","ms"}, 
+  {"func.PathIsNetworkPathA.cc","ms"}, 
+  {"func.CoWaitForMultipleHandles.cc","ms"}, 
+  {"func.ClientToScreen.cc","ms"}, 
+  {"func.ldap_delete_ext_sA.cc","ms"}, 
+  {"func.RegConnectRegistryExA.cc","ms"}, 
+  {"func.CoTaskMemAlloc.cc","ms"}, 
+  {"func.GetProcessWindowStation.cc","ms"}, 
+  {"func.WSASetSocketSecurity.cc","ms"}, 
+  {"func.WinHttpWebSocketCompleteUpgrade.cc","ms"}, 
+  {"func.MapViewOfFile.cc","ms"}, 
+  {"func.VarR4FromI4.cc","ms"}, 
+  {"func.SHCreateShellItemArrayFromIDLists.cc","ms"}, 
+  {"func.wnsprintfW.cc","ms"}, 
+  {"func.SetClassLongPtrA.cc","ms"}, 
+  {"func.GetLastInputInfo.cc","ms"}, 
+  {"func.SetLayeredWindowAttributes.cc","ms"}, 
+  {"func.AccessCheckAndAuditAlarmW.cc","ms"}, 
+  {"func.SendMessageW.cc","ms"}, 
+  {"func.VarNumFromParseNum.cc","ms"}, 
+  {"func.IsWindowVisible.cc","ms"}, 
+  {"func.CharNextW.cc","ms"}, 
+  {"func.IsCharLowerW.cc","ms"}, 
+  {"func.ModifyMenuW.cc","ms"}, 
+  {"func.CoDosDateTimeToFileTime.cc","ms"}, 
+  {"func.ldap_create_vlv_controlA.cc","ms"}, 
+  {"func.VarI1FromBool.cc","ms"}, 
+  {"func.SafeArrayAllocDescriptor.cc","ms"}, 
+  {"func.GetSecurityDescriptorLength.cc","ms"}, 
+  {"func.CreateBoundaryDescriptorA.cc","ms"}, 
+  {"func.GetDlgItemTextW.cc","ms"}, 
+  {"func.CloseThreadpoolWork.cc","ms"}, 
+  {"func.MenuHelp.cc","ms"}, 
+  {"func.SHCreateShellItemArrayFromShellItem.cc","ms"}, 
+  {"func.FlsAlloc.cc","ms"}, 
+  {"func.CreatePrivateObjectSecurityWithMultipleInheritance.cc","ms"}, 
+  {"func.ldap_bind_sA.cc","ms"}, 
+  {"func.QueryPathOfRegTypeLib.cc","ms"}, 
+  {"func.RefreshPolicy.cc","ms"}, 
+  {"func.ldap_add_ext_sW.cc","ms"}, 
+  {"func.GetSecurityDescriptorControl.cc","ms"}, 
+  {"func.SetUserGeoName.cc","ms"}, 
+  {"func.SetThreadLocale.cc","ms"}, 
+  {"func.WaitForSingleObjectEx.cc","ms"}, 
+  {"func.VarR4FromDec.cc","ms"}, 
+  {"func.SetThreadPriority.cc","ms"}, 
+  {"func.OpenWindowStationW.cc","ms"}, 
+  {"func.SymGetLineFromAddrW64.cc","ms"}, 
+  {"func.RoGetAgileReference.cc","ms"}, 
+  {"func.SetFirmwareEnvironmentVariableExA.cc","ms"}, 
+  {"func.GetEventLogInformation.cc","ms"}, 
+  {"type.HCONV.size","64"}, 
+  {"func.QueryWorkingSet.cc","ms"}, 
+  {"func.GetPointerCursorId.cc","ms"}, 
+  {"func.LookupPrivilegeDisplayNameW.cc","ms"}, 
+  {"func.DispGetParam.cc","ms"}, 
+  {"func.CoGetInterfaceAndReleaseStream.cc","ms"}, 
+  {"func.GetPointerFramePenInfoHistory.cc","ms"}, 
+  {"func.SystemTimeToVariantTime.cc","ms"}, 
+  {"func.CM_Free_Range_List.cc","ms"}, 
+  {"func.GetClipboardFormatNameA.cc","ms"}, 
+  {"func.LogicalToPhysicalPoint.cc","ms"}, 
+  {"func.VarFormatCurrency.cc","ms"}, 
+  {"func.VarI2FromI4.cc","ms"}, 
+  {"func.SHInvokePrinterCommandA.cc","ms"}, 
+  {"func.CallEnclave.cc","ms"}, 
+  {"func.StrChrIA.cc","ms"}, 
+  {"func.GetThreadLocale.cc","ms"}, 
+  {"func.SHCreateProcessAsUserW.cc","ms"}, 
+  {"func.VarMonthName.cc","ms"}, 
+  {"func.CryptSignMessageWithKey.cc","ms"}, 
+  {"func.VarDecAdd.cc","ms"}, 
+  {"func.GetClientRect.cc","ms"}, 
+  {"func.ModifyMenuA.cc","ms"}, 
+  {"func.TryEnterCriticalSection.cc","ms"}, 
+  {"func.GetTouchInputInfo.cc","ms"}, 
+  {"type.HWINSTA.size","64"}, 
+  {"func.FindAtomA.cc","ms"}, 
+  {"func.PeekNamedPipe.cc","ms"}, 
+  {"func.CM_Open_Device_Interface_Key_ExA.cc","ms"}, 
+  {"func.CM_Reenumerate_DevNode_Ex.cc","ms"}, 
+  {"func.GetPerformanceInfo.cc","ms"}, 
+  {"func.VarI2FromUI2.cc","ms"}, 
+  {"func.GetNamedPipeClientSessionId.cc","ms"}, 
+  {"func.StrCpyW.cc","ms"}, 
+  {"func.CM_Get_DevNode_Custom_Property_ExW.cc","ms"}, 
+  {"func.SHGetDiskFreeSpaceExW.cc","ms"}, 
+  {"func.CredUnprotectW.cc","ms"}, 
+  {"func.ldap_check_filterA.cc","ms"}, 
+  {"func.EnumProcessModulesEx.cc","ms"}, 
+  {"func.CopyContext.cc","ms"}, 
+  {"func.GetTimeZoneInformation.cc","ms"}, 
+  {"func.CredDeleteW.cc","ms"}, 
+  {"func.WinHttpSetTimeouts.cc","ms"}, 
+  {"func.FlatSB_EnableScrollBar.cc","ms"}, 
+  {"func.CoQueryAuthenticationServices.cc","ms"}, 
+  {"func.OpenWindowStationA.cc","ms"}, 
+  {"func.CertFindExtension.cc","ms"}, 
+  {"func.GetSystemInfo.cc","ms"}, 
+  {"func.GetCapture.cc","ms"}, 
+  {"func.WSAConnectByNameA.cc","ms"}, 
+  {"func.ldap_first_attributeA.cc","ms"}, 
+  {"func.CryptHashSessionKey.cc","ms"}, 
+  {"func.SymFromIndexW.cc","ms"}, 
+  {"func.GetMenuBarInfo.cc","ms"}, 
+  {"func.GetNativeSystemInfo.cc","ms"}, 
+  {"func.SymGetLineNext64.cc","ms"}, 
+  {"func.SymEnumSymbolsExW.cc","ms"}, 
+  {"func.SetConsoleActiveScreenBuffer.cc","ms"}, 
+  {"func.CreateMutexExA.cc","ms"}, 
+  {"func.AssocCreate.cc","ms"}, 
+  {"func.VarDecCmpR8.cc","ms"}, 
+  {"func.CM_Is_Dock_Station_Present_Ex.cc","ms"}, 
+  {"func.EnumDisplayDevicesW.cc","ms"}, 
+  {"func.GetWindowContextHelpId.cc","ms"}, 
+  {"func.EnumDesktopWindows.cc","ms"}, 
+  {"func.VarI1FromI4.cc","ms"}, 
+  {"func.VarDecMul.cc","ms"}, 
+  {"func.WSAGetLastError.cc","ms"}, 
+  {"func.CoMarshalHresult.cc","ms"}, 
+  {"func.VarDecFromUI2.cc","ms"}, 
+  {"func.CreateDecompressor.cc","ms"}, 
+  {"func.QueryIdleProcessorCycleTimeEx.cc","ms"}, 
+  {"func.NCryptStreamOpenToUnprotect.cc","ms"}, 
+  {"func.BCryptDuplicateHash.cc","ms"}, 
+  {"func.NeedCurrentDirectoryForExePathA.cc","ms"}, 
+  {"func.TraceMessage.cc","ms"}, 
+  {"func.CreatePointerMoniker.cc","ms"}, 
+  {"func.SHRegGetBoolUSValueW.cc","ms"}, 
+  {"func.ReleaseActCtx.cc","ms"}, 
+  {"func.ReadConsoleOutputAttribute.cc","ms"}, 
+  {"func.K32GetModuleBaseNameW.cc","ms"}, 
+  {"func.VarDateFromUI2.cc","ms"}, 
+  {"func.FindActCtxSectionGuid.cc","ms"}, 
+  {"func.CoGetSystemSecurityPermissions.cc","ms"}, 
+  {"func.GetProcessWorkingSetSizeEx.cc","ms"}, 
+  {"func.GetTimeFormatW.cc","ms"}, 
+  {"func.ldap_modrdn_s.cc","ms"}, 
+  {"func.IsCharAlphaNumericW.cc","ms"}, 
+  {"func.SymSrvStoreFileW.cc","ms"}, 
+  {"func.VarCyFromR8.cc","ms"}, 
+  {"func.PathRelativePathToA.cc","ms"}, 
+  {"func.SetLocaleInfoA.cc","ms"}, 
+  {"func.ldap_simple_bindW.cc","ms"}, 
+  {"func.MapUserPhysicalPages.cc","ms"}, 
+  {"func.VarDecNeg.cc","ms"}, 
+  {"func.EnumResourceNamesW.cc","ms"}, 
+  {"func.WPUModifyIFSHandle.cc","ms"}, 
+  {"func.DragAcceptFiles.cc","ms"}, 
+  {"func.ReleaseSemaphoreWhenCallbackReturns.cc","ms"}, 
+  {"func.CertAddCTLLinkToStore.cc","ms"}, 
+  {"func.OleLoadPictureEx.cc","ms"}, 
+  {"func.VarR4FromR8.cc","ms"}, 
+  {"func.GetClassInfoW.cc","ms"}, 
+  {"func.AllocateLocallyUniqueId.cc","ms"}, 
+  {"func.VarUI4FromI8.cc","ms"}, 
+  {"func.WSCDeinstallProvider.cc","ms"}, 
+  {"func.CoIsHandlerConnected.cc","ms"}, 
+  {"func.WSANtohl.cc","ms"}, 
+  {"func.SetScrollInfo.cc","ms"}, 
+  {"func.FindClose.cc","ms"}, 
+  {"func.ImageList_BeginDrag.cc","ms"}, 
+  {"func.RegEnumKeyA.cc","ms"}, 
+  {"func.HeapReAlloc.cc","ms"}, 
+  {"func.PathRemoveFileSpecA.cc","ms"}, 
+  {"func.UpdateTraceW.cc","ms"}, 
+  {"func.CredGetTargetInfoA.cc","ms"}, 
+  {"func.SymGetSourceVarFromTokenW.cc","ms"}, 
+  {"func.CredUnmarshalCredentialW.cc","ms"}, 
+  {"func.RegisterClipboardFormatW.cc","ms"}, 
+  {"func.AdjustTokenPrivileges.cc","ms"}, 
+  {"func.IsValidAcl.cc","ms"}, 
+  {"func.VarMul.cc","ms"}, 
+  {"func.RegDeleteKeyA.cc","ms"}, 
+  {"func.LoadIconWithScaleDown.cc","ms"}, 
+  {"func.EnumPropsExA.cc","ms"}, 
+  {"func.GetMailslotInfo.cc","ms"}, 
+  {"func.FindWindowA.cc","ms"}, 
+  {"func.WinHttpConnect.cc","ms"}, 
+  {"func.CryptVerifyCertificateSignatureEx.cc","ms"}, 
+  {"func.FlatSB_SetScrollProp.cc","ms"}, 
+  {"func.CM_Set_DevNode_Registry_Property_ExW.cc","ms"}, 
+  {"func.K32EnumProcesses.cc","ms"}, 
+  {"func.LockWindowUpdate.cc","ms"}, 
+  {"func.ChangeTimerQueueTimer.cc","ms"}, 
+  {"func.SetMessageWaitingIndicator.cc","ms"}, 
+  {"func.CryptSignAndEncryptMessage.cc","ms"}, 
+  {"func.PrivilegeCheck.cc","ms"}, 
+  {"func.VarCyNeg.cc","ms"}, 
+  {"func.GetLongPathNameW.cc","ms"}, 
+  {"func.GetUserObjectSecurity.cc","ms"}, 
+  {"func.SuspendThread.cc","ms"}, 
+  {"func.GetNamedPipeServerSessionId.cc","ms"}, 
+  {"func.SetSymLoadError.cc","ms"}, 
+  {"func.CM_Delete_DevNode_Key.cc","ms"}, 
+  {"func.PeekMessageA.cc","ms"}, 
+  {"func.VarNeg.cc","ms"}, 
+  {"type.HDDEDATA.size","64"}, 
+  {"func.FileEncryptionStatusA.cc","ms"}, 
+  {"func.FillConsoleOutputCharacterW.cc","ms"}, 
+  {"func.ChildWindowFromPoint.cc","ms"}, 
+  {"func.VarCyFromI8.cc","ms"}, 
+  {"func.CreateSemaphoreExW.cc","ms"}, 
+  {"func.ConvertSecurityDescriptorToStringSecurityDescriptorW.cc","ms"}, 
+  {"func.StrToIntW.cc","ms"}, 
+  {"func.HeapCreate.cc","ms"}, 
+  {"func.SymSetSearchPathW.cc","ms"}, 
+  {"func.FindFirstFileNameTransactedW.cc","ms"}, 
+  {"func.GetSymLoadError.cc","ms"}, 
+  {"func.AddAccessAllowedAce.cc","ms"}, 
+  {"func.CryptUnregisterOIDInfo.cc","ms"}, 
+  {"func.RegEnumKeyW.cc","ms"}, 
+  {"func.CoIsOle1Class.cc","ms"}, 
+  {"func.SetThreadpoolThreadMinimum.cc","ms"}, 
+  {"func.SymSrvGetFileIndexInfoW.cc","ms"}, 
+  {"func.RsopResetPolicySettingStatus.cc","ms"}, 
+  {"func.CopyFileTransactedW.cc","ms"}, 
+  {"func.FlushProcessWriteBuffers.cc","ms"}, 
+  {"func.ldap_next_entry.cc","ms"}, 
+  {"func.PathIsLFNFileSpecA.cc","ms"}, 
+  {"func.LHashValOfNameSysA.cc","ms"}, 
+  {"func.VarR8FromDisp.cc","ms"}, 
+  {"func.ReadEventLogA.cc","ms"}, 
+  {"func.SetFileShortNameA.cc","ms"}, 
+  {"func.EnumCalendarInfoA.cc","ms"}, 
+  {"func.IUnknown_GetWindow.cc","ms"}, 
+  {"func.SetForegroundWindow.cc","ms"}, 
+  {"func.CM_Set_DevNode_Registry_Property_ExA.cc","ms"}, 
+  {"func.StgGetIFillLockBytesOnFile.cc","ms"}, 
+  {"func.CryptExportPublicKeyInfo.cc","ms"}, 
+  {"func.GetActiveProcessorGroupCount.cc","ms"}, 
+  {"func.EnableMouseInPointer.cc","ms"}, 
+  {"func.htonll.cc","ms"}, 
+  {"func.LoadModule.cc","ms"}, 
+  {"func.DeleteAce.cc","ms"}, 
+  {"func.FindExecutableImageEx.cc","ms"}, 
+  {"func.ldap_extended_operation_sA.cc","ms"}, 
+  {"func.BroadcastSystemMessageW.cc","ms"}, 
+  {"func.GetLogicalDrives.cc","ms"}, 
+  {"type.HWND.size","64"}, 
+  {"func.IUnknown_SetSite.cc","ms"}, 
+  {"func.EnumDateFormatsA.cc","ms"}, 
+  {"func.EventUnregister.cc","ms"}, 
+  {"func.DllInstall.cc","ms"}, 
+  {"func.PathCchCombineEx.cc","ms"}, 
+  {"func.NCryptEnumStorageProviders.cc","ms"}, 
+  {"func.SetMessageExtraInfo.cc","ms"}, 
+  {"func.ldap_parse_resultW.cc","ms"}, 
+  {"func.SHSetLocalizedName.cc","ms"}, 
+  {"func.GetConsoleCursorInfo.cc","ms"}, 
+  {"func.MapViewOfFile3FromApp.cc","ms"}, 
+  {"func.FileEncryptionStatusW.cc","ms"}, 
+  {"func.UnlockFile.cc","ms"}, 
+  {"func.StrChrW.cc","ms"}, 
+  {"func.StartThreadpoolIo.cc","ms"}, 
+  {"func.CertFindCTLInStore.cc","ms"}, 
+  {"func.CreateSemaphoreExA.cc","ms"}, 
+  {"func.wnsprintfA.cc","ms"}, 
+  {"func.RtlDeleteFunctionTable.cc","ms"}, 
+  {"func.SetDllDirectoryW.cc","ms"}, 
+  {"func.LookupAccountSidLocalA.cc","ms"}, 
+  {"func.ldap_modrdnA.cc","ms"}, 
+  {"func.CryptUninstallCancelRetrieval.cc","ms"}, 
+  {"func.FindFirstVolumeW.cc","ms"}, 
+  {"func.Wow64GetThreadSelectorEntry.cc","ms"}, 
+  {"func.SHAutoComplete.cc","ms"}, 
+  {"func.FreeAddrInfoEx.cc","ms"}, 
+  {"func.SetDlgItemTextA.cc","ms"}, 
+  {"func.OpenFileById.cc","ms"}, 
+  {"func.CoRevokeMallocSpy.cc","ms"}, 
+  {"func.VarUI1FromI4.cc","ms"}, 
+  {"func.EventActivityIdControl.cc","ms"}, 
+  {"func.VarI4FromDate.cc","ms"}, 
+  {"func.AddIntegrityLabelToBoundaryDescriptor.cc","ms"}, 
+  {"func.RegisterTypeLibForUser.cc","ms"}, 
+  {"func.SetThreadPreferredUILanguages.cc","ms"}, 
+  {"func.CoUninitialize.cc","ms"}, 
+  {"func.GetShellWindow.cc","ms"}, 
+  {"func.GetThreadDescription.cc","ms"}, 
+  {"func.CreateProcessW.cc","ms"}, 
+  {"func.VarInt.cc","ms"}, 
+  {"func.CryptDecrypt.cc","ms"}, 
+  {"func.RemoveDirectoryTransactedA.cc","ms"}, 
+  {"func.GetUserNameA.cc","ms"}, 
+  {"func.RegCreateKeyExA.cc","ms"}, 
+  {"func.ReleaseMutexWhenCallbackReturns.cc","ms"}, 
+  {"func.SetRect.cc","ms"}, 
+  {"func.ldap_compareA.cc","ms"}, 
+  {"func.CreateEventW.cc","ms"}, 
+  {"func.ldap_bind_sW.cc","ms"}, 
+  {"func.UrlHashA.cc","ms"}, 
+  {"func.SymLoadModule64.cc","ms"}, 
+  {"func.PathGetCharTypeA.cc","ms"}, 
+  {"func.ldap_add_ext_sA.cc","ms"}, 
+  {"func.GetProcessDEPPolicy.cc","ms"}, 
+  {"func.CertVerifyCTLUsage.cc","ms"}, 
+  {"func.AddRefActCtx.cc","ms"}, 
+  {"func.CryptSIPVerifyIndirectData.cc","ms"}, 
+  {"func.GetRawInputData.cc","ms"}, 
+  {"func.GetCurrentThread.cc","ms"}, 
+  {"func.SwitchToThisWindow.cc","ms"}, 
+  {"func.GetDllDirectoryW.cc","ms"}, 
+  {"func.FindExecutableImageExW.cc","ms"}, 
+  {"func.CM_Register_Device_InterfaceW.cc","ms"}, 
+  {"func.SwitchToThread.cc","ms"}, 
+  {"func.RtlUnwindEx.cc","ms"}, 
+  {"func.RegDisablePredefinedCacheEx.cc","ms"}, 
+  {"func.SetupComm.cc","ms"}, 
+  {"func.SHInvokePrinterCommandW.cc","ms"}, 
+  {"func.CryptInstallCancelRetrieval.cc","ms"}, 
+  {"func.TerminateEnclave.cc","ms"}, 
+  {"func.GetSystemDefaultLCID.cc","ms"}, 
+  {"func.FlsFree.cc","ms"}, 
+  {"func.WinHttpGetProxyResult.cc","ms"}, 
+  {"func.ldap_unbind.cc","ms"}, 
+  {"func.CryptSetProviderA.cc","ms"}, 
+  {"func.WTSGetServiceSessionId.cc","ms"}, 
+  {"func.GetKeyboardLayoutNameW.cc","ms"}, 
+  {"func.CreateFileA.cc","ms"}, 
+  {"func.GetCurrentProcessorNumber.cc","ms"}, 
+  {"func.StrCatW.cc","ms"}, 
+  {"func.ShowCaret.cc","ms"}, 
+  {"func.CredFindBestCredentialA.cc","ms"}, 
+  {"func.CLSIDFromString.cc","ms"}, 
+  {"func.QueryTraceW.cc","ms"}, 
+  {"func.WinHttpCheckPlatform.cc","ms"}, 
+  {"func.BroadcastSystemMessageExW.cc","ms"}, 
+  {"func.RegSetKeySecurity.cc","ms"}, 
+  {"func.DrawStatusTextW.cc","ms"}, 
+  {"func.SetThreadpoolStackInformation.cc","ms"}, 
+  {"func.VarUI2FromDec.cc","ms"}, 
+  {"func.GetWindowLongPtrA.cc","ms"}, 
+  {"func.CertSelectCertificateChains.cc","ms"}, 
+  {"func.VarRound.cc","ms"}, 
+  {"func._lwrite.cc","ms"}, 
+  {"func.WSAAsyncGetHostByName.cc","ms"}, 
+  {"func.SHGetDiskFreeSpaceExA.cc","ms"}, 
+  {"func.CharLowerBuffW.cc","ms"}, 
+  {"func.CryptHashPublicKeyInfo.cc","ms"}, 
+  {"func.GetClassLongA.cc","ms"}, 
+  {"func.ImpersonateAnonymousToken.cc","ms"}, 
+  {"func.GetUpdateRgn.cc","ms"}, 
+  {"func.InitCommonControlsEx.cc","ms"}, 
+  {"func.SHRegDeleteEmptyUSKeyA.cc","ms"}, 
+  {"func.CryptRegisterOIDInfo.cc","ms"}, 
+  {"func.SetThreadContext.cc","ms"}, 
+  {"func.UpdateWindow.cc","ms"}, 
+  {"func.UserHandleGrantAccess.cc","ms"}, 
+  {"func.GetProcessHandleCount.cc","ms"}, 
+  {"func.CertIsRDNAttrsInCertificateName.cc","ms"}, 
+  {"func.StrDupA.cc","ms"}, 
+  {"func.CredMarshalCredentialA.cc","ms"}, 
+  {"func.ReplacePartitionUnit.cc","ms"}, 
+  {"func.ChrCmpIA.cc","ms"}, 
+  {"func.DrawTextA.cc","ms"}, 
+  {"func.GetMenuStringA.cc","ms"}, 
+  {"type.HLOCAL.size","64"}, 
+  {"func.EndUpdateResourceA.cc","ms"}, 
+  {"func.QueryTraceA.cc","ms"}, 
+  {"func.LookupPrivilegeValueA.cc","ms"}, 
+  {"func.StrCmpNW.cc","ms"}, 
+  {"func.SetCommBreak.cc","ms"}, 
+  {"func.InsertMenuItemW.cc","ms"}, 
+  {"func.GlobalAlloc.cc","ms"}, 
+  {"func.K32GetModuleBaseNameA.cc","ms"}, 
+  {"func.SetConsoleMode.cc","ms"}, 
+  {"func.OpenCommPort.cc","ms"}, 
+  {"func.PathSetDlgItemPathW.cc","ms"}, 
+  {"func.LocalShrink.cc","ms"}, 
+  {"func.VarAnd.cc","ms"}, 
+  {"func.IsCharAlphaNumericA.cc","ms"}, 
+  {"func.SymEnumTypesByNameW.cc","ms"}, 
+  {"func.DrawTextExA.cc","ms"}, 
+  {"func.StrSpnW.cc","ms"}, 
+  {"func.IUnknown_QueryService.cc","ms"}, 
+  {"func.GetFirmwareEnvironmentVariableW.cc","ms"}, 
+  {"func.ldap_parse_sort_controlW.cc","ms"}, 
+  {"func.ExitThread.cc","ms"}, 
+  {"func.CharToOemW.cc","ms"}, 
+  {"func.GetTraceLoggerHandle.cc","ms"}, 
+  {"func.AssocQueryStringByKeyW.cc","ms"}, 
+  {"func.PathMakePrettyA.cc","ms"}, 
+  {"func.CreateToolbarEx.cc","ms"}, 
+  {"func.select.cc","ms"}, 
+  {"func.StrDupW.cc","ms"}, 
+  {"func.SymSrvDeltaNameW.cc","ms"}, 
+  {"func.CM_Enumerate_Enumerators_ExW.cc","ms"}, 
+  {"func.VarBstrFromR8.cc","ms"}, 
+  {"func.IUnknown_Set.cc","ms"}, 
+  {"func.WSAEnumProtocolsW.cc","ms"}, 
+  {"func.GetUserObjectInformationA.cc","ms"}, 
+  {"func.DrawTextW.cc","ms"}, 
+  {"func.RegisterWindowMessageA.cc","ms"}, 
+  {"func.PurgeComm.cc","ms"}, 
+  {"func.EndUpdateResourceW.cc","ms"}, 
+  {"func.GetClassNameW.cc","ms"}, 
+  {"func.GetTempFileNameW.cc","ms"}, 
+  {"func.GetWindowRgn.cc","ms"}, 
+  {"func.CryptEnumProvidersW.cc","ms"}, 
+  {"func.PathQuoteSpacesW.cc","ms"}, 
+  {"func.OpenJobObjectW.cc","ms"}, 
+  {"func.IsImmersiveProcess.cc","ms"}, 
+  {"func.cldap_open.cc","ms"}, 
+  {"func.GetAwarenessFromDpiAwarenessContext.cc","ms"}, 
+  {"func.PathCchRemoveBackslashEx.cc","ms"}, 
+  {"func.CreateFileMappingW.cc","ms"}, 
+  {"func.AttachThreadInput.cc","ms"}, 
+  {"func.FindCloseChangeNotification.cc","ms"}, 
+  {"func.DrawStateW.cc","ms"}, 
+  {"func.WriteFile.cc","ms"}, 
+  {"func.StrCSpnA.cc","ms"}, 
+  {"func.RegEnumValueA.cc","ms"}, 
+  {"func.RegisterTouchHitTestingWindow.cc","ms"}, 
+  {"func.TlsAlloc.cc","ms"}, 
+  {"func.CM_Get_Hardware_Profile_InfoW.cc","ms"}, 
+  {"func.CM_Set_DevNode_Registry_PropertyW.cc","ms"}, 
+  {"func.SHSetTemporaryPropertyForItem.cc","ms"}, 
+  {"func.WinHttpQueryAuthParams.cc","ms"}, 
+  {"func.VarDateFromDisp.cc","ms"}, 
+  {"func.CoQueryClientBlanket.cc","ms"}, 
+  {"func.RequestDeviceWakeup.cc","ms"}, 
+  {"func.CM_Add_IDW.cc","ms"}, 
+  {"func.CM_Get_Device_ID_ExW.cc","ms"}, 
+  {"func.SetWindowLongPtrW.cc","ms"}, 
+  {"func.AssocQueryKeyA.cc","ms"}, 
+  {"func.SHAnsiToAnsi.cc","ms"}, 
+  {"func.LoadEnclaveImageW.cc","ms"}, 
+  {"func.GetDisplayAutoRotationPreferencesByProcessId.cc","ms"}, 
+  {"func.SafeArrayDestroyData.cc","ms"}, 
+  {"func.GetThreadIdealProcessorEx.cc","ms"}, 
+  {"func.StrToIntA.cc","ms"}, 
+  {"func.DeleteMenu.cc","ms"}, 
+  {"func.CryptImportPublicKeyInfoEx2.cc","ms"}, 
+  {"func.CoFreeUnusedLibrariesEx.cc","ms"}, 
+  {"func.CveEventWrite.cc","ms"}, 
+  {"func.SHQueryInfoKeyW.cc","ms"}, 
+  {"func.GetTabbedTextExtentA.cc","ms"}, 
+  {"func.GetPrivateProfileSectionNamesW.cc","ms"}, 
+  {"func.StrCmpNICW.cc","ms"}, 
+  {"func.GetDpiForShellUIComponent.cc","ms"}, 
+  {"func.ldap_encode_sort_control.cc","ms"}, 
+  {"func.SymAddrIncludeInlineTrace.cc","ms"}, 
+  {"func.BCryptRegisterConfigChangeNotify.cc","ms"}, 
+  {"func.GlobalGetAtomNameA.cc","ms"}, 
+  {"func.CoInvalidateRemoteMachineBindings.cc","ms"}, 
+  {"func.SymUnloadModule64.cc","ms"}, 
+  {"func.RegCopyTreeA.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_Property_ExW.cc","ms"}, 
+  {"func.VarCyFromUI4.cc","ms"}, 
+  {"func.ldap_parse_vlv_controlA.cc","ms"}, 
+  {"func.CreateIconFromResourceEx.cc","ms"}, 
+  {"func.BCryptDecrypt.cc","ms"}, 
+  {"func.GetWindowRgnBox.cc","ms"}, 
+  {"func.WritePrivateProfileStringW.cc","ms"}, 
+  {"func.SetMenu.cc","ms"}, 
+  {"func.CertSetStoreProperty.cc","ms"}, 
+  {"func.GetDCEx.cc","ms"}, 
+  {"func.CM_Move_DevNode.cc","ms"}, 
+  {"func.WriteProfileSectionW.cc","ms"}, 
+  {"func.DeleteFileW.cc","ms"}, 
+  {"func.CharToOemBuffA.cc","ms"}, 
+  {"func.PowerWriteDCValueIndex.cc","ms"}, 
+  {"func.GetAppliedGPOListW.cc","ms"}, 
+  {"func.CM_Open_Class_KeyA.cc","ms"}, 
+  {"func.CM_Get_Hardware_Profile_InfoA.cc","ms"}, 
+  {"func.GetExitCodeThread.cc","ms"}, 
+  {"func.CertCreateSelfSignCertificate.cc","ms"}, 
+  {"func.CoRegisterMessageFilter.cc","ms"}, 
+  {"func.SafeArrayPtrOfIndex.cc","ms"}, 
+  {"func.ZombifyActCtx.cc","ms"}, 
+  {"func.GetDriveTypeA.cc","ms"}, 
+  {"func.CM_Add_IDA.cc","ms"}, 
+  {"func.GetProfileType.cc","ms"}, 
+  {"func.CascadeWindows.cc","ms"}, 
+  {"func.ldap_bindA.cc","ms"}, 
+  {"func.SHRegSetValue.cc","ms"}, 
+  {"func.GetFileSizeEx.cc","ms"}, 
+  {"func.SHRegGetIntW.cc","ms"}, 
+  {"func.GetSystemWow64DirectoryA.cc","ms"}, 
+  {"func.CM_Get_Device_IDW.cc","ms"}, 
+  {"func.ber_bvfree.cc","ms"}, 
+  {"func.CreateProcessAsUserA.cc","ms"}, 
+  {"func.GetStringTypeA.cc","ms"}, 
+  {"func.BCryptSignHash.cc","ms"}, 
+  {"func.FindFirstFileA.cc","ms"}, 
+  {"func.ldap_err2stringW.cc","ms"}, 
+  {"func.GetDynamicTimeZoneInformationEffectiveYears.cc","ms"}, 
+  {"func.CountClipboardFormats.cc","ms"}, 
+  {"func.WSASocketA.cc","ms"}, 
+  {"func.ImpersonateLoggedOnUser.cc","ms"}, 
+  {"func.ldap_parse_referenceA.cc","ms"}, 
+  {"func.CreateMutexW.cc","ms"}, 
+  {"func.SetFocus.cc","ms"}, 
+  {"func.IsCharUpperA.cc","ms"}, 
+  {"func.EnumWindowStationsA.cc","ms"}, 
+  {"func.RemoveDirectoryTransactedW.cc","ms"}, 
+  {"func.SafeArrayGetUBound.cc","ms"}, 
+  {"func.BCryptExportKey.cc","ms"}, 
+  {"func.GetErrorInfo.cc","ms"}, 
+  {"func.CM_Open_Class_KeyW.cc","ms"}, 
+  {"func.WinHttpQueryOption.cc","ms"}, 
+  {"func.GetRawInputDeviceInfoA.cc","ms"}, 
+  {"func.AssocQueryStringW.cc","ms"}, 
+  {"func.ldap_value_free_len.cc","ms"}, 
+  {"func.MoveFileWithProgressW.cc","ms"}, 
+  {"func.ImageList_DragEnter.cc","ms"}, 
+  {"func.BCryptOpenAlgorithmProvider.cc","ms"}, 
+  {"func.LoadTypeLib.cc","ms"}, 
+  {"func.VarR4FromUI1.cc","ms"}, 
+  {"func.LoadPackagedLibrary.cc","ms"}, 
+  {"func.OpenServiceA.cc","ms"}, 
+  {"func.BCryptEnumContextFunctionProviders.cc","ms"}, 
+  {"func.WSASetSocketPeerTargetName.cc","ms"}, 
+  {"func.MessageBoxW.cc","ms"}, 
+  {"func.RtlInstallFunctionTableCallback.cc","ms"}, 
+  {"func.NCryptCreateProtectionDescriptor.cc","ms"}, 
+  {"func.SafeArrayCreateEx.cc","ms"}, 
+  {"func.SetSecurityDescriptorSacl.cc","ms"}, 
+  {"func.GetCursorInfo.cc","ms"}, 
+  {"func.OpenThread.cc","ms"}, 
+  {"func.GetProcessHeap.cc","ms"}, 
+  {"func.CreateFileW.cc","ms"}, 
+  {"func.InitializeProcThreadAttributeList.cc","ms"}, 
+  {"func.SetProcessDpiAwarenessContext.cc","ms"}, 
+  {"func.VerSetConditionMask.cc","ms"}, 
+  {"func.GetTopWindow.cc","ms"}, 
+  {"func.WSAHtonl.cc","ms"}, 
+  {"func.wsprintfA.cc","ms"}, 
+  {"func.CompareStringW.cc","ms"}, 
+  {"func.cldap_openW.cc","ms"}, 
+  {"func.SafeArrayAllocDescriptorEx.cc","ms"}, 
+  {"func.NCryptGetProtectionDescriptorInfo.cc","ms"}, 
+  {"func.FatalExit.cc","ms"}, 
+  {"func.ldap_sslinit.cc","ms"}, 
+  {"func.GetAddrInfoExA.cc","ms"}, 
+  {"func.EncryptFileW.cc","ms"}, 
+  {"func.CryptCreateHash.cc","ms"}, 
+  {"func.CM_Setup_DevNode.cc","ms"}, 
+  {"func.SetIoRateControlInformationJobObject.cc","ms"}, 
+  {"func.NCryptStreamClose.cc","ms"}, 
+  {"func.ldap_search_ext_sW.cc","ms"}, 
+  {"func.CryptGetAsyncParam.cc","ms"}, 
+  {"func.RemoveVectoredExceptionHandler.cc","ms"}, 
+  {"func.CreateWaitableTimerExA.cc","ms"}, 
+  {"func.DeriveRestrictedAppContainerSidFromAppContainerSidAndRestrictedName.cc","ms"}, 
+  {"func.CertFreeCTLContext.cc","ms"}, 
+  {"func._lcreat.cc","ms"}, 
+  {"func.SysStringLen.cc","ms"}, 
+  {"func.RegSetValueExW.cc","ms"}, 
+  {"func.CloseTouchInputHandle.cc","ms"}, 
+  {"func.CheckRemoteDebuggerPresent.cc","ms"}, 
+  {"func.CryptQueryObject.cc","ms"}, 
+  {"func.WinHttpGetIEProxyConfigForCurrentUser.cc","ms"}, 
+  {"func.SymGetSourceFileW.cc","ms"}, 
+  {"func.CreateItemMoniker.cc","ms"}, 
+  {"func.CertFindAttribute.cc","ms"}, 
+  {"func.GetNextDlgGroupItem.cc","ms"}, 
+  {"func.VkKeyScanExW.cc","ms"}, 
+  {"func.VarBoolFromDate.cc","ms"}, 
+  {"func.SetProcessShutdownParameters.cc","ms"}, 
+  {"func.SHRegOpenUSKeyW.cc","ms"}, 
+  {"func.GetKernelObjectSecurity.cc","ms"}, 
+  {"func.CreatePopupMenu.cc","ms"}, 
+  {"func.GetNLSVersion.cc","ms"}, 
+  {"func.IsValidSecurityDescriptor.cc","ms"}, 
+  {"func.SetCommMask.cc","ms"}, 
+  {"func.GetNumaAvailableMemoryNode.cc","ms"}, 
+  {"func.recv.cc","ms"}, 
+  {"func.VarR4FromI2.cc","ms"}, 
+  {"func.FindNLSStringEx.cc","ms"}, 
+  {"func.ldap_modifyA.cc","ms"}, 
+  {"func.ChangeDisplaySettingsA.cc","ms"}, 
+  {"func.InitiateSystemShutdownA.cc","ms"}, 
+  {"func.GlobalAddAtomExW.cc","ms"}, 
+  {"func.CM_Get_Sibling.cc","ms"}, 
+  {"func.GetPrivateProfileIntW.cc","ms"}, 
+  {"func.VarI2FromR8.cc","ms"}, 
+  {"func.GetFirmwareEnvironmentVariableA.cc","ms"}, 
+  {"func.RegRestoreKeyA.cc","ms"}, 
+  {"func.RegDeleteValueA.cc","ms"}, 
+  {"func.ScrollConsoleScreenBufferW.cc","ms"}, 
+  {"func.PFXExportCertStoreEx.cc","ms"}, 
+  {"func.TzSpecificLocalTimeToSystemTimeEx.cc","ms"}, 
+  {"func.WSAGetOverlappedResult.cc","ms"}, 
+  {"type.HALF_PTR","i"}, 
+  {"func.GetVolumeInformationW.cc","ms"}, 
+  {"func.SetThreadAffinityMask.cc","ms"}, 
+  {"func.ShutdownBlockReasonQuery.cc","ms"}, 
+  {"func.GetNumberOfEventLogRecords.cc","ms"}, 
+  {"func.WakeAllConditionVariable.cc","ms"}, 
+  {"func.CoFileTimeNow.cc","ms"}, 
+  {"func.ReadProcessMemory.cc","ms"}, 
+  {"func.CreateDirectoryTransactedW.cc","ms"}, 
+  {"func.SetCommTimeouts.cc","ms"}, 
+  {"func.CryptSignCertificate.cc","ms"}, 
+  {"func.CryptGetProvParam.cc","ms"}, 
+  {"func.ReplyMessage.cc","ms"}, 
+  {"func.PathParseIconLocationA.cc","ms"}, 
+  {"func.SymMatchStringW.cc","ms"}, 
+  {"func.LogicalToPhysicalPointForPerMonitorDPI.cc","ms"}, 
+  {"func.EnumResourceNamesExA.cc","ms"}, 
+  {"func.SymFromInlineContext.cc","ms"}, 
+  {"func.CharLowerA.cc","ms"}, 
+  {"func.CreateDataAdviseHolder.cc","ms"}, 
+  {"func.MessageBoxIndirectW.cc","ms"}, 
+  {"func.ToAsciiEx.cc","ms"}, 
+  {"func.RegisterApplicationRestart.cc","ms"}, 
+  {"func.GetWindowPlacement.cc","ms"}, 
+  {"func.RtlAddFunctionTable.cc","ms"}, 
+  {"func.NCryptCreateClaim.cc","ms"}, 
+  {"func.RegConnectRegistryA.cc","ms"}, 
+  {"func.GetPrivateProfileIntA.cc","ms"}, 
+  {"func.SafeArrayCopyData.cc","ms"}, 
+  {"type.HCURSOR.size","64"}, 
+  {"func.CM_Get_Res_Des_Data_Size_Ex.cc","ms"}, 
+  {"func.DecodeRemotePointer.cc","ms"}, 
+  {"func.BCryptEncrypt.cc","ms"}, 
+  {"func.LookupAccountNameLocalW.cc","ms"}, 
+  {"func.BCryptFreeBuffer.cc","ms"}, 
+  {"func.RegisterPointerInputTarget.cc","ms"}, 
+  {"func.StrChrNIW.cc","ms"}, 
+  {"func.GetWindowWord.cc","ms"}, 
+  {"func.SHCopyKeyW.cc","ms"}, 
+  {"func.FlushTraceW.cc","ms"}, 
+  {"func.gethostbyaddr.cc","ms"}, 
+  {"func.BCryptEnumContextFunctions.cc","ms"}, 
+  {"func.GetCaretPos.cc","ms"}, 
+  {"func.GetPointerDevice.cc","ms"}, 
+  {"func.GetSystemRegistryQuota.cc","ms"}, 
+  {"func.HeapAlloc.cc","ms"}, 
+  {"func.SearchPathA.cc","ms"}, 
+  {"func.CoGetContextToken.cc","ms"}, 
+  {"func.CertOpenSystemStoreW.cc","ms"}, 
+  {"func.UnloadKeyboardLayout.cc","ms"}, 
+  {"func.ShellExecuteW.cc","ms"}, 
+  {"func.NotifyUILanguageChange.cc","ms"}, 
+  {"func.CredFree.cc","ms"}, 
+  {"func.PrefetchVirtualMemory.cc","ms"}, 
+  {"func.NCryptOpenKey.cc","ms"}, 
+  {"func.IsCharLowerA.cc","ms"}, 
+  {"func.SHCreateStreamOnFileEx.cc","ms"}, 
+  {"func.StrRetToStrA.cc","ms"}, 
+  {"func.WSALookupServiceEnd.cc","ms"}, 
+  {"func.AddAuditAccessAce.cc","ms"}, 
+  {"func.SetCommState.cc","ms"}, 
+  {"func.RaiseException.cc","ms"}, 
+  {"func.WPUCreateEvent.cc","ms"}, 
+  {"func.ContinueDebugEvent.cc","ms"}, 
+  {"func.SymSrvGetFileIndexStringW.cc","ms"}, 
+  {"func.ImageList_AddMasked.cc","ms"}, 
+  {"func.GetCurrentProcessorNumberEx.cc","ms"}, 
+  {"func.PathIsUNCServerShareA.cc","ms"}, 
+  {"func.OpenDesktopW.cc","ms"}, 
+  {"func.SetDefaultCommConfigA.cc","ms"}, 
+  {"func.CryptDuplicateHash.cc","ms"}, 
+  {"func.CloseClipboard.cc","ms"}, 
+  {"func.AssignProcessToJobObject.cc","ms"}, 
+  {"func.ObjectOpenAuditAlarmW.cc","ms"}, 
+  {"func.EventProviderEnabled.cc","ms"}, 
+  {"func.VarMod.cc","ms"}, 
+  {"func.GetDriveTypeW.cc","ms"}, 
+  {"func.SHGetValueW.cc","ms"}, 
+  {"func.GetMenuItemRect.cc","ms"}, 
+  {"func.ldap_simple_bind_sA.cc","ms"}, 
+  {"func.GetModuleFileNameExW.cc","ms"}, 
+  {"func.CryptFormatObject.cc","ms"}, 
+  {"func.LockWorkStation.cc","ms"}, 
+  {"func.VarCyFromDec.cc","ms"}, 
+  {"func.SHFreeNameMappings.cc","ms"}, 
+  {"func.SymGetScopeW.cc","ms"}, 
+  {"func.UnRegisterTypeLibForUser.cc","ms"}, 
+  {"func.ldap_memfree.cc","ms"}, 
+  {"func.CryptRetrieveObjectByUrlA.cc","ms"}, 
+  {"func.ReleaseSemaphore.cc","ms"}, 
+  {"func.EnumResourceLanguagesA.cc","ms"}, 
+  {"func.AreFileApisANSI.cc","ms"}, 
+  {"func.NCryptDeriveKey.cc","ms"}, 
+  {"func.UnsubscribeServiceChangeNotifications.cc","ms"}, 
+  {"func.GetDateFormatEx.cc","ms"}, 
+  {"func.CredPackAuthenticationBufferW.cc","ms"}, 
+  {"func.WSAConnect.cc","ms"}, 
+  {"func.CertCompareCertificate.cc","ms"}, 
+  {"func.TraceEvent.cc","ms"}, 
+  {"func.OleCreatePropertyFrameIndirect.cc","ms"}, 
+  {"func.CreateMutexA.cc","ms"}, 
+  {"func.PathSkipRootA.cc","ms"}, 
+  {"func.CreateWindowExA.cc","ms"}, 
+  {"func.CredUIParseUserNameW.cc","ms"}, 
+  {"func.SymInitialize.cc","ms"}, 
+  {"func.CryptSignAndEncodeCertificate.cc","ms"}, 
+  {"func.ldap_parse_reference.cc","ms"}, 
+  {"func.GetPrivateProfileStringA.cc","ms"}, 
+  {"func.ShowCursor.cc","ms"}, 
+  {"func.K32GetProcessMemoryInfo.cc","ms"}, 
+  {"func.ReportEventA.cc","ms"}, 
+  {"func.CredUnprotectA.cc","ms"}, 
+  {"func.IsCharAlphaA.cc","ms"}, 
+  {"func.BCryptCloseAlgorithmProvider.cc","ms"}, 
+  {"func.CredDeleteA.cc","ms"}, 
+  {"func.GetServiceDisplayNameA.cc","ms"}, 
+  {"func.PathGetArgsA.cc","ms"}, 
+  {"func.CertStrToNameW.cc","ms"}, 
+  {"func.FindFirstFileTransactedA.cc","ms"}, 
+  {"func.GetOverlappedResult.cc","ms"}, 
+  {"func.VarR8FromI4.cc","ms"}, 
+  {"func.CM_Get_Parent_Ex.cc","ms"}, 
+  {"func.ber_bvecfree.cc","ms"}, 
+  {"func.SafeArraySetRecordInfo.cc","ms"}, 
+  {"func.CryptVerifyMessageHash.cc","ms"}, 
+  {"func.StackWalk.cc","ms"}, 
+  {"func.GetNamedPipeClientComputerNameA.cc","ms"}, 
+  {"func.CryptMsgCalculateEncodedLength.cc","ms"}, 
+  {"func.GetPointerDeviceProperties.cc","ms"}, 
+  {"func.ReleaseSRWLockExclusive.cc","ms"}, 
+  {"func.QueryInterruptTimePrecise.cc","ms"}, 
+  {"func.lstrcmpiA.cc","ms"}, 
+  {"func.CryptUnregisterDefaultOIDFunction.cc","ms"}, 
+  {"func.CM_Query_Arbitrator_Free_Data.cc","ms"}, 
+  {"func.GetServiceKeyNameA.cc","ms"}, 
+  {"func.LoadKeyboardLayoutA.cc","ms"}, 
+  {"func.HeapWalk.cc","ms"}, 
+  {"func.PathCommonPrefixW.cc","ms"}, 
+  {"func.CreateStatusWindowW.cc","ms"}, 
+  {"func.VirtualAlloc2.cc","ms"}, 
+  {"func.GetGestureConfig.cc","ms"}, 
+  {"func.GetProcessDpiAwareness.cc","ms"}, 
+  {"func.EnumDeviceDrivers.cc","ms"}, 
+  {"func.SHGetItemFromObject.cc","ms"}, 
+  {"func.WPUQuerySocketHandleContext.cc","ms"}, 
+  {"func.InitiateSystemShutdownExW.cc","ms"}, 
+  {"func.SHGetPropertyStoreForWindow.cc","ms"}, 
+  {"func.VarUI1FromUI2.cc","ms"}, 
+  {"func.GetPointerDevices.cc","ms"}, 
+  {"func.GetOEMCP.cc","ms"}, 
+  {"func.FreeGPOListW.cc","ms"}, 
+  {"func.GetMenuPosFromID.cc","ms"}, 
+  {"func.GetOverlappedResultEx.cc","ms"}, 
+  {"func.CM_Request_Eject_PC.cc","ms"}, 
+  {"func.WSAIoctl.cc","ms"}, 
+  {"func.PrivilegedServiceAuditAlarmA.cc","ms"}, 
+  {"func.CopyFile2.cc","ms"}, 
+  {"func.MapGenericMask.cc","ms"}, 
+  {"func.PFXIsPFXBlob.cc","ms"}, 
+  {"func.GetSystemWindowsDirectoryW.cc","ms"}, 
+  {"func.CreateWindowExW.cc","ms"}, 
+  {"func.PathIsDirectoryEmptyA.cc","ms"}, 
+  {"func.SymEnumerateModules.cc","ms"}, 
+  {"func.LoadAcceleratorsA.cc","ms"}, 
+  {"func.GetTimeFormatA.cc","ms"}, 
+  {"func.VarI2FromDate.cc","ms"}, 
+  {"func.VarI8FromUI4.cc","ms"}, 
+  {"func.WinHttpFreeProxyResult.cc","ms"}, 
+  {"func.ldap_value_free.cc","ms"}, 
+  {"func.ImageList_GetIcon.cc","ms"}, 
+  {"func.CreateDirectoryW.cc","ms"}, 
+  {"func.PathGetArgsW.cc","ms"}, 
+  {"func.FindFirstFileTransactedW.cc","ms"}, 
+  {"func.SetStdHandleEx.cc","ms"}, 
+  {"func.StrCmpNCW.cc","ms"}, 
+  {"func.GetHostNameW.cc","ms"}, 
+  {"func.SetConsoleScreenBufferInfoEx.cc","ms"}, 
+  {"func.GetThreadUILanguage.cc","ms"}, 
+  {"func.DuplicateIcon.cc","ms"}, 
+  {"func.VerQueryValueW.cc","ms"}, 
+  {"func.ber_free.cc","ms"}, 
+  {"func.CM_Delete_Class_Key_Ex.cc","ms"}, 
+  {"func.OleIconToCursor.cc","ms"}, 
+  {"func.VarI4FromI1.cc","ms"}, 
+  {"func.SetDisplayAutoRotationPreferences.cc","ms"}, 
+  {"func.BindMoniker.cc","ms"}, 
+  {"func.ldap_conn_from_msg.cc","ms"}, 
+  {"func.CertSetCTLContextProperty.cc","ms"}, 
+  {"func.GetNamedPipeHandleStateW.cc","ms"}, 
+  {"func.ClearEventLogA.cc","ms"}, 
+  {"func.GetSystemPowerStatus.cc","ms"}, 
+  {"func.CredUnmarshalCredentialA.cc","ms"}, 
+  {"func.CharUpperW.cc","ms"}, 
+  {"type.HMETAFILE.size","64"}, 
+  {"func.VarI4FromI2.cc","ms"}, 
+  {"func.RegDeleteKeyW.cc","ms"}, 
+  {"func.VarUI2FromUI1.cc","ms"}, 
+  {"func.VarUI8FromUI1.cc","ms"}, 
+  {"func.EnumerateLoadedModules64.cc","ms"}, 
+  {"func.RealGetWindowClassA.cc","ms"}, 
+  {"func.DeleteBoundaryDescriptor.cc","ms"}, 
+  {"func.IsSystemResumeAutomatic.cc","ms"}, 
+  {"func.WSCGetProviderPath.cc","ms"}, 
+  {"func.VarCyMulI4.cc","ms"}, 
+  {"func.ldap_get_next_page_s.cc","ms"}, 
+  {"func.CoDecrementMTAUsage.cc","ms"}, 
+  {"func.IsProcessorFeaturePresent.cc","ms"}, 
+  {"func.DllCanUnloadNow.cc","ms"}, 
+  {"func.NCryptUnprotectSecret.cc","ms"}, 
+  {"func.LoadStringW.cc","ms"}, 
+  {"func.RemoveClipboardFormatListener.cc","ms"}, 
+  {"func.SymEnumerateModulesW64.cc","ms"}, 
+  {"func.CoGetTreatAsClass.cc","ms"}, 
+  {"func.FlatSB_GetScrollPropPtr.cc","ms"}, 
+  {"func.CM_Modify_Res_Des.cc","ms"}, 
+  {"func.WinHttpReadProxySettings.cc","ms"}, 
+  {"func.SymFunctionTableAccess64AccessRoutines.cc","ms"}, 
+  {"func.VarR4FromDisp.cc","ms"}, 
+  {"func.RegDeleteValueW.cc","ms"}, 
+  {"func.ImageList_DragLeave.cc","ms"}, 
+  {"func.EnumResourceTypesExA.cc","ms"}, 
+  {"func.WinHttpSetCredentials.cc","ms"}, 
+  {"func.TabbedTextOutW.cc","ms"}, 
+  {"func.CoGetMarshalSizeMax.cc","ms"}, 
+  {"func.RegLoadKeyW.cc","ms"}, 
+  {"func.WinHttpCreateUrl.cc","ms"}, 
+  {"func.SysReleaseString.cc","ms"}, 
+  {"func.getnameinfo.cc","ms"}, 
+  {"func.EvaluateProximityToRect.cc","ms"}, 
+  {"func.UnregisterApplicationRecoveryCallback.cc","ms"}, 
+  {"func.CM_Register_Device_Driver.cc","ms"}, 
+  {"func.CoGetInstanceFromFile.cc","ms"}, 
+  {"func.GrayStringA.cc","ms"}, 
+  {"func.HeapValidate.cc","ms"}, 
+  {"func.K32GetPerformanceInfo.cc","ms"}, 
+  {"func.FlatSB_ShowScrollBar.cc","ms"}, 
+  {"func.UrlGetLocationW.cc","ms"}, 
+  {"func.ldap_modrdn_sW.cc","ms"}, 
+  {"func.MessageBoxIndirectA.cc","ms"}, 
+  {"func.GetLocalTime.cc","ms"}, 
+  {"func.VarI4FromUI2.cc","ms"}, 
+  {"func.ldap_deleteA.cc","ms"}, 
+  {"func.ldap_result.cc","ms"}, 
+  {"func.SHCreateAssociationRegistration.cc","ms"}, 
+  {"func.GetCalendarInfoA.cc","ms"}, 
+  {"func.GetProcessAffinityMask.cc","ms"}, 
+  {"func.BackupRead.cc","ms"}, 
+  {"func.EnumDateFormatsW.cc","ms"}, 
+  {"func.InitNetworkAddressControl.cc","ms"}, 
+  {"func.SymGetSourceFileTokenW.cc","ms"}, 
+  {"func.QueryMemoryResourceNotification.cc","ms"}, 
+  {"func.GetAppContainerFolderPath.cc","ms"}, 
+  {"func.WSPStartup.cc","ms"}, 
+  {"func.SymFromToken.cc","ms"}, 
+  {"func.PathMatchSpecExA.cc","ms"}, 
+  {"func.VarBoolFromUI2.cc","ms"}, 
+  {"func.CM_Get_Resource_Conflict_Count.cc","ms"}, 
+  {"func.GetLastError.cc","ms"}, 
+  {"func.PathCchRenameExtension.cc","ms"}, 
+  {"func.CM_Get_Next_Res_Des_Ex.cc","ms"}, 
+  {"func.CertRemoveStoreFromCollection.cc","ms"}, 
+  {"func.VarI1FromR8.cc","ms"}, 
+  {"func.ImageList_DragShowNolock.cc","ms"}, 
+  {"func.RegSaveKeyExA.cc","ms"}, 
+  {"func.EqualRect.cc","ms"}, 
+  {"func.PowerSettingRegisterNotification.cc","ms"}, 
+  {"func.SearchPathW.cc","ms"}, 
+  {"func.SHQueryRecycleBinW.cc","ms"}, 
+  {"func.VarDecFix.cc","ms"}, 
+  {"func.LocalAlloc.cc","ms"}, 
+  {"func.VarCmp.cc","ms"}, 
+  {"func.WhichPlatform.cc","ms"}, 
+  {"func.GetOldestEventLogRecord.cc","ms"}, 
+  {"func.RegOpenCurrentUser.cc","ms"}, 
+  {"func.CM_Get_Device_Interface_List_ExA.cc","ms"}, 
+  {"func.VarDecFromR8.cc","ms"}, 
+  {"func.SHDeleteEmptyKeyW.cc","ms"}, 
+  {"func.CertDeleteCertificateFromStore.cc","ms"}, 
+  {"func.UnregisterClassW.cc","ms"}, 
+  {"func.WSAEventSelect.cc","ms"}, 
+  {"func.CredWriteDomainCredentialsW.cc","ms"}, 
+  {"func.CertAddRefServerOcspResponse.cc","ms"}, 
+  {"func.WinHttpSetStatusCallback.cc","ms"}, 
+  {"func.OpenWaitableTimerA.cc","ms"}, 
+  {"func.ReadConsoleInputW.cc","ms"}, 
+  {"func.RegSaveKeyA.cc","ms"}, 
+  {"func.WSAUnhookBlockingHook.cc","ms"}, 
+  {"func.SHRegQueryUSValueW.cc","ms"}, 
+  {"func.VarDiv.cc","ms"}, 
+  {"func.CreateEventA.cc","ms"}, 
+  {"func.RaiseFailFastException.cc","ms"}, 
+  {"func.RegSetKeyValueA.cc","ms"}, 
+  {"func.ldap_dn2ufnW.cc","ms"}, 
+  {"func.UpdateLayeredWindowIndirect.cc","ms"}, 
+  {"func.VarDateFromI4.cc","ms"}, 
+  {"func.GetKeyNameTextA.cc","ms"}, 
+  {"func.WSAEnumNetworkEvents.cc","ms"}, 
+  {"func.CertFindRDNAttr.cc","ms"}, 
+  {"func.GetIntegratedDisplaySize.cc","ms"}, 
+  {"func.GetKeyState.cc","ms"}, 
+  {"func.SHSimpleIDListFromPath.cc","ms"}, 
+  {NULL, NULL}
+};
+// 0x56358fed81a0
+// TODO
+typedef int (*GperfForeachCallback)(void *user, const char *k, const char *v);
+int gperf_types_x86_windows_64_foreach(GperfForeachCallback cb, void *user) {
+  int i = 0; while (kvs[i].name) {
+  cb (user, kvs[i].name, kvs[i].value);
+  i++;}
+  return 0;
+}
+const char *gperf_types_x86_windows_64_get(const char *s) {
+  int i = 0; while (kvs[i].name) {
+  if (!strcmp (s, kvs[i].name)) return kvs[i].value;
+  i++;}
+  return NULL;
+}
+#define sdb_hash_c_types_x86_windows_64(x,y) gperf_types_x86_windows_64_hash(x)
+const unsigned int gperf_types_x86_windows_64_hash(const char *s) {
+  int sum = strlen (s);
+  while (*s) { sum += *s; s++; }
+  return sum;
+}
+struct {const char *name;void *get;void *hash;void *foreach;} gperf_types_x86_windows_64 = {
+  .name = "types-x86-windows-64",
+  .get = &gperf_types_x86_windows_64_get,
+  .hash = &gperf_types_x86_windows_64_hash,
+  .foreach = &gperf_types_x86_windows_64_foreach
+};
+
+#if MAIN
+int main () {
+	const char *s = ((char*(*)(char*))gperf_types_x86_windows_64.get)("foo");
+	printf ("%s\n", s);
+}
+#endif
@@ -3,6 +3,7 @@
 #define R_LOG_ORIGIN "anal.diff"
 
 #include <r_anal.h>
+#include <r_hash.h>
 
 R_API RAnalDiff *r_anal_diff_new(void) {
 	RAnalDiff *diff = R_NEW0 (RAnalDiff);
@@ -131,13 +132,13 @@ R_API bool r_anal_diff_bb(RAnal *anal, RAnalFunction *fcn, RAnalFunction *fcn2)
 	}
 	fcn->diff->type = fcn2->diff->type = R_ANAL_DIFF_TYPE_MATCH;
 	r_list_sort (fcn->bbs, &bb_sort_by_addr);
+	r_list_sort (fcn2->bbs, &bb_sort_by_addr);
 	r_list_foreach (fcn->bbs, iter, bb) {
 		if (bb->diff && bb->diff->type != R_ANAL_DIFF_TYPE_NULL) {
 			continue;
 		}
 		ot = 0;
 		mbb = mbb2 = NULL;
-		r_list_sort (fcn2->bbs, &bb_sort_by_addr);
 		r_list_foreach (fcn2->bbs, iter2, bb2) {
 			if (!bb2->diff || bb2->diff->type == R_ANAL_DIFF_TYPE_NULL) {
 				r_diff_buffers_distance (NULL, bb->fingerprint, bb->size,
@@ -184,12 +185,580 @@ R_API bool r_anal_diff_bb(RAnal *anal, RAnalFunction *fcn, RAnalFunction *fcn2)
 	return true;
 }
 
+// Functions are paired in stages, each one only looking at the functions left
+// by the previous ones: unique identical fingerprints, same names, callers and
+// callees of the pairs found so far, and then the fingerprints sharing MinHash
+// buckets. Edit distances are only computed for the few candidates of each stage.
+// Unlike the old all against all loop, autonames like fcn.00401000 are not paired
+// by name, and only FCN and SYM functions are paired on both sides
+
+#define DIFF_MINHASH 16 // values in the MinHash signature of a fingerprint
+#define DIFF_ROWS 2 // values in each LSH band
+#define DIFF_BUCKET_MAX 64 // larger LSH buckets are too common to tell functions apart
+#define DIFF_CANDS 8 // fingerprints compared per function in the fuzzy stage
+#define DIFF_NEIGHBOR_CANDS 2 // same for the neighbors of a pair
+#define DIFF_NEIGHBOR_COMMON 2 // MinHash values a neighbor must share to be compared
+
+typedef struct {
+	RAnalFunction *fcn;
+	ut64 hash; // size and xxhash of the fingerprint, 0 if there is none
+	RVector calls; // ut32 indices of the callers and callees on the same side
+	ut32 mh[DIFF_MINHASH];
+	bool mhok;
+	bool done;
+	bool ok; // only functions and symbols are diffed by content
+} DiffFcn;
+
+typedef struct {
+	RAnal *anal;
+	RVector fcns[2]; // DiffFcn
+	RVector queue; // DiffPair, propagated through the call graph
+	size_t next; // first pair of the queue not propagated yet
+	ut64 mul[DIFF_MINHASH];
+	ut64 add[DIFF_MINHASH];
+} DiffCtx;
+
+typedef struct {
+	ut32 a;
+	ut32 b;
+} DiffPair;
+
+typedef struct {
+	ut64 hash;
+	ut32 side;
+	ut32 i;
+} DiffHash;
+
+typedef struct {
+	ut32 i;
+	ut32 buckets; // LSH buckets shared with the function
+} DiffCand;
+
+static inline DiffFcn *diff_fcn_at(DiffCtx *dc, int side, ut32 i) {
+	return r_vector_index_ptr (&dc->fcns[side], i);
+}
+
+static void diff_fcn_fini(void *e, void *user) {
+	r_vector_fini (&((DiffFcn *)e)->calls);
+}
+
+static inline ut64 splitmix64(ut64 *x) {
+	ut64 z = (*x += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+// the fingerprints of the blocks are freed once they are paired, compute them again if needed
+static void diff_fingerprint(RAnalFunction *fcn) {
+	RAnalBlock *bb;
+	RListIter *iter;
+	if (fcn->fingerprint) {
+		return;
+	}
+	r_list_foreach (fcn->bbs, iter, bb) {
+		if (!bb->fingerprint) {
+			r_anal_diff_fingerprint_bb (fcn->anal, bb);
+		}
+	}
+	r_anal_diff_fingerprint_fcn (fcn->anal, fcn);
+}
+
+static void diff_minhash(DiffCtx *dc, DiffFcn *df) {
+	const ut8 *fp = df->fcn->fingerprint;
+	const size_t size = df->fcn->fingerprint_size;
+	int k;
+	df->mhok = true;
+	for (k = 0; k < DIFF_MINHASH; k++) {
+		df->mh[k] = UT32_MAX;
+	}
+	if (!fp || !size) {
+		return;
+	}
+	// shingles of 4 bytes, or the whole fingerprint if it is shorter
+	const size_t n = (size < 4)? 1: size - 3;
+	size_t i;
+	for (i = 0; i < n; i++) {
+		ut64 h = (size < 4)? r_hash_xxhash (fp, size): r_read_le32 (fp + i);
+		h = (h ^ (h >> 16)) * 0x9e3779b97f4a7c15ULL;
+		for (k = 0; k < DIFF_MINHASH; k++) {
+			const ut32 v = (ut32)((h * dc->mul[k] + dc->add[k]) >> 32);
+			if (v < df->mh[k]) {
+				df->mh[k] = v;
+			}
+		}
+	}
+}
+
+static inline DiffFcn *diff_mh(DiffCtx *dc, DiffFcn *df) {
+	if (!df->mhok) {
+		diff_minhash (dc, df);
+	}
+	return df;
+}
+
+static int diff_mh_common(const DiffFcn *a, const DiffFcn *b) {
+	int k, n = 0;
+	for (k = 0; k < DIFF_MINHASH; k++) {
+		n += a->mh[k] == b->mh[k];
+	}
+	return n;
+}
+
+// sizes too different to ever reach the function threshold
+static bool diff_size_mismatch(RAnal *anal, RAnalFunction *fcn, RAnalFunction *fcn2) {
+	const ut64 fcn_size = r_anal_function_linear_size (fcn);
+	const ut64 fcn2_size = r_anal_function_linear_size (fcn2);
+	const ut64 maxsize = R_MAX (fcn_size, fcn2_size);
+	const ut64 minsize = R_MIN (fcn_size, fcn2_size);
+	return maxsize * anal->diff_thfcn > minsize;
+}
+
+// names like fcn.00401000 only tell the address, which moves between builds
+static bool diff_autoname(RAnalFunction *fcn) {
+	const char *dot = fcn->name? strrchr (fcn->name, '.'): NULL;
+	char *end = NULL;
+	return dot && dot[1] && strtoull (dot + 1, &end, 16) == fcn->addr && end && !*end;
+}
+
+static double diff_distance(RAnalFunction *fcn, RAnalFunction *fcn2) {
+	double t = 0;
+	if (fcn->fingerprint && fcn2->fingerprint) {
+		r_diff_buffers_distance (NULL, fcn->fingerprint, fcn->fingerprint_size,
+				fcn2->fingerprint, fcn2->fingerprint_size, NULL, &t);
+	}
+	return t;
+}
+
+static void diff_pair(DiffCtx *dc, ut32 a, ut32 b, double t) {
+	DiffFcn *da = diff_fcn_at (dc, 0, a);
+	DiffFcn *db = diff_fcn_at (dc, 1, b);
+	RAnalFunction *fcn = da->fcn;
+	RAnalFunction *fcn2 = db->fcn;
+	da->done = db->done = true;
+	/* Set flag in matched functions */
+	fcn->diff->type = fcn2->diff->type = (t >= 1)
+		? R_ANAL_DIFF_TYPE_MATCH
+		: R_ANAL_DIFF_TYPE_UNMATCH;
+	fcn->diff->dist = fcn2->diff->dist = t;
+	R_FREE (fcn->fingerprint);
+	R_FREE (fcn2->fingerprint);
+	fcn->diff->addr = fcn2->addr;
+	fcn2->diff->addr = fcn->addr;
+	fcn->diff->size = r_anal_function_linear_size (fcn2);
+	fcn2->diff->size = r_anal_function_linear_size (fcn);
+	R_FREE (fcn->diff->name);
+	if (fcn2->name) {
+		fcn->diff->name = strdup (fcn2->name);
+	}
+	R_FREE (fcn2->diff->name);
+	if (fcn->name) {
+		fcn2->diff->name = strdup (fcn->name);
+	}
+	r_anal_diff_bb (dc->anal, fcn, fcn2);
+	DiffPair p = { a, b };
+	r_vector_push (&dc->queue, &p);
+}
+
+static inline bool diff_free_fcn(DiffFcn *df) {
+	return df->ok && !df->done;
+}
+
+static void diff_sort(RVector *v, int (*cmp)(const void *, const void *)) {
+	if (v->len > 1) {
+		qsort (v->a, v->len, v->elem_size, cmp);
+	}
+}
+
+static int diff_u32_cmp(const void *x, const void *y) {
+	const ut32 a = *(const ut32 *)x, b = *(const ut32 *)y;
+	return (a < b)? -1: (a > b);
+}
+
+static int diff_hash_cmp(const void *x, const void *y) {
+	const DiffHash *a = x, *b = y;
+	if (a->hash != b->hash) {
+		return (a->hash < b->hash)? -1: 1;
+	}
+	if (a->side != b->side) {
+		return (a->side < b->side)? -1: 1;
+	}
+	return (a->i < b->i)? -1: (a->i > b->i);
+}
+
+static int diff_pair_cmp(const void *x, const void *y) {
+	const DiffPair *a = x, *b = y;
+	return (a->a < b->a)? -1: (a->a > b->a);
+}
+
+// pair the fingerprints found exactly once on each side
+static void diff_unique_hashes(DiffCtx *dc, RVector *hashes) {
+	RVector pairs;
+	r_vector_init (&pairs, sizeof (DiffPair), NULL, NULL);
+	diff_sort (hashes, diff_hash_cmp);
+	const size_t n = r_vector_length (hashes);
+	size_t i = 0;
+	while (i < n) {
+		const DiffHash *h = r_vector_index_ptr (hashes, i);
+		size_t j = i + 1;
+		while (j < n && ((DiffHash *)r_vector_index_ptr (hashes, j))->hash == h->hash) {
+			j++;
+		}
+		const DiffHash *h2 = (j == i + 2)? r_vector_index_ptr (hashes, i + 1): NULL;
+		if (h2 && h->side == 0 && h2->side == 1) {
+			RAnalFunction *fcn = diff_fcn_at (dc, 0, h->i)->fcn;
+			RAnalFunction *fcn2 = diff_fcn_at (dc, 1, h2->i)->fcn;
+			if (!memcmp (fcn->fingerprint, fcn2->fingerprint, fcn->fingerprint_size)) {
+				DiffPair p = { h->i, h2->i };
+				r_vector_push (&pairs, &p);
+			}
+		}
+		i = j;
+	}
+	// in the order of the first list, like the other stages
+	diff_sort (&pairs, diff_pair_cmp);
+	DiffPair *p;
+	r_vector_foreach (&pairs, p) {
+		diff_pair (dc, p->a, p->b, 1);
+	}
+	r_vector_fini (&pairs);
+}
+
+static void diff_hash_push(DiffCtx *dc, RVector *hashes, int side, ut32 i) {
+	DiffFcn *df = diff_fcn_at (dc, side, i);
+	if (diff_free_fcn (df) && df->hash) {
+		DiffHash h = { df->hash, side, i };
+		r_vector_push (hashes, &h);
+	}
+}
+
+static bool diff_init_side(DiffCtx *dc, int side, RList *fcns) {
+	RVector *v = &dc->fcns[side];
+	RListIter *iter;
+	RAnalFunction *fcn;
+	r_vector_init (v, sizeof (DiffFcn), diff_fcn_fini, NULL);
+	if (!r_vector_reserve (v, r_list_length (fcns))) {
+		return false;
+	}
+	HtUP *at = ht_up_new0 ();
+	if (!at) {
+		return false;
+	}
+	r_list_foreach (fcns, iter, fcn) {
+		DiffFcn *df = r_vector_end (v);
+		memset (df, 0, sizeof (DiffFcn));
+		r_vector_init (&df->calls, sizeof (ut32), NULL, NULL);
+		df->fcn = fcn;
+		// imports, locations and the rest are never paired, neither on the first side
+		df->ok = fcn->type == R_ANAL_FCN_TYPE_FCN || fcn->type == R_ANAL_FCN_TYPE_SYM;
+		df->done = fcn->diff->type != R_ANAL_DIFF_TYPE_NULL;
+		diff_fingerprint (fcn);
+		if (fcn->fingerprint && fcn->fingerprint_size > 0) {
+			df->hash = ((ut64)fcn->fingerprint_size << 32) | r_hash_xxhash (fcn->fingerprint, fcn->fingerprint_size);
+		}
+		ht_up_insert (at, fcn->addr, (void *)(size_t)r_vector_length (v));
+	}
+	// the call graph, in both directions
+	ut32 i;
+	for (i = 0; i < r_vector_length (v); i++) {
+		DiffFcn *df = r_vector_index_ptr (v, i);
+		RList *refs = r_anal_function_get_refs (df->fcn);
+		RAnalRef *ref;
+		r_list_foreach (refs, iter, ref) {
+			if (R_ANAL_REF_TYPE_MASK (ref->type) != R_ANAL_REF_TYPE_CALL) {
+				continue;
+			}
+			ut32 j = (ut32)(size_t)ht_up_find (at, ref->addr, NULL);
+			if (j-- && j != i) {
+				r_vector_push (&df->calls, &j);
+				r_vector_push (&((DiffFcn *)r_vector_index_ptr (v, j))->calls, &i);
+			}
+		}
+		r_list_free (refs);
+	}
+	// a function calling another one twice is still a single neighbor
+	for (i = 0; i < r_vector_length (v); i++) {
+		RVector *calls = &((DiffFcn *)r_vector_index_ptr (v, i))->calls;
+		diff_sort (calls, diff_u32_cmp);
+		ut32 *c = calls->a;
+		size_t j, n = calls->len? 1: 0;
+		for (j = 1; j < calls->len; j++) {
+			if (c[j] != c[n - 1]) {
+				c[n++] = c[j];
+			}
+		}
+		calls->len = n;
+	}
+	ht_up_free (at);
+	return true;
+}
+
+// pairs the neighbors of the pairs, first the identical ones and then the closest
+static void diff_propagate(DiffCtx *dc) {
+	RVector hashes, na, nb;
+	r_vector_init (&hashes, sizeof (DiffHash), NULL, NULL);
+	r_vector_init (&na, sizeof (ut32), NULL, NULL);
+	r_vector_init (&nb, sizeof (ut32), NULL, NULL);
+	for (; dc->next < r_vector_length (&dc->queue); dc->next++) {
+		const DiffPair p = *(DiffPair *)r_vector_index_ptr (&dc->queue, dc->next);
+		RVector *ca = &diff_fcn_at (dc, 0, p.a)->calls;
+		RVector *cb = &diff_fcn_at (dc, 1, p.b)->calls;
+		if (r_vector_empty (ca) || r_vector_empty (cb)) {
+			continue;
+		}
+		hashes.len = 0;
+		ut32 *j;
+		r_vector_foreach (ca, j) {
+			diff_hash_push (dc, &hashes, 0, *j);
+		}
+		r_vector_foreach (cb, j) {
+			diff_hash_push (dc, &hashes, 1, *j);
+		}
+		diff_unique_hashes (dc, &hashes);
+		na.len = 0;
+		nb.len = 0;
+		r_vector_foreach (ca, j) {
+			DiffFcn *df = diff_fcn_at (dc, 0, *j);
+			if (diff_free_fcn (df) && df->hash) {
+				r_vector_push (&na, j);
+			}
+		}
+		r_vector_foreach (cb, j) {
+			DiffFcn *df = diff_fcn_at (dc, 1, *j);
+			if (diff_free_fcn (df) && df->hash) {
+				r_vector_push (&nb, j);
+			}
+		}
+		if (r_vector_empty (&na) || r_vector_empty (&nb)) {
+			continue;
+		}
+		// the edit distance is only computed for the neighbors with most MinHash values in common
+		ut32 *a, *b;
+		r_vector_foreach (&na, a) {
+			DiffFcn *da = diff_mh (dc, diff_fcn_at (dc, 0, *a));
+			if (da->done) {
+				continue;
+			}
+			ut32 cands[DIFF_NEIGHBOR_CANDS];
+			int common[DIFF_NEIGHBOR_CANDS];
+			int c, ncands = 0;
+			r_vector_foreach (&nb, b) {
+				DiffFcn *db = diff_fcn_at (dc, 1, *b);
+				if (db->done || diff_size_mismatch (dc->anal, da->fcn, db->fcn)) {
+					continue;
+				}
+				const int n = diff_mh_common (da, diff_mh (dc, db));
+				if (n < DIFF_NEIGHBOR_COMMON) {
+					continue;
+				}
+				for (c = ncands; c > 0 && common[c - 1] < n; c--) {
+					if (c < DIFF_NEIGHBOR_CANDS) {
+						cands[c] = cands[c - 1];
+						common[c] = common[c - 1];
+					}
+				}
+				if (c < DIFF_NEIGHBOR_CANDS) {
+					cands[c] = *b;
+					common[c] = n;
+					ncands = R_MIN (ncands + 1, DIFF_NEIGHBOR_CANDS);
+				}
+			}
+			// the closest estimate is usually the closest one, take it if it is good enough
+			for (c = 0; c < ncands; c++) {
+				const double t = diff_distance (da->fcn, diff_fcn_at (dc, 1, cands[c])->fcn);
+				if (t > dc->anal->diff_thfcn) {
+					diff_pair (dc, *a, cands[c], t);
+					break;
+				}
+			}
+		}
+	}
+	r_vector_fini (&hashes);
+	r_vector_fini (&na);
+	r_vector_fini (&nb);
+}
+
+static inline ut64 diff_band_key(const DiffFcn *df, int band) {
+	ut64 k = band + 1;
+	int r;
+	for (r = 0; r < DIFF_ROWS; r++) {
+		k = (k ^ df->mh[band * DIFF_ROWS + r]) * 0x100000001b3ULL;
+	}
+	return k;
+}
+
+static void bucket_free(HtUPKv *kv) {
+	r_vector_free (kv->value);
+}
+
+static int diff_cand_cmp(const void *x, const void *y) {
+	const DiffCand *a = x, *b = y;
+	// most shared buckets first
+	if (a->buckets != b->buckets) {
+		return (a->buckets > b->buckets)? -1: 1;
+	}
+	return (a->i < b->i)? -1: (a->i > b->i);
+}
+
+// the remaining functions are compared with the ones sharing LSH buckets of their MinHash
+static void diff_fuzzy(DiffCtx *dc) {
+	HtUP *buckets = ht_up_new (NULL, bucket_free, NULL);
+	if (!buckets) {
+		return;
+	}
+	const int bands = DIFF_MINHASH / DIFF_ROWS;
+	ut32 i;
+	int k;
+	for (i = 0; i < r_vector_length (&dc->fcns[1]); i++) {
+		DiffFcn *df = diff_fcn_at (dc, 1, i);
+		if (!diff_free_fcn (df) || !df->hash) {
+			continue;
+		}
+		diff_mh (dc, df);
+		for (k = 0; k < bands; k++) {
+			const ut64 key = diff_band_key (df, k);
+			RVector *v = ht_up_find (buckets, key, NULL);
+			if (!v && (v = r_vector_new (sizeof (ut32), NULL, NULL))) {
+				ht_up_insert (buckets, key, v);
+			}
+			if (v) {
+				r_vector_push (v, &i);
+			}
+		}
+	}
+	RVector found, cands;
+	r_vector_init (&found, sizeof (ut32), NULL, NULL);
+	r_vector_init (&cands, sizeof (DiffCand), NULL, NULL);
+	for (i = 0; i < r_vector_length (&dc->fcns[0]); i++) {
+		DiffFcn *da = diff_fcn_at (dc, 0, i);
+		if (!diff_free_fcn (da) || !da->hash) {
+			continue;
+		}
+		diff_mh (dc, da);
+		found.len = 0;
+		for (k = 0; k < bands; k++) {
+			RVector *v = ht_up_find (buckets, diff_band_key (da, k), NULL);
+			if (v && r_vector_length (v) <= DIFF_BUCKET_MAX) {
+				ut32 *b;
+				r_vector_foreach (v, b) {
+					r_vector_push (&found, b);
+				}
+			}
+		}
+		// count the buckets shared with each candidate
+		diff_sort (&found, diff_u32_cmp);
+		cands.len = 0;
+		size_t j = 0, n = r_vector_length (&found);
+		while (j < n) {
+			const ut32 b = *(ut32 *)r_vector_index_ptr (&found, j);
+			size_t e = j + 1;
+			while (e < n && *(ut32 *)r_vector_index_ptr (&found, e) == b) {
+				e++;
+			}
+			DiffFcn *db = diff_fcn_at (dc, 1, b);
+			if (!db->done && !diff_size_mismatch (dc->anal, da->fcn, db->fcn)) {
+				DiffCand c = { b, (ut32)(e - j) };
+				r_vector_push (&cands, &c);
+			}
+			j = e;
+		}
+		diff_sort (&cands, diff_cand_cmp);
+		double t, ot = 0;
+		ut32 best = UT32_MAX;
+		DiffCand *c;
+		int tries = 0;
+		r_vector_foreach (&cands, c) {
+			if (tries++ >= DIFF_CANDS) {
+				break;
+			}
+			t = diff_distance (da->fcn, diff_fcn_at (dc, 1, c->i)->fcn);
+			if (t > dc->anal->diff_thfcn && t > ot) {
+				ot = t;
+				best = c->i;
+				if (t == 1) {
+					break;
+				}
+			}
+		}
+		if (best != UT32_MAX) {
+			diff_pair (dc, i, best, ot);
+		}
+	}
+	r_vector_fini (&found);
+	r_vector_fini (&cands);
+	ht_up_free (buckets);
+}
+
+static int diff_fcn_staged(RAnal *anal, RList *fcns, RList *fcns2) {
+	DiffCtx dc = { .anal = anal };
+	ut64 seed = 0x5eed;
+	int k;
+	for (k = 0; k < DIFF_MINHASH; k++) {
+		dc.mul[k] = splitmix64 (&seed) | 1;
+		dc.add[k] = splitmix64 (&seed);
+	}
+	r_vector_init (&dc.queue, sizeof (DiffPair), NULL, NULL);
+	if (!diff_init_side (&dc, 0, fcns) || !diff_init_side (&dc, 1, fcns2)) {
+		r_vector_fini (&dc.fcns[0]);
+		r_vector_fini (&dc.fcns[1]);
+		return false;
+	}
+	/* Identical functions */
+	RVector hashes;
+	r_vector_init (&hashes, sizeof (DiffHash), NULL, NULL);
+	ut32 i;
+	for (k = 0; k < 2; k++) {
+		for (i = 0; i < r_vector_length (&dc.fcns[k]); i++) {
+			diff_hash_push (&dc, &hashes, k, i);
+		}
+	}
+	diff_unique_hashes (&dc, &hashes);
+	r_vector_fini (&hashes);
+	R_LOG_DEBUG ("%d functions paired by hash", (int)r_vector_length (&dc.queue));
+	/* Compare functions with the same name */
+	HtPP *names = ht_pp_new0 ();
+	if (names) {
+		for (i = 0; i < r_vector_length (&dc.fcns[1]); i++) {
+			DiffFcn *df = diff_fcn_at (&dc, 1, i);
+			if (df->fcn->name && !diff_autoname (df->fcn)) {
+				// the first one wins
+				ht_pp_insert (names, df->fcn->name, (void *)(size_t)(i + 1));
+			}
+		}
+		for (i = 0; i < r_vector_length (&dc.fcns[0]); i++) {
+			DiffFcn *da = diff_fcn_at (&dc, 0, i);
+			const bool named = da->fcn->name && !diff_autoname (da->fcn);
+			ut32 j = named? (ut32)(size_t)ht_pp_find (names, da->fcn->name, NULL): 0;
+			if (!j-- || da->done) {
+				continue;
+			}
+			DiffFcn *db = diff_fcn_at (&dc, 1, j);
+			if (!db->done && db->fcn != da->fcn) {
+				diff_pair (&dc, i, j, diff_distance (da->fcn, db->fcn));
+			}
+		}
+		ht_pp_free (names);
+	}
+	R_LOG_DEBUG ("%d functions paired by hash and name", (int)r_vector_length (&dc.queue));
+	/* Callers and callees of the paired functions */
+	diff_propagate (&dc);
+	R_LOG_DEBUG ("%d functions paired by call graph", (int)r_vector_length (&dc.queue));
+	/* Compare remaining functions */
+	const size_t fuzzy = r_vector_length (&dc.queue);
+	diff_fuzzy (&dc);
+	R_LOG_DEBUG ("%d functions paired by similarity", (int)(r_vector_length (&dc.queue) - fuzzy));
+	diff_propagate (&dc);
+	r_vector_fini (&dc.queue);
+	r_vector_fini (&dc.fcns[0]);
+	r_vector_fini (&dc.fcns[1]);
+	return true;
+}
+
 R_API int r_anal_diff_fcn(RAnal *anal, RList *fcns, RList *fcns2) {
 	r_return_val_if_fail (anal && fcns, false);
-	RAnalFunction *fcn, *fcn2, *mfcn, *mfcn2;
+	RAnalFunction *fcn, *fcn2;
 	RListIter *iter, *iter2;
-	ut64 maxsize, minsize;
-	double t, ot;
+	double t;
 	if (!fcns2) {
 		fcns2 = fcns;
 	}
@@ -248,124 +817,7 @@ R_API int r_anal_diff_fcn(RAnal *anal, RList *fcns, RList *fcns2) {
 		}
 		return false;
 	}
-	/* Compare functions with the same name */
-	if (fcns) {
-		r_list_foreach (fcns, iter, fcn) {
-			if (!fcn->fingerprint) {
-				r_anal_diff_fingerprint_fcn (anal, fcn);
-			}
-			r_list_foreach (fcns2, iter2, fcn2) {
-				if (fcn == fcn2) {
-					continue;
-				}
-				if (!fcn->name || !fcn2->name || strcmp (fcn->name, fcn2->name)) {
-					continue;
-				}
-				if (!fcn2->fingerprint) {
-					r_anal_diff_fingerprint_fcn (anal, fcn2);
-				}
-				if (fcn->fingerprint && fcn2->fingerprint) {
-					r_diff_buffers_distance (NULL, fcn->fingerprint, fcn->fingerprint_size,
-							fcn2->fingerprint, fcn2->fingerprint_size,
-							NULL, &t);
-					/* Set flag in matched functions */
-					fcn->diff->type = fcn2->diff->type = (t >= 1)
-						? R_ANAL_DIFF_TYPE_MATCH
-						: R_ANAL_DIFF_TYPE_UNMATCH;
-					fcn->diff->dist = fcn2->diff->dist = t;
-					R_FREE (fcn->fingerprint);
-					R_FREE (fcn2->fingerprint);
-				}
-				fcn->diff->addr = fcn2->addr;
-				fcn2->diff->addr = fcn->addr;
-				fcn->diff->size = r_anal_function_linear_size (fcn2);
-				fcn2->diff->size = r_anal_function_linear_size (fcn);
-				R_FREE (fcn->diff->name);
-				if (fcn2->name) {
-					fcn->diff->name = strdup (fcn2->name);
-				}
-				R_FREE (fcn2->diff->name);
-				if (fcn->name) {
-					fcn2->diff->name = strdup (fcn->name);
-				}
-				r_anal_diff_bb (anal, fcn, fcn2);
-				break;
-			}
-		}
-	}
-	/* Compare remaining functions */
-	r_list_foreach (fcns, iter, fcn) {
-/*
-		if ((fcn->type != R_ANAL_FCN_TYPE_FCN &&
-			fcn->type != R_ANAL_FCN_TYPE_SYM) ||
-			fcn->diff->type != R_ANAL_DIFF_TYPE_NULL) {
-			continue;
-		}
-*/
-		if (fcn->diff->type != R_ANAL_DIFF_TYPE_NULL) {
-			continue;
-		}
-		ot = 0;
-		mfcn = mfcn2 = NULL;
-		r_list_foreach (fcns2, iter2, fcn2) {
-			ut64 fcn_size = r_anal_function_linear_size (fcn);
-			ut64 fcn2_size = r_anal_function_linear_size (fcn2);
-			if (fcn_size > fcn2_size) {
-				maxsize = fcn_size;
-				minsize = fcn2_size;
-			} else {
-				maxsize = fcn2_size;
-				minsize = fcn_size;
-			}
-			if (maxsize * anal->diff_thfcn > minsize) {
-				R_LOG_WARN ("Exceeded anal threshold while diffing %s and %s", fcn->name, fcn2->name);
-				continue;
-			}
-			if (fcn2->diff->type != R_ANAL_DIFF_TYPE_NULL) {
-				R_LOG_WARN ("Function %s already diffed", fcn2->name);
-				continue;
-			}
-			if ((fcn2->type != R_ANAL_FCN_TYPE_FCN && fcn2->type != R_ANAL_FCN_TYPE_SYM)) {
-				R_LOG_WARN ("Function %s type not supported", fcn2->name);
-				continue;
-			}
-			if (fcn->fingerprint && fcn2->fingerprint) {
-				r_diff_buffers_distance (NULL, fcn->fingerprint, fcn->fingerprint_size,
-						fcn2->fingerprint, fcn2->fingerprint_size, NULL, &t);
-			}
-			fcn->diff->dist = fcn2->diff->dist = t;
-			if (t > anal->diff_thfcn && t > ot) {
-				ot = t;
-				mfcn = fcn;
-				mfcn2 = fcn2;
-				if (t == 1) {
-					break;
-				}
-			}
-		}
-		if (mfcn && mfcn2) {
-			/* Set flag in matched functions */
-			mfcn->diff->type = mfcn2->diff->type = (ot == 1)
-				? R_ANAL_DIFF_TYPE_MATCH
-				: R_ANAL_DIFF_TYPE_UNMATCH;
-			R_FREE (mfcn->fingerprint);
-			R_FREE (mfcn2->fingerprint);
-			mfcn->diff->addr = mfcn2->addr;
-			mfcn2->diff->addr = mfcn->addr;
-			mfcn->diff->size = r_anal_function_linear_size (mfcn2);
-			mfcn2->diff->size = r_anal_function_linear_size (mfcn);
-			R_FREE (mfcn->diff->name);
-			if (mfcn2->name) {
-				mfcn->diff->name = strdup (mfcn2->name);
-			}
-			R_FREE (mfcn2->diff->name);
-			if (mfcn->name) {
-				mfcn2->diff->name = strdup (mfcn->name);
-			}
-			r_anal_diff_bb (anal, mfcn, mfcn2);
-		}
-	}
-	return true;
+	return diff_fcn_staged (anal, fcns, fcns2);
 }
 
 R_API int r_anal_diff_eval(RAnal *anal) {
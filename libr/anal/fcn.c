@@ -81,6 +81,15 @@ static int read_ahead(ReadAhead *ra, RAnal *anal, ut64 addr, ut8 *buf, int len)
 	return len;
 }
 
+// like read_ahead, but borrows the bytes from io when it can
+static const ut8 *peek_ahead(ReadAhead *ra, RAnal *anal, ut64 addr, ut8 *buf, int len) {
+	const ut8 *ptr;
+	if (anal->iob.peek_at && anal->iob.peek_at (anal->iob.io, addr, len, &ptr)) {
+		return ptr;
+	}
+	return (read_ahead (ra, anal, addr, buf, len) < 0)? NULL: buf;
+}
+
 R_API int r_anal_function_resize(RAnalFunction *fcn, int newsize) {
 	RAnal *anal = fcn->anal;
 	RAnalBlock *bb;
@@ -719,15 +728,16 @@ repeat:
 		if (r_cons_is_breaked ()) {
 			break;
 		}
-		ut8 buf[32]; // 32 bytes is enough to hold any instruction.
+		ut8 rbuf[32]; // 32 bytes is enough to hold any instruction.
 		ut32 at_delta = addrbytes * idx;
 		ut64 at = addr + at_delta;
-		ut64 bytes_read = R_MIN (len - at_delta, sizeof (buf));
-		ret = read_ahead (&ra, anal, at, buf, bytes_read);
-		if (ret < 0) {
+		ut64 bytes_read = R_MIN (len - at_delta, sizeof (rbuf));
+		const ut8 *buf = peek_ahead (&ra, anal, at, rbuf, bytes_read);
+		if (!buf) {
 			R_LOG_ERROR ("Failed to read");
 			break;
 		}
+		ret = bytes_read;
 		// ret is the max length of bytes available
 		// eprintf("%02x %02x\n", buf[0], buf[1]);
 		if (is_invalid_memory (anal, buf, bytes_read)) {
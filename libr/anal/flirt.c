@@ -11,6 +11,8 @@
 
 #define DEBUG 0
 
+R_IPI RThreadPool *r_sign_pool(RAnal *a, size_t n, size_t *grain);
+
 /*
 Flirt file format
 =================
@@ -318,6 +320,9 @@ typedef struct RFlirtNode {
 	ut64 variant_mask; // this is the mask that will define variant bytes in ut8 *pattern_bytes
 	ut8 *pattern_bytes; // holds the pattern bytes of the signature
 	ut8 *variant_bool_array; // bool array, if true, byte in pattern_bytes is a variant byte
+	// children by their first pattern byte, from child_first[b] to child_first[b + 1]
+	struct RFlirtNode **child_index;
+	ut32 *child_first;
 } RFlirtNode;
 
 // This is from flair tools flair/crc16.cpp
@@ -425,6 +430,8 @@ static void node_free(RFlirtNode *node) {
 	}
 	free (node->variant_bool_array);
 	free (node->pattern_bytes);
+	free (node->child_index);
+	free (node->child_first);
 	if (node->module_list) {
 		node->module_list->free = (RListFree)module_free;
 		r_list_free (node->module_list);
@@ -519,13 +526,10 @@ static void print_node(const RAnal *anal, const RFlirtNode *node, int indent) {
 	}
 }
 
-static bool module_match_buffer(RAnal *anal, const RFlirtModule *module, ut8 *b, ut64 address, ut32 buf_size) {
-	/* Returns true if module matches b, according to the signatures infos.
-	* Return false otherwise.
-	* The buffer starts from the first byte after the pattern */
-	RFlirtFunction *flirt_func;
-	RAnalFunction *next_module_function;
-	RListIter *tail_byte_it, *flirt_func_it;
+/* Returns true if the bytes in b match the crc and the tail bytes of the module.
+ * The buffer starts at the function address, the crc covers the bytes after the pattern */
+static bool module_match_bytes(const RFlirtModule *module, const ut8 *b, ut32 buf_size) {
+	RListIter *tail_byte_it;
 	RFlirtTailByte *tail_byte;
 
 	if (32 + module->crc_length < buf_size && module->crc16 != crc16 (b + 32, module->crc_length)) {
@@ -538,6 +542,14 @@ static bool module_match_buffer(RAnal *anal, const RFlirtModule *module, ut8 *b,
 			}
 		}
 	}
+	return true;
+}
+
+// names, flags and resizes the functions of a matched module
+static void module_apply(RAnal *anal, const RFlirtModule *module, ut64 address) {
+	RFlirtFunction *flirt_func;
+	RAnalFunction *next_module_function;
+	RListIter *flirt_func_it;
 
 	// TODO referenced functions
 	r_list_foreach (module->public_functions, flirt_func_it, flirt_func) {
@@ -601,12 +613,11 @@ static bool module_match_buffer(RAnal *anal, const RFlirtModule *module, ut8 *b,
 			free (name);
 		}
 	}
-	return true;
 }
 
 /* Returns true if b matches the pattern in node. */
 /* Returns false otherwise. */
-static bool node_pattern_match(const RFlirtNode *node, ut8 *b, int buf_size) {
+static bool node_pattern_match(const RFlirtNode *node, const ut8 *b, int buf_size) {
 	int i;
 	if (buf_size < node->length) {
 		return false;
@@ -621,65 +632,40 @@ static bool node_pattern_match(const RFlirtNode *node, ut8 *b, int buf_size) {
 	return true;
 }
 
-static bool node_match_buffer(RAnal *anal, const RFlirtNode *node, ut8 *b, ut64 address, ut32 buf_size, ut32 buf_idx) {
+// returns the first module of the tree under node matching b, it has no side effects
+static const RFlirtModule *node_match_buffer(const RFlirtNode *node, const ut8 *b, ut32 buf_size, ut32 buf_idx) {
 	RListIter *node_child_it, *module_it;
 	RFlirtNode *child;
 	RFlirtModule *module;
 
 	if (node_pattern_match (node, b + buf_idx, buf_size - buf_idx)) {
-		if (node->child_list) {
+		const ut32 idx = buf_idx + node->length;
+		if (node->child_first) {
+			if (idx < buf_size) {
+				ut32 i;
+				for (i = node->child_first[b[idx]]; i < node->child_first[b[idx] + 1]; i++) {
+					const RFlirtModule *m = node_match_buffer (node->child_index[i], b, buf_size, idx);
+					if (m) {
+						return m;
+					}
+				}
+			}
+		} else if (node->child_list) {
 			r_list_foreach (node->child_list, node_child_it, child) {
-				if (node_match_buffer (anal, child, b, address, buf_size, buf_idx + node->length)) {
-					return true;
+				const RFlirtModule *m = node_match_buffer (child, b, buf_size, idx);
+				if (m) {
+					return m;
 				}
 			}
 		} else if (node->module_list) {
 			r_list_foreach (node->module_list, module_it, module) {
-				if (module_match_buffer (anal, module, b, address, buf_size)) {
-					return true;
+				if (module_match_bytes (module, b, buf_size)) {
+					return module;
 				}
 			}
 		}
 	}
-	return false;
-}
-
-static bool node_match_functions(RAnal *anal, const RFlirtNode *root_node) {
-	/* Tries to find matching functions between the signature infos in root_node
-	* and the analyzed functions in anal
-	* Returns false on error. */
-
-	if (r_list_length (anal->fcns) == 0) {
-		R_LOG_INFO ("Nothing to do when no functions have been analyzed. Try running `aa`");
-		return false;
-	}
-
-	anal->flb.push_fs (anal->flb.f, "flirt");
-	RListIter *it_func;
-	RAnalFunction *func;
-	r_list_foreach (anal->fcns, it_func, func) {
-		ut64 func_size = r_anal_function_linear_size (func);
-		ut8 *func_buf = malloc (func_size);
-		if (!func_buf) {
-			continue;
-		}
-		if (!anal->iob.read_at (anal->iob.io, func->addr, func_buf, (int)func_size)) {
-			R_LOG_WARN ("Couldn't read function %s at 0x%"PFMT64x, func->name, func->addr);
-			free (func_buf);
-			continue;
-		}
-		RListIter *node_child_it;
-		RFlirtNode *child;
-		r_list_foreach (root_node->child_list, node_child_it, child) {
-			if (node_match_buffer (anal, child, func_buf, func->addr, func_size, 0)) {
-				break;
-			}
-		}
-		free (func_buf);
-	}
-	anal->flb.pop_fs (anal->flb.f);
-
-	return true;
+	return NULL;
 }
 
 // parses a module tail bytes, returns false on parsing error
@@ -865,7 +851,7 @@ static ut8 read_module_public_functions(RFlirt *f, RFlirtModule *module, ut8 *fl
 		} else {
 			function->name[i] = '\0';
 		}
-		R_LOG_ERROR ("%04X:%s ", function->offset, function->name);
+		R_LOG_DEBUG ("%04X:%s ", function->offset, function->name);
 		*flags = current_byte;
 		r_list_append (module->public_functions, function);
 	} while (*flags & IDASIG__PARSE__MORE_PUBLIC_NAMES);
@@ -1424,22 +1410,306 @@ R_API void r_sign_flirt_dump(const RAnal *anal, const char *flirt_file) {
 	flirt_free (f);
 }
 
-// parses a flirt signature file and scan the currently opened file with it
-R_API void r_sign_flirt_scan(RAnal *anal, const char *flirt_file) {
-	RBuffer *flirt_buf = r_buf_new_slurp (flirt_file);
-	if (!flirt_buf) {
-		R_LOG_ERROR ("Can't slurp %s", flirt_file);
+#define FLIRT_BATCH 1024
+#define FLIRT_INDEX_MIN 8
+
+typedef struct {
+	const char *file;
+	RFlirtNode *root;
+	int modules;
+	int matches;
+	double parse_time;
+} FlirtSigFile;
+
+typedef struct {
+	const RFlirtNode *node;
+	int file;
+} FlirtRoot;
+
+typedef struct {
+	RAnalFunction *fcn;
+	ut64 addr;
+} FlirtFcn;
+
+typedef struct {
+	RAnalFunction *fcn;
+	ut64 addr;
+	ut32 size;
+	const ut8 *buf; // borrowed from io or in the batch copy, NULL if it could not be read
+	const RFlirtModule *module;
+	int file;
+} FlirtJob;
+
+typedef struct {
+	RVector roots[256]; // FlirtRoot of all the files by first pattern byte, in file order
+	FlirtJob *jobs;
+} FlirtScan;
+
+static int flirt_count_modules(const RFlirtNode *node) {
+	RListIter *iter;
+	RFlirtNode *child;
+	int n = node->module_list? r_list_length (node->module_list): 0;
+	if (node->child_list) {
+		r_list_foreach (node->child_list, iter, child) {
+			n += flirt_count_modules (child);
+		}
+	}
+	return n;
+}
+
+// index the children of the wide nodes when none of them starts with a variant byte
+static void node_index_children(RFlirtNode *node) {
+	RListIter *iter;
+	RFlirtNode *child;
+	if (!node->child_list) {
 		return;
 	}
-	RFlirt *f = flirt_new (anal, flirt_buf);
-	RFlirtNode *node = flirt_parse (f);
-	if (node) {
-		if (!node_match_functions (anal, node)) {
-			R_LOG_ERROR ("scanning file %s", flirt_file);
+	ut32 count[257] = {0};
+	bool indexable = r_list_length (node->child_list) >= FLIRT_INDEX_MIN;
+	r_list_foreach (node->child_list, iter, child) {
+		node_index_children (child);
+		if (!child->length || child->variant_bool_array[0]) {
+			indexable = false;
+		} else {
+			count[child->pattern_bytes[0] + 1]++;
 		}
-		node_free (node);
-	} else {
-		R_LOG_ERROR ("We encountered an error while parsing the file %s", flirt_file);
 	}
-	flirt_free (f);
+	if (!indexable) {
+		return;
+	}
+	node->child_first = R_NEWS (ut32, 257);
+	node->child_index = R_NEWS (RFlirtNode *, r_list_length (node->child_list));
+	if (!node->child_first || !node->child_index) {
+		R_FREE (node->child_first);
+		R_FREE (node->child_index);
+		return;
+	}
+	int i;
+	for (i = 0; i < 256; i++) {
+		count[i + 1] += count[i];
+	}
+	memcpy (node->child_first, count, sizeof (count));
+	// keep the order of the list, the first matching child wins
+	r_list_foreach (node->child_list, iter, child) {
+		node->child_index[count[child->pattern_bytes[0]]++] = child;
+	}
+}
+
+// the top level nodes starting with a variant byte are in all the buckets
+static void flirt_index_root(FlirtScan *s, const RFlirtNode *root, int file) {
+	RListIter *iter;
+	RFlirtNode *node;
+	r_list_foreach (root->child_list, iter, node) {
+		FlirtRoot fr = { node, file };
+		if (node->length > 0 && !node->variant_bool_array[0]) {
+			r_vector_push (&s->roots[node->pattern_bytes[0]], &fr);
+		} else {
+			int i;
+			for (i = 0; i < 256; i++) {
+				r_vector_push (&s->roots[i], &fr);
+			}
+		}
+	}
+}
+
+// walks the merged trees once, the first file with a matching module wins
+static const RFlirtModule *flirt_match(FlirtScan *s, const ut8 *b, ut32 size, int *file) {
+	FlirtRoot *fr;
+	if (!size) {
+		return NULL;
+	}
+	r_vector_foreach (&s->roots[b[0]], fr) {
+		const RFlirtModule *m = node_match_buffer (fr->node, b, size, 0);
+		if (m) {
+			*file = fr->file;
+			return m;
+		}
+	}
+	return NULL;
+}
+
+static void flirt_match_range(void *user, size_t from, size_t to) {
+	FlirtScan *s = user;
+	size_t i;
+	for (i = from; i < to; i++) {
+		FlirtJob *job = &s->jobs[i];
+		if (job->buf) {
+			job->module = flirt_match (s, job->buf, job->size, &job->file);
+		}
+	}
+}
+
+// matches again a function resized by a previous module of the batch
+static const RFlirtModule *flirt_rematch(RAnal *anal, FlirtScan *s, FlirtJob *job) {
+	const ut8 *buf = NULL;
+	ut8 *copy = NULL;
+	if (!job->size) {
+		return NULL;
+	}
+	if (!anal->iob.peek_at || !anal->iob.peek_at (anal->iob.io, job->addr, job->size, &buf)) {
+		copy = malloc (job->size);
+		if (copy && anal->iob.read_at (anal->iob.io, job->addr, copy, job->size)) {
+			buf = copy;
+		}
+	}
+	const RFlirtModule *m = buf? flirt_match (s, buf, job->size, &job->file): NULL;
+	free (copy);
+	return m;
+}
+
+// parses the flirt signature files and scans the analyzed functions with all of them at once
+R_API void r_sign_flirt_scan_files(RAnal *anal, RList *files) {
+	r_return_if_fail (anal && files);
+	const int nfiles = r_list_length (files);
+	FlirtSigFile *sigs = R_NEWS0 (FlirtSigFile, R_MAX (nfiles, 1));
+	FlirtScan s = { .jobs = NULL };
+	FlirtFcn *fcns = NULL;
+	ut8 *copy = NULL;
+	size_t copy_size = 0;
+	int i = 0, loaded = 0;
+	if (!sigs) {
+		return;
+	}
+	for (i = 0; i < 256; i++) {
+		r_vector_init (&s.roots[i], sizeof (FlirtRoot), NULL, NULL);
+	}
+	RListIter *iter;
+	const char *file;
+	i = 0;
+	r_list_foreach (files, iter, file) {
+		FlirtSigFile *sf = &sigs[i++];
+		sf->file = file;
+		double t = r_time_now_mono ();
+		RBuffer *flirt_buf = r_buf_new_slurp (file);
+		if (!flirt_buf) {
+			R_LOG_ERROR ("Can't slurp %s", file);
+			continue;
+		}
+		RFlirt *f = flirt_new (anal, flirt_buf);
+		sf->root = flirt_parse (f);
+		flirt_free (f);
+		if (!sf->root) {
+			R_LOG_ERROR ("We encountered an error while parsing the file %s", file);
+			continue;
+		}
+		sf->parse_time = (r_time_now_mono () - t) / 1000000.0;
+		sf->modules = flirt_count_modules (sf->root);
+		node_index_children (sf->root);
+		flirt_index_root (&s, sf->root, i - 1);
+		loaded++;
+	}
+	const int n = r_list_length (anal->fcns);
+	if (!loaded) {
+		goto beach;
+	}
+	if (!n) {
+		R_LOG_INFO ("Nothing to do when no functions have been analyzed. Try running `aa`");
+		goto beach;
+	}
+	s.jobs = R_NEWS0 (FlirtJob, FLIRT_BATCH);
+	fcns = R_NEWS (FlirtFcn, n);
+	if (!s.jobs || !fcns) {
+		goto beach;
+	}
+	// applying a module deletes the functions merged into another one
+	RAnalFunction *fcn;
+	i = 0;
+	r_list_foreach (anal->fcns, iter, fcn) {
+		fcns[i].fcn = fcn;
+		fcns[i].addr = fcn->addr;
+		i++;
+	}
+	double t = r_time_now_mono ();
+	anal->flb.push_fs (anal->flb.f, "flirt");
+	int from;
+	for (from = 0; from < n; from += FLIRT_BATCH) {
+		const int to = R_MIN (from + FLIRT_BATCH, n);
+		int nj = 0;
+		size_t need = 0;
+		// borrow the function bytes from io, the rest is copied once in the batch buffer
+		for (i = from; i < to; i++) {
+			if (r_anal_get_function_at (anal, fcns[i].addr) != fcns[i].fcn) {
+				continue;
+			}
+			FlirtJob *job = &s.jobs[nj++];
+			job->fcn = fcns[i].fcn;
+			job->addr = fcns[i].addr;
+			job->size = r_anal_function_linear_size (job->fcn);
+			job->buf = NULL;
+			job->module = NULL;
+			if (!anal->iob.peek_at || !anal->iob.peek_at (anal->iob.io, job->addr, job->size, &job->buf)) {
+				need += job->size;
+			}
+		}
+		if (need > copy_size) {
+			ut8 *c = realloc (copy, need);
+			if (c) {
+				copy = c;
+				copy_size = need;
+			}
+		}
+		size_t off = 0;
+		for (i = 0; i < nj; i++) {
+			FlirtJob *job = &s.jobs[i];
+			if (job->buf) {
+				continue;
+			}
+			if (!job->size || off + job->size > copy_size || !anal->iob.read_at (anal->iob.io, job->addr, copy + off, (int)job->size)) {
+				R_LOG_WARN ("Couldn't read function %s at 0x%"PFMT64x, job->fcn->name, job->addr);
+				continue;
+			}
+			job->buf = copy + off;
+			off += job->size;
+		}
+		size_t grain;
+		RThreadPool *pool = r_sign_pool (anal, nj, &grain);
+		r_th_parallel_for (pool, 0, nj, grain, flirt_match_range, &s);
+		// apply the matches in the order of the function list
+		for (i = 0; i < nj; i++) {
+			FlirtJob *job = &s.jobs[i];
+			if (r_anal_get_function_at (anal, job->addr) != job->fcn) {
+				continue;
+			}
+			const ut32 size = r_anal_function_linear_size (job->fcn);
+			if (size != job->size) {
+				job->size = size;
+				job->module = flirt_rematch (anal, &s, job);
+			}
+			if (job->module) {
+				module_apply (anal, job->module, job->addr);
+				sigs[job->file].matches++;
+			}
+		}
+	}
+	anal->flb.pop_fs (anal->flb.f);
+	t = (r_time_now_mono () - t) / 1000000.0;
+	for (i = 0; i < nfiles; i++) {
+		FlirtSigFile *sf = &sigs[i];
+		if (sf->root) {
+			R_LOG_INFO ("%s: %d modules, %d matches, parsed in %.3fs",
+				sf->file, sf->modules, sf->matches, sf->parse_time);
+		}
+	}
+	R_LOG_INFO ("Scanned %d functions with %d signature files in %.3fs", n, loaded, t);
+beach:
+	for (i = 0; i < 256; i++) {
+		r_vector_fini (&s.roots[i]);
+	}
+	for (i = 0; i < nfiles; i++) {
+		node_free (sigs[i].root);
+	}
+	free (sigs);
+	free (fcns);
+	free (copy);
+	free (s.jobs);
+}
+
+// parses a flirt signature file and scan the currently opened file with it
+R_API void r_sign_flirt_scan(RAnal *anal, const char *flirt_file) {
+	RList *files = r_list_new ();
+	if (files) {
+		r_list_append (files, (void *)flirt_file);
+		r_sign_flirt_scan_files (anal, files);
+		r_list_free (files);
+	}
 }
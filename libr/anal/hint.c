@@ -83,6 +83,7 @@ void r_anal_hint_storage_fini(RAnal *a) {
 
 // R2_590 - add argument to specify the type of hint to remove
 R_API void r_anal_hint_clear(RAnal *a) {
+	r_anal_opcache_flush (a);
 	r_anal_hint_storage_fini (a);
 	r_anal_hint_storage_init (a);
 }
@@ -103,6 +104,7 @@ static bool addr_hint_range_delete_cb(void *user, const ut64 key, const void *va
 }
 
 R_API void r_anal_hint_del(RAnal *a, ut64 addr, ut64 size) {
+	r_anal_opcache_invalidate (a, addr, R_MAX (size, 1));
 	if (size <= 1) {
 		// only single address
 		ht_up_delete (a->addr_hints, addr);
@@ -142,6 +144,7 @@ static void unset_addr_hint_record(RAnal *anal, RAnalAddrHintType type, ut64 add
 	if (!records) {
 		return;
 	}
+	r_anal_opcache_invalidate (anal, addr, 1);
 	size_t i;
 	for (i = 0; i < records->len; i++) {
 		RAnalAddrHintRecord *record = r_vector_index_ptr (records, i);
@@ -155,6 +158,7 @@ static void unset_addr_hint_record(RAnal *anal, RAnalAddrHintType type, ut64 add
 
 // create or return the existing addr hint record of the given type at addr
 static RAnalAddrHintRecord *ensure_addr_hint_record(RAnal *anal, RAnalAddrHintType type, ut64 addr) {
+	r_anal_opcache_invalidate (anal, addr, 1);
 	RVector *records = ht_up_find (anal->addr_hints, addr, NULL);
 	if (!records) {
 		records = r_vector_new (sizeof (RAnalAddrHintRecord), addr_hint_record_fini, NULL);
@@ -284,12 +288,15 @@ R_API void r_anal_hint_set_arch(RAnal *a, ut64 addr, const char *arch) {
 	}
 	free (record->arch);
 	record->arch = arch ? strdup (arch) : NULL;
+	// ranged hints change how everything after addr is decoded
+	r_anal_opcache_flush (a);
 }
 
 R_API void r_anal_hint_set_bits(RAnal *a, ut64 addr, int bits) {
 	RAnalBitsHintRecord *record = (RAnalBitsHintRecord *)ensure_ranged_hint_record (&a->bits_hints, addr, sizeof (RAnalBitsHintRecord));
 	if (record) {
 		record->bits = bits;
+		r_anal_opcache_flush (a);
 		if (a->hint_cbs.on_bits) {
 			a->hint_cbs.on_bits (a, addr, bits, true);
 		}
@@ -361,6 +368,7 @@ R_API void r_anal_hint_unset_stackframe(RAnal *a, ut64 addr) {
 }
 
 R_API void r_anal_hint_unset_arch(RAnal *a, ut64 addr) {
+	r_anal_opcache_flush (a);
 	r_rbtree_delete (&a->arch_hints, &addr, ranged_hint_record_cmp, NULL, arch_hint_record_free_rb, NULL);
 }
 
@@ -373,6 +381,7 @@ static bool filter_hints(ut64 addr, int bits, void *user) {
 }
 
 R_API void r_anal_hint_unset_bits(RAnal *a, ut64 addr) {
+	r_anal_opcache_flush (a);
 	if (addr == UT64_MAX) {
 		// delete all bits hints
 		RList *list = r_list_newf (free);
@@ -143,6 +143,359 @@ beach:
 	return ret;
 }
 
+// Cache of decoded instructions, see anal.opcache. The entries live in a
+// fixed arena linked in lru order and are found by address, an entry is only
+// used if the instruction bytes, the decoder, the bits and the mask match,
+// hints are applied after taking the instruction from the cache. The decoder
+// is the plugin, sessions are reallocated on every arch change and a new one
+// can get the address of the freed one.
+
+#define OPCACHE_WINDOW 32
+
+typedef struct {
+	ut64 addr;
+	const void *decoder; // arch or anal plugin
+	int bits;
+	RAnalOpMask mask;
+	int len; // bytes given to the decoder, up to OPCACHE_WINDOW
+	ut8 buf[OPCACHE_WINDOW];
+	bool hasbytes;
+	int ret; // value returned by the decoder
+	RAnalOp op;
+	int prev; // lru order, -1 terminated
+	int next;
+	int chain; // next entry at the same address
+} OpCacheEntry;
+
+struct r_anal_opcache_t {
+	HtUP *ht; // addr => index of the first entry + 1
+	OpCacheEntry *entries;
+	int size;
+	int count;
+	int head; // most recently used
+	int tail;
+	int free; // unused entries chained by next
+	// decoding setup of the cached entries
+	const void *decoder;
+	char *arch;
+	int bits;
+	ut32 endian;
+	int syntax;
+	char *cpu;
+	// addresses that missed once, most instructions are decoded only once
+	// so they are cached the second time they are requested
+	ut64 *seen;
+	RAnalOpCacheStats stats;
+};
+
+static void opcache_unlink(RAnalOpCache *c, int i) {
+	OpCacheEntry *e = &c->entries[i];
+	if (e->prev != -1) {
+		c->entries[e->prev].next = e->next;
+	} else {
+		c->head = e->next;
+	}
+	if (e->next != -1) {
+		c->entries[e->next].prev = e->prev;
+	} else {
+		c->tail = e->prev;
+	}
+}
+
+static void opcache_link(RAnalOpCache *c, int i) {
+	OpCacheEntry *e = &c->entries[i];
+	e->prev = -1;
+	e->next = c->head;
+	if (c->head != -1) {
+		c->entries[c->head].prev = i;
+	} else {
+		c->tail = i;
+	}
+	c->head = i;
+}
+
+static void opcache_remove(RAnalOpCache *c, int i) {
+	OpCacheEntry *e = &c->entries[i];
+	int first = (int)(size_t)ht_up_find (c->ht, e->addr, NULL) - 1;
+	if (first == i) {
+		if (e->chain != -1) {
+			ht_up_update (c->ht, e->addr, (void *)(size_t)(e->chain + 1));
+		} else {
+			ht_up_delete (c->ht, e->addr);
+		}
+	} else {
+		int j = first;
+		while (j != -1 && c->entries[j].chain != i) {
+			j = c->entries[j].chain;
+		}
+		if (j != -1) {
+			c->entries[j].chain = e->chain;
+		}
+	}
+	opcache_unlink (c, i);
+	r_anal_op_fini (&e->op);
+	e->next = c->free;
+	c->free = i;
+	c->count--;
+}
+
+R_API void r_anal_opcache_flush(RAnal *anal) {
+	r_return_if_fail (anal);
+	RAnalOpCache *c = anal->opcache;
+	if (!c) {
+		return;
+	}
+	while (c->head != -1) {
+		opcache_remove (c, c->head);
+	}
+}
+
+// Allocate room for size instructions, 0 disables the cache
+R_API bool r_anal_opcache_setup(RAnal *anal, int size) {
+	r_return_val_if_fail (anal && size >= 0, false);
+	RAnalOpCache *c = anal->opcache;
+	if (c) {
+		r_anal_opcache_flush (anal);
+		ht_up_free (c->ht);
+		free (c->entries);
+		free (c->seen);
+		free (c->arch);
+		free (c->cpu);
+		R_FREE (anal->opcache);
+	}
+	if (!size) {
+		return true;
+	}
+	c = R_NEW0 (RAnalOpCache);
+	if (!c) {
+		return false;
+	}
+	c->ht = ht_up_new0 ();
+	c->entries = R_NEWS0 (OpCacheEntry, size);
+	c->seen = R_NEWS (ut64, size);
+	if (!c->ht || !c->entries || !c->seen) {
+		ht_up_free (c->ht);
+		free (c->entries);
+		free (c->seen);
+		free (c);
+		return false;
+	}
+	memset (c->seen, 0xff, size * sizeof (ut64));
+	int i;
+	for (i = 0; i < size; i++) {
+		c->entries[i].next = (i + 1 < size)? i + 1: -1;
+	}
+	c->size = size;
+	c->head = c->tail = -1;
+	c->stats.size = size;
+	anal->opcache = c;
+	return true;
+}
+
+// Drop the instructions overlapping [addr, addr + size)
+R_API void r_anal_opcache_invalidate(RAnal *anal, ut64 addr, ut64 size) {
+	r_return_if_fail (anal);
+	RAnalOpCache *c = anal->opcache;
+	if (!c || !c->count || !size) {
+		return;
+	}
+	const ut64 from = (addr > OPCACHE_WINDOW)? addr - OPCACHE_WINDOW: 0;
+	const ut64 to = (UT64_MAX - addr < size)? UT64_MAX: addr + size;
+	if (to - from > (ut64)c->count) {
+		// cheaper to check every entry than every address
+		int i = c->head;
+		while (i != -1) {
+			OpCacheEntry *e = &c->entries[i];
+			const int next = e->next;
+			if (e->addr < to && e->addr + e->op.size > addr) {
+				opcache_remove (c, i);
+			}
+			i = next;
+		}
+		return;
+	}
+	ut64 at;
+	for (at = from; at < to; at++) {
+		int i = (int)(size_t)ht_up_find (c->ht, at, NULL) - 1;
+		while (i != -1) {
+			OpCacheEntry *e = &c->entries[i];
+			const int chain = e->chain;
+			if (e->addr + e->op.size > addr) {
+				opcache_remove (c, i);
+			}
+			i = chain;
+		}
+	}
+}
+
+R_API bool r_anal_opcache_stats(RAnal *anal, RAnalOpCacheStats *stats) {
+	r_return_val_if_fail (anal && stats, false);
+	RAnalOpCache *c = anal->opcache;
+	if (!c) {
+		return false;
+	}
+	*stats = c->stats;
+	stats->count = c->count;
+	return true;
+}
+
+R_API void r_anal_opcache_reset_stats(RAnal *anal) {
+	r_return_if_fail (anal);
+	RAnalOpCache *c = anal->opcache;
+	if (c) {
+		c->stats.hits = 0;
+		c->stats.misses = 0;
+		c->stats.evictions = 0;
+	}
+}
+
+static const void *opcache_decoder(RAnal *anal) {
+	if (anal->uses == 2 && anal->arch->session) {
+		return anal->arch->session->plugin;
+	}
+	return anal->cur;
+}
+
+// the whole cache is dropped when the arch setup changes
+static void opcache_check_config(RAnalOpCache *c, RAnal *anal) {
+	RArchConfig *cfg = anal->config;
+	const void *decoder = opcache_decoder (anal);
+	if (decoder == c->decoder && cfg->bits == c->bits && cfg->endian == c->endian
+			&& cfg->syntax == c->syntax && (cfg->arch == c->arch || r_str_eq (cfg->arch, c->arch))
+			&& (cfg->cpu == c->cpu || r_str_eq (cfg->cpu, c->cpu))) {
+		return;
+	}
+	r_anal_opcache_flush (anal);
+	c->decoder = decoder;
+	free (c->arch);
+	c->arch = R_STR_DUP (cfg->arch);
+	c->bits = cfg->bits;
+	c->endian = cfg->endian;
+	c->syntax = cfg->syntax;
+	free (c->cpu);
+	c->cpu = R_STR_DUP (cfg->cpu);
+}
+
+static OpCacheEntry *opcache_find(RAnalOpCache *c, RAnal *anal, ut64 addr, const ut8 *data, int len, RAnalOpMask mask) {
+	const void *decoder = opcache_decoder (anal);
+	const int bits = anal->config->bits;
+	len = R_MIN (len, OPCACHE_WINDOW);
+	mask &= ~R_ARCH_OP_MASK_HINT;
+	int i = (int)(size_t)ht_up_find (c->ht, addr, NULL) - 1;
+	while (i != -1) {
+		OpCacheEntry *e = &c->entries[i];
+		if (e->decoder == decoder && e->bits == bits && e->mask == mask
+				&& e->len == len && !memcmp (e->buf, data, len)) {
+			return e;
+		}
+		i = e->chain;
+	}
+	return NULL;
+}
+
+// the register names are borrowed from the decoders, which can be unloaded
+// while the op is cached, so the cached ones point to the anal constpool
+static void op_pool_value(RAnal *anal, RArchValue *v) {
+	v->reg = v->reg? r_str_constpool_get (&anal->constpool, v->reg): NULL;
+	v->regdelta = v->regdelta? r_str_constpool_get (&anal->constpool, v->regdelta): NULL;
+	v->seg = v->seg? r_str_constpool_get (&anal->constpool, v->seg): NULL;
+}
+
+static void op_pool_regs(RAnal *anal, RAnalOp *op) {
+	op->reg = op->reg? r_str_constpool_get (&anal->constpool, op->reg): NULL;
+	op->ireg = op->ireg? r_str_constpool_get (&anal->constpool, op->ireg): NULL;
+	RArchValue *v;
+	r_vector_foreach (&op->srcs, v) {
+		op_pool_value (anal, v);
+	}
+	r_vector_foreach (&op->dsts, v) {
+		op_pool_value (anal, v);
+	}
+	if (op->access) {
+		RListIter *iter;
+		r_list_foreach (op->access, iter, v) {
+			op_pool_value (anal, v);
+		}
+	}
+}
+
+// the strings and the lists are duplicated, the register names are shared
+static void op_copy(RAnalOp *dst, RAnalOp *src, const ut8 *data, int len) {
+	*dst = *src;
+	dst->mnemonic = R_STR_DUP (src->mnemonic);
+	dst->weakbytes = false;
+	dst->bytes = data? r_mem_dup (data, len): NULL;
+	r_vector_copy (&dst->srcs, &src->srcs);
+	r_vector_copy (&dst->dsts, &src->dsts);
+	if (src->access) {
+		RListIter *iter;
+		RArchValue *val;
+		dst->access = r_list_newf ((RListFree)r_anal_value_free);
+		r_list_foreach (src->access, iter, val) {
+			r_list_append (dst->access, r_anal_value_clone (val));
+		}
+	}
+	r_strbuf_init (&dst->esil);
+	r_strbuf_copy (&dst->esil, &src->esil);
+	r_strbuf_init (&dst->opex);
+	r_strbuf_copy (&dst->opex, &src->opex);
+}
+
+// returns the size of the cached instruction or 0
+static int opcache_get(RAnal *anal, RAnalOp *op, ut64 addr, const ut8 *data, int len, RAnalOpMask mask) {
+	RAnalOpCache *c = anal->opcache;
+	opcache_check_config (c, anal);
+	OpCacheEntry *e = opcache_find (c, anal, addr, data, len, mask);
+	if (!e) {
+		c->stats.misses++;
+		return 0;
+	}
+	c->stats.hits++;
+	int i = e - c->entries;
+	if (c->head != i) {
+		opcache_unlink (c, i);
+		opcache_link (c, i);
+	}
+	r_anal_op_fini (op);
+	op_copy (op, &e->op, e->hasbytes? data: NULL, len);
+	return e->ret;
+}
+
+static void opcache_put(RAnal *anal, RAnalOp *op, int ret, ut64 addr, const ut8 *data, int len, RAnalOpMask mask) {
+	RAnalOpCache *c = anal->opcache;
+	if (op->size > OPCACHE_WINDOW || op->switch_op) {
+		// the decoder looked further than the bytes kept to compare
+		return;
+	}
+	ut64 *seen = &c->seen[(addr ^ (addr >> 16)) % c->size];
+	if (*seen != addr) {
+		*seen = addr;
+		return;
+	}
+	if (c->free == -1) {
+		opcache_remove (c, c->tail);
+		c->stats.evictions++;
+	}
+	int i = c->free;
+	OpCacheEntry *e = &c->entries[i];
+	c->free = e->next;
+	e->addr = addr;
+	e->decoder = opcache_decoder (anal);
+	e->bits = anal->config->bits;
+	e->mask = mask & ~R_ARCH_OP_MASK_HINT;
+	e->len = R_MIN (len, OPCACHE_WINDOW);
+	memcpy (e->buf, data, e->len);
+	e->hasbytes = op->bytes != NULL;
+	e->ret = ret;
+	op_copy (&e->op, op, NULL, 0);
+	op_pool_regs (anal, &e->op);
+	int first = (int)(size_t)ht_up_find (c->ht, addr, NULL) - 1;
+	e->chain = first;
+	ht_up_update (c->ht, addr, (void *)(size_t)(i + 1));
+	opcache_link (c, i);
+	c->count++;
+}
+
 // R2_590 data and len are contained inside RAnalOp. those args must disapear same for addr.. and then we get r_arch_op xD
 R_API int r_anal_op(RAnal *anal, RAnalOp *op, ut64 addr, const ut8 *data, int len, RAnalOpMask mask) {
 	r_return_val_if_fail (anal && op && len > 0, -1);
@@ -175,7 +528,15 @@ R_API int r_anal_op(RAnal *anal, RAnalOp *op, ut64 addr, const ut8 *data, int le
 		return -1;
 	}
 	int ret = R_MIN (2, len);
-	if (len > 0 && anal->uses == 2 && anal->arch->session) {
+	bool decoded = false;
+	int cached = anal->opcache? opcache_get (anal, op, addr, data, len, mask): 0;
+	if (cached > 0) {
+		ret = cached;
+	} else if (anal->prefetch && r_anal_prefetch_get (anal, op, addr, data, len, mask)) {
+		ret = op->size;
+		decoded = true;
+	} else if (len > 0 && anal->uses == 2 && anal->arch->session) {
+		decoded = true;
 		r_anal_op_set_bytes (op, addr, data, len);
 		if (!r_arch_decode (anal->arch, op, mask) || op->size <= 0) {
 			op->type = R_ANAL_OP_TYPE_ILL;
@@ -204,6 +565,7 @@ R_API int r_anal_op(RAnal *anal, RAnalOp *op, ut64 addr, const ut8 *data, int le
 			op->nopcode = 1;
 		}
 	} else if (len > 0 && anal->cur && anal->cur->op) {
+		decoded = true;
 		ret = anal->cur->op (anal, op, addr, data, len, mask);
 		if (ret < 1) {
 			op->type = R_ANAL_OP_TYPE_ILL;
@@ -232,6 +594,9 @@ R_API int r_anal_op(RAnal *anal, RAnalOp *op, ut64 addr, const ut8 *data, int le
 			R_LOG_WARN ("unhandled R_ARCH_OP_MASK_DISASM in r_anal_op");
 		}
 	}
+	if (decoded && ret > 0 && anal->opcache) {
+		opcache_put (anal, op, ret, addr, data, len, mask);
+	}
 	if (mask & R_ARCH_OP_MASK_HINT) {
 		RAnalHint *hint = r_anal_hint_get (anal, addr);
 		if (hint) {
@@ -0,0 +1,404 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+#define R_LOG_ORIGIN "anal.prefetch"
+
+#include <r_anal.h>
+
+// Decode ahead the code reachable from a list of entrypoints in the workers of
+// anal->pool, with one arch session per task. The analysis is still done by
+// the calling thread, the decoded instructions are kept in a table that
+// r_anal_op consumes as long as the bytes, the mask and the arch config are
+// the same ones, so the result is the same as a sequential run. Only plugins
+// flagged as threadsafe are used (riscv, v810, v850 and msp430 for now).
+
+#define PREFETCH_WINDOW 32 // same buffer size used by fcn_recurse
+#define PREFETCH_MASK (R_ARCH_OP_MASK_BASIC | R_ARCH_OP_MASK_ESIL | R_ARCH_OP_MASK_VAL)
+#define PREFETCH_MAX_OPS (256 * 1024)
+#define PREFETCH_PAGE 4096
+#define PREFETCH_SHARDS 16
+
+typedef struct {
+	RAnalOp op;
+	ut8 buf[PREFETCH_WINDOW];
+} PrefetchOp;
+
+struct r_anal_prefetch_t {
+	HtUP *ops; // addr => PrefetchOp
+	RArchPlugin *plugin;
+	RArchConfig *config;
+	int bits;
+	ut32 endian;
+	int syntax;
+	char *cpu;
+};
+
+typedef struct {
+	RThreadLock *lock;
+	SetU *set;
+} PrefetchShard;
+
+typedef struct {
+	RAnal *anal;
+	RThreadLock *lock; // guards the queue, the counters and the io reads
+	RThreadCond *cond;
+	RVector queue; // ut64
+	bool calls;
+	int busy;
+	int nops;
+	PrefetchShard shards[PREFETCH_SHARDS];
+} PrefetchJob;
+
+typedef struct {
+	PrefetchJob *job;
+	RArchSession *session;
+	RPVector ops; // PrefetchOp
+	ut8 page[PREFETCH_PAGE];
+	ut64 page_addr;
+	int page_len;
+} PrefetchWorker;
+
+static void prefetch_op_free(HtUPKv *kv) {
+	PrefetchOp *p = kv->value;
+	r_anal_op_fini (&p->op);
+	free (p);
+}
+
+// returns false if the address was visited already
+static bool visit(PrefetchJob *job, ut64 addr) {
+	PrefetchShard *shard = &job->shards[(addr >> 2) % PREFETCH_SHARDS];
+	bool res = false;
+	r_th_lock_enter (shard->lock);
+	if (!set_u_contains (shard->set, addr)) {
+		set_u_add (shard->set, addr);
+		res = true;
+	}
+	r_th_lock_leave (shard->lock);
+	return res;
+}
+
+static void push(PrefetchJob *job, ut64 addr) {
+	if (addr == UT64_MAX) {
+		return;
+	}
+	r_th_lock_enter (job->lock);
+	if (job->nops < PREFETCH_MAX_OPS) {
+		r_vector_push (&job->queue, &addr);
+		r_th_cond_signal (job->cond);
+	}
+	r_th_lock_leave (job->lock);
+}
+
+static const ut8 *worker_read(PrefetchWorker *w, ut64 addr) {
+	// no sums of addresses, branches can target the end of the address space
+	if (addr < w->page_addr || addr - w->page_addr + PREFETCH_WINDOW > w->page_len) {
+		RAnal *anal = w->job->anal;
+		r_th_lock_enter (w->job->lock);
+		bool ok = anal->iob.read_at (anal->iob.io, addr, w->page, PREFETCH_PAGE);
+		r_th_lock_leave (w->job->lock);
+		if (!ok) {
+			w->page_len = 0;
+			return NULL;
+		}
+		w->page_addr = addr;
+		w->page_len = PREFETCH_PAGE;
+	}
+	return w->page + (addr - w->page_addr);
+}
+
+static bool is_invalid(const ut8 *buf) {
+	int i;
+	for (i = 0; i < PREFETCH_WINDOW; i++) {
+		if (buf[i] != 0xff) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// linear sweep until the end of the block, branch targets are queued
+static void worker_walk(PrefetchWorker *w, ut64 addr) {
+	PrefetchJob *job = w->job;
+	RAnal *anal = job->anal;
+	const int pcalign = anal->config->pcalign;
+	int delay = -1;
+	while (delay != 0) {
+		if (anal->limit && anal->limit->to <= addr) {
+			break;
+		}
+		if ((pcalign > 1 && (addr % pcalign)) || r_anal_get_block_at (anal, addr)) {
+			break;
+		}
+		if (!visit (job, addr)) {
+			break;
+		}
+		const ut8 *buf = worker_read (w, addr);
+		if (!buf || is_invalid (buf)) {
+			break;
+		}
+		PrefetchOp *p = R_NEW (PrefetchOp);
+		if (!p) {
+			break;
+		}
+		RAnalOp *op = &p->op;
+		memcpy (p->buf, buf, PREFETCH_WINDOW);
+		r_anal_op_init (op);
+		r_anal_op_set_bytes (op, addr, buf, PREFETCH_WINDOW);
+		if (!r_arch_session_decode (w->session, op, PREFETCH_MASK) || op->size <= 0 || op->switch_op) {
+			r_anal_op_fini (op);
+			free (p);
+			break;
+		}
+		op->addr = addr;
+		if (op->nopcode < 1) {
+			op->nopcode = 1;
+		}
+		r_pvector_push (&w->ops, p);
+		r_th_lock_enter (job->lock);
+		bool full = ++job->nops >= PREFETCH_MAX_OPS;
+		r_th_lock_leave (job->lock);
+		if (full) {
+			break;
+		}
+		addr += op->size;
+		if (delay > 0) {
+			delay--;
+			continue;
+		}
+		switch (op->type) {
+		case R_ANAL_OP_TYPE_CALL:
+			// otherwise every batch would walk the whole callgraph again
+			if (job->calls) {
+				push (job, op->jump);
+			}
+			break;
+		case R_ANAL_OP_TYPE_CJMP:
+			push (job, op->jump);
+			break;
+		case R_ANAL_OP_TYPE_JMP:
+			push (job, op->jump);
+			delay = op->delay;
+			break;
+		case R_ANAL_OP_TYPE_RET:
+		case R_ANAL_OP_TYPE_UJMP:
+		case R_ANAL_OP_TYPE_RJMP:
+		case R_ANAL_OP_TYPE_IJMP:
+		case R_ANAL_OP_TYPE_IRJMP:
+		case R_ANAL_OP_TYPE_MJMP:
+			delay = op->delay;
+			break;
+		case R_ANAL_OP_TYPE_ILL:
+		case R_ANAL_OP_TYPE_TRAP:
+			delay = 0;
+			break;
+		}
+	}
+}
+
+static void worker_run(PrefetchWorker *w) {
+	PrefetchJob *job = w->job;
+	r_th_lock_enter (job->lock);
+	while (true) {
+		while (r_vector_empty (&job->queue) && job->busy > 0) {
+			r_th_cond_wait (job->cond, job->lock);
+		}
+		if (r_vector_empty (&job->queue)) {
+			// nothing queued and nobody can queue more
+			r_th_cond_signal_all (job->cond);
+			break;
+		}
+		ut64 addr;
+		r_vector_pop (&job->queue, &addr);
+		job->busy++;
+		r_th_lock_leave (job->lock);
+		worker_walk (w, addr);
+		r_th_lock_enter (job->lock);
+		job->busy--;
+	}
+	r_th_lock_leave (job->lock);
+}
+
+// a worker only waits while another one is walking a block, so the tasks
+// that start late or run in the waiting thread find the queue drained
+static void worker_range(void *user, size_t from, size_t to) {
+	PrefetchWorker *workers = user;
+	size_t i;
+	for (i = from; i < to; i++) {
+		if (workers[i].session) {
+			worker_run (&workers[i]);
+		}
+	}
+}
+
+static RArchSession *session_new(RArchSession *as) {
+	return r_arch_session (as->arch, as->config, as->plugin);
+}
+
+static void session_free(RArchSession *s) {
+	if (s) {
+		RArchPluginFiniCallback fini = s->plugin->fini;
+		if (fini) {
+			fini (s);
+		}
+		free (s);
+	}
+}
+
+static bool job_init(PrefetchJob *job, RAnal *anal) {
+	int i;
+	job->anal = anal;
+	job->lock = r_th_lock_new (false);
+	job->cond = r_th_cond_new ();
+	r_vector_init (&job->queue, sizeof (ut64), NULL, NULL);
+	if (!job->lock || !job->cond) {
+		return false;
+	}
+	for (i = 0; i < PREFETCH_SHARDS; i++) {
+		job->shards[i].lock = r_th_lock_new (false);
+		job->shards[i].set = set_u_new ();
+		if (!job->shards[i].lock || !job->shards[i].set) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void job_fini(PrefetchJob *job) {
+	int i;
+	for (i = 0; i < PREFETCH_SHARDS; i++) {
+		r_th_lock_free (job->shards[i].lock);
+		set_u_free (job->shards[i].set);
+	}
+	r_vector_fini (&job->queue);
+	r_th_cond_free (job->cond);
+	r_th_lock_free (job->lock);
+}
+
+static RAnalPrefetch *prefetch_new(RArchSession *as) {
+	RAnalPrefetch *pf = R_NEW0 (RAnalPrefetch);
+	if (!pf) {
+		return NULL;
+	}
+	pf->ops = ht_up_new (NULL, prefetch_op_free, NULL);
+	if (!pf->ops) {
+		free (pf);
+		return NULL;
+	}
+	pf->plugin = as->plugin;
+	pf->config = as->config;
+	pf->bits = as->config->bits;
+	pf->endian = as->config->endian;
+	pf->syntax = as->config->syntax;
+	pf->cpu = R_STR_DUP (as->config->cpu);
+	return pf;
+}
+
+// the current session must be decoding with the same setup used by the workers
+static bool prefetch_matches(RAnalPrefetch *pf, RArchSession *as) {
+	if (!as || as->plugin != pf->plugin || as->config != pf->config) {
+		return false;
+	}
+	RArchConfig *cfg = as->config;
+	return cfg->bits == pf->bits && cfg->endian == pf->endian
+		&& cfg->syntax == pf->syntax && (cfg->cpu == pf->cpu || r_str_eq (cfg->cpu, pf->cpu));
+}
+
+R_API bool r_anal_prefetch_supported(RAnal *anal) {
+	r_return_val_if_fail (anal, false);
+	RArchSession *as = R_UNWRAP3 (anal, arch, session);
+	return anal->uses == 2 && as && as->plugin->threadsafe && as->config;
+}
+
+// Decode the code reachable from addrs with at most threads workers of
+// anal->pool (0: all of them) and keep the instructions for r_anal_op,
+// returns the amount of decoded ops
+R_API int r_anal_prefetch(RAnal *anal, const ut64 *addrs, int count, int threads, bool calls) {
+	r_return_val_if_fail (anal && (addrs || !count), -1);
+	if (!r_anal_prefetch_supported (anal) || !anal->iob.read_at) {
+		return -1;
+	}
+	RArchSession *as = anal->arch->session;
+	if (anal->prefetch && !prefetch_matches (anal->prefetch, as)) {
+		r_anal_prefetch_clear (anal);
+	}
+	if (!anal->prefetch) {
+		anal->prefetch = prefetch_new (as);
+		if (!anal->prefetch) {
+			return -1;
+		}
+	}
+	RThreadPool *pool = anal->pool;
+	const int size = pool? R_MAX (pool->size, 1): 1;
+	threads = (threads > 0)? R_MIN (threads, size): size;
+	PrefetchJob job = {0};
+	PrefetchWorker *workers = R_NEWS0 (PrefetchWorker, threads);
+	int i, n = 0;
+	if (!workers || !job_init (&job, anal)) {
+		goto beach;
+	}
+	job.calls = calls;
+	// pop takes the last one, queue them backwards to start from the first
+	for (i = count - 1; i >= 0; i--) {
+		r_vector_push (&job.queue, (void *)&addrs[i]);
+	}
+	for (i = 0; i < threads; i++) {
+		PrefetchWorker *w = &workers[i];
+		w->job = &job;
+		w->session = session_new (as);
+		r_pvector_init (&w->ops, NULL);
+	}
+	r_th_parallel_for (pool, 0, threads, 1, worker_range, workers);
+	HtUP *ht = anal->prefetch->ops;
+	for (i = 0; i < threads; i++) {
+		PrefetchWorker *w = &workers[i];
+		void **it;
+		r_pvector_foreach (&w->ops, it) {
+			PrefetchOp *p = *it;
+			if (ht_up_insert (ht, p->op.addr, p)) {
+				n++;
+			} else {
+				r_anal_op_fini (&p->op);
+				free (p);
+			}
+		}
+		r_pvector_fini (&w->ops);
+		session_free (w->session);
+	}
+	R_LOG_DEBUG ("%d instructions decoded with %d threads", n, threads);
+beach:
+	job_fini (&job);
+	free (workers);
+	return n;
+}
+
+R_API void r_anal_prefetch_clear(RAnal *anal) {
+	r_return_if_fail (anal);
+	RAnalPrefetch *pf = anal->prefetch;
+	if (pf) {
+		ht_up_free (pf->ops);
+		free (pf->cpu);
+		free (pf);
+		anal->prefetch = NULL;
+	}
+}
+
+// Fill op with the prefetched instruction at addr if it was decoded from the
+// same bytes, returns false when it must be decoded as usual
+R_API bool r_anal_prefetch_get(RAnal *anal, RAnalOp *op, ut64 addr, const ut8 *data, int len, RAnalOpMask mask) {
+	RAnalPrefetch *pf = anal->prefetch;
+	if (!pf || len != PREFETCH_WINDOW || (mask & ~R_ARCH_OP_MASK_HINT) != PREFETCH_MASK) {
+		return false;
+	}
+	PrefetchOp *p = ht_up_find (pf->ops, addr, NULL);
+	if (!p || memcmp (p->buf, data, PREFETCH_WINDOW)) {
+		return false;
+	}
+	if (!prefetch_matches (pf, anal->arch->session)) {
+		return false;
+	}
+	// the instruction is moved out, decoding it again is rare enough
+	r_anal_op_fini (op);
+	*op = p->op;
+	r_anal_op_init (&p->op);
+	ht_up_delete (pf->ops, addr);
+	return true;
+}
@@ -824,6 +824,61 @@ static RSignBytes *r_sign_fcn_bytes(RAnal *a, RAnalFunction *fcn) {
 	return sig;
 }
 
+static int cmpaddr(const void *_a, const void *_b) {
+	const RAnalBlock *a = _a, *b = _b;
+	return (a->addr - b->addr);
+}
+
+// bytes of every block of the function, sorted by the caller
+static ut8 *bbhash_read(RAnal *a, RAnalFunction *fcn) {
+	RListIter *iter;
+	RAnalBlock *bb;
+	ut64 size = 0;
+	r_list_foreach (fcn->bbs, iter, bb) {
+		size += bb->size;
+	}
+	ut8 *buf = malloc (size + 1);
+	if (!buf) {
+		return NULL;
+	}
+	ut8 *p = buf;
+	r_list_foreach (fcn->bbs, iter, bb) {
+		if (!a->iob.read_at (a->iob.io, bb->addr, p, bb->size)) {
+			free (buf);
+			return NULL;
+		}
+		p += bb->size;
+	}
+	return buf;
+}
+
+// does not touch the function or the io, it is safe to run from the workers
+static char *bbhash_digest(RAnalFunction *fcn, const ut8 *buf) {
+	RHash *ctx = r_hash_new (true, R_ZIGN_HASH);
+	if (!ctx) {
+		return NULL;
+	}
+	RListIter *iter;
+	RAnalBlock *bb;
+	r_hash_do_begin (ctx, R_ZIGN_HASH);
+	r_list_foreach (fcn->bbs, iter, bb) {
+		r_hash_do_sha256 (ctx, buf, bb->size);
+		buf += bb->size;
+	}
+	r_hash_do_end (ctx, R_ZIGN_HASH);
+	char *digest_hex = r_hex_bin2strdup (ctx->digest, r_hash_size (R_ZIGN_HASH));
+	r_hash_free (ctx);
+	return digest_hex;
+}
+
+R_API char *r_sign_calc_bbhash(RAnal *a, RAnalFunction *fcn) {
+	r_list_sort (fcn->bbs, &cmpaddr);
+	ut8 *buf = bbhash_read (a, fcn);
+	char *digest_hex = buf? bbhash_digest (fcn, buf): NULL;
+	free (buf);
+	return digest_hex;
+}
+
 static RSignHash *r_sign_fcn_bbhash(RAnal *a, RAnalFunction *fcn) {
 	r_return_val_if_fail (a && fcn, NULL);
 	RSignHash *hash = R_NEW0 (RSignHash);
@@ -840,7 +895,8 @@ static RSignHash *r_sign_fcn_bbhash(RAnal *a, RAnalFunction *fcn) {
 	return hash;
 }
 
-static RSignItem *item_from_func(RAnal *a, RAnalFunction *fcn, const char *name) {
+// every metric but the bbhash, which zg computes later in the workers
+static RSignItem *item_from_func_nohash(RAnal *a, RAnalFunction *fcn, const char *name) {
 	if (r_list_empty (fcn->bbs)) {
 		R_LOG_WARN ("Function with no basic blocks at 0x%08"PFMT64x, fcn->addr);
 		return false;
@@ -853,13 +909,20 @@ static RSignItem *item_from_func(RAnal *a, RAnalFunction *fcn, const char *name)
 		r_sign_addto_item (a, it, fcn, R_SIGN_REFS);
 		r_sign_addto_item (a, it, fcn, R_SIGN_VARS);
 		r_sign_addto_item (a, it, fcn, R_SIGN_TYPES);
-		r_sign_addto_item (a, it, fcn, R_SIGN_BBHASH);
 		r_sign_addto_item (a, it, fcn, R_SIGN_OFFSET);
 		r_sign_addto_item (a, it, fcn, R_SIGN_NAME);
 	}
 	return it;
 }
 
+static RSignItem *item_from_func(RAnal *a, RAnalFunction *fcn, const char *name) {
+	RSignItem *it = item_from_func_nohash (a, fcn, name);
+	if (it) {
+		r_sign_addto_item (a, it, fcn, R_SIGN_BBHASH);
+	}
+	return it;
+}
+
 static int fcn_sort(const void *va, const void *vb) {
 	ut64 a = ((const RAnalFunction *)va)->addr;
 	ut64 b = ((const RAnalFunction *)vb)->addr;
@@ -908,44 +971,167 @@ static char *real_function_name(RAnal *a, ut64 addr, const char *name) {
 	return strdup (name);
 }
 
+#define SIGN_BATCH 1024
+
+// workers of the shared pool used for n items, zign.threads bounds them
+// with the grain (0: all of them, 1: no threads), also used by flirt
+R_IPI RThreadPool *r_sign_pool(RAnal *a, size_t n, size_t *grain) {
+	int threads = 1;
+	if (a->coreb.core && a->coreb.cfggeti) {
+		threads = a->coreb.cfggeti (a->coreb.core, "zign.threads");
+	}
+	*grain = (threads > 1)? (n + threads - 1) / threads: 0;
+	return (threads != 1)? a->pool: NULL;
+}
+
+typedef struct {
+	RAnalFunction *fcn;
+	RSignItem *it;
+	ut8 *bbbuf; // block bytes for the bbhash, NULL if they could not be read
+	char *key; // NULL if the item is not valid
+	char *value;
+} SignGenJob;
+
+typedef struct {
+	RAnal *anal;
+	SignGenJob *jobs;
+	size_t n;
+	HtPP *pending; // keys of the batch that are not in the sdb yet
+} SignGen;
+
+static void sign_gen_range(void *user, size_t from, size_t to) {
+	SignGenJob *jobs = user;
+	size_t i;
+	for (i = from; i < to; i++) {
+		SignGenJob *job = &jobs[i];
+		if (!job->key) {
+			continue;
+		}
+		if (job->bbbuf) {
+			char *digest = bbhash_digest (job->fcn, job->bbbuf);
+			if (digest && (job->it->hash = R_NEW0 (RSignHash))) {
+				job->it->hash->bbhash = digest;
+			} else {
+				free (digest);
+			}
+		}
+		job->value = serialize_value (job->it);
+	}
+}
+
+// hash and serialize the batch in the workers and store it in order
+static void sign_gen_flush(SignGen *g) {
+	size_t grain;
+	RThreadPool *pool = r_sign_pool (g->anal, g->n, &grain);
+	r_th_parallel_for (pool, 0, g->n, grain, sign_gen_range, g->jobs);
+	size_t i;
+	for (i = 0; i < g->n; i++) {
+		SignGenJob *job = &g->jobs[i];
+		if (job->key && sdb_exists (g->anal->sdb_zigns, job->key)) {
+			r_sign_add_item (g->anal, job->it);
+		} else if (job->key && job->value) {
+			sdb_set (g->anal->sdb_zigns, job->key, job->value, 0);
+		}
+		if (job->key) {
+			ht_pp_delete (g->pending, job->key);
+		}
+		r_sign_item_free (job->it);
+		free (job->bbbuf);
+		free (job->key);
+		free (job->value);
+	}
+	memset (g->jobs, 0, g->n * sizeof (SignGenJob));
+	g->n = 0;
+}
+
+static bool name_pending(SignGen *g, const char *n, const RSpace *sp) {
+	char *key = space_serialize_key (sp, n);
+	bool found = false;
+	if (key) {
+		ht_pp_find (g->pending, key, &found);
+		free (key);
+	}
+	return found;
+}
+
+static char *sign_gen_name(SignGen *g, RAnalFunction *fcn, const RSpace *sp, bool merge) {
+	RAnal *a = g->anal;
+	char *realname = real_function_name (a, fcn->addr, fcn->name);
+	if (merge || !realname) {
+		return realname;
+	}
+	char *name = realname;
+	if (name_exists (a->sdb_zigns, realname, sp)) {
+		name = get_unique_name (a->sdb_zigns, fcn->name, sp);
+	}
+	// the name depends on the zignatures of the batch, store them before looking again
+	if (g->n > 0 && (name_pending (g, realname, sp) || (name && name_pending (g, name, sp)))) {
+		if (name != realname) {
+			free (name);
+		}
+		free (realname);
+		sign_gen_flush (g);
+		return sign_gen_name (g, fcn, sp, merge);
+	}
+	if (name != realname) {
+		free (realname);
+	}
+	return name;
+}
+
 R_API int r_sign_all_functions(RAnal *a, bool merge) {
 	RAnalFunction *fcni = NULL;
 	RListIter *iter = NULL;
 	int count = 0;
 	r_list_sort (a->fcns, fcn_sort);
 	const RSpace *sp = r_spaces_current (&a->zign_spaces);
+	SignGen g = {
+		.anal = a,
+		.jobs = R_NEWS0 (SignGenJob, SIGN_BATCH),
+		.pending = ht_pp_new0 (),
+	};
+	if (!g.jobs || !g.pending) {
+		ht_pp_free (g.pending);
+		free (g.jobs);
+		return 0;
+	}
 	char *prev_name = NULL;
 	r_cons_break_push (NULL, NULL);
+	// the io and the analysis are read here, the workers only hash and serialize
 	r_list_foreach_prev (a->fcns, iter, fcni) {
 		if (r_cons_is_breaked ()) {
 			break;
 		}
-		char *realname = real_function_name (a, fcni->addr, fcni->name);
-		RSignItem *it = NULL;
-		if (merge || !name_exists (a->sdb_zigns, realname, sp)) {
-			it = item_from_func (a, fcni, realname);
-		} else {
-			char *name = get_unique_name (a->sdb_zigns, fcni->name, sp);
-			if (name) {
-				it = item_from_func (a, fcni, name);
-			}
-			free (name);
-			free (realname);
-		}
-		if (it) {
-			if (prev_name) {
-				it->next = prev_name;
-			}
-			prev_name = strdup (it->name);
-			r_sign_add_item (a, it);
-			r_sign_item_free (it);
-			count++;
-		} else {
+		char *name = sign_gen_name (&g, fcni, sp, merge);
+		RSignItem *it = name? item_from_func_nohash (a, fcni, name): NULL;
+		free (name);
+		if (!it) {
 			free (prev_name);
 			prev_name = NULL;
+			continue;
+		}
+		if (prev_name) {
+			it->next = prev_name;
+		}
+		prev_name = strdup (it->name);
+		count++;
+		SignGenJob *job = &g.jobs[g.n++];
+		job->fcn = fcni;
+		job->it = it;
+		r_list_sort (fcni->bbs, &cmpaddr);
+		job->bbbuf = bbhash_read (a, fcni);
+		r_name_filter (it->name, -1);
+		if (validate_item (it) && (job->key = item_serialize_key (it))) {
+			ht_pp_insert (g.pending, job->key, NULL);
+		}
+		if (g.n == SIGN_BATCH) {
+			sign_gen_flush (&g);
 		}
 	}
 	r_cons_break_pop ();
+	sign_gen_flush (&g);
+	ht_pp_free (g.pending);
+	free (g.jobs);
 	free (prev_name);
 	return count;
 }
@@ -1943,42 +2129,6 @@ R_API const char *r_sign_type_to_name(int type) {
 	}
 }
 
-static int cmpaddr(const void *_a, const void *_b) {
-	const RAnalBlock *a = _a, *b = _b;
-	return (a->addr - b->addr);
-}
-
-R_API char *r_sign_calc_bbhash(RAnal *a, RAnalFunction *fcn) {
-	RListIter *iter = NULL;
-	RAnalBlock *bbi = NULL;
-	char *digest_hex = NULL;
-	RHash *ctx = r_hash_new (true, R_ZIGN_HASH);
-	if (!ctx) {
-		goto beach;
-	}
-	r_list_sort (fcn->bbs, &cmpaddr);
-	r_hash_do_begin (ctx, R_ZIGN_HASH);
-	r_list_foreach (fcn->bbs, iter, bbi) {
-		ut8 *buf = malloc (bbi->size);
-		if (!buf) {
-			goto beach;
-		}
-		if (!a->iob.read_at (a->iob.io, bbi->addr, buf, bbi->size)) {
-			goto beach;
-		}
-		if (!r_hash_do_sha256 (ctx, buf, bbi->size)) {
-			goto beach;
-		}
-		free (buf);
-	}
-	r_hash_do_end (ctx, R_ZIGN_HASH);
-
-	digest_hex = r_hex_bin2strdup (ctx->digest, r_hash_size (R_ZIGN_HASH));
-beach:
-	free (ctx);
-	return digest_hex;
-}
-
 static bool countForCB(RSignItem *it, void *user) {
 	(*(int *)user)++;
 	return true;
@@ -2516,14 +2666,11 @@ struct metric_ctx {
 	char *suggest; // holds suggestion for next function match, must be freed
 };
 
-static bool match_metrics(RSignItem *it, struct metric_ctx *ctx) {
-	r_return_val_if_fail (it && ctx, false);
-	RSignSearchMetrics *sm = ctx->sm;
-	RSignItem *fit = ctx->it;
-	RSignType types[R_SIGN_TYPEMAX];
+// bytes, graph, offset and bbhash only depend on the code of the function,
+// so the workers of z/ can compare them before the callbacks run
+static int match_code_metrics(RSignSearchMetrics *sm, RSignItem *it, RSignItem *fit, bool suggest, RSignType *types) {
 	int count = 0;
-
-	if (it->bytes && (it->bytes->size >= sm->minsz || ctx->suggest) && !sig_bytes_diff (it, fit)) {
+	if (it->bytes && (it->bytes->size >= sm->minsz || suggest) && !sig_bytes_diff (it, fit)) {
 		types[count++] = R_SIGN_BYTES;
 	}
 	if (it->graph && it->graph->cc >= sm->mincc && !sig_graph_diff (it, fit)) {
@@ -2535,6 +2682,11 @@ static bool match_metrics(RSignItem *it, struct metric_ctx *ctx) {
 	if (fit->hash && it->hash && !sig_hash_cmp (it->hash, fit->hash)) {
 		types[count++] = R_SIGN_BBHASH;
 	}
+	return count;
+}
+
+static int match_name_metrics(RSignItem *it, RSignItem *fit, RSignType *types) {
+	int count = 0;
 	if (fit->refs && it->refs && !str_list_cmp (it->refs, fit->refs)) {
 		types[count++] = R_SIGN_REFS;
 	}
@@ -2544,7 +2696,11 @@ static bool match_metrics(RSignItem *it, struct metric_ctx *ctx) {
 	if (fit->types && it->types && !strcmp (it->types, fit->types)) {
 		types[count++] = R_SIGN_TYPES;
 	}
+	return count;
+}
 
+static bool match_found(RSignItem *it, struct metric_ctx *ctx, RSignType *types, int count) {
+	RSignSearchMetrics *sm = ctx->sm;
 	bool keep_searching = true;
 	if (count) {
 		RList *col = NULL;
@@ -2570,8 +2726,7 @@ static bool match_metrics(RSignItem *it, struct metric_ctx *ctx) {
 		if (col && r_list_length (col) == 0) {
 			keep_searching = false;
 			// suggest next signature from this match
-			ctx->suggest = it->next;
-			it->next = NULL;
+			ctx->suggest = R_STR_DUP (it->next);
 		}
 		r_list_free (col);
 	} else {
@@ -2581,6 +2736,14 @@ static bool match_metrics(RSignItem *it, struct metric_ctx *ctx) {
 	return keep_searching;
 }
 
+static bool match_metrics(RSignItem *it, struct metric_ctx *ctx) {
+	r_return_val_if_fail (it && ctx, false);
+	RSignType types[R_SIGN_TYPEMAX];
+	int count = match_code_metrics (ctx->sm, it, ctx->it, ctx->suggest != NULL, types);
+	count += match_name_metrics (it, ctx->it, types + count);
+	return match_found (it, ctx, types, count);
+}
+
 static bool _sig_to_vec_cb(RSignItem *it, void *user) {
 	if (it->collisions) {
 		r_list_free (it->collisions);
@@ -2791,27 +2954,711 @@ static inline bool suggest_check(RAnal *a, struct metric_ctx *ctx) {
 	return ret;
 }
 
-R_API int r_sign_metric_search(RAnal *a, RSignSearchMetrics *sm) {
-	r_return_val_if_fail (a && sm, -1);
+// Binary zignature container, written by r_sign_save when the file name ends in
+// .r2z and read by r_sign_load and z/o. The header is followed by one array per
+// field of the items, a table with the deduplicated strings and a blob with the
+// bytes and the masks. Numbers are little endian so the files can be shared,
+// and the file is mapped and walked instead of parsing the text of every item.
+
+#define SIGN_FILE_MAGIC "R2ZG"
+#define SIGN_FILE_VERSION 1
+#define SIGN_FILE_HDRSZ 64
+
+enum {
+	// offsets in the string table, 0 when missing
+	SF_SPACE,
+	SF_NAME,
+	SF_REALNAME,
+	SF_COMMENT,
+	SF_NEXT,
+	SF_TYPES,
+	SF_BBHASH,
+	SF_REFS, // comma separated, like the text format
+	SF_XREFS,
+	SF_COLLISIONS,
+	SF_VARS, // r_anal_var_prot_serialize
+	// graph, only if SF_FLAGS has SF_HAS_GRAPH
+	SF_CC,
+	SF_NBBS,
+	SF_EDGES,
+	SF_EBBS,
+	SF_BBSUM,
+	SF_FLAGS,
+	// offset in the blob of the bytes, the mask follows them
+	SF_BYTES_SIZE,
+	SF_BYTES_OFF,
+	SF_COLS
+};
+
+#define SF_HAS_GRAPH 1
+
+struct r_sign_file_t {
+	RMmap *map;
+	ut32 count;
+	const ut8 *addr; // ut64 column
+	const ut8 *cols[SF_COLS]; // ut32 columns
+	const char *strs;
+	ut64 strsz;
+	const ut8 *blob;
+	ut64 blobsz;
+};
+
+// R_ROUND is not parenthesized
+static inline ut64 sign_file_align(ut64 n) {
+	return R_ROUND (n, 8);
+}
+
+static inline ut64 sign_file_colsz(ut32 count) {
+	return sign_file_align ((ut64)count * 8) + SF_COLS * sign_file_align ((ut64)count * 4);
+}
+
+static inline ut32 sf_u32(const RSignFile *sf, int col, ut32 i) {
+	return r_read_le32 (sf->cols[col] + (ut64)i * 4);
+}
+
+static inline const char *sf_str(const RSignFile *sf, int col, ut32 i) {
+	const ut32 o = sf_u32 (sf, col, i);
+	return (o && o < sf->strsz)? sf->strs + o: NULL;
+}
+
+static bool sign_file_is(const ut8 *buf, ut64 len) {
+	return len >= SIGN_FILE_HDRSZ && !memcmp (buf, SIGN_FILE_MAGIC, 4);
+}
+
+R_API bool r_sign_is_file(const char *file) {
+	r_return_val_if_fail (file, false);
+	int len = 0;
+	char *buf = r_file_exists (file)? r_file_slurp_range (file, 0, SIGN_FILE_HDRSZ, &len): NULL;
+	const bool ret = buf && sign_file_is ((const ut8 *)buf, len);
+	free (buf);
+	return ret;
+}
+
+R_API RSignFile *r_sign_file_open(const char *file) {
+	r_return_val_if_fail (file, NULL);
+	RMmap *m = r_file_exists (file)? r_file_mmap (file, false, 0): NULL;
+	if (!m || !m->buf || !sign_file_is (m->buf, m->len)) {
+		r_file_mmap_free (m);
+		return NULL;
+	}
+	const ut8 *h = m->buf;
+	const ut32 version = r_read_le32 (h + 4);
+	const ut32 count = r_read_le32 (h + 8);
+	const ut32 ncols = r_read_le32 (h + 12);
+	const ut64 strsz = r_read_le64 (h + 16);
+	const ut64 blobsz = r_read_le64 (h + 24);
+	const ut64 colsz = sign_file_colsz (count);
+	if (version != SIGN_FILE_VERSION || ncols != SF_COLS || strsz < 1 || strsz > m->len || blobsz > m->len
+			|| SIGN_FILE_HDRSZ + colsz + strsz + blobsz != (ut64)m->len) {
+		R_LOG_ERROR ("Invalid zignature file %s", file);
+		r_file_mmap_free (m);
+		return NULL;
+	}
+	RSignFile *sf = R_NEW0 (RSignFile);
+	if (!sf) {
+		r_file_mmap_free (m);
+		return NULL;
+	}
+	sf->map = m;
+	sf->count = count;
+	const ut8 *col = h + SIGN_FILE_HDRSZ;
+	sf->addr = col;
+	col += sign_file_align ((ut64)count * 8);
+	int c;
+	for (c = 0; c < SF_COLS; c++) {
+		sf->cols[c] = col;
+		col += sign_file_align ((ut64)count * 4);
+	}
+	sf->strs = (const char *)col;
+	sf->strsz = strsz;
+	sf->blob = col + strsz;
+	sf->blobsz = blobsz;
+	if (sf->strs[strsz - 1]) {
+		R_LOG_ERROR ("Invalid zignature file %s", file);
+		r_sign_file_free (sf);
+		return NULL;
+	}
+	return sf;
+}
+
+R_API void r_sign_file_free(RSignFile *sf) {
+	if (sf) {
+		r_file_mmap_free (sf->map);
+		free (sf);
+	}
+}
+
+R_API ut32 r_sign_file_count(RSignFile *sf) {
+	r_return_val_if_fail (sf, 0);
+	return sf->count;
+}
+
+static RList *sf_list(const char *s) {
+	return s? r_str_split_duplist (s, ",", true): NULL;
+}
+
+// the columns are copied into a new item, the file can be closed after
+R_API RSignItem *r_sign_file_item(RAnal *a, RSignFile *sf, ut32 i) {
+	r_return_val_if_fail (a && sf, NULL);
+	const char *name = (i < sf->count)? sf_str (sf, SF_NAME, i): NULL;
+	const char *space = name? sf_str (sf, SF_SPACE, i): NULL;
+	const char *types = name? sf_str (sf, SF_TYPES, i): NULL;
+	if (!name || strchr (name, '|') || (space && strchr (space, '|'))) {
+		return NULL;
+	}
+	if (types && !types_sig_valid (types)) {
+		R_LOG_ERROR ("Invalid types: ```%s``` in signature for %s", types, name);
+		return NULL;
+	}
+	RSignItem *it = r_sign_item_new ();
+	if (!it || !(it->name = strdup (name))) {
+		r_sign_item_free (it);
+		return NULL;
+	}
+	it->space = r_spaces_add (&a->zign_spaces, space);
+	it->realname = R_STR_DUP (sf_str (sf, SF_REALNAME, i));
+	it->comment = R_STR_DUP (sf_str (sf, SF_COMMENT, i));
+	it->next = R_STR_DUP (sf_str (sf, SF_NEXT, i));
+	it->types = R_STR_DUP (types);
+	it->addr = r_read_le64 (sf->addr + (ut64)i * 8);
+	it->refs = sf_list (sf_str (sf, SF_REFS, i));
+	it->xrefs = sf_list (sf_str (sf, SF_XREFS, i));
+	it->collisions = sf_list (sf_str (sf, SF_COLLISIONS, i));
+	const char *s = sf_str (sf, SF_VARS, i);
+	if (s) {
+		it->vars = r_anal_var_deserialize (s);
+	}
+	if ((s = sf_str (sf, SF_BBHASH, i)) && (it->hash = R_NEW0 (RSignHash))) {
+		it->hash->bbhash = strdup (s);
+	}
+	if ((sf_u32 (sf, SF_FLAGS, i) & SF_HAS_GRAPH) && (it->graph = R_NEW0 (RSignGraph))) {
+		it->graph->cc = (int)sf_u32 (sf, SF_CC, i);
+		it->graph->nbbs = (int)sf_u32 (sf, SF_NBBS, i);
+		it->graph->edges = (int)sf_u32 (sf, SF_EDGES, i);
+		it->graph->ebbs = (int)sf_u32 (sf, SF_EBBS, i);
+		it->graph->bbsum = (int)sf_u32 (sf, SF_BBSUM, i);
+	}
+	const ut64 size = sf_u32 (sf, SF_BYTES_SIZE, i);
+	const ut64 off = sf_u32 (sf, SF_BYTES_OFF, i);
+	if (size > 0 && size < ST32_MAX && off + 2 * size <= sf->blobsz && (it->bytes = R_NEW0 (RSignBytes))) {
+		it->bytes->size = size;
+		it->bytes->bytes = r_mem_dup (sf->blob + off, size);
+		it->bytes->mask = r_mem_dup (sf->blob + off + size, size);
+		if (!it->bytes->bytes || !it->bytes->mask) {
+			r_sign_item_free (it);
+			return NULL;
+		}
+	}
+	return it;
+}
+
+// the callback owns the items, like r_sign_foreach_nofree, filtered by the current space
+static bool sign_file_foreach(RAnal *a, RSignFile *sf, RSignForeachCallback cb, void *user) {
+	const RSpace *sp = r_spaces_current (&a->zign_spaces);
+	ut32 i;
+	for (i = 0; i < sf->count; i++) {
+		RSignItem *it = r_sign_file_item (a, sf, i);
+		if (!it) {
+			R_LOG_ERROR ("cannot read zign %u", i);
+			continue;
+		}
+		if (sp && sp != it->space) {
+			r_sign_item_free (it);
+			continue;
+		}
+		if (!cb (it, user)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// signatures loaded once per search and indexed by every metric, so each
+// function is only compared against the ones that can possibly match it
+typedef struct {
+	ut64 mask; // mask of the first bytes, shared by all the class
+	HtUP *sigs; // masked first bytes => RVector<ut32>
+} SignBytesClass;
+
+typedef struct {
+	RSignSearchMetrics *sm;
+	RPVector *sigs; // RSignItem in r_sign_foreach order
+	HtUP *bytes; // size => RList<SignBytesClass>
+	HtUP *graph; // cc << 32 | nbbs, -1 matches any => RVector<ut32>
+	HtUP *addr;
+	HtPP *bbhash;
+	HtPP *refs;
+	HtPP *vars;
+	HtPP *types;
+	HtPP *names; // item key => RSignItem, to resolve the suggestions of a file
+} SignIndex;
+
+static void bucket_free_up(HtUPKv *kv) {
+	r_vector_free (kv->value);
+}
+
+static void bucket_free_pp(HtPPKv *kv) {
+	free (kv->key);
+	r_vector_free (kv->value);
+}
+
+static void bytes_class_free(SignBytesClass *bc) {
+	if (bc) {
+		ht_up_free (bc->sigs);
+		free (bc);
+	}
+}
+
+static void bytes_classes_free(HtUPKv *kv) {
+	r_list_free (kv->value);
+}
+
+static RVector *bucket_up(HtUP *ht, ut64 k) {
+	RVector *v = ht_up_find (ht, k, NULL);
+	if (!v && (v = r_vector_new (sizeof (ut32), NULL, NULL))) {
+		ht_up_insert (ht, k, v);
+	}
+	return v;
+}
+
+static RVector *bucket_pp(HtPP *ht, const char *k) {
+	RVector *v = ht_pp_find (ht, k, NULL);
+	if (!v && (v = r_vector_new (sizeof (ut32), NULL, NULL))) {
+		ht_pp_insert (ht, k, v);
+	}
+	return v;
+}
+
+static inline ut64 bytes_prefix(const ut8 *b, int size) {
+	ut64 v = 0;
+	memcpy (&v, b, R_MIN (size, sizeof (v)));
+	return v;
+}
+
+static inline ut64 graph_key(int cc, int nbbs) {
+	return ((ut64)(ut32)cc << 32) | (ut32)nbbs;
+}
+
+static char *refs_key(RList *refs) {
+	return r_str_list_join (refs, ",");
+}
+
+static char *vars_key(RList *vars) {
+	RStrBuf *sb = r_strbuf_new ("");
 	RListIter *iter;
+	RAnalVarProt *v;
+	r_list_foreach (vars, iter, v) {
+		r_strbuf_appendf (sb, "%d:%d:%d,", v->kind, v->isarg, v->delta);
+	}
+	return r_strbuf_drain (sb);
+}
+
+static void sign_index_bytes(SignIndex *si, RSignBytes *b, ut32 i) {
+	RList *classes = ht_up_find (si->bytes, b->size, NULL);
+	if (!classes) {
+		classes = r_list_newf ((RListFree)bytes_class_free);
+		ht_up_insert (si->bytes, b->size, classes);
+	}
+	const ut64 mask = bytes_prefix (b->mask, b->size);
+	SignBytesClass *bc;
+	RListIter *iter;
+	r_list_foreach (classes, iter, bc) {
+		if (bc->mask == mask) {
+			break;
+		}
+	}
+	if (!iter) {
+		bc = R_NEW0 (SignBytesClass);
+		if (!bc) {
+			return;
+		}
+		bc->mask = mask;
+		bc->sigs = ht_up_new (NULL, bucket_free_up, NULL);
+		r_list_append (classes, bc);
+	}
+	r_vector_push (bucket_up (bc->sigs, bytes_prefix (b->bytes, b->size) & mask), &i);
+}
+
+static bool sign_index_add(RSignItem *it, void *user) {
+	SignIndex *si = user;
+	RSignSearchMetrics *sm = si->sm;
+	ut32 i = r_pvector_length (si->sigs);
+	if (!r_pvector_push (si->sigs, it)) {
+		r_sign_item_free (it);
+		return false;
+	}
+	if (si->bytes && it->bytes && it->bytes->size >= sm->minsz) {
+		sign_index_bytes (si, it->bytes, i);
+	}
+	if (si->graph && it->graph && it->graph->cc >= sm->mincc) {
+		r_vector_push (bucket_up (si->graph, graph_key (it->graph->cc, it->graph->nbbs)), &i);
+	}
+	if (si->addr && it->addr != UT64_MAX) {
+		r_vector_push (bucket_up (si->addr, it->addr), &i);
+	}
+	if (si->bbhash && it->hash && it->hash->bbhash) {
+		r_vector_push (bucket_pp (si->bbhash, it->hash->bbhash), &i);
+	}
+	if (si->refs && it->refs) {
+		char *k = refs_key (it->refs);
+		r_vector_push (bucket_pp (si->refs, k), &i);
+		free (k);
+	}
+	if (si->vars && it->vars) {
+		char *k = vars_key (it->vars);
+		r_vector_push (bucket_pp (si->vars, k), &i);
+		free (k);
+	}
+	if (si->types && it->types) {
+		r_vector_push (bucket_pp (si->types, it->types), &i);
+	}
+	if (si->names) {
+		char *k = item_serialize_key (it);
+		if (k) {
+			ht_pp_insert (si->names, k, it);
+			free (k);
+		}
+	}
+	return true;
+}
+
+static void sign_index_fini(SignIndex *si) {
+	r_pvector_free (si->sigs);
+	ht_up_free (si->bytes);
+	ht_up_free (si->graph);
+	ht_up_free (si->addr);
+	ht_pp_free (si->bbhash);
+	ht_pp_free (si->refs);
+	ht_pp_free (si->vars);
+	ht_pp_free (si->types);
+	ht_pp_free (si->names);
+}
+
+// only the metrics being searched for are indexed, the function items lack the rest.
+// The signatures come from the zign db or, without parsing them, from a file
+static bool sign_index_init(SignIndex *si, RAnal *a, RSignSearchMetrics *sm, RSignFile *sf) {
+	memset (si, 0, sizeof (SignIndex));
+	si->sm = sm;
+	si->sigs = r_pvector_new ((RPVectorFree)r_sign_item_free);
+	if (type_in_array (sm->stypes, R_SIGN_BYTES)) {
+		si->bytes = ht_up_new (NULL, bytes_classes_free, NULL);
+	}
+	if (type_in_array (sm->stypes, R_SIGN_GRAPH)) {
+		si->graph = ht_up_new (NULL, bucket_free_up, NULL);
+	}
+	if (type_in_array (sm->stypes, R_SIGN_OFFSET)) {
+		si->addr = ht_up_new (NULL, bucket_free_up, NULL);
+	}
+	if (type_in_array (sm->stypes, R_SIGN_BBHASH)) {
+		si->bbhash = ht_pp_new (NULL, bucket_free_pp, NULL);
+	}
+	if (type_in_array (sm->stypes, R_SIGN_REFS)) {
+		si->refs = ht_pp_new (NULL, bucket_free_pp, NULL);
+	}
+	if (type_in_array (sm->stypes, R_SIGN_VARS)) {
+		si->vars = ht_pp_new (NULL, bucket_free_pp, NULL);
+	}
+	if (type_in_array (sm->stypes, R_SIGN_TYPES)) {
+		si->types = ht_pp_new (NULL, bucket_free_pp, NULL);
+	}
+	if (sf && !(si->names = ht_pp_new0 ())) {
+		sign_index_fini (si);
+		return false;
+	}
+	if (!si->sigs || !(sf? sign_file_foreach (a, sf, sign_index_add, si): r_sign_foreach_nofree (a, sign_index_add, si))) {
+		sign_index_fini (si);
+		return false;
+	}
+	return true;
+}
+
+static void cands_add(RVector *cands, RVector *bucket) {
+	ut32 *i;
+	if (bucket) {
+		r_vector_foreach (bucket, i) {
+			r_vector_push (cands, i);
+		}
+	}
+}
+
+static int cand_cmp(const void *a, const void *b) {
+	const ut32 x = *(const ut32 *)a;
+	const ut32 y = *(const ut32 *)b;
+	return (x > y) - (x < y);
+}
+
+// in r_sign_foreach order and without repeated signatures
+static void cands_sort(RVector *cands) {
+	if (cands->len < 2) {
+		return;
+	}
+	ut32 *v = cands->a;
+	qsort (v, cands->len, sizeof (ut32), cand_cmp);
+	size_t i, n = 1;
+	for (i = 1; i < cands->len; i++) {
+		if (v[i] != v[n - 1]) {
+			v[n++] = v[i];
+		}
+	}
+	cands->len = n;
+}
+
+// signatures sharing a code metric key with the function, it only reads the index
+static void sign_index_query_code(SignIndex *si, RSignItem *fit, RVector *cands) {
+	if (si->bytes && fit->bytes) {
+		const RSignBytes *b = fit->bytes;
+		RList *classes = ht_up_find (si->bytes, b->size, NULL);
+		const ut64 prefix = bytes_prefix (b->bytes, b->size);
+		SignBytesClass *bc;
+		RListIter *iter;
+		r_list_foreach (classes, iter, bc) {
+			cands_add (cands, ht_up_find (bc->sigs, prefix & bc->mask, NULL));
+		}
+	}
+	if (si->graph && fit->graph) {
+		const int cc = fit->graph->cc;
+		const int nbbs = fit->graph->nbbs;
+		cands_add (cands, ht_up_find (si->graph, graph_key (cc, nbbs), NULL));
+		cands_add (cands, ht_up_find (si->graph, graph_key (cc, -1), NULL));
+		cands_add (cands, ht_up_find (si->graph, graph_key (-1, nbbs), NULL));
+		cands_add (cands, ht_up_find (si->graph, graph_key (-1, -1), NULL));
+	}
+	if (si->addr && fit->addr != UT64_MAX) {
+		cands_add (cands, ht_up_find (si->addr, fit->addr, NULL));
+	}
+	if (si->bbhash && fit->hash && fit->hash->bbhash) {
+		cands_add (cands, ht_pp_find (si->bbhash, fit->hash->bbhash, NULL));
+	}
+	cands_sort (cands);
+}
+
+static void sign_index_query_names(SignIndex *si, RSignItem *fit, RVector *cands) {
+	if (si->refs && fit->refs) {
+		char *k = refs_key (fit->refs);
+		cands_add (cands, ht_pp_find (si->refs, k, NULL));
+		free (k);
+	}
+	if (si->vars && fit->vars) {
+		char *k = vars_key (fit->vars);
+		cands_add (cands, ht_pp_find (si->vars, k, NULL));
+		free (k);
+	}
+	if (si->types && fit->types) {
+		cands_add (cands, ht_pp_find (si->types, fit->types, NULL));
+	}
+	cands_sort (cands);
+}
+
+static inline bool metric_is_code(RSignType t) {
+	return t == R_SIGN_BYTES || t == R_SIGN_GRAPH || t == R_SIGN_OFFSET || t == R_SIGN_BBHASH;
+}
+
+// code metrics of a signature compared by the workers
+typedef struct {
+	ut32 i;
+	int count;
+	RSignType types[4];
+} SignHit;
+
+typedef struct {
+	RAnalFunction *fcn;
+	RSignItem *it;
+	ut8 *bbbuf; // block bytes for the bbhash, NULL if they could not be read
+	RVector hits; // SignHit sorted by signature
+} SignMatchJob;
+
+typedef struct {
+	SignIndex *si;
+	SignMatchJob *jobs;
+} SignMatch;
+
+// the code metrics are read from the io here, in the calling thread
+static void sign_match_prepare(RSignSearchMetrics *sm, SignMatchJob *job) {
+	RSignItem *it = job->it;
+	RAnalFunction *fcn = job->fcn;
+	RSignType *t;
+	for (t = sm->stypes; *t != R_SIGN_END; t++) {
+		if (*t == R_SIGN_BYTES) {
+			// no need for mask
+			it->bytes = r_sign_func_empty_mask (sm->anal, fcn);
+		} else if (*t == R_SIGN_BBHASH) {
+			r_list_sort (fcn->bbs, &cmpaddr);
+			free (job->bbbuf);
+			job->bbbuf = bbhash_read (sm->anal, fcn);
+		} else if (metric_is_code (*t)) {
+			r_sign_addto_item (sm->anal, it, fcn, *t);
+		}
+	}
+	if (it->graph && it->graph->cc < sm->mincc) {
+		r_sign_graph_free (it->graph);
+		it->graph = NULL;
+	}
+}
+
+static void sign_match_range(void *user, size_t from, size_t to) {
+	SignMatch *m = user;
+	SignIndex *si = m->si;
+	RVector cands;
+	r_vector_init (&cands, sizeof (ut32), NULL, NULL);
+	size_t j;
+	for (j = from; j < to; j++) {
+		SignMatchJob *job = &m->jobs[j];
+		RSignItem *fit = job->it;
+		if (job->bbbuf && !fit->hash) {
+			char *digest = bbhash_digest (job->fcn, job->bbbuf);
+			if (digest && (fit->hash = R_NEW0 (RSignHash))) {
+				fit->hash->bbhash = digest;
+			} else {
+				free (digest);
+			}
+		}
+		r_vector_clear (&cands);
+		sign_index_query_code (si, fit, &cands);
+		ut32 *i;
+		r_vector_foreach (&cands, i) {
+			RSignItem *it = r_pvector_at (si->sigs, *i);
+			SignHit hit = { .i = *i };
+			hit.count = match_code_metrics (si->sm, it, fit, false, hit.types);
+			if (!r_vector_push (&job->hits, &hit)) {
+				break;
+			}
+			// a match without collisions is unique and ends the search
+			if (hit.count > 0 && !it->collisions) {
+				break;
+			}
+		}
+	}
+	r_vector_fini (&cands);
+}
+
+// returns true if you should keep searching
+static bool sign_index_suggest(SignIndex *si, struct metric_ctx *ctx) {
+	if (!si->names) {
+		return suggest_check (si->sm->anal, ctx);
+	}
+	if (ctx->suggest) {
+		RAnal *a = si->sm->anal;
+		char *k = space_serialize_key (r_spaces_current (&a->zign_spaces), ctx->suggest);
+		RSignItem *it = k? ht_pp_find (si->names, k, NULL): NULL;
+		free (k);
+		if (it) {
+			return match_metrics (it, ctx);
+		}
+	}
+	return true;
+}
+
+// callbacks may rename functions, so the rest of the metrics and the matches are done in order
+static bool sign_match_job(SignIndex *si, SignMatchJob *job, struct metric_ctx *ctx, RVector *cands) {
+	RSignSearchMetrics *sm = si->sm;
+	RSignItem *fit = job->it;
+	RSignType *t;
+	for (t = sm->stypes; *t != R_SIGN_END; t++) {
+		if (!metric_is_code (*t)) {
+			r_sign_addto_item (sm->anal, fit, job->fcn, *t);
+		}
+	}
+	ctx->fcn = job->fcn;
+	ctx->it = fit;
+	if (!sign_index_suggest (si, ctx)) {
+		return true;
+	}
+	// a suggestion that did not resolve to a signature
+	R_FREE (ctx->suggest);
+	r_vector_clear (cands);
+	sign_index_query_names (si, fit, cands);
+	SignHit *hits = job->hits.a;
+	ut32 *names = cands->a;
+	size_t h = 0, n = 0;
+	while (h < job->hits.len || n < cands->len) {
+		RSignType types[R_SIGN_TYPEMAX];
+		int count = 0;
+		ut32 i;
+		if (n == cands->len || (h < job->hits.len && hits[h].i <= names[n])) {
+			i = hits[h].i;
+			count = hits[h].count;
+			memcpy (types, hits[h].types, count * sizeof (RSignType));
+			h++;
+			if (n < cands->len && names[n] == i) {
+				n++;
+			}
+		} else {
+			i = names[n++];
+		}
+		RSignItem *it = r_pvector_at (si->sigs, i);
+		count += match_name_metrics (it, fit, types + count);
+		if (!match_found (it, ctx, types, count)) {
+			break;
+		}
+	}
+	return true;
+}
+
+static int sign_metric_search(RAnal *a, RSignSearchMetrics *sm, RSignFile *sf) {
+	SignIndex si;
+	if (!sign_index_init (&si, sm->anal, sm, sf)) {
+		return -1;
+	}
+	SignMatchJob *jobs = R_NEWS0 (SignMatchJob, SIGN_BATCH);
+	if (!jobs) {
+		sign_index_fini (&si);
+		return -1;
+	}
+	SignMatch m = { &si, jobs };
+	RVector cands;
+	r_vector_init (&cands, sizeof (ut32), NULL, NULL);
 	r_list_sort (a->fcns, fcn_sort);
 	r_cons_break_push (NULL, NULL);
 	struct metric_ctx ctx = { 0, NULL, sm, NULL, NULL };
-	r_list_foreach (a->fcns, iter, ctx.fcn) {
-		if (r_cons_is_breaked ()) {
-			break;
+	RListIter *iter = r_list_head (a->fcns);
+	bool breaked = false;
+	while (iter && !breaked) {
+		size_t j, n = 0;
+		for (; iter && n < SIGN_BATCH; iter = iter->n) {
+			SignMatchJob *job = &jobs[n];
+			job->fcn = iter->data;
+			if ((job->it = r_sign_item_new ())) {
+				sign_match_prepare (sm, job);
+				r_vector_init (&job->hits, sizeof (SignHit), NULL, NULL);
+				n++;
+			}
 		}
-		ctx.it = metric_build_item (sm, ctx.fcn);
-		if (ctx.it && suggest_check (sm->anal, &ctx)) {
-			r_sign_foreach (sm->anal, (RSignForeachCallback)match_metrics, (void *)&ctx);
+		size_t grain;
+		RThreadPool *pool = r_sign_pool (a, n, &grain);
+		r_th_parallel_for (pool, 0, n, grain, sign_match_range, &m);
+		for (j = 0; j < n; j++) {
+			SignMatchJob *job = &jobs[j];
+			if (!breaked && r_cons_is_breaked ()) {
+				breaked = true;
+			}
+			if (!breaked) {
+				sign_match_job (&si, job, &ctx, &cands);
+			}
+			r_sign_item_free (job->it);
+			free (job->bbbuf);
+			r_vector_fini (&job->hits);
 		}
-		r_sign_item_free (ctx.it);
+		memset (jobs, 0, n * sizeof (SignMatchJob));
 	}
 	r_cons_break_pop ();
+	r_vector_fini (&cands);
+	free (jobs);
 	free (ctx.suggest);
+	sign_index_fini (&si);
 	return ctx.matched;
 }
 
+R_API int r_sign_metric_search(RAnal *a, RSignSearchMetrics *sm) {
+	r_return_val_if_fail (a && sm, -1);
+	return sign_metric_search (a, sm, NULL);
+}
+
+// match the functions against the zignatures of a file without loading them
+R_API int r_sign_file_search(RAnal *a, RSignFile *sf, RSignSearchMetrics *sm) {
+	r_return_val_if_fail (a && sf && sm, -1);
+	return sign_metric_search (a, sm, sf);
+}
+
 R_API int r_sign_fcn_match_metrics(RSignSearchMetrics *sm, RAnalFunction *fcn) {
 	r_return_val_if_fail (sm && sm->mincc >= 0 && sm->anal && fcn, -1);
 	struct metric_ctx ctx = { 0, metric_build_item (sm, fcn), sm, fcn, NULL };
@@ -2873,25 +3720,29 @@ struct load_sign_data {
 	bool merge;
 };
 
+static void load_item(RAnal *a, RSignItem *it, const char *k, const char *v, bool merge) {
+	if (merge || !name_exists (a->sdb_zigns, it->name, it->space)) {
+		sdb_set (a->sdb_zigns, k, v, 0);
+	} else {
+		char *name = get_unique_name (a->sdb_zigns, it->name, it->space);
+		if (name) {
+			if (!it->realname) {
+				it->realname = it->name;
+			} else {
+				free (it->name);
+			}
+			it->name = name;
+			r_sign_set_item (a->sdb_zigns, it, NULL);
+		}
+	}
+}
+
 static bool loadCB(void *user, const char *k, const char *v) {
 	struct load_sign_data *u = (struct load_sign_data *)user;
 	RAnal *a = u->anal;
 	RSignItem *it = r_sign_item_new ();
 	if (it && r_sign_deserialize (a, it, k, v)) {
-		if (u->merge || !name_exists (a->sdb_zigns, it->name, it->space)) {
-			sdb_set (a->sdb_zigns, k, v, 0);
-		} else {
-			char *name = get_unique_name (a->sdb_zigns, it->name, it->space);
-			if (name) {
-				if (!it->realname) {
-					it->realname = it->name;
-				} else {
-					free (it->name);
-				}
-				it->name = name;
-				r_sign_set_item (a->sdb_zigns, it, NULL);
-			}
-		}
+		load_item (a, it, k, v, u->merge);
 	} else {
 		R_LOG_ERROR ("cannot deserialize zign");
 	}
@@ -2899,6 +3750,171 @@ static bool loadCB(void *user, const char *k, const char *v) {
 	return true;
 }
 
+static bool sign_file_load(RAnal *a, RSignFile *sf, bool merge) {
+	ut32 i;
+	for (i = 0; i < sf->count; i++) {
+		RSignItem *it = r_sign_file_item (a, sf, i);
+		char *k = it? item_serialize_key (it): NULL;
+		char *v = it? serialize_value (it): NULL;
+		if (k && v) {
+			load_item (a, it, k, v, merge);
+		} else {
+			R_LOG_ERROR ("cannot read zign %u", i);
+		}
+		r_sign_item_free (it);
+		free (k);
+		free (v);
+	}
+	return true;
+}
+
+// strings shared by many items, like the spaces, types and refs, are stored once
+static ut32 sign_file_string(HtPU *seen, RStrBuf *sb, const char *s) {
+	if (!s) {
+		return 0;
+	}
+	bool found = false;
+	ut32 o = (ut32)ht_pu_find (seen, s, &found);
+	if (!found) {
+		o = r_strbuf_length (sb);
+		r_strbuf_append_n (sb, s, strlen (s) + 1);
+		ht_pu_insert (seen, s, o);
+	}
+	return o;
+}
+
+static ut32 sign_file_list(HtPU *seen, RStrBuf *sb, RList *l) {
+	if (r_list_empty (l)) {
+		return 0;
+	}
+	char *s = r_str_list_join (l, ",");
+	const ut32 o = sign_file_string (seen, sb, s);
+	free (s);
+	return o;
+}
+
+static bool sign_file_collect(RSignItem *it, void *user) {
+	return r_pvector_push ((RPVector *)user, it)? true: false;
+}
+
+static bool sign_file_write(RAnal *a, const char *file, Sdb *db) {
+	RPVector *items = r_pvector_new ((RPVectorFree)r_sign_item_free);
+	if (!items) {
+		return false;
+	}
+	// every space is saved, as sdb_merge does for the text files
+	Sdb *old = a->sdb_zigns;
+	a->sdb_zigns = db;
+	local_foreach_item (a, sign_file_collect, NULL, false, items);
+	a->sdb_zigns = old;
+	const ut32 count = r_pvector_length (items);
+	const ut64 colsz = sign_file_colsz (count);
+	ut8 *cols = calloc (1, colsz + 1);
+	HtPU *seen = ht_pu_new0 ();
+	RStrBuf *strs = r_strbuf_new (NULL);
+	RStrBuf *blob = r_strbuf_new (NULL);
+	bool ret = false;
+	if (!cols || !seen || !strs || !blob) {
+		goto beach;
+	}
+	r_strbuf_append_n (strs, "", 1); // offset 0 is NULL
+	ut8 *col[SF_COLS];
+	int c;
+	for (c = 0; c < SF_COLS; c++) {
+		col[c] = cols + sign_file_align ((ut64)count * 8) + c * sign_file_align ((ut64)count * 4);
+	}
+	ut32 i;
+	for (i = 0; i < count; i++) {
+		RSignItem *it = r_pvector_at (items, i);
+		ut32 v[SF_COLS] = {0};
+		v[SF_SPACE] = sign_file_string (seen, strs, it->space? it->space->name: NULL);
+		v[SF_NAME] = sign_file_string (seen, strs, it->name);
+		v[SF_REALNAME] = sign_file_string (seen, strs, it->realname);
+		v[SF_COMMENT] = sign_file_string (seen, strs, it->comment);
+		v[SF_NEXT] = sign_file_string (seen, strs, it->next);
+		v[SF_TYPES] = sign_file_string (seen, strs, it->types);
+		v[SF_BBHASH] = sign_file_string (seen, strs, it->hash? it->hash->bbhash: NULL);
+		v[SF_REFS] = sign_file_list (seen, strs, it->refs);
+		v[SF_XREFS] = sign_file_list (seen, strs, it->xrefs);
+		v[SF_COLLISIONS] = sign_file_list (seen, strs, it->collisions);
+		if (!r_list_empty (it->vars)) {
+			char *vars = r_anal_var_prot_serialize (it->vars, false);
+			v[SF_VARS] = sign_file_string (seen, strs, vars);
+			free (vars);
+		}
+		if (it->graph) {
+			v[SF_CC] = it->graph->cc;
+			v[SF_NBBS] = it->graph->nbbs;
+			v[SF_EDGES] = it->graph->edges;
+			v[SF_EBBS] = it->graph->ebbs;
+			v[SF_BBSUM] = it->graph->bbsum;
+			v[SF_FLAGS] |= SF_HAS_GRAPH;
+		}
+		RSignBytes *b = it->bytes;
+		if (b && b->bytes && b->mask && b->size > 0) {
+			v[SF_BYTES_SIZE] = b->size;
+			v[SF_BYTES_OFF] = r_strbuf_length (blob);
+			r_strbuf_append_n (blob, (const char *)b->bytes, b->size);
+			r_strbuf_append_n (blob, (const char *)b->mask, b->size);
+		}
+		r_write_le64 (cols + (ut64)i * 8, it->addr);
+		for (c = 0; c < SF_COLS; c++) {
+			r_write_le32 (col[c] + (ut64)i * 4, v[c]);
+		}
+	}
+	const ut64 strsz = r_strbuf_length (strs);
+	const ut64 blobsz = r_strbuf_length (blob);
+	const ut64 size = SIGN_FILE_HDRSZ + colsz + strsz + blobsz;
+	ut8 *buf = (size < ST32_MAX)? calloc (1, size): NULL;
+	if (buf) {
+		memcpy (buf, SIGN_FILE_MAGIC, 4);
+		r_write_le32 (buf + 4, SIGN_FILE_VERSION);
+		r_write_le32 (buf + 8, count);
+		r_write_le32 (buf + 12, SF_COLS);
+		r_write_le64 (buf + 16, strsz);
+		r_write_le64 (buf + 24, blobsz);
+		ut8 *p = buf + SIGN_FILE_HDRSZ;
+		memcpy (p, cols, colsz);
+		memcpy (p + colsz, r_strbuf_get (strs), strsz);
+		memcpy (p + colsz + strsz, r_strbuf_get (blob), blobsz);
+		// write it aside first, the old file may still be mapped
+		char *tmp = r_str_newf ("%s.%d", file, r_sys_getpid ());
+		ret = tmp && r_file_dump (tmp, buf, size, false) && r_file_move (tmp, file);
+		if (tmp && !ret) {
+			r_file_rm (tmp);
+		}
+		free (tmp);
+		free (buf);
+	}
+beach:
+	r_strbuf_free (strs);
+	r_strbuf_free (blob);
+	ht_pu_free (seen);
+	free (cols);
+	r_pvector_free (items);
+	return ret;
+}
+
+static bool sign_file_save(RAnal *a, const char *file) {
+	Sdb *db = sdb_new0 ();
+	if (!db) {
+		return false;
+	}
+	// merge with the zignatures already in the file, like the text format
+	RSignFile *sf = r_sign_file_open (file);
+	if (sf) {
+		Sdb *old = a->sdb_zigns;
+		a->sdb_zigns = db;
+		sign_file_load (a, sf, true);
+		a->sdb_zigns = old;
+		r_sign_file_free (sf);
+	}
+	sdb_merge (db, a->sdb_zigns);
+	bool ret = sign_file_write (a, file, db);
+	sdb_free (db);
+	return ret;
+}
+
 R_API char *r_sign_path(RAnal *a, const char *file) {
 	char *abs = r_file_abspath (file);
 	if (abs) {
@@ -2947,6 +3963,15 @@ R_API bool r_sign_load(RAnal *a, const char *file, bool merge) {
 		free (path);
 		return false;
 	}
+	if (r_sign_is_file (path)) {
+		RSignFile *sf = r_sign_file_open (path);
+		if (sf) {
+			sign_file_load (a, sf, merge);
+			r_sign_file_free (sf);
+		}
+		free (path);
+		return sf;
+	}
 	Sdb *db = sdb_new (NULL, path, 0);
 	if (!db) {
 		free (path);
@@ -3015,6 +4040,9 @@ R_API bool r_sign_save(RAnal *a, const char *file) {
 		R_LOG_WARN ("no zignatures to save");
 		return false;
 	}
+	if (r_str_endswith (file, R_SIGN_FILE_EXT) || r_sign_is_file (file)) {
+		return sign_file_save (a, file);
+	}
 
 	Sdb *db = sdb_new (NULL, file, 0);
 	if (!db) {
@@ -3,6 +3,51 @@
 #include <r_anal.h>
 #include <r_cons.h>
 
+// References are kept twice, sorted by source (refs) and by destination
+// (xrefs). Each index is a tree of blocks holding up to XREFS_BLOCK records
+// encoded as deltas from the previous one, which takes a few bytes per
+// reference. New references are buffered unsorted and merged into the
+// blocks in batches the next time the index is read.
+
+#define XREFS_BLOCK 32
+#define XREFS_PENDING 4096
+// worst case size of an encoded record: two 64 bit deltas and the type
+#define XREFS_RECORD_MAX (10 + 10 + 5)
+
+typedef struct {
+	RBNode rb;
+	ut64 at; // first record of the block
+	ut64 addr;
+	ut8 *data;
+	ut32 size;
+	ut32 count;
+} XrefBlock;
+
+typedef struct {
+	RAnalRef ref;
+	ut32 seq;
+} XrefPending;
+
+typedef struct {
+	RBNode *root;
+	ut64 count;
+	XrefPending *pending;
+	ut32 npending;
+	ut32 seq;
+} XrefIndex;
+
+struct r_anal_xrefs_t {
+	XrefIndex refs; // keyed by source
+	XrefIndex xrefs; // keyed by destination
+};
+
+typedef struct {
+	const ut8 *p;
+	const ut8 *end;
+	RAnalRef ref;
+	bool first;
+} XrefCursor;
+
 static RAnalRef *r_anal_ref_new(ut64 addr, ut64 at, ut64 type) {
 	RAnalRef *ref = R_NEW (RAnalRef);
 	if (ref) {
@@ -21,79 +66,372 @@ R_API RList *r_anal_ref_list_new(void) {
 	return r_list_newf (r_anal_ref_free);
 }
 
-static void xrefs_ht_free(HtUPKv *kv) {
-	ht_up_free (kv->value);
+static inline int ref_cmp(const RAnalRef *a, const RAnalRef *b) {
+	if (a->at != b->at) {
+		return (a->at < b->at)? -1: 1;
+	}
+	if (a->addr != b->addr) {
+		return (a->addr < b->addr)? -1: 1;
+	}
+	return 0;
 }
 
-static void xrefs_ref_free(HtUPKv *kv) {
-	r_anal_ref_free (kv->value);
+static int pending_cmp(const void *a, const void *b) {
+	const XrefPending *pa = a;
+	const XrefPending *pb = b;
+	int r = ref_cmp (&pa->ref, &pb->ref);
+	if (!r) {
+		r = (pa->seq < pb->seq)? -1: 1;
+	}
+	return r;
 }
 
-static bool appendRef(void *u, const ut64 k, const void *v) {
-	RList *list = (RList *)u;
-	RAnalRef *ref = (RAnalRef *)v;
-	RAnalRef *cloned = r_anal_ref_new (ref->addr, ref->at, ref->type);
-	if (cloned) {
-		r_list_append (list, cloned);
-		return true;
+static int block_cmp(const void *incoming, const RBNode *in_tree, void *user) {
+	const RAnalRef *ref = incoming;
+	const XrefBlock *b = container_of (in_tree, XrefBlock, rb);
+	if (ref->at != b->at) {
+		return (ref->at < b->at)? -1: 1;
+	}
+	if (ref->addr != b->addr) {
+		return (ref->addr < b->addr)? -1: 1;
+	}
+	return 0;
+}
+
+static void block_free(RBNode *node, void *user) {
+	XrefBlock *b = container_of (node, XrefBlock, rb);
+	free (b->data);
+	free (b);
+}
+
+static inline ut8 *put_uleb(ut8 *p, ut64 v) {
+	do {
+		ut8 b = v & 0x7f;
+		v >>= 7;
+		*p++ = v? (b | 0x80): b;
+	} while (v);
+	return p;
+}
+
+static inline const ut8 *get_uleb(const ut8 *p, ut64 *v) {
+	ut64 r = 0;
+	int shift = 0;
+	do {
+		r |= (ut64)(*p & 0x7f) << shift;
+		shift += 7;
+	} while (*p++ & 0x80);
+	*v = r;
+	return p;
+}
+
+// records sharing the source store the distance to the previous destination,
+// the rest store the signed distance from their source
+static ut8 *encode_ref(ut8 *p, const RAnalRef *ref, const RAnalRef *prev) {
+	const ut64 dat = ref->at - (prev? prev->at: ref->at);
+	p = put_uleb (p, dat);
+	if (prev && !dat) {
+		p = put_uleb (p, ref->addr - prev->addr);
+	} else {
+		const st64 d = (st64)(ref->addr - ref->at);
+		p = put_uleb (p, ((ut64)d << 1) ^ (ut64)(d >> 63));
 	}
-	return false;
+	return put_uleb (p, (ut64)(ut32)ref->type);
+}
+
+static inline void cursor_init(XrefCursor *c, const XrefBlock *b) {
+	c->p = b->data;
+	c->end = b->data + b->size;
+	c->ref.at = b->at;
+	c->ref.addr = b->addr;
+	c->first = true;
 }
 
-static bool mylistrefs_cb(void *list, const ut64 k, const void *v) {
-	HtUP *ht = (HtUP *)v;
-	ht_up_foreach (ht, appendRef, list);
+static inline bool cursor_next(XrefCursor *c) {
+	if (c->p >= c->end) {
+		return false;
+	}
+	ut64 dat, v, type;
+	c->p = get_uleb (c->p, &dat);
+	c->p = get_uleb (c->p, &v);
+	c->p = get_uleb (c->p, &type);
+	c->ref.at += dat;
+	if (!c->first && !dat) {
+		c->ref.addr += v;
+	} else {
+		c->ref.addr = c->ref.at + (ut64)((st64)(v >> 1) ^ -(st64)(v & 1));
+	}
+	c->ref.type = (RAnalRefType)type;
+	c->first = false;
 	return true;
 }
 
-static int ref_cmp(const RAnalRef *a, const RAnalRef *b) {
-	if (a->at < b->at) {
-		return -1;
+static int block_decode(const XrefBlock *b, RAnalRef *out) {
+	XrefCursor c;
+	int n = 0;
+	cursor_init (&c, b);
+	while (cursor_next (&c)) {
+		out[n++] = c.ref;
+	}
+	return n;
+}
+
+static bool block_encode(XrefBlock *b, const RAnalRef *refs, int count) {
+	ut8 buf[XREFS_BLOCK * XREFS_RECORD_MAX];
+	ut8 *p = buf;
+	int i;
+	for (i = 0; i < count; i++) {
+		p = encode_ref (p, &refs[i], i? &refs[i - 1]: NULL);
 	}
-	if (a->at > b->at) {
-		return 1;
+	const ut32 size = p - buf;
+	ut8 *data = realloc (b->data, R_MAX (size, 1));
+	if (!data) {
+		return false;
+	}
+	memcpy (data, buf, size);
+	b->data = data;
+	b->size = size;
+	b->count = count;
+	b->at = refs[0].at;
+	b->addr = refs[0].addr;
+	return true;
+}
+
+static XrefBlock *block_new(XrefIndex *x, const RAnalRef *refs, int count) {
+	XrefBlock *b = R_NEW0 (XrefBlock);
+	if (b && !block_encode (b, refs, count)) {
+		R_FREE (b);
 	}
-	if (a->addr < b->addr) {
-		return -1;
+	if (b) {
+		r_rbtree_insert (&x->root, (void *)refs, &b->rb, block_cmp, NULL);
 	}
-	if (a->addr > b->addr) {
-		return 1;
+	return b;
+}
+
+// block that holds or would hold ref: the last one starting before it
+static XrefBlock *block_find(XrefIndex *x, const RAnalRef *ref) {
+	RBNode *n = r_rbtree_upper_bound (x->root, (void *)ref, block_cmp, NULL);
+	if (!n) {
+		RBIter it = r_rbtree_first (x->root);
+		return r_rbtree_iter_has (&it)? r_rbtree_iter_get (&it, XrefBlock, rb): NULL;
 	}
-	return 0;
+	return container_of (n, XrefBlock, rb);
 }
 
-static void sortxrefs(RList *list) {
-	r_list_sort (list, (RListComparator)ref_cmp);
+static XrefBlock *block_next(XrefIndex *x, XrefBlock *b) {
+	RAnalRef key = { .at = b->at, .addr = b->addr };
+	RBIter it = r_rbtree_lower_bound_forward (x->root, &key, block_cmp, NULL);
+	r_rbtree_iter_next (&it);
+	return r_rbtree_iter_has (&it)? r_rbtree_iter_get (&it, XrefBlock, rb): NULL;
 }
 
-static void listxrefs(HtUP *m, ut64 addr, RList *list) {
-	if (addr == UT64_MAX) {
-		ht_up_foreach (m, mylistrefs_cb, list);
+// merge the sorted refs into b, splitting it when it grows too much
+static void block_merge(XrefIndex *x, XrefBlock *b, const RAnalRef *refs, int count) {
+	RAnalRef *tmp = malloc ((b->count + count) * sizeof (RAnalRef));
+	RAnalRef *old = malloc (b->count * sizeof (RAnalRef));
+	if (!tmp || !old) {
+		free (tmp);
+		free (old);
+		return;
+	}
+	const int nold = block_decode (b, old);
+	int i = 0, j = 0, n = 0;
+	while (i < nold || j < count) {
+		const int r = (i < nold && j < count)? ref_cmp (&old[i], &refs[j]): (i < nold)? -1: 1;
+		if (r < 0) {
+			tmp[n++] = old[i++];
+		} else {
+			if (!r) {
+				// the newer type replaces the stored one
+				i++;
+			} else {
+				x->count++;
+			}
+			tmp[n++] = refs[j++];
+		}
+	}
+	if (n <= XREFS_BLOCK) {
+		block_encode (b, tmp, n);
 	} else {
-		bool found;
-		HtUP *d = ht_up_find (m, addr, &found);
-		if (!found) {
-			return;
+		// split in chunks filled to three quarters to leave room for inserts
+		const int chunk = XREFS_BLOCK * 3 / 4;
+		const int nchunks = (n + chunk - 1) / chunk;
+		int k, from = 0;
+		for (k = 0; k < nchunks; k++) {
+			const int to = (int)(((st64)n * (k + 1)) / nchunks);
+			if (!k) {
+				block_encode (b, tmp, to);
+			} else {
+				block_new (x, tmp + from, to - from);
+			}
+			from = to;
+		}
+	}
+	free (tmp);
+	free (old);
+}
+
+static void index_flush(XrefIndex *x) {
+	if (!x->npending) {
+		return;
+	}
+	const int np = x->npending;
+	XrefPending *pending = x->pending;
+	qsort (pending, np, sizeof (XrefPending), pending_cmp);
+	RAnalRef *refs = malloc (np * sizeof (RAnalRef));
+	if (!refs) {
+		return;
+	}
+	// keep the last one of every duplicated record
+	int i, n = 0;
+	for (i = 0; i < np; i++) {
+		if (n > 0 && !ref_cmp (&refs[n - 1], &pending[i].ref)) {
+			refs[n - 1] = pending[i].ref;
+		} else {
+			refs[n++] = pending[i].ref;
+		}
+	}
+	x->npending = 0;
+	x->seq = 0;
+	i = 0;
+	while (i < n) {
+		XrefBlock *b = block_find (x, &refs[i]);
+		if (!b) {
+			const int count = R_MIN (n - i, XREFS_BLOCK * 3 / 4);
+			if (block_new (x, refs + i, count)) {
+				x->count += count;
+			}
+			i += count;
+			continue;
 		}
-		ht_up_foreach (d, appendRef, list);
+		XrefBlock *next = block_next (x, b);
+		int j = i + 1;
+		if (next) {
+			const RAnalRef limit = { .at = next->at, .addr = next->addr };
+			while (j < n && ref_cmp (&refs[j], &limit) < 0) {
+				j++;
+			}
+		} else {
+			j = n;
+		}
+		block_merge (x, b, refs + i, j - i);
+		i = j;
 	}
+	free (refs);
 }
 
-// XXX THIS IS HEAVY IN MEMORY USAGE
-static void setxref(HtUP *m, ut64 from, ut64 to, int type) {
-	bool found;
-	HtUP *ht = ht_up_find (m, from, &found);
-	if (!found) {
-		ht = ht_up_new (NULL, xrefs_ref_free, NULL);
-		if (!ht) {
+static void index_add(XrefIndex *x, ut64 at, ut64 addr, RAnalRefType type) {
+	if (!x->pending) {
+		x->pending = R_NEWS (XrefPending, XREFS_PENDING);
+		if (!x->pending) {
 			return;
 		}
-		ht_up_insert (m, from, ht);
 	}
-	RAnalRef *ref = r_anal_ref_new (to, from, type);
-	if (ref) {
-		ht_up_update (ht, to, ref);
+	if (x->npending == XREFS_PENDING) {
+		index_flush (x);
+	}
+	XrefPending *p = &x->pending[x->npending++];
+	p->ref.at = at;
+	p->ref.addr = addr;
+	p->ref.type = type;
+	p->seq = x->seq++;
+}
+
+static bool index_del(XrefIndex *x, ut64 at, ut64 addr) {
+	index_flush (x);
+	const RAnalRef key = { .at = at, .addr = addr };
+	RBNode *n = r_rbtree_upper_bound (x->root, (void *)&key, block_cmp, NULL);
+	if (!n) {
+		return false;
+	}
+	XrefBlock *b = container_of (n, XrefBlock, rb);
+	RAnalRef refs[XREFS_BLOCK];
+	const int count = block_decode (b, refs);
+	int i;
+	for (i = 0; i < count; i++) {
+		if (!ref_cmp (&refs[i], &key)) {
+			break;
+		}
+	}
+	if (i == count) {
+		return false;
+	}
+	x->count--;
+	if (count == 1) {
+		RAnalRef first = { .at = b->at, .addr = b->addr };
+		r_rbtree_delete (&x->root, &first, block_cmp, NULL, block_free, NULL);
+		return true;
+	}
+	memmove (refs + i, refs + i + 1, (count - i - 1) * sizeof (RAnalRef));
+	block_encode (b, refs, count - 1);
+	return true;
+}
+
+// call cb for the records with a key in [from, to)
+static bool index_foreach(XrefIndex *x, ut64 from, ut64 to, RAnalRefCallback cb, void *user) {
+	index_flush (x);
+	RBIter it;
+	if (from) {
+		const RAnalRef key = { .at = from, .addr = 0 };
+		XrefBlock *b = block_find (x, &key);
+		if (!b) {
+			return true;
+		}
+		const RAnalRef first = { .at = b->at, .addr = b->addr };
+		it = r_rbtree_lower_bound_forward (x->root, (void *)&first, block_cmp, NULL);
+	} else {
+		it = r_rbtree_first (x->root);
+	}
+	XrefBlock *b;
+	r_rbtree_iter_while (it, b, XrefBlock, rb) {
+		if (b->at >= to) {
+			break;
+		}
+		XrefCursor c;
+		cursor_init (&c, b);
+		while (cursor_next (&c)) {
+			if (c.ref.at < from) {
+				continue;
+			}
+			if (c.ref.at >= to) {
+				return true;
+			}
+			if (!cb (user, &c.ref)) {
+				return false;
+			}
+		}
 	}
+	return true;
+}
+
+static void index_fini(XrefIndex *x) {
+	r_rbtree_free (x->root, block_free, NULL);
+	free (x->pending);
+	memset (x, 0, sizeof (XrefIndex));
+}
+
+static bool append_cb(void *user, const RAnalRef *ref) {
+	RAnalRef *r = r_anal_ref_new (ref->addr, ref->at, ref->type);
+	return r && r_list_append ((RList *)user, r);
+}
+
+static void listxrefs(XrefIndex *x, ut64 addr, RList *list) {
+	if (addr == UT64_MAX) {
+		index_foreach (x, 0, UT64_MAX, append_cb, list);
+	} else {
+		index_foreach (x, addr, addr + 1, append_cb, list);
+	}
+}
+
+static RList *getxrefs(XrefIndex *x, ut64 addr) {
+	RList *list = r_anal_ref_list_new ();
+	if (list) {
+		listxrefs (x, addr, list);
+		if (r_list_empty (list)) {
+			r_list_free (list);
+			list = NULL;
+		}
+	}
+	return list;
 }
 
 // set a reference from FROM to TO and a cross-reference(xref) from TO to FROM.
@@ -103,6 +441,9 @@ R_API bool r_anal_xrefs_set(RAnal *anal, ut64 from, ut64 to, const RAnalRefType
 	if (from == to || from == UT64_MAX || to == UT64_MAX) {
 		return false;
 	}
+	if (!anal->xrefs) {
+		return false;
+	}
 	if (anal->iob.is_valid_offset) {
 		if (!anal->iob.is_valid_offset (anal->iob.io, from, 0)) {
 			return false;
@@ -124,93 +465,76 @@ R_API bool r_anal_xrefs_set(RAnal *anal, ut64 from, ut64 to, const RAnalRefType
 			break;
 		}
 	}
-	setxref (anal->dict_xrefs, to, from, type);
-	setxref (anal->dict_refs, from, to, type);
+	index_add (&anal->xrefs->xrefs, to, from, type);
+	index_add (&anal->xrefs->refs, from, to, type);
 	R_DIRTY (anal);
 	return true;
 }
 
 R_API bool r_anal_xrefs_deln(RAnal *anal, ut64 from, ut64 to, const RAnalRefType type) {
 	r_return_val_if_fail (anal, false);
-#if 0
-	ht_up_delete (anal->dict_refs, from);
-	ht_up_delete (anal->dict_xrefs, to);
-#else
-	HtUP *d = ht_up_find (anal->dict_refs, from, NULL);
-	if (d) {
-		ht_up_delete (d, to);
-	}
-	d = ht_up_find (anal->dict_xrefs, to, NULL);
-	if (d) {
-		ht_up_delete (d, from);
-	}
-#endif
+	if (!anal->xrefs) {
+		return false;
+	}
+	bool res = index_del (&anal->xrefs->refs, from, to);
+	res |= index_del (&anal->xrefs->xrefs, to, from);
 	R_DIRTY (anal);
-	return true;
+	return res;
 }
 
 R_API bool r_anal_xref_del(RAnal *anal, ut64 from, ut64 to) {
 	r_return_val_if_fail (anal, false);
-	bool res = false;
-	res |= r_anal_xrefs_deln (anal, from, to, R_ANAL_REF_TYPE_NULL);
-	res |= r_anal_xrefs_deln (anal, from, to, R_ANAL_REF_TYPE_CODE);
-	res |= r_anal_xrefs_deln (anal, from, to, R_ANAL_REF_TYPE_CALL);
-	res |= r_anal_xrefs_deln (anal, from, to, R_ANAL_REF_TYPE_DATA);
-	res |= r_anal_xrefs_deln (anal, from, to, R_ANAL_REF_TYPE_STRING);
-	R_DIRTY (anal);
-	return res;
+	// there is one record per pair of addresses, whatever its type
+	return r_anal_xrefs_deln (anal, from, to, R_ANAL_REF_TYPE_NULL);
 }
 
 R_API bool r_anal_xrefs_from(RAnal *anal, RList *list, const char *kind, const RAnalRefType type, ut64 addr) {
 	r_return_val_if_fail (anal && list, false);
-	listxrefs (anal->dict_refs, addr, list);
-	sortxrefs (list);
+	if (anal->xrefs) {
+		listxrefs (&anal->xrefs->refs, addr, list);
+		r_list_sort (list, (RListComparator)ref_cmp);
+	}
 	return true;
 }
 
 R_API RList *r_anal_xrefs_get(RAnal *anal, ut64 to) {
 	r_return_val_if_fail (anal, NULL);
-	RList *list = r_anal_ref_list_new ();
-	if (!list) {
-		return NULL;
-	}
-	listxrefs (anal->dict_xrefs, to, list);
-	sortxrefs (list);
-	if (r_list_empty (list)) {
-		r_list_free (list);
-		list = NULL;
-	}
-	return list;
+	return anal->xrefs? getxrefs (&anal->xrefs->xrefs, to): NULL;
 }
 
 R_API RList *r_anal_refs_get(RAnal *anal, ut64 from) {
 	r_return_val_if_fail (anal, NULL);
-	RList *list = r_anal_ref_list_new ();
-	if (!list) {
-		return NULL;
-	}
-	listxrefs (anal->dict_refs, from, list);
-	sortxrefs (list);
-	if (r_list_empty (list)) {
-		r_list_free (list);
-		list = NULL;
-	}
-	return list;
+	return anal->xrefs? getxrefs (&anal->xrefs->refs, from): NULL;
 }
 
 R_API RList *r_anal_xrefs_get_from(RAnal *anal, ut64 to) {
 	r_return_val_if_fail (anal, NULL);
-	RList *list = r_anal_ref_list_new ();
-	if (!list) {
-		return NULL;
+	return anal->xrefs? getxrefs (&anal->xrefs->refs, to): NULL;
+}
+
+// Iterate the references pointing to `to` (all of them for UT64_MAX) sorted
+// by source without copying them. The index must not be modified from cb
+R_API bool r_anal_xrefs_foreach(RAnal *anal, ut64 to, RAnalRefCallback cb, void *user) {
+	r_return_val_if_fail (anal && cb, false);
+	if (!anal->xrefs) {
+		return true;
 	}
-	listxrefs (anal->dict_refs, to, list);
-	sortxrefs (list);
-	if (r_list_empty (list)) {
-		r_list_free (list);
-		list = NULL;
+	if (to == UT64_MAX) {
+		return index_foreach (&anal->xrefs->xrefs, 0, UT64_MAX, cb, user);
 	}
-	return list;
+	return index_foreach (&anal->xrefs->xrefs, to, to + 1, cb, user);
+}
+
+// Same as r_anal_xrefs_foreach for the references made from `from`
+R_API bool r_anal_refs_foreach(RAnal *anal, ut64 from, RAnalRefCallback cb, void *user) {
+	r_return_val_if_fail (anal && cb, false);
+	if (!anal->xrefs) {
+		return true;
+	}
+	if (from == UT64_MAX) {
+		return index_foreach (&anal->xrefs->refs, 0, UT64_MAX, cb, user);
+	}
+	return index_foreach (&anal->xrefs->refs, from, from + 1, cb, user);
 }
 
 R_API void r_anal_xrefs_list(RAnal *anal, int rad, const char *arg) {
@@ -220,8 +544,9 @@ R_API void r_anal_xrefs_list(RAnal *anal, int rad, const char *arg) {
 	PJ *pj = NULL;
 	RTable *table = NULL;
 	RList *list = r_anal_ref_list_new ();
-	listxrefs (anal->dict_refs, UT64_MAX, list);
-	sortxrefs (list);
+	if (anal->xrefs) {
+		listxrefs (&anal->xrefs->refs, UT64_MAX, list);
+	}
 	if (rad == ',') {
 		table = r_table_new ("xrefs");
 		r_table_set_columnsf (table, "ddssss", "from", "to", "type", "perm", "fromname", "toname");
@@ -426,75 +751,131 @@ R_API RAnalRefType r_anal_xrefs_type(char ch) {
 
 R_API bool r_anal_xrefs_init(RAnal *anal) {
 	r_return_val_if_fail (anal, false);
-	ht_up_free (anal->dict_refs);
-	anal->dict_refs = NULL;
-	ht_up_free (anal->dict_xrefs);
-	anal->dict_xrefs = NULL;
+	r_anal_xrefs_fini (anal);
+	anal->xrefs = R_NEW0 (RAnalXrefs);
+	return anal->xrefs != NULL;
+}
 
-	HtUP *tmp = ht_up_new (NULL, xrefs_ht_free, NULL);
-	if (!tmp) {
-		return false;
+R_API void r_anal_xrefs_fini(RAnal *anal) {
+	r_return_if_fail (anal);
+	if (anal->xrefs) {
+		index_fini (&anal->xrefs->refs);
+		index_fini (&anal->xrefs->xrefs);
+		R_FREE (anal->xrefs);
 	}
-	anal->dict_refs = tmp;
+}
 
-	tmp = ht_up_new (NULL, xrefs_ht_free, NULL);
-	if (!tmp) {
-		ht_up_free (anal->dict_refs);
-		anal->dict_refs = NULL;
-		return false;
+R_API ut64 r_anal_xrefs_count(RAnal *anal) {
+	if (!anal->xrefs) {
+		return 0;
 	}
-	anal->dict_xrefs = tmp;
-	return true;
+	index_flush (&anal->xrefs->xrefs);
+	return anal->xrefs->xrefs.count;
 }
 
-static bool count_cb(void *user, const ut64 k, const void *v) {
-	(*(ut64 *)user) += ((HtUP *)v)->count;
-	return true;
+typedef struct {
+	RAnalBlock **bbs;
+	int count;
+	int cur;
+	RList *list;
+} BlockRefs;
+
+static int bb_cmp(const void *a, const void *b) {
+	const RAnalBlock *ba = *(RAnalBlock **)a;
+	const RAnalBlock *bb = *(RAnalBlock **)b;
+	return (ba->addr > bb->addr) - (ba->addr < bb->addr);
 }
 
-R_API ut64 r_anal_xrefs_count(RAnal *anal) {
-	ut64 ret = 0;
-	ht_up_foreach (anal->dict_xrefs, count_cb, &ret);
-	return ret;
+// the records come sorted, so the blocks are walked along with them
+static bool append_block_cb(void *user, const RAnalRef *ref) {
+	BlockRefs *br = user;
+	while (br->cur < br->count) {
+		RAnalBlock *bb = br->bbs[br->cur];
+		if (ref->at < bb->addr) {
+			return true;
+		}
+		if (ref->at < bb->addr + bb->size) {
+			break;
+		}
+		br->cur++;
+	}
+	if (br->cur >= br->count) {
+		return false;
+	}
+	int i;
+	// blocks can overlap, report the reference once for each of them
+	for (i = br->cur; i < br->count && br->bbs[i]->addr <= ref->at; i++) {
+		RAnalBlock *bb = br->bbs[i];
+		if (ref->at < bb->addr + bb->size && r_anal_block_op_starts_at (bb, ref->at)) {
+			if (!append_cb (br->list, ref)) {
+				return false;
+			}
+		}
+	}
+	return true;
 }
 
-static RList *fcn_get_all_refs(RAnalFunction *fcn, HtUP *ht) {
+static RList *fcn_get_all_refs(RAnalFunction *fcn, XrefIndex *x) {
+	RList *list = r_anal_ref_list_new ();
+	const int count = r_list_length (fcn->bbs);
+	if (!list || !count) {
+		return list;
+	}
+	RAnalBlock **bbs = R_NEWS (RAnalBlock *, count);
+	if (!bbs) {
+		r_list_free (list);
+		return NULL;
+	}
 	RListIter *iter;
 	RAnalBlock *bb;
-	RList *list = r_anal_ref_list_new ();
-	if (R_LIKELY (list)) {
-		r_list_foreach (fcn->bbs, iter, bb) {
-			int i;
-			for (i = 0; i < bb->ninstr; i++) {
-				ut64 at = bb->addr + r_anal_bb_offset_inst (bb, i);
-				listxrefs (ht, at, list);
-			}
+	ut64 size = 0;
+	int i = 0;
+	r_list_foreach (fcn->bbs, iter, bb) {
+		bbs[i++] = bb;
+		size += bb->size;
+	}
+	qsort (bbs, count, sizeof (RAnalBlock *), bb_cmp);
+	BlockRefs br = { bbs, count, 0, list };
+	const ut64 from = bbs[0]->addr;
+	const ut64 to = r_anal_function_max_addr (fcn);
+	if (to - from <= size * 2) {
+		// one walk for the whole function unless its blocks are far apart
+		index_foreach (x, from, to, append_block_cb, &br);
+	} else {
+		for (i = 0; i < count; i++) {
+			br.cur = i;
+			br.count = i + 1;
+			index_foreach (x, bbs[i]->addr, bbs[i]->addr + bbs[i]->size, append_block_cb, &br);
 		}
-		sortxrefs (list);
 	}
+	free (bbs);
+	r_list_sort (list, (RListComparator)ref_cmp);
 	return list;
 }
 
-static RList *fcn_get_refs(RAnalFunction *fcn, HtUP *ht) {
+static RList *fcn_get_refs(RAnalFunction *fcn, XrefIndex *x) {
 	RList *list = r_anal_ref_list_new ();
 	if (R_LIKELY (list)) {
 		// XXX assume first basic block is the entrypoint
-				listxrefs (ht, fcn->addr, list);
+		listxrefs (x, fcn->addr, list);
 	}
 	return list;
 }
 
 R_API RList *r_anal_function_get_refs(RAnalFunction *fcn) {
 	r_return_val_if_fail (fcn, NULL);
-	return fcn_get_all_refs (fcn, fcn->anal->dict_refs);
+	RAnalXrefs *x = fcn->anal->xrefs;
+	return x? fcn_get_all_refs (fcn, &x->refs): NULL;
 }
 
 R_API RList *r_anal_function_get_xrefs(RAnalFunction *fcn) {
 	r_return_val_if_fail (fcn, NULL);
-	return fcn_get_refs (fcn, fcn->anal->dict_xrefs);
+	RAnalXrefs *x = fcn->anal->xrefs;
+	return x? fcn_get_refs (fcn, &x->xrefs): NULL;
 }
 
 R_API RList *r_anal_function_get_all_xrefs(RAnalFunction *fcn) {
 	r_return_val_if_fail (fcn, NULL);
-	return fcn_get_all_refs (fcn, fcn->anal->dict_xrefs);
+	RAnalXrefs *x = fcn->anal->xrefs;
+	return x? fcn_get_all_refs (fcn, &x->xrefs): NULL;
 }
@@ -160,6 +160,7 @@ const RArchPlugin r_arch_plugin_msp430 = {
 	},
 	.arch = "msp430",
 	.bits = R_SYS_BITS_PACK1 (16),
+	.threadsafe = true,
 	.decode = &decode,
 	.info = info,
 	.regs = regs,
@@ -1016,6 +1016,7 @@ const RArchPlugin r_arch_plugin_riscv = {
 	.arch = "riscv",
 	.endian = R_SYS_ENDIAN_LITTLE | R_SYS_ENDIAN_BIG,
 	.bits = R_SYS_BITS_PACK2 (32, 64),
+	.threadsafe = true,
 	.encode = riscv_encode,
 	.decode = riscv_decode,
 	.info = info,
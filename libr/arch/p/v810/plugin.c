@@ -469,6 +469,7 @@ const RArchPlugin r_arch_plugin_v810 = {
 	},
 	.arch = "v810",
 	.bits = R_SYS_BITS_PACK1 (32),
+	.threadsafe = true,
 	.decode = v810_decode,
 	.regs = v810_regs,
 	.info = archinfo,
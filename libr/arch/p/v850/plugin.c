@@ -907,6 +907,7 @@ const RArchPlugin r_arch_plugin_v850 = {
 	.cpus = "e0,0,e,e1,e2,e2v3,e3v5,all",
 	.arch = "v850",
 	.bits = 32,
+	.threadsafe = true,
 	.encode = encode,
 	.decode = decode,
 	.info = archinfo,
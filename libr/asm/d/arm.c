@@ -0,0 +1,600 @@
+// SDB-CGEN V1.9.4
+// gcc -DMAIN=1 arm.c ; ./a.out > arm.h
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+struct kv { const char *name; const char *value; };
+static const struct kv kvs[] = {
+  {"cps","change processor state"}, 
+  {"rev","reverse bytes"}, 
+  {"cpp","cache prefetch prediction restriction by context: an alias of sys"}, 
+  {"autiza","authenticate instruction address, using key a"}, 
+  {"steorh","atomic exclusive or on halfword in memory, without return: an alias of ldeorh, ldeorah, ldeoralh, ldeorlh"}, 
+  {"ret","return from subroutine"}, 
+  {"eon","bitwise exclusive or not"}, 
+  {"pacdb","pointer authentication code for data address, using key b"}, 
+  {"cdp","coprocessor data operations"}, 
+  {"ldnp","load pair of registers, with non-temporal hint"}, 
+  {"subg","subtract with tag"}, 
+  {"pacda","pointer authentication code for data address, using key a"}, 
+  {"bhs","variant of bcs"}, 
+  {"ldmia","incrememnt after"}, 
+  {"steorl","atomic exclusive or on word or doubleword in memory, without return: an alias of ldeor, ldeora, ldeoral, ldeorl"}, 
+  {"sbfiz","signed bitfield insert in zero: an alias of sbfm"}, 
+  {"caspal","compare and swap pair of words or doublewords in memory"}, 
+  {"steorb","atomic exclusive or on byte in memory, without return: an alias of ldeorb, ldeorab, ldeoralb, ldeorlb"}, 
+  {"mov","move value between registers"}, 
+  {"ldapursw","load-acquire rcpc register signed word (unscaled)"}, 
+  {"ldmib","increment before"}, 
+  {"sbfm","signed bitfield move"}, 
+  {"dc","data cache operation (alias of sys)"}, 
+  {"msr","move general-purpose register to system register"}, 
+  {"cfinv","invert carry flag"}, 
+  {"ldlarb","load loacquire register byte"}, 
+  {"tbz","test bit and branch if zero"}, 
+  {"tlbi","tlb invalidate operation: an alias of sys"}, 
+  {"subp","subtract pointer"}, 
+  {"subs","substract two values and update flags"}, 
+  {"nop","no operation"}, 
+  {"ldeora","atomic exclusive or on word or doubleword in memory"}, 
+  {"ldlarh","load loacquire register halfword"}, 
+  {"uxtab16","zero extend bytes to halfwords add halfwords"}, 
+  {"ldeorb","atomic exclusive or on byte in memory"}, 
+  {"bic","logical bit clear"}, 
+  {"ldeorl","atomic exclusive or on word or doubleword in memory"}, 
+  {"ldsminab","atomic signed minimum on byte in memory"}, 
+  {"st64bv","single-copy atomic 64-byte store with return"}, 
+  {"ldsminal","atomic signed minimum on word or doubleword in memory"}, 
+  {"ldeorh","atomic exclusive or on halfword in memory"}, 
+  {"pacibz","pointer authentication code for instruction address, using key b"}, 
+  {"eor","logical exclusive OR (XOR)"}, 
+  {"ldsminah","atomic signed minimum on halfword in memory"}, 
+  {"stlurh","store-release register halfword (unscaled)"}, 
+  {"bfc","bitfield clear: an alias of bfm"}, 
+  {"andne","logical AND if Z clear (not equal)"}, 
+  {"bfi","bitfield insert: an alias of bfm"}, 
+  {"stlurb","store-release register byte (unscaled)"}, 
+  {"bfm","bitfield move"}, 
+  {"ngcs","negate with carry, setting flags: an alias of sbcs"}, 
+  {"ldarh","load-acquire register halfword"}, 
+  {"lsr","logical shift right"}, 
+  {"ldarb","load-acquire register byte"}, 
+  {"ands","logical AND that updates flags"}, 
+  {"rsb","reverse substract"}, 
+  {"csetm","conditional set mask: an alias of csinv"}, 
+  {"prfum","prefetch memory (unscaled offset)"}, 
+  {"rsc","reverse substract with carry"}, 
+  {"uxtab","zero extend byte to word, add"}, 
+  {"ldlar","load loacquire register"}, 
+  {"lduminalh","atomic unsigned minimum on halfword in memory"}, 
+  {"lsl","logical shift left"}, 
+  {"stzgm","store tag and zero multiple"}, 
+  {"bics","Bitwise bit clear (shifted register), setting the condition flags."}, 
+  {"bge","branch if N clear and V clear"}, 
+  {"asr","arithmetic shift right"}, 
+  {"ror","rotate right: an alias of rorv"}, 
+  {"ldurh","load register halfword (unscaled)"}, 
+  {"brk","breakpoint instruction"}, 
+  {"lduminalb","atomic unsigned minimum on byte in memory"}, 
+  {"wfet","wait for event with timeout"}, 
+  {"cneg","conditional negate: an alias of csneg"}, 
+  {"ldclra","atomic bit clear on word or doubleword in memory"}, 
+  {"sbcs","subtract with carry, setting flags"}, 
+  {"braa","branch with pointer authentication using A key"}, 
+  {"ldurb","load register byte (unscaled)"}, 
+  {"ldclrb","atomic bit clear on byte in memory"}, 
+  {"brab","branch with pointer authentication using B key"}, 
+  {"ldsetlb","atomic bit set on byte in memory"}, 
+  {"ldclrh","atomic bit clear on halfword in memory"}, 
+  {"bgt","branch if Z, N and V clear"}, 
+  {"rbit","reverse bits"}, 
+  {"ldclrl","atomic bit clear on word or doubleword in memory"}, 
+  {"casp","compare and swap pair of words or doublewords in memory"}, 
+  {"setf8","evaluation of 8 or 16 bit flag values"}, 
+  {"sturb","store register byte (unscaled)"}, 
+  {"ldsetlh","atomic bit set on halfword in memory"}, 
+  {"ldadd","atomic add on word or doubleword in memory"}, 
+  {"psb","profiling synchronization barrier"}, 
+  {"lslv","logical shift left variable"}, 
+  {"sturh","store register halfword (unscaled)"}, 
+  {"ld64b","single-copy atomic 64-byte load"}, 
+  {"stxr","store exclusive register"}, 
+  {"lsls","logical shift left and update flags"}, 
+  {"stxp","store exclusive pair of registers"}, 
+  {"and","logical AND"}, 
+  {"cas","compare and swap word or doubleword in memory"}, 
+  {"ldapr","load-acquire rcpc register"}, 
+  {"casa","compare and swap word or doubleword in memory"}, 
+  {"casb","compare and swap byte in memory"}, 
+  {"xpaci","strip pac from instruction pointer"}, 
+  {"casl","compare and swap word or doubleword in memory"}, 
+  {"pop","load N elements from stack into given registers"}, 
+  {"xpacd","strip pac from data pointer"}, 
+  {"cash","compare and swap halfword in memory"}, 
+  {"cbnz","compare and branch on non-zero"}, 
+  {"stsminh","atomic signed minimum on halfword in memory, without return: an alias of ldsminh, ldsminah, ldsminalh, ldsminlh"}, 
+  {"staddlh","atomic add on halfword in memory, without return: an alias of ldaddh, ldaddah, ldaddalh, ldaddlh"}, 
+  {"caspa","compare and swap pair of words or doublewords in memory"}, 
+  {"stsminl","atomic signed minimum on word or doubleword in memory, without return: an alias of ldsmin, ldsmina, ldsminal, ldsminl"}, 
+  {"stsminb","atomic signed minimum on byte in memory, without return: an alias of ldsminb, ldsminab, ldsminalb, ldsminlb"}, 
+  {"caspl","compare and swap pair of words or doublewords in memory"}, 
+  {"staddlb","atomic add on byte in memory, without return: an alias of ldaddb, ldaddab, ldaddalb, ldaddlb"}, 
+  {"dmb","data memory barrier"}, 
+  {"extr","extract register"}, 
+  {"bti","branch target identification"}, 
+  {"stumin","atomic unsigned minimum on word or doubleword in memory, without return: an alias of ldumin, ldumina, lduminal, lduminl"}, 
+  {"ldumaxalb","atomic unsigned maximum on byte in memory"}, 
+  {"swplh","swap halfword in memory"}, 
+  {"ldumaxalh","atomic unsigned maximum on halfword in memory"}, 
+  {"caslh","compare and swap halfword in memory"}, 
+  {"orreq","logical inclusive OR if Z set (equal)"}, 
+  {"ldumax","atomic unsigned maximum on word or doubleword in memory"}, 
+  {"ldtrsw","load register signed word (unprivileged)"}, 
+  {"mcr","move to coprocessor from ARM register"}, 
+  {"ldtrsh","load register signed halfword (unprivileged)"}, 
+  {"swplb","swap byte in memory"}, 
+  {"esb","error synchronization barrier"}, 
+  {"csdb","consumption of speculative data barrier"}, 
+  {"smaddl","signed multiply-add long"}, 
+  {"caslb","compare and swap byte in memory"}, 
+  {"strh.w","store byte value in register into memory"}, 
+  {"casalh","compare and swap halfword in memory"}, 
+  {"autiaz","authenticate instruction address, using key a"}, 
+  {"ldtrsb","load register signed byte (unprivileged)"}, 
+  {"tsb","trace synchronization barrier"}, 
+  {"sxtw","signed extend word"}, 
+  {"swpab","swap byte in memory"}, 
+  {"pacibsp","function prelude for pointer authentication using B key"}, 
+  {"sxth","extracts bits[15:0] and sign extends to 32 bits."}, 
+  {"casalb","compare and swap byte in memory"}, 
+  {"swpah","swap halfword in memory"}, 
+  {"ldsmaxah","atomic signed maximum on halfword in memory"}, 
+  {"ldsmin","atomic signed minimum on word or doubleword in memory"}, 
+  {"sxtb","extracts bits[7:0] and sign extends to 32 bits."}, 
+  {"swpal","swap word or doubleword in memory"}, 
+  {"ldsmaxal","atomic signed maximum on word or doubleword in memory"}, 
+  {"ldsmaxab","atomic signed maximum on byte in memory"}, 
+  {"stnp","store pair of registers, with non-temporal hint"}, 
+  {"crc32cw","crc32c checksum"}, 
+  {"paciasp","function prelude for pointer authentication using A key"}, 
+  {"stclr","atomic bit clear on word or doubleword in memory, without return: an alias of ldclr, ldclra, ldclral, ldclrl"}, 
+  {"pacib","pointer authentication code for instruction address, using key b"}, 
+  {"tst","test"}, 
+  {"addne","add two values if Z clear (not equal)"}, 
+  {"stz2g","store allocation tags, zeroing"}, 
+  {"pacia","pointer authentication code for instruction address, using key a"}, 
+  {"autib1716","authenticate instruction address, using key b"}, 
+  {"at","address translate: an alias of sys"}, 
+  {"smsubl","signed multiply-subtract long"}, 
+  {"crc32cx","crc32c checksum"}, 
+  {"ldsminalh","atomic signed minimum on halfword in memory"}, 
+  {"cmpp","compare with tag: an alias of subps"}, 
+  {"ldreq","load from memory to register if Z set (equal)"}, 
+  {"dsb","data synchronization barrier."}, 
+  {"crc32cb","crc32c checksum"}, 
+  {"ldsminalb","atomic signed minimum on byte in memory"}, 
+  {"flt","armfpu: convert int to float: flt"}, 
+  {"rorv","rotate right variable"}, 
+  {"bcc","branch if C clear (no carry)"}, 
+  {"umsubl","unsigned multiply-subtract long"}, 
+  {"crc32ch","crc32c checksum"}, 
+  {"eorne","logical exclusive OR (XOR) if Z clear (not equal)"}, 
+  {"ldumaxlb","atomic unsigned maximum on byte in memory"}, 
+  {"st2g","store allocation tags"}, 
+  {"movs","move immediate into register and update flags"}, 
+  {"movt","write 16 bit value on top of halfword"}, 
+  {"movw","write 16 bit value on lower bits"}, 
+  {"ldumaxlh","atomic unsigned maximum on halfword in memory"}, 
+  {"drps","debug restore process state"}, 
+  {"movz","move shifted 16-bit immediate to register."}, 
+  {"cmn","compare negated"}, 
+  {"bcs","branch if C set (carry)"}, 
+  {"pacib1716","pointer authentication code for instruction address, using key b"}, 
+  {"ldapurh","load-acquire rcpc register halfword (unscaled)"}, 
+  {"ldsetalb","atomic bit set on byte in memory"}, 
+  {"ssbb","speculative store bypass barrier: an alias of dsb"}, 
+  {"ldapurb","load-acquire rcpc register byte (unscaled)"}, 
+  {"ldaprh","load-acquire rcpc register halfword"}, 
+  {"sys","system instruction"}, 
+  {"movk","move wide with keep"}, 
+  {"ldsetalh","atomic bit set on halfword in memory"}, 
+  {"ldaprb","load-acquire rcpc register byte"}, 
+  {"ldsetl","atomic bit set on word or doubleword in memory"}, 
+  {"teq","test equivalence"}, 
+  {"addlo","add if C is clear (no carry)"}, 
+  {"movn","move wide with not"}, 
+  {"ldseth","atomic bit set on halfword in memory"}, 
+  {"cmp","compares two registers"}, 
+  {"strne","store register into memory if Z clear (not equal)"}, 
+  {"ldar","load-acquire register"}, 
+  {"ldrsh","load register signed halfword"}, 
+  {"lduminb","atomic unsigned minimum on byte in memory"}, 
+  {"ldsetb","atomic bit set on byte in memory"}, 
+  {"ldseta","atomic bit set on word or doubleword in memory"}, 
+  {"swpa","swap word or doubleword in memory"}, 
+  {"ldumina","atomic unsigned minimum on word or doubleword in memory"}, 
+  {"swpb","swap byte in memory"}, 
+  {"ldr.w","load from memory to register"}, 
+  {"ldrsb","load register signed byte"}, 
+  {"lduminh","atomic unsigned minimum on halfword in memory"}, 
+  {"swph","swap halfword in memory"}, 
+  {"lduminl","atomic unsigned minimum on word or doubleword in memory"}, 
+  {"swpl","swap word or doubleword in memory"}, 
+  {"adrp","form pc-relative address to 4kb page"}, 
+  {"clz","count leading zeros"}, 
+  {"b.cond","branch conditionally"}, 
+  {"bpl","branch if N clear"}, 
+  {"sb","speculation barrier"}, 
+  {"ldrsw","load register signed word"}, 
+  {"ldsmaxalb","atomic signed maximum on byte in memory"}, 
+  {"xpaclri","system strip pointer authentication"}, 
+  {"cls","count leading sign bits"}, 
+  {"lduminlh","atomic unsigned minimum on halfword in memory"}, 
+  {"ngc","negate with carry: an alias of sbc"}, 
+  {"autibsp","authenticate return pointer before returning from function using B key"}, 
+  {"lduminlb","atomic unsigned minimum on byte in memory"}, 
+  {"ldrh","load half word (16bit) from memory to register"}, 
+  {"beq","branches if equal (see 'b') Z is set"}, 
+  {"ldsmaxalh","atomic signed maximum on halfword in memory"}, 
+  {"mcrr","move to coprocessor from two ARM register"}, 
+  {"dvp","data value prediction restriction by context: an alias of sys"}, 
+  {"ldrb","load byte from memory to register"}, 
+  {"ldgm","load tag multiple"}, 
+  {"ldeorlh","atomic exclusive or on halfword in memory"}, 
+  {"eoreq","logical exclusive OR (XOR) if Z set (equal)"}, 
+  {"subps","subtract pointer, setting flags"}, 
+  {"svc","supervisor call"}, 
+  {"cinc","conditional increment: an alias of csinc"}, 
+  {"rev64","reverse bytes: an alias of rev"}, 
+  {"stset","atomic bit set on word or doubleword in memory, without return: an alias of ldset, ldseta, ldsetal, ldsetl"}, 
+  {"strb","store byte value in register into memory"}, 
+  {"ldumaxl","atomic unsigned maximum on word or doubleword in memory"}, 
+  {"ldeorlb","atomic exclusive or on byte in memory"}, 
+  {"strd","store floating point value in memory"}, 
+  {"ldumaxh","atomic unsigned maximum on halfword in memory"}, 
+  {"b","branches the program counter to dst (pc aka r15)"}, 
+  {"tbnz","test bit and branch if nonzero"}, 
+  {"strh","store byte value in register into memory"}, 
+  {"ldpsw","load pair of registers signed word"}, 
+  {"bne","branch if Z clear (not equal)"}, 
+  {"tst.w","logical AND register value with 12-bit immediate value"}, 
+  {"ldumaxa","atomic unsigned maximum on word or doubleword in memory"}, 
+  {"ldumaxb","atomic unsigned maximum on byte in memory"}, 
+  {"stlxr","store-release exclusive register"}, 
+  {"stlxp","store-release exclusive pair of registers"}, 
+  {"stllr","store lorelease register"}, 
+  {"ldtrh","load register halfword (unprivileged)"}, 
+  {"cinv","conditional invert: an alias of csinv"}, 
+  {"addg","add with tag"}, 
+  {"sbc","substract with carry"}, 
+  {"ldtrb","load register byte (unprivileged)"}, 
+  {"autdzb","authenticate data address, using key b"}, 
+  {"autdza","authenticate data address, using key a"}, 
+  {"rev16","reverse bytes in 16-bit halfwords"}, 
+  {"ldm","load to multiple registers from memory"}, 
+  {"strb.w","store byte value in register into memory"}, 
+  {"orrne","logical inclusive OR if Z clear (not equal)"}, 
+  {"ldeor","atomic exclusive or on word or doubleword in memory"}, 
+  {"sev","send event"}, 
+  {"adds","add two values and update flags"}, 
+  {"eors","logical exclusive OR (XOR) and update flags"}, 
+  {"smnegl","signed multiply-negate long: an alias of smsubl"}, 
+  {"ldg","load allocation tag"}, 
+  {"yield","alias for hint instructrion"}, 
+  {"ldf","armfpu: load float value pointed by reg+(offset): ldf f0, [r0,#off]"}, 
+  {"ldrab","load from memory to register authenticanting the pointer using B key"}, 
+  {"bl","branches and link, similar to call in i386, set lr(r14) = pc, changes pc (r15) )"}, 
+  {"ldc","load from memory to coprocessor"}, 
+  {"ldraa","load from memory to register authenticanting the pointer using A key"}, 
+  {"umnegl","unsigned multiply-negate long: an alias of umsubl"}, 
+  {"ldaddal","atomic add on word or doubleword in memory"}, 
+  {"ldaddah","atomic add on halfword in memory"}, 
+  {"smulh","signed multiply high"}, 
+  {"br","branch to register"}, 
+  {"ldrne","load from memory to register if Z clear (not equal)"}, 
+  {"msub","multiply-subtract"}, 
+  {"smull","signed multiply long: an alias of smaddl"}, 
+  {"ldaxrb","load-acquire exclusive register byte"}, 
+  {"ldp","load a pair of registers from memory"}, 
+  {"axflag","convert floating-point condition flags from arm to external format"}, 
+  {"ldr","load register"}, 
+  {"ldaddab","atomic add on byte in memory"}, 
+  {"autiasp","authenticate return pointer before returning from function using A key"}, 
+  {"subne","substract two values if Z clear (not equal)"}, 
+  {"adcs","add with carry and update flags"}, 
+  {"bx","branches and exchanges cpu mode to 16 bits (thumb mode)"}, 
+  {"pacia1716","pointer authentication code for instruction address, using key a"}, 
+  {"ldaddl","atomic add on word or doubleword in memory"}, 
+  {"orrs","logical inclusive OR and update flags"}, 
+  {"hint","hint instruction"}, 
+  {"xaflag","convert floating-point condition flags from external format to arm format"}, 
+  {"stumax","atomic unsigned maximum on word or doubleword in memory, without return: an alias of ldumax, ldumaxa, ldumaxal, ldumaxl"}, 
+  {"stuminl","atomic unsigned minimum on word or doubleword in memory, without return: an alias of ldumin, ldumina, lduminal, lduminl"}, 
+  {"ldaxrh","load-acquire exclusive register halfword"}, 
+  {"sysl","system instruction with result"}, 
+  {"ldaddh","atomic add on halfword in memory"}, 
+  {"stlr","store-release register"}, 
+  {"stuminh","atomic unsigned minimum on halfword in memory, without return: an alias of lduminh, lduminah, lduminalh, lduminlh"}, 
+  {"irg","insert random tag"}, 
+  {"autia1716","authenticate instruction address, using key a"}, 
+  {"madd","multiply-add"}, 
+  {"ldrb.w","load from memory to register"}, 
+  {"autibz","authenticate instruction address, using key b"}, 
+  {"ldadda","atomic add on word or doubleword in memory"}, 
+  {"stsmin","atomic signed minimum on word or doubleword in memory, without return: an alias of ldsmin, ldsmina, ldsminal, ldsminl"}, 
+  {"retab","return with authenticated pointer using B key"}, 
+  {"ldaddb","atomic add on byte in memory"}, 
+  {"retaa","return with authenticated pointer using A key"}, 
+  {"ldxrb","load exclusive register byte"}, 
+  {"stuminb","atomic unsigned minimum on byte in memory, without return: an alias of lduminb, lduminab, lduminalb, lduminlb"}, 
+  {"mneg","multiply-negate: an alias of msub"}, 
+  {"orr","logical inclusive OR"}, 
+  {"stsetlh","atomic bit set on halfword in memory, without return: an alias of ldseth, ldsetah, ldsetalh, ldsetlh"}, 
+  {"st64b","single-copy atomic 64-byte store without return"}, 
+  {"rev32","reverse bytes in 32-bit words"}, 
+  {"asrv","arithmetic shift right variable"}, 
+  {"ldxrh","load exclusive register halfword"}, 
+  {"stlrh","store-release register halfword"}, 
+  {"dcps1","debug change pe state to el1."}, 
+  {"bics.w","word bitwise bit clear and update flags"}, 
+  {"asrs","arithmetic shift right and update flags"}, 
+  {"dcps3","debug change pe state to el3"}, 
+  {"orn","bitwise or not"}, 
+  {"dcps2","debug change pe state to el2."}, 
+  {"stsetlb","atomic bit set on byte in memory, without return: an alias of ldsetb, ldsetab, ldsetalb, ldsetlb"}, 
+  {"stlrb","store-release register byte"}, 
+  {"blrabz","variants of blraa"}, 
+  {"rsbs","subtracts the value from zero, producing the arithmetic negative of the value, and updates flags"}, 
+  {"hlt","external debug breakpoint."}, 
+  {"uxtb.w","zero textend word and add, extend to 32bit value"}, 
+  {"ldclrlh","atomic bit clear on halfword in memory"}, 
+  {"ldumin","atomic unsigned minimum on word or doubleword in memory"}, 
+  {"stsmaxb","atomic signed maximum on byte in memory, without return: an alias of ldsmaxb, ldsmaxab, ldsmaxalb, ldsmaxlb"}, 
+  {"stsmaxl","atomic signed maximum on word or doubleword in memory, without return: an alias of ldsmax, ldsmaxa, ldsmaxal, ldsmaxl"}, 
+  {"stlur","store-release register (unscaled)"}, 
+  {"steor","atomic exclusive or on word or doubleword in memory, without return: an alias of ldeor, ldeora, ldeoral, ldeorl"}, 
+  {"vsri","vector shift right and insert"}, 
+  {"stxrh","store exclusive register halfword"}, 
+  {"stsmaxh","atomic signed maximum on halfword in memory, without return: an alias of ldsmaxh, ldsmaxah, ldsmaxalh, ldsmaxlh"}, 
+  {"swpalh","swap halfword in memory"}, 
+  {"autia","authenticate instruction address, using key a"}, 
+  {"ldsmaxh","atomic signed maximum on halfword in memory"}, 
+  {"ldclrlb","atomic bit clear on byte in memory"}, 
+  {"autib","authenticate instruction address, using key b"}, 
+  {"mrs","move system register"}, 
+  {"stsmaxlh","atomic signed maximum on halfword in memory, without return: an alias of ldsmaxh, ldsmaxah, ldsmaxalh, ldsmaxlh"}, 
+  {"ldsmaxl","atomic signed maximum on word or doubleword in memory"}, 
+  {"ldsmaxb","atomic signed maximum on byte in memory"}, 
+  {"stxrb","store exclusive register byte"}, 
+  {"swpalb","swap byte in memory"}, 
+  {"ldsmaxa","atomic signed maximum on word or doubleword in memory"}, 
+  {"rfe","return from exception (loads pc+cpsr)"}, 
+  {"csinv","conditional select invert"}, 
+  {"ubfx","unsigned bit field extract"}, 
+  {"stsmaxlb","atomic signed maximum on byte in memory, without return: an alias of ldsmaxb, ldsmaxab, ldsmaxalb, ldsmaxlb"}, 
+  {"ccmn","conditional compare negative"}, 
+  {"lsrs","logical shift right and update flags"}, 
+  {"blraaz","variants of blraa"}, 
+  {"lsrv","logical shift right variable"}, 
+  {"srs","store return state"}, 
+  {"csinc","conditional select increment"}, 
+  {"dgh","data gathering hint"}, 
+  {"ic","instruction cache operation (alias of sys)"}, 
+  {"ubfm","unsigned bitfield move"}, 
+  {"mov.w","move 3byte immediate into register"}, 
+  {"ldxp","load exclusive pair of registers"}, 
+  {"cfp","control flow prediction restriction by context: an alias of sys"}, 
+  {"ldxr","load exclusive register"}, 
+  {"ldsmaxlb","atomic signed maximum on byte in memory"}, 
+  {"sub","substract two values"}, 
+  {"ccmp","conditional compare"}, 
+  {"it","if then"}, 
+  {"stsminlb","atomic signed minimum on byte in memory, without return: an alias of ldsminb, ldsminab, ldsminalb, ldsminlb"}, 
+  {"ldsmaxlh","atomic signed maximum on halfword in memory"}, 
+  {"pacdza","pointer authentication code for data address, using key a"}, 
+  {"neg","negate: an alias of sub"}, 
+  {"pacdzb","pointer authentication code for data address, using key b"}, 
+  {"mvns","move bitwise NOT and update flags"}, 
+  {"ldursw","load register signed word (unscaled)"}, 
+  {"stsminlh","atomic signed minimum on halfword in memory, without return: an alias of ldsminh, ldsminah, ldsminalh, ldsminlh"}, 
+  {"wfit","wait for interrupt with timeout"}, 
+  {"ldursh","load register signed halfword (unscaled)"}, 
+  {"ldm.w","load multiple words from memory into registers"}, 
+  {"mla","multiply and accumulate"}, 
+  {"pop.w","load N words from stack into registers"}, 
+  {"ldaxp","load-acquire exclusive pair of registers"}, 
+  {"ldaxr","load-acquire exclusive register"}, 
+  {"andeq","logical AND if Z set (equal)"}, 
+  {"ldursb","load register signed byte (unscaled)"}, 
+  {"pacga","pointer authentication code, using generic key"}, 
+  {"hvc","hypervisor call"}, 
+  {"stc","store from coprocessor to memory"}, 
+  {"stclrlb","atomic bit clear on byte in memory, without return: an alias of ldclrb, ldclrab, ldclralb, ldclrlb"}, 
+  {"lduminab","atomic unsigned minimum on byte in memory"}, 
+  {"stf","armfpu: store float value pointed by reg+(offset): ldf [r0,#off]"}, 
+  {"sttrb","store register byte (unprivileged)"}, 
+  {"stg","store allocation tag"}, 
+  {"blo","variant of bcc"}, 
+  {"mls","multiply and substract"}, 
+  {"sttrh","store register halfword (unprivileged)"}, 
+  {"stclrlh","atomic bit clear on halfword in memory, without return: an alias of ldclrh, ldclrah, ldclralh, ldclrlh"}, 
+  {"stumaxlh","atomic unsigned maximum on halfword in memory, without return: an alias of ldumaxh, ldumaxah, ldumaxalh, ldumaxlh"}, 
+  {"lduminah","atomic unsigned minimum on halfword in memory"}, 
+  {"stm","store multiple registers to memory"}, 
+  {"str","store register into memory"}, 
+  {"staddb","atomic add on byte in memory, without return: an alias of ldaddb, ldaddab, ldaddalb, ldaddlb"}, 
+  {"lduminal","atomic unsigned minimum on word or doubleword in memory"}, 
+  {"wfs","armfpu: write fp status register. wfs r0"}, 
+  {"stumaxlb","atomic unsigned maximum on byte in memory, without return: an alias of ldumaxb, ldumaxab, ldumaxalb, ldumaxlb"}, 
+  {"stp","store register pairs in memory"}, 
+  {"ldsmina","atomic signed minimum on word or doubleword in memory"}, 
+  {"ble","branch if (Z || (N && V)) or !N && V) or !N && V"}, 
+  {"ldsminb","atomic signed minimum on byte in memory"}, 
+  {"stlxrb","store-release exclusive register byte"}, 
+  {"stgm","store tag multiple"}, 
+  {"ldsminl","atomic signed minimum on word or doubleword in memory"}, 
+  {"pssbb","physical speculative store bypass barrier: an alias of dsb"}, 
+  {"blx","branch link and optionally exchange to Thumb"}, 
+  {"ldsetal","atomic bit set on word or doubleword in memory"}, 
+  {"ldsminh","atomic signed minimum on halfword in memory"}, 
+  {"stsetb","atomic bit set on byte in memory, without return: an alias of ldsetb, ldsetab, ldsetalb, ldsetlb"}, 
+  {"stlxrh","store-release exclusive register halfword"}, 
+  {"staddh","atomic add on halfword in memory, without return: an alias of ldaddh, ldaddah, ldaddalh, ldaddlh"}, 
+  {"wfe","wait for event"}, 
+  {"crc32w","crc32 checksum"}, 
+  {"bls","branch if C clear or Z set"}, 
+  {"ldsetah","atomic bit set on halfword in memory"}, 
+  {"blr","branch with link to register"}, 
+  {"staddl","atomic add dword (arm v8.1)"}, 
+  {"brabz","variant of brabz"}, 
+  {"negs","negate, setting flags: an alias of subs"}, 
+  {"stseth","atomic bit set on halfword in memory, without return: an alias of ldseth, ldsetah, ldsetalh, ldsetlh"}, 
+  {"stgp","store allocation tag and pair of registers"}, 
+  {"bxj","branches and exchanges cpu mode to Jazzele (jumps to a bytecode vector)"}, 
+  {"ldsetab","atomic bit set on byte in memory"}, 
+  {"blt","branch if N clear and V set"}, 
+  {"stsetl","atomic bit set on word or doubleword in memory, without return: an alias of ldset, ldseta, ldsetal, ldsetl"}, 
+  {"bmi","branch if N set"}, 
+  {"wfi","wait for interrupt"}, 
+  {"crc32x","crc32 checksum"}, 
+  {"stumaxb","atomic unsigned maximum on byte in memory, without return: an alias of ldumaxb, ldumaxab, ldumaxalb, ldumaxlb"}, 
+  {"crc32b","crc32 checksum"}, 
+  {"paciza","pointer authentication code for instruction address, using key a"}, 
+  {"ldclralh","atomic bit clear on halfword in memory"}, 
+  {"pacizb","pointer authentication code for instruction address, using key b"}, 
+  {"ldapur","load-acquire rcpc register (unscaled)"}, 
+  {"swp","swap word or doubleword in memory"}, 
+  {"ldset","atomic bit set on word or doubleword in memory"}, 
+  {"stumaxh","atomic unsigned maximum on halfword in memory, without return: an alias of ldumaxh, ldumaxah, ldumaxalh, ldumaxlh"}, 
+  {"ldsmax","atomic signed maximum on word or doubleword in memory"}, 
+  {"adc","add with carry"}, 
+  {"add","add two values"}, 
+  {"setf16","evaluation of 8 or 16 bit flag values"}, 
+  {"stumaxl","atomic unsigned maximum on word or doubleword in memory, without return: an alias of ldumax, ldumaxa, ldumaxal, ldumaxl"}, 
+  {"crc32h","crc32 checksum"}, 
+  {"ldclralb","atomic bit clear on byte in memory"}, 
+  {"uxth","extracts bits[15:0] and zero extends to 32 bits."}, 
+  {"gmi","tag mask insert"}, 
+  {"ldmda","decrement after"}, 
+  {"ldmdb","decrement before"}, 
+  {"cset","conditional set: an alias of csinc"}, 
+  {"vadd","vector add"}, 
+  {"cpsid","like msr, but only disable interrupts (i or f)"}, 
+  {"braaz","variant of braa"}, 
+  {"cpsie","like msr, but only enable interrupts (i or f)"}, 
+  {"adr","form pc-relative address"}, 
+  {"uxtb","extracts bits[7:0] and zero extends to 32 bits."}, 
+  {"bvs","branch if V set"}, 
+  {"udiv","unsigned division"}, 
+  {"umaddl","unsigned multiply-add long"}, 
+  {"mvn","move bitwise NOT"}, 
+  {"rsbs.w","substract the negative value"}, 
+  {"ldsminlh","atomic signed minimum on halfword in memory"}, 
+  {"ldumaxal","atomic unsigned maximum on word or doubleword in memory"}, 
+  {"prfm","prefetch memory (literal)"}, 
+  {"eret","return from exception"}, 
+  {"ldumaxah","atomic unsigned maximum on halfword in memory"}, 
+  {"csneg","conditional select negation"}, 
+  {"stzg","store allocation tag, zeroing"}, 
+  {"ldaddalb","atomic add on byte in memory"}, 
+  {"sdiv","signed division"}, 
+  {"ldclr","atomic bit clear on word or doubleword in memory"}, 
+  {"bvc","branch if V clear"}, 
+  {"ldsminlb","atomic signed minimum on byte in memory"}, 
+  {"csel","conditional select"}, 
+  {"paciaz","pointer authentication code for instruction address, using key a"}, 
+  {"ldeoralh","atomic exclusive or on halfword in memory"}, 
+  {"ldeorab","atomic exclusive or on byte in memory"}, 
+  {"stur","store register (unscaled)"}, 
+  {"ldaddalh","atomic add on halfword in memory"}, 
+  {"stuminlb","atomic unsigned minimum on byte in memory, without return: an alias of lduminb, lduminab, lduminalb, lduminlb"}, 
+  {"ldeoral","atomic exclusive or on word or doubleword in memory"}, 
+  {"ldumaxab","atomic unsigned maximum on byte in memory"}, 
+  {"rmif","rotate, mask insert flags"}, 
+  {"ldeorah","atomic exclusive or on halfword in memory"}, 
+  {"ldtr","load register (unprivileged)"}, 
+  {"stuminlh","atomic unsigned minimum on halfword in memory, without return: an alias of lduminh, lduminah, lduminalh, lduminlh"}, 
+  {"stclrl","atomic bit clear on word or doubleword in memory, without return: an alias of ldclr, ldclra, ldclral, ldclrl"}, 
+  {"bfxil","bitfield extract and insert at low end: an alias of bfm"}, 
+  {"ldeoralb","atomic exclusive or on byte in memory"}, 
+  {"stclrh","atomic bit clear on halfword in memory, without return: an alias of ldclrh, ldclrah, ldclralh, ldclrlh"}, 
+  {"ubfiz","unsigned bitfield insert in zero: an alias of ubfm"}, 
+  {"subeq","substract two values if Z set (equal)"}, 
+  {"cbz","compare and branch on zero"}, 
+  {"stclrb","atomic bit clear on byte in memory, without return: an alias of ldclrb, ldclrab, ldclralb, ldclrlb"}, 
+  {"mul","multiply"}, 
+  {"addeq","add two values if Z set (equal)"}, 
+  {"clrex","clear exclusive"}, 
+  {"stllrb","store lorelease register byte"}, 
+  {"isb","instruction synchronization barrier."}, 
+  {"vldmia","vector load memory into paired registers"}, 
+  {"sttr","store register (unprivileged)"}, 
+  {"steorlb","atomic exclusive or on byte in memory, without return: an alias of ldeorb, ldeorab, ldeoralb, ldeorlb"}, 
+  {"stllrh","store lorelease register halfword"}, 
+  {"ldur","load register (unscaled)"}, 
+  {"smc","secure monitor call"}, 
+  {"udf","permanently undefined"}, 
+  {"ldapursh","load-acquire rcpc register signed halfword (unscaled)"}, 
+  {"stsmax","atomic signed maximum on word or doubleword in memory, without return: an alias of ldsmax, ldsmaxa, ldsmaxal, ldsmaxl"}, 
+  {"eretab","exception return, with pointer authentication"}, 
+  {"steorlh","atomic exclusive or on halfword in memory, without return: an alias of ldeorh, ldeorah, ldeoralh, ldeorlh"}, 
+  {"stadd","atomic add word (arm v8.1)"}, 
+  {"eretaa","exception return, with pointer authentication"}, 
+  {"umull","unsigned multiply long: an alias of umaddl"}, 
+  {"st64bv0","single-copy atomic 64-byte el0 store with return"}, 
+  {"bhi","branch if C set and Z clear"}, 
+  {"autda","authenticate data address, using key a"}, 
+  {"umulh","unsigned multiply high"}, 
+  {"ldclrab","atomic bit clear on byte in memory"}, 
+  {"ldapursb","load-acquire rcpc register signed byte (unscaled)"}, 
+  {"autdb","authenticate data address, using key b"}, 
+  {"casab","compare and swap byte in memory"}, 
+  {"sbfx","signed bit field extract"}, 
+  {"casal","compare and swap word or doubleword in memory"}, 
+  {"ldaddlb","atomic add on byte in memory"}, 
+  {"streq","store register into memory if Z set (equal)"}, 
+  {"ldclrah","atomic bit clear on halfword in memory"}, 
+  {"casah","compare and swap halfword in memory"}, 
+  {"sevl","send event local"}, 
+  {"blraa","brank and link with pointer authentication"}, 
+  {"ldclral","atomic bit clear on word or doubleword in memory"}, 
+  {"blrab","variants of blraa"}, 
+  {"ldaddlh","atomic add on halfword in memory"}, 
+  {"autizb","authenticate instruction address, using key b"}, 
+  {NULL, NULL}
+};
+// 0x556f0c43a160
+// TODO
+typedef int (*GperfForeachCallback)(void *user, const char *k, const char *v);
+int gperf_arm_foreach(GperfForeachCallback cb, void *user) {
+  int i = 0; while (kvs[i].name) {
+  cb (user, kvs[i].name, kvs[i].value);
+  i++;}
+  return 0;
+}
+const char *gperf_arm_get(const char *s) {
+  int i = 0; while (kvs[i].name) {
+  if (!strcmp (s, kvs[i].name)) return kvs[i].value;
+  i++;}
+  return NULL;
+}
+#define sdb_hash_c_arm(x,y) gperf_arm_hash(x)
+const unsigned int gperf_arm_hash(const char *s) {
+  int sum = strlen (s);
+  while (*s) { sum += *s; s++; }
+  return sum;
+}
+struct {const char *name;void *get;void *hash;void *foreach;} gperf_arm = {
+  .name = "arm",
+  .get = &gperf_arm_get,
+  .hash = &gperf_arm_hash,
+  .foreach = &gperf_arm_foreach
+};
+
+#if MAIN
+int main () {
+	const char *s = ((char*(*)(char*))gperf_arm.get)("foo");
+	printf ("%s\n", s);
+}
+#endif
@@ -0,0 +1,649 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+#include <r_bin.h>
+
+// Source line information is kept as a table of rows sorted by address.
+// File names are interned and the rows are encoded as deltas from the
+// previous one in blocks of ADDRLINE_BLOCK rows. The first address of each
+// block is kept apart, so a lookup binary searches the blocks and decodes a
+// single one. New rows are buffered and merged the next time it's read.
+
+#define ADDRLINE_BLOCK 64
+#define ADDRLINE_PENDING (1024 * 1024)
+// worst case size of an encoded row: address delta, file, line delta and column
+#define ADDRLINE_ROW_MAX (10 + 5 + 10 + 5)
+#define ADDRLINE_MAGIC "R2AL"
+#define ADDRLINE_VERSION 1
+// flags the pending rows that replace the previous ones at the same address
+#define ADDRLINE_REPLACE 0x80000000U
+
+typedef struct {
+	ut64 addr;
+	ut32 file;
+	ut32 line;
+	ut32 column;
+	ut32 seq; // insertion order, the first row added for an address wins unless replaced
+} AddrlineRow;
+
+typedef struct {
+	const ut8 *p;
+	const ut8 *end;
+	AddrlineRow row;
+	bool first;
+} AddrlineCursor;
+
+struct r_bin_addrline_store_t {
+	RPVector files; // interned file names
+	HtPU *ids; // file name -> index + 1
+	ut64 *baddr; // first address of each block
+	ut32 *boff; // offset of each block in data
+	ut8 *data;
+	ut32 size;
+	ut32 count;
+	ut32 nblocks;
+	AddrlineRow *pending;
+	ut32 npending;
+	ut32 mpending;
+	ut32 *byline; // row numbers sorted by file, line and address, built on demand
+	RThreadLock *lock;
+};
+
+static inline ut8 *put_uleb(ut8 *p, ut64 v) {
+	do {
+		ut8 b = v & 0x7f;
+		v >>= 7;
+		*p++ = v? (b | 0x80): b;
+	} while (v);
+	return p;
+}
+
+static inline const ut8 *get_uleb(const ut8 *p, const ut8 *end, ut64 *v) {
+	ut64 r = 0;
+	int shift = 0;
+	do {
+		if (p >= end || shift > 63) {
+			return NULL;
+		}
+		r |= (ut64)(*p & 0x7f) << shift;
+		shift += 7;
+	} while (*p++ & 0x80);
+	*v = r;
+	return p;
+}
+
+static ut8 *encode_row(ut8 *p, const AddrlineRow *row, const AddrlineRow *prev) {
+	const st64 dline = (st64)row->line - (prev? (st64)prev->line: 0);
+	p = put_uleb (p, prev? row->addr - prev->addr: 0);
+	p = put_uleb (p, row->file);
+	p = put_uleb (p, ((ut64)dline << 1) ^ (ut64)(dline >> 63));
+	return put_uleb (p, row->column);
+}
+
+static inline void cursor_init(AddrlineCursor *c, const RBinAddrLineStore *s, ut32 block) {
+	c->p = s->data + s->boff[block];
+	c->end = s->data + ((block + 1 < s->nblocks)? s->boff[block + 1]: s->size);
+	c->row.addr = s->baddr[block];
+	c->row.line = 0;
+	c->row.seq = block * ADDRLINE_BLOCK;
+	c->first = true;
+}
+
+static inline bool cursor_next(AddrlineCursor *c) {
+	ut64 daddr, file, dline, column;
+	if (c->p >= c->end
+			|| !(c->p = get_uleb (c->p, c->end, &daddr))
+			|| !(c->p = get_uleb (c->p, c->end, &file))
+			|| !(c->p = get_uleb (c->p, c->end, &dline))
+			|| !(c->p = get_uleb (c->p, c->end, &column))) {
+		c->p = c->end;
+		return false;
+	}
+	c->row.addr += daddr;
+	c->row.file = (ut32)file;
+	c->row.line += (ut32)((st64)(dline >> 1) ^ -(st64)(dline & 1));
+	c->row.column = (ut32)column;
+	if (!c->first) {
+		c->row.seq++;
+	}
+	c->first = false;
+	return true;
+}
+
+static int row_cmp(const void *a, const void *b) {
+	const AddrlineRow *ra = a, *rb = b;
+	if (ra->addr != rb->addr) {
+		return (ra->addr < rb->addr)? -1: 1;
+	}
+	const ut32 sa = ra->seq & ~ADDRLINE_REPLACE;
+	const ut32 sb = rb->seq & ~ADDRLINE_REPLACE;
+	return (sa < sb)? -1: (sa > sb);
+}
+
+static inline void row_fill(const RBinAddrLineStore *s, const AddrlineRow *r, RBinAddrline *out) {
+	out->addr = r->addr;
+	out->file = r_pvector_at (&s->files, r->file);
+	out->line = r->line;
+	out->column = r->column;
+}
+
+static void table_fini(RBinAddrLineStore *s) {
+	R_FREE (s->baddr);
+	R_FREE (s->boff);
+	R_FREE (s->data);
+	R_FREE (s->byline);
+	s->size = s->count = s->nblocks = 0;
+}
+
+// rows must be sorted by address without duplicates
+static bool table_encode(RBinAddrLineStore *s, const AddrlineRow *rows, ut32 count) {
+	const ut32 nblocks = (count + ADDRLINE_BLOCK - 1) / ADDRLINE_BLOCK;
+	ut64 *baddr = malloc (sizeof (ut64) * (nblocks + 1));
+	ut32 *boff = malloc (sizeof (ut32) * (nblocks + 1));
+	ut8 *data = malloc ((size_t)count * ADDRLINE_ROW_MAX + 1);
+	if (!baddr || !boff || !data) {
+		free (baddr);
+		free (boff);
+		free (data);
+		return false;
+	}
+	ut8 *p = data;
+	ut32 i;
+	for (i = 0; i < count; i++) {
+		if (!(i % ADDRLINE_BLOCK)) {
+			baddr[i / ADDRLINE_BLOCK] = rows[i].addr;
+			boff[i / ADDRLINE_BLOCK] = p - data;
+			p = encode_row (p, &rows[i], NULL);
+		} else {
+			p = encode_row (p, &rows[i], &rows[i - 1]);
+		}
+	}
+	const ut32 size = p - data;
+	ut8 *shrunk = realloc (data, size + 1);
+	if (shrunk) {
+		data = shrunk;
+	}
+	table_fini (s);
+	s->data = data;
+	s->size = size;
+	s->baddr = baddr;
+	s->boff = boff;
+	s->count = count;
+	s->nblocks = nblocks;
+	return true;
+}
+
+// decodes the whole table leaving room for extra rows at the end
+static AddrlineRow *table_decode(RBinAddrLineStore *s, ut32 extra) {
+	AddrlineRow *rows = malloc (sizeof (AddrlineRow) * ((size_t)s->count + extra + 1));
+	if (!rows) {
+		return NULL;
+	}
+	ut32 b, n = 0;
+	for (b = 0; b < s->nblocks; b++) {
+		AddrlineCursor c;
+		cursor_init (&c, s, b);
+		while (n < s->count && cursor_next (&c)) {
+			rows[n] = c.row;
+			rows[n].seq = n;
+			n++;
+		}
+	}
+	return rows;
+}
+
+static void table_flush(RBinAddrLineStore *s) {
+	if (!s->npending) {
+		return;
+	}
+	const ut32 count = s->count;
+	AddrlineRow *rows = table_decode (s, s->npending);
+	if (!rows) {
+		return;
+	}
+	ut32 i, n = 0;
+	for (i = 0; i < s->npending; i++) {
+		rows[count + i] = s->pending[i];
+		rows[count + i].seq = (count + i) | (s->pending[i].seq & ADDRLINE_REPLACE);
+	}
+	const ut32 total = count + s->npending;
+	qsort (rows, total, sizeof (AddrlineRow), row_cmp);
+	for (i = 0; i < total; i++) {
+		if (!n || rows[n - 1].addr != rows[i].addr) {
+			rows[n++] = rows[i];
+		} else if (rows[i].seq & ADDRLINE_REPLACE) {
+			rows[n - 1] = rows[i];
+		}
+	}
+	if (table_encode (s, rows, n)) {
+		R_FREE (s->pending);
+		s->npending = s->mpending = 0;
+	}
+	free (rows);
+}
+
+static bool row_at(RBinAddrLineStore *s, ut32 n, AddrlineRow *out) {
+	if (n >= s->count) {
+		return false;
+	}
+	AddrlineCursor c;
+	cursor_init (&c, s, n / ADDRLINE_BLOCK);
+	ut32 i;
+	for (i = 0; i <= n % ADDRLINE_BLOCK; i++) {
+		if (!cursor_next (&c)) {
+			return false;
+		}
+	}
+	*out = c.row;
+	return true;
+}
+
+static int line_cmp(const void *a, const void *b) {
+	const AddrlineRow *ra = a, *rb = b;
+	if (ra->file != rb->file) {
+		return (ra->file < rb->file)? -1: 1;
+	}
+	if (ra->line != rb->line) {
+		return (ra->line < rb->line)? -1: 1;
+	}
+	return (ra->addr < rb->addr)? -1: (ra->addr > rb->addr);
+}
+
+static bool byline_build(RBinAddrLineStore *s) {
+	if (s->byline) {
+		return true;
+	}
+	AddrlineRow *rows = table_decode (s, 0);
+	s->byline = malloc (sizeof (ut32) * ((size_t)s->count + 1));
+	if (!rows || !s->byline) {
+		free (rows);
+		R_FREE (s->byline);
+		return false;
+	}
+	qsort (rows, s->count, sizeof (AddrlineRow), line_cmp);
+	ut32 i;
+	for (i = 0; i < s->count; i++) {
+		s->byline[i] = rows[i].seq;
+	}
+	free (rows);
+	return true;
+}
+
+R_API RBinAddrLineStore *r_bin_addrline_store_new(void) {
+	RBinAddrLineStore *s = R_NEW0 (RBinAddrLineStore);
+	if (s) {
+		r_pvector_init (&s->files, free);
+		s->ids = ht_pu_new0 ();
+		s->lock = r_th_lock_new (true);
+		if (!s->ids || !s->lock) {
+			r_bin_addrline_store_free (s);
+			return NULL;
+		}
+	}
+	return s;
+}
+
+R_API void r_bin_addrline_store_free(RBinAddrLineStore *s) {
+	if (s) {
+		table_fini (s);
+		free (s->pending);
+		r_pvector_fini (&s->files);
+		ht_pu_free (s->ids);
+		r_th_lock_free (s->lock);
+		free (s);
+	}
+}
+
+R_API void r_bin_addrline_reset(RBinAddrLineStore *s) {
+	r_return_if_fail (s);
+	r_th_lock_enter (s->lock);
+	table_fini (s);
+	R_FREE (s->pending);
+	s->npending = s->mpending = 0;
+	r_pvector_clear (&s->files);
+	ht_pu_free (s->ids);
+	s->ids = ht_pu_new0 ();
+	r_th_lock_leave (s->lock);
+}
+
+static ut32 file_intern(RBinAddrLineStore *s, const char *file) {
+	bool found = false;
+	ut64 id = ht_pu_find (s->ids, file, &found);
+	if (found) {
+		return (ut32)(id - 1);
+	}
+	char *name = strdup (file);
+	if (!name || !r_pvector_push (&s->files, name)) {
+		free (name);
+		return UT32_MAX;
+	}
+	id = r_pvector_length (&s->files);
+	ht_pu_insert (s->ids, file, id);
+	return (ut32)(id - 1);
+}
+
+static bool addrline_push(RBinAddrLineStore *s, ut64 addr, const char *file, ut32 line, ut32 column, bool replace) {
+	bool res = false;
+	r_th_lock_enter (s->lock);
+	if (s->npending == s->mpending) {
+		if (s->npending >= ADDRLINE_PENDING) {
+			table_flush (s);
+		}
+		const ut32 m = s->mpending? s->mpending * 2: 256;
+		AddrlineRow *p = realloc (s->pending, sizeof (AddrlineRow) * m);
+		if (!p) {
+			goto beach;
+		}
+		s->pending = p;
+		s->mpending = m;
+	}
+	const ut32 id = file_intern (s, file);
+	if (id != UT32_MAX) {
+		AddrlineRow *row = &s->pending[s->npending++];
+		row->addr = addr;
+		row->file = id;
+		row->line = line;
+		row->column = column;
+		row->seq = replace? ADDRLINE_REPLACE: 0;
+		R_FREE (s->byline);
+		res = true;
+	}
+beach:
+	r_th_lock_leave (s->lock);
+	return res;
+}
+
+// keeps the row added first for an address, like the dwarf line programs expect
+R_API bool r_bin_addrline_add(RBinAddrLineStore *s, ut64 addr, const char *file, ut32 line, ut32 column) {
+	r_return_val_if_fail (s && file, false);
+	return addrline_push (s, addr, file, line, column, false);
+}
+
+R_API bool r_bin_addrline_set(RBinAddrLineStore *s, ut64 addr, const char *file, ut32 line, ut32 column) {
+	r_return_val_if_fail (s && file, false);
+	return addrline_push (s, addr, file, line, column, true);
+}
+
+R_API bool r_bin_addrline_del(RBinAddrLineStore *s, ut64 addr) {
+	r_return_val_if_fail (s, false);
+	bool res = false;
+	r_th_lock_enter (s->lock);
+	table_flush (s);
+	AddrlineRow *rows = table_decode (s, 0);
+	if (rows) {
+		ut32 i, n = 0;
+		for (i = 0; i < s->count; i++) {
+			if (rows[i].addr != addr) {
+				rows[n++] = rows[i];
+			}
+		}
+		res = n != s->count && table_encode (s, rows, n);
+		free (rows);
+	}
+	r_th_lock_leave (s->lock);
+	return res;
+}
+
+R_API bool r_bin_addrline_get(RBinAddrLineStore *s, ut64 addr, RBinAddrline *row) {
+	r_return_val_if_fail (s && row, false);
+	bool res = false;
+	r_th_lock_enter (s->lock);
+	table_flush (s);
+	if (s->nblocks && addr >= s->baddr[0]) {
+		ut32 lo = 0, hi = s->nblocks;
+		while (hi - lo > 1) {
+			const ut32 mid = lo + (hi - lo) / 2;
+			if (s->baddr[mid] <= addr) {
+				lo = mid;
+			} else {
+				hi = mid;
+			}
+		}
+		AddrlineCursor c;
+		cursor_init (&c, s, lo);
+		while (cursor_next (&c) && c.row.addr <= addr) {
+			if (c.row.addr == addr) {
+				row_fill (s, &c.row, row);
+				res = true;
+				break;
+			}
+		}
+	}
+	r_th_lock_leave (s->lock);
+	return res;
+}
+
+static bool find_line(RBinAddrLineStore *s, ut32 file, ut32 line, AddrlineRow *out) {
+	ut32 lo = 0, hi = s->count;
+	while (lo < hi) {
+		const ut32 mid = lo + (hi - lo) / 2;
+		AddrlineRow r;
+		if (!row_at (s, s->byline[mid], &r)) {
+			return false;
+		}
+		if (r.file < file || (r.file == file && r.line < line)) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo < s->count && row_at (s, s->byline[lo], out) && out->file == file && out->line == line;
+}
+
+// file can be the full path or just the basename, the lowest address wins
+R_API bool r_bin_addrline_find(RBinAddrLineStore *s, const char *file, ut32 line, RBinAddrline *row) {
+	r_return_val_if_fail (s && file && row, false);
+	bool res = false;
+	r_th_lock_enter (s->lock);
+	table_flush (s);
+	if (s->count && byline_build (s)) {
+		const char *base = r_file_basename (file);
+		AddrlineRow best = {0}, r;
+		void **it;
+		r_pvector_foreach (&s->files, it) {
+			const char *name = *it;
+			if (strcmp (name, file) && (base != file || strcmp (r_file_basename (name), base))) {
+				continue;
+			}
+			const ut32 id = it - (void **)s->files.v.a;
+			if (find_line (s, id, line, &r) && (!res || r.addr < best.addr)) {
+				best = r;
+				res = true;
+			}
+		}
+		if (res) {
+			row_fill (s, &best, row);
+		}
+	}
+	r_th_lock_leave (s->lock);
+	return res;
+}
+
+R_API bool r_bin_addrline_foreach(RBinAddrLineStore *s, RBinAddrlineCallback cb, void *user) {
+	r_return_val_if_fail (s && cb, false);
+	bool res = true;
+	r_th_lock_enter (s->lock);
+	table_flush (s);
+	ut32 b;
+	for (b = 0; res && b < s->nblocks; b++) {
+		AddrlineCursor c;
+		cursor_init (&c, s, b);
+		while (cursor_next (&c)) {
+			RBinAddrline row;
+			row_fill (s, &c.row, &row);
+			if (!cb (user, &row)) {
+				res = false;
+				break;
+			}
+		}
+	}
+	r_th_lock_leave (s->lock);
+	return res;
+}
+
+R_API ut32 r_bin_addrline_count(RBinAddrLineStore *s) {
+	r_return_val_if_fail (s, 0);
+	r_th_lock_enter (s->lock);
+	table_flush (s);
+	const ut32 count = s->count;
+	r_th_lock_leave (s->lock);
+	return count;
+}
+
+// names of the source files referenced by the rows, free text notes are skipped
+R_API RList *r_bin_addrline_files(RBinAddrLineStore *s) {
+	r_return_val_if_fail (s, NULL);
+	RList *list = r_list_newf (free);
+	if (!list) {
+		return NULL;
+	}
+	r_th_lock_enter (s->lock);
+	table_flush (s);
+	const ut32 nfiles = r_pvector_length (&s->files);
+	ut8 *used = calloc (nfiles + 1, 1);
+	if (used) {
+		ut32 b, i;
+		for (b = 0; b < s->nblocks; b++) {
+			AddrlineCursor c;
+			cursor_init (&c, s, b);
+			while (cursor_next (&c)) {
+				if (c.row.file < nfiles && c.row.line != R_BIN_ADDRLINE_TEXT) {
+					used[c.row.file] = 1;
+				}
+			}
+		}
+		for (i = 0; i < nfiles; i++) {
+			if (used[i]) {
+				r_list_append (list, strdup (r_pvector_at (&s->files, i)));
+			}
+		}
+		free (used);
+	}
+	r_th_lock_leave (s->lock);
+	return list;
+}
+
+// "R2AL" version nfiles names.. count nblocks size (addr off).. data
+R_API ut8 *r_bin_addrline_serialize(RBinAddrLineStore *s, ut32 *size) {
+	r_return_val_if_fail (s && size, NULL);
+	r_th_lock_enter (s->lock);
+	table_flush (s);
+	const ut32 nfiles = r_pvector_length (&s->files);
+	ut64 total = 4 + 4 * 5 + (ut64)s->nblocks * 12 + s->size;
+	ut32 i;
+	for (i = 0; i < nfiles; i++) {
+		total += strlen (r_pvector_at (&s->files, i)) + 1;
+	}
+	ut8 *buf = (total < UT32_MAX)? malloc (total): NULL;
+	if (buf) {
+		ut8 *p = buf;
+		memcpy (p, ADDRLINE_MAGIC, 4);
+		r_write_le32 (p + 4, ADDRLINE_VERSION);
+		r_write_le32 (p + 8, nfiles);
+		p += 12;
+		for (i = 0; i < nfiles; i++) {
+			const char *name = r_pvector_at (&s->files, i);
+			const size_t len = strlen (name) + 1;
+			memcpy (p, name, len);
+			p += len;
+		}
+		r_write_le32 (p, s->count);
+		r_write_le32 (p + 4, s->nblocks);
+		r_write_le32 (p + 8, s->size);
+		p += 12;
+		for (i = 0; i < s->nblocks; i++) {
+			r_write_le64 (p, s->baddr[i]);
+			r_write_le32 (p + 8, s->boff[i]);
+			p += 12;
+		}
+		if (s->size) {
+			memcpy (p, s->data, s->size);
+		}
+		*size = (ut32)total;
+	}
+	r_th_lock_leave (s->lock);
+	return buf;
+}
+
+static bool table_check(RBinAddrLineStore *s) {
+	const ut32 nfiles = r_pvector_length (&s->files);
+	ut32 b, n = 0;
+	ut64 last = 0;
+	for (b = 0; b < s->nblocks; b++) {
+		if (s->boff[b] >= s->size || (b && (s->boff[b] <= s->boff[b - 1] || s->baddr[b] <= last))) {
+			return false;
+		}
+		AddrlineCursor c;
+		cursor_init (&c, s, b);
+		ut32 rows = 0;
+		while (cursor_next (&c)) {
+			if (c.row.file >= nfiles || (rows && c.row.addr <= last) || ++rows > ADDRLINE_BLOCK) {
+				return false;
+			}
+			last = c.row.addr;
+		}
+		if (c.p != c.end || (rows != ADDRLINE_BLOCK && b + 1 < s->nblocks)) {
+			return false;
+		}
+		n += rows;
+	}
+	return n == s->count;
+}
+
+R_API bool r_bin_addrline_unserialize(RBinAddrLineStore *s, const ut8 *buf, ut32 size) {
+	r_return_val_if_fail (s && buf, false);
+	if (size < 12 || memcmp (buf, ADDRLINE_MAGIC, 4) || r_read_le32 (buf + 4) != ADDRLINE_VERSION) {
+		return false;
+	}
+	const ut8 *p = buf + 12;
+	const ut8 *end = buf + size;
+	const ut32 nfiles = r_read_le32 (buf + 8);
+	r_bin_addrline_reset (s);
+	r_th_lock_enter (s->lock);
+	bool res = false;
+	ut32 i;
+	for (i = 0; i < nfiles; i++) {
+		const ut8 *nul = memchr (p, 0, end - p);
+		if (!nul) {
+			goto beach;
+		}
+		char *name = strdup ((const char *)p);
+		if (!name || !r_pvector_push (&s->files, name)) {
+			free (name);
+			goto beach;
+		}
+		ht_pu_insert (s->ids, name, i + 1);
+		p = nul + 1;
+	}
+	if (end - p < 12) {
+		goto beach;
+	}
+	const ut32 count = r_read_le32 (p);
+	const ut32 nblocks = r_read_le32 (p + 4);
+	const ut32 dsize = r_read_le32 (p + 8);
+	p += 12;
+	if (nblocks != (count + ADDRLINE_BLOCK - 1) / ADDRLINE_BLOCK || (ut64)(end - p) != (ut64)nblocks * 12 + dsize) {
+		goto beach;
+	}
+	s->baddr = malloc (sizeof (ut64) * (nblocks + 1));
+	s->boff = malloc (sizeof (ut32) * (nblocks + 1));
+	s->data = malloc (dsize + 1);
+	if (!s->baddr || !s->boff || !s->data) {
+		goto beach;
+	}
+	for (i = 0; i < nblocks; i++) {
+		s->baddr[i] = r_read_le64 (p);
+		s->boff[i] = r_read_le32 (p + 8);
+		p += 12;
+	}
+	memcpy (s->data, p, dsize);
+	s->count = count;
+	s->nblocks = nblocks;
+	s->size = dsize;
+	res = table_check (s);
+beach:
+	r_th_lock_leave (s->lock);
+	if (!res) {
+		r_bin_addrline_reset (s);
+	}
+	return res;
+}
@@ -0,0 +1,370 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+#include <r_bin.h>
+#include <r_hash.h>
+#include "i/private.h"
+
+// On-disk cache of the lists returned by the bin plugins, enabled with bin.itemcache.
+// Every kind of item of a file is stored in its own file named after a hash of the
+// binary, one array per struct field followed by a table with the deduplicated strings,
+// so a hit just walks the mapped columns instead of running the plugin parser again.
+
+#define CACHE_MAGIC 0x63623272 // "r2bc"
+#define CACHE_VERSION 2
+
+enum {
+	COL_STR, // heap string owned by the item
+	COL_CSTR, // string that is never freed, kept in the RBin constpool
+	COL_U64,
+	COL_U32,
+	COL_BOOL,
+};
+
+typedef struct {
+	ut8 kind;
+	ut16 off;
+} CacheColumn;
+
+typedef struct {
+	const char *name;
+	size_t size;
+	RListFree free;
+	const CacheColumn *cols;
+	int ncols;
+} CacheKind;
+
+typedef struct {
+	ut32 magic;
+	ut32 version;
+	ut32 count;
+	ut32 ncols;
+	ut64 baddr;
+	ut64 loadaddr;
+	ut64 filesize;
+	ut64 strsz;
+	char plugin[32];
+	char kind[16];
+	char r2version[16]; // the plugins of another release may parse the file differently
+	char pversion[16];
+} CacheHeader;
+
+#define COL(k, t, f) { k, offsetof (t, f) }
+
+static const CacheColumn symbol_cols[] = {
+	COL (COL_STR, RBinSymbol, name),
+	COL (COL_STR, RBinSymbol, libname),
+	COL (COL_STR, RBinSymbol, classname),
+	COL (COL_CSTR, RBinSymbol, dname),
+	COL (COL_CSTR, RBinSymbol, forwarder),
+	COL (COL_CSTR, RBinSymbol, bind),
+	COL (COL_CSTR, RBinSymbol, type),
+	COL (COL_CSTR, RBinSymbol, rtype),
+	COL (COL_CSTR, RBinSymbol, visibility_str),
+	COL (COL_U64, RBinSymbol, vaddr),
+	COL (COL_U64, RBinSymbol, paddr),
+	COL (COL_U64, RBinSymbol, method_flags),
+	COL (COL_U32, RBinSymbol, size),
+	COL (COL_U32, RBinSymbol, ordinal),
+	COL (COL_U32, RBinSymbol, visibility),
+	COL (COL_U32, RBinSymbol, lang),
+	COL (COL_U32, RBinSymbol, bits),
+	COL (COL_BOOL, RBinSymbol, is_imported),
+};
+
+static const CacheColumn import_cols[] = {
+	COL (COL_STR, RBinImport, name),
+	COL (COL_STR, RBinImport, libname),
+	COL (COL_STR, RBinImport, classname),
+	COL (COL_STR, RBinImport, descriptor),
+	COL (COL_CSTR, RBinImport, bind),
+	COL (COL_CSTR, RBinImport, type),
+	COL (COL_U32, RBinImport, ordinal),
+	COL (COL_U32, RBinImport, visibility),
+};
+
+static const CacheColumn section_cols[] = {
+	COL (COL_STR, RBinSection, name),
+	COL (COL_STR, RBinSection, format),
+	COL (COL_CSTR, RBinSection, type),
+	COL (COL_CSTR, RBinSection, arch),
+	COL (COL_U64, RBinSection, size),
+	COL (COL_U64, RBinSection, vsize),
+	COL (COL_U64, RBinSection, vaddr),
+	COL (COL_U64, RBinSection, paddr),
+	COL (COL_U32, RBinSection, perm),
+	COL (COL_U32, RBinSection, bits),
+	COL (COL_BOOL, RBinSection, has_strings),
+	COL (COL_BOOL, RBinSection, add),
+	COL (COL_BOOL, RBinSection, is_data),
+	COL (COL_BOOL, RBinSection, is_segment),
+};
+
+static const CacheColumn entry_cols[] = {
+	COL (COL_U64, RBinAddr, vaddr),
+	COL (COL_U64, RBinAddr, paddr),
+	COL (COL_U64, RBinAddr, hvaddr),
+	COL (COL_U64, RBinAddr, hpaddr),
+	COL (COL_U32, RBinAddr, type),
+	COL (COL_U32, RBinAddr, bits),
+};
+
+static const CacheKind kinds[] = {
+	{ "symbols", sizeof (RBinSymbol), r_bin_symbol_free, symbol_cols, R_ARRAY_SIZE (symbol_cols) },
+	{ "imports", sizeof (RBinImport), (RListFree)r_bin_import_free, import_cols, R_ARRAY_SIZE (import_cols) },
+	{ "sections", sizeof (RBinSection), (RListFree)r_bin_section_free, section_cols, R_ARRAY_SIZE (section_cols) },
+	{ "entries", sizeof (RBinAddr), free, entry_cols, R_ARRAY_SIZE (entry_cols) },
+};
+
+static const CacheKind *cache_kind(const char *name) {
+	size_t i;
+	for (i = 0; i < R_ARRAY_SIZE (kinds); i++) {
+		if (!strcmp (kinds[i].name, name)) {
+			return &kinds[i];
+		}
+	}
+	return NULL;
+}
+
+static size_t column_width(const CacheColumn *col) {
+	switch (col->kind) {
+	case COL_U64:
+		return 8;
+	case COL_BOOL:
+		return 1;
+	default:
+		return 4; // numbers and offsets in the string table
+	}
+}
+
+static size_t columns_size(const CacheKind *k, ut32 count) {
+	size_t i, sz = 0;
+	for (i = 0; i < k->ncols; i++) {
+		sz += R_ROUND (column_width (&k->cols[i]) * count, 8);
+	}
+	return sz;
+}
+
+// sha1 over the xxhash of every 64K block of the file, a full sha1 costs more than
+// parsing most binaries. Computed once per RBinFile
+static const char *cache_key(RBinFile *bf) {
+	if (bf->itemkey) {
+		return bf->itemkey;
+	}
+	const ut64 size = r_buf_size (bf->buf);
+	const size_t blocksize = 0x10000;
+	ut8 *buf = malloc (blocksize);
+	RHash *ctx = r_hash_new (false, R_HASH_SHA1);
+	if (buf && ctx) {
+		ut64 at = 0;
+		while (at < size) {
+			st64 n = r_buf_read_at (bf->buf, at, buf, R_MIN (blocksize, size - at));
+			if (n < 1) {
+				break;
+			}
+			ut8 digest[4];
+			r_write_le32 (digest, r_hash_xxhash (buf, n));
+			r_hash_do_sha1 (ctx, digest, sizeof (digest));
+			at += n;
+		}
+		if (at == size) {
+			r_hash_do_end (ctx, R_HASH_SHA1);
+			bf->itemkey = r_hex_bin2strdup (ctx->digest, R_HASH_SIZE_SHA1);
+		}
+	}
+	r_hash_free (ctx);
+	free (buf);
+	return bf->itemkey;
+}
+
+static char *cache_path(RBinFile *bf, const CacheKind *k) {
+	const char *key = cache_key (bf);
+	if (!key) {
+		return NULL;
+	}
+	char *dir = r_xdg_cachedir ("bin");
+	char *path = dir? r_str_newf ("%s" R_SYS_DIR "%s.%s", dir, key, k->name): NULL;
+	free (dir);
+	return path;
+}
+
+static void cache_header(RBinFile *bf, RBinObject *bo, const CacheKind *k, CacheHeader *h) {
+	memset (h, 0, sizeof (CacheHeader));
+	h->magic = CACHE_MAGIC;
+	h->version = CACHE_VERSION;
+	h->ncols = k->ncols;
+	h->baddr = bo->baddr;
+	h->loadaddr = bo->loadaddr;
+	h->filesize = r_buf_size (bf->buf);
+	r_str_ncpy (h->plugin, bo->plugin->name, sizeof (h->plugin));
+	r_str_ncpy (h->kind, k->name, sizeof (h->kind));
+	r_str_ncpy (h->r2version, R2_VERSION, sizeof (h->r2version));
+	r_str_ncpy (h->pversion, r_str_get (bo->plugin->version), sizeof (h->pversion));
+}
+
+R_IPI RList *r_bin_cache_load(RBinFile *bf, RBinObject *bo, const char *kind) {
+	r_return_val_if_fail (bf && bo && kind, NULL);
+	const CacheKind *k = cache_kind (kind);
+	if (!bf->rbin->itemcache || !k) {
+		return NULL;
+	}
+	char *path = cache_path (bf, k);
+	RMmap *m = (path && r_file_exists (path))? r_file_mmap (path, false, 0): NULL;
+	free (path);
+	if (!m) {
+		return NULL;
+	}
+	RList *list = NULL;
+	CacheHeader h, want;
+	cache_header (bf, bo, k, &want);
+	if (m->len < sizeof (h)) {
+		goto beach;
+	}
+	memcpy (&h, m->buf, sizeof (h));
+	want.count = h.count;
+	want.strsz = h.strsz;
+	if (memcmp (&h, &want, sizeof (h))) {
+		goto beach;
+	}
+	const size_t colsz = columns_size (k, h.count);
+	if (h.strsz < 1 || sizeof (h) + colsz + h.strsz != m->len) {
+		goto beach;
+	}
+	const ut8 *col = m->buf + sizeof (h);
+	const char *strs = (const char *)col + colsz;
+	if (strs[h.strsz - 1]) {
+		goto beach;
+	}
+	list = r_list_newf (k->free);
+	ut8 **items = R_NEWS0 (ut8 *, h.count);
+	ut32 i, c;
+	if (!list || !items) {
+		free (items);
+		r_list_free (list);
+		list = NULL;
+		goto beach;
+	}
+	for (i = 0; i < h.count; i++) {
+		items[i] = calloc (1, k->size);
+		if (!items[i]) {
+			break;
+		}
+		r_list_append (list, items[i]);
+	}
+	if (i < h.count) {
+		free (items);
+		r_list_free (list);
+		list = NULL;
+		goto beach;
+	}
+	for (c = 0; c < k->ncols; c++) {
+		const CacheColumn *cc = &k->cols[c];
+		const size_t w = column_width (cc);
+		for (i = 0; i < h.count; i++) {
+			ut8 *field = items[i] + cc->off;
+			const ut8 *v = col + i * w;
+			if (cc->kind == COL_STR || cc->kind == COL_CSTR) {
+				ut32 o;
+				memcpy (&o, v, sizeof (o));
+				const char *s = (o && o < h.strsz)? strs + o: NULL;
+				const char *dup = s? (cc->kind == COL_STR)
+					? strdup (s): r_str_constpool_get (&bf->rbin->constpool, s): NULL;
+				memcpy (field, &dup, sizeof (dup));
+			} else {
+				memcpy (field, v, w);
+			}
+		}
+		col += R_ROUND (w * h.count, 8);
+	}
+	free (items);
+	R_LOG_DEBUG ("bin.itemcache: %u %s loaded from the cache", h.count, k->name);
+beach:
+	r_file_mmap_free (m);
+	return list;
+}
+
+// only the constant strings are deduplicated, names are mostly unique
+static ut32 cache_string(HtPU *seen, RStrBuf *sb, const char *s) {
+	if (!s) {
+		return 0;
+	}
+	bool found = false;
+	ut32 o = seen? (ut32)ht_pu_find (seen, s, &found): 0;
+	if (!found) {
+		o = r_strbuf_length (sb);
+		r_strbuf_append_n (sb, s, strlen (s) + 1);
+		if (seen) {
+			ht_pu_insert (seen, s, o);
+		}
+	}
+	return o;
+}
+
+R_IPI void r_bin_cache_save(RBinFile *bf, RBinObject *bo, const char *kind, RList *items) {
+	r_return_if_fail (bf && bo && kind);
+	const CacheKind *k = cache_kind (kind);
+	if (!bf->rbin->itemcache || !k || !items) {
+		return;
+	}
+	char *path = cache_path (bf, k);
+	char *dir = path? r_file_dirname (path): NULL;
+	if (!dir || !r_sys_mkdirp (dir)) {
+		free (dir);
+		free (path);
+		return;
+	}
+	free (dir);
+	CacheHeader h;
+	cache_header (bf, bo, k, &h);
+	h.count = r_list_length (items);
+	const size_t colsz = columns_size (k, h.count);
+	ut8 *cols = calloc (1, colsz + 1);
+	HtPU *seen = ht_pu_new0 ();
+	RStrBuf *sb = r_strbuf_new (NULL);
+	if (!cols || !seen || !sb) {
+		goto beach;
+	}
+	r_strbuf_append_n (sb, "", 1); // offset 0 is NULL
+	ut8 *col = cols;
+	ut32 c;
+	for (c = 0; c < k->ncols; c++) {
+		const CacheColumn *cc = &k->cols[c];
+		const size_t w = column_width (cc);
+		RListIter *iter;
+		ut8 *item;
+		ut8 *v = col;
+		r_list_foreach (items, iter, item) {
+			const ut8 *field = item + cc->off;
+			if (cc->kind == COL_STR || cc->kind == COL_CSTR) {
+				const char *s;
+				memcpy (&s, field, sizeof (s));
+				const ut32 o = cache_string ((cc->kind == COL_CSTR)? seen: NULL, sb, s);
+				memcpy (v, &o, sizeof (o));
+			} else {
+				memcpy (v, field, w);
+			}
+			v += w;
+		}
+		col += R_ROUND (w * h.count, 8);
+	}
+	h.strsz = r_strbuf_length (sb);
+	const size_t size = sizeof (h) + colsz + h.strsz;
+	ut8 *buf = (size < ST32_MAX)? malloc (size): NULL;
+	if (buf) {
+		memcpy (buf, &h, sizeof (h));
+		memcpy (buf + sizeof (h), cols, colsz);
+		memcpy (buf + sizeof (h) + colsz, r_strbuf_get (sb), h.strsz);
+		// write it aside first, other sessions may be mapping the old one
+		char *tmp = r_str_newf ("%s.%d", path, r_sys_getpid ());
+		if (tmp && r_file_dump (tmp, buf, size, false) && !r_file_move (tmp, path)) {
+			r_file_rm (tmp);
+		}
+		free (tmp);
+		free (buf);
+		R_LOG_DEBUG ("bin.itemcache: %u %s saved", h.count, k->name);
+	}
+beach:
+	r_strbuf_free (sb);
+	ht_pu_free (seen);
+	free (cols);
+	free (path);
+}
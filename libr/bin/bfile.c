@@ -2,11 +2,20 @@
 
 #include <r_bin.h>
 #include <r_hash.h>
+#include <sdb/ht_uu.h>
 #include "i/private.h"
 
 // maybe too big sometimes? 2KB of stack eaten here..
 #define R_STRING_SCAN_BUFFER_SIZE 2048
 #define R_STRING_MAX_UNI_BLOCKS 4
+// ranges are read in windows of this size instead of being loaded at once
+#define R_STRING_SCAN_WINDOW (1024 * 1024)
+// a rune takes up to 4 bytes, keep enough of them loaded to eat a whole string
+#define R_STRING_SCAN_MARGIN (4 * R_STRING_SCAN_BUFFER_SIZE + 64)
+// bigger ranges are split in chunks of this size when they are scanned in parallel
+#define R_STRING_SCAN_CHUNK (4 * 1024 * 1024)
+// loop positions recorded per chunk to find where the previous chunk joins it
+#define R_STRING_SCAN_SYNC 4096
 
 static RBinClass *__getClass(RBinFile *bf, const char *name) {
 	r_return_val_if_fail (bf && bf->o && bf->o->classes_ht && name, NULL);
@@ -103,88 +112,181 @@ static void print_string(RBinFile *bf, RBinString *string, int raw, PJ *pj) {
 	}
 }
 
-// TODO: this code must be implemented in RSearch as options for the strings mode
-static int string_scan_range(RList *list, RBinFile *bf, int min, const ut64 from, const ut64 to, int type, int raw, RBinSection *section) {
-	RBin *bin = bf->rbin;
-	const bool strings_nofp = bin->strings_nofp;
-	ut8 tmp[R_STRING_SCAN_BUFFER_SIZE];
-	ut64 str_start, needle = from;
-	int count = 0, i, rc, runes;
-	int str_type = R_STRING_TYPE_DETECT;
-
-	// if list is null it means its gonna dump
-	r_return_val_if_fail (bf, -1);
+typedef struct {
+	RBinFile *bf;
+	RList *list; // NULL when dumping
+	PJ *pj;
+	int min;
+	int type;
+	int raw;
+	ut64 from;
+	ut64 to;
+	RBinSection *section;
+	RBinSection *s; // section of the last string
+	st64 vdelta;
+	st64 pdelta;
+	int count;
+	bool strings_nofp;
+	bool skip; // the encoding allows jumping over binary data
+	struct str_chunk_t *chunks;
+	RThreadLock *lock; // serializes the reads done by the workers
+	RConsIsBreaked is_breaked;
+} StrScan;
+
+typedef struct {
+	ut8 *buf;
+	ut64 from; // file range loaded in buf
+	ut64 to;
+	ut64 size;
+} StrWindow;
+
+typedef struct str_chunk_t {
+	ut64 start;
+	ut64 stop;
+	ut64 end; // first loop position at or after stop
+	RList *strings; // the ordinal holds the loop iteration that found the string
+	HtUU *visits; // loop position -> iteration + 1, for the first iterations only
+} StrChunk;
+
+// bytes that can start a string when decoding ascii or utf8, the arithmetic
+// form lets the compiler check a whole block with vector instructions
+static inline ut8 is_text(ut8 b) {
+	return ((ut8)(b - 0x20) < 0x5f) | (b >= 0xc0) | ((ut8)(b - 7) < 7) | (b == 0x1b);
+}
 
-	if (type == -1) {
-		type = R_STRING_TYPE_DETECT;
+static ut64 skip_binary(const ut8 *p, ut64 len) {
+	ut64 i = 0;
+	while (i + 32 <= len) {
+		ut8 m = 0;
+		int j;
+		for (j = 0; j < 32; j++) {
+			m |= is_text (p[i + j]);
+		}
+		if (m) {
+			break;
+		}
+		i += 32;
 	}
-	if (from == UT64_MAX || from == to) {
-		return 0;
+	while (i < len && !is_text (p[i])) {
+		i++;
 	}
-	if (from > to) {
-		R_LOG_ERROR ("Invalid range to find strings 0x%"PFMT64x" .. 0x%"PFMT64x, from, to);
-		return -1;
+	return i;
+}
+
+// make sure the window covers the needle and enough bytes after it to eat a whole string
+static bool window_load(StrScan *ss, StrWindow *win, ut64 needle) {
+	if (needle >= win->from && (win->to == ss->to || needle + R_STRING_SCAN_MARGIN <= win->to)) {
+		return true;
 	}
-	st64 len = (st64)(to - from);
-	if (len < 1 || len > ST32_MAX) {
-		R_LOG_ERROR ("String scan range is invalid (%"PFMT64d" bytes)", len);
-		return -1;
+	// keep a few bytes behind the needle to find the BOM of wide strings
+	const ut64 from = (needle - ss->from > 8)? needle - 8: ss->from;
+	const ut64 len = R_MIN (win->size, ss->to - from);
+	if (ss->lock) {
+		r_th_lock_enter (ss->lock);
 	}
-	ut8 *buf = calloc (len, 1);
-	if (!buf || !min) {
-		free (buf);
-		return -1;
+	st64 r = r_buf_read_at (ss->bf->buf, from, win->buf, len);
+	if (ss->lock) {
+		r_th_lock_leave (ss->lock);
 	}
-	st64 vdelta = 0, pdelta = 0;
-	RBinSection *s = NULL;
-	bool ascii_only = false;
-	PJ *pj = NULL;
-	if (bf->strmode == R_MODE_JSON && !list) {
-		pj = pj_new ();
-		if (pj) {
-			pj_a (pj);
+	if (r < (st64)len) {
+		r = R_MAX (r, 0);
+		memset (win->buf + r, 0, len - r);
+	}
+	win->from = from;
+	win->to = from + len;
+	return true;
+}
+
+static void string_emit(StrScan *ss, RBinString *bs) {
+	RBinFile *bf = ss->bf;
+	ut64 str_start = bs->paddr; // offset in the file until here
+	if (!ss->s) {
+		if (ss->section) {
+			ss->s = ss->section;
+		} else if (bf->o) {
+			ss->s = r_bin_get_section_at (bf->o, str_start, false);
+		}
+		if (ss->s) {
+			ss->vdelta = ss->s->vaddr;
+			ss->pdelta = ss->s->paddr;
 		}
 	}
-	r_buf_read_at (bf->buf, from, buf, len);
-	char *charset = r_sys_getenv ("RABIN2_CHARSET");
-	if (!R_STR_ISEMPTY (charset)) {
-		RCharset *ch = r_charset_new ();
-		if (r_charset_use (ch, charset)) {
-			int outlen = len * 4;
-			ut8 *out = calloc (len, 4);
-			if (out) {
-				int res = r_charset_encode_str (ch, out, outlen, buf, len);
-				int i;
-				// TODO unknown chars should be translated to null bytes
-				for (i = 0; i < res; i++) {
-					if (out[i] == '?') {
-						out[i] = 0;
-					}
-				}
-				free (buf);
-				buf = out;
-			}
-		} else {
-			R_LOG_ERROR ("Invalid value for RABIN2_CHARSET");
+	ut64 baddr = bf->loadaddr && bf->o? bf->o->baddr: bf->loadaddr;
+	bs->paddr = str_start + baddr;
+	bs->vaddr = str_start - ss->pdelta + ss->vdelta + baddr;
+	bs->ordinal = ss->count++;
+	if (ss->list) {
+		r_list_append (ss->list, bs);
+		if (bf->o) {
+			ht_up_insert (bf->o->strings_db, bs->vaddr, bs);
 		}
-		r_charset_free (ch);
+	} else {
+		print_string (bf, bs, ss->raw, ss->pj);
+		r_bin_string_free (bs);
 	}
-	free (charset);
-	RConsIsBreaked is_breaked = (bin && bin->consb.is_breaked)? bin->consb.is_breaked: NULL;
+	if (ss->from == 0 && ss->to == bf->size) {
+		/* force lookup section at the next one */
+		ss->s = NULL;
+	}
+}
+
+// Walk the loop positions from needle until one is past stop and return it.
+// Strings are emitted as they are found, or collected in own when running on a
+// worker. When join is given the walk stops at the first position visited by
+// that chunk scan, from there on both are the same and *at gets its iteration
+#define AT(x) (win->buf + ((x) - win->from))
+static ut64 string_scan(StrScan *ss, StrWindow *win, ut64 needle, ut64 stop, StrChunk *own, StrChunk *join, ut32 *at) {
+	const ut64 from = ss->from;
+	const ut64 to = ss->to;
+	const int min = ss->min;
+	const int type = ss->type;
+	const bool strings_nofp = ss->strings_nofp;
+	ut8 tmp[R_STRING_SCAN_BUFFER_SIZE];
+	ut64 str_start;
+	int i, rc, runes;
+	int str_type = R_STRING_TYPE_DETECT;
+	bool ascii_only = false;
+	ut32 iter = 0;
+	RConsIsBreaked is_breaked = own? NULL: ss->is_breaked;
+
 	// may oobread
 	while (needle < to && needle < UT64_MAX - 4) {
 		if (is_breaked && is_breaked ()) {
 			break;
 		}
+		window_load (ss, win, needle);
+		if (!ascii_only) {
+			if (ss->skip) {
+				needle += skip_binary (AT (needle), win->to - needle);
+				if (needle >= to) {
+					break;
+				}
+				window_load (ss, win, needle);
+			}
+			if (needle >= stop) {
+				break;
+			}
+			if (own && iter < R_STRING_SCAN_SYNC) {
+				ht_uu_insert (own->visits, needle, iter + 1);
+			} else if (join) {
+				bool found = false;
+				ut64 n = ht_uu_find (join->visits, needle, &found);
+				if (found) {
+					*at = (ut32)n;
+					return needle;
+				}
+			}
+			iter++;
+		}
 		// smol optimization
 		if (to > 4 && needle < to - 4) {
-			ut32 n1 = r_read_le32 (buf + (needle - from));
+			ut32 n1 = r_read_le32 (AT (needle));
 			if (!n1) {
 				needle += 4;
 				continue;
 			}
 		}
-		rc = r_utf8_decode (buf + (needle - from), to - needle, NULL);
+		rc = r_utf8_decode (AT (needle), win->to - needle, NULL);
 		if (!rc) {
 			needle++;
 			continue;
@@ -192,7 +294,7 @@ static int string_scan_range(RList *list, RBinFile *bf, int min, const ut64 from
 		bool addr_aligned = !(needle % 4);
 
 		if (type == R_STRING_TYPE_DETECT) {
-			char *w = (char *)buf + (needle + rc - from);
+			char *w = (char *)AT (needle + rc);
 			if (((to - needle) > 8 + rc)) {
 				// TODO: support le and be
 				bool is_wide32le = (needle + rc + 2 < to) && (!w[0] && !w[1] && !w[2] && w[3] && !w[4]);
@@ -232,17 +334,17 @@ static int string_scan_range(RList *list, RBinFile *bf, int min, const ut64 from
 		for (i = 0; i < sizeof (tmp) - 4 && needle < to; i += rc) {
 			RRune r = {0};
 			if (str_type == R_STRING_TYPE_WIDE32) {
-				rc = r_utf32le_decode (buf + needle - from, to - needle, &r);
+				rc = r_utf32le_decode (AT (needle), win->to - needle, &r);
 				if (rc) {
 					rc = 4;
 				}
 			} else if (str_type == R_STRING_TYPE_WIDE) {
-				rc = r_utf16le_decode (buf + needle - from, to - needle, &r);
+				rc = r_utf16le_decode (AT (needle), win->to - needle, &r);
 				if (rc == 1) {
 					rc = 2;
 				}
 			} else {
-				rc = r_utf8_decode (buf + (needle - from), to - needle, &r);
+				rc = r_utf8_decode (AT (needle), win->to - needle, &r);
 				if (rc > 1) {
 					str_type = R_STRING_TYPE_UTF8;
 				}
@@ -361,12 +463,11 @@ static int string_scan_range(RList *list, RBinFile *bf, int min, const ut64 from
 			bs->type = str_type;
 			bs->length = runes;
 			bs->size = needle - str_start;
-			bs->ordinal = count++;
 			// TODO: move into adjust_offset
 			switch (str_type) {
 			case R_STRING_TYPE_WIDE:
 				if (str_start - from > 1) {
-					const ut8 *p = buf + str_start - 2 - from;
+					const ut8 *p = AT (str_start - 2);
 					if (p[0] == 0xff && p[1] == 0xfe) {
 						str_start -= 2; // \xff\xfe
 					}
@@ -374,49 +475,204 @@ static int string_scan_range(RList *list, RBinFile *bf, int min, const ut64 from
 				break;
 			case R_STRING_TYPE_WIDE32:
 				if (str_start - from > 3) {
-					const ut8 *p = buf + str_start - 4 - from;
+					const ut8 *p = AT (str_start - 4);
 					if (p[0] == 0xff && p[1] == 0xfe) {
 						str_start -= 4; // \xff\xfe\x00\x00
 					}
 				}
 				break;
 			}
-			if (!s) {
-				if (section) {
-					s = section;
-				} else if (bf->o) {
-					s = r_bin_get_section_at (bf->o, str_start, false);
-				}
-				if (s) {
-					vdelta = s->vaddr;
-					pdelta = s->paddr;
-				}
-			}
-			ut64 baddr = bf->loadaddr && bf->o? bf->o->baddr: bf->loadaddr;
-			bs->paddr = str_start + baddr;
-			bs->vaddr = str_start - pdelta + vdelta + baddr;
+			bs->paddr = str_start;
 			bs->string = r_str_ndup ((const char *)tmp, i); // Use stringviews to save memory
 			if (strings_nofp) {
 				r_str_trim (bs->string); // trim spaces to ease readability
 			}
-			if (list) {
-				r_list_append (list, bs);
-				if (bf->o) {
-					ht_up_insert (bf->o->strings_db, bs->vaddr, bs);
-				}
+			if (own) {
+				bs->ordinal = iter - 1;
+				r_list_append (own->strings, bs);
 			} else {
-				print_string (bf, bs, raw, pj);
-				r_bin_string_free (bs);
-			}
-			if (from == 0 && to == bf->size) {
-				/* force lookup section at the next one */
-				s = NULL;
+				string_emit (ss, bs);
 			}
 		}
 		ascii_only = false;
 	}
-	free (buf);
-	if (pj) {
+	return needle;
+}
+#undef AT
+
+static void string_scan_chunks(void *user, size_t from, size_t to) {
+	StrScan *ss = user;
+	StrWindow win = {0};
+	win.size = R_STRING_SCAN_WINDOW;
+	win.buf = malloc (win.size);
+	if (!win.buf) {
+		return;
+	}
+	size_t i;
+	for (i = from; i < to; i++) {
+		StrChunk *c = &ss->chunks[i];
+		win.from = win.to = 0;
+		c->end = string_scan (ss, &win, c->start, c->stop, c, NULL, NULL);
+	}
+	free (win.buf);
+}
+
+// Scan the chunks on the workers of the pool, a few at a time to bound the memory
+// used by the strings not yet emitted. Each worker starts at the beginning of its
+// chunk, which may be in the middle of a string, so the calling thread resumes the
+// scan where the previous chunk ended until it reaches a position that the worker
+// also visited, and only takes the strings found from that point on
+static void string_scan_parallel(StrScan *ss, StrWindow *win, RThreadPool *pool, int workers) {
+	const ut64 len = ss->to - ss->from;
+	const int nchunks = (int)((len + R_STRING_SCAN_CHUNK - 1) / R_STRING_SCAN_CHUNK);
+	const int batch = workers * 2;
+	ss->chunks = R_NEWS0 (StrChunk, batch);
+	ss->lock = r_th_lock_new (false);
+	if (!ss->chunks || !ss->lock) {
+		goto beach;
+	}
+	ut64 needle = ss->from;
+	int i, b;
+	for (b = 0; b < nchunks; b += batch) {
+		const int n = R_MIN (batch, nchunks - b);
+		for (i = 0; i < n; i++) {
+			StrChunk *c = &ss->chunks[i];
+			c->start = ss->from + (ut64)(b + i) * R_STRING_SCAN_CHUNK;
+			c->stop = R_MIN (c->start + R_STRING_SCAN_CHUNK, ss->to);
+			c->strings = r_list_new ();
+			c->visits = ht_uu_new0 ();
+		}
+		// two chunks per task keeps the scan on at most workers threads
+		r_th_parallel_for (pool, 0, n, 2, string_scan_chunks, ss);
+		for (i = 0; i < n; i++) {
+			StrChunk *c = &ss->chunks[i];
+			ut32 at = 0;
+			needle = string_scan (ss, win, needle, c->stop, NULL, c, &at);
+			RListIter *iter;
+			RBinString *bs;
+			r_list_foreach (c->strings, iter, bs) {
+				if (at && bs->ordinal + 1 >= at) {
+					string_emit (ss, bs);
+				} else {
+					r_bin_string_free (bs);
+				}
+			}
+			if (at) {
+				needle = c->end;
+			}
+			r_list_free (c->strings);
+			ht_uu_free (c->visits);
+		}
+		if (ss->is_breaked && ss->is_breaked ()) {
+			break;
+		}
+	}
+beach:
+	free (ss->chunks);
+	ss->chunks = NULL;
+	r_th_lock_free (ss->lock);
+	ss->lock = NULL;
+}
+
+// TODO: this code must be implemented in RSearch as options for the strings mode
+static int string_scan_range(RList *list, RBinFile *bf, int min, const ut64 from, const ut64 to, int type, int raw, RBinSection *section) {
+	RBin *bin = bf->rbin;
+
+	// if list is null it means its gonna dump
+	r_return_val_if_fail (bf, -1);
+
+	if (type == -1) {
+		type = R_STRING_TYPE_DETECT;
+	}
+	if (from == UT64_MAX || from == to) {
+		return 0;
+	}
+	if (from > to) {
+		R_LOG_ERROR ("Invalid range to find strings 0x%"PFMT64x" .. 0x%"PFMT64x, from, to);
+		return -1;
+	}
+	st64 len = (st64)(to - from);
+	if (len < 1 || !min) {
+		return -1;
+	}
+	StrScan ss = {
+		.bf = bf,
+		.list = list,
+		.min = min,
+		.type = type,
+		.raw = raw,
+		.from = from,
+		.to = to,
+		.section = section,
+		.strings_nofp = bin->strings_nofp,
+		.skip = type == R_STRING_TYPE_DETECT || type == R_STRING_TYPE_ASCII || type == R_STRING_TYPE_UTF8,
+		.is_breaked = (bin && bin->consb.is_breaked)? bin->consb.is_breaked: NULL
+	};
+	StrWindow win = {0};
+	char *charset = r_sys_getenv ("RABIN2_CHARSET");
+	if (!R_STR_ISEMPTY (charset)) {
+		// the charset is decoded for the whole range at once
+		if (len > ST32_MAX) {
+			R_LOG_ERROR ("String scan range is invalid (%"PFMT64d" bytes)", len);
+			free (charset);
+			return -1;
+		}
+		ut8 *buf = calloc (len, 1);
+		if (!buf) {
+			free (charset);
+			return -1;
+		}
+		r_buf_read_at (bf->buf, from, buf, len);
+		RCharset *ch = r_charset_new ();
+		if (r_charset_use (ch, charset)) {
+			int outlen = len * 4;
+			ut8 *out = calloc (len, 4);
+			if (out) {
+				int res = r_charset_encode_str (ch, out, outlen, buf, len);
+				int i;
+				// TODO unknown chars should be translated to null bytes
+				for (i = 0; i < res; i++) {
+					if (out[i] == '?') {
+						out[i] = 0;
+					}
+				}
+				free (buf);
+				buf = out;
+			}
+		} else {
+			R_LOG_ERROR ("Invalid value for RABIN2_CHARSET");
+		}
+		r_charset_free (ch);
+		win.buf = buf;
+		win.from = from;
+		win.to = to;
+		win.size = len;
+	} else {
+		win.size = R_MIN (len, R_STRING_SCAN_WINDOW);
+		win.buf = malloc (win.size);
+		if (!win.buf) {
+			free (charset);
+			return -1;
+		}
+		win.from = win.to = UT64_MAX;
+	}
+	if (bf->strmode == R_MODE_JSON && !list) {
+		ss.pj = pj_new ();
+		if (ss.pj) {
+			pj_a (ss.pj);
+		}
+	}
+	const int threads = bin->strthreads;
+	RThreadPool *pool = (threads != 1)? bin->pool: NULL;
+	if (pool && pool->size > 1 && win.size < len && len > 2 * R_STRING_SCAN_CHUNK) {
+		string_scan_parallel (&ss, &win, pool, (threads > 1)? R_MIN (threads, pool->size): pool->size);
+	} else {
+		string_scan (&ss, &win, from, to, NULL, NULL, NULL);
+	}
+	free (charset);
+	free (win.buf);
+	if (ss.pj) {
+		PJ *pj = ss.pj;
 		pj_end (pj);
 		if (bin) {
 			RIO *io = bin->iob.io;
@@ -426,7 +682,7 @@ static int string_scan_range(RList *list, RBinFile *bf, int min, const ut64 from
 		}
 		pj_free (pj);
 	}
-	return count;
+	return ss.count;
 }
 
 static bool __isDataSection(RBinFile *a, RBinSection *s) {
@@ -522,6 +778,8 @@ R_IPI RBinFile *r_bin_file_new(RBin *bin, const char *file, ut64 file_sz, int ra
 		bf->sdb = sdb_new0 ();
 		bf->sdb_addrinfo = sdb_new0 (); // ns (bf->sdb, "addrinfo", 1);
 		// bf->sdb_addrinfo->refs++;
+		bf->addrline = r_bin_addrline_store_new ();
+		bf->demangled_lock = r_th_lock_new (false);
 	}
 	return bf;
 }
@@ -740,7 +998,8 @@ R_IPI bool r_bin_file_set_obj(RBin *bin, RBinFile *bf, RBinObject *obj) {
 			R_LOG_DEBUG ("bin object have no information");
 			return false;
 		}
-		if (!obj->info->lang) {
+		// otherwise its set when the language is loaded
+		if (!obj->info->lang && (obj->loaded & (1U << R_BIN_ITEM_LANG))) {
 			obj->info->lang = r_bin_lang_tostring (obj->lang);
 		}
 	}
@@ -767,6 +1026,24 @@ R_API bool r_bin_file_deref(RBin *bin, RBinFile *a) {
 	return true;
 }
 
+// sdb_ns_unset only unlinks the namespace, release it and the reference taken by sdb_ns_set
+static bool ns_drop(Sdb *s, const char *name, Sdb *r) {
+	SdbListIter *it;
+	SdbNs *ns;
+	ls_foreach_cast (s->ns, it, SdbNs*, ns) {
+		if ((name && !strcmp (name, ns->name)) || (r && ns->sdb == r)) {
+			if (!sdb_ns_unset (s, ns->name, NULL)) {
+				return false;
+			}
+			sdb_free (ns->sdb);
+			sdb_gh_free (ns->name);
+			sdb_gh_free (ns);
+			return true;
+		}
+	}
+	return false;
+}
+
 R_API void r_bin_file_free(void /*RBinFile*/ *_bf) {
 	if (!_bf) {
 		return;
@@ -783,11 +1060,25 @@ R_API void r_bin_file_free(void /*RBinFile*/ *_bf) {
 	if (bf->curxtr && bf->curxtr->destroy && bf->xtr_obj) {
 		bf->curxtr->free_xtr ((void *)(bf->xtr_obj));
 	}
-	// TODO: unset related sdb namespaces
+	// drop the namespaces r_bin_object_new links this file with, or the root sdb keeps it alive
+	Sdb *root = bf->rbin->sdb;
+	while (root && ns_drop (root, NULL, bf->sdb)) {
+		;
+	}
+	ns_drop (bf->sdb, "info", NULL);
+	ns_drop (bf->sdb, "addrinfo", NULL);
 	if (bf->sdb_addrinfo) {
 		sdb_free (bf->sdb_addrinfo);
 		bf->sdb_addrinfo = NULL;
 	}
+	r_bin_addrline_store_free (bf->addrline);
+	r_bin_dwarf_cu_index_free (bf->dwarf_index);
+	if (bf->demangled) {
+		ht_pp_free (bf->demangled);
+		r_str_constpool_fini (&bf->demangled_names);
+	}
+	r_th_lock_free (bf->demangled_lock);
+	free (bf->itemkey);
 	free (bf->file);
 	r_bin_object_free (bf->o);
 	r_list_free (bf->xtr_data);
@@ -796,6 +1087,7 @@ R_API void r_bin_file_free(void /*RBinFile*/ *_bf) {
 		r_id_pool_kick_id (bf->rbin->ids->pool, bf->id);
 	}
 	(void) r_bin_object_delete (bf->rbin, bf->id);
+	sdb_free (bf->sdb);
 	free (bf);
 }
 
@@ -1071,6 +1363,10 @@ R_IPI void r_bin_class_free(RBinClass *k) {
 
 R_API RBinClass *r_bin_file_add_class(RBinFile *bf, const char *name, const char *super, int view) {
 	r_return_val_if_fail (name && bf && bf->o, NULL);
+	if (bf->o->plugin) {
+		// the classes from the plugin replace the list when they are loaded
+		r_bin_object_load_item (bf, bf->o, R_BIN_ITEM_CLASSES);
+	}
 	RBinClass *c = __getClass (bf, name);
 	if (c) {
 		if (super) {
@@ -1143,6 +1439,9 @@ R_API RList *r_bin_file_get_trycatch(RBinFile *bf) {
 R_API RList *r_bin_file_get_symbols(RBinFile *bf) {
 	r_return_val_if_fail (bf, NULL);
 	RBinObject *o = bf->o;
+	if (o && o->plugin) {
+		r_bin_object_load_item (bf, o, R_BIN_ITEM_SYMBOLS);
+	}
 	return o? o->symbols: NULL;
 }
 
@@ -1153,11 +1452,18 @@ R_API RBinFile *r_bin_file_open(RBin *bin, const char *file, RBinFileOptions *op
 	return NULL;
 }
 
+static bool addrline_merge_cb(void *user, const RBinAddrline *row) {
+	return r_bin_addrline_add ((RBinAddrLineStore *)user, row->addr, row->file, row->line, row->column);
+}
+
 // TODO Improve this API
 R_API void r_bin_file_merge(RBinFile *dst, RBinFile *src) {
 	// merge imports
 	// merge dbginfo
 	sdb_merge (dst->o->kv, src->o->kv);
 	sdb_merge (dst->sdb_addrinfo, src->sdb_addrinfo);
+	if (dst->addrline && src->addrline) {
+		r_bin_addrline_foreach (src->addrline, addrline_merge_cb, dst->addrline);
+	}
 	sdb_merge (dst->sdb_info, src->sdb_info);
 }
@@ -77,70 +77,120 @@ R_API char *r_bin_filter_name(RBinFile *bf, HtPU *db, ut64 vaddr, char *name) {
 	return resname;
 }
 
-R_API void r_bin_filter_sym(RBinFile *bf, HtPP *ht, ut64 vaddr, RBinSymbol *sym) {
-	r_return_if_fail (ht && sym && sym->name);
-	const char *name = sym->name;
-	// if (!strncmp (sym->name, "imp.", 4)) {
-	// demangle symbol name depending on the language specs if any
-	if (bf && bf->o && bf->o->lang) {
-		const char *lang = r_bin_lang_tostring (bf->o->lang);
-		char *dn = r_bin_demangle (bf, lang, sym->name, sym->vaddr, false);
-		if (dn && *dn) {
-			sym->dname = dn;
-			// XXX this is wrong but is required for this test to pass
-			// pmb:new pancake$ bin/r2r.js db/formats/mangling/swift
-			sym->name = dn;
-			// extract class information from demangled symbol name
-			char *p = strchr (dn, '.');
-			if (p) {
-				if (IS_UPPER (*dn)) {
-					sym->classname = strdup (dn);
-					sym->classname[p - dn] = 0;
-				} else if (IS_UPPER (p[1])) {
-					sym->classname = strdup (p + 1);
-					p = strchr (sym->classname, '.');
-					if (p) {
-						*p = 0;
-					}
+static void filter_demangle(RBinFile *bf, const char *lang, RBinSymbol *sym) {
+	char *dn = r_bin_demangle (bf, lang, sym->name, sym->vaddr, false);
+	if (dn && *dn) {
+		sym->dname = dn;
+		// XXX this is wrong but is required for this test to pass
+		// pmb:new pancake$ bin/r2r.js db/formats/mangling/swift
+		sym->name = dn;
+		// extract class information from demangled symbol name
+		char *p = strchr (dn, '.');
+		if (p) {
+			if (IS_UPPER (*dn)) {
+				sym->classname = strdup (dn);
+				sym->classname[p - dn] = 0;
+			} else if (IS_UPPER (p[1])) {
+				sym->classname = strdup (p + 1);
+				p = strchr (sym->classname, '.');
+				if (p) {
+					*p = 0;
 				}
 			}
 		}
 	}
+}
 
-	r_strf_var (uname, 256, "%" PFMT64x ".%c.%s", vaddr, sym->is_imported ? 'i' : 's', name);
-	bool res = ht_pp_insert (ht, uname, sym);
-	if (!res) {
+// one symbol at a time, the caller keeps the names seen in ht between the calls.
+// r_bin_filter_symbols does the same for a whole list without building the keys
+R_API void r_bin_filter_sym(RBinFile *bf, HtPP *ht, ut64 vaddr, RBinSymbol *sym) {
+	r_return_if_fail (ht && sym && sym->name);
+	const char type = sym->is_imported ? 'i' : 's';
+	r_strf_var (uname, 256, "%" PFMT64x ".%c.%s", vaddr, type, sym->name);
+	if (!ht_pp_insert (ht, uname, sym)) {
 		return;
 	}
-	sym->dup_count = 0;
+	r_strf_var (oname, 256, "o.0.%c.%s", type, sym->name);
+	RBinSymbol *prev = ht_pp_find (ht, oname, NULL);
+	sym->dup_count = prev? prev->dup_count + 1: 0;
+	ht_pp_update (ht, oname, sym);
+	if (bf && bf->o && bf->o->lang) {
+		filter_demangle (bf, r_bin_lang_tostring (bf->o->lang), sym);
+	}
+}
+
+// open addressing table sized once for the whole list, no key strings are built
+typedef struct {
+	RBinSymbol *sym;
+	ut32 hash;
+	ut32 count; // symbols seen with this name
+} FilterSlot;
 
-	r_strf_var (oname, 256, "o.0.%c.%s", sym->is_imported ? 'i' : 's', name);
-	RBinSymbol *prev_sym = ht_pp_find (ht, oname, NULL);
-	if (!prev_sym) {
-		if (!ht_pp_insert (ht, oname, sym)) {
-			R_LOG_WARN ("Failed to insert dup_count in ht");
-			return;
+static FilterSlot *filter_slot(FilterSlot *slots, ut32 mask, ut32 hash, RBinSymbol *sym, bool by_addr) {
+	ut32 i = hash & mask;
+	for (;;) {
+		FilterSlot *slot = &slots[i];
+		if (!slot->sym) {
+			return slot;
 		}
-	} else {
-		sym->dup_count = prev_sym->dup_count + 1;
-		ht_pp_update (ht, oname, sym);
+		RBinSymbol *s = slot->sym;
+		if (slot->hash == hash && s->is_imported == sym->is_imported
+				&& (!by_addr || s->vaddr == sym->vaddr) && !strcmp (s->name, sym->name)) {
+			return slot;
+		}
+		i = (i + 1) & mask;
 	}
 }
 
 R_API void r_bin_filter_symbols(RBinFile *bf, RList *list) {
-	HtPP *ht = ht_pp_new0 ();
-	if (!ht) {
+	const ut32 n = r_list_length (list);
+	ut32 size = 16;
+	while (size < n * 2) {
+		size <<= 1;
+	}
+	// first half is keyed by name and address, second half by name
+	FilterSlot *slots = R_NEWS0 (FilterSlot, size * 2);
+	if (!slots) {
 		return;
 	}
+	const ut32 mask = size - 1;
 
+	// count the duplicates by the names given by the plugin, before demangling them
 	RListIter *iter;
 	RBinSymbol *sym;
 	r_list_foreach (list, iter, sym) {
-		if (sym && sym->name && *sym->name) {
-			r_bin_filter_sym (bf, ht, sym->vaddr, sym);
+		if (!sym || R_STR_ISEMPTY (sym->name)) {
+			continue;
+		}
+		ut32 hash = sdb_hash (sym->name);
+		if (sym->is_imported) {
+			hash = ~hash;
+		}
+		const ut32 ahash = hash ^ ((ut32)(sym->vaddr ^ (sym->vaddr >> 32)) * 0x9e3779b1);
+		FilterSlot *slot = filter_slot (slots, mask, ahash, sym, true);
+		if (slot->sym) {
+			// same name at the same address
+			continue;
+		}
+		slot->sym = sym;
+		slot->hash = ahash;
+		slot = filter_slot (slots + size, mask, hash, sym, false);
+		if (!slot->sym) {
+			slot->sym = sym;
+			slot->hash = hash;
+		}
+		sym->dup_count = slot->count++;
+	}
+	free (slots);
+
+	if (bf && bf->o && bf->o->lang) {
+		const char *lang = r_bin_lang_tostring (bf->o->lang);
+		r_list_foreach (list, iter, sym) {
+			if (sym && R_STR_ISNOTEMPTY (sym->name)) {
+				filter_demangle (bf, lang, sym);
+			}
 		}
 	}
-	ht_pp_free (ht);
 }
 
 R_API void r_bin_filter_sections(RBinFile *bf, RList *list) {
@@ -679,22 +679,32 @@ R_API RBinAddr *r_bin_get_sym(RBin *bin, int sym) {
 	return o? o->binsym[sym]: NULL;
 }
 
+// current object with the given item loaded
+static RBinObject *cur_object_item(RBin *bin, RBinItem item) {
+	RBinFile *bf = r_bin_cur (bin);
+	RBinObject *o = bf? bf->o: NULL;
+	if (o && o->plugin) {
+		r_bin_object_load_item (bf, o, item);
+	}
+	return o;
+}
+
 // XXX: those accessors are redundant
 R_API const RList *r_bin_get_entries(RBin *bin) {
 	r_return_val_if_fail (bin, NULL);
-	RBinObject *o = r_bin_cur_object (bin);
+	RBinObject *o = cur_object_item (bin, R_BIN_ITEM_ENTRIES);
 	return o ? o->entries : NULL;
 }
 
 R_API RList *r_bin_get_fields(RBin *bin) {
 	r_return_val_if_fail (bin, NULL);
-	RBinObject *o = r_bin_cur_object (bin);
+	RBinObject *o = cur_object_item (bin, R_BIN_ITEM_FIELDS);
 	return o ? o->fields : NULL;
 }
 
 R_API const RList *r_bin_get_imports(RBin *bin) {
 	r_return_val_if_fail (bin, NULL);
-	RBinObject *o = r_bin_cur_object (bin);
+	RBinObject *o = cur_object_item (bin, R_BIN_ITEM_IMPORTS);
 	return o ? o->imports : NULL;
 }
 
@@ -706,19 +716,19 @@ R_API RBinInfo *r_bin_get_info(RBin *bin) {
 
 R_API RList *r_bin_get_libs(RBin *bin) {
 	r_return_val_if_fail (bin, NULL);
-	RBinObject *o = r_bin_cur_object (bin);
+	RBinObject *o = cur_object_item (bin, R_BIN_ITEM_LIBS);
 	return o ? o->libs : NULL;
 }
 
 R_API RRBTree *r_bin_patch_relocs(RBinFile *bf) {
 	r_return_val_if_fail (bf && bf->rbin, NULL);
-	RBinObject *o = r_bin_cur_object (bf->rbin);
+	RBinObject *o = cur_object_item (bf->rbin, R_BIN_ITEM_RELOCS);
 	return o? r_bin_object_patch_relocs (bf, o): NULL;
 }
 
 R_API RRBTree *r_bin_get_relocs(RBin *bin) {
 	r_return_val_if_fail (bin, NULL);
-	RBinObject *o = r_bin_cur_object (bin);
+	RBinObject *o = cur_object_item (bin, R_BIN_ITEM_RELOCS);
 	return o ? o->relocs : NULL;
 }
 
@@ -771,12 +781,13 @@ R_API RList *r_bin_reset_strings(RBin *bin) {
 	if (bin->debase64) {
 		r_bin_object_filter_strings (bf->o);
 	}
+	bf->o->loaded |= 1U << R_BIN_ITEM_STRINGS;
 	return bf->o->strings;
 }
 
 R_API RList *r_bin_get_strings(RBin *bin) {
 	r_return_val_if_fail (bin, NULL);
-	RBinObject *o = r_bin_cur_object (bin);
+	RBinObject *o = cur_object_item (bin, R_BIN_ITEM_STRINGS);
 	return o ? o->strings : NULL;
 }
 
@@ -800,7 +811,7 @@ R_API int r_bin_is_string(RBin *bin, ut64 va) {
 
 R_API RList *r_bin_get_symbols(RBin *bin) {
 	r_return_val_if_fail (bin, NULL);
-	RBinObject *o = r_bin_cur_object (bin);
+	RBinObject *o = cur_object_item (bin, R_BIN_ITEM_SYMBOLS);
 	return o? o->symbols: NULL;
 }
 
@@ -818,7 +829,7 @@ R_API int r_bin_is_big_endian(RBin *bin) {
 
 R_API int r_bin_is_static(RBin *bin) {
 	r_return_val_if_fail (bin, false);
-	RBinObject *o = r_bin_cur_object (bin);
+	RBinObject *o = cur_object_item (bin, R_BIN_ITEM_LIBS);
 	if (o && o->libs && r_list_length (o->libs) > 0) {
 		return R_BIN_DBG_STATIC & o->info->dbg_info;
 	}
@@ -1278,7 +1289,7 @@ R_API RBuffer *r_bin_package(RBin *bin, const char *type, const char *file, RLis
 
 R_API RList */*<RBinClass>*/ r_bin_get_classes(RBin *bin) {
 	r_return_val_if_fail (bin, NULL);
-	RBinObject *o = r_bin_cur_object (bin);
+	RBinObject *o = cur_object_item (bin, R_BIN_ITEM_CLASSES);
 	return o ? o->classes : NULL;
 }
 
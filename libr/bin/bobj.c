@@ -1,4 +1,4 @@
-/* radare2 - LGPL - Copyright 2009-2022 - pancake, nibble, dso */
+/* radare2 - LGPL - Copyright 2009-2023 - pancake, nibble, dso */
 
 #define R_LOG_ORIGIN "bin.obj"
 
@@ -58,6 +58,7 @@ R_IPI void r_bin_object_free(void /*RBinObject*/ *o_) {
 		free (o->regstate);
 		r_bin_info_free (o->info);
 		object_delete_items (o);
+		r_th_lock_free (o->lock);
 		free (o);
 	}
 }
@@ -143,6 +144,7 @@ R_IPI RBinObject *r_bin_object_new(RBinFile *bf, RBinPlugin *plugin, ut64 basead
 	bo->baddr_shift = 0;
 	bo->plugin = plugin;
 	bo->loadaddr = loadaddr != UT64_MAX ? loadaddr : 0;
+	bo->lock = r_th_lock_new (true);
 
 	Sdb *sdb = bf->sdb; // should be bo->kv ?
 	if (plugin && plugin->load_buffer) {
@@ -151,12 +153,14 @@ R_IPI RBinObject *r_bin_object_new(RBinFile *bf, RBinPlugin *plugin, ut64 basead
 				R_LOG_ERROR ("r_bin_object_new: load_buffer failed for %s plugin", plugin->name);
 			}
 			sdb_free (bo->kv);
+			r_th_lock_free (bo->lock);
 			free (bo);
 			return NULL;
 		}
 	} else {
 		R_LOG_WARN ("Plugin %s should implement load_buffer method", plugin->name);
 		sdb_free (bo->kv);
+		r_th_lock_free (bo->lock);
 		free (bo);
 		return NULL;
 	}
@@ -197,7 +201,7 @@ R_IPI RBinObject *r_bin_object_new(RBinFile *bf, RBinPlugin *plugin, ut64 basead
 
 static void filter_classes(RBinFile *bf, RList *list) {
 	HtPU *db = ht_pu_new0 ();
-	HtPP *ht = ht_pp_new0 ();
+	RList *methods = r_list_new ();
 	RListIter *iter, *iter2;
 	RBinClass *cls;
 	RBinSymbol *sym;
@@ -217,14 +221,14 @@ static void filter_classes(RBinFile *bf, RList *list) {
 			free (cls->name);
 			cls->name = namepad;
 			r_list_foreach (cls->methods, iter2, sym) {
-				if (sym->name) {
-					r_bin_filter_sym (bf, ht, sym->vaddr, sym);
-				}
+				r_list_append (methods, sym);
 			}
 		}
 	}
+	// method names are deduped across all the classes
+	r_bin_filter_symbols (bf, methods);
+	r_list_free (methods);
 	ht_pu_free (db);
-	ht_pp_free (ht);
 }
 
 static RRBTree *list2rbtree(RList *relocs) {
@@ -262,16 +266,236 @@ static void r_bin_object_rebuild_classes_ht(RBinObject *bo) {
 	}
 }
 
+static const char *item_names[R_BIN_ITEM_LAST] = {
+	"entries", "fields", "imports", "symbols", "libs",
+	"relocs", "strings", "classes", "lines", "lang"
+};
+
+R_API const char *r_bin_item_tostring(RBinItem item) {
+	return (item < R_BIN_ITEM_LAST)? item_names[item]: NULL;
+}
+
+// drop the lazy items, they will be computed again with the current load address
+static void object_reset_items(RBinObject *bo) {
+	r_list_free (bo->entries);
+	bo->entries = NULL;
+	r_list_free (bo->fields);
+	bo->fields = NULL;
+	r_list_free (bo->imports);
+	bo->imports = NULL;
+	r_list_free (bo->symbols);
+	bo->symbols = NULL;
+	r_list_free (bo->libs);
+	bo->libs = NULL;
+	r_crbtree_free (bo->relocs);
+	bo->relocs = NULL;
+	bo->is_reloc_patched = false;
+	r_list_free (bo->strings);
+	bo->strings = NULL;
+	ht_up_free (bo->strings_db);
+	bo->strings_db = ht_up_new0 ();
+	r_list_free (bo->classes);
+	bo->classes = r_list_newf ((RListFree)r_bin_class_free);
+	r_bin_object_rebuild_classes_ht (bo);
+	ht_up_free (bo->addr2klassmethod);
+	bo->addr2klassmethod = NULL;
+	r_list_free (bo->lines);
+	bo->lines = NULL;
+	bo->lang = 0;
+	bo->loaded = 0;
+	memset (bo->load_time, 0, sizeof (bo->load_time));
+}
+
+static void load_classes(RBinFile *bf, RBinObject *bo) {
+	RBin *bin = bf->rbin;
+	RBinPlugin *p = bo->plugin;
+	if (p->classes) {
+		RList *classes = p->classes (bf);
+		if (classes) {
+			// XXX we should probably merge them instead
+			r_list_free (bo->classes);
+			bo->classes = classes;
+			r_bin_object_rebuild_classes_ht (bo);
+		}
+		if (r_bin_lang_swift (bf)) {
+			bo->classes = classes_from_symbols (bf);
+		}
+	} else {
+		RList *classes = classes_from_symbols (bf);
+		if (classes) {
+			bo->classes = classes;
+		}
+	}
+	if (bin->filter) {
+		// the eager loader filtered the classes before knowing the language
+		const int lang = bo->lang;
+		bo->lang = 0;
+		filter_classes (bf, bo->classes);
+		bo->lang = lang;
+	}
+	// cache addr=class+method
+	if (bo->classes && !bo->addr2klassmethod) {
+		RListIter *iter, *iter2;
+		RBinClass *klass;
+		RBinSymbol *method;
+		// this is slow. must be optimized, but at least its cached
+		bo->addr2klassmethod = ht_up_new0 ();
+		r_list_foreach (bo->classes, iter, klass) {
+			r_list_foreach (klass->methods, iter2, method) {
+				ht_up_insert (bo->addr2klassmethod, method->vaddr, method);
+			}
+		}
+	}
+}
+
+// the plugin output is cached as is, rebasing and filtering happen after a hit too
+static RList *cached_items(RBinFile *bf, RBinObject *bo, const char *kind, RList *(*get)(RBinFile *bf)) {
+	RList *items = r_bin_cache_load (bf, bo, kind);
+	if (!items) {
+		items = get (bf);
+		r_bin_cache_save (bf, bo, kind, items);
+	}
+	return items;
+}
+
+static void load_item(RBinFile *bf, RBinObject *bo, RBinItem item) {
+	RBin *bin = bf->rbin;
+	RBinPlugin *p = bo->plugin;
+	switch (item) {
+	case R_BIN_ITEM_ENTRIES:
+		if (p->entries) {
+			bo->entries = cached_items (bf, bo, "entries", p->entries);
+			REBASE_PADDR (bo, bo->entries, RBinAddr);
+		}
+		break;
+	case R_BIN_ITEM_FIELDS:
+		if (p->fields) {
+			bo->fields = p->fields (bf);
+			if (bo->fields) {
+				bo->fields->free = r_bin_field_free;
+				REBASE_PADDR (bo, bo->fields, RBinField);
+			}
+		}
+		break;
+	case R_BIN_ITEM_IMPORTS:
+		if (p->imports) {
+			bo->imports = cached_items (bf, bo, "imports", p->imports);
+			if (bo->imports) {
+				bo->imports->free = (RListFree)r_bin_import_free;
+			}
+		}
+		break;
+	case R_BIN_ITEM_SYMBOLS:
+		if (p->symbols) {
+			bo->symbols = cached_items (bf, bo, "symbols", p->symbols); // 5s
+			if (bo->symbols) {
+				bo->symbols->free = r_bin_symbol_free;
+				REBASE_PADDR (bo, bo->symbols, RBinSymbol);
+				if (bin->filter) {
+					r_bin_filter_symbols (bf, bo->symbols); // 5s
+				}
+			}
+		}
+		break;
+	case R_BIN_ITEM_LIBS:
+		if (p->libs) {
+			bo->libs = p->libs (bf);
+		}
+		break;
+	case R_BIN_ITEM_RELOCS:
+		if (p->relocs && (bin->filter_rules & (R_BIN_REQ_RELOCS | R_BIN_REQ_IMPORTS))) {
+			RList *l = p->relocs (bf);
+			if (l) {
+				REBASE_PADDR (bo, l, RBinReloc);
+				bo->relocs = list2rbtree (l);
+				l->free = NULL;
+				r_list_free (l);
+			}
+		}
+		break;
+	case R_BIN_ITEM_STRINGS:
+		if (bin->filter_rules & R_BIN_REQ_STRINGS) {
+			int minlen = (bin->minstrlen > 0) ? bin->minstrlen : p->minstrlen;
+			bo->strings = p->strings
+				? p->strings (bf)
+				: r_bin_file_get_strings (bf, minlen, 0, bf->rawstr);
+			if (bin->debase64) {
+				r_bin_object_filter_strings (bo);
+			}
+			REBASE_PADDR (bo, bo->strings, RBinString);
+		}
+		break;
+	case R_BIN_ITEM_CLASSES:
+		if (bin->filter_rules & R_BIN_REQ_CLASSES) {
+			load_classes (bf, bo);
+		}
+		break;
+	case R_BIN_ITEM_LINES:
+		if (p->lines) {
+			bo->lines = p->lines (bf);
+		}
+		break;
+	case R_BIN_ITEM_LANG:
+		if (bo->info && bin->filter_rules & (R_BIN_REQ_INFO | R_BIN_REQ_SYMBOLS | R_BIN_REQ_IMPORTS)) {
+			const bool swift = p->classes && (bin->filter_rules & R_BIN_REQ_CLASSES) && r_bin_lang_swift (bf);
+			bo->lang = swift? R_BIN_LANG_SWIFT: r_bin_load_languages (bf);
+			if (!bo->info->lang) {
+				bo->info->lang = r_bin_lang_tostring (bo->lang);
+			}
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+// computes the given item the first time it is requested, the time spent is kept in bo->load_time
+R_API bool r_bin_object_load_item(RBinFile *bf, RBinObject *bo, RBinItem item) {
+	r_return_val_if_fail (bf && bo && bo->plugin && item < R_BIN_ITEM_LAST, false);
+	const ut32 bit = 1U << item;
+	r_th_lock_enter (bo->lock);
+	if (bo->loaded & bit) {
+		r_th_lock_leave (bo->lock);
+		return true;
+	}
+	// load the items this one is computed from first, so the timings dont overlap
+	switch (item) {
+	case R_BIN_ITEM_CLASSES:
+		r_bin_object_load_item (bf, bo, R_BIN_ITEM_SYMBOLS);
+		break;
+	case R_BIN_ITEM_LANG:
+		r_bin_object_load_item (bf, bo, R_BIN_ITEM_IMPORTS);
+		r_bin_object_load_item (bf, bo, R_BIN_ITEM_SYMBOLS);
+		r_bin_object_load_item (bf, bo, R_BIN_ITEM_LIBS);
+		break;
+	default:
+		break;
+	}
+	// mark it before loading, the plugins may ask for it again while computing it
+	bo->loaded |= bit;
+	RBinObject *cur = bf->o;
+	bf->o = bo;
+	const ut64 t = r_time_now_mono ();
+	load_item (bf, bo, item);
+	bo->load_time[item] = r_time_now_mono () - t;
+	bf->o = cur;
+	r_th_lock_leave (bo->lock);
+	return true;
+}
+
+// only the cheap items needed to map the file are computed here, the rest is done by r_bin_object_load_item
 R_API int r_bin_object_set_items(RBinFile *bf, RBinObject *bo) {
 	r_return_val_if_fail (bf && bo && bo->plugin, false);
 
 	int i;
-	bool isSwift = false;
 	RBin *bin = bf->rbin;
 	RBinPlugin *p = bo->plugin;
-	int minlen = (bf->rbin->minstrlen > 0) ? bf->rbin->minstrlen : p->minstrlen;
 	bf->o = bo;
 
+	r_th_lock_enter (bo->lock);
+	if (bo->loaded) {
+		object_reset_items (bo);
+	}
 	if (p->file_type) {
 		int type = p->file_type (bf);
 		if (type == R_BIN_TYPE_CORE) {
@@ -302,110 +526,17 @@ R_API int r_bin_object_set_items(RBinFile *bf, RBinObject *bo) {
 			}
 		}
 	}
-	if (p->entries) {
-		bo->entries = p->entries (bf);
-		REBASE_PADDR (bo, bo->entries, RBinAddr);
-	}
-	if (p->fields) {
-		bo->fields = p->fields (bf);
-		if (bo->fields) {
-			bo->fields->free = r_bin_field_free;
-			REBASE_PADDR (bo, bo->fields, RBinField);
-		}
-	}
-	if (p->imports) {
-		r_list_free (bo->imports);
-		bo->imports = p->imports (bf);
-		if (bo->imports) {
-			bo->imports->free = (RListFree)r_bin_import_free;
-		}
-	}
-	if (p->symbols) {
-		bo->symbols = p->symbols (bf); // 5s
-		if (bo->symbols) {
-			bo->symbols->free = r_bin_symbol_free;
-			REBASE_PADDR (bo, bo->symbols, RBinSymbol);
-			if (bin->filter) {
-				r_bin_filter_symbols (bf, bo->symbols); // 5s
-			}
-		}
-	}
 	bo->info = p->info? p->info (bf): NULL;
-	if (p->libs) {
-		bo->libs = p->libs (bf);
-	}
 	if (p->sections) {
 		// XXX sections are populated by call to size
 		if (!bo->sections) {
-			bo->sections = p->sections (bf);
+			bo->sections = cached_items (bf, bo, "sections", p->sections);
 		}
 		REBASE_PADDR (bo, bo->sections, RBinSection);
 		if (bin->filter) {
 			r_bin_filter_sections (bf, bo->sections);
 		}
 	}
-	if (bin->filter_rules & (R_BIN_REQ_RELOCS | R_BIN_REQ_IMPORTS)) {
-		if (p->relocs) {
-			RList *l = p->relocs (bf);
-			if (l) {
-				REBASE_PADDR (bo, l, RBinReloc);
-				bo->relocs = list2rbtree (l);
-				l->free = NULL;
-				r_list_free (l);
-			}
-		}
-	}
-	if (bin->filter_rules & R_BIN_REQ_STRINGS) {
-		bo->strings = p->strings
-			? p->strings (bf)
-			: r_bin_file_get_strings (bf, minlen, 0, bf->rawstr);
-		if (bin->debase64) {
-			r_bin_object_filter_strings (bo);
-		}
-		REBASE_PADDR (bo, bo->strings, RBinString);
-	}
-	if (bin->filter_rules & R_BIN_REQ_CLASSES) {
-		if (p->classes) {
-			RList *classes = p->classes (bf);
-			if (classes) {
-				// XXX we should probably merge them instead
-				r_list_free (bo->classes);
-				bo->classes = classes;
-				r_bin_object_rebuild_classes_ht (bo);
-			}
-			isSwift = r_bin_lang_swift (bf);
-			if (isSwift) {
-				bo->classes = classes_from_symbols (bf);
-			}
-		} else {
-			RList *classes = classes_from_symbols (bf);
-			if (classes) {
-				bo->classes = classes;
-			}
-		}
-		if (bin->filter) {
-			filter_classes (bf, bo->classes);
-		}
-		// cache addr=class+method
-		if (bo->classes) {
-			RList *klasses = bo->classes;
-			RListIter *iter, *iter2;
-			RBinClass *klass;
-			RBinSymbol *method;
-			if (!bo->addr2klassmethod) {
-				// this is slow. must be optimized, but at least its cached
-				bo->addr2klassmethod = ht_up_new0 ();
-				r_list_foreach (klasses, iter, klass) {
-					r_list_foreach (klass->methods, iter2, method) {
-						ht_up_insert (bo->addr2klassmethod, method->vaddr, method);
-					}
-				}
-			}
-		}
-	}
-	if (p->lines) {
-		bo->lines = p->lines (bf);
-	}
 	if (p->get_sdb) {
 		Sdb* new_kv = p->get_sdb (bf);
 		if (new_kv != bo->kv) {
@@ -416,9 +547,7 @@ R_API int r_bin_object_set_items(RBinFile *bf, RBinObject *bo) {
 	if (p->mem)  {
 		bo->mem = p->mem (bf);
 	}
-	if (bo->info && bin->filter_rules & (R_BIN_REQ_INFO | R_BIN_REQ_SYMBOLS | R_BIN_REQ_IMPORTS)) {
-		bo->lang = isSwift? R_BIN_LANG_SWIFT: r_bin_load_languages (bf);
-	}
+	r_th_lock_leave (bo->lock);
 	return true;
 }
 
@@ -26,37 +26,21 @@ R_API bool r_bin_addr2line(RBin *bin, ut64 addr, char *file, int len, int *line,
 // XXX R2_590 why dupe
 R_API bool r_bin_addr2line2(RBin *bin, ut64 addr, char *file, int len, int *line, int *column) {
 	r_return_val_if_fail (bin, false);
-	if (!bin->cur || !bin->cur->sdb_addrinfo) {
+	RBinAddrline row;
+	if (!bin->cur || !bin->cur->addrline || !r_bin_addrline_get (bin->cur->addrline, addr, &row)) {
 		return false;
 	}
-	char *key = r_str_newf ("0x%"PFMT64x, addr);
-	char *file_line = sdb_get (bin->cur->sdb_addrinfo, key, 0);
-	if (file_line) {
-		char *token = strchr (file_line, '|');
-		if (token) {
-			*token++ = 0;
-			char *token2 = strchr (token, ':'); // 0xaddr=file.c|line:column
-			if (token2) {
-				*token2++ = 0;
-				if (column) {
-					*column = atoi (token2);
-				}
-			} else {
-				if (column) {
-					*column = 0;
-				}
-			}
-			if (line) {
-				*line = atoi (token);
-			}
-			r_str_ncpy (file, file_line, len);
-			free (key);
-			free (file_line);
-			return true;
-		}
+	if (row.line == R_BIN_ADDRLINE_TEXT) {
+		return false;
 	}
-	free (key);
-	return false;
+	if (line) {
+		*line = row.line;
+	}
+	if (column) {
+		*column = row.column;
+	}
+	r_str_ncpy (file, row.file, len);
+	return true;
 }
 
 R_API char *r_bin_addr2text(RBin *bin, ut64 addr, int origin) {
@@ -65,81 +49,48 @@ R_API char *r_bin_addr2text(RBin *bin, ut64 addr, int origin) {
 	int line = 0;
 	int colu = -1;
 	char *out = NULL, *out2 = NULL;
-	char *file_nopath = NULL;
+	const char *file_nopath = NULL;
 	if (!bin->cur) {
 		return NULL;
 	}
-	char *key = r_str_newf ("0x%"PFMT64x, addr);
-	char *file_line = sdb_get (bin->cur->sdb_addrinfo, key, 0);
-	if (file_line) {
-		char *token = strchr (file_line, '|'); /// XXX use : everywhere instead of |
-		if (token) {
-			*token++ = 0;
-			line = atoi (token);
-			char *colupos = strchr (token, ':');
-			if (colupos) {
-				colu = atoi (colupos + 1);
-			}
-			bool found = true;
-			const char *filename = file_line;
-			char *nf = NULL;
-			if (!r_file_exists (file_line)) {
-				const char *bn = r_file_basename (file_line);
-				// TODO: use dir.source
-				if (r_file_exists (bn)) {
-					filename = bn;
+	RBinAddrline row;
+	if (bin->cur->addrline && r_bin_addrline_get (bin->cur->addrline, addr, &row)) {
+		if (row.line == R_BIN_ADDRLINE_TEXT) {
+			return strdup (row.file);
+		}
+		line = row.line;
+		const char *filename = row.file;
+		char *nf = NULL;
+		bool found = true;
+		if (!r_file_exists (filename)) {
+			const char *bn = r_file_basename (filename);
+			// TODO: use dir.source
+			if (r_file_exists (bn)) {
+				filename = bn;
+			} else {
+				nf = r_str_newf ("%s/%s", bin->srcdir, bn);
+				if (r_file_exists (nf)) {
+					filename = nf;
 				} else {
-					nf = r_str_newf ("%s/%s", bin->srcdir, bn);
-					if (r_file_exists (nf)) {
-						filename = nf;
-					} else {
-						found = false;
-						// R_LOG_WARN ("Cannot find %s", filename);
-						// return NULL;
-					}
+					found = false;
 				}
 			}
-			if (found) {
-				out = r_file_slurp_line (filename, line, 0);
-				*token++ = ':';
-				free (nf);
-			}
-		} else {
-			return file_line;
 		}
-	}
-	free (key);
-	if (out) {
-		if (origin > 1) {
-			file_nopath = file_line;
-		} else {
-			file_nopath = strrchr (file_line, '/');
-			if (file_nopath) {
-				file_nopath++;
-			} else {
-				file_nopath = file_line;
-			}
+		if (found) {
+			out = r_file_slurp_line (filename, line, 0);
+		}
+		free (nf);
+		file_nopath = (origin > 1)? row.file: r_file_basename (row.file);
+		if (!out) {
+			return r_str_newf ("%s:%d", file_nopath, line);
 		}
 		if (origin) {
-			char *res;
-			if (colu == -1) {
-				res = r_str_newf ("%s:%d%s%s",
-					r_str_get (file_nopath),
-					line, file_nopath? " ": "",
-					r_str_get (out));
-			} else {
-				res = r_str_newf ("%s:%d:%d%s%s",
-					r_str_get (file_nopath),
-					line, colu, file_nopath? " ": "",
-					r_str_get (out));
-			}
+			char *res = r_str_newf ("%s:%d %s", file_nopath, line, out);
 			free (out);
 			out = res;
 		}
-		free (file_line);
 		return out;
 	}
-	R_FREE (file_line);
 
 	file[0] = 0;
 	if (r_bin_addr2line (bin, addr, file, sizeof (file), &line, &colu)) {
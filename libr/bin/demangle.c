@@ -1,5 +1,7 @@
 /* radare - LGPL - Copyright 2011-2023 - pancake */
 
+#define R_LOG_ORIGIN "bin.demangle"
+
 #include <r_bin.h>
 #include "i/private.h"
 #include <cxx/demangle.h>
@@ -86,16 +88,64 @@ R_API int r_bin_demangle_type(const char *str) {
 	return R_BIN_LANG_NONE;
 }
 
-R_API char *r_bin_demangle(RBinFile *bf, const char *def, const char *str, ut64 vaddr, bool libs) {
-	int type = -1;
-	if (R_STR_ISEMPTY (str)) {
-		return NULL;
+static char *demangle_key(RBin *bin, int type, const char *str) {
+	// the swift demangler depends on these options
+	const bool usecmd = bin? bin->demangle_usecmd: false;
+	const bool trylib = bin? bin->demangle_trylib: true;
+	return r_str_newf ("%d%c%c%s", type, usecmd? 'c': '-', trylib? 'l': '-', str);
+}
+
+// true when str was already demangled as type, res is NULL if it failed
+R_IPI bool r_bin_demangle_cached(RBinFile *bf, int type, const char *str, char **res) {
+	bool found = false;
+	*res = NULL;
+	if (!bf->demangled) {
+		return false;
+	}
+	char *key = demangle_key (bf->rbin, type, str);
+	r_th_lock_enter (bf->demangled_lock);
+	const char *name = ht_pp_find (bf->demangled, key, &found);
+	if (R_STR_ISNOTEMPTY (name)) {
+		*res = strdup (name);
 	}
+	r_th_lock_leave (bf->demangled_lock);
+	free (key);
+	return found;
+}
+
+static bool demangle_cache_init(RBinFile *bf) {
+	if (!bf->demangled && bf->demangled_lock && r_str_constpool_init (&bf->demangled_names)) {
+		bf->demangled = ht_pp_new0 ();
+		if (!bf->demangled) {
+			r_str_constpool_fini (&bf->demangled_names);
+		}
+	}
+	return bf->demangled;
+}
+
+R_IPI void r_bin_demangle_cache(RBinFile *bf, int type, const char *str, const char *res) {
+	if (!demangle_cache_init (bf)) {
+		return;
+	}
+	char *key = demangle_key (bf->rbin, type, str);
+	r_th_lock_enter (bf->demangled_lock);
+	{
+		// many symbols demangle to the same name, keep a single copy of it
+		const char *name = res? r_str_constpool_get (&bf->demangled_names, res): "";
+		ht_pp_update (bf->demangled, key, (void *)name);
+	}
+	r_th_lock_leave (bf->demangled_lock);
+	free (key);
+}
+
+// skips the flag and library prefixes of str and guesses the language to demangle it with
+static int demangle_prepare(RBinFile *bf, const char *def, const char **pstr, const char **plib, bool libs) {
 	RBin *bin = bf? bf->rbin: NULL;
-	bool trylib = bin? bin->demangle_trylib: true;
 	RBinObject *o = bf? bf->o: NULL;
-	RListIter *iter;
+	const char *str = *pstr;
 	const char *lib = NULL;
+	RListIter *iter;
+	int type = -1;
 	if (r_str_startswith (str, "reloc.")) {
 		str += strlen ("reloc.");
 	}
@@ -137,23 +187,63 @@ R_API char *r_bin_demangle(RBinFile *bf, const char *def, const char *str, ut64
 		//	str++;
 		}
 	}
+	*pstr = str;
+	*plib = lib;
 	// if str is sym. or imp. when str+=4 str points to the end so just return
 	if (!*str) {
-		return NULL;
+		return -1;
 	}
 	if (type == -1) {
 		type = r_bin_lang_type (bf, def, str);
 	}
+	return type;
+}
+
+// the demanglers without side effects on bf
+static char *demangle_as(RBin *bin, int type, const char *str) {
+	const bool trylib = bin? bin->demangle_trylib: true;
+	switch (type) {
+	case R_BIN_LANG_JAVA: return r_bin_demangle_java (str);
+	case R_BIN_LANG_OBJC: return r_bin_demangle_objc (NULL, str);
+	case R_BIN_LANG_SWIFT: return r_bin_demangle_swift (str, bin? bin->demangle_usecmd: false, trylib);
+	case R_BIN_LANG_PASCAL: return r_bin_demangle_freepascal (str);
+	case R_BIN_LANG_MSVC: return r_bin_demangle_msvc (str);
+	case R_BIN_LANG_DLANG: return r_bin_demangle_plugin (bin, "dlang", str);
+	}
+	return NULL;
+}
+
+R_API char *r_bin_demangle(RBinFile *bf, const char *def, const char *str, ut64 vaddr, bool libs) {
+	if (R_STR_ISEMPTY (str)) {
+		return NULL;
+	}
+	RBin *bin = bf? bf->rbin: NULL;
+	RBinObject *o = bf? bf->o: NULL;
+	const char *lib = NULL;
+	if (o && libs && o->plugin) {
+		r_bin_object_load_item (bf, o, R_BIN_ITEM_LIBS);
+	}
+	const int type = demangle_prepare (bf, def, &str, &lib, libs);
+	if (type == -1) {
+		return NULL;
+	}
 	char *demangled = NULL;
 	switch (type) {
-	case R_BIN_LANG_JAVA: demangled = r_bin_demangle_java (str); break;
 	case R_BIN_LANG_RUST: demangled = r_bin_demangle_rust (bf, str, vaddr); break;
-	case R_BIN_LANG_OBJC: demangled = r_bin_demangle_objc (NULL, str); break;
-	case R_BIN_LANG_SWIFT: demangled = r_bin_demangle_swift (str, bin? bin->demangle_usecmd: false, trylib); break;
 	case R_BIN_LANG_CXX: demangled = r_bin_demangle_cxx (bf, str, vaddr); break;
-	case R_BIN_LANG_PASCAL: demangled = r_bin_demangle_freepascal (str); break;
-	case R_BIN_LANG_MSVC: demangled = r_bin_demangle_msvc (str); break;
-	case R_BIN_LANG_DLANG: demangled = r_bin_demangle_plugin (bin, "dlang", str); break;
+	case R_BIN_LANG_JAVA:
+	case R_BIN_LANG_OBJC:
+	case R_BIN_LANG_SWIFT:
+	case R_BIN_LANG_PASCAL:
+	case R_BIN_LANG_MSVC:
+	case R_BIN_LANG_DLANG:
+		if (!bf || !r_bin_demangle_cached (bf, type, str, &demangled)) {
+			demangled = demangle_as (bin, type, str);
+			if (bf) {
+				r_bin_demangle_cache (bf, type, str, demangled);
+			}
+		}
+		break;
 	}
 	if (libs && demangled && lib) {
 		char *d = r_str_newf ("%s_%s", lib, demangled);
@@ -162,3 +252,84 @@ R_API char *r_bin_demangle(RBinFile *bf, const char *def, const char *str, ut64
 	}
 	return demangled;
 }
+
+typedef struct {
+	RBinFile *bf;
+	const char *lang;
+	const char **names;
+} DemangleBatch;
+
+static void demangle_batch_range(void *user, size_t from, size_t to) {
+	DemangleBatch *db = user;
+	RBinFile *bf = db->bf;
+	const char *lib;
+	size_t i;
+	for (i = from; i < to; i++) {
+		const char *str = db->names[i];
+		int type = demangle_prepare (bf, db->lang, &str, &lib, false);
+		char *res = NULL;
+		switch (type) {
+		case -1:
+			continue;
+		case R_BIN_LANG_RUST:
+			// the rust demangler is built on top of the c++ one
+		case R_BIN_LANG_CXX:
+			type = R_BIN_LANG_CXX;
+			if (!r_bin_demangle_cached (bf, type, str, &res)) {
+				r_bin_demangle_cache (bf, type, str, res = r_bin_demangle_cxx_raw (str));
+			}
+			break;
+		case R_BIN_LANG_JAVA:
+		case R_BIN_LANG_OBJC:
+		case R_BIN_LANG_SWIFT:
+		case R_BIN_LANG_PASCAL:
+		case R_BIN_LANG_MSVC:
+		case R_BIN_LANG_DLANG:
+			if (!r_bin_demangle_cached (bf, type, str, &res)) {
+				r_bin_demangle_cache (bf, type, str, res = demangle_as (bf->rbin, type, str));
+			}
+			break;
+		default:
+			// no demangler for this language, nothing to remember
+			continue;
+		}
+		free (res);
+	}
+}
+
+/**
+ * @brief Demangles the names of the symbols in list across the workers of bin->pool
+ *
+ * The results are memoized in bf, so the r_bin_demangle calls done later
+ * for these names return without running the demanglers again.
+ *
+ * @return int number of names that were demangled
+ */
+R_API int r_bin_demangle_batch(RBinFile *bf, const char *lang, RList *symbols) {
+	r_return_val_if_fail (bf && symbols, 0);
+	RListIter *iter;
+	RBinSymbol *sym;
+	size_t n = 0;
+	if (!demangle_cache_init (bf)) {
+		return 0;
+	}
+	const char **names = R_NEWS (const char *, r_list_length (symbols));
+	if (!names) {
+		return 0;
+	}
+	r_list_foreach (symbols, iter, sym) {
+		if (R_STR_ISNOTEMPTY (sym->name)) {
+			names[n++] = sym->name;
+		}
+	}
+	DemangleBatch db = { bf, lang, names };
+	RBin *bin = bf->rbin;
+	const int threads = bin? bin->demanglethreads: 1;
+	RThreadPool *pool = (bin && threads != 1)? bin->pool: NULL;
+	// at most threads slices at once, 0 lets r_th_parallel_for split the list
+	const size_t grain = (threads > 1)? (n + threads - 1) / threads: 0;
+	R_LOG_DEBUG ("Demangling the symbol names with %d threads", pool? (threads > 1? threads: pool->size): 1);
+	r_th_parallel_for (pool, 0, n, grain, demangle_batch_range, &db);
+	free (names);
+	return n;
+}
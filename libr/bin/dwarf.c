@@ -916,9 +916,7 @@ static const ut8 *parse_line_header(RBin *bin, RBinFile *bf, const ut8 *buf, con
 	return buf;
 }
 
-static inline void add_sdb_addrline(Sdb *s, ut64 addr, const char *file, ut64 line, ut64 column, int mode, PrintfCallback print) {
-	char offset[SDB_NUM_BUFSZ];
-	char *offset_ptr;
+static inline void add_addrline(RBinAddrLineStore *s, ut64 addr, const char *file, ut64 line, ut64 column, int mode, PrintfCallback print) {
 	if (!s || R_STR_ISEMPTY (file)) {
 		return;
 	}
@@ -946,24 +944,16 @@ static inline void add_sdb_addrline(Sdb *s, ut64 addr, const char *file, ut64 li
 #endif
 		break;
 	}
-#if 0
-	/* THIS IS TOO SLOW */
-	if (r_file_exists (file)) {
-		p = file;
+	if (strpbrk (file, "\x1b\n\t")) {
+		char *name = strdup (file);
+		r_str_ansi_strip (name);
+		r_str_replace_ch (name, '\n', 0, true);
+		r_str_replace_ch (name, '\t', 0, true);
+		r_bin_addrline_add (s, addr, name, (ut32)line, (ut32)column);
+		free (name);
+	} else {
+		r_bin_addrline_add (s, addr, file, (ut32)line, (ut32)column);
 	}
-#else
-	p = file;
-#endif
-	char *fileline = (column > 0)
-		? r_str_newf ("%s|%"PFMT64d"|%"PFMT64d, p, line, column)
-		: r_str_newf ("%s|%"PFMT64d, p, line);
-	r_str_ansi_strip (fileline);
-	r_str_replace_ch (fileline, '\n', 0, true);
-	r_str_replace_ch (fileline, '\t', 0, true);
-	offset_ptr = sdb_itoa (addr, 16, offset, sizeof (offset));
-	sdb_add (s, offset_ptr, fileline, 0);
-	sdb_add (s, fileline, offset_ptr, 0);
-	free (fileline);
 }
 
 static const ut8 *parse_ext_opcode(RBin *bin, const ut8 *obuf, size_t len, const RBinDwarfLineHeader *hdr, RBinDwarfSMRegisters *regs, int mode) {
@@ -998,10 +988,10 @@ static const ut8 *parse_ext_opcode(RBin *bin, const ut8 *obuf, size_t len, const
 	case DW_LNE_end_sequence:
 		regs->end_sequence = DWARF_TRUE;
 
-		if (binfile && binfile->sdb_addrinfo && hdr->file_names) {
+		if (binfile && binfile->addrline && hdr->file_names) {
 			int fnidx = regs->file - 1;
 			if (fnidx >= 0 && fnidx < hdr->file_names_count) {
-				add_sdb_addrline (binfile->sdb_addrinfo, regs->address,
+				add_addrline (binfile->addrline, regs->address,
 						hdr->file_names[fnidx].name,
 						regs->line, regs->column, mode, print);
 			}
@@ -1089,10 +1079,10 @@ static const ut8 *parse_spec_opcode(
 		print ("advance Address by %"PFMT64d " to 0x%"PFMT64x" and Line by %d to %"PFMT64d"\n",
 			advance_adr, regs->address, line_increment, regs->line);
 	}
-	if (binfile && binfile->sdb_addrinfo && hdr->file_names) {
+	if (binfile && binfile->addrline && hdr->file_names) {
 		int idx = regs->file -1;
 		if (idx >= 0 && idx < hdr->file_names_count) {
-			add_sdb_addrline (binfile->sdb_addrinfo, regs->address,
+			add_addrline (binfile->addrline, regs->address,
 					hdr->file_names[idx].name,
 					regs->line, regs->column, mode, print);
 		}
@@ -1127,10 +1117,10 @@ static const ut8 *parse_std_opcode(RBin *bin, const ut8 *obuf, size_t len, const
 		if (mode == R_MODE_PRINT) {
 			print ("Copy\n");
 		}
-		if (binfile && binfile->sdb_addrinfo && hdr->file_names) {
+		if (binfile && binfile->addrline && hdr->file_names) {
 			int fnidx = regs->file - 1;
 			if (fnidx >= 0 && fnidx < hdr->file_names_count) {
-				add_sdb_addrline (binfile->sdb_addrinfo,
+				add_addrline (binfile->addrline,
 					regs->address,
 					hdr->file_names[fnidx].name,
 					regs->line, regs->column, mode, print);
@@ -2275,6 +2265,51 @@ static bool expand_info(RBinDwarfDebugInfo *info) {
 	return true;
 }
 
+/**
+ * @brief Parses the header and the DIEs of a single compilation unit
+ *
+ * @param info Parsed information, the unit is stored in the next free slot
+ * @param offset Offset of the unit in the .debug_info section
+ * @param buf Start of the unit
+ * @param limit Maximum length the unit header can claim
+ * @return const ut8* Advanced position in the buffer, NULL on error
+ */
+static const ut8 *parse_unit(RBin *bin, RBinDwarfDebugInfo *info, Sdb *sdb, const RBinDwarfDebugAbbrev *da, ut64 offset, const ut8 *buf, const ut8 *buf_end, ut64 limit, bool be) {
+	RBinDwarfCompUnit *unit = &info->comp_units[info->count];
+	if (!init_comp_unit (unit)) {
+		return NULL;
+	}
+	info->count++;
+
+	unit->offset = offset;
+	// small redundancy, because it was easiest solution at a time
+	unit->hdr.unit_offset = offset;
+
+	buf = info_comp_unit_read_hdr (buf, buf_end, &unit->hdr, be);
+
+	if (unit->hdr.length > limit) {
+		return NULL;
+	}
+
+	if (da->decls->count >= da->capacity) {
+		R_LOG_WARN ("malformed dwarf have not enough buckets for decls");
+	}
+	r_warn_if_fail (da->count <= da->capacity);
+
+	// find abbrev start for current comp unit
+	// we could also do naive, ((char *)da->decls) + abbrev_offset,
+	// but this is more bulletproof to invalid DWARF
+	RBinDwarfAbbrevDecl key = { .offset = unit->hdr.abbrev_offset };
+	RBinDwarfAbbrevDecl *abbrev_start = bsearch (&key, da->decls, da->count, sizeof (key), abbrev_cmp);
+	if (!abbrev_start) {
+		return NULL;
+	}
+	// They point to the same array object, so should be def. behaviour
+	size_t first_abbr_idx = abbrev_start - da->decls;
+
+	return parse_comp_unit (bin, info, sdb, buf, buf_end, unit, da, first_abbr_idx, be);
+}
+
 /**
  * @brief Parses whole .debug_info section
  *
@@ -2296,7 +2331,6 @@ static RBinDwarfDebugInfo *parse_info_raw(RBin *bin, Sdb *sdb, RBinDwarfDebugAbb
 	if (!init_debug_info (info)) {
 		goto cleanup;
 	}
-	int unit_idx = 0;
 
 	while (buf < buf_end) {
 		if (info->count >= info->capacity) {
@@ -2304,46 +2338,10 @@ static RBinDwarfDebugInfo *parse_info_raw(RBin *bin, Sdb *sdb, RBinDwarfDebugAbb
 				break;
 			}
 		}
-
-		RBinDwarfCompUnit *unit = &info->comp_units[unit_idx];
-		if (!init_comp_unit (unit)) {
-			unit_idx--;
-			goto cleanup;
-		}
-		info->count++;
-
-		unit->offset = buf - obuf;
-		// small redundancy, because it was easiest solution at a time
-		unit->hdr.unit_offset = buf - obuf;
-
-		buf = info_comp_unit_read_hdr (buf, buf_end, &unit->hdr, be);
-
-		if (unit->hdr.length > len) {
-			goto cleanup;
-		}
-
-		if (da->decls->count >= da->capacity) {
-			R_LOG_WARN ("malformed dwarf have not enough buckets for decls");
-		}
-		r_warn_if_fail (da->count <= da->capacity);
-
-		// find abbrev start for current comp unit
-		// we could also do naive, ((char *)da->decls) + abbrev_offset,
-		// but this is more bulletproof to invalid DWARF
-		RBinDwarfAbbrevDecl key = { .offset = unit->hdr.abbrev_offset };
-		RBinDwarfAbbrevDecl *abbrev_start = bsearch (&key, da->decls, da->count, sizeof (key), abbrev_cmp);
-		if (!abbrev_start) {
-			goto cleanup;
-		}
-		// They point to the same array object, so should be def. behaviour
-		size_t first_abbr_idx = abbrev_start - da->decls;
-
-		buf = parse_comp_unit (bin, info, sdb, buf, buf_end, unit, da, first_abbr_idx, be);
+		buf = parse_unit (bin, info, sdb, da, buf - obuf, buf, buf_end, len, be);
 		if (!buf) {
 			goto cleanup;
 		}
-
-		unit_idx++;
 	}
 	return info;
 cleanup:
@@ -2488,6 +2486,348 @@ cleanup:
 	return NULL;
 }
 
+// bytes read to decode the header and the first DIE of a unit when indexing
+#define CU_INDEX_PEEK 4096
+
+static void cu_index_add_range(RBinDwarfCuIndex *ci, ut32 unit, ut64 from, ut64 to) {
+	if (from < to && from != UT64_MAX) {
+		RBinDwarfCuRange r = { .from = from, .to = to, .unit = unit };
+		r_vector_push (&ci->ranges, &r);
+	}
+}
+
+// DWARF 2-4 .debug_ranges lists, base is the low_pc of the unit
+static void cu_index_add_debug_ranges(RBinDwarfCuIndex *ci, ut32 unit, ut64 offset, ut64 base, ut8 addr_size) {
+	RBinSection *section = getsection (ci->bin, "debug_ranges");
+	if (!section || offset >= section->size || (addr_size != 4 && addr_size != 8)) {
+		return;
+	}
+	const bool be = ci->be;
+	const ut64 max = (addr_size == 4)? UT32_MAX: UT64_MAX;
+	ut8 pair[16];
+	for (; offset + 2 * addr_size <= section->size; offset += 2 * addr_size) {
+		if (r_buf_read_at (ci->bf->buf, section->paddr + offset, pair, 2 * addr_size) != 2 * addr_size) {
+			break;
+		}
+		ut64 from = (addr_size == 4)? r_read_ble32 (pair, be): r_read_ble64 (pair, be);
+		ut64 to = (addr_size == 4)? r_read_ble32 (pair + 4, be): r_read_ble64 (pair + 8, be);
+		if (!from && !to) {
+			break;
+		}
+		if (from == max) {
+			base = to;
+			continue;
+		}
+		cu_index_add_range (ci, unit, base + from, base + to);
+	}
+}
+
+// decodes the DIE of the unit to find the addresses it covers, the rest is skipped
+static bool cu_index_unit_die(RBinDwarfCuIndex *ci, ut32 unit, const ut8 *obuf, const ut8 *buf_end) {
+	const bool be = ci->be;
+	RBinDwarfCompUnitHdr hdr = {0};
+	const ut8 *buf = info_comp_unit_read_hdr (obuf, buf_end, &hdr, be);
+	ut64 abbr_code = 0;
+	buf = r_uleb128 (buf, buf_end - buf, &abbr_code, NULL);
+	if (!buf || buf >= buf_end || !abbr_code) {
+		return true;
+	}
+	RBinDwarfDebugAbbrev *da = ci->da;
+	RBinDwarfAbbrevDecl key = { .offset = hdr.abbrev_offset };
+	RBinDwarfAbbrevDecl *abbrev_start = bsearch (&key, da->decls, da->count, sizeof (key), abbrev_cmp);
+	if (!abbrev_start) {
+		return true;
+	}
+	const ut64 abbr_idx = (abbrev_start - da->decls) + abbr_code;
+	if (abbr_idx > da->count) {
+		return true;
+	}
+	RBinDwarfAbbrevDecl *abbrev = &da->decls[abbr_idx - 1];
+	RBinDwarfDie die = {0};
+	if (!init_die (&die, abbr_code, abbrev->count)) {
+		return true;
+	}
+	parse_die (ci->bin, buf, buf_end, abbrev, &hdr, &die, ci->bf->sdb_addrinfo, be);
+	if (die.count < abbrev->count && abbrev->defs[die.count].attr_name) {
+		// truncated, the caller retries with the whole unit
+		free_die (&die);
+		return false;
+	}
+	ut64 low = UT64_MAX, high = 0, ranges = UT64_MAX;
+	bool high_is_size = false;
+	size_t i;
+	for (i = 0; i < die.count; i++) {
+		const RBinDwarfAttrValue *val = &die.attr_values[i];
+		switch (val->attr_name) {
+		case DW_AT_low_pc:
+			low = val->address;
+			break;
+		case DW_AT_high_pc:
+			high = val->address;
+			high_is_size = val->kind != DW_AT_KIND_ADDRESS;
+			break;
+		case DW_AT_ranges:
+			ranges = val->reference;
+			break;
+		}
+	}
+	if (low != UT64_MAX) {
+		cu_index_add_range (ci, unit, low, high_is_size? low + high: high);
+	}
+	if (ranges != UT64_MAX && hdr.version < 5) {
+		cu_index_add_debug_ranges (ci, unit, ranges, (low == UT64_MAX)? 0: low, hdr.address_size);
+	}
+	free_die (&die);
+	return true;
+}
+
+static void cu_index_units(RBinDwarfCuIndex *ci) {
+	const bool be = ci->be;
+	ut8 *peek = malloc (CU_INDEX_PEEK);
+	if (!peek) {
+		return;
+	}
+	ut64 offset = 0;
+	while (offset + 11 < ci->size) {
+		const ut64 plen = R_MIN (CU_INDEX_PEEK, ci->size - offset);
+		memset (peek, 0, CU_INDEX_PEEK);
+		if (r_buf_read_at (ci->bf->buf, ci->paddr + offset, peek, plen) < 1) {
+			break;
+		}
+		const ut8 *buf_end = peek + plen;
+		RBinDwarfCompUnitHdr hdr = {0};
+		info_comp_unit_read_hdr (peek, buf_end, &hdr, be);
+		const ut64 size = hdr.length + (hdr.is_64bit? 12: 4);
+		if (!hdr.length || size > ci->size - offset) {
+			break;
+		}
+		RBinDwarfCuEntry entry = { .offset = offset, .size = size };
+		const ut32 unit = r_vector_length (&ci->units);
+		if (!r_vector_push (&ci->units, &entry)) {
+			break;
+		}
+		if (!cu_index_unit_die (ci, unit, peek, peek + R_MIN (plen, size)) && size > plen) {
+			ut8 *whole = malloc (size);
+			if (whole && r_buf_read_at (ci->bf->buf, ci->paddr + offset, whole, size) == size) {
+				cu_index_unit_die (ci, unit, whole, whole + size);
+			}
+			free (whole);
+		}
+		offset += size;
+	}
+	free (peek);
+}
+
+static int cu_unit_cmp(const void *a, const void *b) {
+	const ut64 off = *(const ut64 *)a;
+	const RBinDwarfCuEntry *e = b;
+	return (off < e->offset)? -1: (off > e->offset);
+}
+
+// units without address attributes are found through .debug_aranges
+static void cu_index_aranges(RBinDwarfCuIndex *ci) {
+	size_t len = 0;
+	ut8 *obuf = get_section_bytes (ci->bin, "debug_aranges", &len);
+	if (!obuf) {
+		return;
+	}
+	const bool be = ci->be;
+	const ut8 *buf = obuf;
+	const ut8 *end = obuf + len;
+	while (buf + 12 < end) {
+		const ut8 *set = buf;
+		const ut8 *buf_end = end;
+		bool is_64bit = false;
+		ut64 length = READ32 (buf);
+		if (length == DWARF_INIT_LEN_64) {
+			length = READ64 (buf);
+			is_64bit = true;
+		}
+		if (!length || length > (ut64)(end - buf)) {
+			break;
+		}
+		const ut8 *next = buf + length;
+		buf_end = next;
+		buf += 2; // version
+		const ut64 info_offset = dwarf_read_offset (is_64bit, &buf, buf_end, be);
+		const ut8 addr_size = READ8 (buf);
+		const ut8 seg_size = READ8 (buf);
+		const size_t tuple = 2 * addr_size + seg_size;
+		RBinDwarfCuEntry *e = bsearch (&info_offset, ci->units.a, r_vector_length (&ci->units), sizeof (RBinDwarfCuEntry), cu_unit_cmp);
+		if (e && (addr_size == 4 || addr_size == 8) && tuple) {
+			const ut32 unit = e - (RBinDwarfCuEntry *)ci->units.a;
+			// tuples are aligned to their size from the start of the set
+			const size_t pad = (tuple - ((buf - set) % tuple)) % tuple;
+			for (buf += pad; buf + tuple <= next; buf += tuple) {
+				const ut8 *p = buf + seg_size;
+				ut64 addr = (addr_size == 4)? r_read_ble32 (p, be): r_read_ble64 (p, be);
+				ut64 size = (addr_size == 4)? r_read_ble32 (p + 4, be): r_read_ble64 (p + 8, be);
+				if (!addr && !size) {
+					break;
+				}
+				cu_index_add_range (ci, unit, addr, addr + size);
+			}
+		}
+		buf = next;
+	}
+	free (obuf);
+}
+
+static int cu_range_cmp(const void *a, const void *b) {
+	const RBinDwarfCuRange *ra = a, *rb = b;
+	if (ra->from != rb->from) {
+		return (ra->from < rb->from)? -1: 1;
+	}
+	return (ra->to < rb->to)? -1: (ra->to > rb->to);
+}
+
+/**
+ * @brief Indexes the compilation units of .debug_info by the addresses they cover
+ *
+ * Only the unit headers, the unit DIEs and .debug_aranges are read, the units
+ * are decoded later with r_bin_dwarf_cu_index_get
+ *
+ * @param addr_size Size of an address, used for the location lists
+ * @param lru_size Number of decoded units to keep around
+ */
+R_API RBinDwarfCuIndex *r_bin_dwarf_cu_index_new(RBin *bin, int addr_size, int lru_size) {
+	r_return_val_if_fail (bin, NULL);
+	RBinFile *bf = bin->cur;
+	RBinSection *section = getsection (bin, "debug_info");
+	if (!bf || !section || !section->size || section->paddr >= bf->size) {
+		return NULL;
+	}
+	RBinDwarfCuIndex *ci = R_NEW0 (RBinDwarfCuIndex);
+	if (!ci) {
+		return NULL;
+	}
+	ci->bin = bin;
+	ci->bf = bf;
+	ci->paddr = section->paddr;
+	ci->size = R_MIN (section->size, bf->size - section->paddr);
+	ci->be = r_bin_is_big_endian (bin);
+	ci->addr_size = addr_size;
+	ci->lru_size = R_MAX (lru_size, 1);
+	r_vector_init (&ci->units, sizeof (RBinDwarfCuEntry), NULL, NULL);
+	r_vector_init (&ci->ranges, sizeof (RBinDwarfCuRange), NULL, NULL);
+	ci->lru = r_list_newf ((RListFree)r_bin_dwarf_free_debug_info);
+	ci->da = r_bin_dwarf_parse_abbrev (bin, R_MODE_SET);
+	if (!ci->lru || !ci->da) {
+		r_bin_dwarf_cu_index_free (ci);
+		return NULL;
+	}
+	cu_index_units (ci);
+	cu_index_aranges (ci);
+	if (!r_vector_empty (&ci->ranges)) {
+		qsort (ci->ranges.a, r_vector_length (&ci->ranges), sizeof (RBinDwarfCuRange), cu_range_cmp);
+	}
+	return ci;
+}
+
+R_API void r_bin_dwarf_cu_index_free(RBinDwarfCuIndex *ci) {
+	if (ci) {
+		r_bin_dwarf_free_debug_abbrev (ci->da);
+		r_vector_fini (&ci->units);
+		r_vector_fini (&ci->ranges);
+		r_list_free (ci->lru);
+		r_bin_dwarf_free_loc (ci->loc);
+		free (ci);
+	}
+}
+
+/**
+ * @brief Finds the compilation unit covering the given address
+ *
+ * @return int Index of the unit, -1 if none covers it
+ */
+R_API int r_bin_dwarf_cu_index_find(RBinDwarfCuIndex *ci, ut64 addr) {
+	r_return_val_if_fail (ci, -1);
+	const RBinDwarfCuRange *ranges = ci->ranges.a;
+	size_t lo = 0, hi = r_vector_length (&ci->ranges);
+	// last range starting at or before addr
+	while (lo < hi) {
+		const size_t mid = lo + (hi - lo) / 2;
+		if (ranges[mid].from <= addr) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	// ranges of nested or broken units may overlap, look a few back
+	size_t i, tries = 8;
+	for (i = lo; i > 0 && tries; i--, tries--) {
+		if (addr < ranges[i - 1].to) {
+			return ranges[i - 1].unit;
+		}
+	}
+	return -1;
+}
+
+static int cu_info_cmp(const void *a, const void *b) {
+	const ut64 *offset = a;
+	const RBinDwarfDebugInfo *info = b;
+	return info->comp_units[0].offset != *offset;
+}
+
+/**
+ * @brief Decodes all the DIEs of a compilation unit, keeping the last used ones
+ *
+ * @return const RBinDwarfDebugInfo* Information holding just that unit, owned
+ *         by the index and valid until lru_size other units are decoded
+ */
+R_API const RBinDwarfDebugInfo *r_bin_dwarf_cu_index_get(RBinDwarfCuIndex *ci, int unit) {
+	r_return_val_if_fail (ci, NULL);
+	if (unit < 0 || unit >= r_vector_length (&ci->units)) {
+		return NULL;
+	}
+	RBinDwarfCuEntry *e = r_vector_index_ptr (&ci->units, unit);
+	RListIter *it = r_list_find (ci->lru, &e->offset, cu_info_cmp);
+	if (it) {
+		RBinDwarfDebugInfo *info = it->data;
+		if (it != ci->lru->head) {
+			r_list_split_iter (ci->lru, it);
+			free (it);
+			r_list_prepend (ci->lru, info);
+		}
+		return info;
+	}
+	// the strings and line tables are read from the current file
+	if (ci->bin->cur != ci->bf) {
+		return NULL;
+	}
+	ut8 *buf = malloc (e->size);
+	if (!buf || r_buf_read_at (ci->bf->buf, ci->paddr + e->offset, buf, e->size) != e->size) {
+		free (buf);
+		return NULL;
+	}
+	RBinDwarfDebugInfo *info = R_NEW0 (RBinDwarfDebugInfo);
+	if (!init_debug_info (info)
+			|| !parse_unit (ci->bin, info, ci->bf->sdb_addrinfo, ci->da, e->offset, buf, buf + e->size, e->size, ci->be)) {
+		r_bin_dwarf_free_debug_info (info);
+		free (buf);
+		return NULL;
+	}
+	free (buf);
+	RBinDwarfCompUnit *cu = &info->comp_units[0];
+	size_t i;
+	for (i = 0; i < cu->count; i++) {
+		ht_up_insert (info->lookup_table, cu->dies[i].offset, &cu->dies[i]);
+	}
+	r_list_prepend (ci->lru, info);
+	while (r_list_length (ci->lru) > ci->lru_size) {
+		r_bin_dwarf_free_debug_info (r_list_pop (ci->lru));
+	}
+	return info;
+}
+
+R_API HtUP *r_bin_dwarf_cu_index_loc(RBinDwarfCuIndex *ci) {
+	r_return_val_if_fail (ci, NULL);
+	if (!ci->loc && ci->bin->cur == ci->bf) {
+		ci->loc = r_bin_dwarf_parse_loc (ci->bin, ci->addr_size);
+	}
+	return ci->loc;
+}
+
 static RBinDwarfRow *row_new(ut64 addr, const char *file, int line, int col) {
 	r_return_val_if_fail (file, NULL);
 	RBinDwarfRow *row = R_NEW0 (RBinDwarfRow);
@@ -2508,6 +2848,16 @@ static void row_free(void *p) {
 	}
 }
 
+static bool line_row_cb(void *user, const RBinAddrline *al) {
+	if (al->line != R_BIN_ADDRLINE_TEXT) {
+		RBinDwarfRow *row = row_new (al->addr, al->file, al->line, al->column);
+		if (row) {
+			r_list_append ((RList *)user, row);
+		}
+	}
+	return true;
+}
+
 R_API RList *r_bin_dwarf_parse_line(RBin *bin, int mode) {
 	r_return_val_if_fail (bin, NULL);
 	ut8 *buf;
@@ -2538,40 +2888,10 @@ R_API RList *r_bin_dwarf_parse_line(RBin *bin, int mode) {
 		/* set the endianity global [HOTFIX] */
 		// Actually parse the section
 		parse_line_raw (bin, buf, len, mode, be);
-		// k bin/cur/addrinfo/*
-		SdbListIter *iter;
-		SdbKv *kv;
-		SdbList *ls = sdb_foreach_list (binfile->sdb_addrinfo, false);
 		// Use the parsed information from _raw and transform it to more useful format
-		ls_foreach (ls, iter, kv) {
-			const char *key = sdbkv_key (kv);
-			if (r_str_startswith (key, "0x")) {
-				char *file = strdup (sdbkv_value (kv));
-				if (!file) {
-					free (buf);
-					ls_free (ls);
-					r_list_free (list);
-					return NULL;
-				}
-				char *tok = strchr (file, '|');
-				if (tok) {
-					*tok++ = 0;
-					int line = atoi (tok);
-					int column = 0;
-					char *tok2 = strchr (tok, '|');
-					if (tok2) {
-						column = atoi (tok2 + 1);
-					}
-					ut64 addr = r_num_get (NULL, key);
-					RBinDwarfRow *row = row_new (addr, file, line, column);
-					if (row) {
-						r_list_append (list, row);
-					}
-				}
-				free (file);
-			}
+		if (binfile->addrline) {
+			r_bin_addrline_foreach (binfile->addrline, line_row_cb, list);
 		}
-		ls_free (ls);
 		free (buf);
 	}
 	return list;
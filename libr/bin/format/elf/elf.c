@@ -1567,8 +1567,8 @@ static bool elf_init(ELFOBJ *eo) {
 	(void) _load_elf_sections (eo);
 	eo->boffset = Elf_(get_boffset) (eo);
 	HtUUOptions opt = {0};
+	// the relocs are parsed on first use, see Elf_(load_relocs)
 	eo->rel_cache = ht_uu_new_opt (&opt);
-	(void) Elf_(load_relocs) (eo);
 	sdb_ns_set (eo->kv, "versioninfo", store_versioninfo (eo));
 	return true;
 }
@@ -1819,7 +1819,7 @@ static ut64 get_import_addr(ELFOBJ *eo, int sym) {
 		return UT64_MAX;
 	}
 
-	if (!eo->rel_cache) {
+	if (!eo->rel_cache || !Elf_(load_relocs) (eo)) {
 		return UT64_MAX;
 	}
 
@@ -116,24 +116,16 @@ ut64 r_coresym_cache_element_pa2va(RCoreSymCacheElement *element, ut64 pa) {
 }
 
 static void meta_add_fileline(RBinFile *bf, ut64 vaddr, ut32 size, RCoreSymCacheElementFLC *flc) {
-	Sdb *s = bf->sdb_addrinfo;
-	if (!s) {
+	RBinAddrLineStore *s = bf->addrline;
+	if (!s || !flc->file) {
 		return;
 	}
-	char aoffset[SDB_NUM_BUFSZ];
 	ut64 cursor = vaddr;
 	ut64 end = cursor + R_MAX (size, 1);
-	char *fileline = r_str_newf ("%s:%d", flc->file, flc->line);
 	while (cursor < end) {
-		char *aoffsetptr = sdb_itoa (cursor, 16, aoffset, sizeof (aoffset));
-		if (!aoffsetptr) {
-			break;
-		}
-		sdb_set (s, aoffsetptr, fileline, 0);
-		sdb_set (s, fileline, aoffsetptr, 0);
+		r_bin_addrline_set (s, cursor, flc->file, flc->line, flc->col);
 		cursor += 2;
 	}
-	free (fileline);
 }
 
 static char *str_dup_safe(const ut8 *b, const ut8 *str, const ut8 *end) {
@@ -342,9 +342,51 @@ static void find_indx_in_list(RList *l, int index, SStreamParseFunc **res) {
 	}
 }
 
+typedef struct {
+	R_STREAM_FILE stream_file;
+	STpiStream *tpi_stream;
+	SStreamParseFunc *stream_parse_func;
+	RThreadPool *pool;
+	RThreadFuture *future;
+	int res;
+} SStreamJob;
+
+static void *parse_stream_job(void *user) {
+	SStreamJob *job = user;
+	if (job->tpi_stream) {
+		job->res = parse_tpi_stream (job->tpi_stream, &job->stream_file, job->pool);
+	} else {
+		job->stream_parse_func->parse_stream (job->stream_parse_func->stream, &job->stream_file);
+		job->res = 1;
+	}
+	return NULL;
+}
+
+static void free_stream_job(void *user) {
+	SStreamJob *job = user;
+	r_th_future_free (job->future);
+	free (job);
+}
+
+static bool add_stream_job(RList *jobs, R_STREAM_FILE *stream_file, STpiStream *tpi_stream, SStreamParseFunc *stream_parse_func, RThreadPool *pool) {
+	SStreamJob *job = R_NEW0 (SStreamJob);
+	if (!job) {
+		return false;
+	}
+	job->stream_file = *stream_file;
+	job->tpi_stream = tpi_stream;
+	job->stream_parse_func = stream_parse_func;
+	job->pool = pool;
+	r_list_append (jobs, job);
+	// without a pool the job runs right away
+	job->future = r_th_pool_submit (pool, parse_stream_job, job);
+	return job->future != NULL;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 static int pdb_read_root(RPdb *pdb) {
 	int i = 0;
+	int res = 0;
 	RList *pList = pdb->pdb_streams;
 	R_PDB7_ROOT_STREAM *root_stream = pdb->root_stream;
 	R_PDB_STREAM *pdb_stream = 0;
@@ -354,6 +396,16 @@ static int pdb_read_root(RPdb *pdb) {
 	RListIter *it;
 	SPage *page = 0;
 	SStreamParseFunc *stream_parse_func = 0;
+	RThreadPool *pool = NULL;
+	// the type and symbol streams are parsed in the background
+	RList *jobs = r_list_newf (free_stream_job);
+	if (!jobs) {
+		return 0;
+	}
+	if (pdb->pool && pdb->pool->size > 1 && pdb->buf->methods->get_whole_buf) {
+		// only when the pages can be read without going through the buffer
+		pool = pdb->pool;
+	}
 
 	it = r_list_iterator (root_stream->streams_list);
 	while (r_list_iter_next (it)) {
@@ -374,7 +426,7 @@ static int pdb_read_root(RPdb *pdb) {
 		case ePDB_STREAM_PDB:
 			pdb_info_stream = R_NEW0 (SPDBInfoStream);
 			if (!pdb_info_stream) {
-				return 0;
+				goto beach;
 			}
 			pdb_info_stream->free_ = free_info_stream;
 			parse_pdb_info_stream (pdb_info_stream, &stream_file);
@@ -383,20 +435,19 @@ static int pdb_read_root(RPdb *pdb) {
 		case ePDB_STREAM_TPI:
 			tpi_stream = R_NEW0 (STpiStream);
 			if (!tpi_stream) {
-				return 0;
+				goto beach;
 			}
 			init_tpi_stream (tpi_stream);
-			if (!parse_tpi_stream (tpi_stream, &stream_file)) {
-				free (tpi_stream);
-				return 0;
-			}
 			r_list_append (pList, tpi_stream);
+			if (!add_stream_job (jobs, &stream_file, tpi_stream, NULL, pool)) {
+				goto beach;
+			}
 			break;
 		case ePDB_STREAM_DBI:
 		{
 			SDbiStream *dbi_stream = R_NEW0 (SDbiStream);
 			if (!dbi_stream) {
-				return 0;
+				goto beach;
 			}
 			init_dbi_stream (dbi_stream);
 			parse_dbi_stream (dbi_stream, &stream_file);
@@ -408,13 +459,15 @@ static int pdb_read_root(RPdb *pdb) {
 		default:
 			find_indx_in_list (pdb->pdb_streams2, i, &stream_parse_func);
 			if (stream_parse_func && stream_parse_func->parse_stream) {
-				stream_parse_func->parse_stream (stream_parse_func->stream, &stream_file);
+				if (!add_stream_job (jobs, &stream_file, NULL, stream_parse_func, pool)) {
+					goto beach;
+				}
 				break;
 			}
 
 			pdb_stream = R_NEW0 (R_PDB_STREAM);
 			if (!pdb_stream) {
-				return 0;
+				goto beach;
 			}
 			init_r_pdb_stream (pdb_stream, pdb->buf, (int *) page->stream_pages,
 				root_stream->pdb_stream.pages_amount, i,
@@ -423,11 +476,25 @@ static int pdb_read_root(RPdb *pdb) {
 			break;
 		}
 		if (stream_file.error) {
-			return 0;
+			goto beach;
 		}
 		i++;
 	}
-	return 1;
+	res = 1;
+beach:
+	it = r_list_iterator (jobs);
+	while (r_list_iter_next (it)) {
+		SStreamJob *job = r_list_iter_get (it);
+		r_th_future_wait (job->future);
+		if (!job->res || job->stream_file.error) {
+			res = 0;
+		} else if (job->tpi_stream) {
+			// type lookups are thread local, make them work in this thread
+			select_tpi_stream (job->tpi_stream);
+		}
+	}
+	r_list_free (jobs);
+	return res;
 }
 
 static bool pdb7_parse(RPdb *pdb) {
@@ -1502,7 +1569,10 @@ error:
 }
 
 R_API bool init_pdb_parser(RPdb *pdb, const char *filename) {
-	RBuffer *buf = r_buf_new_slurp (filename);
+	RBuffer *buf = r_buf_new_mmap (filename, R_PERM_R);
+	if (!buf) {
+		buf = r_buf_new_slurp (filename);
+	}
 	if (!buf) {
 		R_LOG_ERROR ("%s: Error reading file \"%s\"", __func__, filename);
 		return false;
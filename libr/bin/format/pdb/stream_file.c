@@ -8,6 +8,12 @@
 int init_r_stream_file(R_STREAM_FILE *stream_file, RBuffer *buf, int *pages, int pages_amount, int size, int page_size) {
 	stream_file->error = 0;
 	stream_file->buf = buf;
+	stream_file->data = NULL;
+	stream_file->data_size = 0;
+	if (buf && buf->methods->get_whole_buf) {
+		// mmaped or in memory, no need to go through the buffer api
+		stream_file->data = r_buf_data (buf, &stream_file->data_size);
+	}
 	stream_file->pages = pages;
 	stream_file->pages_amount = pages_amount;
 	stream_file->page_size = page_size;
@@ -21,24 +27,40 @@ int init_r_stream_file(R_STREAM_FILE *stream_file, RBuffer *buf, int *pages, int
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-static void stream_file_read_pages(R_STREAM_FILE *stream_file, int start_indx, int end_indx, char *res) {
-	int i, page_offset;
-
-	if ((end_indx - start_indx) > stream_file->end) {
-		stream_file->error = READ_PAGE_FAIL;
-		return;
+static bool stream_file_read_page(R_STREAM_FILE *stream_file, int indx, int off, int len, char *res) {
+	if (indx >= stream_file->pages_amount || stream_file->pages[indx] < 1) {
+		return false;
 	}
-	end_indx = R_MIN (end_indx, stream_file->pages_amount);
+	ut64 at = (ut64)stream_file->pages[indx] * stream_file->page_size + off;
+	if (stream_file->data) {
+		if (at + len > stream_file->data_size) {
+			return false;
+		}
+		memcpy (res, stream_file->data + at, len);
+		return true;
+	}
+	return r_buf_read_at (stream_file->buf, at, (ut8 *)res, len) == len;
+}
 
-	for (i = start_indx; i < end_indx; i++) {
-		page_offset = stream_file->pages[i] * stream_file->page_size;
-		if (page_offset < 1) {
-			return;
+// copies len bytes from the stream offset pos, everything after a missing page reads as zeros
+///////////////////////////////////////////////////////////////////////////////
+static void stream_file_copy(R_STREAM_FILE *stream_file, int pos, int len, char *res) {
+	int indx, off;
+	bool ok = true;
+
+	GET_PAGE (indx, off, pos, stream_file->page_size);
+	while (len > 0) {
+		int n = R_MIN (len, stream_file->page_size - off);
+		if (ok) {
+			ok = stream_file_read_page (stream_file, indx, off, n, res);
 		}
-		r_buf_seek (stream_file->buf, page_offset, R_BUF_SET);
-		r_buf_read_at (stream_file->buf, page_offset,
-			(ut8 *)res, stream_file->page_size);
-		res += stream_file->page_size;
+		if (!ok) {
+			memset (res, 0, n);
+		}
+		res += n;
+		len -= n;
+		off = 0;
+		indx++;
 	}
 }
 
@@ -47,27 +69,50 @@ static void stream_file_read_pages(R_STREAM_FILE *stream_file, int start_indx, i
 void stream_file_read(R_STREAM_FILE *stream_file, int size, char *res) {
 	size_t pn_start, off_start, pn_end, off_end;
 	if (size == -1) {
-		char *pdata = (char *) calloc(stream_file->pages_amount, stream_file->page_size);
-		if (pdata) {
-			GET_PAGE (pn_start, off_start, stream_file->pos, stream_file->page_size);
-			(void)off_end; // hack to remove unused warning
-			stream_file_read_pages (stream_file, 0, stream_file->pages_amount, pdata);
-			stream_file->pos = stream_file->end;
-			memcpy (res, pdata + off_start, stream_file->end - off_start);
-			free (pdata);
+		GET_PAGE (pn_start, off_start, stream_file->pos, stream_file->page_size);
+		(void)pn_start; // hack to remove unused warning
+		stream_file_copy (stream_file, off_start, stream_file->end - off_start, res);
+		stream_file->pos = stream_file->end;
+	} else if (size > 0) {
+		GET_PAGE (pn_start, off_start, stream_file->pos, stream_file->page_size);
+		GET_PAGE (pn_end, off_end, stream_file->pos + size, stream_file->page_size);
+		(void)off_start; // hack to remove unused warning
+		(void)off_end;
+		if ((int)(pn_end + 1 - pn_start) > stream_file->end) {
+			stream_file->error = READ_PAGE_FAIL;
+			memset (res, 0, size);
+		} else {
+			stream_file_copy (stream_file, stream_file->pos, size, res);
 		}
-	} else {
-		GET_PAGE(pn_start, off_start, stream_file->pos, stream_file->page_size);
-		GET_PAGE(pn_end, off_end, stream_file->pos + size, stream_file->page_size);
-		(void)off_end; // hack to remove unused warning
-		char *pdata = (char *) calloc(stream_file->page_size * (pn_end + 1 - pn_start), 1);
-		if (pdata) {
-			stream_file_read_pages(stream_file, pn_start, pn_end + 1, pdata);
-			stream_file->pos += size;
-			memcpy(res, pdata + off_start, size);
-			free (pdata);
+		stream_file->pos += size;
+	}
+}
+
+// Returns the next size bytes of the stream without copying them and moves past them.
+// NULL when they are not contiguous in memory, stream_file_read must be used then.
+///////////////////////////////////////////////////////////////////////////////
+const ut8 *stream_file_view(R_STREAM_FILE *stream_file, int size) {
+	int indx, off, last, i;
+
+	if (!stream_file->data || size < 1 || stream_file->pos + size > stream_file->end) {
+		return NULL;
+	}
+	GET_PAGE (indx, off, stream_file->pos, stream_file->page_size);
+	last = (stream_file->pos + size - 1) / stream_file->page_size;
+	if (last >= stream_file->pages_amount || stream_file->pages[indx] < 1) {
+		return NULL;
+	}
+	for (i = indx + 1; i <= last; i++) {
+		if (stream_file->pages[i] != stream_file->pages[i - 1] + 1) {
+			return NULL;
 		}
 	}
+	ut64 at = (ut64)stream_file->pages[indx] * stream_file->page_size + off;
+	if (at + size > stream_file->data_size) {
+		return NULL;
+	}
+	stream_file->pos += size;
+	return stream_file->data + at;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
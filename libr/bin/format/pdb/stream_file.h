@@ -14,6 +14,9 @@ int init_r_stream_file(R_STREAM_FILE *stream_file, RBuffer *buf, int *pages,
 ///////////////////////////////////////////////////////////////////////////////
 void stream_file_read(R_STREAM_FILE *stream_file, int size, char *res);
 
+///////////////////////////////////////////////////////////////////////////////
+const ut8 *stream_file_view(R_STREAM_FILE *stream_file, int size);
+
 ///////////////////////////////////////////////////////////////////////////////
 void stream_file_seek(R_STREAM_FILE *stream_file, int offset, int whence);
 
@@ -5,7 +5,13 @@
 #include "stream_file.h"
 
 static R_TH_LOCAL unsigned int base_idx = 0;
-static R_TH_LOCAL RList *p_types_list;
+static R_TH_LOCAL SType **p_types_index;
+static R_TH_LOCAL ut32 p_types_count;
+
+// types are looked up by idx - base_idx
+static SType *get_type_at(ut32 indx) {
+	return (p_types_index && indx < p_types_count)? p_types_index[indx]: NULL;
+}
 
 static bool is_simple_type(int idx) {
 	ut32 value = (ut32) idx;
@@ -820,7 +826,7 @@ static int get_array_element_type(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -846,7 +852,7 @@ static int get_array_index_type(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -873,7 +879,7 @@ static int get_bitfield_base_type(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -887,7 +893,7 @@ static int get_class_struct_derived(void *type, void **ret_type) {
 
 	if (curr_idx) {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	} else {
 		*ret_type = NULL;
 	}
@@ -902,7 +908,7 @@ static int get_class_struct_vshape(void *type, void **ret_type) {
 
 	if (curr_idx) {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	} else {
 		*ret_type = NULL;
 	}
@@ -929,7 +935,7 @@ static int get_mfunction_return_type(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -942,7 +948,7 @@ static int get_mfunction_class_type(void *type, void **ret_type) {
 
 	if (curr_idx) {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	} else {
 		*ret_type = NULL;
 	}
@@ -957,7 +963,7 @@ static int get_mfunction_this_type(void *type, void **ret_type) {
 
 	if (curr_idx) {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	} else {
 		*ret_type = NULL;
 	}
@@ -973,7 +979,7 @@ static int get_mfunction_arglist(void *type, void **ret_type) {
 
 	if (curr_idx) {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	} else {
 		*ret_type = NULL;
 	}
@@ -1001,7 +1007,7 @@ static int get_modifier_modified_type(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -1027,7 +1033,7 @@ static int get_pointer_utype(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -1052,7 +1058,7 @@ static int get_procedure_return_type(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -1077,7 +1083,7 @@ static int get_procedure_arglist(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -1102,7 +1108,7 @@ static int get_member_index(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -1127,7 +1133,7 @@ static int get_nesttype_index(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -1152,7 +1158,7 @@ static int get_onemethod_index(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -1177,7 +1183,7 @@ static int get_method_mlist(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -1202,7 +1208,7 @@ static int get_enum_utype(void *type, void **ret_type) {
 		return true; // check what are the return values used for
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = get_type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -1225,7 +1231,7 @@ static void get_union_members(void *type, RList **l) {
 	} else {
 		SType *tmp = 0;
 		indx = lf_union->field_list - base_idx;
-		tmp = (SType *)r_list_get_n(p_types_list, indx);
+		tmp = (SType *)get_type_at (indx);
 		*l = tmp ? ((SLF_FIELDLIST *)tmp->type_data.type_info)->substructs : NULL;
 	}
 }
@@ -1240,7 +1246,7 @@ static void get_struct_class_members(void *type, RList **l) {
 	} else {
 		SType *tmp = 0;
 		indx = lf->field_list - base_idx;
-		tmp = (SType *)r_list_get_n(p_types_list, indx);
+		tmp = (SType *)get_type_at (indx);
 		*l = tmp ? ((SLF_FIELDLIST *)tmp->type_data.type_info)->substructs : NULL;
 	}
 }
@@ -1255,7 +1261,7 @@ static void get_enum_members(void *type, RList **l) {
 	} else {
 		SType *tmp = 0;
 		indx = lf->field_list - base_idx;
-		tmp = (SType *)r_list_get_n(p_types_list, indx);
+		tmp = (SType *)get_type_at (indx);
 		*l = tmp ? ((SLF_FIELDLIST *)tmp->type_data.type_info)->substructs : NULL;
 	}
 }
@@ -1663,6 +1669,11 @@ static void free_tpi_stream(void *stream) {
 		R_FREE (type);
 	}
 	r_list_free (tpi_stream->types);
+	if (p_types_index == tpi_stream->index) {
+		p_types_index = NULL;
+		p_types_count = 0;
+	}
+	R_FREE (tpi_stream->index);
 }
 
 static void get_array_print_type(void *type, char **name) {
@@ -2852,27 +2863,17 @@ static int parse_lf_vtshape(SLF_VTSHAPE *lf_vtshape, uint8_t *leaf_data, unsigne
 
 #define PARSE_LF(lf_type, lf_func) { \
 	lf_type *lf = (lf_type *) malloc(sizeof (lf_type)); \
-	if (!lf) { free (leaf_data); return 0; }\
+	if (!lf) { return 0; }\
 	parse_##lf_func(lf, leaf_data + 2, &read_bytes, type->length); \
 	type->type_data.type_info = (void *) lf; \
 	init_stype_info(&type->type_data); \
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-static int parse_tpi_stypes(R_STREAM_FILE *stream, SType *type) {
-	uint8_t *leaf_data;
+static int parse_tpi_leaf(SType *type, uint8_t *leaf_data) {
 	unsigned int read_bytes = 0;
 
-	stream_file_read(stream, 2, (char *)&type->length);
-	if (type->length < 1) {
-		return 0;
-	}
-	leaf_data = (uint8_t *) malloc(type->length);
-	if (!leaf_data) {
-		return 0;
-	}
-	stream_file_read (stream, type->length, (char *)leaf_data);
-	type->type_data.leaf_type = *(uint16_t *)leaf_data;
+	type->type_data.leaf_type = r_read_le16 (leaf_data);
 	read_bytes += 2;
 	switch (type->type_data.leaf_type) {
 	case eLF_FIELDLIST:
@@ -2892,7 +2893,6 @@ static int parse_tpi_stypes(R_STREAM_FILE *stream, SType *type) {
 	{
 		SLF_POINTER *lf = (SLF_POINTER *) malloc(sizeof (SLF_POINTER)); \
 		if (!lf) { \
-			free (leaf_data); \
 			return 0; \
 		} \
 		parse_lf_pointer(lf, leaf_data + 2, &read_bytes, type->length); \
@@ -2933,38 +2933,112 @@ static int parse_tpi_stypes(R_STREAM_FILE *stream, SType *type) {
 		break;
 	}
 
-	free (leaf_data);
 	return read_bytes;
 }
 
-int parse_tpi_stream(void *parsed_pdb_stream, R_STREAM_FILE *stream) {
-	int i;
-	SType *type = 0;
-	STpiStream *tpi_stream = (STpiStream *) parsed_pdb_stream;
-	tpi_stream->types = r_list_new ();
-	p_types_list = tpi_stream->types;
-
-	stream_file_read(stream, sizeof (STPIHeader), (char *)&tpi_stream->header);
-
-	base_idx = tpi_stream->header.idx_begin;
+///////////////////////////////////////////////////////////////////////////////
+static int parse_tpi_stypes(R_STREAM_FILE *stream, SType *type) {
+	stream_file_read (stream, 2, (char *)&type->length);
+	if (type->length < 2) {
+		return 0;
+	}
+	// records are read in place when the file is mapped in memory
+	uint8_t *leaf_data = (uint8_t *)stream_file_view (stream, type->length);
+	if (leaf_data) {
+		return parse_tpi_leaf (type, leaf_data);
+	}
+	leaf_data = (uint8_t *) malloc (type->length);
+	if (!leaf_data) {
+		return 0;
+	}
+	stream_file_read (stream, type->length, (char *)leaf_data);
+	int read_bytes = parse_tpi_leaf (type, leaf_data);
+	free (leaf_data);
+	return read_bytes;
+}
 
-	for (i = tpi_stream->header.idx_begin; i < tpi_stream->header.idx_end; i++) {
-		type = (SType *) malloc (sizeof (SType));
+typedef struct {
+	STpiStream *tpi_stream;
+	R_STREAM_FILE *stream;
+	ut32 *offsets;
+} STpiParse;
+
+static void parse_tpi_range(void *user, size_t from, size_t to) {
+	STpiParse *tp = user;
+	STpiStream *tpi_stream = tp->tpi_stream;
+	// every worker walks its own copy of the stream
+	R_STREAM_FILE stream = *tp->stream;
+	size_t i;
+	for (i = from; i < to; i++) {
+		if (tp->offsets[i] == UT32_MAX) {
+			continue;
+		}
+		SType *type = (SType *) malloc (sizeof (SType));
 		if (!type) {
-			return 0;
+			continue;
 		}
-		type->tpi_idx = i;
+		type->tpi_idx = tpi_stream->header.idx_begin + i;
 		type->type_data.type_info = 0;
 		type->type_data.leaf_type = eLF_MAX;
-		init_stype_info(&type->type_data);
-		if (!parse_tpi_stypes(stream, type)) {
+		init_stype_info (&type->type_data);
+		stream_file_seek (&stream, tp->offsets[i], 0);
+		if (!parse_tpi_stypes (&stream, type)) {
 			R_FREE (type);
 		}
-		r_list_append(tpi_stream->types, type);
+		tpi_stream->index[i] = type;
 	}
+}
+
+int parse_tpi_stream(void *parsed_pdb_stream, R_STREAM_FILE *stream, RThreadPool *pool) {
+	STpiStream *tpi_stream = (STpiStream *) parsed_pdb_stream;
+	ut32 i, count;
+	ut16 length;
+
+	tpi_stream->types = r_list_new ();
+	stream_file_read (stream, sizeof (STPIHeader), (char *)&tpi_stream->header);
+	if (tpi_stream->header.idx_end <= tpi_stream->header.idx_begin) {
+		return 1;
+	}
+	// every record takes at least the two bytes of its length
+	count = tpi_stream->header.idx_end - tpi_stream->header.idx_begin;
+	count = R_MIN (count, (ut32)R_MAX (stream->end - stream_file_tell (stream), 0) / 2 + 1);
+	ut32 *offsets = R_NEWS (ut32, count);
+	tpi_stream->index = R_NEWS0 (SType *, count);
+	if (!offsets || !tpi_stream->index) {
+		free (offsets);
+		return 0;
+	}
+	tpi_stream->count = count;
+	// first pass: where each type index starts, so records can be decoded in any order
+	for (i = 0; i < count; i++) {
+		if (stream_file_tell (stream) + 2 > stream->end) {
+			offsets[i] = UT32_MAX;
+			continue;
+		}
+		offsets[i] = stream_file_tell (stream);
+		stream_file_read (stream, 2, (char *)&length);
+		if (length < 2) {
+			offsets[i] = UT32_MAX;
+		}
+		stream_file_seek (stream, length, 1);
+	}
+	STpiParse tp = { tpi_stream, stream, offsets };
+	// workers can only share the stream when its pages are in memory
+	r_th_parallel_for (stream->data? pool: NULL, 0, count, 0, parse_tpi_range, &tp);
+	free (offsets);
+	for (i = 0; i < count; i++) {
+		r_list_append (tpi_stream->types, tpi_stream->index[i]);
+	}
+	select_tpi_stream (tpi_stream);
 	return 1;
 }
 
+void select_tpi_stream(STpiStream *tpi_stream) {
+	base_idx = tpi_stream->header.idx_begin;
+	p_types_index = tpi_stream->index;
+	p_types_count = tpi_stream->count;
+}
+
 void init_tpi_stream(STpiStream *tpi_stream) {
 	tpi_stream->free_ = free_tpi_stream;
 }
@@ -5,7 +5,11 @@
 void init_tpi_stream(STpiStream *tpi_stream);
 
 ///////////////////////////////////////////////////////////////////////////////
-int parse_tpi_stream(void *parsed_pdb_stream, R_STREAM_FILE *stream);
+int parse_tpi_stream(void *parsed_pdb_stream, R_STREAM_FILE *stream, RThreadPool *pool);
+
+// makes the type lookups of the calling thread use this stream
+///////////////////////////////////////////////////////////////////////////////
+void select_tpi_stream(STpiStream *tpi_stream);
 
 // TODO: Remove to separate file
 int parse_sctring(SCString *sctr, unsigned char *leaf_data, unsigned int *read_bytes, unsigned int len);
@@ -93,6 +93,8 @@
 typedef struct R_STREAM_FILE_{
 //	FILE *fp;
 	RBuffer *buf;
+	const ut8 *data; // bytes of buf when it is backed by memory, pages are read from here without copies
+	ut64 data_size;
 	int *pages;
 	int page_size;
 	int pages_amount;
@@ -1150,6 +1152,8 @@ typedef struct {
 typedef struct {
 	STPIHeader header;
 	RList *types;
+	SType **index; // types by idx - header.idx_begin, NULL for the ones that failed to parse
+	ut32 count;
 
 	free_func free_;
 } STpiStream;
@@ -32,6 +32,13 @@ R_IPI const char *r_bin_lang_tostring(int lang);
 R_IPI int r_bin_lang_type(RBinFile *binfile, const char *def, const char *sym);
 R_IPI bool r_bin_lang_swift(RBinFile *binfile);
 
+R_IPI char *r_bin_demangle_cxx_raw(const char *str);
+R_IPI bool r_bin_demangle_cached(RBinFile *bf, int type, const char *str, char **res);
+R_IPI void r_bin_demangle_cache(RBinFile *bf, int type, const char *str, const char *res);
+
+R_IPI RList *r_bin_cache_load(RBinFile *bf, RBinObject *bo, const char *kind);
+R_IPI void r_bin_cache_save(RBinFile *bf, RBinObject *bo, const char *kind, RList *items);
+
 R_IPI void r_bin_class_free(RBinClass *c);
 R_IPI RBinSymbol *r_bin_class_add_method(RBinFile *binfile, const char *classname, const char *name, int nargs);
 R_IPI void r_bin_class_add_field(RBinFile *binfile, const char *classname, const char *name);
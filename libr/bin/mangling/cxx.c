@@ -4,7 +4,8 @@
 #include "../i/private.h"
 #include "./cxx/demangle.h"
 
-R_API char *r_bin_demangle_cxx(RBinFile *bf, const char *str, ut64 vaddr) {
+// demangles str without touching any RBinFile, safe to call from any thread
+R_IPI char *r_bin_demangle_cxx_raw(const char *str) {
 	// DMGL_TYPES | DMGL_PARAMS | DMGL_ANSI | DMGL_VERBOSE
 	// | DMGL_RET_POSTFIX | DMGL_TYPES;
 	int i;
@@ -53,38 +54,53 @@ R_API char *r_bin_demangle_cxx(RBinFile *bf, const char *str, ut64 vaddr) {
 	char *out = NULL;
 #endif
 	free (tmpstr);
-	if (out) {
-		char *sign = (char *)strchr (out, '(');
-		if (sign) {
-			char *str = out;
-			char *ptr = NULL;
-			char *nerd = NULL;
-			for (;;) {
-				ptr = strstr (str, "::");
-				if (!ptr || ptr > sign) {
-					break;
+	return out;
+}
+
+// registers the class method out demangles to
+static void add_method(RBinFile *bf, char *out, ut64 vaddr) {
+	char *sign = (char *)strchr (out, '(');
+	if (!sign) {
+		return;
+	}
+	char *str = out;
+	char *ptr = NULL;
+	char *nerd = NULL;
+	for (;;) {
+		ptr = strstr (str, "::");
+		if (!ptr || ptr > sign) {
+			break;
+		}
+		nerd = ptr;
+		str = ptr + 1;
+	}
+	if (nerd && *nerd) {
+		*nerd = 0;
+		RBinSymbol *sym = r_bin_file_add_method (bf, out, nerd + 2, 0);
+		if (sym) {
+			if (sym->vaddr != 0 && sym->vaddr != vaddr) {
+				if (bf->rbin && bf->rbin->verbose) {
+					eprintf ("Dupped method found: %s\n", sym->name);
 				}
-				nerd = ptr;
-				str = ptr + 1;
 			}
-			if (nerd && *nerd) {
-				*nerd = 0;
-				if (bf) {
-					RBinSymbol *sym = r_bin_file_add_method (bf, out, nerd + 2, 0);
-					if (sym) {
-						if (sym->vaddr != 0 && sym->vaddr != vaddr) {
-							if (bf && bf->rbin && bf->rbin->verbose) {
-								eprintf ("Dupped method found: %s\n", sym->name);
-							}
-						}
-						if (sym->vaddr == 0) {
-							sym->vaddr = vaddr;
-						}
-					}
-				}
-				*nerd = ':';
+			if (sym->vaddr == 0) {
+				sym->vaddr = vaddr;
 			}
 		}
+		*nerd = ':';
+	}
+}
+
+R_API char *r_bin_demangle_cxx(RBinFile *bf, const char *str, ut64 vaddr) {
+	char *out = NULL;
+	if (!bf || !r_bin_demangle_cached (bf, R_BIN_LANG_CXX, str, &out)) {
+		out = r_bin_demangle_cxx_raw (str);
+		if (bf) {
+			r_bin_demangle_cache (bf, R_BIN_LANG_CXX, str, out);
+		}
+	}
+	if (out && bf) {
+		add_method (bf, out, vaddr);
 	}
 	return out;
 }
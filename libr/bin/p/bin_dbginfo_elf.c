@@ -4,24 +4,12 @@
 
 // TODO: use proper dwarf api here.. or deprecate
 static bool get_line(RBinFile *bf, ut64 addr, char *file, int len, int *line, int *colu) {
-	if (bf->sdb_addrinfo) {
-		char offset[SDB_NUM_BUFSZ];
-		char *offset_ptr = sdb_itoa (addr, 16, offset, sizeof (offset));
-		char *ret = sdb_get (bf->sdb_addrinfo, offset_ptr, 0);
-		if (ret) {
-			char *p = strchr (ret, '|');
-			if (p) {
-				*p++ = '\0';
-				char *c = strchr (p, ':');
-				if (c) {
-					*c++ = 0;
-					*colu = atoi (c);
-				}
-				r_str_ncpy (file, ret, len);
-				*line = atoi (p);
-				return true;
-			}
-		}
+	RBinAddrline row;
+	if (bf->addrline && r_bin_addrline_get (bf->addrline, addr, &row) && row.line != R_BIN_ADDRLINE_TEXT) {
+		r_str_ncpy (file, row.file, len);
+		*line = row.line;
+		*colu = row.column;
+		return true;
 	}
 	return false;
 }
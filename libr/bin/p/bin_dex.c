@@ -611,25 +611,18 @@ static void dex_parse_debug_item(RBinFile *bf, RBinDexClass *c, int MI, int MA,
 		}
 	}
 
-	if (!bf->sdb_addrinfo) {
-		bf->sdb_addrinfo = sdb_new0 ();
-	}
-
 	RListIter *iter1;
 	struct dex_debug_position_t *pos;
 	// Loading the debug info takes too much time and nobody uses this afaik
 	// 0.5s of 5s is spent in this loop
 	r_list_foreach (debug_positions, iter1, pos) {
 		const char *line = getstr (dex, pos->source_file_idx);
-		char offset[SDB_NUM_BUFSZ] = {0};
 		if (R_STR_ISEMPTY (line)) {
 			continue;
 		}
-		char *fileline = r_str_newf ("%s|%"PFMT64d, line, pos->line);
-		char *offset_ptr = sdb_itoa (pos->address + paddr, 16, offset, sizeof (offset));
-		sdb_set (bf->sdb_addrinfo, offset_ptr, fileline, 0);
-		sdb_set (bf->sdb_addrinfo, fileline, offset_ptr, 0);
-		free (fileline);
+		if (bf->addrline) {
+			r_bin_addrline_set (bf->addrline, pos->address + paddr, line, (ut32)pos->line, 0);
+		}
 
 		RBinDwarfRow *rbindwardrow = R_NEW0 (RBinDwarfRow);
 		if (!rbindwardrow) {
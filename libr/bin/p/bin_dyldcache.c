@@ -8,6 +8,7 @@
 
 #define R_IS_PTR_AUTHENTICATED(x) B_IS_SET(x, 63)
 #define MAX_N_HDR 128
+#define INDEX_VERSION 1
 
 typedef struct {
 	ut8 version;
@@ -95,6 +96,9 @@ typedef struct _r_dyldcache {
 	RDyldLocSym *locsym;
 	objc_cache_opt_info *oi;
 	bool objc_opt_info_loaded;
+	Sdb *index;
+	char *index_path;
+	bool index_dirty;
 } RDyldCache;
 
 typedef struct _r_bin_image {
@@ -102,9 +106,12 @@ typedef struct _r_bin_image {
 	ut64 header_at;
 	ut64 hdr_offset;
 	ut64 symbols_off;
+	bool symbols_off_resolved;
 	ut64 va;
 	ut32 nlist_start_index;
 	ut32 nlist_count;
+	ut32 id;
+	RVector *sections; // struct section_t, materialized on first use
 } RDyldBinImage;
 
 static R_TH_LOCAL RList *pending_bin_files = NULL;
@@ -137,6 +144,7 @@ static void free_bin(RDyldBinImage *bin) {
 	}
 
 	R_FREE (bin->file);
+	r_vector_free (bin->sections);
 	R_FREE (bin);
 }
 
@@ -403,11 +411,139 @@ static void symbols_from_locsym(RDyldCache *cache, RDyldBinImage *bin, RList *sy
 	free (nlists);
 }
 
+static void index_open(RDyldCache *cache) {
+	const ut8 zero[16] = {0};
+	if (!memcmp (cache->hdr->uuid, zero, sizeof (zero))) {
+		return;
+	}
+	char *uuid = r_hex_bin2strdup (cache->hdr->uuid, sizeof (cache->hdr->uuid));
+	char *dir = r_xdg_cachedir ("dyldcache");
+	if (uuid && dir) {
+		cache->index_path = r_str_newf ("%s" R_SYS_DIR "%s.sdb", dir, uuid);
+		cache->index = sdb_new (NULL, cache->index_path, 0);
+	}
+	free (uuid);
+	free (dir);
+	if (!cache->index) {
+		return;
+	}
+	// the uuid should be enough, but dont trust an index built for another file
+	if (sdb_num_get (cache->index, "version", NULL) != INDEX_VERSION
+			|| sdb_num_get (cache->index, "size", NULL) != r_buf_size (cache->buf)
+			|| sdb_num_get (cache->index, "headers", NULL) != cache->n_hdr) {
+		sdb_reset (cache->index);
+	}
+}
+
+static RList *index_load_bins(RDyldCache *cache) {
+	if (!cache->index) {
+		return NULL;
+	}
+	ut32 i, count = sdb_num_get (cache->index, "images", NULL);
+	if (!count) {
+		return NULL;
+	}
+	RList *bins = r_list_newf ((RListFree)free_bin);
+	if (!bins) {
+		return NULL;
+	}
+	for (i = 0; i < count; i++) {
+		r_strf_var (key, 32, "img.%u", i);
+		const char *row = sdb_const_get (cache->index, key, NULL);
+		RDyldBinImage *bin = R_NEW0 (RDyldBinImage);
+		int n = 0;
+		if (!row || !bin || sscanf (row, "%"PFMT64x",%"PFMT64x",%"PFMT64x",%n",
+				&bin->header_at, &bin->hdr_offset, &bin->va, &n) != 3 || !n) {
+			R_LOG_WARN ("Ignoring corrupted dyldcache index %s", cache->index_path);
+			free (bin);
+			r_list_free (bins);
+			sdb_reset (cache->index);
+			return NULL;
+		}
+		bin->id = i;
+		bin->file = row[n]? strdup (row + n): NULL;
+		r_list_append (bins, bin);
+	}
+	return bins;
+}
+
+static bool index_load_sections(RDyldCache *cache, RDyldBinImage *bin, RVector *sections) {
+	if (!cache->index) {
+		return false;
+	}
+	r_strf_var (key, 32, "secs.%u", bin->id);
+	if (!sdb_const_get (cache->index, key, NULL)) {
+		return false;
+	}
+	ut32 i, count = sdb_num_get (cache->index, key, NULL);
+	for (i = 0; i < count; i++) {
+		r_strf_var (skey, 32, "sec.%u.%u", bin->id, i);
+		const char *row = sdb_const_get (cache->index, skey, NULL);
+		struct section_t section = {0};
+		int n = 0;
+		if (!row || sscanf (row, "%"PFMT64x",%"PFMT64x",%"PFMT64x",%d,%n",
+				&section.addr, &section.size, &section.vsize, &section.perm, &n) != 4 || !n) {
+			r_vector_clear (sections);
+			return false;
+		}
+		r_str_ncpy (section.name, row + n, sizeof (section.name));
+		r_vector_push (sections, &section);
+	}
+	return true;
+}
+
+static void index_save(RDyldCache *cache) {
+	if (!cache->index || !cache->index_dirty || !cache->bins) {
+		return;
+	}
+	char *dir = r_file_dirname (cache->index_path);
+	if (!dir || !r_sys_mkdirp (dir)) {
+		free (dir);
+		return;
+	}
+	free (dir);
+	Sdb *db = cache->index;
+	sdb_num_set (db, "version", INDEX_VERSION, 0);
+	sdb_num_set (db, "size", r_buf_size (cache->buf), 0);
+	sdb_num_set (db, "headers", cache->n_hdr, 0);
+	sdb_num_set (db, "images", r_list_length (cache->bins), 0);
+	RListIter *iter;
+	RDyldBinImage *bin;
+	r_list_foreach (cache->bins, iter, bin) {
+		r_strf_var (key, 32, "img.%u", bin->id);
+		char *row = r_str_newf ("0x%"PFMT64x",0x%"PFMT64x",0x%"PFMT64x",%s",
+			bin->header_at, bin->hdr_offset, bin->va, r_str_get (bin->file));
+		sdb_set (db, key, row, 0);
+		free (row);
+		r_strf_var (skey, 32, "secs.%u", bin->id);
+		if (!bin->sections || sdb_const_get (db, skey, NULL)) {
+			continue;
+		}
+		ut32 i = 0;
+		struct section_t *section;
+		r_vector_foreach (bin->sections, section) {
+			r_strf_var (k, 32, "sec.%u.%u", bin->id, i++);
+			row = r_str_newf ("0x%"PFMT64x",0x%"PFMT64x",0x%"PFMT64x",%d,%s",
+				section->addr, section->size, section->vsize, section->perm, section->name);
+			sdb_set (db, k, row, 0);
+			free (row);
+		}
+		sdb_num_set (db, skey, i, 0);
+	}
+	if (!sdb_sync (db)) {
+		R_LOG_DEBUG ("Cannot write the dyldcache index to %s", cache->index_path);
+	}
+	cache->index_dirty = false;
+}
+
 static void r_dyldcache_free(RDyldCache *cache) {
 	if (!cache) {
 		return;
 	}
 
+	index_save (cache);
+	sdb_free (cache->index);
+	free (cache->index_path);
 	r_list_free (cache->bins);
 	cache->bins = NULL;
 	r_buf_free (cache->buf);
@@ -431,6 +567,62 @@ static void r_dyldcache_free(RDyldCache *cache) {
 	R_FREE (cache);
 }
 
+static ut64 resolve_symbols_off(RDyldCache *cache, ut64 pa) {
+	struct MACH0_(mach_header) mh;
+	if (r_buf_fread_at (cache->buf, pa, (ut8*) &mh, "8i", 1) != sizeof (struct MACH0_(mach_header))) {
+		return 0;
+	}
+	if (mh.magic != MH_MAGIC_64 || mh.sizeofcmds == 0) {
+		return 0;
+	}
+	ut64 cmds_at = pa + sizeof (struct MACH0_(mach_header));
+	ut64 cursor = cmds_at;
+	ut64 end = cursor + mh.sizeofcmds;
+	while (cursor < end) {
+		ut32 cmd = r_buf_read_le32_at (cache->buf, cursor);
+		if (cmd == UT32_MAX) {
+			return 0;
+		}
+		ut32 cmdsize = r_buf_read_le32_at (cache->buf, cursor + sizeof (ut32));
+		if (cmdsize == UT32_MAX || cmdsize < 1) {
+			return 0;
+		}
+		if (cmd == LC_SEGMENT || cmd == LC_SEGMENT_64) {
+			char segname[17];
+			segname[16] = 0;
+			if (r_buf_read_at (cache->buf, cursor + 2 * sizeof (ut32), (ut8 *)segname, 16) != 16) {
+				return 0;
+			}
+			if (!strncmp (segname, "__LINKEDIT", 16)) {
+				ut64 vmaddr = r_buf_read_le64_at (cache->buf, cursor + 2 * sizeof (ut32) + 16);
+				if (vmaddr == UT64_MAX) {
+					return 0;
+				}
+				ut64 original_off = r_buf_read_le64_at (cache->buf, cursor + 2 * sizeof (ut32) + 16 + 16);
+				if (original_off == UT64_MAX) {
+					return 0;
+				}
+
+				ut32 i,j;
+				for (i = 0; i < cache->n_hdr; i++) {
+					cache_hdr_t *hdr = &cache->hdr[i];
+					ut32 maps_index = cache->maps_index[i];
+					for (j = 0; j < hdr->mappingCount; j++) {
+						ut64 map_start = cache->maps[maps_index + j].address;
+						ut64 map_end = map_start + cache->maps[maps_index + j].size;
+						if (vmaddr >= map_start && vmaddr < map_end) {
+							ut64 map_off = vmaddr - map_start + cache->maps[maps_index + j].fileOffset;
+							return map_off - original_off;
+						}
+					}
+				}
+			}
+		}
+		cursor += cmdsize;
+	}
+	return 0;
+}
+
 static ut64 bin_obj_va2pa(ut64 p, ut32 *offset, ut32 *left, RBinFile *bf) {
 	if (!bf || !bf->o || !bf->o->bin_obj) {
 		return 0;
@@ -467,6 +659,10 @@ static struct MACH0_(obj_t) *bin_to_mach0(RBinFile *bf, RDyldBinImage *bin) {
 	struct MACH0_(opts_t) opts;
 	MACH0_(opts_set_default) (&opts, bf);
 	opts.header_at = bin->header_at - bin->hdr_offset;
+	if (!bin->symbols_off_resolved) {
+		bin->symbols_off = resolve_symbols_off (cache, bin->header_at);
+		bin->symbols_off_resolved = true;
+	}
 	if (bin->symbols_off) {
 		opts.symbols_off = bin->symbols_off - bin->hdr_offset;
 	}
@@ -481,6 +677,37 @@ static struct MACH0_(obj_t) *bin_to_mach0(RBinFile *bf, RDyldBinImage *bin) {
 	return mach0;
 }
 
+static RVector *image_sections(RBinFile *bf, RDyldCache *cache, RDyldBinImage *bin) {
+	if (bin->sections) {
+		return bin->sections;
+	}
+	RVector *sections = r_vector_new (sizeof (struct section_t), NULL, NULL);
+	if (!sections) {
+		return NULL;
+	}
+	if (!index_load_sections (cache, bin, sections)) {
+		struct MACH0_(obj_t) *mach0 = bin_to_mach0 (bf, bin);
+		if (!mach0) {
+			r_vector_free (sections);
+			return NULL;
+		}
+		const RVector *msections = MACH0_(load_sections) (mach0);
+		if (!msections) {
+			MACH0_(mach0_free) (mach0);
+			r_vector_free (sections);
+			return NULL;
+		}
+		struct section_t *section;
+		r_vector_foreach (msections, section) {
+			r_vector_push (sections, section);
+		}
+		MACH0_(mach0_free) (mach0);
+		cache->index_dirty = true;
+	}
+	bin->sections = sections;
+	return sections;
+}
+
 static int prot2perm(int x) {
 	int r = 0;
 	if (x & 1) {
@@ -1089,62 +1316,6 @@ beach:
 	free (cmds);
 }
 
-static ut64 resolve_symbols_off(RDyldCache *cache, ut64 pa) {
-	struct MACH0_(mach_header) mh;
-	if (r_buf_fread_at (cache->buf, pa, (ut8*) &mh, "8i", 1) != sizeof (struct MACH0_(mach_header))) {
-		return 0;
-	}
-	if (mh.magic != MH_MAGIC_64 || mh.sizeofcmds == 0) {
-		return 0;
-	}
-	ut64 cmds_at = pa + sizeof (struct MACH0_(mach_header));
-	ut64 cursor = cmds_at;
-	ut64 end = cursor + mh.sizeofcmds;
-	while (cursor < end) {
-		ut32 cmd = r_buf_read_le32_at (cache->buf, cursor);
-		if (cmd == UT32_MAX) {
-			return 0;
-		}
-		ut32 cmdsize = r_buf_read_le32_at (cache->buf, cursor + sizeof (ut32));
-		if (cmdsize == UT32_MAX || cmdsize < 1) {
-			return 0;
-		}
-		if (cmd == LC_SEGMENT || cmd == LC_SEGMENT_64) {
-			char segname[17];
-			segname[16] = 0;
-			if (r_buf_read_at (cache->buf, cursor + 2 * sizeof (ut32), (ut8 *)segname, 16) != 16) {
-				return 0;
-			}
-			if (!strncmp (segname, "__LINKEDIT", 16)) {
-				ut64 vmaddr = r_buf_read_le64_at (cache->buf, cursor + 2 * sizeof (ut32) + 16);
-				if (vmaddr == UT64_MAX) {
-					return 0;
-				}
-				ut64 original_off = r_buf_read_le64_at (cache->buf, cursor + 2 * sizeof (ut32) + 16 + 16);
-				if (original_off == UT64_MAX) {
-					return 0;
-				}
-
-				ut32 i,j;
-				for (i = 0; i < cache->n_hdr; i++) {
-					cache_hdr_t *hdr = &cache->hdr[i];
-					ut32 maps_index = cache->maps_index[i];
-					for (j = 0; j < hdr->mappingCount; j++) {
-						ut64 map_start = cache->maps[maps_index + j].address;
-						ut64 map_end = map_start + cache->maps[maps_index + j].size;
-						if (vmaddr >= map_start && vmaddr < map_end) {
-							ut64 map_off = vmaddr - map_start + cache->maps[maps_index + j].fileOffset;
-							return map_off - original_off;
-						}
-					}
-				}
-			}
-		}
-		cursor += cmdsize;
-	}
-	return 0;
-}
-
 static RList *create_cache_bins(RBinFile *bf, RDyldCache *cache) {
 	RList *bins = r_list_newf ((RListFree)free_bin);
 	ut16 *depArray = NULL;
@@ -1172,6 +1343,12 @@ static RList *create_cache_bins(RBinFile *bf, RDyldCache *cache) {
 	} else {
 		eprintf ("bin.dyldcache: Use R_DYLDCACHE_FILTER to specify a colon ':' separated\n");
 		eprintf ("bin.dyldcache: list of names to avoid loading all the files in memory.\n");
+		RList *indexed = index_load_bins (cache);
+		if (indexed) {
+			r_list_free (bins);
+			return indexed;
+		}
+		cache->index_dirty = true;
 	}
 
 	ut32 i;
@@ -1276,8 +1453,8 @@ static RList *create_cache_bins(RBinFile *bf, RDyldCache *cache) {
 				}
 				bin->header_at = pa;
 				bin->hdr_offset = hdr_offset;
-				bin->symbols_off = resolve_symbols_off (cache, pa);
 				bin->va = img[j].address;
+				bin->id = r_list_length (bins);
 				if (r_buf_read_at (cache->buf, img[j].pathFileOffset, (ut8*) &file, sizeof (file)) == sizeof (file)) {
 					file[255] = 0;
 					char *last_slash = strrchr (file, '/');
@@ -1937,6 +2114,14 @@ static bool load_buffer(RBinFile *bf, void **bin_obj, RBuffer *buf, ut64 loadadd
 		return false;
 	}
 	cache->accel = read_cache_accel (cache->buf, cache->hdr, cache->maps, cache->n_maps);
+	if (bf->rbin && bf->rbin->dyldindex) {
+		char *filter = r_sys_getenv ("R_DYLDCACHE_FILTER");
+		// the index covers all the images, filtered loads are not worth caching
+		if (!filter) {
+			index_open (cache);
+		}
+		free (filter);
+	}
 	cache->bins = create_cache_bins (bf, cache);
 	if (!cache->bins) {
 		r_dyldcache_free (cache);
@@ -2084,12 +2269,7 @@ static void sections_from_bin(RList *ret, RBinFile *bf, RDyldBinImage *bin) {
 		return;
 	}
 
-	struct MACH0_(obj_t) *mach0 = bin_to_mach0 (bf, bin);
-	if (!mach0) {
-		return;
-	}
-
-	const RVector *sections = MACH0_(load_sections) (mach0);
+	RVector *sections = image_sections (bf, cache, bin);
 	if (!sections) {
 		return;
 	}
@@ -2121,7 +2301,6 @@ static void sections_from_bin(RList *ret, RBinFile *bf, RDyldBinImage *bin) {
 		ptr->perm = section->perm;
 		r_list_append (ret, ptr);
 	}
-	MACH0_(mach0_free) (mach0);
 }
 
 static RList *sections(RBinFile *bf) {
@@ -2234,6 +2413,16 @@ static void destroy(RBinFile *bf) {
 	r_dyldcache_free (cache);
 }
 
+static bool has_objc_lists(RVector *sections) {
+	struct section_t *section;
+	r_vector_foreach (sections, section) {
+		if (section->size && (strstr (section->name, "__objc_classlist") || strstr (section->name, "__objc_catlist"))) {
+			return true;
+		}
+	}
+	return false;
+}
+
 static RList *classes(RBinFile *bf) {
 	RDyldCache *cache = (RDyldCache*) bf->o->bin_obj;
 	if (!cache) {
@@ -2264,14 +2453,15 @@ static RList *classes(RBinFile *bf) {
 			eprintf ("Parsing classes stopped %d / %d\n", i, r_list_length (cache->bins));
 			break;
 		}
-		struct MACH0_(obj_t) *mach0 = bin_to_mach0 (bf, bin);
-		if (!mach0) {
+		RVector *sections = image_sections (bf, cache, bin);
+		if (!sections) {
 			goto beach;
 		}
-
-		const RVector *sections = MACH0_(load_sections) (mach0);
-		if (!sections) {
-			MACH0_(mach0_free) (mach0);
+		if (!has_objc_lists (sections)) {
+			continue;
+		}
+		struct MACH0_(obj_t) *mach0 = bin_to_mach0 (bf, bin);
+		if (!mach0) {
 			goto beach;
 		}
 
@@ -1,4 +1,4 @@
-/* radare - LGPL - Copyright 2009-2022 - pancake, nibble, Adam Pridgen <dso@rice.edu || adam.pridgen@thecoverofnight.com> */
+/* radare - LGPL - Copyright 2009-2023 - pancake, nibble, Adam Pridgen <dso@rice.edu || adam.pridgen@thecoverofnight.com> */
 
 #define R_LOG_ORIGIN "bin.java"
 
@@ -118,6 +118,14 @@ static RBinInfo *info(RBinFile *bf) {
 	if (!ret) {
 		return NULL;
 	}
+	if (jo && !jo->lang) {
+		// the language version is detected while walking the symbols, which are now loaded on demand
+		RList *symbols = r_bin_java_get_symbols (jo);
+		if (symbols) {
+			symbols->free = r_bin_symbol_free;
+			r_list_free (symbols);
+		}
+	}
 	ret->lang = (jo && jo->lang) ? jo->lang : "java";
 	ret->file = strdup (bf->file);
 	ret->type = strdup ("JAVA CLASS");
@@ -1,4 +1,4 @@
-/* radare2 - MIT - Copyright 2021-2022 - pancake, keegan, Plan 9 Foundation */
+/* radare2 - MIT - Copyright 2021-2023 - pancake, keegan, Plan 9 Foundation */
 
 #include <r_types.h>
 #include <r_util.h>
@@ -371,9 +371,9 @@ static int apply_history(RBinFile *bf, ut64 pc, ut64 line, Sym *base, Sym **ret)
 		line = line - delta + 1;
 	}
 
-	char *line_info = r_str_newf ("%s|%"PFMT64d, name, line);
-	sdb_nset (bf->sdb_addrinfo, pc, line_info, 0);
-	free (line_info);
+	if (bf->addrline) {
+		r_bin_addrline_set (bf->addrline, pc, name, (ut32)line, 0);
+	}
 	return 0;
 }
 
@@ -400,10 +400,6 @@ static RList *symbols(RBinFile *bf) {
 
 	const ut64 syms = o->header_size + o->header.text + o->header.data;
 
-	if (!bf->sdb_addrinfo && o->header.syms && o->header.pcsz) {
-		bf->sdb_addrinfo = sdb_new0 ();
-	}
-
 	ut64 offset = 0;
 	while (offset < o->header.syms) {
 		const st64 size = sym_read (bf, &sym, offset);
@@ -89,7 +89,7 @@ static int cmpaddr(const void *_a, const void *_b) {
 
 static char *get_function_name(RCore *core, ut64 addr) {
 	RBinFile *bf = r_bin_cur (core->bin);
-	if (bf && bf->o) {
+	if (bf && bf->o && r_bin_object_load_item (bf, bf->o, R_BIN_ITEM_CLASSES)) {
 		RBinSymbol *sym = ht_up_find (bf->o->addr2klassmethod, addr, NULL);
 		if (sym && sym->classname && sym->name) {
 			return r_str_newf ("method.%s.%s", sym->classname, sym->name);
@@ -2340,7 +2340,8 @@ R_API RGraph *r_core_anal_importxrefs(RCore *core) {
 	if (!graph) {
 		return NULL;
 	}
-	r_list_foreach (obj->imports, iter, imp) {
+	const RList *imports = r_bin_get_imports (core->bin);
+	r_list_foreach (imports, iter, imp) {
 		ut64 addr = lit ? r_core_bin_impaddr (core->bin, va, imp->name): 0;
 		if (addr) {
 			add_single_addr_xrefs (core, addr, graph);
@@ -4433,6 +4434,30 @@ static bool isSkippable(RBinSymbol *s) {
 	return false;
 }
 
+typedef struct {
+	ut64 addr;
+	const char *name;
+} AnalEntry;
+
+// functions whose code is decoded ahead at once, see anal.prefetch.threads
+#define ANAL_PREFETCH_BATCH 64
+
+static void anal_prefetch(RCore *core, RVector *entries, int from, int threads, bool calls) {
+	const int to = R_MIN (from + ANAL_PREFETCH_BATCH, entries->len);
+	ut64 *addrs = R_NEWS (ut64, to - from);
+	if (!addrs) {
+		return;
+	}
+	int i;
+	for (i = from; i < to; i++) {
+		AnalEntry *e = r_vector_at (entries, i);
+		addrs[i - from] = e->addr;
+	}
+	r_anal_prefetch_clear (core->anal);
+	r_anal_prefetch (core->anal, addrs, to - from, threads, calls);
+	free (addrs);
+}
+
 R_API int r_core_anal_all(RCore *core) {
 	const RList *list;
 	RListIter *iter;
@@ -4442,59 +4467,73 @@ R_API int r_core_anal_all(RCore *core) {
 	RBinSymbol *symbol;
 	const bool anal_vars = r_config_get_i (core->config, "anal.vars");
 	const bool anal_calls = r_config_get_i (core->config, "anal.calls");
+	const int threads = r_config_get_i (core->config, "anal.prefetch.threads");
+	RVector entries;
+	r_vector_init (&entries, sizeof (AnalEntry), NULL, NULL);
 
 	/* Analyze Functions */
 	/* Entries */
 	RFlagItem *item = r_flag_get (core->flags, "entry0");
-	if (item) {
-		r_core_af (core, item->offset, "entry0", anal_calls);
-	} else {
-		r_core_af (core, core->offset, NULL, anal_calls);
-	}
-
-	r_core_task_yield (&core->tasks);
-
-	r_cons_break_push (NULL, NULL);
+	AnalEntry e = { item? item->offset: core->offset, item? "entry0": NULL };
+	r_vector_push (&entries, &e);
 	/* Symbols (Imports are already analyzed by rabin2 on init) */
 	if ((list = r_bin_get_symbols (core->bin))) {
 		r_list_foreach (list, iter, symbol) {
-			if (r_cons_is_breaked ()) {
-				break;
-			}
 			// Stop analyzing PE imports further
 			if (isSkippable (symbol)) {
 				continue;
 			}
 			if (isValidSymbol (symbol)) {
-				ut64 addr = r_bin_get_vaddr (core->bin, symbol->paddr, symbol->vaddr);
-				// TODO: uncomment to: fcn.name = symbol.name, problematic for imports
-				// r_core_af (core, addr, symbol->name, anal_calls);
-				r_core_af (core, addr, NULL, anal_calls);
+				// TODO: use symbol->name as name, problematic for imports
+				e.addr = r_bin_get_vaddr (core->bin, symbol->paddr, symbol->vaddr);
+				e.name = NULL;
+				r_vector_push (&entries, &e);
 			}
 		}
 	}
-	r_core_task_yield (&core->tasks);
 	/* Main */
 	if ((binmain = r_bin_get_sym (core->bin, R_BIN_SYM_MAIN))) {
 		if (binmain->paddr != UT64_MAX) {
-			ut64 addr = r_bin_get_vaddr (core->bin, binmain->paddr, binmain->vaddr);
-			r_core_af (core, addr, "main", anal_calls);
+			e.addr = r_bin_get_vaddr (core->bin, binmain->paddr, binmain->vaddr);
+			e.name = "main";
+			r_vector_push (&entries, &e);
 		}
 	}
-	r_core_task_yield (&core->tasks);
 	if ((list = r_bin_get_entries (core->bin))) {
 		r_list_foreach (list, iter, entry) {
-			if (r_cons_is_breaked ()) {
-				break;
-			}
 			if (entry->paddr == UT64_MAX) {
 				continue;
 			}
-			ut64 addr = r_bin_get_vaddr (core->bin, entry->paddr, entry->vaddr);
-			r_core_af (core, addr, NULL, anal_calls);
+			e.addr = r_bin_get_vaddr (core->bin, entry->paddr, entry->vaddr);
+			e.name = NULL;
+			r_vector_push (&entries, &e);
+		}
+	}
+	// the code is decoded ahead in parallel, but the functions are still
+	// analyzed one after the other in the same order to get the same results
+	RThreadPool *pool = core->anal->pool;
+	const bool parallel = threads != 1 && pool && pool->size > 1;
+	const bool prefetch = parallel && r_anal_prefetch_supported (core->anal);
+	if (threads > 1 && parallel && !prefetch) {
+		R_LOG_WARN ("anal.prefetch.threads is ignored, the arch plugin is not threadsafe");
+	}
+	r_cons_break_push (NULL, NULL);
+	int i;
+	for (i = 0; i < entries.len; i++) {
+		if (r_cons_is_breaked ()) {
+			break;
+		}
+		if (prefetch && !(i % ANAL_PREFETCH_BATCH)) {
+			anal_prefetch (core, &entries, i, threads, anal_calls);
+		}
+		AnalEntry *ae = r_vector_at (&entries, i);
+		r_core_af (core, ae->addr, ae->name, anal_calls);
+		if (!(i % ANAL_PREFETCH_BATCH)) {
+			r_core_task_yield (&core->tasks);
 		}
 	}
-	r_core_task_yield (&core->tasks);
+	r_anal_prefetch_clear (core->anal);
+	r_vector_fini (&entries);
 	if (anal_vars) {
 		/* Set fcn type to R_ANAL_FCN_TYPE_SYM for symbols */
 		r_list_foreach_prev (core->anal->fcns, iter, fcni) {
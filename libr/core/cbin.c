@@ -10,6 +10,7 @@
 #define VA_NOREBASE 2
 
 #define LOAD_BSS_MALLOC 0
+#define DWARF_LRU_SIZE 16
 
 #define IS_MODE_SET(mode) ((mode) & R_MODE_SET)
 #define IS_MODE_SIMPLE(mode) ((mode) & R_MODE_SIMPLE)
@@ -816,6 +817,9 @@ static int bin_info(RCore *r, PJ *pj, int mode, ut64 laddr) {
 		}
 		return false;
 	}
+	// info->lang is only known once the language is detected
+	r_bin_object_load_item (bf, obj, R_BIN_ITEM_LANG);
+	r_bin_object_load_item (bf, obj, R_BIN_ITEM_ENTRIES);
 	bool havecode = is_executable (obj) | (!!obj->entries);
 	const char *compiled = get_compile_time (bf->sdb);
 
@@ -1090,6 +1094,43 @@ static void file_lines_free_kv(HtPPKv *kv) {
 	file_lines_free (kv->value);
 }
 
+/**
+ * @brief Applies the types and functions of the dwarf unit covering addr
+ *
+ * Does nothing unless the units were indexed with bin.dbginfo.lazy, each
+ * unit is only applied once. Called from analysis commands ("aaD", "aaa")
+ * only, seeking and printing never decode the units.
+ *
+ * @return bool true if addr is covered by a unit that has been applied
+ */
+R_API bool r_core_bin_dwarf_load_at(RCore *core, ut64 addr) {
+	r_return_val_if_fail (core, false);
+	RBinFile *bf = r_bin_cur (core->bin);
+	RBinDwarfCuIndex *ci = bf? bf->dwarf_index: NULL;
+	if (!ci) {
+		return false;
+	}
+	int unit = r_bin_dwarf_cu_index_find (ci, addr);
+	if (unit < 0) {
+		return false;
+	}
+	RBinDwarfCuEntry *e = r_vector_index_ptr (&ci->units, unit);
+	if (e->done) {
+		return true;
+	}
+	e->done = true;
+	const RBinDwarfDebugInfo *info = r_bin_dwarf_cu_index_get (ci, unit);
+	if (!info) {
+		return false;
+	}
+	RAnalDwarfContext ctx = {
+		.info = info,
+		.loc = r_bin_dwarf_cu_index_loc (ci)
+	};
+	r_anal_dwarf_process_info (core->anal, &ctx);
+	return true;
+}
+
 static bool bin_dwarf(RCore *core, PJ *pj, int mode) {
 	RBinDwarfRow *row;
 	RListIter *iter;
@@ -1115,6 +1156,11 @@ static bool bin_dwarf(RCore *core, PJ *pj, int mode) {
 	if (plugin && plugin->lines) {
 		// list is not cloned to improve speed. avoid use after free
 		list = plugin->lines (binfile);
+	} else if (core->bin && mode == R_MODE_SET && r_config_get_b (core->config, "bin.dbginfo.lazy")) {
+		// units are decoded by the analysis commands, see r_core_bin_dwarf_load_at
+		r_bin_dwarf_cu_index_free (binfile->dwarf_index);
+		binfile->dwarf_index = r_bin_dwarf_cu_index_new (core->bin, core->anal->config->bits / 8, DWARF_LRU_SIZE);
+		list = ownlist = r_bin_dwarf_parse_line (core->bin, mode);
 	} else if (core->bin) {
 		// TODO: complete and speed-up support for dwarf
 		RBinDwarfDebugAbbrev *da = r_bin_dwarf_parse_abbrev (core->bin, mode);
@@ -1268,6 +1314,7 @@ R_API bool r_core_pdb_info(RCore *core, const char *file, PJ *pj, int mode) {
 	RPdb pdb = {0};
 
 	pdb.cb_printf = r_cons_printf;
+	pdb.pool = r_core_thread_pool (core);
 	if (!init_pdb_parser (&pdb, file)) {
 		if (pj || mode == 'j') {
 			pj_o (pj);
@@ -1320,45 +1367,23 @@ R_API bool r_core_pdb_info(RCore *core, const char *file, PJ *pj, int mode) {
 	return true;
 }
 
-static ut64 srclineVal(const void *a) {
-	return r_str_hash64 (a);
-}
-
 static int bin_source(RCore *r, PJ *pj, int mode) {
-	RList *final_list = r_list_new ();
 	RBinFile * binfile = r->bin->cur;
-
-	if (!binfile) {
+	if (!binfile || !binfile->addrline) {
 		if (IS_MODE_JSON (mode)) {
 			pj_o (pj);
 			pj_end (pj);
 		}
-		r_list_free (final_list);
 		return false;
 	}
-
-	SdbListIter *iter;
-	RListIter *iter2;
-	char* srcline;
-	SdbKv *kv;
-	SdbList *ls = sdb_foreach_list (binfile->sdb_addrinfo, false);
-	ls_foreach (ls, iter, kv) {
-		char *v = sdbkv_value (kv);
-		RList *list = r_str_split_list (v, "|", 0);
-		srcline = r_list_first (list);
-		if (srcline) {
-			if (!strstr (srcline, "0x")) {
-				r_list_append (final_list, srcline);
-			}
-		}
-		r_list_free (list);
-	}
+	RList *files = r_bin_addrline_files (binfile->addrline);
+	RListIter *iter;
+	char *srcline;
 	r_cons_printf ("[Source file]\n");
-	r_list_uniq_inplace (final_list, srclineVal);
-	r_list_foreach (final_list, iter2, srcline) {
+	r_list_foreach (files, iter, srcline) {
 		r_cons_printf ("%s\n", srcline);
 	}
-	r_list_free (final_list);
+	r_list_free (files);
 	return true;
 }
 
@@ -1859,7 +1884,11 @@ static int bin_relocs(RCore *r, PJ *pj, int mode, int va) {
 			}
 			r->bin->iob.overlay_write_at = r_io_cache_write_at;
 		}
+		// the relocated slots are usually contiguous, keep one cache item per page
+		const bool coalesce = r->io->cache.coalesce;
+		r->io->cache.coalesce = true;
 		relocs = r_bin_patch_relocs (r->bin->cur); // XXX other way to get RBinFile?
+		r->io->cache.coalesce = coalesce;
 		if (bc) {
 			r->bin->iob.overlay_write_at = r_io_vwrite_to_overlay_at;
 		} else {
@@ -2457,6 +2486,10 @@ static int bin_symbols(RCore *r, PJ *pj, int mode, ut64 laddr, int va, ut64 at,
 	const char *lang = bin_demangle ? r_config_get (r->config, "bin.lang") : NULL;
 
 	RList *symbols = r_bin_get_symbols (r->bin);
+	if (lang && r->bin->cur && symbols) {
+		// fill the demangle cache up front, snInit picks the names from there
+		r_bin_demangle_batch (r->bin->cur, lang, symbols);
+	}
 	r_spaces_push (&r->anal->meta_spaces, "bin");
 
 	if (IS_MODE_SET (mode)) {
@@ -3697,6 +3730,7 @@ static int bin_classes(RCore *r, PJ *pj, int mode) {
 			if (c) {
 				RBinFile *bf = r_bin_cur (r->bin);
 				if (bf && bf->o) {
+					r_bin_object_load_item (bf, bf->o, R_BIN_ITEM_LANG);
 					if (IS_MODE_RAD (mode)) {
 						classdump_c (r, c);
 					} else if (bf->o->lang == R_BIN_LANG_JAVA || (bf->o->info && bf->o->info->lang && strstr (bf->o->info->lang, "dalvik"))) {
@@ -343,6 +343,16 @@ static bool cb_analsleep(void *user, void *data) {
 	return true;
 }
 
+static bool cb_analopcache(void *user, void *data) {
+	RCore *core = (RCore*) user;
+	RConfigNode *node = (RConfigNode*) data;
+	if (node->i_value > 0x1000000) {
+		R_LOG_ERROR ("anal.opcache is too big");
+		return false;
+	}
+	return r_anal_opcache_setup (core->anal, (int)node->i_value);
+}
+
 static bool cb_analmaxrefs(void *user, void *data) {
 	RCore *core = (RCore*) user;
 	RConfigNode *node = (RConfigNode*) data;
@@ -716,6 +726,7 @@ static bool cb_asmcpu(void *user, void *data) {
 	}
 	r_asm_set_cpu (core->rasm, node->value);
 	r_arch_config_set_cpu (core->rasm->config, node->value);
+	r_anal_opcache_flush (core->anal);
 	int v = r_anal_archinfo (core->anal, R_ANAL_ARCHINFO_ALIGN);
  	if (v != -1) {
  		core->anal->config->pcalign = v;
@@ -783,6 +794,7 @@ static bool cb_asmarch(void *user, void *data) {
 		R_LOG_ERROR ("asm.arch: cannot find '%s'", node->value);
 		return false;
 	}
+	r_anal_opcache_flush (core->anal);
 	//we should strdup here otherwise will crash if any r_config_set
 	//free the old value
 	char *asm_cpu = strdup (r_config_get (core->config, "asm.cpu"));
@@ -938,6 +950,7 @@ static bool cb_asmbits(void *user, void *data) {
 			R_LOG_ERROR ("asm.arch: Cannot setup '%d' bits analysis engine", bits);
 			ret = false;
 		}
+		r_anal_opcache_flush (core->anal);
 	}
 	r_debug_set_arch (core->dbg, core->anal->config->arch, bits);
 	const bool load_from_debug = r_config_get_b (core->config, "cfg.debug");
@@ -1522,6 +1535,23 @@ static bool cb_cfgsanbox(void *user, void *data) {
 	return (!node->i_value && ret)? 0: 1;
 }
 
+static bool cb_cfgthreads(void *user, void *data) {
+	RCore *core = (RCore*) user;
+	RConfigNode *node = (RConfigNode*) data;
+	if (node->i_value > 1024) {
+		R_LOG_ERROR ("Too many threads");
+		return false;
+	}
+	// the workers of the old pool finish their tasks before the new one is shared
+	core->bin->pool = NULL;
+	core->anal->pool = NULL;
+	core->search->pool = NULL;
+	r_th_pool_free (core->pool);
+	core->pool = NULL;
+	r_core_thread_pool (core);
+	return true;
+}
+
 static bool cb_str_escbslash(void *user, void *data) {
 	RCore *core = (RCore*) user;
 	RConfigNode *node = (RConfigNode*) data;
@@ -2275,6 +2305,20 @@ static bool cb_io_cache_nodup(void *user, void *data) {
 	return true;
 }
 
+static bool cb_io_cache_coalesce(void *user, void *data) {
+	RCore *core = (RCore *)user;
+	RConfigNode *node = (RConfigNode *)data;
+	core->io->cache.coalesce = node->i_value;
+	return true;
+}
+
+static bool cb_io_cache_limit(void *user, void *data) {
+	RCore *core = (RCore *)user;
+	RConfigNode *node = (RConfigNode *)data;
+	core->io->cache.limit = node->i_value;
+	return true;
+}
+
 static bool cb_io_cache_read(void *user, void *data) {
 	RCore *core = (RCore *)user;
 	RConfigNode *node = (RConfigNode *)data;
@@ -2917,6 +2961,42 @@ static bool cb_binmaxstrbuf(void *user, void *data) {
 	return true;
 }
 
+static bool cb_binstrthreads(void *user, void *data) {
+	RCore *core = (RCore *) user;
+	RConfigNode *node = (RConfigNode *) data;
+	if (core->bin) {
+		core->bin->strthreads = node->i_value;
+	}
+	return true;
+}
+
+static bool cb_bindemanglethreads(void *user, void *data) {
+	RCore *core = (RCore *) user;
+	RConfigNode *node = (RConfigNode *) data;
+	if (core->bin) {
+		core->bin->demanglethreads = node->i_value;
+	}
+	return true;
+}
+
+static bool cb_binitemcache(void *user, void *data) {
+	RCore *core = (RCore *) user;
+	RConfigNode *node = (RConfigNode *) data;
+	if (core->bin) {
+		core->bin->itemcache = node->i_value;
+	}
+	return true;
+}
+
+static bool cb_bindyldindex(void *user, void *data) {
+	RCore *core = (RCore *) user;
+	RConfigNode *node = (RConfigNode *) data;
+	if (core->bin) {
+		core->bin->dyldindex = node->i_value;
+	}
+	return true;
+}
+
 static bool cb_binmaxsymlen(void *user, void *data) {
 	RCore *core = (RCore *) user;
 	RConfigNode *node = (RConfigNode *) data;
@@ -3452,6 +3532,8 @@ R_API int r_core_config_init(RCore *core) {
 		"anal.fcn", "anal.bb",
 	NULL);
 	SETI ("anal.timeout", 0, "stop analyzing after a couple of seconds");
+	SETI ("anal.prefetch.threads", 0, "number of cfg.threads workers that decode ahead the code reachable from the entrypoints in aa, only for threadsafe arch plugins like riscv (0: all, 1: no prefetch)");
+	SETICB ("anal.opcache", 0, &cb_analopcache, "keep the last N decoded instructions to avoid decoding them again (see aoh)");
 	SETCB ("anal.jmp.retpoline", "true", &cb_anal_jmpretpoline, "analyze retpolines, may be slower if not needed");
 	SETCB ("anal.jmp.tailcall", "true", &cb_anal_jmptailcall, "consume a branch as a call if delta is a function");
 	SETICB ("anal.jmp.tailcall.delta", 0, &cb_anal_jmptailcall_delta, "consume a branch as a call if delta is big");
@@ -3764,15 +3846,20 @@ R_API int r_core_config_init(RCore *core) {
 	SETBPREF ("bin.demangle", "true", "import demangled symbols from RBin");
 	SETCB("bin.demangle.trylib", "true", &cb_demangle_trylib, "try to use system available libraries to demangle");
 	SETBPREF ("bin.demangle.libs", "false", "show library name on demangled symbols names");
+	SETICB ("bin.demangle.threads", 0, &cb_bindemanglethreads, "number of cfg.threads workers used to demangle the symbols of big binaries (0: all, 1: no threads)");
+	SETCB ("bin.dyldcache.index", "false", &cb_bindyldindex, "index the images and sections of the dyld shared caches by uuid in ~/.cache/radare2/dyldcache");
+	SETCB ("bin.itemcache", "false", &cb_binitemcache, "cache the parsed symbols, imports, entries and sections by file hash in ~/.cache/radare2/bin");
 	SETI ("bin.baddr", -1, "base address of the binary");
 	SETI ("bin.laddr", 0, "base address for loading library ('*.so')");
 	SETCB ("bin.dbginfo", "true", &cb_bindbginfo, "load debug information at startup if available");
+	SETBPREF ("bin.dbginfo.lazy", "false", "index dwarf units at startup and decode them on analysis (aaD, aaa)");
 	SETBPREF ("bin.relocs", "true", "load relocs information at startup if available");
 	SETBPREF ("bin.relocs.apply", "false", "apply reloc information");
 	SETICB ("bin.str.min", 0, &cb_binminstr, "minimum string length for r_bin");
 	SETICB ("bin.maxsymlen", 0, &cb_binmaxsymlen, "maximum length for symbol names");
 	SETICB ("bin.str.max", 0, &cb_binmaxstr, "maximum string length for r_bin");
 	SETICB ("bin.str.maxbuf", 1024*1024*10, & cb_binmaxstrbuf, "maximum size of range to load strings from");
+	SETICB ("bin.str.threads", 0, &cb_binstrthreads, "number of cfg.threads workers used to scan big ranges for strings (0: all, 1: no threads)");
 	n = NODECB ("bin.str.enc", "guess", &cb_binstrenc);
 	SETDESC (n, "default string encoding of binary");
 	SETOPTIONS (n, "ascii", "latin1", "utf8", "utf16le", "utf32le", "utf16be", "utf32be", "guess", NULL);
@@ -3786,6 +3873,7 @@ R_API int r_core_config_init(RCore *core) {
 	/* prj */
 	SETCB ("prj.name", "", &cb_prjname, "name of current project");
 	SETBPREF ("prj.files", "false", "save the target binary inside the project directory");
+	SETBPREF ("prj.db", "false", "save the analysis in a binary snapshot (anal.r2db) instead of the project script");
 	SETBPREF ("prj.vc", "true", "use your version control system of choice (rvc, git) to manage projects");
 	SETBPREF ("prj.zip", "false", "use ZIP format for project files");
 	SETBPREF ("prj.gpg", "false", "TODO: encrypt project with GnuPGv2");
@@ -3836,6 +3924,7 @@ R_API int r_core_config_init(RCore *core) {
 	SETBPREF ("cfg.wseek", "false", "Seek after write");
 	SETCB ("cfg.bigendian", "false", &cb_bigendian, "use little (false) or big (true) endianness");
 	SETI ("cfg.cpuaffinity", 0, "run on cpuid");
+	SETICB ("cfg.threads", 0, &cb_cfgthreads, "size of the thread pool shared by the parallel tasks, see *.threads (0: one per cpu)");
 
 	/* log */
 	SETICB ("log.level", R_LOGLVL_DEFAULT, cb_log_config_level, "Target log level/severity (0:FATAL 1:ERROR 2:INFO 3:WARN 4:TODO 5:DEBUG)");
@@ -3853,6 +3942,7 @@ R_API int r_core_config_init(RCore *core) {
 	SETI ("zign.maxsz", 500, "maximum zignature length");
 	SETI ("zign.minsz", 16, "minimum zignature length for matching");
 	SETI ("zign.mincc", 10, "minimum cyclomatic complexity for matching");
+	SETI ("zign.threads", 0, "number of cfg.threads workers used to hash and compare the functions in zg, z/ and zf (0: all, 1: no threads)");
 	SETBPREF ("zign.graph", "true", "use graph metrics for matching");
 	SETBPREF ("zign.bytes", "true", "use bytes patterns for matching");
 	SETBPREF ("zign.offset", "false", "use original offset for matching");
@@ -4303,6 +4393,7 @@ R_API int r_core_config_init(RCore *core) {
 	SETBPREF ("search.flags", "true", "all search results are flagged, otherwise only printed");
 	SETBPREF ("search.overlap", "false", "look for overlapped search hits");
 	SETI ("search.maxhits", 0, "maximum number of hits (0: no limit)");
+	SETI ("search.threads", 0, "number of cfg.threads workers used to scan for keywords (0: all, 1: no threads)");
 	SETI ("search.from", -1, "search start address");
 	n = NODECB ("search.in", "io.maps", &cb_searchin);
 	SETDESC (n, "specify search boundaries");
@@ -4330,6 +4421,8 @@ R_API int r_core_config_init(RCore *core) {
 	SETCB ("io.cache", "false", &cb_io_cache, "change both of io.cache.{read,write}");
 	SETCB ("io.cache.read", "true", &cb_io_cache_read, "enable read cache for vaddr (or paddr when io.va=0)");
 	SETCB ("io.cache.write", "true", &cb_io_cache_write, "enable write cache for vaddr (or paddr when io.va=0)");
+	SETCB ("io.cache.coalesce", "false", &cb_io_cache_coalesce, "merge the cached writes that land in the same page");
+	SETICB ("io.cache.limit", 0, &cb_io_cache_limit, "spill the io.cache to a temporary file when it holds more bytes (0 means no limit)");
 	SETCB ("io.cache.nodup", "false", &cb_io_cache_nodup, "do not cache duplicated cache writes");
 	SETCB ("io.cache.auto", "false", &cb_io_cache_mode, "automatic cache all reads in the IO backend"); // renamed to slurp?
 	/* pcache */
@@ -398,6 +398,10 @@ R_API void r_core_seek_arch_bits(RCore *core, ut64 addr) {
 
 R_API bool r_core_seek(RCore *core, ut64 addr, bool rb) {
 	core->offset = r_io_seek (core->io, addr, R_IO_SEEK_SET);
+	if (core->prj && core->prj->db) {
+		// bring the analysis of this range from the project snapshot
+		r_core_project_db_fill (core, core->offset, core->offset);
+	}
 	if (rb) {
 		r_core_block_read (core);
 	}
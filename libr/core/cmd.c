@@ -2850,6 +2850,9 @@ static int cmd_resize(void *data, const char *input) {
 		return true;
 	}
 
+	if (!r_core_task_wait_readers (&core->tasks)) {
+		return false;
+	}
 	grow = (newsize > oldsize);
 	if (grow) {
 		ret = r_io_resize (core->io, newsize);
@@ -3039,6 +3042,24 @@ static int cmd_tasks(void *data, const char *input) {
 		r_core_task_enqueue (&core->tasks, task);
 		break;
 	}
+	case 'r': { // "&r"
+		if (r_sandbox_enable (0)) {
+			R_LOG_ERROR ("This command is disabled in sandbox mode");
+			return 0;
+		}
+		const char *cmd = r_str_trim_head_ro (input + 1);
+		if (!*cmd) {
+			r_core_cmd_help_match (core, help_msg_amper, "&r", true);
+			break;
+		}
+		RCoreTask *task = r_core_task_new (core, true, cmd, NULL, core);
+		if (!task) {
+			break;
+		}
+		task->concurrent = true;
+		r_core_task_enqueue (&core->tasks, task);
+		break;
+	}
 	}
 	return 0;
 }
@@ -169,6 +169,7 @@ static RCoreHelpMessage help_msg_aa = {
 	"aac*", " [len]", "flag function calls without performing a complete analysis",
 	"aaci", "", "flag import xrefs only",
 	"aad", " [len]", "analyze data references to code",
+	"aaD", "", "apply the dwarf unit covering the current address (see bin.dbginfo.lazy)",
 	"aae", "[?] [len] ([addr])", "analyze references with ESIL (optionally to address)",
 	"aaef", "", "analyze references with ESIL in all functions",
 	"aaf", "[?][efrt] ", "analyze all functions relationships with flags, type matching and consecutive",
@@ -913,6 +914,7 @@ static RCoreHelpMessage help_msg_ao = {
 	"aoc", " [cycles]", "analyze which op could be executed in [cycles]",
 	"aod", " [mnemonic]", "instruction mnemonic description for asm.arch",
 	"aoda", "", "show all mnemonic descriptions",
+	"aoh", "[j-]", "show the decoded instructions cache stats (see anal.opcache), aoh- flushes it",
 	"aoe", " N", "display esil form for N opcodes",
 	"aoem", " N", "display memory references from esil emulation of N opcode",
 	"aoef", " expr", "filter esil expression of opcode by given output",
@@ -8316,6 +8318,43 @@ static void cmd_anal_opcode_bits(RCore *core, const char *arg, int mode) {
 	}
 }
 
+static void cmd_anal_opcache(RCore *core, const char *input) {
+	RAnalOpCacheStats st;
+	switch (*input) {
+	case '-': // "aoh-"
+		r_anal_opcache_flush (core->anal);
+		r_anal_opcache_reset_stats (core->anal);
+		return;
+	case '?':
+		r_core_cmd_help_match (core, help_msg_ao, "aoh", false);
+		return;
+	}
+	if (!r_anal_opcache_stats (core->anal, &st)) {
+		R_LOG_ERROR ("The instructions cache is disabled, see anal.opcache");
+		return;
+	}
+	const ut64 total = st.hits + st.misses;
+	const double ratio = total? (double)st.hits * 100 / total: 0;
+	if (*input == 'j') { // "aohj"
+		PJ *pj = r_core_pj_new (core);
+		pj_o (pj);
+		pj_kn (pj, "hits", st.hits);
+		pj_kn (pj, "misses", st.misses);
+		pj_kn (pj, "evictions", st.evictions);
+		pj_ki (pj, "count", st.count);
+		pj_ki (pj, "size", st.size);
+		pj_end (pj);
+		char *s = pj_drain (pj);
+		r_cons_println (s);
+		free (s);
+	} else {
+		r_cons_printf ("hits      %"PFMT64d" (%.2f%%)\n", st.hits, ratio);
+		r_cons_printf ("misses    %"PFMT64d"\n", st.misses);
+		r_cons_printf ("evictions %"PFMT64d"\n", st.evictions);
+		r_cons_printf ("count     %d/%d\n", st.count, st.size);
+	}
+}
+
 static void cmd_anal_opcode(RCore *core, const char *input) {
 	int l, len = core->blocksize;
 	ut32 tbs = core->blocksize;
@@ -8455,6 +8494,9 @@ static void cmd_anal_opcode(RCore *core, const char *input) {
 		r_config_set_b (core->config, "asm.xrefs", xr);
 	}
 	break;
+	case 'h': // "aoh"
+		cmd_anal_opcache (core, input + 1);
+		break;
 	case 'd': // "aod"
 		if (input[1] == 'a') { // "aoda"
 			// list sdb database
@@ -9202,8 +9244,7 @@ static const char *axtm_name(RCore *core, ut64 addr) {
 	return name;
 }
 
-static bool axtm_cb(void *u, const ut64 k, const void *v) {
-	RCore *core = (RCore*)u;
+static void axtm_at(RCore *core, ut64 k) {
 	const char *name = axtm_name (core, k);
 	RListIter *iter;
 	RAnalRef *ref;
@@ -9216,15 +9257,38 @@ static bool axtm_cb(void *u, const ut64 k, const void *v) {
 		}
 	}
 	r_list_free (list);
+}
+
+static bool axtm_key_cb(void *user, const RAnalRef *ref) {
+	RVector *keys = user;
+	ut64 *last = r_vector_empty (keys)? NULL: r_vector_index_ptr (keys, keys->len - 1);
+	if (!last || *last != ref->at) {
+		r_vector_push (keys, (void *)&ref->at);
+	}
 	return true;
 }
 
+static void axtm_foreach(RCore *core, bool refs) {
+	RVector keys;
+	r_vector_init (&keys, sizeof (ut64), NULL, NULL);
+	if (refs) {
+		r_anal_refs_foreach (core->anal, UT64_MAX, axtm_key_cb, &keys);
+	} else {
+		r_anal_xrefs_foreach (core->anal, UT64_MAX, axtm_key_cb, &keys);
+	}
+	ut64 *k;
+	r_vector_foreach (&keys, k) {
+		axtm_at (core, *k);
+	}
+	r_vector_fini (&keys);
+}
+
 static void axtm(RCore *core) {
-	ht_up_foreach (core->anal->dict_refs, axtm_cb, core);
+	axtm_foreach (core, true);
 }
 
 static void axfm(RCore *core) {
-	ht_up_foreach (core->anal->dict_xrefs, axtm_cb, core);
+	axtm_foreach (core, false);
 }
 
 static bool cmd_anal_refs(RCore *core, const char *input) {
@@ -12323,6 +12387,13 @@ static int cmd_anal_all(RCore *core, const char *input) {
 			r_core_cmd0 (core, "af @@f:entry*");
 		}
 		break;
+	case 'D': // "aaD"
+		if (input[1] == '?') {
+			r_core_cmd_help_match (core, help_msg_aa, "aaD", true);
+		} else {
+			r_core_return_value (core, r_core_bin_dwarf_load_at (core, core->offset)? 0: 1);
+		}
+		break;
 	case 'F': // "aaF" "aaFa"
 		if (!input[1] || input[1] == ' ' || input[1] == 'a') {
 			r_core_anal_inflags (core, input + 1);
@@ -12527,6 +12598,10 @@ static int cmd_anal_all(RCore *core, const char *input) {
 				r_core_anal_propagate_noreturn (core, UT64_MAX);
 				r_core_task_yield (&core->tasks);
 
+				if (r_config_get_b (core->config, "bin.dbginfo.lazy")) {
+					R_LOG_INFO ("Apply the dwarf units of all functions (aaD @@F)");
+					r_core_cmd0 (core, "aaD @@F");
+				}
 				// apply dwarf function information
 				Sdb *dwarf_sdb = sdb_ns (core->anal->sdb, "dwarf", 0);
 				if (dwarf_sdb) {
@@ -33,6 +33,7 @@ static RCoreHelpMessage help_msg_i = {
 	"iHH", "", "verbose Headers in raw text",
 	"ii", "", "imports",
 	"iI", "", "binary info",
+	"iIt", "[j]", "show which bin items are loaded and the time spent computing them",
 	"ik", " [query]", "key-value database from RBinObject",
 	"il", "", "libraries",
 	"iL ", "[plugin]", "list all RBin plugins loaded or plugin details",
@@ -347,6 +348,37 @@ static void cmd_info_bin(RCore *core, int va, PJ *pj, int mode) {
 	}
 }
 
+// the object of the given file with the item computed, they are loaded on first use
+static RBinObject *bin_object_item(RBinFile *bf, RBinItem item) {
+	RBinObject *obj = bf? bf->o: NULL;
+	if (obj) {
+		r_bin_object_load_item (bf, obj, item);
+	}
+	return obj;
+}
+
+// bin items are computed on first use, this lists the ones already loaded
+static void cmd_iIt(RCore *core, PJ *pj) {
+	RBinFile *bf = r_bin_cur (core->bin);
+	RBinObject *obj = bf? bf->o: NULL;
+	if (!obj) {
+		return;
+	}
+	int i;
+	for (i = 0; i < R_BIN_ITEM_LAST; i++) {
+		const bool loaded = obj->loaded & (1U << i);
+		const char *name = r_bin_item_tostring (i);
+		if (pj) {
+			pj_ko (pj, name);
+			pj_kb (pj, "loaded", loaded);
+			pj_kn (pj, "time", obj->load_time[i]);
+			pj_end (pj);
+		} else {
+			r_cons_printf ("%-8s %-5s %8"PFMT64u"us\n", name, r_str_bool (loaded), obj->load_time[i]);
+		}
+	}
+}
+
 static void playMsg(RCore *core, const char *n, int len) {
 	if (r_config_get_b (core->config, "scr.tts")) {
 		char *s = (*n && len > 0)
@@ -453,7 +485,7 @@ static void cmd_ic_comma(RCore *core, const char *input) {
 	r_table_add_column (t, typeString, "klass", 0);
 	r_table_add_column (t, typeString, "name", 0);
 	r_list_foreach (objs, objs_iter, bf) {
-		RBinObject *obj = bf->o;
+		RBinObject *obj = bin_object_item (bf, R_BIN_ITEM_CLASSES);
 		RBinClass *klass;
 		RListIter *iter, *iter2;
 		core->bin->cur = bf;
@@ -823,7 +855,7 @@ static int cmd_info(void *data, const char *input) {
 			RBinFile *bf;
 			RBinFile *cur = core->bin->cur;
 			r_list_foreach (objs, iter, bf) {
-				RBinObject *obj = bf->o;
+				RBinObject *obj = bin_object_item (bf, R_BIN_ITEM_LIBS);
 				core->bin->cur = bf;
 				RBININFO ("libs", R_CORE_BIN_ACC_LIBS, NULL, (obj && obj->libs)? r_list_length (obj->libs): 0);
 			}
@@ -857,7 +889,7 @@ static int cmd_info(void *data, const char *input) {
 				mode = R_MODE_SIMPLEST;
 			}
 			r_list_foreach (objs, iter, bf) {
-				RBinObject *obj = bf->o;
+				RBinObject *obj = bin_object_item (bf, R_BIN_ITEM_SYMBOLS);
 				if (!obj) {
 					continue;
 				}
@@ -1022,7 +1054,7 @@ static int cmd_info(void *data, const char *input) {
 			RBinFile *bf;
 			RBinFile *cur = core->bin->cur;
 			r_list_foreach (objs, iter, bf) {
-				RBinObject *obj = bf->o;
+				RBinObject *obj = bin_object_item (bf, R_BIN_ITEM_IMPORTS);
 				core->bin->cur = bf;
 				RBININFO ("imports", R_CORE_BIN_ACC_IMPORTS, NULL,
 					(obj && obj->imports)? r_list_length (obj->imports): 0);
@@ -1032,6 +1064,10 @@ static int cmd_info(void *data, const char *input) {
 			break;
 		}
 		case 'I': // "iI"
+			if (input[1] == 't') { // "iIt"
+				cmd_iIt (core, pj);
+				goto done;
+			}
 			  {
 				  RList *objs = r_core_bin_files (core);
 				  RListIter *iter;
@@ -1221,7 +1257,7 @@ static int cmd_info(void *data, const char *input) {
 					RBinFile *cur = core->bin->cur;
 					r_list_foreach (objs, iter, bf) {
 						core->bin->cur = bf;
-						RBinObject *obj = r_bin_cur_object (core->bin);
+						RBinObject *obj = bin_object_item (bf, R_BIN_ITEM_STRINGS);
 						RBININFO ("strings", R_CORE_BIN_ACC_STRINGS, NULL,
 								(obj && obj->strings)? r_list_length (obj->strings): 0);
 					}
@@ -1241,7 +1277,7 @@ static int cmd_info(void *data, const char *input) {
 			} else if (input[1] == 'g') { // "icg"
 				RBinClass *cls;
 				RListIter *iter, *iter2;
-				RBinObject *obj = r_bin_cur_object (core->bin);
+				RBinObject *obj = bin_object_item (r_bin_cur (core->bin), R_BIN_ITEM_CLASSES);
 				if (!obj) {
 					break;
 				}
@@ -1293,7 +1329,7 @@ static int cmd_info(void *data, const char *input) {
 				RBinFile *bf;
 				RBinFile *cur = core->bin->cur;
 				r_list_foreach (objs, objs_iter, bf) {
-					RBinObject *obj = bf->o;
+					RBinObject *obj = bin_object_item (bf, R_BIN_ITEM_CLASSES);
 					RBinClass *cls;
 					RBinSymbol *sym;
 					RListIter *iter, *iter2;
@@ -1463,7 +1499,7 @@ static int cmd_info(void *data, const char *input) {
 				RBinFile *cur = core->bin->cur;
 				r_list_foreach (objs, iter, bf) {
 					core->bin->cur = bf;
-					RBinObject *obj = bf->o;
+					RBinObject *obj = bin_object_item (bf, R_BIN_ITEM_CLASSES);
 					if (obj && obj->classes) {
 						int len = r_list_length (obj->classes);
 						RBININFO ("classes", R_CORE_BIN_ACC_CLASSES, NULL, len);
@@ -73,6 +73,8 @@ static RCoreHelpMessage help_msg_CL = {
 	"CLLf", "", "show source lines covered by the current function (see CLL@@i or list)",
 	"CL", " addr file:line", "register new file:line source details, r2 will slurp the line",
 	"CL", " addr base64:text", "register new source details for given address using base64",
+	"CLr", " [file]", "load the code line table from file (defaults to the binary path + .r2al)",
+	"CLw", " [file]", "save the code line table to file (defaults to the binary path + .r2al)",
 	NULL
 };
 
@@ -153,14 +155,9 @@ static RCoreHelpMessage help_msg_Cvs = {
 	NULL
 };
 
-static int remove_meta_offset(RCore *core, ut64 offset) {
-	char aoffset[SDB_NUM_BUFSZ];
-	char *aoffsetptr = sdb_itoa (offset, 16, aoffset, sizeof (aoffset));
-	if (!aoffsetptr) {
-		R_LOG_ERROR ("Failed to convert %"PFMT64x" to a key", offset);
-		return -1;
-	}
-	return sdb_unset (core->bin->cur->sdb_addrinfo, aoffsetptr, 0);
+static bool remove_meta_offset(RCore *core, ut64 offset) {
+	RBinFile *bf = r_bin_cur (core->bin);
+	return bf && bf->addrline && r_bin_addrline_del (bf->addrline, offset);
 }
 
 static bool print_meta_offset(RCore *core, ut64 addr, PJ *pj) {
@@ -206,125 +203,134 @@ static bool print_meta_offset(RCore *core, ut64 addr, PJ *pj) {
 	return ret;
 }
 
-#if 0
-static int remove_meta_fileline(RCore *core, const char *file_line) {
-	return sdb_unset (core->bin->cur->sdb_addrinfo, file_line, 0);
-}
-
-static int print_meta_fileline(RCore *core, const char *file_line) {
-	char *meta_info = sdb_get (core->bin->cur->sdb_addrinfo, file_line, 0);
-	if (meta_info) {
-		r_cons_printf ("Meta info %s\n", meta_info);
-	} else {
-		r_cons_printf ("No meta info for %s found\n", file_line);
-	}
-	return 0;
-}
-#endif
-
-static bool print_addrinfo_json(void *user, const char *k, const char *v) {
-	ut64 offset = sdb_atoi (k);
-	if (!offset || offset == UT64_MAX) {
+static bool print_addrinfo_json(void *user, const RBinAddrline *row) {
+	if (filter_offset != UT64_MAX && filter_offset != row->addr) {
 		return true;
 	}
-	char *subst = strdup (v);
-	char *colonpos = strchr (subst, '|'); // XXX keep only : for simplicity?
-	if (!colonpos) {
-		colonpos = strchr (subst, ':');
-	}
-	if (!colonpos) {
-		r_cons_printf ("%s\n", subst);
+	filter_count++;
+	PJ *pj = (PJ*)user;
+	pj_o (pj);
+	if (row->line == R_BIN_ADDRLINE_TEXT) {
+		pj_ks (pj, "text", row->file);
+		pj_kn (pj, "addr", row->addr);
+		pj_end (pj);
+		return true;
 	}
-	if (colonpos && (filter_offset == UT64_MAX || filter_offset == offset)) {
-		if (filter_format) {
-			*colonpos = ':';
-	//		r_cons_printf ("CL %s %s\n", k, subst);
-		} else {
-			*colonpos = 0;
-	//		r_cons_printf ("file: %s\nline: %s\naddr: 0x%08"PFMT64x"\n", subst, colonpos + 1, offset);
-		}
-		filter_count++;
+	pj_ks (pj, "file", row->file);
+	pj_kn (pj, "line", row->line);
+	pj_kn (pj, "addr", row->addr);
+	const char *cached_existance = sdb_const_get (fscache, row->file, NULL);
+	bool file_exists = false;
+	if (cached_existance) {
+		file_exists = !strcmp (cached_existance, "1");
+	} else {
+		file_exists = r_file_exists (row->file);
+		sdb_set (fscache, row->file, file_exists? "1": "0", 0);
 	}
-	const char *file = subst;
-	int line = atoi (colonpos + 1);
-	ut64 addr = offset;
-	PJ *pj = (PJ*)user;
-	if (pj) {
-		pj_o (pj);
-		pj_ks (pj, "file", file);
-		pj_kn (pj, "line", line);
-		pj_kn (pj, "addr", addr);
-		const char *cached_existance = sdb_const_get (fscache, file, NULL);
-		bool file_exists = false;
-		if (cached_existance) {
-			file_exists = !strcmp (cached_existance, "1");
-		} else {
-			if (r_file_exists (file)) {
-				sdb_set (fscache, file, "1", 0);
-			} else {
-				sdb_set (fscache, file, "0", 0);
-			}
-		}
-		if (file_exists) {
-			char *row = r_file_slurp_line (file, line, 0);
-			pj_ks (pj, "text", file);
-			free (row);
+	if (file_exists) {
+		char *text = r_file_slurp_line (row->file, row->line, 0);
+		if (text) {
+			pj_ks (pj, "text", text);
+			free (text);
 		}
-		pj_end (pj);
 	}
-	free (subst);
+	pj_end (pj);
 	return true;
 }
 
-static bool print_addrinfo(void *user, const char *k, const char *v) {
-	ut64 offset = sdb_atoi (k);
-	if (!offset || offset == UT64_MAX) {
+static bool print_addrinfo(void *user, const RBinAddrline *row) {
+	if (filter_offset != UT64_MAX && filter_offset != row->addr) {
 		return true;
 	}
-	char *subst = strdup (v);
-	char *colonpos = strchr (subst, '|');
-	if (!colonpos) {
-		colonpos = strchr (subst, ':'); // : for shell and | for db.. imho : everywhere
-	}
-	if (!colonpos) {
-		r_cons_printf ("%s\n", subst);
-	} else if (filter_offset == UT64_MAX || filter_offset == offset) {
-		if (filter_format) {
-			*colonpos = ':';
-			r_cons_printf ("\"\"CL %s %s\n", k, subst);
+	if (row->line == R_BIN_ADDRLINE_TEXT) {
+		r_cons_printf ("%s\n", row->file);
+	} else if (filter_format) {
+		if (row->column) {
+			r_cons_printf ("\"\"CL 0x%"PFMT64x" %s:%u:%u\n", row->addr, row->file, row->line, row->column);
 		} else {
-			*colonpos++ = 0;
-			int line = atoi (colonpos);
-			int colu = 0;
-			char *columnpos = strchr (colonpos, '|');
-			if (columnpos) {
-				*columnpos ++ = 0;
-				colu = atoi (columnpos);
-			}
+			r_cons_printf ("\"\"CL 0x%"PFMT64x" %s:%u\n", row->addr, row->file, row->line);
+		}
+	} else {
+		r_cons_printf ("file: %s\nline: %u\ncolu: %u\naddr: 0x%08"PFMT64x"\n",
+			row->file, row->line, row->column, row->addr);
+	}
+	filter_count++;
+	return true;
+}
 
-			r_cons_printf ("file: %s\nline: %d\ncolu: %d\naddr: 0x%08"PFMT64x"\n",
-				subst, line, colu, offset);
+// accepts file:line[:column] (or | as separator), anything else is kept as text
+static bool cmd_meta_add_fileline(RBinAddrLineStore *s, const char *fileline, ut64 offset) {
+	char *file = strdup (fileline);
+	if (!file) {
+		return false;
+	}
+	ut32 nums[2] = {0};
+	int n = 0;
+	while (n < 2) {
+		char *sep = (char *)r_str_rsep (file, file + strlen (file), ":|");
+		if (!sep || sep == file || !sep[1] || !r_str_isnumber (sep + 1)) {
+			break;
 		}
-		filter_count++;
+		nums[n++] = (ut32)atoi (sep + 1);
+		*sep = 0;
 	}
-	free (subst);
+	bool res;
+	if (!n) {
+		res = r_bin_addrline_set (s, offset, fileline, R_BIN_ADDRLINE_TEXT, 0);
+	} else if (n == 1) {
+		res = r_bin_addrline_set (s, offset, file, nums[0], 0);
+	} else {
+		res = r_bin_addrline_set (s, offset, file, nums[1], nums[0]);
+	}
+	free (file);
+	return res;
+}
 
-	return true;
+static char *addrline_cache_path(RCore *core, const char *arg) {
+	arg = r_str_trim_head_ro (arg);
+	if (*arg) {
+		return strdup (arg);
+	}
+	RBinFile *bf = r_bin_cur (core->bin);
+	return (bf && bf->file)? r_str_newf ("%s.r2al", bf->file): NULL;
 }
 
-static int cmd_meta_add_fileline(Sdb *s, char *fileline, ut64 offset) {
-	char aoffset[SDB_NUM_BUFSZ];
-	char *aoffsetptr = sdb_itoa (offset, 16, aoffset, sizeof (aoffset));
-	if (!aoffsetptr) {
-		return -1;
+static bool cmd_meta_addrline_save(RCore *core, const char *arg) {
+	RBinFile *bf = r_bin_cur (core->bin);
+	char *path = addrline_cache_path (core, arg);
+	if (!bf || !bf->addrline || !path) {
+		R_LOG_ERROR ("No code line information to save");
+		free (path);
+		return false;
+	}
+	ut32 size = 0;
+	ut8 *buf = r_bin_addrline_serialize (bf->addrline, &size);
+	bool res = buf && r_file_dump (path, buf, size, false);
+	if (!res) {
+		R_LOG_ERROR ("Cannot save the code line table to %s", path);
 	}
-	if (!sdb_add (s, aoffsetptr, fileline, 0)) {
-		sdb_set (s, aoffsetptr, fileline, 0);
+	free (buf);
+	free (path);
+	return res;
+}
+
+static bool cmd_meta_addrline_load(RCore *core, const char *arg) {
+	RBinFile *bf = r_bin_cur (core->bin);
+	char *path = addrline_cache_path (core, arg);
+	if (!bf || !bf->addrline || !path) {
+		R_LOG_ERROR ("No binary file to load the code line table into");
+		free (path);
+		return false;
 	}
-	if (!sdb_add (s, fileline, aoffsetptr, 0)) {
-		sdb_set (s, fileline, aoffsetptr, 0);
+	size_t size = 0;
+	ut8 *buf = (ut8 *)r_file_slurp (path, &size);
+	bool res = buf && size < UT32_MAX && r_bin_addrline_unserialize (bf->addrline, buf, (ut32)size);
+	if (!res) {
+		R_LOG_ERROR ("Cannot load the code line table from %s", path);
 	}
-	return 0;
+	free (buf);
+	free (path);
+	return res;
 }
 
 static int cmd_meta_lineinfo(RCore *core, const char *input) {
@@ -334,7 +340,6 @@ static int cmd_meta_lineinfo(RCore *core, const char *input) {
 	bool use_json = false;
 	int all = false;
 	const char *p = input;
-	char *file_line = NULL;
 
 	if (*p == '?') {
 		r_core_cmd_help (core, help_msg_CL);
@@ -356,6 +361,12 @@ static int cmd_meta_lineinfo(RCore *core, const char *input) {
 		}
 		return 0;
 	}
+	if (*p == 'w') { // "CLw"
+		return cmd_meta_addrline_save (core, p + 1)? 0: 1;
+	}
+	if (*p == 'r') { // "CLr"
+		return cmd_meta_addrline_load (core, p + 1)? 0: 1;
+	}
 	if (*p == '-') { // "CL-"
 		p++;
 		remove = true;
@@ -384,10 +395,14 @@ static int cmd_meta_lineinfo(RCore *core, const char *input) {
 	}
 
 	if (all) {
-		if (remove) {
-			sdb_reset (core->bin->cur->sdb_addrinfo);
-		} else {
-			sdb_foreach (core->bin->cur->sdb_addrinfo, print_addrinfo, NULL);
+		RBinFile *bf = r_bin_cur (core->bin);
+		if (bf && bf->addrline) {
+			if (remove) {
+				r_bin_addrline_reset (bf->addrline);
+			} else {
+				filter_offset = UT64_MAX;
+				r_bin_addrline_foreach (bf->addrline, print_addrinfo, NULL);
+			}
 		}
 		return 0;
 	}
@@ -408,18 +423,18 @@ static int cmd_meta_lineinfo(RCore *core, const char *input) {
 			ut8 *o = sdb_decode (sp + 7, &len);
 			if (!o) {
 				R_LOG_ERROR ("Invalid base64");
+				free (myp);
 				return 0;
 			}
 			sp = pheap = (char *)o;
 		}
 		RBinFile *bf = r_bin_cur (core->bin);
 		ret = 0;
-		if (bf && bf->sdb_addrinfo) {
-			ret = cmd_meta_add_fileline (bf->sdb_addrinfo, sp, offset);
+		if (bf && bf->addrline) {
+			ret = cmd_meta_add_fileline (bf->addrline, sp, offset)? 0: -1;
 		} else {
-			R_LOG_TODO ("Support global SdbAddrinfo or dummy rbinfile to handlee this case");
+			R_LOG_TODO ("Support a global line table or dummy rbinfile to handle this case");
 		}
-		free (file_line);
 		free (myp);
 		free (pheap);
 		return ret;
@@ -428,7 +443,6 @@ static int cmd_meta_lineinfo(RCore *core, const char *input) {
 	if (remove) {
 		remove_meta_offset (core, offset);
 	} else {
-		// taken from r2 // TODO: we should move this addrinfo sdb logic into RBin.. use HT
 		filter_offset = offset;
 		filter_count = 0;
 		fscache = sdb_new0 ();
@@ -437,12 +451,12 @@ static int cmd_meta_lineinfo(RCore *core, const char *input) {
 		if (use_json) {
 			pj = r_core_pj_new (core);
 			pj_a (pj);
-			if (bf && bf->sdb_addrinfo) {
-				sdb_foreach (bf->sdb_addrinfo, print_addrinfo_json, pj);
+			if (bf && bf->addrline) {
+				r_bin_addrline_foreach (bf->addrline, print_addrinfo_json, pj);
 			}
 		} else {
-			if (bf && bf->sdb_addrinfo) {
-				sdb_foreach (bf->sdb_addrinfo, print_addrinfo, NULL);
+			if (bf && bf->addrline) {
+				r_bin_addrline_foreach (bf->addrline, print_addrinfo, NULL);
 			}
 		}
 		if (filter_count == 0) {
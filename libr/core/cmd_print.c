@@ -137,6 +137,7 @@ static RCoreHelpMessage help_msg_amper = {
 	"&", " <cmd>", "run <cmd> in a new background task",
 	"&:", "<cmd>", "queue <cmd> to be executed later when possible",
 	"&t", " <cmd>", "run <cmd> in a new transient background task (auto-delete when it is finished)",
+	"&r", " <cmd>", "run read-only <cmd> concurrently on a copy of the session (cooperatively if it has no files)",
 	"&", "", "list all tasks",
 	"&j", "", "list all tasks (in JSON)",
 	"&=", " 3", "show output of task 3",
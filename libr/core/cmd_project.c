@@ -10,6 +10,7 @@ static RCoreHelpMessage help_msg_P = {
 	"P-", " [name]", "delete project",
 	"P*", "", "printn project script as r2 commands",
 	"P!", "([cmd])", "open a shell or run command in the project directory",
+	"Pb", "[?ils] [file]", "save or load the analysis in a binary snapshot",
 	"Pc", "", "close current project",
 	"Pd", " [N]", "diff Nth commit",
 	"Pi", " [file]", "show project information",
@@ -40,6 +41,16 @@ static RCoreHelpMessage help_msg_Pn = {
 	NULL
 };
 
+static RCoreHelpMessage help_msg_Pb = {
+	"Usage:", "Pb[ils] [file] ([from] [to])", "Binary analysis snapshots",
+	"Pb", " [file]", "save the analysis, only the chunks that changed are written",
+	"Pbi", "[j] [file]", "list the chunks of the snapshot",
+	"Pbl", " [file] ([from] [to])", "load the snapshot, or just the addresses in the given range",
+	"Pbs", " [file]", "same as Pb",
+	"NOTE:", "", "set prj.db to use snapshots when saving and opening projects",
+	NULL
+};
+
 static RCoreHelpMessage help_msg_Pz = {
 	"Usage:", "Pz[ie] ([file])", "Import/Export Projects in Zip form",
 	"Pz", "", "export project to prjname.zrp",
@@ -94,6 +105,49 @@ static void r_core_project_zip_export(RCore *core, const char *prjname, const ch
 	free (cwd);
 }
 
+static void cmd_Pb(RCore *core, const char *cmd) {
+	const char mode = *cmd;
+	if (mode && mode != ' ' && mode != '?') {
+		cmd++;
+	}
+	const bool json = mode == 'i' && *cmd == 'j';
+	if (json) {
+		cmd++;
+	}
+	int argc = 0;
+	char **argv = r_str_argv (r_str_trim_head_ro (cmd), &argc);
+	if (!argv || argc < 1 || mode == '?') {
+		r_core_cmd_help (core, help_msg_Pb);
+		r_str_argv_free (argv);
+		return;
+	}
+	const char *file = argv[0];
+	switch (mode) {
+	case 'i': // "Pbi"
+		r_core_project_db_list (core, file, json? 'j': 0);
+		break;
+	case 'l': // "Pbl"
+		{
+			ut64 from = (argc > 1)? r_num_math (core->num, argv[1]): 0;
+			ut64 to = (argc > 2)? r_num_math (core->num, argv[2]): UT64_MAX;
+			if (from > to) {
+				R_LOG_ERROR ("Invalid range");
+			} else {
+				r_core_project_db_load (core, file, from, to);
+			}
+		}
+		break;
+	case 's': // "Pbs"
+	case ' ': // "Pb"
+		r_core_project_db_save (core, file);
+		break;
+	default:
+		r_core_cmd_help (core, help_msg_Pb);
+		break;
+	}
+	r_str_argv_free (argv);
+}
+
 static void cmd_Pz(RCore *core, const char *cmd) {
 	char *arg = strchr (cmd, ' ');
 	if (arg) {
@@ -193,6 +247,9 @@ static int cmd_project(void *data, const char *input) {
 	case 'z': // "Pz"
 		cmd_Pz (core, input + 1);
 		break;
+	case 'b': // "Pb"
+		cmd_Pb (core, input + 1);
+		break;
 	case '+': // "P+"
 		// xxx
 	case 's': // "Ps"
@@ -3039,6 +3039,21 @@ static void do_string_search(RCore *core, RInterval search_itv, struct search_pa
 			const ut64 from = itv.addr, to = r_itv_end (itv),
 					from1 = search->bckwrds? to: from,
 					to1 = search->bckwrds? from: to;
+			if (search->threads != 1 && search->pool && search->pool->size > 1
+					&& search->mode == R_SEARCH_KEYWORD && !search->bckwrds) {
+				// chunked scan on the workers of the pool, hits come back in address order
+				if (r_search_update_read (search, from, to) < 0) {
+					R_LOG_ERROR ("Cannot search in 0x%08"PFMT64x, from);
+				}
+				r_core_return_value (core, search->nhits);
+				if (param->outmode != R_MODE_JSON) {
+					eprintf ("hits: %" PFMT64d "\n", search->nhits - saved_nhits);
+				}
+				if (search->maxhits > 0 && search->nhits >= search->maxhits) {
+					goto done;
+				}
+				continue;
+			}
 			ut64 len;
 			for (at = from1; at != to1; at = search->bckwrds? at - len: at + len) {
 				print_search_progress (at, to1, search->nhits, param);
@@ -3792,6 +3807,7 @@ static int cmd_search(void *data, const char *input) {
 	core->search->align = r_config_get_i (core->config, "search.align");
 	searchflags = r_config_get_i (core->config, "search.flags");
 	core->search->maxhits = r_config_get_i (core->config, "search.maxhits");
+	core->search->threads = r_config_get_i (core->config, "search.threads");
 	searchprefix = r_config_get (core->config, "search.prefix");
 	core->search->overlap = r_config_get_i (core->config, "search.overlap");
 	core->search->bckwrds = false;
@@ -1348,6 +1348,9 @@ static void cmd_wcf(RCore *core, const char *dfn) {
 		void **iter;
 		r_pvector_foreach (layer->vec, iter) {
 			RIOCacheItem *c = *iter;
+			if (!r_io_cache_item_load (core->io, c)) {
+				continue;
+			}
 			const ut64 ps = r_itv_size (c->itv);
 			const ut64 va = r_itv_begin (c->itv);
 			const ut64 pa = __va2pa (core, va);
@@ -2290,6 +2293,21 @@ static int cmd_ws(void *data, const char *input) {
 	return 0;
 }
 
+// the subcommands that may change the opened files, the rest only print,
+// set the write mask or work on the io cache layers without committing them
+static bool cmd_write_changes_files(const char *input) {
+	switch (*input) {
+	case '?': // "w?"
+	case 'h': // "wh"
+	case 'm': // "wm"
+		return false;
+	case 'c': // "wc"
+		return input[1] == 'i' || input[1] == 'f' || r_str_startswith (input + 1, "pi")
+			|| (input[1] == '+' && input[2] != '+' && input[2] != '?');
+	}
+	return true;
+}
+
 /* TODO: simplify using r_write */
 static int cmd_write(void *data, const char *input) {
 	RCore *core = (RCore *)data;
@@ -2297,6 +2315,12 @@ static int cmd_write(void *data, const char *input) {
 	if (!input) {
 		return 0;
 	}
+	// concurrent tasks read the files directly, patching the cache is fine
+	if (cmd_write_changes_files (input) && !r_config_get_b (core->config, "io.cache")) {
+		if (!r_core_task_wait_readers (&core->tasks)) {
+			return 0;
+		}
+	}
 
 	switch (*input) {
 	case '0': // "w0"
@@ -33,9 +33,10 @@ static RCoreHelpMessage help_msg_zb = {
 };
 
 static RCoreHelpMessage help_msg_z_slash = {
-	"Usage:", "z/[f*] ", "# Search signatures (see 'e?search' for options)",
+	"Usage:", "z/[fo*] ", "# Search signatures (see 'e?search' for options)",
 	"z/ ", "", "search zignatures on range and flag matches",
 	"z/f ", "", "zignature search on known functions",
+	"z/o ", "filename", "search zignatures from a .r2z file on known functions without loading them",
 	"z/* ", "", "search zignatures on range and output radare commands",
 	NULL
 };
@@ -55,16 +56,16 @@ static RCoreHelpMessage help_msg_zf = {
 	"Usage:", "zf[dsz] filename ", "# Manage FLIRT signatures",
 	"zfd ", "filename", "open FLIRT file and dump",
 	"zfs ", "filename", "open FLIRT file and scan",
-	"zfs ", "/path/**.sig", "recursively search for FLIRT files and scan them (see dir.depth)",
+	"zfs ", "/path/**.sig", "recursively search for FLIRT files and scan with all of them at once (see dir.depth, zign.threads)",
 	"zfz ", "filename", "open FLIRT file and get sig commands (zfz flirt_file > zignatures.sig)",
 	NULL
 };
 
 static RCoreHelpMessage help_msg_zo = {
 	"Usage:", "zo[zs] filename ", "# Manage zignature files (see dir.zigns)",
-	"zo ", "filename", "load zinatures from sdb file",
+	"zo ", "filename", "load zinatures from sdb or .r2z file",
 	"zoz ", "filename", "load zinatures from gzipped sdb file",
-	"zos ", "filename", "save zignatures to sdb file (merge if file exists)",
+	"zos ", "filename", "save zignatures to sdb file, binary if it ends in .r2z (merge if file exists)",
 	NULL
 };
 
@@ -392,11 +393,9 @@ static int cmdFlirt(void *data, const char *input) {
 			return false;
 		}
 		int depth = r_config_get_i (core->config, "dir.depth");
-		char *file;
-		RListIter *iter;
 		RList *files = r_file_glob (input + 2, depth);
-		r_list_foreach (files, iter, file) {
-			r_sign_flirt_scan (core->anal, file);
+		if (files) {
+			r_sign_flirt_scan_files (core->anal, files);
 		}
 		r_list_free (files);
 		break;
@@ -678,7 +677,7 @@ static void print_ctx_hits(struct ctxSearchCB *ctx) {
 	}
 }
 
-static bool search(RCore *core, bool rad, bool only_func) {
+static bool search(RCore *core, bool rad, bool only_func, RSignFile *sf) {
 	const char *zign_prefix = r_config_get (core->config, "zign.prefix");
 	if (rad) {
 		r_cons_printf ("fs+%s\n", zign_prefix);
@@ -705,7 +704,7 @@ static bool search(RCore *core, bool rad, bool only_func) {
 	}
 
 	// Bytes search
-	if (r_config_get_i (core->config, "zign.bytes") && !only_func) {
+	if (r_config_get_i (core->config, "zign.bytes") && !only_func && !sf) {
 		const char *mode = r_config_get (core->config, "search.in");
 		RList *list = r_core_get_boundaries_prot (core, -1, mode, "search");
 		if (!list) {
@@ -723,7 +722,11 @@ static bool search(RCore *core, bool rad, bool only_func) {
 	// Function search
 	if (!ctx.bytes_only) {
 		R_LOG_INFO ("searching function metrics");
-		r_sign_metric_search (core->anal, &sm);
+		if (sf) {
+			r_sign_file_search (core->anal, sf, &sm);
+		} else {
+			r_sign_metric_search (core->anal, &sm);
+		}
 	}
 
 	if (rad) {
@@ -1233,16 +1236,32 @@ static int cmdSearch(void *data, const char *input) {
 	switch (*input) {
 	case 0:
 	case '*': // "z/*"
-		return search (core, input[0] == '*', false);
+		return search (core, input[0] == '*', false, NULL);
 	case 'f': // "z/f"
 		switch (input[1]) {
 		case 0:
 		case '*':
-			return search (core, input[1] == '*', true);
+			return search (core, input[1] == '*', true, NULL);
 		default:
 			r_core_cmd_help_match (core, help_msg_z_slash, "z/f", false);
 			return false;
 		}
+	case 'o': // "z/o"
+		if (input[1] == ' ' && input[2]) {
+			char *path = r_sign_path (core->anal, r_str_trim_head_ro (input + 2));
+			RSignFile *sf = path? r_sign_file_open (path): NULL;
+			if (!sf) {
+				R_LOG_ERROR ("Cannot open zignature file %s", input + 2);
+				free (path);
+				return false;
+			}
+			bool ret = search (core, false, true, sf);
+			r_sign_file_free (sf);
+			free (path);
+			return ret;
+		}
+		r_core_cmd_help_match (core, help_msg_z_slash, "z/o", false);
+		return false;
 	case '?':
 		r_core_cmd_help (core, help_msg_z_slash);
 		break;
@@ -2945,9 +2945,36 @@ static int win_eprintf(const char *format, ...) {
 }
 #endif
 
+// the decoded instructions are cached by virtual address
+static void opcache_invalidate_paddr(RCore *core, int fd, ut64 paddr, int len) {
+	if (!core->io->va) {
+		r_anal_opcache_invalidate (core->anal, paddr, len);
+		return;
+	}
+	RList *maps = r_io_map_get_by_fd (core->io, fd);
+	if (!maps) {
+		return;
+	}
+	RInterval itv = { paddr, len };
+	RListIter *iter;
+	RIOMap *map;
+	r_list_foreach (maps, iter, map) {
+		RInterval mitv = { map->delta, r_io_map_size (map) };
+		if (r_itv_overlap (itv, mitv)) {
+			RInterval w = r_itv_intersect (itv, mitv);
+			const ut64 vaddr = r_io_map_begin (map) + (r_itv_begin (w) - map->delta);
+			r_anal_opcache_invalidate (core->anal, vaddr, r_itv_size (w));
+		}
+	}
+	r_list_free (maps);
+}
+
 static void ev_iowrite_cb(REvent *ev, int type, void *user, void *data) {
 	RCore *core = user;
 	REventIOWrite *iow = data;
+	if (core->anal->opcache) {
+		opcache_invalidate_paddr (core, iow->fd, iow->addr, iow->len);
+	}
 	if (r_config_get_i (core->config, "anal.onchange")) {
 		// works, but loses varnames and such, but at least is not crashing
 		char *cmd = r_str_newf ("af-0x%08"PFMT64x";af 0x%08"PFMT64x, iow->addr, iow->addr);
@@ -3309,6 +3336,20 @@ R_API void r_core_bind_cons(RCore *core) {
 	core->cons->user = (void*)core;
 }
 
+// shared by the parallel paths of bin, anal and search, the cfg.threads workers
+// are only spawned when the first task is queued
+R_API RThreadPool *r_core_thread_pool(RCore *core) {
+	r_return_val_if_fail (core, NULL);
+	if (!core->pool) {
+		int size = r_config_get_i (core->config, "cfg.threads");
+		core->pool = r_th_pool_new (size);
+		core->bin->pool = core->pool;
+		core->anal->pool = core->pool;
+		core->search->pool = core->pool;
+	}
+	return core->pool;
+}
+
 R_API void r_core_fini(RCore *c) {
 	if (!c) {
 		return;
@@ -3325,6 +3366,11 @@ R_API void r_core_fini(RCore *c) {
 	r_core_task_break_all (&c->tasks);
 	r_core_task_join (&c->tasks, NULL, -1);
 	r_core_wait (c);
+	c->bin->pool = NULL;
+	c->anal->pool = NULL;
+	c->search->pool = NULL;
+	r_th_pool_free (c->pool);
+	c->pool = NULL;
 	/* TODO: it leaks as shit */
 	//update_sdb (c);
 	// avoid double free
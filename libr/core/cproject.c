@@ -5,6 +5,8 @@
 #include "rvc.h"
 #include <r_core.h>
 
+R_IPI void r_core_project_db_free(struct r_core_prjdb_t *db);
+
 R_API RProject *r_project_new(void) {
 	RProject *p = R_NEW0 (RProject);
 	return p;
@@ -49,6 +51,8 @@ R_API void r_project_close(RProject *p) {
 			rvc_close (p->rvc, true);
 			p->rvc = NULL;
 		}
+		r_core_project_db_free (p->db);
+		p->db = NULL;
 	}
 }
 
@@ -75,6 +79,7 @@ R_API void r_project_free(RProject *p) {
 	if (p) {
 		free (p->name);
 		free (p->path);
+		r_core_project_db_free (p->db);
 		free (p);
 	}
 }
@@ -1373,53 +1373,50 @@ static void ds_print_pins(RDisasmState *ds) {
 	}
 }
 
-static void ds_show_refs(RDisasmState *ds) {
-	RAnalRef *ref;
-	RListIter *iter;
-
-	if (!ds->show_cmtrefs) {
-		return;
+static bool ds_show_refs_cb(void *user, const RAnalRef *ref) {
+	RDisasmState *ds = user;
+	const char *cmt = r_meta_get_string (ds->core->anal, R_META_TYPE_COMMENT, ref->addr);
+	const RList *fls = r_flag_get_list (ds->core->flags, ref->addr);
+	RListIter *iter2;
+	RFlagItem *fis;
+	r_list_foreach (fls, iter2, fis) {
+		ds_begin_comment (ds);
+		ds_comment (ds, true, "%s (%s)", ds->cmtoken, fis->name);
 	}
-	RList *list = r_anal_xrefs_get_from (ds->core->anal, ds->at);
-
-	r_list_foreach (list, iter, ref) {
-		const char *cmt = r_meta_get_string (ds->core->anal, R_META_TYPE_COMMENT, ref->addr);
-		const RList *fls = r_flag_get_list (ds->core->flags, ref->addr);
-		RListIter *iter2;
-		RFlagItem *fis;
-		r_list_foreach (fls, iter2, fis) {
-			ds_begin_comment (ds);
-			ds_comment (ds, true, "%s (%s)", ds->cmtoken, fis->name);
-		}
 
-		// ds_align_comment (ds);
-		if (ds->show_color) {
-			r_cons_strcat (ds->color_comment);
-		}
-		if (cmt) {
+	// ds_align_comment (ds);
+	if (ds->show_color) {
+		r_cons_strcat (ds->color_comment);
+	}
+	if (cmt) {
+		ds_begin_comment (ds);
+		ds_comment (ds, true, "%s (%s)", ds->cmtoken, cmt);
+	}
+	if (ref->type & R_ANAL_REF_TYPE_CALL) {
+		RAnalOp aop;
+		ut8 buf[12];
+		r_io_read_at (ds->core->io, ref->at, buf, sizeof (buf));
+		// R2_590 - check for return value and use it wisely
+		(void)r_anal_op (ds->core->anal, &aop, ref->at, buf, sizeof (buf), R_ARCH_OP_MASK_ALL);
+		if ((aop.type & R_ANAL_OP_TYPE_MASK) == R_ANAL_OP_TYPE_UCALL) {
+			RAnalFunction * fcn = r_anal_get_function_at (ds->core->anal, ref->addr);
 			ds_begin_comment (ds);
-			ds_comment (ds, true, "%s (%s)", ds->cmtoken, cmt);
-		}
-		if (ref->type & R_ANAL_REF_TYPE_CALL) {
-			RAnalOp aop;
-			ut8 buf[12];
-			r_io_read_at (ds->core->io, ref->at, buf, sizeof (buf));
-			// R2_590 - check for return value and use it wisely
-			(void)r_anal_op (ds->core->anal, &aop, ref->at, buf, sizeof (buf), R_ARCH_OP_MASK_ALL);
-			if ((aop.type & R_ANAL_OP_TYPE_MASK) == R_ANAL_OP_TYPE_UCALL) {
-				RAnalFunction * fcn = r_anal_get_function_at (ds->core->anal, ref->addr);
-				ds_begin_comment (ds);
-				if (fcn) {
-					ds_comment (ds, true, "%s %s", ds->cmtoken, fcn->name);
-				} else {
-					ds_comment (ds, true, "%s 0x%" PFMT64x, ds->cmtoken, ref->addr);
-				}
+			if (fcn) {
+				ds_comment (ds, true, "%s %s", ds->cmtoken, fcn->name);
+			} else {
+				ds_comment (ds, true, "%s 0x%" PFMT64x, ds->cmtoken, ref->addr);
 			}
-			r_anal_op_fini (&aop);
 		}
-		ds_print_color_reset (ds);
+		r_anal_op_fini (&aop);
+	}
+	ds_print_color_reset (ds);
+	return true;
+}
+
+static void ds_show_refs(RDisasmState *ds) {
+	if (ds->show_cmtrefs) {
+		r_anal_refs_foreach (ds->core->anal, ds->at, ds_show_refs_cb, ds);
 	}
-	r_list_free (list);
 }
 
 static void ds_show_xrefs(RDisasmState *ds) {
@@ -5660,7 +5657,22 @@ static void ds_end_line_highlight(RDisasmState *ds) {
  *
  * pdu_condition_type is only used if pdu_condition is not NULL
  */
+// Fill wbuf, which is owned by the caller, with the bytes at addr. The io
+// mapping is borrowed when possible to skip the map walk of r_io_read_at, but
+// the borrowed bytes are only valid until the next io call (asm.emu writes,
+// map changes), so they are copied instead of being kept as the ds buffer
+static ut8 *ds_read_at(RDisasmState *ds, ut64 addr, ut8 *wbuf, int len) {
+	const ut8 *ptr;
+	if (r_io_peek_at (ds->core->io, addr, len, &ptr)) {
+		memcpy (wbuf, ptr, len);
+	} else {
+		r_io_read_at (ds->core->io, addr, wbuf, len);
+	}
+	return wbuf;
+}
+
 R_API int r_core_print_disasm(RCore *core, ut64 addr, ut8 *buf, int len, int count, enum r_pdu_condition_t pdu_condition_type, const void *pdu_condition, bool count_bytes, bool json, PJ *pj, RAnalFunction *pdf) {
+	ut8 *obuf = buf;
 	RPrint *p = core->print;
 	RAnalFunction *of = NULL;
 	RAnalFunction *f = NULL;
@@ -5866,7 +5878,7 @@ toro:
 					delta = -delta;
 				}
 				ds->addr += delta + ds->index;
-				r_io_read_at (core->io, ds->addr, buf, len);
+				ds->buf = buf = ds_read_at (ds, ds->addr, nbuf? nbuf: obuf, len);
 				inc = 0; //delta;
 				ds->index = 0;
 				of = f;
@@ -5876,7 +5888,7 @@ toro:
 			} else {
 				ds->lines--;
 				ds->addr++;
-				r_io_read_at (core->io, ds->addr, buf, len);
+				ds->buf = buf = ds_read_at (ds, ds->addr, nbuf? nbuf: obuf, len);
 				inc = 0; //delta;
 				ds->index = 0;
 			}
@@ -6213,7 +6225,7 @@ toro:
 		// only try again if we still need more lines
 		if (buf && !count_bytes && ds->lines < ds->count) {
 			ds->addr += ds->index;
-			r_io_read_at (core->io, ds->addr, buf, len);
+			ds->buf = buf = ds_read_at (ds, ds->addr, nbuf, len);
 
 			goto toro;
 		}
@@ -322,6 +322,15 @@ static bool r_core_project_load(RCore *core, const char *prj_name, const char *r
 	}
 	char *prj_path = r_file_dirname(rcpath);
 	if (prj_path) {
+		// same location used by r_core_project_save
+		char *db_path = r_str_endswith (rcpath, R_SYS_DIR "rc.r2")
+			? r_str_newf ("%s" R_SYS_DIR "anal.r2db", prj_path)
+			: r_str_newf ("%s.d" R_SYS_DIR "anal.r2db", rcpath);
+		// the other ranges are loaded when they are needed
+		if (r_file_exists (db_path) && !r_core_project_db_open (core, db_path)) {
+			R_LOG_WARN ("Cannot load the analysis snapshot from '%s'", db_path);
+		}
+		free (db_path);
 		//check if the project uses git
 		Rvc *vc = rvc_open (prj_path, RVC_TYPE_GIT);
 		core->prj->rvc = vc;
@@ -650,6 +659,8 @@ R_API bool r_core_project_save(RCore *core, const char *prj_name) {
 		R_LOG_ERROR ("radare2 does not support projects on debugged bins");
 		return false;
 	}
+	// the snapshot ranges that were not loaded yet must be saved too
+	r_core_project_db_fill (core, 0, UT64_MAX);
 	char *script_path = get_project_script_path (core, prj_name);
 	if (!script_path) {
 		R_LOG_ERROR ("Invalid project name '%s'", prj_name);
@@ -693,10 +704,29 @@ R_API bool r_core_project_save(RCore *core, const char *prj_name) {
 	}
 
 	r_config_set (core->config, "prj.name", prj_name);
-	if (!r_core_project_save_script (core, script_path, R_CORE_PRJ_ALL)) {
+	const bool use_db = r_config_get_b (core->config, "prj.db");
+	int opts = R_CORE_PRJ_ALL;
+	if (use_db) {
+		// these are stored in the binary snapshot instead
+		opts &= ~(R_CORE_PRJ_FLAGS | R_CORE_PRJ_META | R_CORE_PRJ_XREFS | R_CORE_PRJ_FCNS
+			| R_CORE_PRJ_ANAL_HINTS | R_CORE_PRJ_ANAL_TYPES);
+	}
+	if (!r_core_project_save_script (core, script_path, opts)) {
 		R_LOG_ERROR ("Cannot open '%s' for writing", prj_name);
 		ret = false;
 		r_config_set (core->config, "prj.name", "");
+	} else {
+		char *db_path = r_str_newf ("%s" R_SYS_DIR "anal.r2db", prj_dir);
+		if (use_db) {
+			if (!r_core_project_db_save (core, db_path)) {
+				R_LOG_ERROR ("Cannot save the analysis snapshot in '%s'", db_path);
+				ret = false;
+			}
+		} else if (r_file_exists (db_path)) {
+			// the script has all the analysis now, a stale snapshot would be loaded over it
+			r_file_rm (db_path);
+		}
+		free (db_path);
 	}
 
 	if (r_config_get_b (core->config, "prj.files")) {
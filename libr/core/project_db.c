@@ -0,0 +1,1105 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+#include <r_core.h>
+
+// Binary analysis snapshots
+//
+// The analysis is stored as a list of chunks, every chunk holds the records
+// of one kind (functions, references, flags, ..) whose address falls in the
+// same 64K window. The index at the end of the file tells the address range
+// of each chunk, so a range can be loaded without parsing the rest. Saving
+// again only appends the chunks whose contents changed and then rewrites the
+// index and the header, which is written last so an interrupted save keeps
+// the previous snapshot. All the numbers are little endian.
+//
+// Opening a project only loads the chunks that are not bound to an address
+// and the window at the current seek, the rest is kept in core->prj->db and
+// loaded by r_core_project_db_fill when a seek reaches it or before saving.
+//
+//   header: "R2DB" ut32 version, ut64 index offset, ut32 chunks, ut32 pad, ut64 pad
+//   index:  { ut32 kind, ut32 count, ut64 from, ut64 to, ut64 off, ut64 size, ut64 hash }
+
+#define PRJDB_MAGIC "R2DB"
+#define PRJDB_VERSION 1
+#define PRJDB_HEADER 32
+#define PRJDB_ENTRY 48
+#define PRJDB_WINDOW 16
+#define PRJDB_WINDOW_MASK ((1ULL << PRJDB_WINDOW) - 1)
+
+enum {
+	PRJDB_FCNS = 1,
+	PRJDB_XREFS,
+	PRJDB_FLAGS,
+	PRJDB_META,
+	PRJDB_HINTS,
+	PRJDB_TYPES,
+	PRJDB_LAST
+};
+
+// hints that are not stored as address hint records
+#define PRJDB_HINT_ARCH 0x100
+#define PRJDB_HINT_BITS 0x101
+
+static const char *kinds[PRJDB_LAST] = {
+	"", "functions", "xrefs", "flags", "meta", "hints", "types"
+};
+
+typedef struct {
+	ut32 kind;
+	ut32 count;
+	ut64 from;
+	ut64 to;
+	ut64 off;
+	ut64 size;
+	ut64 hash;
+} PrjdbChunk;
+
+// chunks of the opened project snapshot that are still on disk
+typedef struct r_core_prjdb_t {
+	char *file;
+	ut64 at; // index offset, to notice when the file is saved by someone else
+	ut64 window; // last window filled, UT64_MAX if none
+	RVector chunks; // PrjdbChunk
+} PrjdbPending;
+
+typedef struct {
+	ut64 key;
+	ut64 aux;
+	const void *ptr;
+	const char *str;
+} PrjdbRec;
+
+typedef struct {
+	RCore *core;
+	RBuffer *file;
+	HtUP *old; // (kind, window) => PrjdbChunk * of the previous save
+	RVector chunks; // PrjdbChunk
+	ut64 end;
+	ut64 written;
+} PrjdbSave;
+
+typedef struct {
+	const ut8 *p;
+	const ut8 *end;
+	bool err;
+} PrjdbCursor;
+
+typedef void (*PrjdbPut)(PrjdbSave *s, RBuffer *b, PrjdbRec *rec);
+
+static ut64 hash_bytes(const ut8 *buf, ut64 len) {
+	ut64 h = 0xcbf29ce484222325ULL;
+	ut64 i;
+	for (i = 0; i < len; i++) {
+		h = (h ^ buf[i]) * 0x100000001b3ULL;
+	}
+	return h;
+}
+
+static inline ut64 chunk_key(ut32 kind, ut64 addr) {
+	return ((ut64)kind << 56) | ((addr >> PRJDB_WINDOW) & 0xffffffffffffULL);
+}
+
+static void put8(RBuffer *b, ut8 v) {
+	r_buf_append_bytes (b, &v, 1);
+}
+
+static void put32(RBuffer *b, ut32 v) {
+	ut8 tmp[4];
+	r_write_le32 (tmp, v);
+	r_buf_append_bytes (b, tmp, sizeof (tmp));
+}
+
+static void put64(RBuffer *b, ut64 v) {
+	ut8 tmp[8];
+	r_write_le64 (tmp, v);
+	r_buf_append_bytes (b, tmp, sizeof (tmp));
+}
+
+static void putstr(RBuffer *b, const char *s) {
+	if (!s) {
+		put32 (b, UT32_MAX);
+		return;
+	}
+	const size_t len = strlen (s);
+	put32 (b, len);
+	r_buf_append_bytes (b, (const ut8 *)s, len);
+}
+
+static ut8 get8(PrjdbCursor *c) {
+	if (c->err || c->p + 1 > c->end) {
+		c->err = true;
+		return 0;
+	}
+	return *c->p++;
+}
+
+static ut32 get32(PrjdbCursor *c) {
+	if (c->err || c->p + 4 > c->end) {
+		c->err = true;
+		return 0;
+	}
+	ut32 v = r_read_le32 (c->p);
+	c->p += 4;
+	return v;
+}
+
+static ut64 get64(PrjdbCursor *c) {
+	if (c->err || c->p + 8 > c->end) {
+		c->err = true;
+		return 0;
+	}
+	ut64 v = r_read_le64 (c->p);
+	c->p += 8;
+	return v;
+}
+
+static char *getstr(PrjdbCursor *c) {
+	const ut32 len = get32 (c);
+	if (c->err || len == UT32_MAX) {
+		return NULL;
+	}
+	if (len > c->end - c->p) {
+		c->err = true;
+		return NULL;
+	}
+	char *s = r_str_ndup ((const char *)c->p, len);
+	c->p += len;
+	return s;
+}
+
+static int rec_cmp(const void *a, const void *b) {
+	const PrjdbRec *ra = a, *rb = b;
+	if (ra->key != rb->key) {
+		return (ra->key < rb->key)? -1: 1;
+	}
+	if (ra->aux != rb->aux) {
+		return (ra->aux < rb->aux)? -1: 1;
+	}
+	if (ra->str && rb->str) {
+		return strcmp (ra->str, rb->str);
+	}
+	return 0;
+}
+
+static void rec_push(RVector *v, ut64 key, ut64 aux, const void *ptr, const char *str) {
+	PrjdbRec rec = { key, aux, ptr, str };
+	r_vector_push (v, &rec);
+}
+
+static bool chunk_flush(PrjdbSave *s, ut32 kind, ut64 from, ut64 to, ut32 count, RBuffer *b) {
+	ut64 size = 0;
+	const ut8 *data = r_buf_data (b, &size);
+	PrjdbChunk c = { kind, count, from, to, 0, size, hash_bytes (data, size) };
+	PrjdbChunk *prev = s->old? ht_up_find (s->old, chunk_key (kind, from), NULL): NULL;
+	if (prev && prev->hash == c.hash && prev->size == c.size && prev->count == c.count) {
+		c.off = prev->off;
+	} else {
+		c.off = s->end;
+		if (r_buf_write_at (s->file, c.off, data, size) != size) {
+			return false;
+		}
+		s->end += size;
+		s->written += size;
+	}
+	r_vector_push (&s->chunks, &c);
+	return true;
+}
+
+static bool emit(PrjdbSave *s, ut32 kind, RVector *recs, PrjdbPut put) {
+	if (r_vector_length (recs) > 1) {
+		qsort (recs->a, r_vector_length (recs), sizeof (PrjdbRec), rec_cmp);
+	}
+	RBuffer *b = NULL;
+	ut64 from = 0, to = 0;
+	ut32 count = 0;
+	bool ok = true;
+	PrjdbRec *rec;
+	r_vector_foreach (recs, rec) {
+		if (b && (rec->key >> PRJDB_WINDOW) != (from >> PRJDB_WINDOW)) {
+			ok &= chunk_flush (s, kind, from, to, count, b);
+			r_buf_free (b);
+			b = NULL;
+		}
+		if (!b) {
+			b = r_buf_new ();
+			from = rec->key;
+			count = 0;
+		}
+		put (s, b, rec);
+		to = rec->key;
+		count++;
+	}
+	if (b) {
+		if (kind == PRJDB_TYPES) {
+			// not bound to any address, always loaded
+			from = 0;
+			to = UT64_MAX;
+		}
+		ok &= chunk_flush (s, kind, from, to, count, b);
+		r_buf_free (b);
+	}
+	return ok;
+}
+
+static bool label_cb(void *user, const ut64 addr, const void *name) {
+	rec_push (user, addr, 0, NULL, name);
+	return true;
+}
+
+static void put_fcn(PrjdbSave *s, RBuffer *b, PrjdbRec *rec) {
+	RAnalFunction *fcn = (RAnalFunction *)rec->ptr;
+	put64 (b, fcn->addr);
+	putstr (b, fcn->name);
+	put32 (b, fcn->type);
+	put32 (b, fcn->bits);
+	putstr (b, fcn->cc);
+	put64 (b, fcn->stack);
+	put32 (b, fcn->maxstack);
+	put64 (b, fcn->bp_off);
+	put64 (b, fcn->reg_save_area);
+	put32 (b, fcn->ninstr);
+	put8 (b, fcn->is_noreturn | (fcn->is_pure << 1) | (fcn->folded << 2)
+		| (fcn->bp_frame << 3) | (fcn->is_variadic << 4));
+	put8 (b, fcn->diff? fcn->diff->type: 0);
+	put32 (b, r_list_length (fcn->bbs));
+	RListIter *iter;
+	RAnalBlock *bb;
+	r_list_foreach (fcn->bbs, iter, bb) {
+		put64 (b, bb->addr);
+		put64 (b, bb->size);
+		put64 (b, bb->jump);
+		put64 (b, bb->fail);
+		put32 (b, bb->ninstr);
+		put32 (b, bb->stackptr);
+		put32 (b, bb->parent_stackptr);
+		const int npos = (bb->op_pos && bb->ninstr > 1)? R_MIN (bb->ninstr - 1, bb->op_pos_size): 0;
+		put32 (b, npos);
+		int i;
+		for (i = 0; i < npos; i++) {
+			put32 (b, bb->op_pos[i]);
+		}
+	}
+	put32 (b, r_pvector_length (&fcn->vars));
+	void **it;
+	r_pvector_foreach (&fcn->vars, it) {
+		RAnalVar *var = *it;
+		putstr (b, var->name);
+		putstr (b, var->type);
+		put8 (b, var->kind);
+		put8 (b, var->isarg);
+		put32 (b, var->delta);
+		putstr (b, var->comment);
+	}
+	RVector labels;
+	r_vector_init (&labels, sizeof (PrjdbRec), NULL, NULL);
+	if (fcn->labels) {
+		ht_up_foreach (fcn->labels, label_cb, &labels);
+		qsort (labels.a, r_vector_length (&labels), sizeof (PrjdbRec), rec_cmp);
+	}
+	put32 (b, r_vector_length (&labels));
+	PrjdbRec *label;
+	r_vector_foreach (&labels, label) {
+		put64 (b, label->key);
+		putstr (b, label->str);
+	}
+	r_vector_fini (&labels);
+}
+
+static bool xref_cb(void *user, const RAnalRef *ref) {
+	RBuffer *b = user;
+	put64 (b, ref->at);
+	put64 (b, ref->addr);
+	put32 (b, ref->type);
+	return true;
+}
+
+static void put_flag(PrjdbSave *s, RBuffer *b, PrjdbRec *rec) {
+	RFlagItem *fi = (RFlagItem *)rec->ptr;
+	put64 (b, fi->offset);
+	put64 (b, fi->size);
+	putstr (b, fi->name);
+	putstr (b, (fi->realname && strcmp (fi->realname, fi->name))? fi->realname: NULL);
+	putstr (b, fi->space? fi->space->name: NULL);
+	putstr (b, fi->comment);
+	putstr (b, fi->alias);
+	putstr (b, fi->color);
+	putstr (b, fi->type);
+}
+
+static bool flag_cb(RFlagItem *fi, void *user) {
+	rec_push (user, fi->offset, 0, fi, fi->name);
+	return true;
+}
+
+static void put_meta(PrjdbSave *s, RBuffer *b, PrjdbRec *rec) {
+	const RIntervalNode *node = rec->ptr;
+	const RAnalMetaItem *mi = node->data;
+	put64 (b, node->start);
+	put64 (b, r_meta_node_size ((RIntervalNode *)node));
+	put32 (b, mi->type);
+	put32 (b, mi->subtype);
+	putstr (b, mi->str);
+	putstr (b, mi->space? mi->space->name: NULL);
+}
+
+static void put_hint(PrjdbSave *s, RBuffer *b, PrjdbRec *rec) {
+	put64 (b, rec->key);
+	put32 (b, rec->aux);
+	if (rec->aux >= PRJDB_HINT_ARCH) {
+		put64 (b, (ut64)(size_t)rec->ptr);
+		putstr (b, rec->str);
+		return;
+	}
+	const RAnalAddrHintRecord *r = rec->ptr;
+	ut64 num = 0;
+	const char *str = NULL;
+	switch (r->type) {
+	case R_ANAL_ADDR_HINT_TYPE_IMMBASE: num = r->immbase; break;
+	case R_ANAL_ADDR_HINT_TYPE_JUMP: num = r->jump; break;
+	case R_ANAL_ADDR_HINT_TYPE_FAIL: num = r->fail; break;
+	case R_ANAL_ADDR_HINT_TYPE_STACKFRAME: num = r->stackframe; break;
+	case R_ANAL_ADDR_HINT_TYPE_PTR: num = r->ptr; break;
+	case R_ANAL_ADDR_HINT_TYPE_NWORD: num = r->nword; break;
+	case R_ANAL_ADDR_HINT_TYPE_RET: num = r->retval; break;
+	case R_ANAL_ADDR_HINT_TYPE_NEW_BITS: num = r->newbits; break;
+	case R_ANAL_ADDR_HINT_TYPE_SIZE: num = r->size; break;
+	case R_ANAL_ADDR_HINT_TYPE_OPTYPE: num = r->optype; break;
+	case R_ANAL_ADDR_HINT_TYPE_VAL: num = r->val; break;
+	case R_ANAL_ADDR_HINT_TYPE_SYNTAX: str = r->syntax; break;
+	case R_ANAL_ADDR_HINT_TYPE_OPCODE: str = r->opcode; break;
+	case R_ANAL_ADDR_HINT_TYPE_TYPE_OFFSET: str = r->type_offset; break;
+	case R_ANAL_ADDR_HINT_TYPE_ESIL: str = r->esil; break;
+	case R_ANAL_ADDR_HINT_TYPE_HIGH: break;
+	}
+	put64 (b, num);
+	putstr (b, str);
+}
+
+static bool addr_hints_cb(ut64 addr, const RVector *records, void *user) {
+	const RAnalAddrHintRecord *r;
+	r_vector_foreach (records, r) {
+		rec_push (user, addr, r->type, r, NULL);
+	}
+	return true;
+}
+
+static bool arch_hints_cb(ut64 addr, const char *arch, void *user) {
+	rec_push (user, addr, PRJDB_HINT_ARCH, NULL, arch);
+	return true;
+}
+
+static bool bits_hints_cb(ut64 addr, int bits, void *user) {
+	rec_push (user, addr, PRJDB_HINT_BITS, (void *)(size_t)bits, NULL);
+	return true;
+}
+
+static void put_type(PrjdbSave *s, RBuffer *b, PrjdbRec *rec) {
+	const SdbKv *kv = rec->ptr;
+	putstr (b, sdbkv_key (kv));
+	putstr (b, sdbkv_value (kv));
+}
+
+static bool save_xrefs(PrjdbSave *s) {
+	// the references are already sorted by source, collect them per window
+	RList *refs = r_anal_refs_get (s->core->anal, UT64_MAX);
+	if (!refs) {
+		return true;
+	}
+	RBuffer *b = NULL;
+	ut64 from = 0, to = 0;
+	ut32 count = 0;
+	bool ok = true;
+	RListIter *iter;
+	RAnalRef *ref;
+	r_list_foreach (refs, iter, ref) {
+		if (b && (ref->at >> PRJDB_WINDOW) != (from >> PRJDB_WINDOW)) {
+			ok &= chunk_flush (s, PRJDB_XREFS, from, to, count, b);
+			r_buf_free (b);
+			b = NULL;
+		}
+		if (!b) {
+			b = r_buf_new ();
+			from = ref->at;
+			count = 0;
+		}
+		xref_cb (b, ref);
+		to = ref->at;
+		count++;
+	}
+	if (b) {
+		ok &= chunk_flush (s, PRJDB_XREFS, from, to, count, b);
+		r_buf_free (b);
+	}
+	r_list_free (refs);
+	return ok;
+}
+
+static bool save_all(PrjdbSave *s) {
+	RCore *core = s->core;
+	RAnal *anal = core->anal;
+	RVector recs;
+	r_vector_init (&recs, sizeof (PrjdbRec), NULL, NULL);
+	bool ok = true;
+
+	RListIter *iter;
+	RAnalFunction *fcn;
+	r_list_foreach (anal->fcns, iter, fcn) {
+		rec_push (&recs, fcn->addr, 0, fcn, NULL);
+	}
+	ok &= emit (s, PRJDB_FCNS, &recs, put_fcn);
+	r_vector_clear (&recs);
+
+	ok &= save_xrefs (s);
+
+	r_flag_foreach (core->flags, flag_cb, &recs);
+	ok &= emit (s, PRJDB_FLAGS, &recs, put_flag);
+	r_vector_clear (&recs);
+
+	RIntervalTreeIter it;
+	RAnalMetaItem *mi;
+	r_interval_tree_foreach (&anal->meta, it, mi) {
+		RIntervalNode *node = r_interval_tree_iter_get (&it);
+		rec_push (&recs, node->start, mi->type, node, mi->str);
+	}
+	ok &= emit (s, PRJDB_META, &recs, put_meta);
+	r_vector_clear (&recs);
+
+	r_anal_addr_hints_foreach (anal, addr_hints_cb, &recs);
+	r_anal_arch_hints_foreach (anal, arch_hints_cb, &recs);
+	r_anal_bits_hints_foreach (anal, bits_hints_cb, &recs);
+	ok &= emit (s, PRJDB_HINTS, &recs, put_hint);
+	r_vector_clear (&recs);
+
+	SdbList *types = sdb_foreach_list (anal->sdb_types, true);
+	if (types) {
+		SdbListIter *sit;
+		SdbKv *kv;
+		ls_foreach (types, sit, kv) {
+			rec_push (&recs, 0, 0, kv, sdbkv_key (kv));
+		}
+		ok &= emit (s, PRJDB_TYPES, &recs, put_type);
+		ls_free (types);
+	}
+	r_vector_fini (&recs);
+	return ok;
+}
+
+static bool write_index(RBuffer *file, ut64 at, RVector *chunks) {
+	RBuffer *b = r_buf_new ();
+	PrjdbChunk *c;
+	r_vector_foreach (chunks, c) {
+		put32 (b, c->kind);
+		put32 (b, c->count);
+		put64 (b, c->from);
+		put64 (b, c->to);
+		put64 (b, c->off);
+		put64 (b, c->size);
+		put64 (b, c->hash);
+	}
+	ut64 size = 0;
+	const ut8 *data = r_buf_data (b, &size);
+	bool ok = r_buf_write_at (file, at, data, size) == size;
+	r_buf_free (b);
+	if (!ok) {
+		return false;
+	}
+	ut8 hdr[PRJDB_HEADER] = {0};
+	memcpy (hdr, PRJDB_MAGIC, 4);
+	r_write_le32 (hdr + 4, PRJDB_VERSION);
+	r_write_le64 (hdr + 8, at);
+	r_write_le32 (hdr + 16, r_vector_length (chunks));
+	return r_buf_write_at (file, 0, hdr, sizeof (hdr)) == sizeof (hdr);
+}
+
+// check the header and return the position and number of index entries
+static bool parse_header(const ut8 *hdr, ut64 len, ut64 *at, ut32 *count) {
+	if (len < PRJDB_HEADER || memcmp (hdr, PRJDB_MAGIC, 4) || r_read_le32 (hdr + 4) != PRJDB_VERSION) {
+		return false;
+	}
+	*at = r_read_le64 (hdr + 8);
+	*count = r_read_le32 (hdr + 16);
+	return *at <= len && (ut64)*count * PRJDB_ENTRY <= len - *at;
+}
+
+static bool parse_index(const ut8 *buf, ut32 count, ut64 len, RVector *chunks) {
+	PrjdbCursor c = { buf, buf + (ut64)count * PRJDB_ENTRY, false };
+	ut32 i;
+	for (i = 0; i < count; i++) {
+		PrjdbChunk chunk;
+		chunk.kind = get32 (&c);
+		chunk.count = get32 (&c);
+		chunk.from = get64 (&c);
+		chunk.to = get64 (&c);
+		chunk.off = get64 (&c);
+		chunk.size = get64 (&c);
+		chunk.hash = get64 (&c);
+		if (c.err || chunk.off > len || chunk.size > len - chunk.off) {
+			return false;
+		}
+		r_vector_push (chunks, &chunk);
+	}
+	return true;
+}
+
+static bool mmap_index(RMmap *m, RVector *chunks, ut64 *at) {
+	ut32 count;
+	return m && m->buf && m->len > 0
+		&& parse_header (m->buf, m->len, at, &count)
+		&& parse_index (m->buf + *at, count, m->len, chunks);
+}
+
+// only the header and the index are read, the chunks are reused in place
+static RVector *read_index(RBuffer *file) {
+	const ut64 len = r_buf_size (file);
+	ut8 hdr[PRJDB_HEADER];
+	ut64 at;
+	ut32 count;
+	if (r_buf_read_at (file, 0, hdr, sizeof (hdr)) != sizeof (hdr)
+			|| !parse_header (hdr, len, &at, &count)) {
+		return NULL;
+	}
+	const ut64 size = (ut64)count * PRJDB_ENTRY;
+	ut8 *buf = malloc (size + 1);
+	RVector *chunks = r_vector_new (sizeof (PrjdbChunk), NULL, NULL);
+	if (!buf || !chunks || r_buf_read_at (file, at, buf, size) != size
+			|| !parse_index (buf, count, len, chunks)) {
+		r_vector_free (chunks);
+		chunks = NULL;
+	}
+	free (buf);
+	return chunks;
+}
+
+// rewrite the file with the live chunks only
+static bool compact(PrjdbSave *s, const char *file) {
+	char *tmp = r_str_newf ("%s.tmp", file);
+	r_file_rm (tmp);
+	RBuffer *out = r_buf_new_file (tmp, O_RDWR | O_CREAT, 0644);
+	if (!out) {
+		free (tmp);
+		return false;
+	}
+	ut64 end = PRJDB_HEADER;
+	bool ok = true;
+	PrjdbChunk *c;
+	r_vector_foreach (&s->chunks, c) {
+		ut8 *data = malloc (c->size + 1);
+		if (!data || r_buf_read_at (s->file, c->off, data, c->size) != c->size
+				|| r_buf_write_at (out, end, data, c->size) != c->size) {
+			free (data);
+			ok = false;
+			break;
+		}
+		free (data);
+		c->off = end;
+		end += c->size;
+	}
+	ok = ok && write_index (out, end, &s->chunks);
+	r_buf_free (out);
+	if (ok) {
+		r_buf_free (s->file);
+		s->file = NULL;
+		ok = r_file_move (tmp, file);
+	} else {
+		r_file_rm (tmp);
+	}
+	free (tmp);
+	return ok;
+}
+
+R_API bool r_core_project_db_save(RCore *core, const char *file) {
+	r_return_val_if_fail (core && file, false);
+	// the chunks that were not loaded yet would be dropped from the snapshot
+	r_core_project_db_fill (core, 0, UT64_MAX);
+	PrjdbSave s = { .core = core };
+	r_vector_init (&s.chunks, sizeof (PrjdbChunk), NULL, NULL);
+	RVector *old = NULL;
+	if (r_file_exists (file)) {
+		s.file = r_buf_new_file (file, O_RDWR, 0644);
+		old = s.file? read_index (s.file): NULL;
+		if (!old) {
+			R_LOG_WARN ("Rewriting the invalid snapshot in %s", file);
+			r_buf_free (s.file);
+			s.file = NULL;
+			r_file_rm (file);
+		}
+	}
+	if (!s.file) {
+		s.file = r_buf_new_file (file, O_RDWR | O_CREAT, 0644);
+		if (!s.file) {
+			R_LOG_ERROR ("Cannot open %s for writing", file);
+			return false;
+		}
+		ut8 hdr[PRJDB_HEADER] = {0};
+		r_buf_write_at (s.file, 0, hdr, sizeof (hdr));
+	}
+	s.end = r_buf_size (s.file);
+	if (old) {
+		s.old = ht_up_new0 ();
+		PrjdbChunk *c;
+		r_vector_foreach (old, c) {
+			ht_up_insert (s.old, chunk_key (c->kind, c->from), c);
+		}
+	}
+	bool ok = save_all (&s) && write_index (s.file, s.end, &s.chunks);
+	if (ok) {
+		ut64 live = PRJDB_HEADER + r_vector_length (&s.chunks) * PRJDB_ENTRY;
+		PrjdbChunk *c;
+		r_vector_foreach (&s.chunks, c) {
+			live += c->size;
+		}
+		const ut64 size = s.end + r_vector_length (&s.chunks) * PRJDB_ENTRY;
+		R_LOG_DEBUG ("Snapshot %s: %"PFMT64u" bytes written, %"PFMT64u" live of %"PFMT64u,
+			file, s.written, live, size);
+		if (size > live * 2 && size > 0x10000) {
+			ok = compact (&s, file);
+		}
+	} else {
+		R_LOG_ERROR ("Cannot write the snapshot to %s", file);
+	}
+	ht_up_free (s.old);
+	r_vector_free (old);
+	r_vector_fini (&s.chunks);
+	r_buf_free (s.file);
+	return ok;
+}
+
+static void load_fcn(RCore *core, PrjdbCursor *c) {
+	RAnal *anal = core->anal;
+	const ut64 addr = get64 (c);
+	char *name = getstr (c);
+	const int type = get32 (c);
+	const int bits = get32 (c);
+	char *cc = getstr (c);
+	const st64 stack = get64 (c);
+	const int maxstack = get32 (c);
+	const st64 bp_off = get64 (c);
+	const ut64 reg_save_area = get64 (c);
+	const int ninstr = get32 (c);
+	const ut8 flags = get8 (c);
+	const ut8 diff = get8 (c);
+	RAnalFunction *fcn = NULL;
+	// functions that exist already are kept, the record is skipped
+	if (!c->err && name && !r_anal_get_function_at (anal, addr)) {
+		fcn = r_anal_create_function (anal, name, addr, type, NULL);
+	}
+	if (fcn) {
+		fcn->bits = bits;
+		fcn->cc = cc? r_str_constpool_get (&anal->constpool, cc): NULL;
+		fcn->stack = stack;
+		fcn->maxstack = maxstack;
+		fcn->bp_off = bp_off;
+		fcn->reg_save_area = reg_save_area;
+		fcn->ninstr = ninstr;
+		fcn->is_noreturn = flags & 1;
+		fcn->is_pure = flags & 2;
+		fcn->folded = flags & 4;
+		fcn->bp_frame = flags & 8;
+		fcn->is_variadic = flags & 16;
+		if (fcn->diff) {
+			fcn->diff->type = diff;
+		}
+	}
+	free (name);
+	free (cc);
+	ut32 i, j, n = get32 (c);
+	for (i = 0; i < n && !c->err; i++) {
+		const ut64 bb_addr = get64 (c);
+		const ut64 bb_size = get64 (c);
+		const ut64 jump = get64 (c);
+		const ut64 fail = get64 (c);
+		const int bb_ninstr = get32 (c);
+		const int stackptr = get32 (c);
+		const int parent_stackptr = get32 (c);
+		const ut32 npos = get32 (c);
+		if (c->err || npos > (c->end - c->p) / 4) {
+			c->err = true;
+			break;
+		}
+		RAnalBlock *bb = NULL;
+		if (fcn && bb_size > 0) {
+			bb = r_anal_get_block_at (anal, bb_addr);
+			if (bb) {
+				r_anal_function_add_block (fcn, bb);
+			} else if ((bb = r_anal_create_block (anal, bb_addr, bb_size))) {
+				r_anal_function_add_block (fcn, bb);
+				r_anal_block_unref (bb);
+				bb->jump = jump;
+				bb->fail = fail;
+				bb->ninstr = bb_ninstr;
+				bb->stackptr = stackptr;
+				bb->parent_stackptr = parent_stackptr;
+				if (npos > 0) {
+					bb->op_pos = R_NEWS0 (ut16, npos);
+					bb->op_pos_size = bb->op_pos? npos: 0;
+				}
+			} else {
+				bb = NULL;
+			}
+		}
+		for (j = 0; j < npos; j++) {
+			const ut32 pos = get32 (c);
+			if (bb && bb->op_pos && j < bb->op_pos_size) {
+				bb->op_pos[j] = pos;
+			}
+		}
+	}
+	n = get32 (c);
+	for (i = 0; i < n && !c->err; i++) {
+		char *vname = getstr (c);
+		char *vtype = getstr (c);
+		const char kind = get8 (c);
+		const bool isarg = get8 (c);
+		const int delta = get32 (c);
+		char *comment = getstr (c);
+		if (fcn && vname && !c->err) {
+			RAnalVar *var = r_anal_function_set_var (fcn, delta, kind, vtype, 0, isarg, vname);
+			if (var && comment) {
+				free (var->comment);
+				var->comment = comment;
+				comment = NULL;
+			}
+		}
+		free (vname);
+		free (vtype);
+		free (comment);
+	}
+	n = get32 (c);
+	for (i = 0; i < n && !c->err; i++) {
+		const ut64 at = get64 (c);
+		char *label = getstr (c);
+		if (fcn && label) {
+			r_anal_function_set_label (fcn, label, at);
+		}
+		free (label);
+	}
+}
+
+static void load_xref(RCore *core, PrjdbCursor *c) {
+	const ut64 from = get64 (c);
+	const ut64 to = get64 (c);
+	const ut32 type = get32 (c);
+	if (!c->err) {
+		r_anal_xrefs_set (core->anal, from, to, type);
+	}
+}
+
+static void load_flag(RCore *core, PrjdbCursor *c) {
+	const ut64 addr = get64 (c);
+	const ut64 size = get64 (c);
+	char *name = getstr (c);
+	char *realname = getstr (c);
+	char *space = getstr (c);
+	char *comment = getstr (c);
+	char *alias = getstr (c);
+	char *color = getstr (c);
+	char *type = getstr (c);
+	if (name && !c->err) {
+		r_flag_space_push (core->flags, space);
+		RFlagItem *fi = r_flag_set (core->flags, name, addr, size);
+		r_flag_space_pop (core->flags);
+		if (fi) {
+			if (realname) {
+				r_flag_item_set_realname (fi, realname);
+			}
+			if (comment) {
+				r_flag_item_set_comment (fi, comment);
+			}
+			if (alias) {
+				r_flag_item_set_alias (fi, alias);
+			}
+			if (color) {
+				r_flag_item_set_color (fi, color);
+			}
+			if (type) {
+				free (fi->type);
+				fi->type = type;
+				type = NULL;
+			}
+		}
+	}
+	free (name);
+	free (realname);
+	free (space);
+	free (comment);
+	free (alias);
+	free (color);
+	free (type);
+}
+
+static void load_meta(RCore *core, PrjdbCursor *c) {
+	RAnal *anal = core->anal;
+	const ut64 addr = get64 (c);
+	const ut64 size = get64 (c);
+	const int type = get32 (c);
+	const int subtype = get32 (c);
+	char *str = getstr (c);
+	char *space = getstr (c);
+	if (!c->err) {
+		r_spaces_push (&anal->meta_spaces, space);
+		r_meta_set_with_subtype (anal, type, subtype, addr, size, str);
+		r_spaces_pop (&anal->meta_spaces);
+	}
+	free (str);
+	free (space);
+}
+
+static void load_hint(RCore *core, PrjdbCursor *c) {
+	RAnal *a = core->anal;
+	const ut64 addr = get64 (c);
+	const ut32 type = get32 (c);
+	const ut64 num = get64 (c);
+	char *str = getstr (c);
+	if (c->err) {
+		free (str);
+		return;
+	}
+	switch (type) {
+	case R_ANAL_ADDR_HINT_TYPE_IMMBASE: r_anal_hint_set_immbase (a, addr, (int)num); break;
+	case R_ANAL_ADDR_HINT_TYPE_JUMP: r_anal_hint_set_jump (a, addr, num); break;
+	case R_ANAL_ADDR_HINT_TYPE_FAIL: r_anal_hint_set_fail (a, addr, num); break;
+	case R_ANAL_ADDR_HINT_TYPE_STACKFRAME: r_anal_hint_set_stackframe (a, addr, num); break;
+	case R_ANAL_ADDR_HINT_TYPE_PTR: r_anal_hint_set_pointer (a, addr, num); break;
+	case R_ANAL_ADDR_HINT_TYPE_NWORD: r_anal_hint_set_nword (a, addr, (int)num); break;
+	case R_ANAL_ADDR_HINT_TYPE_RET: r_anal_hint_set_ret (a, addr, num); break;
+	case R_ANAL_ADDR_HINT_TYPE_NEW_BITS: r_anal_hint_set_newbits (a, addr, (int)num); break;
+	case R_ANAL_ADDR_HINT_TYPE_SIZE: r_anal_hint_set_size (a, addr, num); break;
+	case R_ANAL_ADDR_HINT_TYPE_OPTYPE: r_anal_hint_set_type (a, addr, (int)num); break;
+	case R_ANAL_ADDR_HINT_TYPE_VAL: r_anal_hint_set_val (a, addr, num); break;
+	case R_ANAL_ADDR_HINT_TYPE_HIGH: r_anal_hint_set_high (a, addr); break;
+	case R_ANAL_ADDR_HINT_TYPE_SYNTAX: r_anal_hint_set_syntax (a, addr, str); break;
+	case R_ANAL_ADDR_HINT_TYPE_OPCODE: r_anal_hint_set_opcode (a, addr, str); break;
+	case R_ANAL_ADDR_HINT_TYPE_TYPE_OFFSET: r_anal_hint_set_offset (a, addr, str); break;
+	case R_ANAL_ADDR_HINT_TYPE_ESIL: r_anal_hint_set_esil (a, addr, str); break;
+	case PRJDB_HINT_ARCH: r_anal_hint_set_arch (a, addr, str); break;
+	case PRJDB_HINT_BITS: r_anal_hint_set_bits (a, addr, (int)num); break;
+	}
+	free (str);
+}
+
+static void load_type(RCore *core, PrjdbCursor *c) {
+	char *k = getstr (c);
+	char *v = getstr (c);
+	if (k && v && !c->err) {
+		sdb_set (core->anal->sdb_types, k, v, 0);
+	}
+	free (k);
+	free (v);
+}
+
+static bool load_chunk(RCore *core, RMmap *m, PrjdbChunk *chunk, const char *file) {
+	PrjdbCursor c = { m->buf + chunk->off, m->buf + chunk->off + chunk->size, false };
+	ut32 i;
+	for (i = 0; i < chunk->count && !c.err; i++) {
+		switch (chunk->kind) {
+		case PRJDB_FCNS: load_fcn (core, &c); break;
+		case PRJDB_XREFS: load_xref (core, &c); break;
+		case PRJDB_FLAGS: load_flag (core, &c); break;
+		case PRJDB_META: load_meta (core, &c); break;
+		case PRJDB_HINTS: load_hint (core, &c); break;
+		case PRJDB_TYPES: load_type (core, &c); break;
+		default: c.err = true; break;
+		}
+	}
+	if (c.err) {
+		R_LOG_ERROR ("Corrupted %s chunk at 0x%08"PFMT64x" in %s",
+			(chunk->kind < PRJDB_LAST)? kinds[chunk->kind]: "unknown", chunk->from, file);
+		return false;
+	}
+	return true;
+}
+
+static RMmap *open_index(const char *file, RVector *chunks, ut64 *at) {
+	RMmap *m = r_file_mmap (file, false, 0);
+	if (!m || !m->buf) {
+		R_LOG_ERROR ("Cannot open %s", file);
+		r_file_mmap_free (m);
+		return NULL;
+	}
+	if (!mmap_index (m, chunks, at)) {
+		R_LOG_ERROR ("Invalid snapshot in %s", file);
+		r_file_mmap_free (m);
+		return NULL;
+	}
+	return m;
+}
+
+static void pending_free(PrjdbPending *db) {
+	if (db) {
+		r_vector_fini (&db->chunks);
+		free (db->file);
+		free (db);
+	}
+}
+
+R_IPI void r_core_project_db_free(PrjdbPending *db) {
+	pending_free (db);
+}
+
+// load the pending chunks that intersect [from, to] and forget about them
+static bool pending_load(RCore *core, ut64 from, ut64 to) {
+	PrjdbPending *db = core->prj->db;
+	bool found = false;
+	PrjdbChunk *chunk;
+	r_vector_foreach (&db->chunks, chunk) {
+		if (chunk->to >= from && chunk->from <= to) {
+			found = true;
+			break;
+		}
+	}
+	if (!found) {
+		return true;
+	}
+	RVector chunks;
+	r_vector_init (&chunks, sizeof (PrjdbChunk), NULL, NULL);
+	ut64 at = 0;
+	RMmap *m = open_index (db->file, &chunks, &at);
+	r_vector_fini (&chunks);
+	// detached while loading, nothing is filled twice if the loaders seek
+	core->prj->db = NULL;
+	bool ok = m && at == db->at;
+	if (m && !ok) {
+		R_LOG_WARN ("The snapshot in %s changed, the ranges not loaded yet are lost", db->file);
+	}
+	if (ok) {
+		size_t i, n = 0;
+		for (i = 0; i < r_vector_length (&db->chunks); i++) {
+			chunk = r_vector_at (&db->chunks, i);
+			if (chunk->to >= from && chunk->from <= to) {
+				ok &= load_chunk (core, m, chunk, db->file);
+			} else {
+				if (i != n) {
+					r_vector_assign_at (&db->chunks, n, chunk);
+				}
+				n++;
+			}
+		}
+		while (r_vector_length (&db->chunks) > n) {
+			r_vector_pop (&db->chunks, NULL);
+		}
+		R_LOG_DEBUG ("Loaded 0x%08"PFMT64x"-0x%08"PFMT64x" from %s, %d chunks left",
+			from, to, db->file, (int)n);
+	}
+	r_file_mmap_free (m);
+	if (m && at == db->at && !r_vector_empty (&db->chunks)) {
+		core->prj->db = db;
+	} else {
+		pending_free (db);
+	}
+	return ok;
+}
+
+// Load the records of the chunks that intersect [from, to], the types are
+// always loaded and the functions that already exist are not replaced
+R_API bool r_core_project_db_load(RCore *core, const char *file, ut64 from, ut64 to) {
+	r_return_val_if_fail (core && file && from <= to, false);
+	PrjdbPending *db = core->prj? core->prj->db: NULL;
+	if (db && !strcmp (db->file, file)) {
+		// the rest of the opened project was loaded already
+		return pending_load (core, from, to);
+	}
+	RVector chunks;
+	r_vector_init (&chunks, sizeof (PrjdbChunk), NULL, NULL);
+	ut64 at;
+	RMmap *m = open_index (file, &chunks, &at);
+	if (!m) {
+		r_vector_fini (&chunks);
+		return false;
+	}
+	bool ok = true;
+	PrjdbChunk *chunk;
+	r_vector_foreach (&chunks, chunk) {
+		if (chunk->to >= from && chunk->from <= to) {
+			ok &= load_chunk (core, m, chunk, file);
+		}
+	}
+	r_vector_fini (&chunks);
+	r_file_mmap_free (m);
+	return ok;
+}
+
+// Load the chunks that are not bound to an address and the window at the
+// current seek, the others are loaded by r_core_project_db_fill
+R_API bool r_core_project_db_open(RCore *core, const char *file) {
+	r_return_val_if_fail (core && core->prj && file, false);
+	pending_free (core->prj->db);
+	core->prj->db = NULL;
+	PrjdbPending *db = R_NEW0 (PrjdbPending);
+	if (!db) {
+		return false;
+	}
+	r_vector_init (&db->chunks, sizeof (PrjdbChunk), NULL, NULL);
+	RMmap *m = open_index (file, &db->chunks, &db->at);
+	if (!m) {
+		pending_free (db);
+		return false;
+	}
+	r_file_mmap_free (m);
+	db->file = strdup (file);
+	db->window = UT64_MAX;
+	core->prj->db = db;
+	const ut64 from = core->offset & ~PRJDB_WINDOW_MASK;
+	return pending_load (core, from, from | PRJDB_WINDOW_MASK);
+}
+
+// Load the chunks of the opened project snapshot in the windows touching
+// [from, to], called on every seek so the last window is remembered
+R_API bool r_core_project_db_fill(RCore *core, ut64 from, ut64 to) {
+	r_return_val_if_fail (core && from <= to, false);
+	PrjdbPending *db = core->prj? core->prj->db: NULL;
+	if (!db) {
+		return true;
+	}
+	from &= ~PRJDB_WINDOW_MASK;
+	to |= PRJDB_WINDOW_MASK;
+	const ut64 window = (to - from == PRJDB_WINDOW_MASK)? from: UT64_MAX;
+	if (window != UT64_MAX && window == db->window) {
+		return true;
+	}
+	db->window = window;
+	return pending_load (core, from, to);
+}
+
+R_API bool r_core_project_db_list(RCore *core, const char *file, int mode) {
+	r_return_val_if_fail (core && file, false);
+	RMmap *m = r_file_mmap (file, false, 0);
+	RVector chunks;
+	r_vector_init (&chunks, sizeof (PrjdbChunk), NULL, NULL);
+	ut64 at;
+	if (!mmap_index (m, &chunks, &at)) {
+		R_LOG_ERROR ("Invalid snapshot in %s", file);
+		r_vector_fini (&chunks);
+		r_file_mmap_free (m);
+		return false;
+	}
+	PJ *pj = (mode == 'j')? r_core_pj_new (core): NULL;
+	if (pj) {
+		pj_a (pj);
+	}
+	PrjdbChunk *c;
+	r_vector_foreach (&chunks, c) {
+		const char *kind = (c->kind < PRJDB_LAST)? kinds[c->kind]: "unknown";
+		if (pj) {
+			pj_o (pj);
+			pj_ks (pj, "kind", kind);
+			pj_kn (pj, "from", c->from);
+			pj_kn (pj, "to", c->to);
+			pj_kn (pj, "count", c->count);
+			pj_kn (pj, "offset", c->off);
+			pj_kn (pj, "size", c->size);
+			pj_end (pj);
+		} else {
+			r_cons_printf ("0x%08"PFMT64x" 0x%08"PFMT64x" %6d %8"PFMT64u" %8"PFMT64u" %s\n",
+				c->from, c->to, c->count, c->off, c->size, kind);
+		}
+	}
+	if (pj) {
+		pj_end (pj);
+		char *s = pj_drain (pj);
+		r_cons_println (s);
+		free (s);
+	}
+	r_vector_fini (&chunks);
+	r_file_mmap_free (m);
+	return true;
+}
@@ -1,4 +1,4 @@
-/* radare - LGPL - Copyright 2014-2022 - pancake, thestr4ng3r */
+/* radare - LGPL - Copyright 2014-2023 - pancake, thestr4ng3r */
 
 #include <r_core.h>
 
@@ -56,6 +56,207 @@ typedef struct oneshot_t {
 	void *user;
 } OneShot;
 
+// Concurrent tasks run on a private core built from a snapshot of the
+// foreground one, so they never touch the shared RCore, RIO or RCons state.
+// The opened files are reopened read-only and their bin info loaded again
+// from the task thread, the flags and the analysis travel in a binary
+// project snapshot (see project_db.c). Sessions with descriptors that are
+// not plain files can't be reopened, so their tasks run cooperatively.
+
+static const char *snap_skip[] = {
+	"cfg.debug", "cfg.sandbox", "dbg.", "dir.", "file.", "http.", "prj.", "scr.interactive", "tcp.", NULL
+};
+
+typedef struct {
+	int fd;
+	int newfd;
+	char *uri;
+	bool bin; // the foreground loaded the bin info for it
+	ut64 baddr;
+	ut64 laddr;
+} SnapDesc;
+
+typedef struct {
+	int fd;
+	int perm;
+	ut64 delta;
+	ut64 addr;
+	ut64 size;
+} SnapMap;
+
+typedef struct {
+	RList *config;
+	RVector descs;
+	RVector maps;
+	char *db; // flags and analysis
+	int fd;
+	ut64 offset;
+	int blocksize;
+	bool interactive;
+} TaskSnap;
+
+static void snap_desc_fini(void *e, void *user) {
+	SnapDesc *sd = e;
+	free (sd->uri);
+}
+
+static void snap_free(TaskSnap *snap) {
+	if (snap) {
+		r_list_free (snap->config);
+		r_vector_fini (&snap->descs);
+		r_vector_fini (&snap->maps);
+		if (snap->db) {
+			r_file_rm (snap->db);
+			free (snap->db);
+		}
+		free (snap);
+	}
+}
+
+static bool snap_skipped(const char *name) {
+	int i;
+	for (i = 0; snap_skip[i]; i++) {
+		if (r_str_startswith (name, snap_skip[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static SnapDesc *snap_desc(TaskSnap *snap, RCore *core, int fd) {
+	SnapDesc *sd;
+	r_vector_foreach (&snap->descs, sd) {
+		if (sd->fd == fd) {
+			return sd;
+		}
+	}
+	RIODesc *desc = r_io_desc_get (core->io, fd);
+	if (!desc || !(desc->perm & R_PERM_R) || !desc->uri || !r_file_exists (desc->uri)) {
+		return NULL;
+	}
+	SnapDesc d = { .fd = fd, .newfd = -1, .uri = strdup (desc->uri) };
+	RBinFile *bf = r_bin_file_find_by_fd (core->bin, fd);
+	if (bf) {
+		d.bin = true;
+		d.baddr = r_bin_file_get_baddr (bf);
+		d.laddr = bf->loadaddr;
+	}
+	return r_vector_push (&snap->descs, &d);
+}
+
+// called from the foreground, it must not keep any reference to the core
+static TaskSnap *snap_new(RCore *core) {
+	TaskSnap *snap = R_NEW0 (TaskSnap);
+	if (!snap) {
+		return NULL;
+	}
+	snap->config = r_list_newf (free);
+	r_vector_init (&snap->descs, sizeof (SnapDesc), snap_desc_fini, NULL);
+	r_vector_init (&snap->maps, sizeof (SnapMap), NULL, NULL);
+	RListIter *iter;
+	RConfigNode *node;
+	r_list_foreach (core->config->nodes, iter, node) {
+		if (!(node->flags & CN_RO) && !snap_skipped (node->name)) {
+			r_list_append (snap->config, r_str_newf ("%s=%s", node->name, r_str_get (node->value)));
+		}
+	}
+	RIO *io = core->io;
+	RIOBank *bank = r_io_bank_get (io, io->bank);
+	if (bank) {
+		RIOMapRef *mapref;
+		r_list_foreach (bank->maprefs, iter, mapref) {
+			RIOMap *map = r_io_map_get (io, mapref->id);
+			if (!map) {
+				continue;
+			}
+			if (!snap_desc (snap, core, map->fd)) {
+				R_LOG_DEBUG ("The fd %d is not a file that can be reopened", map->fd);
+				snap_free (snap);
+				return NULL;
+			}
+			SnapMap sm = {
+				.fd = map->fd,
+				.perm = map->perm & ~R_PERM_W,
+				.delta = map->delta,
+				.addr = r_io_map_begin (map),
+				.size = r_io_map_size (map)
+			};
+			r_vector_push (&snap->maps, &sm);
+		}
+	}
+	snap->fd = io->desc? io->desc->fd: -1;
+	if (snap->fd != -1 && !snap_desc (snap, core, snap->fd)) {
+		snap_free (snap);
+		return NULL;
+	}
+	snap->db = r_file_temp ("r2task");
+	if (!snap->db || !r_core_project_db_save (core, snap->db)) {
+		snap_free (snap);
+		return NULL;
+	}
+	snap->offset = core->offset;
+	snap->blocksize = core->blocksize;
+	snap->interactive = r_cons_default_context_is_interactive ();
+	return snap;
+}
+
+// called from the task thread on its own core
+static void snap_apply(TaskSnap *snap, RCore *core) {
+	RListIter *iter;
+	char *kv;
+	r_list_foreach (snap->config, iter, kv) {
+		char *v = strchr (kv, '=');
+		if (!v) {
+			continue;
+		}
+		*v = 0;
+		const char *cur = r_config_get (core->config, kv);
+		if (cur && strcmp (cur, v + 1)) {
+			r_config_set (core->config, kv, v + 1);
+		}
+		*v = '=';
+	}
+	r_config_set_b (core->config, "scr.interactive", false);
+	RIO *io = core->io;
+	SnapDesc *sd;
+	r_vector_foreach (&snap->descs, sd) {
+		RIODesc *desc = r_io_open_nomap (io, sd->uri, R_PERM_R, 0);
+		sd->newfd = desc? desc->fd: -1;
+		if (desc && sd->bin) {
+			RBinFileOptions opt;
+			r_bin_file_options_init (&opt, sd->newfd, sd->baddr, sd->laddr, core->bin->rawstr);
+			if (!r_bin_open_io (core->bin, &opt)) {
+				R_LOG_WARN ("Cannot load the bin info of %s in the task", sd->uri);
+			}
+		}
+	}
+	SnapMap *sm;
+	r_vector_foreach (&snap->maps, sm) {
+		r_vector_foreach (&snap->descs, sd) {
+			if (sd->fd == sm->fd) {
+				if (sd->newfd != -1) {
+					r_io_map_add (io, sd->newfd, sm->perm, sm->delta, sm->addr, sm->size);
+				}
+				break;
+			}
+		}
+	}
+	r_vector_foreach (&snap->descs, sd) {
+		if (sd->fd == snap->fd && sd->newfd != -1) {
+			r_io_use_fd (io, sd->newfd);
+			if (sd->bin) {
+				r_bin_file_set_cur_by_fd (core->bin, sd->newfd);
+			}
+			break;
+		}
+	}
+	if (!r_core_project_db_load (core, snap->db, 0, UT64_MAX)) {
+		R_LOG_WARN ("Cannot load the flags and analysis in the task");
+	}
+	r_core_block_size (core, snap->blocksize);
+	r_core_seek (core, snap->offset, true);
+}
+
 R_API void r_core_task_print(RCore *core, RCoreTask *task, PJ *pj, int mode) {
 	switch (mode) {
 	case 'j': {
@@ -77,6 +278,7 @@ R_API void r_core_task_print(RCore *core, RCoreTask *task, PJ *pj, int mode) {
 			break;
 		}
 		pj_kb (pj, "transient", task->transient);
+		pj_kb (pj, "concurrent", task->concurrent);
 		pj_ks (pj, "cmd", r_str_get_fail (task->cmd, "null"));
 		pj_end (pj);
 		break;
@@ -211,6 +413,7 @@ static void task_free(RCoreTask *task) {
 	r_th_sem_free (task->running_sem);
 	r_th_cond_free (task->dispatch_cond);
 	r_cons_context_free (task->cons_context);
+	snap_free (task->snapshot);
 	r_th_lock_leave (lock);
 	r_th_lock_free (lock); // task->dispatch_lock);
 	free (task);
@@ -482,10 +685,70 @@ static RThreadFunctionRet task_run_thread(RThread *th) {
 	return task_run (task);
 }
 
+static RThreadFunctionRet task_run_concurrent(RThread *th) {
+	RCoreTask *task = (RCoreTask *)th->user;
+	RCoreTaskScheduler *scheduler = &task->core->tasks;
+	TaskSnap *snap = task->snapshot;
+	char *res_str = NULL;
+	if (!task->cons_context->breaked) {
+		// the cons instance is thread local, so this core has its own
+		RCore *core = r_core_new ();
+		if (core) {
+			snap_apply (snap, core);
+			r_cons_context_load (task->cons_context);
+			if (!task->cons_context->breaked) {
+				res_str = r_core_cmd_str (core, task->cmd);
+			}
+			r_cons_context_reset ();
+			r_core_free (core);
+		}
+		if (snap->interactive) {
+			eprintf ("\nTask %d finished\n", task->id);
+		}
+	}
+
+	TASK_SIGSET_T old_sigset;
+	tasks_lock_enter (scheduler, &old_sigset);
+	free (task->res);
+	task->res = res_str;
+	task->state = R_CORE_TASK_STATE_DONE;
+	scheduler->readers--;
+	task->snapshot = NULL;
+	snap_free (snap);
+	if (task->cb) {
+		task->cb (task->user, task->res);
+	}
+	r_th_sem_post (task->running_sem);
+	if (task->cons_context->break_stack) {
+		r_cons_context_break_pop (task->cons_context, false);
+	}
+	int ret = R_TH_STOP;
+	if (task->transient) {
+		RCoreTask *ltask;
+		RListIter *iter;
+		r_list_foreach (scheduler->tasks, iter, ltask) {
+			if (ltask == task) {
+				r_list_delete (scheduler->tasks, iter);
+				ret = R_TH_FREED;
+				break;
+			}
+		}
+	}
+	tasks_lock_leave (scheduler, &old_sigset);
+	return ret;
+}
+
 R_API void r_core_task_enqueue(RCoreTaskScheduler *scheduler, RCoreTask *task) {
 	if (!scheduler || !task) {
 		return;
 	}
+	if (task->concurrent && !task->snapshot) {
+		task->snapshot = task->cons_context? snap_new (task->core): NULL;
+		if (!task->snapshot) {
+			R_LOG_WARN ("Cannot snapshot the core, running task %d cooperatively", task->id);
+			task->concurrent = false;
+		}
+	}
 	TASK_SIGSET_T old_sigset;
 	tasks_lock_enter (scheduler, &old_sigset);
 	if (!task->running_sem) {
@@ -498,9 +761,44 @@ R_API void r_core_task_enqueue(RCoreTaskScheduler *scheduler, RCoreTask *task) {
 		r_cons_context_break_push (task->cons_context, NULL, NULL, false);
 	}
 	r_list_append (scheduler->tasks, task);
-	task->thread = r_th_new (task_run_thread, task, 0);
+	if (task->concurrent) {
+		// it never takes part in the cooperative scheduling
+		scheduler->readers++;
+		task->state = R_CORE_TASK_STATE_RUNNING;
+		task->thread = r_th_new (task_run_concurrent, task, 0);
+	} else {
+		task->thread = r_th_new (task_run_thread, task, 0);
+	}
+
+	tasks_lock_leave (scheduler, &old_sigset);
+}
 
+// Wait until no concurrent task is reading the opened files, to be called
+// before writing to them. Returns false when interrupted by the user
+R_API bool r_core_task_wait_readers(RCoreTaskScheduler *scheduler) {
+	r_return_val_if_fail (scheduler, false);
+	TASK_SIGSET_T old_sigset;
+	tasks_lock_enter (scheduler, &old_sigset);
+	int readers = scheduler->readers;
 	tasks_lock_leave (scheduler, &old_sigset);
+	if (!readers) {
+		return true;
+	}
+	R_LOG_INFO ("Waiting for %d concurrent task(s) reading the file", readers);
+	bool ret = true;
+	r_cons_break_push (NULL, NULL);
+	while (readers > 0) {
+		if (r_cons_is_breaked ()) {
+			ret = false;
+			break;
+		}
+		r_sys_usleep (10000);
+		tasks_lock_enter (scheduler, &old_sigset);
+		readers = scheduler->readers;
+		tasks_lock_leave (scheduler, &old_sigset);
+	}
+	r_cons_break_pop ();
+	return ret;
 }
 
 R_API void r_core_task_enqueue_oneshot(RCoreTaskScheduler *scheduler, RCoreTaskOneShot func, void *user) {
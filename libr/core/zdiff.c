@@ -2,35 +2,39 @@
 
 #include <r_core.h>
 
-static bool matchBytes(RSignItem *a, RSignItem *b) {
-	if (a->bytes && b->bytes) {
-		if (a->bytes->size == b->bytes->size) {
-			return !memcmp (a->bytes->bytes, b->bytes->bytes, b->bytes->size);
-		}
-	}
-	return false;
+// zignatures of the second file by bytes and by graph, so each one of the
+// first file is only compared with the ones having the same key
+static void bucket_free(HtPPKv *kv) {
+	free (kv->key);
+	r_vector_free (kv->value);
 }
 
-static bool matchGraph(RSignItem *a, RSignItem *b) {
-	if (a->graph && b->graph) {
-		if (a->graph->cc != b->graph->cc) {
-			return false;
-		}
-		if (a->graph->nbbs != b->graph->nbbs) {
-			return false;
-		}
-		if (a->graph->ebbs != b->graph->ebbs) {
-			return false;
-		}
-		if (a->graph->edges != b->graph->edges) {
-			return false;
+static char *bytes_key(RSignItem *it) {
+	return (it->bytes && it->bytes->size > 0)? r_hex_bin2strdup (it->bytes->bytes, it->bytes->size): NULL;
+}
+
+static char *graph_key(RSignItem *it) {
+	RSignGraph *g = it->graph;
+	return g? r_str_newf ("%d %d %d %d %d", g->cc, g->nbbs, g->ebbs, g->edges, g->bbsum): NULL;
+}
+
+static void bucket_add(HtPP *ht, char *k, ut32 i) {
+	if (k) {
+		RVector *v = ht_pp_find (ht, k, NULL);
+		if (!v && (v = r_vector_new (sizeof (ut32), NULL, NULL))) {
+			ht_pp_insert (ht, k, v);
 		}
-		if (a->graph->bbsum!= b->graph->bbsum) {
-			return false;
+		if (v) {
+			r_vector_push (v, &i);
 		}
-		return true;
+		free (k);
 	}
-	return false;
+}
+
+static RVector *bucket_get(HtPP *ht, char *k) {
+	RVector *v = k? ht_pp_find (ht, k, NULL): NULL;
+	free (k);
+	return v;
 }
 
 static bool is_import(const char *name) {
@@ -48,7 +52,7 @@ R_API int r_core_zdiff(RCore *c, RCore *c2) {
 	eprintf ("Diff %d %d\n", (int)ls_length (a), (int)ls_length (b));
 	SdbListIter *iter;
 	SdbKv *kv;
-	RList *la = r_list_new ();
+	RList *la = r_list_newf ((RListFree)r_sign_item_free);
 	ls_foreach (a, iter, kv) {
 		RSignItem *it = r_sign_item_new ();
 		if (r_sign_deserialize (c->anal, it, kv->base.key, kv->base.value)) {
@@ -57,7 +61,7 @@ R_API int r_core_zdiff(RCore *c, RCore *c2) {
 			r_sign_item_free (it);
 		}
 	}
-	RList *lb = r_list_new ();
+	RList *lb = r_list_newf ((RListFree)r_sign_item_free);
 	ls_foreach (b, iter, kv) {
 		RSignItem *it = r_sign_item_new ();
 		if (r_sign_deserialize (c2->anal, it, kv->base.key, kv->base.value)) {
@@ -67,28 +71,54 @@ R_API int r_core_zdiff(RCore *c, RCore *c2) {
 		}
 	}
 	//////////
+	HtPP *bytes = ht_pp_new (NULL, bucket_free, NULL);
+	HtPP *graphs = ht_pp_new (NULL, bucket_free, NULL);
+	RPVector *items = r_pvector_new (NULL);
 	RListIter *itr;
-	RListIter *itr2;
 	RSignItem *si;
-	RSignItem *si2;
-
-	// do the sign diff here
-	r_list_foreach (la, itr, si) {
-		if (is_import (si->name)) {
-			continue;
-		}
-		r_list_foreach (lb, itr2, si2) {
-			if (is_import (si2->name)) {
+	if (bytes && graphs && items) {
+		r_list_foreach (lb, itr, si) {
+			if (is_import (si->name)) {
 				continue;
 			}
-			if (matchBytes (si, si2)) {
-				r_cons_printf ("0x%08"PFMT64x" 0x%08"PFMT64x" B %s\n", si->addr, si2->addr, si->name);
+			const ut32 i = r_pvector_length (items);
+			r_pvector_push (items, si);
+			bucket_add (bytes, bytes_key (si), i);
+			bucket_add (graphs, graph_key (si), i);
+		}
+		// do the sign diff here, in the order of the second list like a nested loop
+		r_list_foreach (la, itr, si) {
+			if (is_import (si->name)) {
+				continue;
 			}
-			if (matchGraph (si, si2)) {
-				r_cons_printf ("0x%08"PFMT64x" 0x%08"PFMT64x" G %s\n", si->addr, si2->addr, si->name);
+			RVector *vb = bucket_get (bytes, bytes_key (si));
+			RVector *vg = bucket_get (graphs, graph_key (si));
+			const size_t nb = vb? r_vector_length (vb): 0;
+			const size_t ng = vg? r_vector_length (vg): 0;
+			size_t b = 0, g = 0;
+			while (b < nb || g < ng) {
+				const ut32 ib = (b < nb)? *(ut32 *)r_vector_index_ptr (vb, b): UT32_MAX;
+				const ut32 ig = (g < ng)? *(ut32 *)r_vector_index_ptr (vg, g): UT32_MAX;
+				const ut32 i = R_MIN (ib, ig);
+				RSignItem *si2 = r_pvector_at (items, i);
+				if (ib == i) {
+					r_cons_printf ("0x%08"PFMT64x" 0x%08"PFMT64x" B %s\n", si->addr, si2->addr, si->name);
+					b++;
+				}
+				if (ig == i) {
+					r_cons_printf ("0x%08"PFMT64x" 0x%08"PFMT64x" G %s\n", si->addr, si2->addr, si->name);
+					g++;
+				}
 			}
 		}
 	}
+	ht_pp_free (bytes);
+	ht_pp_free (graphs);
+	r_pvector_free (items);
+	r_list_free (la);
+	r_list_free (lb);
+	ls_free (a);
+	ls_free (b);
 
 	/* Diff functions */
 	// r_anal_diff_fcn (cores[0]->anal, cores[0]->anal->fcns, cores[1]->anal->fcns);
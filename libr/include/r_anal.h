@@ -436,6 +436,18 @@ typedef struct r_anal_thread_t {
 	RReg *reg;
 } RAnalThread;
 
+typedef struct r_anal_prefetch_t RAnalPrefetch;
+typedef struct r_anal_opcache_t RAnalOpCache;
+typedef struct r_anal_xrefs_t RAnalXrefs;
+
+typedef struct r_anal_opcache_stats_t {
+	ut64 hits;
+	ut64 misses;
+	ut64 evictions;
+	int count; // cached instructions
+	int size; // anal.opcache
+} RAnalOpCacheStats;
+
 typedef struct r_anal_t {
 	RArchConfig *config;
 	int lineswidth; // asm.lines.width
@@ -473,8 +485,7 @@ typedef struct r_anal_t {
 	Sdb *sdb_types;
 	Sdb *sdb_fmts;
 	Sdb *sdb_zigns;
-	HtUP *dict_refs;
-	HtUP *dict_xrefs;
+	RAnalXrefs *xrefs; // see xrefs.c
 	RSpaces zign_spaces;
 	char *zign_path; // dir.zigns
 	PrintfCallback cb_printf;
@@ -517,6 +528,9 @@ typedef struct r_anal_t {
 	int thread; // see apt command
 	RList *threads;
 	RColor tracetagcolors[64]; // each trace color for each bit
+	RAnalPrefetch *prefetch; // instructions decoded ahead by anal.prefetch.threads
+	RAnalOpCache *opcache; // recently decoded instructions, see anal.opcache
+	RThreadPool *pool; // shared workers, set by the core (see cfg.threads)
 	/* end private */
 	R_DIRTY_VAR;
 } RAnal;
@@ -1051,6 +1065,17 @@ R_API RList *r_anal_op_list_new(void);
 R_API int r_anal_op(RAnal *anal, RAnalOp *op, ut64 addr, const ut8 *data, int len, RAnalOpMask mask);
 R_API int r_anal_opasm(RAnal *anal, ut64 pc, const char *s, ut8 *outbuf, int outlen);
 R_API char *r_anal_op_tostring(RAnal *anal, RAnalOp *op);
+R_API bool r_anal_opcache_setup(RAnal *anal, int size);
+R_API void r_anal_opcache_flush(RAnal *anal);
+R_API void r_anal_opcache_invalidate(RAnal *anal, ut64 addr, ut64 size);
+R_API bool r_anal_opcache_stats(RAnal *anal, RAnalOpCacheStats *stats);
+R_API void r_anal_opcache_reset_stats(RAnal *anal);
+
+/* prefetch.c */
+R_API bool r_anal_prefetch_supported(RAnal *anal);
+R_API int r_anal_prefetch(RAnal *anal, const ut64 *addrs, int count, int threads, bool calls);
+R_API void r_anal_prefetch_clear(RAnal *anal);
+R_API bool r_anal_prefetch_get(RAnal *anal, RAnalOp *op, ut64 addr, const ut8 *data, int len, RAnalOpMask mask);
 
 
 /* pin */
@@ -1113,6 +1138,7 @@ R_API const char *r_anal_pin_at(RAnal *a, ut64 addr);
 R_API bool r_anal_pin_set(RAnal *a, const char *name, const char *cmd);
 
 typedef bool (* RAnalRefCmp)(RAnalRef *ref, void *data);
+typedef bool (* RAnalRefCallback)(void *user, const RAnalRef *ref);
 R_API RList *r_anal_ref_list_new(void);
 R_API const char *r_anal_ref_type_tostring(RAnalRefType t);
 R_API ut64 r_anal_xrefs_count(RAnal *anal);
@@ -1126,6 +1152,8 @@ R_API RAnalRefType r_anal_xrefs_type_from_string(const char *s);
 R_API RList *r_anal_xrefs_get(RAnal *anal, ut64 to);
 R_API RList *r_anal_refs_get(RAnal *anal, ut64 to);
 R_API RList *r_anal_xrefs_get_from(RAnal *anal, ut64 from);
+R_API bool r_anal_xrefs_foreach(RAnal *anal, ut64 to, RAnalRefCallback cb, void *user);
+R_API bool r_anal_refs_foreach(RAnal *anal, ut64 from, RAnalRefCallback cb, void *user);
 R_API void r_anal_xrefs_list(RAnal *anal, int rad, const char *arg);
 R_API RList *r_anal_function_get_refs(RAnalFunction *fcn);
 R_API RList *r_anal_function_get_xrefs(RAnalFunction *fcn);
@@ -1196,6 +1224,7 @@ R_API char *r_anal_function_format_sig(R_NONNULL RAnal *anal, R_NONNULL RAnalFun
 
 /* project */
 R_API bool r_anal_xrefs_init(RAnal *anal);
+R_API void r_anal_xrefs_fini(RAnal *anal);
 
 #define R_ANAL_THRESHOLDFCN 0.7F
 #define R_ANAL_THRESHOLDBB 0.7F
@@ -170,6 +170,9 @@ typedef struct r_arch_plugin_t {
 	ut32 endian;
 	RSysBits bits;
 	RSysBits addr_bits;
+	// decode only touches the session data and the returned op does not point
+	// into it, so several sessions of this plugin can decode in parallel
+	bool threadsafe;
 
 	// R2_590 figure out a way to make init and decode const (better perf)
 	RArchPluginInitCallback init;
@@ -251,6 +251,21 @@ typedef struct r_bin_info_t {
 	char *charset;
 } RBinInfo;
 
+// items of an RBinObject that are computed on first use, see r_bin_object_load_item
+typedef enum {
+	R_BIN_ITEM_ENTRIES,
+	R_BIN_ITEM_FIELDS,
+	R_BIN_ITEM_IMPORTS,
+	R_BIN_ITEM_SYMBOLS,
+	R_BIN_ITEM_LIBS,
+	R_BIN_ITEM_RELOCS,
+	R_BIN_ITEM_STRINGS,
+	R_BIN_ITEM_CLASSES,
+	R_BIN_ITEM_LINES,
+	R_BIN_ITEM_LANG,
+	R_BIN_ITEM_LAST
+} RBinItem;
+
 typedef struct r_bin_object_t {
 	ut64 baddr;
 	st64 baddr_shift;
@@ -282,8 +297,23 @@ typedef struct r_bin_object_t {
 	HtUP *addr2klassmethod;
 	void *bin_obj; // internal pointer used by formats
 	bool is_reloc_patched; // used to indicate whether relocations were patched or not
+	ut32 loaded; // bitmask of the RBinItem already computed
+	ut64 load_time[R_BIN_ITEM_LAST]; // microseconds spent computing each item
+	RThreadLock *lock;
 } RBinObject;
 
+typedef struct r_bin_addrline_t {
+	ut64 addr;
+	const char *file; // owned by the store
+	ut32 line; // R_BIN_ADDRLINE_TEXT when file holds a free text note
+	ut32 column;
+} RBinAddrline;
+
+#define R_BIN_ADDRLINE_TEXT UT32_MAX
+
+typedef bool (*RBinAddrlineCallback)(void *user, const RBinAddrline *row);
+typedef struct r_bin_addrline_store_t RBinAddrLineStore;
+
 // XXX: RbinFile may hold more than one RBinObject
 /// XX curplugin == o->plugin
 typedef struct r_bin_file_t {
@@ -308,7 +338,13 @@ typedef struct r_bin_file_t {
 	Sdb *sdb;
 // #warning RBinFile.sdb_info will be removed in r2-5.7.0
 	Sdb *sdb_info;
-	Sdb *sdb_addrinfo;
+	Sdb *sdb_addrinfo; // compilation directories of the dwarf units
+	RBinAddrLineStore *addrline; // source line of each address
+	RBinDwarfCuIndex *dwarf_index; // dwarf units decoded on demand (bin.dbginfo.lazy)
+	HtPP *demangled; // memoized r_bin_demangle results, the names live in demangled_names
+	RStrConstPool demangled_names;
+	RThreadLock *demangled_lock;
+	char *itemkey; // sha1 of the file, names its bin.itemcache entries
 	struct r_bin_t *rbin;
 } RBinFile;
 
@@ -337,6 +373,11 @@ struct r_bin_t {
 	ut64 maxstrbuf;
 	int rawstr;
 	bool strings_nofp; // move to options struct passed instead of min, dump raw on every getstrings call
+	int strthreads; // bin.str.threads, pool workers used to scan big ranges for strings (0: all)
+	int demanglethreads; // bin.demangle.threads, pool workers used by r_bin_demangle_batch (0: all)
+	RThreadPool *pool; // shared workers, set by the core (see cfg.threads)
+	bool itemcache; // bin.itemcache, keep the parsed symbols, imports and sections on disk
+	bool dyldindex; // bin.dyldcache.index, keep the images and sections of the dyld caches on disk
 	Sdb *sdb;
 	RIDStorage *ids;
 	RList/*<RBinPlugin>*/ *plugins;
@@ -793,11 +834,14 @@ R_API void r_bin_file_hash_free(RBinFileHash *fhash);
 
 // binobject functions
 R_API int r_bin_object_set_items(RBinFile *binfile, RBinObject *o);
+R_API bool r_bin_object_load_item(RBinFile *bf, RBinObject *o, RBinItem item);
+R_API const char *r_bin_item_tostring(RBinItem item);
 R_API bool r_bin_object_delete(RBin *bin, ut32 binfile_id);
 R_API void r_bin_mem_free(void *data);
 
 // demangle functions
 R_API char *r_bin_demangle(RBinFile *binfile, const char *lang, const char *str, ut64 vaddr, bool libs);
+R_API int r_bin_demangle_batch(RBinFile *bf, const char *lang, RList *symbols);
 R_API char *r_bin_demangle_java(const char *str);
 R_API char *r_bin_demangle_freepascal(const char *str);
 R_API char *r_bin_demangle_cxx(RBinFile *binfile, const char *str, ut64 vaddr);
@@ -817,6 +861,21 @@ R_API bool r_bin_addr2line(RBin *bin, ut64 addr, char *file, int len, int *line,
 R_API bool r_bin_addr2line2(RBin *bin, ut64 addr, char *file, int len, int *line, int *column);
 R_API char *r_bin_addr2text(RBin *bin, ut64 addr, int origin);
 R_API char *r_bin_addr2fileline(RBin *bin, ut64 addr);
+
+/* addrline.c */
+R_API RBinAddrLineStore *r_bin_addrline_store_new(void);
+R_API void r_bin_addrline_store_free(RBinAddrLineStore *s);
+R_API void r_bin_addrline_reset(RBinAddrLineStore *s);
+R_API bool r_bin_addrline_add(RBinAddrLineStore *s, ut64 addr, const char *file, ut32 line, ut32 column);
+R_API bool r_bin_addrline_set(RBinAddrLineStore *s, ut64 addr, const char *file, ut32 line, ut32 column);
+R_API bool r_bin_addrline_del(RBinAddrLineStore *s, ut64 addr);
+R_API bool r_bin_addrline_get(RBinAddrLineStore *s, ut64 addr, RBinAddrline *row);
+R_API bool r_bin_addrline_find(RBinAddrLineStore *s, const char *file, ut32 line, RBinAddrline *row);
+R_API bool r_bin_addrline_foreach(RBinAddrLineStore *s, RBinAddrlineCallback cb, void *user);
+R_API ut32 r_bin_addrline_count(RBinAddrLineStore *s);
+R_API RList *r_bin_addrline_files(RBinAddrLineStore *s);
+R_API ut8 *r_bin_addrline_serialize(RBinAddrLineStore *s, ut32 *size);
+R_API bool r_bin_addrline_unserialize(RBinAddrLineStore *s, const ut8 *buf, ut32 size);
 /* bin_write.c */
 R_API bool r_bin_wr_addlib(RBin *bin, const char *lib);
 R_API ut64 r_bin_wr_scn_resize(RBin *bin, const char *name, ut64 size);
@@ -853,6 +853,34 @@ typedef struct r_bin_dwarf_loc_list_t {
 	ut64 offset;
 } RBinDwarfLocList;
 
+typedef struct {
+	ut64 offset; // of the unit header in .debug_info
+	ut64 size; // including the initial length field
+	bool done; // set by the consumer once the unit has been applied
+} RBinDwarfCuEntry;
+
+typedef struct {
+	ut64 from;
+	ut64 to;
+	ut32 unit;
+} RBinDwarfCuRange;
+
+// compilation units of .debug_info indexed by address, decoded on demand
+typedef struct r_bin_dwarf_cu_index_t {
+	RBin *bin;
+	struct r_bin_file_t *bf;
+	RBinDwarfDebugAbbrev *da;
+	ut64 paddr; // of the .debug_info section
+	ut64 size;
+	bool be;
+	int addr_size;
+	RVector units; // RBinDwarfCuEntry
+	RVector ranges; // RBinDwarfCuRange sorted by address
+	RList *lru; // RBinDwarfDebugInfo holding one unit each, most recently used first
+	int lru_size;
+	HtUP/*<offset, RBinDwarfLocList*>*/ *loc; // parsed on first use
+} RBinDwarfCuIndex;
+
 #define r_bin_dwarf_line_new(o,a,f,l) o->address=a, o->file = strdup (r_str_get (f)), o->line = l, o->column =0,o
 
 R_API void r_bin_dwarf_parse_aranges(RBin *a, int mode);
@@ -864,6 +892,11 @@ R_API void r_bin_dwarf_print_loc(HtUP /*<offset, RBinDwarfLocList*>*/  *loc_tabl
 R_API void r_bin_dwarf_free_loc(HtUP /*<offset, RBinDwarfLocList*>*/  *loc_table);
 R_API void r_bin_dwarf_free_debug_info(RBinDwarfDebugInfo *inf);
 R_API void r_bin_dwarf_free_debug_abbrev(RBinDwarfDebugAbbrev *da);
+R_API RBinDwarfCuIndex *r_bin_dwarf_cu_index_new(RBin *bin, int addr_size, int lru_size);
+R_API void r_bin_dwarf_cu_index_free(RBinDwarfCuIndex *ci);
+R_API int r_bin_dwarf_cu_index_find(RBinDwarfCuIndex *ci, ut64 addr);
+R_API const RBinDwarfDebugInfo *r_bin_dwarf_cu_index_get(RBinDwarfCuIndex *ci, int unit);
+R_API HtUP/*<offset, RBinDwarfLocList*>*/ *r_bin_dwarf_cu_index_loc(RBinDwarfCuIndex *ci);
 
 #ifdef __cplusplus
 }
@@ -245,12 +245,14 @@ typedef struct r_core_tasks_t {
 	RThreadLock *lock;
 	int tasks_running;
 	bool oneshot_running;
+	int readers; // concurrent tasks reading the opened files
 } RCoreTaskScheduler;
 
 typedef struct r_core_project_t {
 	char *name;
 	char *path;
 	struct r_vc_t *rvc; // Rvc *rvc;
+	struct r_core_prjdb_t *db; // snapshot chunks not loaded yet, see r_core_project_db_fill
 } RProject;
 
 R_API RProject *r_project_new(void);
@@ -374,6 +376,7 @@ struct r_core_t {
 	int (*r_main_ragg2)(int argc, const char **argv);
 	int (*r_main_rasm2)(int argc, const char **argv);
 	int (*r_main_rax2)(int argc, const char **argv);
+	RThreadPool *pool; // workers for parallel tasks, see r_core_thread_pool
 };
 
 // maybe move into RAnal
@@ -427,6 +430,7 @@ R_API RCore *r_core_new(void);
 R_API void r_core_free(RCore *core);
 R_API void r_core_fini(RCore *c);
 R_API void r_core_wait(RCore *core);
+R_API RThreadPool *r_core_thread_pool(RCore *core);
 R_API RCore *r_core_ncast(ut64 p);
 R_API RCore *r_core_cast(void *p);
 R_API bool r_core_bin_load_structs(RCore *core, const char *file);
@@ -711,6 +715,7 @@ R_API bool r_core_bin_set_by_fd(RCore *core, ut64 bin_fd);
 R_API bool r_core_bin_set_by_name(RCore *core, const char *name);
 R_API bool r_core_bin_load(RCore *core, const char *file, ut64 baseaddr);
 R_API bool r_core_bin_rebase(RCore *core, ut64 baddr);
+R_API bool r_core_bin_dwarf_load_at(RCore *core, ut64 addr);
 R_API void r_core_bin_export_info(RCore *core, int mode);
 R_API bool r_core_bin_list(RCore *core, int mode);
 R_API bool r_core_bin_delete(RCore *core, ut32 binfile_idx);
@@ -736,6 +741,12 @@ R_API bool r_core_project_save(RCore *core, const char *file);
 R_API char *r_core_project_name(RCore *core, const char *file);
 R_API char *r_core_project_notes_file(RCore *core, const char *file);
 R_API void r_core_project_undirty(RCore *core);
+/* project_db.c */
+R_API bool r_core_project_db_save(RCore *core, const char *file);
+R_API bool r_core_project_db_load(RCore *core, const char *file, ut64 from, ut64 to);
+R_API bool r_core_project_db_open(RCore *core, const char *file);
+R_API bool r_core_project_db_fill(RCore *core, ut64 from, ut64 to);
+R_API bool r_core_project_db_list(RCore *core, const char *file, int mode);
 R_API char *r_core_sysenv_begin(RCore *core, const char *cmd);
 R_API void r_core_sysenv_end(RCore *core, const char *cmd);
 
@@ -944,6 +955,8 @@ typedef struct r_core_task_t {
 	bool cmd_log;
 	RConsContext *cons_context;
 	RCoreTaskCallback cb;
+	bool concurrent; // runs in parallel on a private copy of the core
+	void *snapshot;
 } RCoreTask;
 
 typedef void (*RCoreTaskOneShot)(void *);
@@ -976,6 +989,7 @@ R_API int r_core_task_del(RCoreTaskScheduler *scheduler, int id);
 R_API void r_core_task_del_all_done(RCoreTaskScheduler *scheduler);
 R_API RCoreTask *r_core_task_self(RCoreTaskScheduler *scheduler);
 R_API void r_core_task_join(RCoreTaskScheduler *scheduler, RCoreTask *current, int id);
+R_API bool r_core_task_wait_readers(RCoreTaskScheduler *scheduler);
 typedef void (*inRangeCb) (RCore *core, ut64 from, ut64 to, int vsize, void *cb_user);
 R_IPI int r_core_search_value_in_range(RCore *core, bool relative, RInterval search_itv, ut64 vmin, ut64 vmax, int vsize, inRangeCb cb, void *cb_user);
 
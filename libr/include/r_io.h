@@ -109,6 +109,8 @@ typedef struct io_cache_item_t {
 	ut8 *data;
 	ut8 *odata; // is this a good idea?
 	bool written;
+	bool spilled; // data and odata are stored in the spill file
+	ut64 spill; // offset of data and odata in the spill file
 } RIOCacheItem;
 
 typedef struct r_io_cache_layer_t {
@@ -125,8 +127,15 @@ typedef struct r_io_cache_t {
 	RList *layers; // a list of cache layers-- must be a vector O(n)
 	int enabled;
 	ut32 mode; // read, write, exec (enabled) sperm = requires maps
+	bool coalesce; // merge the writes that land in the same page
+	ut64 limit; // max bytes held in memory before spilling, 0 for unlimited
+	ut64 size; // bytes of the cached items held in memory (data and odata)
+	RBuffer *spill; // temporary file holding the spilled items
+	char *spill_file;
 } RIOCache;
 
+#define R_IO_CACHE_PAGE 4096
+
 // -io-cache-
 
 typedef struct r_io_t {
@@ -221,6 +230,7 @@ typedef struct r_io_plugin_t {
 	bool (*accept)(RIO *io, RIODesc *desc, int fd);
 	int (*create)(RIO *io, const char *file, int mode, int type);
 	bool (*check)(RIO *io, const char *, bool many);
+	const ut8 *(*peek)(RIO *io, RIODesc *fd, ut64 addr, int len); // borrow the bytes instead of reading them
 } RIOPlugin;
 
 typedef struct r_io_map_t {
@@ -274,6 +284,7 @@ typedef RIODesc *(*RIOOpen)(RIO *io, const char *uri, int flags, int mode);
 typedef RIODesc *(*RIOOpenAt)(RIO *io, const  char *uri, int flags, int mode, ut64 at);
 typedef bool (*RIOClose)(RIO *io, int fd);
 typedef bool (*RIOReadAt)(RIO *io, ut64 addr, ut8 *buf, int len);
+typedef bool (*RIOPeekAt)(RIO *io, ut64 addr, int len, const ut8 **ptr);
 typedef bool (*RIOWriteAt)(RIO *io, ut64 addr, const ut8 *buf, int len);
 typedef bool (*RIOOverlayWriteAt)(RIO *io, ut64 addr, const ut8 *buf, int len);
 typedef char *(*RIOSystem)(RIO *io, const char* cmd);
@@ -314,6 +325,7 @@ typedef struct r_io_bind_t {
 	RIOOpenAt open_at;
 	RIOClose close;
 	RIOReadAt read_at;
+	RIOPeekAt peek_at;
 	RIOWriteAt write_at;
 	RIOOverlayWriteAt overlay_write_at;
 	RIOSystem system;
@@ -409,6 +421,7 @@ R_API bool r_io_bank_locate(RIO *io, const ut32 bankid, ut64 *addr, const ut64 s
 R_API void r_io_bank_del_map(RIO *io, const ut32 bankid, const ut32 mapid);
 R_API RIOMap *r_io_bank_get_map_at(RIO *io, const ut32 bankid, const ut64 addr);
 R_API bool r_io_bank_read_at(RIO *io, const ut32 bankid, ut64 addr, ut8 *buf, int len);
+R_API bool r_io_bank_peek_at(RIO *io, const ut32 bankid, ut64 addr, int len, const ut8 **ptr);
 R_API bool r_io_bank_write_at(RIO *io, const ut32 bankid, ut64 addr, const ut8 *buf, int len);
 R_API bool r_io_bank_write_to_overlay_at(RIO *io, const ut32 bankid, ut64 addr, const ut8 *buf, int len);
 R_API int r_io_bank_read_from_submap_at(RIO *io, const ut32 bankid, ut64 addr, ut8 *buf, int len);
@@ -433,6 +446,7 @@ R_API bool r_io_vread_at(RIO *io, ut64 vaddr, ut8 *buf, int len);
 R_API bool r_io_vwrite_at(RIO *io, ut64 vaddr, const ut8 *buf, int len);
 R_API bool r_io_vwrite_to_overlay_at(RIO *io, ut64 caddr, const ut8 *buf, int len);
 R_API bool r_io_read_at(RIO *io, ut64 addr, ut8 *buf, int len);
+R_API bool r_io_peek_at(RIO *io, ut64 addr, int len, const ut8 **ptr);
 R_API int r_io_nread_at(RIO *io, ut64 addr, ut8 *buf, int len);
 R_API bool r_io_write_at(RIO *io, ut64 addr, const ut8 *buf, int len);
 R_API bool r_io_read(RIO *io, ut8 *buf, int len);
@@ -513,6 +527,7 @@ R_API int r_io_desc_get_pid(RIODesc *desc);
 R_API int r_io_desc_get_tid(RIODesc *desc);
 R_API bool r_io_desc_get_base(RIODesc *desc, ut64 *base);
 R_API int r_io_desc_read_at(RIODesc *desc, ut64 addr, ut8 *buf, int len);
+R_API const ut8 *r_io_desc_peek_at(RIODesc *desc, ut64 addr, int len);
 R_API int r_io_desc_write_at(RIODesc *desc, ut64 addr, const ut8 *buf, int len);
 
 /* lifecycle */
@@ -526,6 +541,8 @@ R_API void r_io_cache_list(RIO *io, int rad, bool many);
 R_API bool r_io_cache_empty(RIO *io);
 R_API void r_io_cache_reset(RIO *io);
 R_API bool r_io_cache_at(RIO *io, ut64 addr);
+R_API bool r_io_cache_overlaps(RIO *io, ut64 addr, int len);
+R_API bool r_io_cache_item_load(RIO *io, RIOCacheItem *ci);
 R_API bool r_io_cache_writable(RIO *io);
 // apply patches in given buffer
 R_API bool r_io_cache_write_at(RIO *io, ut64 addr, const ut8 *buf, int len);
@@ -24,6 +24,7 @@ typedef struct r_pdb_t {
 	RList *pdb_streams;
 	RList *pdb_streams2;
 	RBuffer *buf; // mmap of file
+	RThreadPool *pool; // shared workers that parse the streams, NULL parses them in this thread
 //	int curr;
 
 	void (*print_gvars)(struct r_pdb_t *pdb, ut64 img_base, PJ *pj, int format);
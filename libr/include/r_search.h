@@ -70,6 +70,7 @@ typedef int (*RSearchCallback) (R_NULLABLE RSearchKeyword *kw, void *user, ut64
 // function does not use kw's
 typedef int (*RSearchRCb) (RSearchKeyword *kw, int mlen, void *user, ut64 where);
 typedef void (RSearchDFree) (void *ptr);
+typedef struct r_search_aho_t RSearchAho;
 
 typedef struct r_search_t {
 	int n_kws; // hit${n_kws}_${count}
@@ -96,6 +97,9 @@ typedef struct r_search_t {
 	RIOBind iob;
 	RConsBind consb;
 	char bckwrds;
+	RSearchAho *aho; // compiled keywords, built by r_search_begin
+	int threads; // search.threads, pool workers used by r_search_update_read (0: all, 1: none)
+	RThreadPool *pool; // shared workers, set by the core (see cfg.threads)
 } RSearch;
 
 #ifdef R_API
@@ -14,6 +14,7 @@ R_LIB_VERSION_HEADER(r_sign);
 #define ZIGN_HASH "sha256"
 #define R_ZIGN_HASH R_HASH_SHA256
 #define R_SIGN_COL_DELEM ':'
+#define R_SIGN_FILE_EXT ".r2z" // binary zignature files
 
 typedef enum {
 	R_SIGN_BYTES = 'b', // bytes pattern
@@ -105,6 +106,9 @@ typedef struct {
 	RSignItem *item;
 } RSignCloseMatch;
 
+// mmapped binary zignature file
+typedef struct r_sign_file_t RSignFile;
+
 #ifdef R_API
 R_API bool r_sign_add_bytes(RAnal *a, const char *name, const char *val);
 R_API bool r_sign_add_anal(RAnal *a, const char *name, const char *val);
@@ -144,6 +148,12 @@ R_API bool r_sign_load(RAnal *a, const char *file, bool merge);
 R_API bool r_sign_load_gz(RAnal *a, const char *filename, bool merge);
 R_API char *r_sign_path(RAnal *a, const char *file);
 R_API bool r_sign_save(RAnal *a, const char *file);
+R_API bool r_sign_is_file(const char *file);
+R_API RSignFile *r_sign_file_open(const char *file);
+R_API void r_sign_file_free(RSignFile *sf);
+R_API ut32 r_sign_file_count(RSignFile *sf);
+R_API RSignItem *r_sign_file_item(RAnal *a, RSignFile *sf, ut32 i);
+R_API int r_sign_file_search(RAnal *a, RSignFile *sf, RSignSearchMetrics *sm);
 
 R_API RSignItem *r_sign_item_new(void);
 R_API void r_sign_item_free(RSignItem *item);
@@ -158,6 +168,7 @@ R_API RList *r_sign_fcn_vars(RAnal *a, RAnalFunction *fcn);
 R_API int r_sign_is_flirt(RBuffer *buf);
 R_API void r_sign_flirt_dump(const RAnal *anal, const char *flirt_file);
 R_API void r_sign_flirt_scan(RAnal *anal, const char *flirt_file);
+R_API void r_sign_flirt_scan_files(RAnal *anal, RList *files);
 
 R_API RList *r_sign_find_closest_sig(RAnal *a, RSignItem *it, int count, double score_threshold);
 R_API RList *r_sign_find_closest_fcn(RAnal *a, RSignItem *it, int count, double score_threshold);
@@ -158,11 +158,32 @@ typedef struct r_th_t {
 	int ready;     // thread is properly setup
 } RThread;
 
+typedef void *(*RThreadPoolFunction)(void *user);
+typedef void (*RThreadForCallback)(void *user, size_t from, size_t to);
+
 typedef struct r_th_pool_t {
 	int size;
 	RThread **threads;
+	struct r_th_pool_queue_t *queues; // one work stealing deque per worker
+	RThreadLock *lock; // protects the counters below
+	RThreadCond *work; // signaled when a task is queued
+	RThreadCond *done; // signaled when a task finishes and someone is waiting
+	int pending; // queued tasks
+	int waiters; // threads blocked in r_th_future_wait
+	ut32 next; // round robin index for tasks submitted from outside the pool
+	bool started; // the workers are spawned when the first task is queued
+	bool stop;
 } RThreadPool;
 
+typedef struct r_th_future_t {
+	RThreadPool *pool;
+	RThreadPoolFunction fun;
+	void *user;
+	void *result;
+	bool done; // protected by pool->lock
+	bool owned; // allocated by r_th_pool_submit
+} RThreadFuture;
+
 typedef struct {
 	int nextid;
 	RThreadLock *lock; // protects the stack from race conditions
@@ -236,6 +257,14 @@ R_API void *r_th_lock_free(RThreadLock *thl);
 #define R_CRITICAL_LEAVE(x)
 #endif
 
+R_API int r_th_ncpus(void);
+R_API RThreadPool *r_th_pool_new(int size);
+R_API void r_th_pool_free(RThreadPool *pool);
+R_API RThreadFuture *r_th_pool_submit(RThreadPool *pool, RThreadPoolFunction fun, void *user);
+R_API void *r_th_future_wait(RThreadFuture *f);
+R_API void r_th_future_free(RThreadFuture *f);
+R_API bool r_th_parallel_for(RThreadPool *pool, size_t from, size_t to, size_t grain, RThreadForCallback cb, void *user);
+
 R_API RThreadCond *r_th_cond_new(void);
 R_API void r_th_cond_signal(RThreadCond *cond);
 R_API void r_th_cond_signal_all(RThreadCond *cond);
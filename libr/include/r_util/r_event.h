@@ -77,9 +77,10 @@ typedef struct r_event_debug_process_finished_t {
 } REventDebugProcessFinished;
 
 typedef struct r_event_io_write_t {
-	ut64 addr;
+	ut64 addr; // physical, in the file of fd
 	const ut8 *buf;
 	int len;
+	int fd;
 } REventIOWrite;
 
 R_API REvent *r_event_new(void *user);
@@ -0,0 +1,12 @@
+#ifndef R_VERSION_H
+#define R_VERSION_H 1
+#define R2_VERSION_COMMIT 1
+#define R2_VERSION "5.8.9"
+#define R2_VERSION_MAJOR 5
+#define R2_VERSION_MINOR 8
+#define R2_VERSION_PATCH 9
+#define R2_VERSION_NUMBER 50809
+#define R2_GITTAP "5.8.9"
+#define R2_GITTIP "8ae17dbb5700c1a60859992f5390d272848d10eb"
+#define R2_BIRTH "2026-10-18__06:27:49"
+#endif
@@ -285,6 +285,28 @@ R_API bool r_io_read_at(RIO *io, ut64 addr, ut8 *buf, int len) {
 	return internal_r_io_read_at (io, addr, buf, len);
 }
 
+// Zero-copy version of r_io_read_at. It only succeeds when the whole range
+// is backed by one map of a plugin that keeps the contents in memory and
+// nothing shadows them (io.cache patches, overlays, desc caches or io.mask).
+// The pointer is borrowed, it is valid until the desc is resized or closed
+R_API bool r_io_peek_at(RIO *io, ut64 addr, int len, const ut8 **ptr) {
+	r_return_val_if_fail (io && ptr, false);
+	*ptr = NULL;
+	if (len < 1 || io->mask || UT64_ADD_OVFCHK (addr, len)) {
+		return false;
+	}
+	if ((io->cache.mode & R_PERM_R) && r_io_cache_overlaps (io, addr, len)) {
+		return false;
+	}
+	if (io->va) {
+		return r_io_bank_peek_at (io, io->bank, addr, len, ptr);
+	}
+	if (io->desc) {
+		*ptr = r_io_desc_peek_at (io->desc, addr, len);
+	}
+	return *ptr != NULL;
+}
+
 // For both virtual and physical mode, returns the number of bytes of read
 // prefix.
 // Returns -1 on error.
@@ -491,6 +513,7 @@ R_API void r_io_bind(RIO *io, RIOBind *bnd) {
 	bnd->open_at = r_io_open_at;
 	bnd->close = r_io_fd_close;
 	bnd->read_at = r_io_read_at;
+	bnd->peek_at = r_io_peek_at;
 	bnd->write_at = r_io_write_at;
 	bnd->overlay_write_at = r_io_vwrite_to_overlay_at;
 	bnd->system = r_io_system;
@@ -797,6 +797,39 @@ R_API bool r_io_bank_read_at(RIO *io, const ut32 bankid, ut64 addr, ut8 *buf, in
 	return ret;
 }
 
+// borrow the bytes when [addr, addr + len) is inside a single submap
+R_API bool r_io_bank_peek_at(RIO *io, const ut32 bankid, ut64 addr, int len, const ut8 **ptr) {
+	r_return_val_if_fail (io && ptr, false);
+	*ptr = NULL;
+	RIOBank *bank = r_io_bank_get (io, bankid);
+	if (!bank || len < 1) {
+		return false;
+	}
+	RIOSubMap fake_sm = {{0}};
+	fake_sm.itv.addr = addr;
+	fake_sm.itv.size = len;
+	RRBNode *node;
+	if (R_LIKELY (bank->last_used && r_io_submap_contain (((RIOSubMap *)bank->last_used->data), addr))) {
+		node = bank->last_used;
+	} else {
+		node = _find_entry_submap_node (bank, &fake_sm);
+	}
+	RIOSubMap *sm = node ? (RIOSubMap *)node->data : NULL;
+	if (!sm || !r_io_submap_contain (sm, addr) || r_io_submap_to (sm) < r_io_submap_to ((&fake_sm))) {
+		return false;
+	}
+	bank->last_used = node;
+	RIOMap *map = r_io_map_get_by_ref (io, &sm->mapref);
+	if (!map || !(map->perm & R_PERM_R) || (io->overlay && map->overlay)) {
+		return false;
+	}
+	RIODesc *desc = r_io_desc_get (io, map->fd);
+	if (desc) {
+		*ptr = r_io_desc_peek_at (desc, addr - r_io_map_from (map) + map->delta, len);
+	}
+	return *ptr != NULL;
+}
+
 R_API bool r_io_bank_write_at(RIO *io, const ut32 bankid, ut64 addr, const ut8 *buf, int len) {
 	r_return_val_if_fail (io, false);
 	RIOBank *bank = r_io_bank_get (io, bankid);
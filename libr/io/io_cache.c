@@ -31,6 +31,7 @@ static RIOCacheItem *iocache_item_new(RIO *io, RInterval *itv) {
 		ci->tree_itv = R_NEWCOPY (RInterval, itv);
 		if (ci->data && ci->odata && ci->tree_itv) {
 			ci->itv = (*itv);
+			io->cache.size += 2 * itv->size;
 			return ci;
 		}
 	}
@@ -40,6 +41,112 @@ static RIOCacheItem *iocache_item_new(RIO *io, RInterval *itv) {
 	return NULL;
 }
 
+// bytes of the item held in memory, io.cache.size is the sum for all the items
+static inline ut64 iocache_item_size(RIOCacheItem *ci) {
+	return ci->spilled? 0: 2 * r_itv_size (ci->itv);
+}
+
+static inline void iocache_size_sub(RIO *io, ut64 size) {
+	io->cache.size -= R_MIN (io->cache.size, size);
+}
+
+static void _io_cache_item_free(void *data);
+
+static void iocache_item_free(RIO *io, RIOCacheItem *ci) {
+	iocache_size_sub (io, iocache_item_size (ci));
+	_io_cache_item_free (ci);
+}
+
+// Items are spilled oldest first, the spill file is only appended and it
+// is removed when the cache is reset
+static bool iocache_item_spill(RIO *io, RIOCacheItem *ci) {
+	RIOCache *cache = &io->cache;
+	if (!cache->spill) {
+		char *file = NULL;
+		int fd = r_file_mkstemp ("r2cache", &file);
+		if (fd == -1) {
+			free (file);
+			return false;
+		}
+		close (fd);
+		cache->spill = r_buf_new_file (file, O_RDWR, 0600);
+		if (!cache->spill) {
+			r_file_rm (file);
+			free (file);
+			return false;
+		}
+		cache->spill_file = file;
+	}
+	const ut64 size = r_itv_size (ci->itv);
+	const ut64 at = r_buf_size (cache->spill);
+	if (r_buf_write_at (cache->spill, at, ci->data, size) != size
+			|| r_buf_write_at (cache->spill, at + size, ci->odata, size) != size) {
+		return false;
+	}
+	iocache_size_sub (io, iocache_item_size (ci));
+	R_FREE (ci->data);
+	R_FREE (ci->odata);
+	ci->spill = at;
+	ci->spilled = true;
+	return true;
+}
+
+R_API bool r_io_cache_item_load(RIO *io, RIOCacheItem *ci) {
+	r_return_val_if_fail (io && ci, false);
+	if (!ci->spilled) {
+		return true;
+	}
+	const ut64 size = r_itv_size (ci->itv);
+	ut8 *data = malloc (size);
+	ut8 *odata = malloc (size);
+	if (!data || !odata
+			|| r_buf_read_at (io->cache.spill, ci->spill, data, size) != size
+			|| r_buf_read_at (io->cache.spill, ci->spill + size, odata, size) != size) {
+		free (data);
+		free (odata);
+		R_LOG_ERROR ("Cannot load the cached bytes at 0x%08"PFMT64x, r_itv_begin (ci->itv));
+		return false;
+	}
+	ci->data = data;
+	ci->odata = odata;
+	ci->spilled = false;
+	io->cache.size += 2 * size;
+	return true;
+}
+
+// copy len bytes of the patched data starting at off without loading the item
+static void iocache_item_read(RIO *io, RIOCacheItem *ci, ut64 off, ut8 *buf, int len) {
+	if (ci->spilled) {
+		r_buf_read_at (io->cache.spill, ci->spill + off, buf, len);
+	} else {
+		memcpy (buf, ci->data + off, len);
+	}
+}
+
+// spill the oldest items until half of io.cache.limit is used
+static void iocache_enforce_limit(RIO *io) {
+	RIOCache *cache = &io->cache;
+	if (!cache->limit || cache->size <= cache->limit) {
+		return;
+	}
+	const ut64 target = cache->limit / 2;
+	RIOCacheLayer *layer;
+	RListIter *liter;
+	void **iter;
+	r_list_foreach (cache->layers, liter, layer) {
+		r_pvector_foreach (layer->vec, iter) {
+			if (cache->size <= target) {
+				return;
+			}
+			RIOCacheItem *ci = *iter;
+			if (!ci->spilled && !iocache_item_spill (io, ci)) {
+				R_LOG_WARN ("Cannot spill the io.cache to disk");
+				return;
+			}
+		}
+	}
+}
+
 static void _io_cache_item_free(void *data) {
 	RIOCacheItem *ci = (RIOCacheItem *)data;
 	if (ci) {
@@ -60,6 +167,14 @@ R_API void r_io_cache_init(RIO *io) {
 R_API void r_io_cache_fini(RIO *io) {
 	r_return_if_fail (io);
 	r_list_free (io->cache.layers);
+	io->cache.layers = NULL;
+	io->cache.size = 0;
+	r_buf_free (io->cache.spill);
+	io->cache.spill = NULL;
+	if (io->cache.spill_file) {
+		r_file_rm (io->cache.spill_file);
+		R_FREE (io->cache.spill_file);
+	}
 }
 
 R_API bool r_io_cache_empty(RIO *io) {
@@ -109,6 +224,58 @@ static RRBNode *_find_entry_ci_node(RRBTree *cache_tree, RInterval *itv) {
 	return node;
 }
 
+// With io.cache.coalesce every page holds a single item that grows to cover
+// all the writes in it, the gaps keep the bytes that were visible before
+static bool iocache_coalesce(RIO *io, RIOCacheLayer *layer, ut64 addr, const ut8 *buf, int len) {
+	const ut64 page = addr & ~(ut64)(R_IO_CACHE_PAGE - 1);
+	if (addr + len < addr || addr + len > page + R_IO_CACHE_PAGE) {
+		return false;
+	}
+	RInterval pitv = (RInterval){page, R_IO_CACHE_PAGE};
+	RRBNode *node = _find_entry_ci_node (layer->tree, &pitv);
+	if (!node) {
+		return false;
+	}
+	RIOCacheItem *ci = (RIOCacheItem *)node->data;
+	RRBNode *next = r_rbnode_next (node);
+	if (next && r_itv_overlap (pitv, ((RIOCacheItem *)next->data)->tree_itv[0])) {
+		return false;
+	}
+	// items that were committed or partially overwritten take the slow path
+	if (ci->written || !r_itv_include (pitv, ci->itv)
+			|| r_itv_begin (ci->tree_itv[0]) != r_itv_begin (ci->itv)
+			|| r_itv_size (ci->tree_itv[0]) != r_itv_size (ci->itv)) {
+		return false;
+	}
+	if (!r_io_cache_item_load (io, ci)) {
+		return false;
+	}
+	const ut64 from = R_MIN (addr, r_itv_begin (ci->itv));
+	const ut64 to = R_MAX (addr + len, r_itv_end (ci->itv));
+	if (from < r_itv_begin (ci->itv) || to > r_itv_end (ci->itv)) {
+		const ut64 size = to - from;
+		ut8 *data = malloc (size);
+		ut8 *odata = malloc (size);
+		if (!data || !odata) {
+			free (data);
+			free (odata);
+			return false;
+		}
+		(void)r_io_read_at (io, from, data, size);
+		memcpy (odata, data, size);
+		memcpy (odata + (r_itv_begin (ci->itv) - from), ci->odata, r_itv_size (ci->itv));
+		io->cache.size += 2 * (size - r_itv_size (ci->itv));
+		free (ci->data);
+		free (ci->odata);
+		ci->data = data;
+		ci->odata = odata;
+		ci->itv = (RInterval){from, size};
+		ci->tree_itv[0] = ci->itv;
+	}
+	memcpy (ci->data + (addr - r_itv_begin (ci->itv)), buf, len);
+	return true;
+}
+
 // write happens only in the last layer
 R_API bool r_io_cache_write_at(RIO *io, ut64 addr, const ut8 *buf, int len) {
 	r_return_val_if_fail (io && buf && (len > 0), false);
@@ -116,6 +283,10 @@ R_API bool r_io_cache_write_at(RIO *io, ut64 addr, const ut8 *buf, int len) {
 	if (r_list_empty (io->cache.layers)) {
 		return false;
 	}
+	if (io->cache.coalesce && iocache_coalesce (io, r_list_last (io->cache.layers), addr, buf, len)) {
+		iocache_enforce_limit (io);
+		return true;
+	}
 	RIOCacheItem *ci = iocache_item_new (io, &itv);
 	if (!ci) {
 		return false;
@@ -144,6 +315,7 @@ R_API bool r_io_cache_write_at(RIO *io, ut64 addr, const ut8 *buf, int len) {
 	}
 	r_crbtree_insert (layer->tree, ci, _ci_start_cmp_cb, NULL);
 	r_pvector_push (layer->vec, ci);
+	iocache_enforce_limit (io);
 	return true;
 }
 
@@ -186,13 +358,13 @@ R_API bool r_io_cache_read_at(RIO *io, ut64 addr, ut8 *buf, int len) {
 				}
 				st64 offb = r_itv_begin (its) - r_itv_begin (ci->itv);
 				// eprintf ("ITVLEN = %d (%d)\n", itvlen, delta);
-				memcpy (buf + delta, ci->data + offb, itvlen);
+				iocache_item_read (io, ci, offb, buf + delta, itvlen);
 				// r_sys_breakpoint ();
 			} else {
 				st64 offa = addr - r_itv_begin (its);
 				st64 offb = r_itv_begin (its) - r_itv_begin (ci->itv);
 				// eprintf ("OFFA (addr %llx iv %llx) %llx %llx\n", addr, r_itv_begin (its), offa, offb);
-				memcpy (buf + offa, ci->data + offb, itvlen);
+				iocache_item_read (io, ci, offb, buf + offa, itvlen);
 			}
 			ci = node? (RIOCacheItem *)node->data: NULL;
 		}
@@ -224,6 +396,20 @@ R_API bool r_io_cache_at(RIO *io, ut64 addr) {
 	return false;
 }
 
+// true when any layer has patched bytes in [addr, addr + len)
+R_API bool r_io_cache_overlaps(RIO *io, ut64 addr, int len) {
+	r_return_val_if_fail (io && len > 0, false);
+	RInterval itv = (RInterval){addr, len};
+	RIOCacheLayer *layer;
+	RListIter *liter;
+	r_list_foreach (io->cache.layers, liter, layer) {
+		if (_find_entry_ci_node (layer->tree, &itv)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 // this uses closed boundary input
 R_API int r_io_cache_invalidate(RIO *io, ut64 from, ut64 to, bool many) {
 	r_return_val_if_fail (io && from <= to, 0);
@@ -232,12 +418,18 @@ R_API int r_io_cache_invalidate(RIO *io, ut64 from, ut64 to, bool many) {
 	ut32 invalidated_cache_bytes = 0;
 	RIOCacheLayer *layer;
 	RListIter *liter;
+	// the split items are pushed after the walk, the vector can be moved
+	RPVector split;
+	r_pvector_init (&split, NULL);
 	r_list_foreach (io->cache.layers, liter, layer) {
 		r_pvector_foreach_prev (layer->vec, iter) {
 			RIOCacheItem *ci = (RIOCacheItem *)*iter;
 			if (!r_itv_overlap (itv, ci->itv)) {
 				continue;
 			}
+			if (!r_io_cache_item_load (io, ci)) {
+				continue;
+			}
 			ci->written = false;
 			if (r_itv_include (itv, ci->itv)) {
 				if (ci->tree_itv) {
@@ -245,6 +437,7 @@ R_API int r_io_cache_invalidate(RIO *io, ut64 from, ut64 to, bool many) {
 					r_crbtree_delete (layer->tree, ci, _ci_start_cmp_cb, NULL);
 				}
 				r_pvector_remove_data (layer->vec, ci);
+				iocache_item_free (io, ci);
 				continue;
 			}
 			if (r_itv_include (ci->itv, itv)) {
@@ -255,6 +448,7 @@ R_API int r_io_cache_invalidate(RIO *io, ut64 from, ut64 to, bool many) {
 				}
 				memcpy (_ci->data, &ci->data[r_itv_end (itv) - r_itv_begin (ci->itv)], r_itv_size (_ci->itv));
 				memcpy (_ci->odata, &ci->odata[r_itv_end (itv) - r_itv_begin (ci->itv)], r_itv_size (_ci->itv));
+				iocache_size_sub (io, 2 * (r_itv_end (ci->itv) - itv.addr));
 				ci->itv.size = itv.addr - ci->itv.addr;
 				ut8 *cidata = realloc (ci->data, (size_t)r_itv_size (ci->itv));
 				if (cidata) {
@@ -289,10 +483,11 @@ R_API int r_io_cache_invalidate(RIO *io, ut64 from, ut64 to, bool many) {
 				} else {
 					R_FREE (_ci->tree_itv);
 				}
-				r_pvector_push (layer->vec, _ci);
+				r_pvector_push (&split, _ci);
 				continue;
 			}
 			if (r_itv_begin (ci->itv) < r_itv_begin (itv)) {
+				iocache_size_sub (io, 2 * (r_itv_end (ci->itv) - itv.addr));
 				ci->itv.size = itv.addr - ci->itv.addr;
 				ut8 *cidata = realloc (ci->data, (size_t)r_itv_size (ci->itv));
 				ut8 *ciodata = realloc (ci->odata, (size_t)r_itv_size (ci->itv));
@@ -320,6 +515,7 @@ R_API int r_io_cache_invalidate(RIO *io, ut64 from, ut64 to, bool many) {
 				r_itv_end (ci->itv) - r_itv_end (itv));
 			memcpy (ci->odata, &ci->odata[r_itv_end (itv) - r_itv_begin (ci->itv)],
 				r_itv_end (ci->itv) - r_itv_end (itv));
+			iocache_size_sub (io, 2 * (r_itv_end (itv) - r_itv_begin (ci->itv)));
 			ci->itv.size = r_itv_end (ci->itv) - r_itv_end (itv);
 			ci->itv.addr = r_itv_end (itv);	//this feels so wrong
 			if (ci->tree_itv) {
@@ -334,7 +530,12 @@ R_API int r_io_cache_invalidate(RIO *io, ut64 from, ut64 to, bool many) {
 				}
 			}
 		}
+		r_pvector_foreach (&split, iter) {
+			r_pvector_push (layer->vec, *iter);
+		}
+		r_pvector_clear (&split);
 	}
+	r_pvector_fini (&split);
 	return invalidated_cache_bytes;
 }
 
@@ -349,6 +550,9 @@ R_API void r_io_cache_commit(RIO *io, ut64 from, ut64 to, bool many) {
 			while (node) {
 				RIOCacheItem *ci = (RIOCacheItem *)node->data;
 				node = r_rbnode_next (node);
+				if (!r_io_cache_item_load (io, ci)) {
+					continue;
+				}
 				bool write_ok = r_io_bank_write_at (io, io->bank, r_itv_begin (ci->tree_itv[0]),
 					&ci->data[r_itv_begin (ci->tree_itv[0]) - r_itv_begin (ci->itv)],
 					r_itv_size (ci->tree_itv[0]));
@@ -366,8 +570,10 @@ R_API void r_io_cache_commit(RIO *io, ut64 from, ut64 to, bool many) {
 				RIOCacheItem *ci = (RIOCacheItem *)node->data;
 				while (ci && r_itv_overlap (itv, ci->tree_itv[0])) {
 					RInterval its = r_itv_intersect (itv, ci->tree_itv[0]);
-					r_io_bank_write_at (io, io->bank, r_itv_begin (its),
-						&ci->data[r_itv_begin (its) - r_itv_begin (ci->itv)], r_itv_size (its));
+					if (r_io_cache_item_load (io, ci)) {
+						r_io_bank_write_at (io, io->bank, r_itv_begin (its),
+							&ci->data[r_itv_begin (its) - r_itv_begin (ci->itv)], r_itv_size (its));
+					}
 					node = r_rbnode_next (node);
 					ci = node? (RIOCacheItem *)node->data: NULL;
 				}
@@ -386,6 +592,9 @@ static void list(RIO *io, RIOCacheLayer *layer, PJ *pj, int rad) {
 	r_pvector_foreach (layer->vec, iter) {
 		RIOCacheItem *ci = *iter;
 		const ut64 dataSize = r_itv_size (ci->itv);
+		if (!r_io_cache_item_load (io, ci)) {
+			continue;
+		}
 		if (pj) {
 			pj_o (pj);
 			pj_kn (pj, "idx", j);
@@ -520,6 +729,10 @@ R_API void r_io_cache_push(RIO *io) {
 R_API bool r_io_cache_pop(RIO *io) {
 	if (!r_list_empty (io->cache.layers)) {
 		RIOCacheLayer *cl = r_list_pop (io->cache.layers);
+		void **iter;
+		r_pvector_foreach (cl->vec, iter) {
+			iocache_size_sub (io, iocache_item_size (*iter));
+		}
 		iocache_layer_free (cl);
 		return true;
 	}
@@ -535,6 +748,9 @@ R_API bool r_io_cache_undo(RIO *io) { // "wcu"
 	void **iter;
 	r_pvector_foreach_prev (layer->vec, iter) {
 		RIOCacheItem *c = *iter;
+		if (!r_io_cache_item_load (io, c)) {
+			return false;
+		}
 		ut32 mode = io->cache.mode;
 		io->cache.mode = 0;
 		r_io_write_at (io, r_itv_begin (c->itv), c->odata, r_itv_size (c->itv));
@@ -542,11 +758,10 @@ R_API bool r_io_cache_undo(RIO *io) { // "wcu"
 		io->cache.mode = mode;
 		// tf is all this shit
 		r_pvector_remove_data (layer->vec, c);
-		RPVectorFree free_elem = layer->vec->v.free_user;
 		if (c->tree_itv) {
 			r_crbtree_delete (layer->tree, c, _ci_start_cmp_cb, NULL);
 		}
-		free_elem (c);
+		iocache_item_free (io, c);
 		break;
 	}
 	return true;
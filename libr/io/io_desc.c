@@ -344,6 +344,19 @@ R_API int r_io_desc_read_at(RIODesc *desc, ut64 addr, ut8 *buf, int len) {
 	return 0;
 }
 
+// Returns a pointer to the backing memory of the plugin, NULL when it can't
+// be borrowed and the bytes must be read instead
+R_API const ut8 *r_io_desc_peek_at(RIODesc *desc, ut64 addr, int len) {
+	r_return_val_if_fail (desc, NULL);
+	if (len < 1 || !(desc->perm & R_PERM_R) || !desc->plugin || !desc->plugin->peek) {
+		return NULL;
+	}
+	if (desc->cache && desc->io && (desc->io->p_cache & 1)) {
+		return NULL;
+	}
+	return desc->plugin->peek (desc->io, desc, addr, len);
+}
+
 R_API int r_io_desc_write_at(RIODesc *desc, ut64 addr, const ut8 *buf, int len) {
 	if (desc && buf && (r_io_desc_seek (desc, addr, R_IO_SEEK_SET) == addr)) {
 		return r_io_desc_write (desc, buf, len);
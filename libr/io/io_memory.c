@@ -1,4 +1,4 @@
-/* radare - LGPL - Copyright 2008-2022 - pancake */
+/* radare - LGPL - Copyright 2008-2023 - pancake */
 
 #include "io_memory.h"
 
@@ -95,6 +95,15 @@ int io_memory_read(RIO *io, RIODesc *fd, ut8 *buf, int count) {
 	return count;
 }
 
+const ut8 *io_memory_peek(RIO *io, RIODesc *fd, ut64 addr, int count) {
+	r_return_val_if_fail (fd, NULL);
+	const ut32 mallocsz = _io_malloc_sz (fd);
+	if (!fd->data || addr >= mallocsz || count > mallocsz - addr) {
+		return NULL;
+	}
+	return _io_malloc_buf (fd) + addr;
+}
+
 bool io_memory_close(RIODesc *fd) {
 	if (!fd || !fd->data) {
 		return false;
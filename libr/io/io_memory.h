@@ -12,6 +12,7 @@ typedef struct {
 
 bool io_memory_close(RIODesc *fd);
 int io_memory_read(RIO *io, RIODesc *fd, ut8 *buf, int count);
+const ut8 *io_memory_peek(RIO *io, RIODesc *fd, ut64 addr, int count);
 ut64 io_memory_lseek(RIO* io, RIODesc *fd, ut64 offset, int whence);
 int io_memory_write(RIO *io, RIODesc *fd, const ut8 *buf, int count);
 bool io_memory_resize(RIO *io, RIODesc *fd, ut64 count);
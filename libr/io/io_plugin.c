@@ -166,7 +166,7 @@ R_API int r_io_plugin_write(RIODesc *desc, const ut8 *buf, int len) {
 	}
 	const ut64 cur_addr = r_io_desc_seek (desc, 0LL, R_IO_SEEK_CUR);
 	int ret = desc->plugin->write (desc->io, desc, buf, len);
-	REventIOWrite iow = { cur_addr, buf, len };
+	REventIOWrite iow = { cur_addr, buf, len, desc->fd };
 	r_event_send (desc->io->event, R_EVENT_IO_WRITE, &iow);
 	return ret;
 }
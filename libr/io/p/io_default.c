@@ -1,4 +1,4 @@
-/* radare - LGPL - Copyright 2008-2022 - pancake */
+/* radare - LGPL - Copyright 2008-2023 - pancake */
 
 #include <r_io.h>
 #include <r_lib.h>
@@ -279,6 +279,17 @@ static int __write(RIO *io, RIODesc *fd, const ut8 *buf, int len) {
 	return r_io_def_mmap_write(io, fd, buf, len);
 }
 
+// writes remap the file, so only read-only mappings can be borrowed
+static const ut8 *__peek(RIO *io, RIODesc *fd, ut64 addr, int len) {
+	RIOMMapFileObj *mmo = fd->data;
+	if (!mmo || mmo->rawio || !mmo->buf || (fd->perm & R_PERM_W)) {
+		return NULL;
+	}
+	ut64 size = 0;
+	const ut8 *data = r_buf_data (mmo->buf, &size);
+	return (data && addr < size && len <= size - addr)? data + addr: NULL;
+}
+
 static ut64 __lseek(RIO *io, RIODesc *fd, ut64 offset, int whence) {
 	r_return_val_if_fail (fd && fd->data, UT64_MAX);
 	return r_io_def_mmap_seek (io, (RIOMMapFileObj *)fd->data, offset, whence);
@@ -326,6 +337,7 @@ RIOPlugin r_io_plugin_default = {
 	.seek = __lseek,
 	.write = __write,
 	.resize = __resize,
+	.peek = __peek,
 #if R2__UNIX__
 	.is_blockdevice = __is_blockdevice,
 #endif
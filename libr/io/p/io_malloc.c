@@ -1,4 +1,4 @@
-/* radare - LGPL - Copyright 2008-2022 - pancake */
+/* radare - LGPL - Copyright 2008-2023 - pancake */
 
 #include <r_io.h>
 #include <r_lib.h>
@@ -87,6 +87,7 @@ RIOPlugin r_io_plugin_malloc = {
 	.seek = io_memory_lseek,
 	.write = io_memory_write,
 	.resize = io_memory_resize,
+	.peek = io_memory_peek,
 };
 
 #ifndef R2_PLUGIN_INCORE
@@ -1,4 +1,4 @@
-/* radare - LGPL - Copyright 2013-2022 - pancake */
+/* radare - LGPL - Copyright 2013-2023 - pancake */
 
 #include <r_userconf.h>
 #include <r_io.h>
@@ -164,6 +164,17 @@ static int __write(RIO *io, RIODesc *fd, const ut8 *buf, int len) {
 	return r_io_mmap_write(io, fd, buf, len);
 }
 
+// writes remap the file, so only read-only mappings can be borrowed
+static const ut8 *__peek(RIO *io, RIODesc *fd, ut64 addr, int len) {
+	RIOMMapFileObj *mmo = fd->data;
+	if (!mmo || !mmo->buf || (fd->perm & R_PERM_W)) {
+		return NULL;
+	}
+	ut64 size = 0;
+	const ut8 *data = r_buf_data (mmo->buf, &size);
+	return (data && addr < size && len <= size - addr)? data + addr: NULL;
+}
+
 static ut64 __lseek(RIO *io, RIODesc *fd, ut64 offset, int whence) {
 	return r_io_mmap_lseek (io, fd, offset, whence);
 }
@@ -196,6 +207,7 @@ RIOPlugin r_io_plugin_mmap = {
 	.seek = __lseek,
 	.write = __write,
 	.resize = __resize,
+	.peek = __peek,
 };
 
 #ifndef R2_PLUGIN_INCORE
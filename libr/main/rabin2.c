@@ -1,4 +1,4 @@
-/* radare - LGPL - Copyright 2009-2022 - pancake */
+/* radare - LGPL - Copyright 2009-2023 - pancake */
 
 #include <r_core.h>
 #include <r_types.h>
@@ -14,8 +14,8 @@ typedef struct rabin2_state_t {
 
 static int rabin_show_help(int v) {
 	printf ("Usage: rabin2 [-AcdeEghHiIjlLMqrRsSUvVxzZ] [-@ at] [-a arch] [-b bits] [-B addr]\n"
-		"              [-C F:C:D] [-f str] [-m addr] [-n str] [-N m:M] [-P[-P] pdb]\n"
-		"              [-o str] [-O str] [-k query] [-D lang mangledsymbol] file\n");
+		"              [-C F:C:D] [-f str] [-J jobs] [-m addr] [-n str] [-N m:M]\n"
+		"              [-P[-P] pdb] [-o str] [-O str] [-k query] [-D lang mangledsymbol] file\n");
 	if (v) {
 		printf (
 		" -@ [addr]       show section, symbol or import at addr\n"
@@ -40,6 +40,7 @@ static int rabin_show_help(int v) {
 		" -i              imports (symbols imported from libraries)\n"
 		" -I              binary info\n"
 		" -j              output in json\n"
+		" -J [jobs]       batch: parse the given files, dirs or - (stdin list) in parallel, a json line each\n"
 		" -k [sdb-query]  run sdb query. for example: '*'\n"
 		" -K [algo]       calculate checksums (md5, sha1, ..)\n"
 		" -l              linked libraries\n"
@@ -84,12 +85,15 @@ static int rabin_show_help(int v) {
 		" RABIN2_DEBASE64:  e bin.str.debase64 # try to debase64 all strings\n"
 		" RABIN2_DEMANGLE=0:e bin.demangle     # do not demangle symbols\n"
 		" RABIN2_DMNGLRCMD: e bin.demanglercmd # try to purge false positives\n"
+		" RABIN2_DYLDINDEX: e bin.dyldcache.index # reuse the dyld cache images listed in previous runs\n"
+		" RABIN2_ITEMCACHE: e bin.itemcache    # reuse the symbols parsed in previous runs\n"
 		" RABIN2_LANG:      e bin.lang         # assume lang for demangling\n"
 		" RABIN2_MAXSTRBUF: e bin.str.maxbuf   # specify maximum buffer size\n"
 		" RABIN2_PDBSERVER: e pdb.server       # use alternative PDB server\n"
 		" RABIN2_PREFIX:    e bin.prefix       # prefix symbols/sections/relocs with a specific string\n"
 		" RABIN2_STRFILTER: e bin.str.filter   # r2 -qc 'e bin.str.filter=?" "?' -\n"
 		" RABIN2_STRPURGE:  e bin.str.purge    # try to purge false positives\n"
+		" RABIN2_STRTHREADS:e bin.str.threads  # threads used to scan big files for strings\n"
 		" RABIN2_SYMSTORE:  e pdb.symstore     # path to downstream symbol store\n"
 		" RABIN2_SWIFTLIB:  1|0|               # load Swift libsto demangle (default: true)\n"
 		" RABIN2_VERBOSE:   e bin.verbose      # show debugging messages from the parser\n"
@@ -551,6 +555,235 @@ static void __listPlugins(RBin *bin, const char* plugin_name, PJ *pj, int rad) {
 	}
 }
 
+typedef struct {
+	const char *name;
+	ut64 req;
+	int acc;
+} RabinAction;
+
+// in the order they are printed
+static const RabinAction rabin_actions[] = {
+	{ "sections", R_BIN_REQ_SECTIONS, R_CORE_BIN_ACC_SECTIONS },
+	{ "segments", R_BIN_REQ_SEGMENTS, R_CORE_BIN_ACC_SEGMENTS },
+	{ "entries", R_BIN_REQ_ENTRIES, R_CORE_BIN_ACC_ENTRIES },
+	{ "initfini", R_BIN_REQ_INITFINI, R_CORE_BIN_ACC_INITFINI },
+	{ "main", R_BIN_REQ_MAIN, R_CORE_BIN_ACC_MAIN },
+	{ "imports", R_BIN_REQ_IMPORTS, R_CORE_BIN_ACC_IMPORTS },
+	{ "classes", R_BIN_REQ_CLASSES, R_CORE_BIN_ACC_CLASSES },
+	{ "symbols", R_BIN_REQ_SYMBOLS, R_CORE_BIN_ACC_SYMBOLS },
+	{ "exports", R_BIN_REQ_EXPORTS, R_CORE_BIN_ACC_EXPORTS },
+	{ "resources", R_BIN_REQ_RESOURCES, R_CORE_BIN_ACC_RESOURCES },
+	{ "strings", R_BIN_REQ_STRINGS, R_CORE_BIN_ACC_STRINGS },
+	{ "info", R_BIN_REQ_INFO, R_CORE_BIN_ACC_INFO },
+	{ "fields", R_BIN_REQ_FIELDS, R_CORE_BIN_ACC_FIELDS },
+	{ "header", R_BIN_REQ_HEADER, R_CORE_BIN_ACC_HEADER },
+	{ "libs", R_BIN_REQ_LIBS, R_CORE_BIN_ACC_LIBS },
+	{ "relocs", R_BIN_REQ_RELOCS, R_CORE_BIN_ACC_RELOCS },
+	{ "dwarf", R_BIN_REQ_DWARF, R_CORE_BIN_ACC_DWARF },
+	{ "pdb", R_BIN_REQ_PDB, R_CORE_BIN_ACC_PDB },
+	{ "size", R_BIN_REQ_SIZE, R_CORE_BIN_ACC_SIZE },
+	{ "versioninfo", R_BIN_REQ_VERSIONINFO, R_CORE_BIN_ACC_VERSIONINFO },
+	{ "sections", R_BIN_REQ_SIGNATURE, R_CORE_BIN_ACC_SIGNATURE },
+	{ "hashes", R_BIN_REQ_HASHES, R_CORE_BIN_ACC_HASHES },
+	{ "sections mapping", R_BIN_REQ_SECTIONS_MAPPING, R_CORE_BIN_ACC_SECTIONS_MAPPING },
+};
+
+typedef struct {
+	RThreadLock *lock; // guards the queue, core creation and stdout
+	RCore *core; // the one parsing the command line, owns the plugin registry
+	RList *files;
+	RListIter *next;
+	ut64 action;
+	ut64 baddr;
+	ut64 laddr;
+	int rawstr;
+	bool va;
+	const char *forcebin;
+	const char *chksum;
+	RCoreBinFilter filter;
+} RabinBatch;
+
+// config prefixes that affect the bin parsers, copied to every worker
+static const char *batch_config[] = { "bin.", "cfg.charset", "cmd.demangle", "pdb.", NULL };
+
+static RCore *batch_core_new(RabinBatch *b) {
+	RCore *core = r_core_new ();
+	if (!core) {
+		return NULL;
+	}
+	RBin *bin = b->core->bin;
+	RListIter *iter;
+	void *p;
+	r_list_foreach (bin->plugins, iter, p) {
+		r_bin_add (core->bin, p);
+	}
+	r_list_foreach (bin->binxtrs, iter, p) {
+		r_bin_xtr_add (core->bin, p);
+	}
+	r_list_foreach (bin->binldrs, iter, p) {
+		r_bin_ldr_add (core->bin, p);
+	}
+	RConfigNode *node;
+	r_list_foreach (b->core->config->nodes, iter, node) {
+		int i;
+		for (i = 0; batch_config[i]; i++) {
+			if (r_str_startswith (node->name, batch_config[i])) {
+				r_config_set (core->config, node->name, node->value);
+				break;
+			}
+		}
+	}
+	core->bin->filter = bin->filter;
+	core->bin->minstrlen = r_config_get_i (core->config, "bin.str.min");
+	core->bin->maxstrbuf = r_config_get_i (core->config, "bin.str.maxbuf");
+	core->io->va = b->va;
+	// the parallel paths of every file use the workers of the main core
+	core->bin->pool = core->anal->pool = r_core_thread_pool (b->core);
+	r_bin_force_plugin (core->bin, b->forcebin);
+	r_bin_load_filter (core->bin, b->action);
+	r_cons_singleton ()->context->is_interactive = false;
+	return core;
+}
+
+static char *batch_file(RabinBatch *b, RCore *core, const char *file) {
+	PJ *pj = r_core_pj_new (core);
+	if (!pj) {
+		return NULL;
+	}
+	pj_o (pj);
+	pj_ks (pj, "file", file);
+	if (!r_core_file_open (core, file, R_PERM_R, 0)) {
+		pj_ks (pj, "error", "cannot open file");
+	} else {
+		RBinFileOptions bo;
+		r_bin_file_options_init (&bo, r_io_fd_get_current (core->io), b->baddr, b->laddr, b->rawstr);
+		if (!r_bin_open (core->bin, file, &bo)) {
+			pj_ks (pj, "error", "cannot load bin");
+		} else {
+			(void)r_core_bin_update_arch_bits (core);
+			if (b->baddr != UT64_MAX) {
+				r_bin_set_baddr (core->bin, b->baddr);
+			}
+			size_t i;
+			for (i = 0; i < R_ARRAY_SIZE (rabin_actions); i++) {
+				const RabinAction *ra = &rabin_actions[i];
+				if (b->action & ra->req) {
+					pj_k (pj, ra->name);
+					if (!r_core_bin_info (core, ra->acc, pj, R_MODE_JSON, b->va, &b->filter, b->chksum)) {
+						pj_null (pj);
+					}
+				}
+			}
+		}
+	}
+	pj_end (pj);
+	// drop everything loaded for this file before taking the next one
+	r_bin_file_delete_all (core->bin);
+	r_io_close_all (core->io);
+	r_cons_reset ();
+	return pj_drain (pj);
+}
+
+static RThreadFunctionRet batch_worker(RThread *th) {
+	RabinBatch *b = th->user;
+	r_th_lock_enter (b->lock);
+	RCore *core = batch_core_new (b);
+	r_th_lock_leave (b->lock);
+	if (!core) {
+		return R_TH_STOP;
+	}
+	for (;;) {
+		r_th_lock_enter (b->lock);
+		const char *file = b->next? b->next->data: NULL;
+		if (b->next) {
+			b->next = b->next->n;
+		}
+		r_th_lock_leave (b->lock);
+		if (!file) {
+			break;
+		}
+		char *res = batch_file (b, core, file);
+		if (res) {
+			r_th_lock_enter (b->lock);
+			printf ("%s\n", res);
+			fflush (stdout);
+			r_th_lock_leave (b->lock);
+			free (res);
+		}
+	}
+	r_th_lock_enter (b->lock);
+	r_core_free (core);
+	r_th_lock_leave (b->lock);
+	return R_TH_STOP;
+}
+
+static void batch_add(RList *files, const char *path) {
+	if (r_file_is_directory (path)) {
+		RList *dir = r_file_lsrf (path);
+		RListIter *iter;
+		char *f;
+		r_list_foreach (dir, iter, f) {
+			if (!r_file_is_directory (f)) {
+				r_list_append (files, strdup (f));
+			}
+		}
+		r_list_free (dir);
+	} else {
+		r_list_append (files, strdup (path));
+	}
+}
+
+// parse every file with its own core in one of the threads, printing a json line per file as they finish
+static int rabin_batch(RabinBatch *b, Rabin2State *state, const char **paths, int npaths, int nthreads) {
+	RList *files = r_list_newf (free);
+	int i;
+	for (i = 0; i < npaths; i++) {
+		if (!strcmp (paths[i], "-")) {
+			char *line;
+			while ((line = stdin_gets (state))) {
+				r_str_trim (line);
+				if (*line) {
+					batch_add (files, line);
+				}
+				free (line);
+			}
+		} else {
+			batch_add (files, paths[i]);
+		}
+	}
+	if (nthreads < 1) {
+		nthreads = r_th_ncpus ();
+	}
+	nthreads = R_MAX (R_MIN (nthreads, r_list_length (files)), 1);
+	RThread **ths = R_NEWS0 (RThread *, nthreads);
+	b->lock = r_th_lock_new (false);
+	if (!ths || !b->lock) {
+		free (ths);
+		r_th_lock_free (b->lock);
+		r_list_free (files);
+		return 1;
+	}
+	b->files = files;
+	b->next = r_list_head (files);
+	for (i = 0; i < nthreads; i++) {
+		ths[i] = r_th_new (batch_worker, b, 0);
+	}
+	for (i = 0; i < nthreads; i++) {
+		if (ths[i]) {
+			r_th_wait (ths[i]);
+			r_th_free (ths[i]);
+		} else {
+			// the thread could not be spawned, drain the queue from here
+			RThread th = { .user = b };
+			batch_worker (&th);
+		}
+	}
+	free (ths);
+	r_th_lock_free (b->lock);
+	r_list_free (files);
+	return 0;
+}
+
 R_API int r_main_rabin2(int argc, const char **argv) {
 	Rabin2State state = {0};
 	RBin *bin = NULL;
@@ -575,6 +808,8 @@ R_API int r_main_rabin2(int argc, const char **argv) {
 	int xtr_idx = 0; // load all files if extraction is necessary.
 	int rawstr = 0;
 	int fd = -1;
+	bool batch = false;
+	int jobs = 0;
 	RCore core = {0};
 	ut64 at = UT64_MAX;
 
@@ -658,6 +893,18 @@ R_API int r_main_rabin2(int argc, const char **argv) {
 		r_config_set (core.config, "bin.str.purge", tmp);
 		free (tmp);
 	}
+	if ((tmp = r_sys_getenv ("RABIN2_STRTHREADS"))) {
+		r_config_set (core.config, "bin.str.threads", tmp);
+		free (tmp);
+	}
+	if ((tmp = r_sys_getenv ("RABIN2_DYLDINDEX"))) {
+		r_config_set (core.config, "bin.dyldcache.index", tmp);
+		free (tmp);
+	}
+	if ((tmp = r_sys_getenv ("RABIN2_ITEMCACHE"))) {
+		r_config_set (core.config, "bin.itemcache", tmp);
+		free (tmp);
+	}
 	if ((tmp = r_sys_getenv ("RABIN2_DEBASE64"))) {
 		r_config_set (core.config, "bin.str.debase64", tmp);
 		free (tmp);
@@ -671,7 +918,7 @@ R_API int r_main_rabin2(int argc, const char **argv) {
 #define set_action(x) { actions++; action |= (x); }
 #define unset_action(x) action &= ~x
 	RGetopt opt;
-	r_getopt_init (&opt, argc, argv, "DjgAf:F:a:B:G:b:cC:k:K:dD:Mm:n:N:@:isSVIHeEUlRwO:o:pPqQrTtvLhuxXzZ");
+	r_getopt_init (&opt, argc, argv, "DjgAf:F:a:B:G:b:cC:k:K:dD:J:Mm:n:N:@:isSVIHeEUlRwO:o:pPqQrTtvLhuxXzZ");
 	while ((c = r_getopt_next (&opt)) != -1) {
 		switch (c) {
 		case 'g':
@@ -702,6 +949,10 @@ R_API int r_main_rabin2(int argc, const char **argv) {
 				R_MODE_SIMPLEST : R_MODE_SIMPLE);
 			break;
 		case 'j': rad = R_MODE_JSON; break;
+		case 'J':
+			batch = true;
+			jobs = r_num_math (NULL, opt.arg);
+			break;
 		case 'A': set_action (R_BIN_REQ_LISTARCHS); break;
 		case 'a': arch = opt.arg; break;
 		case 'C':
@@ -1026,6 +1277,24 @@ R_API int r_main_rabin2(int argc, const char **argv) {
 	}
 	r_config_set_i (core.config, "bin.str.raw", rawstr);
 
+	if (batch && file) {
+		RabinBatch b = {
+			.core = &core,
+			.action = action,
+			.baddr = baddr,
+			.laddr = laddr,
+			.rawstr = rawstr,
+			.va = va,
+			.forcebin = forcebin,
+			.chksum = chksum,
+			.filter = { .offset = at, .name = name },
+		};
+		int rc = rabin_batch (&b, &state, argv + opt.ind, argc - opt.ind, jobs);
+		pj_free (pj);
+		r_core_fini (&core);
+		free (state.stdin_buf);
+		return rc;
+	}
 	if (!file) {
 		R_LOG_ERROR ("Missing file");
 		r_core_fini (&core);
@@ -1204,29 +1473,11 @@ R_API int r_main_rabin2(int argc, const char **argv) {
 		free (tmp);
 	}
 
-	run_action ("sections", R_BIN_REQ_SECTIONS, R_CORE_BIN_ACC_SECTIONS);
-	run_action ("segments", R_BIN_REQ_SEGMENTS, R_CORE_BIN_ACC_SEGMENTS);
-	run_action ("entries", R_BIN_REQ_ENTRIES, R_CORE_BIN_ACC_ENTRIES);
-	run_action ("initfini", R_BIN_REQ_INITFINI, R_CORE_BIN_ACC_INITFINI);
-	run_action ("main", R_BIN_REQ_MAIN, R_CORE_BIN_ACC_MAIN);
-	run_action ("imports", R_BIN_REQ_IMPORTS, R_CORE_BIN_ACC_IMPORTS);
-	run_action ("classes", R_BIN_REQ_CLASSES, R_CORE_BIN_ACC_CLASSES);
-	run_action ("symbols", R_BIN_REQ_SYMBOLS, R_CORE_BIN_ACC_SYMBOLS);
-	run_action ("exports", R_BIN_REQ_EXPORTS, R_CORE_BIN_ACC_EXPORTS);
-	run_action ("resources", R_BIN_REQ_RESOURCES, R_CORE_BIN_ACC_RESOURCES);
-	run_action ("strings", R_BIN_REQ_STRINGS, R_CORE_BIN_ACC_STRINGS);
-	run_action ("info", R_BIN_REQ_INFO, R_CORE_BIN_ACC_INFO);
-	run_action ("fields", R_BIN_REQ_FIELDS, R_CORE_BIN_ACC_FIELDS);
-	run_action ("header", R_BIN_REQ_HEADER, R_CORE_BIN_ACC_HEADER);
-	run_action ("libs", R_BIN_REQ_LIBS, R_CORE_BIN_ACC_LIBS);
-	run_action ("relocs", R_BIN_REQ_RELOCS, R_CORE_BIN_ACC_RELOCS);
-	run_action ("dwarf", R_BIN_REQ_DWARF, R_CORE_BIN_ACC_DWARF);
-	run_action ("pdb", R_BIN_REQ_PDB, R_CORE_BIN_ACC_PDB);
-	run_action ("size", R_BIN_REQ_SIZE, R_CORE_BIN_ACC_SIZE);
-	run_action ("versioninfo", R_BIN_REQ_VERSIONINFO, R_CORE_BIN_ACC_VERSIONINFO);
-	run_action ("sections", R_BIN_REQ_SIGNATURE, R_CORE_BIN_ACC_SIGNATURE);
-	run_action ("hashes", R_BIN_REQ_HASHES, R_CORE_BIN_ACC_HASHES);
-	run_action ("sections mapping", R_BIN_REQ_SECTIONS_MAPPING, R_CORE_BIN_ACC_SECTIONS_MAPPING);
+	size_t i;
+	for (i = 0; i < R_ARRAY_SIZE (rabin_actions); i++) {
+		const RabinAction *ra = &rabin_actions[i];
+		run_action (ra->name, ra->req, ra->acc);
+	}
 	if (action & R_BIN_REQ_SRCLINE) {
 		rabin_show_srcline (bin, at);
 	}
@@ -20,7 +20,11 @@ typedef struct {
 	bool json;
 	int mode;
 	int align;
+	int threads;
+	RThreadPool *pool; // workers of the keyword searches, see -T
 	ut8 *buf;
+	ut8 *win; // bytes around the hits of the threaded searches
+	ut64 winat;
 	ut64 bsize;
 	ut64 from;
 	ut64 to;
@@ -38,6 +42,7 @@ static void rafind_options_fini(RafindOptions *ro) {
 	// 	r_io_free (ro->io);
 		ro->io = NULL;
 		free (ro->buf);
+		R_FREE (ro->win);
 		ro->cur = 0;
 	}
 }
@@ -55,11 +60,42 @@ static void rafind_options_init(RafindOptions *ro) {
 
 static int rafind_open(RafindOptions *ro, const char *file);
 
+// bytes shown after a hit, see the string and hexdump below
+#define HIT_SPAN 128
+
+// The threaded searches report the hits in address order once the range is
+// scanned, their bytes are borrowed from io or read a window at a time
+static const ut8 *hit_data(RafindOptions *ro, ut64 addr) {
+	const ut8 *data;
+	if (r_io_peek_at (ro->io, addr, HIT_SPAN, &data)) {
+		return data;
+	}
+	if (!ro->win) {
+		ro->win = malloc (ro->bsize + HIT_SPAN);
+		if (!ro->win) {
+			return NULL;
+		}
+		ro->winat = UT64_MAX;
+	}
+	if (ro->winat == UT64_MAX || addr < ro->winat || addr - ro->winat > ro->bsize) {
+		memset (ro->win, 0, ro->bsize + HIT_SPAN);
+		r_io_pread_at (ro->io, addr, ro->win, ro->bsize + HIT_SPAN);
+		ro->winat = addr;
+	}
+	return ro->win + (addr - ro->winat);
+}
+
 static int hit(RSearchKeyword *kw, void *user, ut64 addr) {
 	RafindOptions *ro = (RafindOptions*)user;
 	ut8 *buf = ro->buf;
 	int delta = addr - ro->cur;
-	if (ro->cur > addr && (ro->cur - addr == kw->keyword_length - 1)) {
+	if (ro->pool) {
+		buf = (ut8 *)hit_data (ro, addr);
+		if (!buf) {
+			return 0;
+		}
+		delta = 0;
+	} else if (ro->cur > addr && (ro->cur - addr == kw->keyword_length - 1)) {
 		// This case occurs when there is hit in search left over
 		delta = ro->cur - addr;
 	}
@@ -152,14 +188,14 @@ static int hit(RSearchKeyword *kw, void *user, ut64 addr) {
 			}
 		}
 	}
-	if (buf != ro->buf) {
+	if (buf != ro->buf && !ro->pool) {
 		free (buf);
 	}
 	return 1;
 }
 
 static int show_help(const char *argv0, int line) {
-	printf ("Usage: %s [-mXnzZhqv] [-a align] [-b sz] [-f/t from/to] [-[e|s|S] str] [-x hex] -|file|dir ..\n", argv0);
+	printf ("Usage: %s [-mXnzZhqv] [-a align] [-b sz] [-f/t from/to] [-T threads] [-[e|s|S] str] [-x hex] -|file|dir ..\n", argv0);
 	if (line) {
 		return 0;
 	}
@@ -181,6 +217,7 @@ static int show_help(const char *argv0, int line) {
 	" -s [str]   search for a string (more than one string can be passed)\n"
 	" -S [str]   search for a wide string (more than one string can be passed).\n"
 	" -t [to]    stop search at address 'to'\n"
+	" -T [n]     use n threads to search for keywords\n"
 	" -q         quiet: fewer output do not show headings or filenames.\n"
 	" -v         print version and exit\n"
 	" -V [s:num] search for given value (-V 4:123) // assume local endian\n"
@@ -303,6 +340,16 @@ static int rafind_open_file(RafindOptions *ro, const char *file, const ut8 *data
 	r_search_begin (rs);
 	(void)r_io_seek (io, ro->from, R_IO_SEEK_SET);
 	result = 0;
+	if (ro->pool && ro->mode == R_SEARCH_KEYWORD) {
+		r_io_bind (io, &rs->iob);
+		r_cons_bind (&rs->consb);
+		rs->pool = ro->pool;
+		if (r_search_update_read (rs, ro->from, to) < 0) {
+			R_LOG_ERROR ("search.update read error at 0x%08"PFMT64x, ro->from);
+			result = 1;
+		}
+		goto done;
+	}
 	ut64 bsize = ro->bsize;
 	for (ro->cur = ro->from; !last && ro->cur < to; ro->cur += bsize) {
 		if ((ro->cur + bsize) > to) {
@@ -385,7 +432,7 @@ R_API int r_main_rafind2(int argc, const char **argv) {
 		return show_help (argv[0], 0);
 	}
 	RGetopt opt;
-	r_getopt_init (&opt, argc, argv, "a:ie:b:cjmM:s:S:x:Xzf:F:t:E:rqnhvZLV:");
+	r_getopt_init (&opt, argc, argv, "a:ie:b:cjmM:s:S:x:Xzf:F:t:T:E:rqnhvZLV:");
 	while ((c = r_getopt_next (&opt)) != -1) {
 		switch (c) {
 		case 'a':
@@ -409,6 +456,9 @@ R_API int r_main_rafind2(int argc, const char **argv) {
 		case 'n':
 			ro.nonstop = 1;
 			break;
+		case 'T':
+			ro.threads = (int)r_num_math (NULL, opt.arg);
+			break;
 		case 'm':
 			ro.mode = R_SEARCH_MAGIC;
 			break;
@@ -569,14 +619,20 @@ R_API int r_main_rafind2(int argc, const char **argv) {
 		ro.pj = pj_new ();
 		pj_a (ro.pj);
 	}
+	if (ro.threads > 1 && ro.mode == R_SEARCH_KEYWORD) {
+		// one pool for all the files
+		ro.pool = r_th_pool_new (ro.threads);
+	}
 	for (; opt.ind < argc; opt.ind++) {
 		file = argv[opt.ind];
 		if (file && !*file) {
 			R_LOG_ERROR ("Cannot open empty path");
+			r_th_pool_free (ro.pool);
 			return 1;
 		}
 		rafind_open (&ro, file);
 	}
+	r_th_pool_free (ro.pool);
 	r_list_free (ro.keywords);
 	if (ro.pj) {
 		pj_end (ro.pj);
@@ -8,6 +8,7 @@
 struct rasignconf {
 	const char *ofile, *space;
 	size_t a_cnt;
+	int threads;
 	bool merge, sdb, ar, rad, quiet, json, flirt, collision;
 };
 
@@ -18,16 +19,18 @@ static void rasign_show_help(void) {
 		" -f               interpret the file as a FLIRT .sig file and dump signatures\n"
 		" -h               help menu\n"
 		" -j               show signatures in json\n"
-		" -o sigs.sdb      add signatures to file, create if it does not exist\n"
+		" -o sigs.sdb      add signatures to file, create if it does not exist (.r2z: binary)\n"
 		" -q               quiet mode\n"
 		" -r               show output in radare commands\n"
 		" -S               perform operation on sdb signature file ('-o -' to save to same file)\n"
 		" -s signspace     save all signatures under this signspace\n"
+		" -t threads       number of threads used to compute the signatures\n"
 		" -c               add collision signatures before writing file\n"
 		" -v               show version information\n"
 		" -m               merge/overwrite signatures with same name\n"
 		"Examples:\n"
-		"  rasign2 -o libc.sdb libc.so.6\n");
+		"  rasign2 -o libc.sdb libc.so.6\n"
+		"  rasign2 -S -o libc.r2z libc.sdb\n");
 }
 
 static RCore *opencore(const char *fname) {
@@ -120,6 +123,9 @@ static int signs_from_file(const char *fname, struct rasignconf *conf) {
 		r_config_set_b (core->config, "scr.prompt", false);
 		r_config_set_i (core->config, "scr.color", COLOR_MODE_DISABLED);
 	}
+	if (conf->threads > 0) {
+		r_config_set_i (core->config, "zign.threads", conf->threads);
+	}
 	if (conf->space) {
 		r_spaces_set (&core->anal->zign_spaces, conf->space);
 	}
@@ -236,7 +242,7 @@ R_API int r_main_rasign2(int argc, const char **argv) {
 	RGetopt opt;
 	struct rasignconf conf = {0};
 
-	r_getopt_init (&opt, argc, argv, "Aafhjmo:qrSs:cv");
+	r_getopt_init (&opt, argc, argv, "Aafhjmo:qrSs:t:cv");
 	while ((c = r_getopt_next (&opt)) != -1) {
 		switch (c) {
 		case 'A':
@@ -257,6 +263,9 @@ R_API int r_main_rasign2(int argc, const char **argv) {
 		case 's':
 			conf.space = opt.arg;
 			break;
+		case 't':
+			conf.threads = atoi (opt.arg);
+			break;
 		case 'r':
 			conf.rad = true;
 			break;
@@ -0,0 +1,358 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+#include <r_search.h>
+#include "search.h"
+
+// Aho-Corasick automaton compiled from the keyword list, so the keyword search
+// scans every block once no matter how many keywords are loaded. Keywords with
+// a binmask are indexed by their longest fully unmasked run (the anchor) and
+// every candidate is verified by the caller. Keywords without any anchor are
+// reported at every offset and left to the verifier too.
+
+typedef struct {
+	ut8 c;
+	ut32 to;
+	ut32 next; // sibling link, only used while building
+} AhoEdge;
+
+typedef struct {
+	ut32 fail;
+	ut32 dict; // closest suffix state with outputs, 0 if none
+	ut32 out; // first pattern ending here (index + 1), 0 if none
+	ut32 edges; // offset in the edge table
+	ut32 nedges;
+} AhoState;
+
+typedef struct {
+	RSearchKeyword *kw;
+	ut32 order; // position in the keyword list
+	ut32 off; // anchor offset inside the keyword
+	ut32 len; // anchor length, 0 when the keyword has no anchor
+	ut32 next; // next pattern ending in the same state (index + 1)
+} AhoPattern;
+
+struct r_search_aho_t {
+	AhoState *states;
+	ut32 nstates;
+	ut32 sstates;
+	AhoEdge *edges;
+	ut32 nedges;
+	ut32 sedges;
+	ut32 root[256];
+	AhoPattern *pats;
+	ut32 npats;
+	ut8 map[256]; // identity, or tolower when any keyword ignores case
+	bool first[256]; // prefilter: input bytes that can start an anchor
+	int nfirst;
+	ut8 firstc;
+};
+
+static inline ut8 kw_mask(RSearchKeyword *kw, ut32 i) {
+	return kw->binmask_length? kw->bin_binmask[i % kw->binmask_length]: 0xff;
+}
+
+// pick the longest run of bytes that must match exactly
+static void find_anchor(RSearchKeyword *kw, ut32 *off, ut32 *len) {
+	ut32 i, cur = 0, best = 0, boff = 0;
+	for (i = 0; i < kw->keyword_length; i++) {
+		if (kw_mask (kw, i) == 0xff) {
+			cur++;
+			if (cur > best) {
+				best = cur;
+				boff = i + 1 - cur;
+			}
+		} else {
+			cur = 0;
+		}
+	}
+	*off = boff;
+	*len = best;
+}
+
+static ut32 new_state(RSearchAho *ac) {
+	if (ac->nstates == ac->sstates) {
+		ut32 n = ac->sstates? ac->sstates * 2: 64;
+		AhoState *s = realloc (ac->states, n * sizeof (AhoState));
+		if (!s) {
+			return 0;
+		}
+		ac->states = s;
+		ac->sstates = n;
+	}
+	memset (&ac->states[ac->nstates], 0, sizeof (AhoState));
+	return ac->nstates++;
+}
+
+static ut32 new_edge(RSearchAho *ac, ut32 from, ut8 c, ut32 to) {
+	if (ac->nedges == ac->sedges) {
+		ut32 n = ac->sedges? ac->sedges * 2: 64;
+		AhoEdge *e = realloc (ac->edges, n * sizeof (AhoEdge));
+		if (!e) {
+			return 0;
+		}
+		ac->edges = e;
+		ac->sedges = n;
+	}
+	AhoEdge *e = &ac->edges[ac->nedges];
+	e->c = c;
+	e->to = to;
+	e->next = ac->states[from].edges;
+	ac->states[from].edges = ++ac->nedges;
+	ac->states[from].nedges++;
+	return to;
+}
+
+static ut32 build_goto(RSearchAho *ac, ut32 st, ut8 c) {
+	if (!st) {
+		return ac->root[c];
+	}
+	ut32 e = ac->states[st].edges;
+	while (e) {
+		AhoEdge *edge = &ac->edges[e - 1];
+		if (edge->c == c) {
+			return edge->to;
+		}
+		e = edge->next;
+	}
+	return 0;
+}
+
+static bool add_pattern(RSearchAho *ac, ut32 idx) {
+	AhoPattern *p = &ac->pats[idx];
+	const ut8 *data = p->kw->bin_keyword + p->off;
+	ut32 i, st = 0;
+	for (i = 0; i < p->len; i++) {
+		ut8 c = ac->map[data[i]];
+		ut32 nx = build_goto (ac, st, c);
+		if (!nx) {
+			nx = new_state (ac);
+			if (!nx) {
+				return false;
+			}
+			if (st) {
+				if (!new_edge (ac, st, c, nx)) {
+					return false;
+				}
+			} else {
+				ac->root[c] = nx;
+			}
+		}
+		st = nx;
+	}
+	p->next = ac->states[st].out;
+	ac->states[st].out = idx + 1;
+	return true;
+}
+
+static int edge_cmp(const void *a, const void *b) {
+	return (int)((const AhoEdge *)a)->c - (int)((const AhoEdge *)b)->c;
+}
+
+// store the children of every state contiguously and sorted by byte
+static bool compact_edges(RSearchAho *ac) {
+	AhoEdge *edges = ac->nedges? calloc (ac->nedges, sizeof (AhoEdge)): NULL;
+	if (ac->nedges && !edges) {
+		return false;
+	}
+	ut32 i, n = 0;
+	for (i = 1; i < ac->nstates; i++) {
+		AhoState *st = &ac->states[i];
+		ut32 first = n, e = st->edges;
+		while (e) {
+			edges[n++] = ac->edges[e - 1];
+			e = ac->edges[e - 1].next;
+		}
+		qsort (edges + first, n - first, sizeof (AhoEdge), edge_cmp);
+		st->edges = first;
+	}
+	free (ac->edges);
+	ac->edges = edges;
+	ac->sedges = n;
+	return true;
+}
+
+static inline ut32 child(const RSearchAho *ac, ut32 st, ut8 c) {
+	const AhoState *s = &ac->states[st];
+	const AhoEdge *e = ac->edges + s->edges;
+	ut32 lo = 0, hi = s->nedges;
+	while (lo < hi) {
+		ut32 mid = (lo + hi) / 2;
+		if (e[mid].c == c) {
+			return e[mid].to;
+		}
+		if (e[mid].c < c) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return 0;
+}
+
+static inline ut32 step(const RSearchAho *ac, ut32 st, ut8 c) {
+	while (st) {
+		ut32 nx = child (ac, st, c);
+		if (nx) {
+			return nx;
+		}
+		st = ac->states[st].fail;
+	}
+	return ac->root[c];
+}
+
+static bool build_links(RSearchAho *ac) {
+	ut32 *queue = malloc (ac->nstates * sizeof (ut32));
+	if (!queue) {
+		return false;
+	}
+	ut32 head = 0, tail = 0;
+	int c;
+	for (c = 0; c < 256; c++) {
+		ut32 st = ac->root[c];
+		if (st) {
+			ac->states[st].fail = 0;
+			ac->states[st].dict = 0;
+			queue[tail++] = st;
+		}
+	}
+	while (head < tail) {
+		ut32 u = queue[head++];
+		AhoState *us = &ac->states[u];
+		ut32 i;
+		for (i = 0; i < us->nedges; i++) {
+			AhoEdge *e = &ac->edges[us->edges + i];
+			ut32 v = e->to;
+			ut32 f = step (ac, us->fail, e->c);
+			ac->states[v].fail = f;
+			ac->states[v].dict = ac->states[f].out? f: ac->states[f].dict;
+			queue[tail++] = v;
+		}
+	}
+	free (queue);
+	return true;
+}
+
+R_IPI RSearchAho *search_aho_new(RList *kws) {
+	r_return_val_if_fail (kws, NULL);
+	RSearchAho *ac = R_NEW0 (RSearchAho);
+	if (!ac) {
+		return NULL;
+	}
+	ac->npats = r_list_length (kws);
+	ac->pats = calloc (R_MAX (ac->npats, 1), sizeof (AhoPattern));
+	// state 0 is the root, its transitions live in the dense root table
+	ac->states = R_NEW0 (AhoState);
+	ac->nstates = ac->sstates = 1;
+	if (!ac->pats || !ac->states) {
+		search_aho_free (ac);
+		return NULL;
+	}
+	bool fold = false;
+	RListIter *iter;
+	RSearchKeyword *kw;
+	r_list_foreach (kws, iter, kw) {
+		if (kw->icase) {
+			fold = true;
+			break;
+		}
+	}
+	int i;
+	for (i = 0; i < 256; i++) {
+		ac->map[i] = fold? tolower (i): i;
+	}
+	ut32 idx = 0;
+	r_list_foreach (kws, iter, kw) {
+		AhoPattern *p = &ac->pats[idx];
+		p->kw = kw;
+		p->order = idx;
+		find_anchor (kw, &p->off, &p->len);
+		if (p->len && !add_pattern (ac, idx)) {
+			search_aho_free (ac);
+			return NULL;
+		}
+		idx++;
+	}
+	if (!compact_edges (ac) || !build_links (ac)) {
+		search_aho_free (ac);
+		return NULL;
+	}
+	for (i = 0; i < 256; i++) {
+		if (ac->root[ac->map[i]]) {
+			ac->first[i] = true;
+			ac->firstc = i;
+			ac->nfirst++;
+		}
+	}
+	return ac;
+}
+
+R_IPI void search_aho_free(RSearchAho *ac) {
+	if (ac) {
+		free (ac->states);
+		free (ac->edges);
+		free (ac->pats);
+		free (ac);
+	}
+}
+
+// skip bytes that cannot start any anchor, returns len when there are none left
+static inline int prefilter(const RSearchAho *ac, const ut8 *buf, int i, int len) {
+	if (ac->nfirst == 1) {
+		// memchr is vectorized by the libc
+		const ut8 *p = memchr (buf + i, ac->firstc, len - i);
+		return p? p - buf: len;
+	}
+	while (i < len && !ac->first[buf[i]]) {
+		i++;
+	}
+	return i;
+}
+
+// Call cb for every offset in buf where a keyword may start, candidates of
+// masked, case-insensitive or unanchored keywords must be verified by cb
+R_IPI int search_aho_find(RSearchAho *ac, const ut8 *buf, int len, RSearchAhoCallback cb, void *user) {
+	r_return_val_if_fail (ac && buf && cb, -1);
+	ut32 st = 0;
+	int i, n = 0;
+	if (ac->nfirst) {
+		for (i = 0; i < len; i++) {
+			if (!st) {
+				i = prefilter (ac, buf, i, len);
+				if (i >= len) {
+					break;
+				}
+			}
+			st = step (ac, st, ac->map[buf[i]]);
+			ut32 o = ac->states[st].out? st: ac->states[st].dict;
+			while (o) {
+				ut32 pi = ac->states[o].out;
+				while (pi) {
+					AhoPattern *p = &ac->pats[pi - 1];
+					st64 start = (st64)i + 1 - p->len - p->off;
+					if (start >= 0 && start + p->kw->keyword_length <= len) {
+						if (!cb (p->kw, p->order, (int)start, user)) {
+							return -1;
+						}
+						n++;
+					}
+					pi = p->next;
+				}
+				o = ac->states[o].dict;
+			}
+		}
+	}
+	ut32 j;
+	for (j = 0; j < ac->npats; j++) {
+		AhoPattern *p = &ac->pats[j];
+		if (p->len) {
+			continue;
+		}
+		for (i = 0; i + (int)p->kw->keyword_length <= len; i++) {
+			if (!cb (p->kw, p->order, i, user)) {
+				return -1;
+			}
+			n++;
+		}
+	}
+	return n;
+}
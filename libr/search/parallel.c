@@ -0,0 +1,245 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+#define R_LOG_ORIGIN "search.threads"
+
+#include <r_search.h>
+#include "search.h"
+
+// The range is split in chunks that overlap by the longest keyword, every
+// task of the shared pool scans the chunks with a private copy of the search
+// and the hits are reported back in address order by the calling thread, so
+// the callbacks, search.align and search.maxhits behave the same as in a
+// sequential scan.
+
+#define CHUNK_SIZE (1024 * 1024)
+#define CHUNKS_PER_THREAD 4
+
+typedef struct {
+	RSearchKeyword *kw;
+	ut64 addr;
+	int size;
+} ChunkHit;
+
+typedef struct {
+	ut64 from;
+	ut64 to; // hits must start before this address
+	int len; // bytes to scan, including the overlap with the next chunk
+	RVector hits;
+} SearchChunk;
+
+typedef struct {
+	RSearch *s;
+	RThreadLock *lock; // serializes io reads and chunk dispatching
+	SearchChunk *chunks;
+	int nchunks;
+	int next;
+	int bsize;
+} SearchJob;
+
+typedef struct {
+	SearchJob *job;
+	SearchChunk *chunk;
+	RSearch shadow;
+	ut8 *buf;
+} SearchWorker;
+
+R_IPI bool search_parallel_supported(RSearch *s) {
+	// inverse and distance searches depend on the previous blocks
+	return s->threads != 1 && s->pool && s->pool->size > 1
+		&& s->mode == R_SEARCH_KEYWORD && !s->bckwrds
+		&& !s->inverse && !s->distance && !r_list_empty (s->kws);
+}
+
+static int worker_hit(RSearchKeyword *kw, int mlen, void *user, ut64 where) {
+	SearchWorker *w = user;
+	if (where < w->chunk->to) {
+		// the clone keeps the original keyword in its data field
+		ChunkHit h = { kw->data, where, mlen };
+		if (!r_vector_push (&w->chunk->hits, &h)) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static bool worker_init(SearchWorker *w, SearchJob *job) {
+	RSearch *s = job->s;
+	w->job = job;
+	w->shadow = *s;
+	RSearch *ws = &w->shadow;
+	ws->data = NULL;
+	ws->datafree = free;
+	ws->aho = NULL;
+	ws->hits = NULL;
+	ws->callback = NULL;
+	ws->r_callback = worker_hit;
+	ws->user = w;
+	ws->nhits = 0;
+	ws->maxhits = 0;
+	ws->align = 0;
+	ws->bckwrds = false;
+	// report everything, overlaps and sequential hits are resolved when merging
+	ws->overlap = true;
+	ws->contiguous = true;
+	ws->kws = r_list_newf ((RListFree)r_search_keyword_free);
+	w->buf = malloc (job->bsize);
+	if (!ws->kws || !w->buf) {
+		return false;
+	}
+	RListIter *iter;
+	RSearchKeyword *kw;
+	r_list_foreach (s->kws, iter, kw) {
+		RSearchKeyword *k = r_search_keyword_new (kw->bin_keyword, kw->keyword_length,
+			kw->bin_binmask, kw->binmask_length, NULL);
+		if (!k) {
+			return false;
+		}
+		k->data = kw;
+		k->type = kw->type;
+		k->icase = kw->icase;
+		k->kwidx = kw->kwidx;
+		r_list_append (ws->kws, k);
+	}
+	return true;
+}
+
+static void worker_fini(SearchWorker *w) {
+	RSearch *ws = &w->shadow;
+	search_aho_free (ws->aho);
+	if (ws->datafree) {
+		ws->datafree (ws->data);
+	}
+	r_list_free (ws->kws);
+	free (w->buf);
+}
+
+static void worker_run(SearchWorker *w) {
+	SearchJob *job = w->job;
+	RSearch *s = job->s;
+	while (true) {
+		r_th_lock_enter (job->lock);
+		if (job->next >= job->nchunks) {
+			r_th_lock_leave (job->lock);
+			break;
+		}
+		SearchChunk *c = &job->chunks[job->next++];
+		// io is not thread safe, but the borrowed bytes can be scanned unlocked
+		const ut8 *data = w->buf;
+		if (!s->iob.peek_at || !s->iob.peek_at (s->iob.io, c->from, c->len, &data)) {
+			(void)s->iob.read_at (s->iob.io, c->from, w->buf, c->len);
+			data = w->buf;
+		}
+		r_th_lock_leave (job->lock);
+		w->chunk = c;
+		if (w->shadow.update (&w->shadow, c->from, data, c->len) < 0) {
+			R_LOG_DEBUG ("search failed at 0x%08"PFMT64x, c->from);
+		}
+	}
+}
+
+static void worker_range(void *user, size_t from, size_t to) {
+	SearchWorker *workers = user;
+	size_t i;
+	for (i = from; i < to; i++) {
+		worker_run (&workers[i]);
+	}
+}
+
+static int hit_cmp(const void *a, const void *b) {
+	const ChunkHit *ha = a, *hb = b;
+	if (ha->addr != hb->addr) {
+		return ha->addr < hb->addr? -1: 1;
+	}
+	return ha->kw->kwidx - hb->kw->kwidx;
+}
+
+// Returns -1 on error, 2 when maxhits is reached, 1 otherwise
+static int report_hits(RSearch *s, SearchChunk *c) {
+	qsort (c->hits.a, c->hits.len, sizeof (ChunkHit), hit_cmp);
+	ChunkHit *h;
+	r_vector_foreach (&c->hits, h) {
+		RSearchKeyword *kw = h->kw;
+		if (!s->overlap && kw->count && h->addr < kw->last) {
+			continue;
+		}
+		int t = r_search_hit_sz (s, kw, h->addr, h->size);
+		if (!t) {
+			return -1;
+		}
+		if (t > 1) {
+			return 2;
+		}
+	}
+	return 1;
+}
+
+static int search_batch(SearchJob *job, SearchWorker *workers, int nthreads) {
+	// one task per worker, each of them takes the next chunk when it is done
+	if (!r_th_parallel_for (job->s->pool, 0, nthreads, 1, worker_range, workers)) {
+		return -1;
+	}
+	int i, ret = 1;
+	for (i = 0; i < job->nchunks && ret == 1; i++) {
+		ret = report_hits (job->s, &job->chunks[i]);
+	}
+	return ret;
+}
+
+R_IPI int search_parallel(RSearch *s, ut64 from, ut64 to) {
+	r_return_val_if_fail (s && s->update && s->iob.read_at, -1);
+	const int size = s->pool->size;
+	const int nthreads = (s->threads > 1)? R_MIN (s->threads, size): size;
+	const int maxchunks = nthreads * CHUNKS_PER_THREAD;
+	const ut64 old_nhits = s->nhits;
+	int i, ret = 1, overlap = 0;
+	RListIter *iter;
+	RSearchKeyword *kw;
+	r_list_foreach (s->kws, iter, kw) {
+		overlap = R_MAX (overlap, (int)kw->keyword_length - 1);
+	}
+	SearchJob job = { s, r_th_lock_new (false) };
+	job.chunks = R_NEWS0 (SearchChunk, maxchunks);
+	job.bsize = CHUNK_SIZE + overlap;
+	SearchWorker *workers = R_NEWS0 (SearchWorker, nthreads);
+	if (!job.lock || !job.chunks || !workers) {
+		ret = -1;
+		goto beach;
+	}
+	for (i = 0; i < nthreads; i++) {
+		if (!worker_init (&workers[i], &job)) {
+			ret = -1;
+			goto beach;
+		}
+	}
+	ut64 at = from;
+	while (at < to && ret == 1) {
+		if (s->consb.is_breaked && s->consb.is_breaked ()) {
+			break;
+		}
+		job.nchunks = 0;
+		job.next = 0;
+		while (at < to && job.nchunks < maxchunks) {
+			SearchChunk *c = &job.chunks[job.nchunks++];
+			ut64 size = R_MIN (to - at, CHUNK_SIZE);
+			c->from = at;
+			c->to = at + size;
+			c->len = (int)R_MIN (to - at, size + overlap);
+			r_vector_init (&c->hits, sizeof (ChunkHit), NULL, NULL);
+			at += size;
+		}
+		ret = search_batch (&job, workers, R_MIN (nthreads, job.nchunks));
+		for (i = 0; i < job.nchunks; i++) {
+			r_vector_fini (&job.chunks[i].hits);
+		}
+	}
+beach:
+	if (workers) {
+		for (i = 0; i < nthreads; i++) {
+			worker_fini (&workers[i]);
+		}
+	}
+	free (workers);
+	r_th_lock_free (job.lock);
+	free (job.chunks);
+	return (ret < 0)? -1: (int)(s->nhits - old_nhits);
+}
@@ -42,6 +42,7 @@ R_API RSearch *r_search_new(int mode) {
 	s->string_min = 3;
 	s->hits = r_list_newf (free);
 	s->maxhits = 0;
+	s->threads = 0;
 	// TODO: review those mempool sizes. ensure never gets NULL
 	s->kws = r_list_newf (free);
 	if (!s->kws) {
@@ -54,6 +55,7 @@ R_API RSearch *r_search_new(int mode) {
 
 R_API void r_search_free(RSearch *s) {
 	if (s) {
+		search_aho_free (s->aho);
 		r_list_free (s->hits);
 		r_list_free (s->kws);
 		//r_io_free(s->iob.io); this is supposed to be a weak reference
@@ -114,6 +116,11 @@ R_API int r_search_begin(RSearch *s) {
 		kw->count = 0;
 		kw->last = 0;
 	}
+	search_aho_free (s->aho);
+	s->aho = NULL;
+	if (s->mode == R_SEARCH_KEYWORD && !r_list_empty (s->kws)) {
+		s->aho = search_aho_new (s->kws);
+	}
 	return true;
 }
 
@@ -393,6 +400,101 @@ static bool brute_force_match(RSearch *s, RSearchKeyword *kw, const ut8 *buf, in
 	return j == kw->keyword_length;
 }
 
+typedef struct {
+	RSearch *s;
+	const ut8 *buf;
+	int seg;
+	RVector cands;
+} AhoScan;
+
+typedef struct {
+	RSearchKeyword *kw;
+	ut32 order;
+	int seg; // 0 for the leftover, 1 for the block
+	int start;
+} AhoCand;
+
+static int aho_cand_cmp(const void *a, const void *b) {
+	const AhoCand *ca = a, *cb = b;
+	if (ca->order != cb->order) {
+		return ca->order < cb->order? -1: 1;
+	}
+	if (ca->seg != cb->seg) {
+		return ca->seg - cb->seg;
+	}
+	return ca->start - cb->start;
+}
+
+static int aho_cand_cb(RSearchKeyword *kw, ut32 order, int start, void *user) {
+	AhoScan *as = user;
+	if (brute_force_match (as->s, kw, as->buf, start)) {
+		AhoCand c = { kw, order, as->seg, start };
+		return r_vector_push (&as->cands, &c) != NULL;
+	}
+	return 1;
+}
+
+static inline bool use_aho(RSearch *s) {
+	if (s->inverse || s->distance) {
+		return false;
+	}
+	if (!s->aho) {
+		s->aho = search_aho_new (s->kws);
+	}
+	return s->aho != NULL;
+}
+
+// Same as the brute force loops in search_kw_update: for every keyword the
+// leftover is searched first and then the block, honoring search.overlap.
+// Returns -1 on error, 2 when maxhits is reached, 1 otherwise
+static int aho_update(RSearch *s, ut64 from, RSearchLeftover *left, int len1, const ut8 *buf, int len) {
+	AhoScan as = { s, left->data, 0 };
+	r_vector_init (&as.cands, sizeof (AhoCand), NULL, NULL);
+	if (search_aho_find (s->aho, left->data, len1, aho_cand_cb, &as) < 0) {
+		r_vector_fini (&as.cands);
+		return -1;
+	}
+	as.buf = buf;
+	as.seg = 1;
+	if (search_aho_find (s->aho, buf, len, aho_cand_cb, &as) < 0) {
+		r_vector_fini (&as.cands);
+		return -1;
+	}
+	qsort (as.cands.a, as.cands.len, sizeof (AhoCand), aho_cand_cmp);
+	int ret = 1;
+	RSearchKeyword *kw = NULL;
+	int seg = -1;
+	ut64 at = from, next = 0;
+	AhoCand *c;
+	r_vector_foreach (&as.cands, c) {
+		int limit = c->seg? len: left->len;
+		if (c->start >= limit) {
+			continue;
+		}
+		if (c->kw != kw || c->seg != seg) {
+			kw = c->kw;
+			seg = c->seg;
+			at = seg? from: s->bckwrds? from + left->len: from - left->len;
+			ut64 d = s->bckwrds? at - kw->last: kw->last - at;
+			next = (s->overlap || !kw->count || d > limit)? 0: d;
+		}
+		if ((ut64)c->start < next) {
+			continue;
+		}
+		ut64 addr = s->bckwrds? at - kw->keyword_length - c->start: at + c->start;
+		int t = r_search_hit_new (s, kw, addr);
+		if (!t || t > 1) {
+			ret = t? t: -1;
+			break;
+		}
+		if (!s->overlap) {
+			next = c->start + kw->keyword_length;
+		}
+	}
+	r_vector_fini (&as.cands);
+	return ret;
+}
+
 // Supported search variants: backward, binmask, icase, inverse, overlap
 R_IPI int search_kw_update(RSearch *s, ut64 from, const ut8 *buf, int len) {
 	RSearchKeyword *kw;
@@ -430,6 +532,16 @@ R_IPI int search_kw_update(RSearch *s, ut64 from, const ut8 *buf, int len) {
 
 	ut64 len1 = left->len + R_MIN (longest - 1, len);
 	memcpy (left->data + left->len, buf, len1 - left->len);
+	if (use_aho (s)) {
+		int t = aho_update (s, from, left, len1, buf, len);
+		if (t < 0) {
+			return -1;
+		}
+		if (t > 1) {
+			return s->nhits - old_nhits;
+		}
+		goto leftover;
+	}
 	r_list_foreach (s->kws, iter, kw) {
 		i = s->overlap || !kw->count ? 0 :
 				s->bckwrds
@@ -468,6 +580,7 @@ R_IPI int search_kw_update(RSearch *s, ut64 from, const ut8 *buf, int len) {
 			}
 		}
 	}
+leftover:
 	if (len < longest - 1) {
 		if (len1 < longest) {
 			left->len = len1;
@@ -525,10 +638,42 @@ R_API int r_search_update(RSearch *s, ut64 from, const ut8 *buf, long len) {
 	return ret;
 }
 
+static int search_kw_read(RSearch *s, ut64 from, ut64 to) {
+	if (search_parallel_supported (s)) {
+		return search_parallel (s, from, to);
+	}
+	const int bsize = 0x10000;
+	ut8 *buf = malloc (bsize);
+	if (!buf) {
+		return -1;
+	}
+	const ut64 old_nhits = s->nhits;
+	ut64 at;
+	for (at = from; at < to; at += bsize) {
+		if (s->consb.is_breaked () || (s->maxhits && s->nhits >= s->maxhits)) {
+			break;
+		}
+		int len = (int)R_MIN (to - at, bsize);
+		const ut8 *data = buf;
+		if (!s->iob.peek_at || !s->iob.peek_at (s->iob.io, at, len, &data)) {
+			(void)s->iob.read_at (s->iob.io, at, buf, len);
+			data = buf;
+		}
+		if (r_search_update (s, at, data, len) < 0) {
+			free (buf);
+			return -1;
+		}
+	}
+	free (buf);
+	return s->nhits - old_nhits;
+}
+
 // like r_search_update but uses s->iob, does not need to loop as much
 R_API int r_search_update_read(RSearch *s, ut64 from, ut64 to) {
 	r_return_val_if_fail (s && s->iob.read_at && s->consb.is_breaked, -1);
 	switch (s->mode) {
+	case R_SEARCH_KEYWORD:
+		return search_kw_read (s, from, to);
 	case R_SEARCH_PATTERN:
 		return search_pattern (s, from, to);
 	case R_SEARCH_REGEXP:
@@ -613,6 +758,8 @@ R_API int r_search_kw_add(RSearch *s, RSearchKeyword *kw) {
 	s->longest = R_MAX ((int)kw->keyword_length, s->longest);
 	kw->kwidx = s->n_kws++;
 	r_list_append (s->kws, kw);
+	search_aho_free (s->aho);
+	s->aho = NULL;
 	return true;
 }
 
@@ -620,6 +767,9 @@ R_API int r_search_kw_add(RSearch *s, RSearchKeyword *kw) {
 R_API void r_search_string_prepare_backward(RSearch *s) {
 	RListIter *iter;
 	RSearchKeyword *kw;
+	// the automaton must be rebuilt from the reversed keywords
+	search_aho_free (s->aho);
+	s->aho = NULL;
 	// Precondition: !kw->binmask_length || kw->keyword_length % kw->binmask_length == 0
 	r_list_foreach (s->kws, iter, kw) {
 		ut8 *i = kw->bin_keyword, *j = kw->bin_keyword + kw->keyword_length;
@@ -647,6 +797,8 @@ R_API void r_search_reset(RSearch *s, int mode) {
 
 R_API void r_search_kw_reset(RSearch *s) {
 	s->longest = -1;
+	search_aho_free (s->aho);
+	s->aho = NULL;
 	r_list_purge (s->kws);
 	r_list_purge (s->hits);
 	if (s->datafree) {
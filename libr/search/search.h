@@ -14,3 +14,13 @@ R_IPI int search_rk(RSearch *s, ut64 from, ut64 to);
 R_IPI int search_tire(RSearch *srch, ut64 from, ut64 to);
 
 R_IPI int r_search_hit_sz(RSearch *s, RSearchKeyword *kw, ut64 addr, ut32 sz);
+
+// multi-keyword automaton, see aho.c
+typedef int (*RSearchAhoCallback)(RSearchKeyword *kw, ut32 order, int start, void *user);
+R_IPI RSearchAho *search_aho_new(RList *kws);
+R_IPI void search_aho_free(RSearchAho *ac);
+R_IPI int search_aho_find(RSearchAho *ac, const ut8 *buf, int len, RSearchAhoCallback cb, void *user);
+
+// chunked multi-threaded keyword search, see parallel.c
+R_IPI bool search_parallel_supported(RSearch *s);
+R_IPI int search_parallel(RSearch *s, ut64 from, ut64 to);
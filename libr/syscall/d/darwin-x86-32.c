@@ -0,0 +1,937 @@
+// SDB-CGEN V1.9.4
+// gcc -DMAIN=1 darwin_x86_32.c ; ./a.out > darwin_x86_32.h
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+struct kv { const char *name; const char *value; };
+static const struct kv kvs[] = {
+  {"semaphore_signal_all_trap","0x80,0x22,1,"}, 
+  {"write_nocancel","0x80,0x18d,3,"}, 
+  {"setpgid","0x80,0x52,2,"}, 
+  {"fpathconf","0x80,0xc0,2,"}, 
+  {"0x80.0x89","rmdir"}, 
+  {"fstatat64","0x80,0x1d6,4,"}, 
+  {"0x80.0x88","mkdir"}, 
+  {"0x80.0x112","sysctlbyname"}, 
+  {"0x80.0xfe","semctl"}, 
+  {"0x80.0x111","sem_post"}, 
+  {"0x80.0xfd","shmsys"}, 
+  {"0x80.0x110","sem_trywait"}, 
+  {"fchown","0x80,0x7b,3,"}, 
+  {"0x80.0x117","stat_extended"}, 
+  {"0x80.0xff","semget"}, 
+  {"0x80.0x116","umask_extended"}, 
+  {"chroot","0x80,0x3d,1,"}, 
+  {"unmount","0x80,0x9f,2,"}, 
+  {"0x80.0x83","flock"}, 
+  {"0x80.0xfa","minherit"}, 
+  {"0x80.0x115","open_extended"}, 
+  {"exit","0x80,0x1,1,"}, 
+  {"acct","0x80,0x33,1,"}, 
+  {"0x80.0xfc","msgsys"}, 
+  {"shutdown","0x80,0x86,2,"}, 
+  {"0x80.0x80","rename"}, 
+  {"0x80.0xfb","semsys"}, 
+  {"0x80.0x87","socketpair"}, 
+  {"0x80.0x119","fstat_extended"}, 
+  {"0x80.0x86","shutdown"}, 
+  {"0x80.0x118","lstat_extended"}, 
+  {"0x80.0x85","sendto"}, 
+  {"0x80.0x84","mkfifo"}, 
+  {"_kernelrpc_mach_port_deallocate_trap","0x80,0x12,2,"}, 
+  {"0x80.0x16e","bsdthread_register"}, 
+  {"0x80.0x16f","workq_open"}, 
+  {"0x80.0x16a","kqueue"}, 
+  {"0x80.0x16b","kevent"}, 
+  {"setegid","0x80,0xb6,1,"}, 
+  {"0x80.0x16c","lchown"}, 
+  {"kdebug_typefilter","0x80,0xb1,2,"}, 
+  {"recvmsg","0x80,0x1b,3,"}, 
+  {"setxattr","0x80,0xec,6,"}, 
+  {"thread_selfid","0x80,0x174,0,"}, 
+  {"0x80.0x98","setprivexec"}, 
+  {"0x80.0x99","pread"}, 
+  {"0x80.0xd8","open_dprotected_np"}, 
+  {"0x80.0x147","issetugid"}, 
+  {"0x80.0x144","mlockall"}, 
+  {"0x80.0x145","munlockall"}, 
+  {"csops","0x80,0xa9,4,"}, 
+  {"0x80.0x142","iopolicysys"}, 
+  {"swtch","0x80,0x3c,0,"}, 
+  {"0x80.0x143","process_policy"}, 
+  {"setsgroups","0x80,0x11f,2,"}, 
+  {"0x80.0x140","lio_listio"}, 
+  {"0x80.0x93","setsid"}, 
+  {"fchmodat","0x80,0x1d3,4,"}, 
+  {"fsctl","0x80,0xf2,4,"}, 
+  {"sigaction","0x80,0x2e,3,"}, 
+  {"0x80.0x97","getpgid"}, 
+  {"ioctl","0x80,0x36,3,"}, 
+  {"0x80.0x148","__pthread_kill"}, 
+  {"0x80.0x149","__pthread_sigmask"}, 
+  {"msgsys","0x80,0xfc,5,"}, 
+  {"0x80.0x11c","access_extended"}, 
+  {"0x80.0x11b","fchmod_extended"}, 
+  {"_kernelrpc_mach_vm_map_trap","0x80,0xf,6,"}, 
+  {"0x80.0xe6","poll"}, 
+  {"0x80.0x11a","chmod_extended"}, 
+  {"0x80.0xe7","watchevent"}, 
+  {"_kernelrpc_mach_port_insert_member_trap","0x80,0x16,3,"}, 
+  {"0x80.0xe4","fgetattrlist"}, 
+  {"0x80.0xe5","fsetattrlist"}, 
+  {"0x80.0x11f","setsgroups"}, 
+  {"0x80.0xe2","delete"}, 
+  {"0x80.0x11e","gettid"}, 
+  {"fchdir","0x80,0xd,1,"}, 
+  {"0x80.0xe3","copyfile"}, 
+  {"0x80.0x11d","settid"}, 
+  {"0x80.0xe1","searchfs"}, 
+  {"statfs64","0x80,0x159,2,"}, 
+  {"setuid","0x80,0x17,1,"}, 
+  {"mprotect","0x80,0x4a,3,"}, 
+  {"fsgetpath","0x80,0x1ab,4,"}, 
+  {"0x80.0xe8","waitevent"}, 
+  {"0x80.0x175","ledger"}, 
+  {"0x80.0xe9","modwatch"}, 
+  {"0x80.0x174","thread_selfid"}, 
+  {"0x80.0x177","kevent_id"}, 
+  {"0x80.0x176","kevent_qos"}, 
+  {"0x80.0x171","kevent64"}, 
+  {"0x80.0x170","workq_kernreturn"}, 
+  {"quotactl","0x80,0xa5,4,"}, 
+  {"0x80.0x173","__old_semwait_signal_nocancel"}, 
+  {"__mac_get_mount","0x80,0x1a9,2,"}, 
+  {"0x80.0x172","__old_semwait_signal"}, 
+  {"swtch_pri","0x80,0x3b,0,"}, 
+  {"psynch_rw_wrlock","0x80,0x133,5,"}, 
+  {"sendmsg","0x80,0x1c,3,"}, 
+  {"setaudit_addr","0x80,0x166,2,"}, 
+  {"umask_extended","0x80,0x116,2,"}, 
+  {"mk_timer_arm_leeway_trap","0x80,0x5f,4,"}, 
+  {"_kernelrpc_mach_port_mod_refs_trap","0x80,0x13,4,"}, 
+  {"pfz_exit","0x80,0x3a,0,"}, 
+  {"fsync","0x80,0x5f,1,"}, 
+  {"stat64_extended","0x80,0x155,4,"}, 
+  {"aio_return","0x80,0x13a,1,"}, 
+  {"setreuid","0x80,0x7e,2,"}, 
+  {"work_interval_ctl","0x80,0x1f3,4,"}, 
+  {"psynch_cvclrprepost","0x80,0x138,7,"}, 
+  {"0x80.0x8c","adjtime"}, 
+  {"0x80.0x8b","futimes"}, 
+  {"0x80.0x8a","utimes"}, 
+  {"0x80.0x18b","pselect_nocancel"}, 
+  {"select","0x80,0x5d,5,"}, 
+  {"0x80.0x18c","read_nocancel"}, 
+  {"_kernelrpc_mach_port_move_member_trap","0x80,0x14,3,"}, 
+  {"kevent_qos","0x80,0x176,8,"}, 
+  {"0x80.0x18a","pselect"}, 
+  {"0x80.0x8e","gethostuuid"}, 
+  {"0x80.0x18f","close_nocancel"}, 
+  {"psynch_rw_upgrade","0x80,0x12c,5,"}, 
+  {"sfi_ctl","0x80,0x1c8,4,"}, 
+  {"__mac_set_file","0x80,0x17f,2,"}, 
+  {"0x80.0x18d","write_nocancel"}, 
+  {"0x80.0x18e","open_nocancel"}, 
+  {"macx_triggers","0x80,0x33,4,"}, 
+  {"setpriority","0x80,0x60,3,"}, 
+  {"bsdthread_ctl","0x80,0x1de,4,"}, 
+  {"wait4","0x80,0x7,4,"}, 
+  {"fgetattrlist","0x80,0xe4,5,"}, 
+  {"pid_hibernate","0x80,0x1b3,1,"}, 
+  {"setitimer","0x80,0x53,3,"}, 
+  {"audit","0x80,0x15e,2,"}, 
+  {"msgget","0x80,0x103,2,"}, 
+  {"fileport_makeport","0x80,0x1ae,2,"}, 
+  {"disconnectx","0x80,0x1c0,3,"}, 
+  {"0x80.0x9b","nfssvc"}, 
+  {"proc_trace_log","0x80,0x1dd,2,"}, 
+  {"necp_session_action","0x80,0x20b,6,"}, 
+  {"0x80.0x9a","pwrite"}, 
+  {"0x80.0x9f","unmount"}, 
+  {"connect_nocancel","0x80,0x199,3,"}, 
+  {"listen","0x80,0x6a,2,"}, 
+  {"munlockall","0x80,0x145,1,"}, 
+  {"0x80.0x9d","statfs"}, 
+  {"0x80.0x9e","fstatfs"}, 
+  {"getpgid","0x80,0x97,1,"}, 
+  {"macx_backing_store_suspend","0x80,0x34,1,"}, 
+  {"adjtime","0x80,0x8c,2,"}, 
+  {"setgid","0x80,0xb5,1,"}, 
+  {"0x80.0x157","fstat64_extended"}, 
+  {"lstat64_extended","0x80,0x156,4,"}, 
+  {"0x80.0x156","lstat64_extended"}, 
+  {"0x80.0x155","stat64_extended"}, 
+  {"kevent","0x80,0x16b,6,"}, 
+  {"0x80.0x154","lstat64"}, 
+  {"0x80.0x153","fstat64"}, 
+  {"auditctl","0x80,0x167,1,"}, 
+  {"0x80.0x152","stat64"}, 
+  {"0x80.0x151","sendfile"}, 
+  {"auditon","0x80,0x15f,3,"}, 
+  {"workq_kernreturn","0x80,0x170,4,"}, 
+  {"0x80.0x150","proc_info"}, 
+  {"accept","0x80,0x1e,3,"}, 
+  {"openat_nocancel","0x80,0x1d0,4,"}, 
+  {"umask","0x80,0x3c,1,"}, 
+  {"sigreturn","0x80,0xb8,2,"}, 
+  {"semop","0x80,0x100,3,"}, 
+  {"posix_spawn","0x80,0xf4,5,"}, 
+  {"0x80.0x159","statfs64"}, 
+  {"0x80.0x158","getdirentries64"}, 
+  {"sigsuspend_nocancel","0x80,0x19a,1,"}, 
+  {"guarded_writev_np","0x80,0x1e7,4,"}, 
+  {"change_fdguard_np","0x80,0x1bc,6,"}, 
+  {"getsgroups","0x80,0x120,2,"}, 
+  {"__mac_get_link","0x80,0x180,2,"}, 
+  {"socket","0x80,0x61,3,"}, 
+  {"shmat","0x80,0x106,3,"}, 
+  {"fsetattrlist","0x80,0xe5,5,"}, 
+  {"0x80.0x182","__mac_get_proc"}, 
+  {"0x80.0x183","__mac_set_proc"}, 
+  {"0x80.0x180","__mac_get_link"}, 
+  {"0x80.0x181","__mac_set_link"}, 
+  {"0x80.0x186","__mac_get_pid"}, 
+  {"sendfile","0x80,0x151,6,"}, 
+  {"0x80.0x184","__mac_get_fd"}, 
+  {"0x80.0x185","__mac_set_fd"}, 
+  {"kdebug_trace64","0x80,0xb3,5,"}, 
+  {"0x80.0x15f","auditon"}, 
+  {"0x80.0x15e","audit"}, 
+  {"0x80.0x15d","__pthread_fchdir"}, 
+  {"0x80.0x15c","__pthread_chdir"}, 
+  {"0x80.0x15b","getfsstat64"}, 
+  {"link","0x80,0x9,2,"}, 
+  {"0x80.0x15a","fstatfs64"}, 
+  {"pipe","0x80,0x2a,0,"}, 
+  {"semaphore_timedwait_trap","0x80,0x26,3,"}, 
+  {"gettid","0x80,0x11e,2,"}, 
+  {"task_name_for_pid","0x80,0x2c,3,"}, 
+  {"msync","0x80,0x41,3,"}, 
+  {"truncate","0x80,0xc8,2,"}, 
+  {"sigpending","0x80,0x34,1,"}, 
+  {"bsdthread_terminate","0x80,0x169,4,"}, 
+  {"waitid","0x80,0xad,4,"}, 
+  {"readv_nocancel","0x80,0x19b,3,"}, 
+  {"getdtablesize","0x80,0x59,0,"}, 
+  {"semaphore_wait_signal_trap","0x80,0x25,2,"}, 
+  {"lchown","0x80,0x16c,3,"}, 
+  {"kdebug_trace_string","0x80,0xb2,3,"}, 
+  {"aio_suspend","0x80,0x13b,3,"}, 
+  {"_kernelrpc_mach_port_allocate_trap","0x80,0x10,3,"}, 
+  {"mach_timebase_info_trap","0x80,0x59,1,"}, 
+  {"stack_snapshot_with_config","0x80,0x1eb,3,"}, 
+  {"write","0x80,0x4,3,"}, 
+  {"setrlimit","0x80,0xc3,2,"}, 
+  {"psynch_cvsignal","0x80,0x130,8,"}, 
+  {"chmod","0x80,0xf,2,"}, 
+  {"fmount","0x80,0x20e,4,"}, 
+  {"__mac_syscall","0x80,0x17d,3,"}, 
+  {"chflags","0x80,0x22,2,"}, 
+  {"fcntl_nocancel","0x80,0x196,3,"}, 
+  {"fstatfs","0x80,0x9e,2,"}, 
+  {"__pthread_fchdir","0x80,0x15d,1,"}, 
+  {"getdirentries","0x80,0xc4,4,"}, 
+  {"setwgroups","0x80,0x121,2,"}, 
+  {"shm_open","0x80,0x10a,3,"}, 
+  {"shmget","0x80,0x109,3,"}, 
+  {"psynch_cvbroad","0x80,0x12f,7,"}, 
+  {"shmdt","0x80,0x108,1,"}, 
+  {"listxattr","0x80,0xf0,4,"}, 
+  {"exchangedata","0x80,0xdf,3,"}, 
+  {"__semwait_signal_nocancel","0x80,0x1a7,6,"}, 
+  {"pathconf","0x80,0xbf,2,"}, 
+  {"0x80.0x199","connect_nocancel"}, 
+  {"0x80.0x198","fsync_nocancel"}, 
+  {"getppid","0x80,0x27,0,"}, 
+  {"chdir","0x80,0xc,1,"}, 
+  {"getgroups","0x80,0x4f,2,"}, 
+  {"symlink","0x80,0x39,2,"}, 
+  {"0x80.0x193","recvfrom_nocancel"}, 
+  {"0x80.0x192","sendmsg_nocancel"}, 
+  {"0x80.0x191","recvmsg_nocancel"}, 
+  {"0x80.0x190","wait4_nocancel"}, 
+  {"0x80.0x197","select_nocancel"}, 
+  {"shmctl","0x80,0x107,3,"}, 
+  {"0x80.0x196","fcntl_nocancel"}, 
+  {"msync_nocancel","0x80,0x195,3,"}, 
+  {"0x80.0x195","msync_nocancel"}, 
+  {"mkdir_extended","0x80,0x124,5,"}, 
+  {"0x80.0x194","accept_nocancel"}, 
+  {"aio_error","0x80,0x13d,1,"}, 
+  {"stat","0x80,0xbc,2,"}, 
+  {"_kernelrpc_mach_vm_deallocate_trap","0x80,0xc,3,"}, 
+  {"fchflags","0x80,0x23,2,"}, 
+  {"shared_region_check_np","0x80,0x126,1,"}, 
+  {"sem_unlink","0x80,0x10e,1,"}, 
+  {"getrlimit","0x80,0xc2,2,"}, 
+  {"_","0x80"}, 
+  {"ffsctl","0x80,0xf5,4,"}, 
+  {"psynch_rw_rdlock","0x80,0x132,5,"}, 
+  {"semaphore_timedwait_signal_trap","0x80,0x27,4,"}, 
+  {"open_nocancel","0x80,0x18e,3,"}, 
+  {"memorystatus_get_level","0x80,0x1c5,1,"}, 
+  {"sem_wait_nocancel","0x80,0x1a4,1,"}, 
+  {"linkat","0x80,0x1d7,5,"}, 
+  {"0x80.0x20a","necp_session_open"}, 
+  {"0x80.0x20c","setattrlistat"}, 
+  {"mkfifo","0x80,0x84,2,"}, 
+  {"0x80.0x20b","necp_session_action"}, 
+  {"chmod_extended","0x80,0x11a,5,"}, 
+  {"lstat64","0x80,0x154,2,"}, 
+  {"0x80.0x20e","fmount"}, 
+  {"0x80.0x20d","net_qos_guideline"}, 
+  {"0x80.0x20f","ntp_adjtime"}, 
+  {"__mac_get_fd","0x80,0x184,2,"}, 
+  {"delete","0x80,0xe2,1,"}, 
+  {"open_dprotected_np","0x80,0xd8,5,"}, 
+  {"getattrlist","0x80,0xdc,5,"}, 
+  {"csops_audittoken","0x80,0xaa,5,"}, 
+  {"0x80.0x19c","writev_nocancel"}, 
+  {"0x80.0x19b","readv_nocancel"}, 
+  {"0x80.0x19a","sigsuspend_nocancel"}, 
+  {"getpeername","0x80,0x1f,3,"}, 
+  {"audit_session_self","0x80,0x1ac,0,"}, 
+  {"0x80.0x19f","pwrite_nocancel"}, 
+  {"0x80.0x19e","pread_nocancel"}, 
+  {"0x80.0x19d","sendto_nocancel"}, 
+  {"usrctl","0x80,0x1bd,1,"}, 
+  {"fstat64","0x80,0x153,2,"}, 
+  {"__pthread_chdir","0x80,0x15c,1,"}, 
+  {"getaudit_addr","0x80,0x165,2,"}, 
+  {"semaphore_signal_trap","0x80,0x21,1,"}, 
+  {"setsockopt","0x80,0x69,5,"}, 
+  {"audit_session_port","0x80,0x1b0,2,"}, 
+  {"os_fault_with_payload","0x80,0x211,6,"}, 
+  {"fcntl","0x80,0x5c,3,"}, 
+  {"swapon","0x80,0x55,0,"}, 
+  {"open_extended","0x80,0x115,6,"}, 
+  {"fstat","0x80,0xbd,2,"}, 
+  {"psynch_cvwait","0x80,0x131,8,"}, 
+  {"getdirentries64","0x80,0x158,4,"}, 
+  {"fs_snapshot","0x80,0x206,6,"}, 
+  {"access","0x80,0x21,2,"}, 
+  {"sendmsg_nocancel","0x80,0x192,3,"}, 
+  {"msgsnd","0x80,0x104,4,"}, 
+  {"unlinkat","0x80,0x1d8,3,"}, 
+  {"getegid","0x80,0x2b,0,"}, 
+  {"writev_nocancel","0x80,0x19c,3,"}, 
+  {"socket_delegate","0x80,0x1c2,4,"}, 
+  {"geteuid","0x80,0x19,0,"}, 
+  {"utimes","0x80,0x8a,2,"}, 
+  {"symlinkat","0x80,0x1da,3,"}, 
+  {"__sigwait","0x80,0x14a,2,"}, 
+  {"recvmsg_x","0x80,0x1e0,4,"}, 
+  {"psynch_mutexwait","0x80,0x12d,5,"}, 
+  {"clock_sleep_trap","0x80,0x3e,5,"}, 
+  {"mlock","0x80,0xcb,2,"}, 
+  {"iokit_user_client_trap","0x80,0x64,8,"}, 
+  {"__mac_execve","0x80,0x17c,4,"}, 
+  {"0x80.0x203","ulock_wait"}, 
+  {"psynch_rw_unlock2","0x80,0x135,5,"}, 
+  {"0x80.0x205","fclonefileat"}, 
+  {"0x80.0x204","ulock_wake"}, 
+  {"0x80.0x206","fs_snapshot"}, 
+  {"iopolicysys","0x80,0x142,2,"}, 
+  {"0x80.0x209","abort_with_payload"}, 
+  {"__mac_get_file","0x80,0x17e,2,"}, 
+  {"0x80.0x208","terminate_with_payload"}, 
+  {"getitimer","0x80,0x56,2,"}, 
+  {"dup2","0x80,0x5a,2,"}, 
+  {"pwrite","0x80,0x9a,4,"}, 
+  {"aio_write","0x80,0x13f,1,"}, 
+  {"msgrcv_nocancel","0x80,0x1a3,5,"}, 
+  {"removexattr","0x80,0xee,3,"}, 
+  {"readlinkat","0x80,0x1d9,4,"}, 
+  {"vm_pressure_monitor","0x80,0x128,3,"}, 
+  {"poll_nocancel","0x80,0x1a1,3,"}, 
+  {"0x80.0x210","ntp_gettime"}, 
+  {"connectx","0x80,0x1bf,8,"}, 
+  {"mkfifo_extended","0x80,0x123,5,"}, 
+  {"0x80.0x211","os_fault_with_payload"}, 
+  {"lseek","0x80,0xc7,3,"}, 
+  {"__old_semwait_signal_nocancel","0x80,0x173,5,"}, 
+  {"getauid","0x80,0x161,1,"}, 
+  {"setattrlistat","0x80,0x20c,6,"}, 
+  {"mach_reply_port","0x80,0x1a,0,"}, 
+  {"guarded_kqueue_np","0x80,0x1bb,2,"}, 
+  {"renameatx_np","0x80,0x1e8,5,"}, 
+  {"waitevent","0x80,0xe8,2,"}, 
+  {"gethostuuid","0x80,0x8e,3,"}, 
+  {"sfi_pidctl","0x80,0x1c9,4,"}, 
+  {"close_nocancel","0x80,0x18f,1,"}, 
+  {"getpid","0x80,0x14,0,"}, 
+  {"sem_post","0x80,0x111,1,"}, 
+  {"mkdirat","0x80,0x1db,3,"}, 
+  {"__mac_set_proc","0x80,0x183,1,"}, 
+  {"guarded_write_np","0x80,0x1e5,4,"}, 
+  {"_kernelrpc_mach_port_destroy_trap","0x80,0x11,2,"}, 
+  {"psynch_rw_downgrade","0x80,0x12b,5,"}, 
+  {"settimeofday","0x80,0x7a,2,"}, 
+  {"__mac_getfsstat","0x80,0x1aa,5,"}, 
+  {"stat_extended","0x80,0x117,4,"}, 
+  {"workq_open","0x80,0x16f,0,"}, 
+  {"proc_info","0x80,0x150,6,"}, 
+  {"fremovexattr","0x80,0xef,3,"}, 
+  {"bind","0x80,0x68,3,"}, 
+  {"aio_cancel","0x80,0x13c,2,"}, 
+  {"pwrite_nocancel","0x80,0x19f,4,"}, 
+  {"minherit","0x80,0xfa,3,"}, 
+  {"fstatfs64","0x80,0x15a,2,"}, 
+  {"readv","0x80,0x78,3,"}, 
+  {"system_override","0x80,0x1c6,2,"}, 
+  {"lstat","0x80,0xbe,2,"}, 
+  {"__disable_threadsignal","0x80,0x14b,1,"}, 
+  {"_kernelrpc_mach_vm_protect_trap","0x80,0xe,5,"}, 
+  {"sysctl","0x80,0xca,6,"}, 
+  {"read_nocancel","0x80,0x18c,3,"}, 
+  {"psynch_rw_yieldwrlock","0x80,0x12a,5,"}, 
+  {"getentropy","0x80,0x1f4,2,"}, 
+  {"persona","0x80,0x1ee,5,"}, 
+  {"getgid","0x80,0x2f,0,"}, 
+  {"recvfrom","0x80,0x1d,6,"}, 
+  {"flock","0x80,0x83,2,"}, 
+  {"getuid","0x80,0x18,0,"}, 
+  {"reboot","0x80,0x37,2,"}, 
+  {"getfsstat64","0x80,0x15b,3,"}, 
+  {"fchownat","0x80,0x1d4,5,"}, 
+  {"semctl","0x80,0xfe,4,"}, 
+  {"fstat_extended","0x80,0x119,4,"}, 
+  {"guarded_close_np","0x80,0x1ba,2,"}, 
+  {"openat","0x80,0x1cf,4,"}, 
+  {"read","0x80,0x3,3,"}, 
+  {"copyfile","0x80,0xe3,4,"}, 
+  {"mk_timer_arm_trap","0x80,0x5d,2,"}, 
+  {"fsetxattr","0x80,0xed,6,"}, 
+  {"semaphore_signal_thread_trap","0x80,0x23,2,"}, 
+  {"waitid_nocancel","0x80,0x1a0,4,"}, 
+  {"shmsys","0x80,0xfd,4,"}, 
+  {"pselect_nocancel","0x80,0x18b,6,"}, 
+  {"netagent_trigger","0x80,0x1ea,2,"}, 
+  {"initgroups","0x80,0xf3,3,"}, 
+  {"mach_wait_until_trap","0x80,0x5a,1,"}, 
+  {"mk_timer_cancel_trap","0x80,0x5e,2,"}, 
+  {"grab_pgo_data","0x80,0x1ed,4,"}, 
+  {"mach_voucher_extract_attr_recipe_trap","0x80,0x48,4,"}, 
+  {"vfs_purge","0x80,0x1c7,0,"}, 
+  {"pread","0x80,0x99,4,"}, 
+  {"0x80.0x2a","_kernelrpc_mach_port_unguard_trap"}, 
+  {"__semwait_signal","0x80,0x14e,6,"}, 
+  {"0x80.0x2c","task_name_for_pid"}, 
+  {"0x80.0x2b","mach_generate_activity_id"}, 
+  {"ntp_gettime","0x80,0x210,1,"}, 
+  {"0x80.0x2e","pid_for_task"}, 
+  {"socketpair","0x80,0x87,4,"}, 
+  {"pid_resume","0x80,0x1b2,1,"}, 
+  {"0x80.0x2d","task_for_pid"}, 
+  {"0x80.0x2f","getgid"}, 
+  {"ptrace","0x80,0x1a,4,"}, 
+  {"dup","0x80,0x29,1,"}, 
+  {"mkdir","0x80,0x88,2,"}, 
+  {"modwatch","0x80,0xe9,2,"}, 
+  {"fstat64_extended","0x80,0x157,4,"}, 
+  {"abort_with_payload","0x80,0x209,6,"}, 
+  {"semsys","0x80,0xfb,5,"}, 
+  {"writev","0x80,0x79,3,"}, 
+  {"0x80.0x1ba","guarded_close_np"}, 
+  {"0x80.0x1bb","guarded_kqueue_np"}, 
+  {"net_qos_guideline","0x80,0x20d,2,"}, 
+  {"0x80.0x1bc","change_fdguard_np"}, 
+  {"thread_self_trap","0x80,0x1b,0,"}, 
+  {"msgsnd_nocancel","0x80,0x1a2,4,"}, 
+  {"0x80.0x1bd","usrctl"}, 
+  {"0x80.0x1be","proc_rlimit_control"}, 
+  {"0x80.0x1bf","connectx"}, 
+  {"__sigwait_nocancel","0x80,0x1a6,2,"}, 
+  {"thread_selfcounts","0x80,0xba,3,"}, 
+  {"mk_timer_destroy_trap","0x80,0x5c,1,"}, 
+  {"close","0x80,0x6,1,"}, 
+  {"statfs","0x80,0x9d,2,"}, 
+  {"0x80.0x3a","pfz_exit"}, 
+  {"0x80.0x3b","swtch_pri"}, 
+  {"__old_semwait_signal","0x80,0x172,5,"}, 
+  {"0x80.0x3c","swtch"}, 
+  {"mach_msg_trap","0x80,0x1f,7,"}, 
+  {"0x80.0x3d","thread_switch"}, 
+  {"peeloff","0x80,0x1c1,2,"}, 
+  {"proc_rlimit_control","0x80,0x1be,3,"}, 
+  {"0x80.0x3e","clock_sleep_trap"}, 
+  {"renameat","0x80,0x1d1,4,"}, 
+  {"ulock_wake","0x80,0x204,3,"}, 
+  {"__mac_get_proc","0x80,0x182,1,"}, 
+  {"0x80.0x21","semaphore_signal_trap"}, 
+  {"madvise","0x80,0x4b,3,"}, 
+  {"0x80.0x20","mach_msg_overwrite_trap"}, 
+  {"0x80.0x23","semaphore_signal_thread_trap"}, 
+  {"0x80.0x22","semaphore_signal_all_trap"}, 
+  {"0x80.0x25","semaphore_wait_signal_trap"}, 
+  {"aio_fsync","0x80,0x139,2,"}, 
+  {"0x80.0x24","semaphore_wait_trap"}, 
+  {"getpgrp","0x80,0x51,0,"}, 
+  {"0x80.0x27","semaphore_timedwait_signal_trap"}, 
+  {"0x80.0x26","semaphore_timedwait_trap"}, 
+  {"0x80.0x29","_kernelrpc_mach_port_guard_trap"}, 
+  {"mach_msg_overwrite_trap","0x80,0x20,8,"}, 
+  {"mach_generate_activity_id","0x80,0x2b,3,"}, 
+  {"0x80.0x1b0","audit_session_port"}, 
+  {"0x80.0x1b1","pid_suspend"}, 
+  {"0x80.0x1b2","pid_resume"}, 
+  {"aio_suspend_nocancel","0x80,0x1a5,3,"}, 
+  {"0x80.0x1b3","pid_hibernate"}, 
+  {"pid_shutdown_sockets","0x80,0x1b4,2,"}, 
+  {"0x80.0x1b4","pid_shutdown_sockets"}, 
+  {"0x80.0xc","_kernelrpc_mach_vm_deallocate_trap"}, 
+  {"0x80.0x1b6","shared_region_map_and_slide_np"}, 
+  {"0x80.0x1b7","kas_info"}, 
+  {"0x80.0xb","_kernelrpc_mach_vm_purgable_control_trap"}, 
+  {"0x80.0xa","_kernelrpc_mach_vm_allocate_trap"}, 
+  {"0x80.0x1b8","memorystatus_control"}, 
+  {"_kernelrpc_mach_port_unguard_trap","0x80,0x2a,3,"}, 
+  {"poll","0x80,0xe6,3,"}, 
+  {"process_policy","0x80,0x143,7,"}, 
+  {"0x80.0x1b9","guarded_open_np"}, 
+  {"_kernelrpc_mach_port_construct_trap","0x80,0x18,4,"}, 
+  {"0x80.0xf","_kernelrpc_mach_vm_map_trap"}, 
+  {"0x80.0xe","_kernelrpc_mach_vm_protect_trap"}, 
+  {"0x80.0xd","fchdir"}, 
+  {"semget","0x80,0xff,3,"}, 
+  {"fsync_nocancel","0x80,0x198,1,"}, 
+  {"0x80.0x30","macx_swapon"}, 
+  {"0x80.0x31","macx_swapoff"}, 
+  {"getrusage","0x80,0x75,2,"}, 
+  {"0x80.0x32","thread_get_special_reply_port"}, 
+  {"pselect","0x80,0x18a,6,"}, 
+  {"microstackshot","0x80,0x1ec,3,"}, 
+  {"0x80.0x33","macx_triggers"}, 
+  {"psynch_rw_longrdlock","0x80,0x129,5,"}, 
+  {"0x80.0x34","macx_backing_store_suspend"}, 
+  {"0x80.0x35","macx_backing_store_recovery"}, 
+  {"0x80.0x36","ioctl"}, 
+  {"0x80.0x37","reboot"}, 
+  {"fclonefileat","0x80,0x205,4,"}, 
+  {"0x80.0x38","revoke"}, 
+  {"0x80.0x39","symlink"}, 
+  {"pread_nocancel","0x80,0x19e,4,"}, 
+  {"thread_get_special_reply_port","0x80,0x32,0,"}, 
+  {"settid_with_pid","0x80,0x137,2,"}, 
+  {"_kernelrpc_mach_vm_purgable_control_trap","0x80,0xb,4,"}, 
+  {"sem_wait","0x80,0x10f,1,"}, 
+  {"necp_open","0x80,0x1f5,1,"}, 
+  {"flistxattr","0x80,0xf1,4,"}, 
+  {"setlogin","0x80,0x32,1,"}, 
+  {"necp_client_action","0x80,0x1f6,6,"}, 
+  {"setattrlist","0x80,0xdd,5,"}, 
+  {"__mac_set_fd","0x80,0x185,2,"}, 
+  {"chown","0x80,0x10,3,"}, 
+  {"mlockall","0x80,0x144,1,"}, 
+  {"searchfs","0x80,0xe1,6,"}, 
+  {"kill","0x80,0x25,3,"}, 
+  {"__pthread_sigmask","0x80,0x149,3,"}, 
+  {"task_for_pid","0x80,0x2d,3,"}, 
+  {"recvmsg_nocancel","0x80,0x191,3,"}, 
+  {"host_create_mach_voucher_trap","0x80,0x46,4,"}, 
+  {"sem_open","0x80,0x10c,4,"}, 
+  {"watchevent","0x80,0xe7,2,"}, 
+  {"task_self_trap","0x80,0x1c,0,"}, 
+  {"sysctlbyname","0x80,0x112,6,"}, 
+  {"rmdir","0x80,0x89,1,"}, 
+  {"0x80.0x6f","sigsuspend"}, 
+  {"settid","0x80,0x11d,2,"}, 
+  {"0x80.0x6a","listen"}, 
+  {"getxattr","0x80,0xea,6,"}, 
+  {"rename","0x80,0x80,2,"}, 
+  {"0x80.0x12","_kernelrpc_mach_port_deallocate_trap"}, 
+  {"0x80.0x13","_kernelrpc_mach_port_mod_refs_trap"}, 
+  {"0x80.0x10","_kernelrpc_mach_port_allocate_trap"}, 
+  {"mount","0x80,0xa7,4,"}, 
+  {"0x80.0x11","_kernelrpc_mach_port_destroy_trap"}, 
+  {"0x80.0x3","read"}, 
+  {"0x80.0x16","_kernelrpc_mach_port_insert_member_trap"}, 
+  {"getfh","0x80,0xa1,2,"}, 
+  {"0x80.0x2","fork"}, 
+  {"0x80.0x17","_kernelrpc_mach_port_extract_member_trap"}, 
+  {"0x80.0x1","exit"}, 
+  {"0x80.0x14","_kernelrpc_mach_port_move_member_trap"}, 
+  {"gettimeofday","0x80,0x74,3,"}, 
+  {"0x80.0x15","_kernelrpc_mach_port_insert_right_trap"}, 
+  {"0x80.0x7","wait4"}, 
+  {"0x80.0x6","close"}, 
+  {"0x80.0x5","open"}, 
+  {"0x80.0x18","_kernelrpc_mach_port_construct_trap"}, 
+  {"nfssvc","0x80,0x9b,2,"}, 
+  {"0x80.0x4","write"}, 
+  {"0x80.0x19","_kernelrpc_mach_port_destruct_trap"}, 
+  {"_kernelrpc_mach_port_destruct_trap","0x80,0x19,4,"}, 
+  {"0x80.0x9","link"}, 
+  {"0x80.0x1c1","peeloff"}, 
+  {"0x80.0x1c0","disconnectx"}, 
+  {"0x80.0x1c3","telemetry"}, 
+  {"sendto","0x80,0x85,6,"}, 
+  {"0x80.0x7e","setreuid"}, 
+  {"0x80.0x1c2","socket_delegate"}, 
+  {"0x80.0x7f","setregid"}, 
+  {"0x80.0x1c5","memorystatus_get_level"}, 
+  {"0x80.0x1c4","proc_uuid_policy"}, 
+  {"0x80.0x1c7","vfs_purge"}, 
+  {"0x80.0x7a","settimeofday"}, 
+  {"0x80.0x1c6","system_override"}, 
+  {"0x80.0x7b","fchown"}, 
+  {"0x80.0x1c9","sfi_pidctl"}, 
+  {"guarded_open_np","0x80,0x1b9,5,"}, 
+  {"0x80.0x7c","fchmod"}, 
+  {"0x80.0x1c8","sfi_ctl"}, 
+  {"coalition","0x80,0x1ca,3,"}, 
+  {"_kernelrpc_mach_vm_allocate_trap","0x80,0xa,4,"}, 
+  {"_kernelrpc_mach_port_insert_right_trap","0x80,0x15,4,"}, 
+  {"kqueue","0x80,0x16a,0,"}, 
+  {"sync","0x80,0x24,0,"}, 
+  {"0x80.0x1ac","audit_session_self"}, 
+  {"futimes","0x80,0x8b,2,"}, 
+  {"0x80.0x1ab","fsgetpath"}, 
+  {"necp_session_open","0x80,0x20a,1,"}, 
+  {"ntp_adjtime","0x80,0x20f,1,"}, 
+  {"0x80.0x1aa","__mac_getfsstat"}, 
+  {"0x80.0x64","iokit_user_client_trap"}, 
+  {"mincore","0x80,0x4e,3,"}, 
+  {"0x80.0x1af","fileport_makefd"}, 
+  {"munlock","0x80,0xcc,2,"}, 
+  {"aio_read","0x80,0x13e,1,"}, 
+  {"fileport_makefd","0x80,0x1af,1,"}, 
+  {"0x80.0x61","socket"}, 
+  {"0x80.0x1ae","fileport_makeport"}, 
+  {"telemetry","0x80,0x1c3,6,"}, 
+  {"mknod","0x80,0xe,3,"}, 
+  {"0x80.0x60","setpriority"}, 
+  {"0x80.0x1ad","audit_session_join"}, 
+  {"host_self_trap","0x80,0x1d,0,"}, 
+  {"nfsclnt","0x80,0xf7,2,"}, 
+  {"0x80.0x62","connect"}, 
+  {"audit_session_join","0x80,0x1ad,1,"}, 
+  {"0x80.0x69","setsockopt"}, 
+  {"0x80.0x68","bind"}, 
+  {"0x80.0x1f4","getentropy"}, 
+  {"issetugid","0x80,0x147,0,"}, 
+  {"__pthread_markcancel","0x80,0x14c,1,"}, 
+  {"ftruncate","0x80,0xc9,2,"}, 
+  {"0x80.0x1f5","necp_open"}, 
+  {"0x80.0x1f6","necp_client_action"}, 
+  {"proc_uuid_policy","0x80,0x1c4,4,"}, 
+  {"0x80.0x10b","shm_unlink"}, 
+  {"select_nocancel","0x80,0x197,5,"}, 
+  {"0x80.0x10c","sem_open"}, 
+  {"0x80.0xb1","kdebug_typefilter"}, 
+  {"0x80.0x1f3","work_interval_ctl"}, 
+  {"0x80.0x10a","shm_open"}, 
+  {"0x80.0xb3","kdebug_trace64"}, 
+  {"0x80.0x10f","sem_wait"}, 
+  {"ledger","0x80,0x175,4,"}, 
+  {"0x80.0xb2","kdebug_trace_string"}, 
+  {"0x80.0xb5","setgid"}, 
+  {"0x80.0x10d","sem_close"}, 
+  {"0x80.0xb4","kdebug_trace"}, 
+  {"0x80.0x10e","sem_unlink"}, 
+  {"0x80.0xb7","seteuid"}, 
+  {"open","0x80,0x5,3,"}, 
+  {"0x80.0xb6","setegid"}, 
+  {"0x80.0xb8","sigreturn"}, 
+  {"0x80.0x74","gettimeofday"}, 
+  {"setregid","0x80,0x7f,2,"}, 
+  {"0x80.0x75","getrusage"}, 
+  {"0x80.0x76","getsockopt"}, 
+  {"0x80.0x120","getsgroups"}, 
+  {"sem_trywait","0x80,0x110,1,"}, 
+  {"0x80.0x121","setwgroups"}, 
+  {"pid_suspend","0x80,0x1b1,1,"}, 
+  {"fchmod_extended","0x80,0x11b,5,"}, 
+  {"0x80.0x122","getwgroups"}, 
+  {"0x80.0x123","mkfifo_extended"}, 
+  {"setsid","0x80,0x93,0,"}, 
+  {"0x80.0x124","mkdir_extended"}, 
+  {"vfork","0x80,0x42,0,"}, 
+  {"mremap_encrypted","0x80,0x1e9,5,"}, 
+  {"access_extended","0x80,0x11c,4,"}, 
+  {"0x80.0xaa","csops_audittoken"}, 
+  {"0x80.0x125","identitysvc"}, 
+  {"0x80.0x126","shared_region_check_np"}, 
+  {"guarded_open_dprotected_np","0x80,0x1e4,7,"}, 
+  {"0x80.0xad","waitid"}, 
+  {"0x80.0x128","vm_pressure_monitor"}, 
+  {"getsid","0x80,0x136,1,"}, 
+  {"munmap","0x80,0x49,2,"}, 
+  {"0x80.0x129","psynch_rw_longrdlock"}, 
+  {"0x80.0x78","readv"}, 
+  {"0x80.0x79","writev"}, 
+  {"readlink","0x80,0x3a,3,"}, 
+  {"__mac_set_link","0x80,0x181,2,"}, 
+  {"0x80.0x1a3","msgrcv_nocancel"}, 
+  {"pid_for_task","0x80,0x2e,2,"}, 
+  {"__pthread_kill","0x80,0x148,2,"}, 
+  {"0x80.0x1a2","msgsnd_nocancel"}, 
+  {"_kernelrpc_mach_port_extract_member_trap","0x80,0x17,3,"}, 
+  {"0x80.0x1b","thread_self_trap"}, 
+  {"0x80.0x1a1","poll_nocancel"}, 
+  {"mk_timer_create_trap","0x80,0x5b,0,"}, 
+  {"0x80.0x1c","task_self_trap"}, 
+  {"0x80.0x1a0","waitid_nocancel"}, 
+  {"0x80.0x1a7","__semwait_signal_nocancel"}, 
+  {"ulock_wait","0x80,0x203,4,"}, 
+  {"0x80.0x13a","aio_return"}, 
+  {"__mac_get_pid","0x80,0x186,2,"}, 
+  {"0x80.0x1a","mach_reply_port"}, 
+  {"0x80.0x1a6","__sigwait_nocancel"}, 
+  {"0x80.0x1f","mach_msg_trap"}, 
+  {"0x80.0x1a5","aio_suspend_nocancel"}, 
+  {"0x80.0xc0","fpathconf"}, 
+  {"0x80.0x13c","aio_cancel"}, 
+  {"0x80.0x1a4","sem_wait_nocancel"}, 
+  {"0x80.0x13b","aio_suspend"}, 
+  {"kdebug_trace","0x80,0xb4,5,"}, 
+  {"0x80.0x1d","host_self_trap"}, 
+  {"fhopen","0x80,0xf8,2,"}, 
+  {"0x80.0xc2","getrlimit"}, 
+  {"0x80.0x13e","aio_read"}, 
+  {"0x80.0x1e","accept"}, 
+  {"coalition_info","0x80,0x1cb,4,"}, 
+  {"0x80.0xc3","setrlimit"}, 
+  {"0x80.0x13d","aio_error"}, 
+  {"0x80.0x1a9","__mac_get_mount"}, 
+  {"0x80.0xc4","getdirentries"}, 
+  {"0x80.0x1a8","__mac_mount"}, 
+  {"0x80.0xc5","mmap"}, 
+  {"0x80.0x13f","aio_write"}, 
+  {"guarded_pwrite_np","0x80,0x1e6,5,"}, 
+  {"0x80.0xc7","lseek"}, 
+  {"0x80.0xc8","truncate"}, 
+  {"0x80.0xc9","ftruncate"}, 
+  {"0x80.0x1ca","coalition"}, 
+  {"0x80.0x1cc","necp_match_policy"}, 
+  {"accept_nocancel","0x80,0x194,3,"}, 
+  {"0x80.0x1cb","coalition_info"}, 
+  {"0x80.0x46","host_create_mach_voucher_trap"}, 
+  {"0x80.0x1ce","clonefileat"}, 
+  {"0x80.0x1cd","getattrlistbulk"}, 
+  {"0x80.0xba","thread_selfcounts"}, 
+  {"0x80.0x42","vfork"}, 
+  {"0x80.0x1cf","openat"}, 
+  {"0x80.0x41","msync"}, 
+  {"thread_switch","0x80,0x3d,3,"}, 
+  {"0x80.0xbc","stat"}, 
+  {"bsdthread_create","0x80,0x168,5,"}, 
+  {"0x80.0xbb","fdatasync"}, 
+  {"__mac_mount","0x80,0x1a8,5,"}, 
+  {"0x80.0xbe","lstat"}, 
+  {"stat64","0x80,0x152,2,"}, 
+  {"0x80.0xbd","fstat"}, 
+  {"undelete","0x80,0xcd,1,"}, 
+  {"kas_info","0x80,0x1b7,3,"}, 
+  {"0x80.0xbf","pathconf"}, 
+  {"identitysvc","0x80,0x125,2,"}, 
+  {"0x80.0x49","munmap"}, 
+  {"0x80.0x1d6","fstatat64"}, 
+  {"0x80.0x1d7","linkat"}, 
+  {"0x80.0x48","mach_voucher_extract_attr_recipe_trap"}, 
+  {"0x80.0x1d4","fchownat"}, 
+  {"getsockname","0x80,0x20,3,"}, 
+  {"0x80.0x1d5","fstatat"}, 
+  {"0x80.0x1d2","faccessat"}, 
+  {"0x80.0x1d3","fchmodat"}, 
+  {"fgetxattr","0x80,0xeb,6,"}, 
+  {"0x80.0x12a","psynch_rw_yieldwrlock"}, 
+  {"0x80.0x1d0","openat_nocancel"}, 
+  {"0x80.0x12b","psynch_rw_downgrade"}, 
+  {"0x80.0x1d1","renameat"}, 
+  {"0x80.0x12c","psynch_rw_upgrade"}, 
+  {"sendmsg_x","0x80,0x1e1,4,"}, 
+  {"fchmod","0x80,0x7c,2,"}, 
+  {"0x80.0x12d","psynch_mutexwait"}, 
+  {"0x80.0x12e","psynch_mutexdrop"}, 
+  {"setgroups","0x80,0x50,2,"}, 
+  {"0x80.0x12f","psynch_cvbroad"}, 
+  {"sigprocmask","0x80,0x30,3,"}, 
+  {"faccessat","0x80,0x1d2,4,"}, 
+  {"0x80.0x1d8","unlinkat"}, 
+  {"getfsstat","0x80,0x12,3,"}, 
+  {"0x80.0x1d9","readlinkat"}, 
+  {"0x80.0x56","getitimer"}, 
+  {"execve","0x80,0x3b,3,"}, 
+  {"0x80.0x102","msgctl"}, 
+  {"0x80.0x55","swapon"}, 
+  {"0x80.0x103","msgget"}, 
+  {"0x80.0x52","setpgid"}, 
+  {"0x80.0x100","semop"}, 
+  {"0x80.0x53","setitimer"}, 
+  {"setauid","0x80,0x162,1,"}, 
+  {"0x80.0xca","sysctl"}, 
+  {"0x80.0x50","setgroups"}, 
+  {"0x80.0xcb","mlock"}, 
+  {"0x80.0x106","shmat"}, 
+  {"0x80.0x51","getpgrp"}, 
+  {"0x80.0xcc","munlock"}, 
+  {"0x80.0x107","shmctl"}, 
+  {"psynch_rw_unlock","0x80,0x134,5,"}, 
+  {"0x80.0xcd","undelete"}, 
+  {"0x80.0x104","msgsnd"}, 
+  {"0x80.0x105","msgrcv"}, 
+  {"thread_selfusage","0x80,0x1e2,0,"}, 
+  {"0x80.0x108","shmdt"}, 
+  {"connect","0x80,0x62,3,"}, 
+  {"fdatasync","0x80,0xbb,1,"}, 
+  {"0x80.0x109","shmget"}, 
+  {"kevent_id","0x80,0x177,8,"}, 
+  {"0x80.0x59","mach_timebase_info_trap"}, 
+  {"msgrcv","0x80,0x105,5,"}, 
+  {"terminate_with_payload","0x80,0x208,7,"}, 
+  {"clonefileat","0x80,0x1ce,5,"}, 
+  {"lio_listio","0x80,0x140,4,"}, 
+  {"semaphore_wait_trap","0x80,0x24,1,"}, 
+  {"0x80.0xa1","getfh"}, 
+  {"getdirentriesattr","0x80,0xde,8,"}, 
+  {"macx_backing_store_recovery","0x80,0x35,1,"}, 
+  {"__pthread_canceled","0x80,0x14d,1,"}, 
+  {"0x80.0xa7","mount"}, 
+  {"csrctl","0x80,0x1e3,3,"}, 
+  {"0x80.0xa5","quotactl"}, 
+  {"_kernelrpc_mach_port_guard_trap","0x80,0x29,4,"}, 
+  {"0x80.0xa9","csops"}, 
+  {"0x80.0x1ee","persona"}, 
+  {"0x80.0x1ed","grab_pgo_data"}, 
+  {"0x80.0x1ec","microstackshot"}, 
+  {"0x80.0x131","psynch_cvwait"}, 
+  {"0x80.0x1eb","stack_snapshot_with_config"}, 
+  {"0x80.0x130","psynch_cvsignal"}, 
+  {"0x80.0x1ea","netagent_trigger"}, 
+  {"0x80.0x133","psynch_rw_wrlock"}, 
+  {"wait4_nocancel","0x80,0x190,4,"}, 
+  {"0x80.0xdf","exchangedata"}, 
+  {"0x80.0x132","psynch_rw_rdlock"}, 
+  {"0x80.0xde","getdirentriesattr"}, 
+  {"0x80.0x135","psynch_rw_unlock2"}, 
+  {"mmap","0x80,0xc5,6,"}, 
+  {"0x80.0xdd","setattrlist"}, 
+  {"0x80.0x134","psynch_rw_unlock"}, 
+  {"memorystatus_control","0x80,0x1b8,5,"}, 
+  {"0x80.0xdc","getattrlist"}, 
+  {"0x80.0x137","settid_with_pid"}, 
+  {"0x80.0x136","getsid"}, 
+  {"sigsuspend","0x80,0x6f,1,"}, 
+  {"shm_unlink","0x80,0x10b,1,"}, 
+  {"0x80.0x139","aio_fsync"}, 
+  {"getattrlistbulk","0x80,0x1cd,5,"}, 
+  {"0x80.0x138","psynch_cvclrprepost"}, 
+  {"getwgroups","0x80,0x122,2,"}, 
+  {"getlogin","0x80,0x31,2,"}, 
+  {"fstatat","0x80,0x1d5,4,"}, 
+  {"0x80.0x4f","getgroups"}, 
+  {"0x80.0x4e","mincore"}, 
+  {"kevent64","0x80,0x171,7,"}, 
+  {"necp_match_policy","0x80,0x1cc,3,"}, 
+  {"0x80.0xf5","ffsctl"}, 
+  {"0x80.0x14d","__pthread_canceled"}, 
+  {"0x80.0x4b","madvise"}, 
+  {"0x80.0xf4","posix_spawn"}, 
+  {"0x80.0x14e","__semwait_signal"}, 
+  {"seteuid","0x80,0xb7,1,"}, 
+  {"0x80.0x4a","mprotect"}, 
+  {"0x80.0xf7","nfsclnt"}, 
+  {"0x80.0x14b","__disable_threadsignal"}, 
+  {"0x80.0x14c","__pthread_markcancel"}, 
+  {"0x80.0xf1","flistxattr"}, 
+  {"0x80.0xf0","listxattr"}, 
+  {"0x80.0x14a","__sigwait"}, 
+  {"0x80.0xf3","initgroups"}, 
+  {"0x80.0xf2","fsctl"}, 
+  {"0x80.0x1df","openbyid_np"}, 
+  {"psynch_mutexdrop","0x80,0x12e,5,"}, 
+  {"sem_close","0x80,0x10d,1,"}, 
+  {"0x80.0x1dd","proc_trace_log"}, 
+  {"0x80.0x1de","bsdthread_ctl"}, 
+  {"0x80.0xf8","fhopen"}, 
+  {"0x80.0x1db","mkdirat"}, 
+  {"lstat_extended","0x80,0x118,4,"}, 
+  {"0x80.0x1dc","getattrlistat"}, 
+  {"0x80.0x165","getaudit_addr"}, 
+  {"revoke","0x80,0x38,1,"}, 
+  {"shared_region_map_and_slide_np","0x80,0x1b6,6,"}, 
+  {"0x80.0xef","fremovexattr"}, 
+  {"0x80.0x166","setaudit_addr"}, 
+  {"0x80.0x1da","symlinkat"}, 
+  {"0x80.0x167","auditctl"}, 
+  {"0x80.0xed","fsetxattr"}, 
+  {"0x80.0xee","removexattr"}, 
+  {"0x80.0x161","getauid"}, 
+  {"0x80.0xeb","fgetxattr"}, 
+  {"0x80.0x162","setauid"}, 
+  {"0x80.0xec","setxattr"}, 
+  {"unlink","0x80,0xa,1,"}, 
+  {"sigaltstack","0x80,0x35,2,"}, 
+  {"0x80.0xea","getxattr"}, 
+  {"sendto_nocancel","0x80,0x19d,6,"}, 
+  {"openbyid_np","0x80,0x1df,3,"}, 
+  {"0x80.0x1e7","guarded_writev_np"}, 
+  {"0x80.0x168","bsdthread_create"}, 
+  {"0x80.0x1e6","guarded_pwrite_np"}, 
+  {"0x80.0x169","bsdthread_terminate"}, 
+  {"bsdthread_register","0x80,0x16e,7,"}, 
+  {"0x80.0x5f","mk_timer_arm_leeway_trap"}, 
+  {"0x80.0x1e5","guarded_write_np"}, 
+  {"0x80.0x1e4","guarded_open_dprotected_np"}, 
+  {"0x80.0x5d","mk_timer_arm_trap"}, 
+  {"0x80.0x1e3","csrctl"}, 
+  {"0x80.0x17e","__mac_get_file"}, 
+  {"getsockopt","0x80,0x76,5,"}, 
+  {"0x80.0x1e2","thread_selfusage"}, 
+  {"macx_swapon","0x80,0x30,4,"}, 
+  {"0x80.0x5e","mk_timer_cancel_trap"}, 
+  {"0x80.0x17d","__mac_syscall"}, 
+  {"0x80.0x1e1","sendmsg_x"}, 
+  {"0x80.0x5b","mk_timer_create_trap"}, 
+  {"0x80.0x5c","mk_timer_destroy_trap"}, 
+  {"0x80.0x1e0","recvmsg_x"}, 
+  {"getpriority","0x80,0x64,2,"}, 
+  {"0x80.0x17f","__mac_set_file"}, 
+  {"msgctl","0x80,0x102,3,"}, 
+  {"fork","0x80,0x2,0,"}, 
+  {"0x80.0x5a","mach_wait_until_trap"}, 
+  {"0x80.0x17c","__mac_execve"}, 
+  {"recvfrom_nocancel","0x80,0x193,6,"}, 
+  {"getattrlistat","0x80,0x1dc,6,"}, 
+  {"macx_swapoff","0x80,0x31,2,"}, 
+  {"0x80.0x1e9","mremap_encrypted"}, 
+  {"0x80.0x1e8","renameatx_np"}, 
+  {"setprivexec","0x80,0x98,1,"}, 
+  {NULL, NULL}
+};
+// 0x5579889db170
+// TODO
+typedef int (*GperfForeachCallback)(void *user, const char *k, const char *v);
+int gperf_darwin_x86_32_foreach(GperfForeachCallback cb, void *user) {
+  int i = 0; while (kvs[i].name) {
+  cb (user, kvs[i].name, kvs[i].value);
+  i++;}
+  return 0;
+}
+const char *gperf_darwin_x86_32_get(const char *s) {
+  int i = 0; while (kvs[i].name) {
+  if (!strcmp (s, kvs[i].name)) return kvs[i].value;
+  i++;}
+  return NULL;
+}
+#define sdb_hash_c_darwin_x86_32(x,y) gperf_darwin_x86_32_hash(x)
+const unsigned int gperf_darwin_x86_32_hash(const char *s) {
+  int sum = strlen (s);
+  while (*s) { sum += *s; s++; }
+  return sum;
+}
+struct {const char *name;void *get;void *hash;void *foreach;} gperf_darwin_x86_32 = {
+  .name = "darwin-x86-32",
+  .get = &gperf_darwin_x86_32_get,
+  .hash = &gperf_darwin_x86_32_hash,
+  .foreach = &gperf_darwin_x86_32_foreach
+};
+
+#if MAIN
+int main () {
+	const char *s = ((char*(*)(char*))gperf_darwin_x86_32.get)("foo");
+	printf ("%s\n", s);
+}
+#endif
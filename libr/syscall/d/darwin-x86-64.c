@@ -0,0 +1,979 @@
+// SDB-CGEN V1.9.4
+// gcc -DMAIN=1 darwin_x86_64.c ; ./a.out > darwin_x86_64.h
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+struct kv { const char *name; const char *value; };
+static const struct kv kvs[] = {
+  {"getlogin","0x80,0x2000031,2,"}, 
+  {"audit_session_self","0x80,0x20001ac,0,"}, 
+  {"0x80.0x20000f7","nfsclnt"}, 
+  {"0x80.0x20000f5","ffsctl"}, 
+  {"0x80.0x20000f4","posix_spawn"}, 
+  {"adjtime","0x80,0x200008c,2,"}, 
+  {"0x80.0x20000f3","initgroups"}, 
+  {"readlinkat","0x80,0x20001d9,4,"}, 
+  {"0x80.0x20000f2","fsctl"}, 
+  {"watchevent","0x80,0x20000e7,2,"}, 
+  {"0x80.0x20000f1","flistxattr"}, 
+  {"0x80.0x20000f0","listxattr"}, 
+  {"_kernelrpc_mach_port_destruct_trap","0x80,0x1000019,4,"}, 
+  {"mmap","0x80,0x20000c5,6,"}, 
+  {"setprivexec","0x80,0x2000098,1,"}, 
+  {"swtch_pri","0x80,0x100003b,0,"}, 
+  {"aio_suspend_nocancel","0x80,0x20001a5,3,"}, 
+  {"0x80.0x20000f8","fhopen"}, 
+  {"0x80.0x20000de","getdirentriesattr"}, 
+  {"0x80.0x20000dd","setattrlist"}, 
+  {"getattrlistbulk","0x80,0x20001cd,5,"}, 
+  {"setauid","0x80,0x2000162,1,"}, 
+  {"0x80.0x20000df","exchangedata"}, 
+  {"0x80.0x20000dc","getattrlist"}, 
+  {"sem_wait_nocancel","0x80,0x20001a4,1,"}, 
+  {"reboot","0x80,0x2000037,2,"}, 
+  {"memorystatus_control","0x80,0x20001b8,5,"}, 
+  {"psynch_rw_unlock","0x80,0x2000134,5,"}, 
+  {"bsdthread_terminate","0x80,0x2000169,4,"}, 
+  {"setsgroups","0x80,0x200011f,2,"}, 
+  {"mkdir_extended","0x80,0x2000124,5,"}, 
+  {"msgsnd","0x80,0x2000104,4,"}, 
+  {"0x80.0x20000ed","fsetxattr"}, 
+  {"0x80.0x20000ee","removexattr"}, 
+  {"0x80.0x20000ef","fremovexattr"}, 
+  {"writev_nocancel","0x80,0x200019c,3,"}, 
+  {"sigprocmask","0x80,0x2000030,3,"}, 
+  {"0x80.0x20000ea","getxattr"}, 
+  {"0x80.0x20000eb","fgetxattr"}, 
+  {"aio_return","0x80,0x200013a,1,"}, 
+  {"0x80.0x20000ec","setxattr"}, 
+  {"stack_snapshot_with_config","0x80,0x20001eb,3,"}, 
+  {"net_qos_guideline","0x80,0x200020d,2,"}, 
+  {"_kernelrpc_mach_port_construct_trap","0x80,0x1000018,4,"}, 
+  {"setregid","0x80,0x200007f,2,"}, 
+  {"symlinkat","0x80,0x20001da,3,"}, 
+  {"_","0x80"}, 
+  {"necp_session_open","0x80,0x200020a,1,"}, 
+  {"fsetattrlist","0x80,0x20000e5,5,"}, 
+  {"poll","0x80,0x20000e6,3,"}, 
+  {"terminate_with_payload","0x80,0x2000208,7,"}, 
+  {"__mac_set_file","0x80,0x200017f,2,"}, 
+  {"__pthread_fchdir","0x80,0x200015d,1,"}, 
+  {"sigaltstack","0x80,0x2000035,2,"}, 
+  {"sendto_nocancel","0x80,0x200019d,6,"}, 
+  {"ptrace","0x80,0x200001a,4,"}, 
+  {"setpriority","0x80,0x2000060,3,"}, 
+  {"disconnectx","0x80,0x20001c0,3,"}, 
+  {"minherit","0x80,0x20000fa,3,"}, 
+  {"iokit_user_client_trap","0x80,0x1000064,8,"}, 
+  {"access","0x80,0x2000021,2,"}, 
+  {"chmod","0x80,0x200000f,2,"}, 
+  {"gettid","0x80,0x200011e,2,"}, 
+  {"task_for_pid","0x80,0x100002d,3,"}, 
+  {"fstatat","0x80,0x20001d5,4,"}, 
+  {"fgetattrlist","0x80,0x20000e4,5,"}, 
+  {"getsgroups","0x80,0x2000120,2,"}, 
+  {"undelete","0x80,0x20000cd,1,"}, 
+  {"close","0x80,0x2000006,1,"}, 
+  {"lchown","0x80,0x200016c,3,"}, 
+  {"coalition_info","0x80,0x20001cb,4,"}, 
+  {"fchdir","0x80,0x200000d,1,"}, 
+  {"msgrcv_nocancel","0x80,0x20001a3,5,"}, 
+  {"kevent_id","0x80,0x2000177,8,"}, 
+  {"__sigwait_nocancel","0x80,0x20001a6,2,"}, 
+  {"setreuid","0x80,0x200007e,2,"}, 
+  {"sync","0x80,0x2000024,0,"}, 
+  {"kill","0x80,0x2000025,3,"}, 
+  {"fgetxattr","0x80,0x20000eb,6,"}, 
+  {"getpgid","0x80,0x2000097,1,"}, 
+  {"getfsstat","0x80,0x2000012,3,"}, 
+  {"0x80.0x100000b","_kernelrpc_mach_vm_purgable_control_trap"}, 
+  {"0x80.0x100000c","_kernelrpc_mach_vm_deallocate_trap"}, 
+  {"0x80.0x100000a","_kernelrpc_mach_vm_allocate_trap"}, 
+  {"psynch_rw_upgrade","0x80,0x200012c,5,"}, 
+  {"shmget","0x80,0x2000109,3,"}, 
+  {"0x80.0x100000f","_kernelrpc_mach_vm_map_trap"}, 
+  {"0x80.0x100000e","_kernelrpc_mach_vm_protect_trap"}, 
+  {"_kernelrpc_mach_port_move_member_trap","0x80,0x1000014,3,"}, 
+  {"truncate","0x80,0x20000c8,2,"}, 
+  {"read_nocancel","0x80,0x200018c,3,"}, 
+  {"munmap","0x80,0x2000049,2,"}, 
+  {"sem_post","0x80,0x2000111,1,"}, 
+  {"0x80.0x1000020","mach_msg_overwrite_trap"}, 
+  {"0x80.0x1000021","semaphore_signal_trap"}, 
+  {"0x80.0x1000022","semaphore_signal_all_trap"}, 
+  {"0x80.0x1000023","semaphore_signal_thread_trap"}, 
+  {"0x80.0x1000024","semaphore_wait_trap"}, 
+  {"0x80.0x1000025","semaphore_wait_signal_trap"}, 
+  {"0x80.0x1000026","semaphore_timedwait_trap"}, 
+  {"fchflags","0x80,0x2000023,2,"}, 
+  {"0x80.0x1000027","semaphore_timedwait_signal_trap"}, 
+  {"0x80.0x200010a","shm_open"}, 
+  {"0x80.0x200010b","shm_unlink"}, 
+  {"getpid","0x80,0x2000014,0,"}, 
+  {"0x80.0x1000029","_kernelrpc_mach_port_guard_trap"}, 
+  {"0x80.0x200010c","sem_open"}, 
+  {"0x80.0x200010d","sem_close"}, 
+  {"setlogin","0x80,0x2000032,1,"}, 
+  {"0x80.0x200010e","sem_unlink"}, 
+  {"0x80.0x200010f","sem_wait"}, 
+  {"necp_match_policy","0x80,0x20001cc,3,"}, 
+  {"usrctl","0x80,0x20001bd,1,"}, 
+  {"mach_wait_until_trap","0x80,0x100005a,1,"}, 
+  {"0x80.0x100003a","pfz_exit"}, 
+  {"pid_shutdown_sockets","0x80,0x20001b4,2,"}, 
+  {"0x80.0x100003c","swtch"}, 
+  {"0x80.0x100003b","swtch_pri"}, 
+  {"0x80.0x100003e","clock_sleep_trap"}, 
+  {"0x80.0x100003d","thread_switch"}, 
+  {"setwgroups","0x80,0x2000121,2,"}, 
+  {"getxattr","0x80,0x20000ea,6,"}, 
+  {"_kernelrpc_mach_vm_deallocate_trap","0x80,0x100000c,3,"}, 
+  {"listxattr","0x80,0x20000f0,4,"}, 
+  {"aio_write","0x80,0x200013f,1,"}, 
+  {"fhopen","0x80,0x20000f8,2,"}, 
+  {"psynch_mutexdrop","0x80,0x200012e,5,"}, 
+  {"_kernelrpc_mach_port_insert_member_trap","0x80,0x1000016,3,"}, 
+  {"sendmsg","0x80,0x200001c,3,"}, 
+  {"__mac_set_fd","0x80,0x2000185,2,"}, 
+  {"sfi_ctl","0x80,0x20001c8,4,"}, 
+  {"proc_rlimit_control","0x80,0x20001be,3,"}, 
+  {"unlinkat","0x80,0x20001d8,3,"}, 
+  {"symlink","0x80,0x2000039,2,"}, 
+  {"process_policy","0x80,0x2000143,7,"}, 
+  {"0x80.0x100002a","_kernelrpc_mach_port_unguard_trap"}, 
+  {"0x80.0x100002b","mach_generate_activity_id"}, 
+  {"getgid","0x80,0x200002f,0,"}, 
+  {"0x80.0x100002c","task_name_for_pid"}, 
+  {"0x80.0x100002d","task_for_pid"}, 
+  {"0x80.0x100002e","pid_for_task"}, 
+  {"recvmsg_nocancel","0x80,0x2000191,3,"}, 
+  {"0x80.0x200020c","setattrlistat"}, 
+  {"0x80.0x200020b","necp_session_action"}, 
+  {"writev","0x80,0x2000079,3,"}, 
+  {"openat_nocancel","0x80,0x20001d0,4,"}, 
+  {"0x80.0x200020a","necp_session_open"}, 
+  {"close_nocancel","0x80,0x200018f,1,"}, 
+  {"getuid","0x80,0x2000018,0,"}, 
+  {"task_self_trap","0x80,0x100001c,0,"}, 
+  {"fsctl","0x80,0x20000f2,4,"}, 
+  {"0x80.0x200020f","ntp_adjtime"}, 
+  {"getitimer","0x80,0x2000056,2,"}, 
+  {"0x80.0x200020e","fmount"}, 
+  {"0x80.0x200020d","net_qos_guideline"}, 
+  {"semaphore_timedwait_trap","0x80,0x1000026,3,"}, 
+  {"__pthread_kill","0x80,0x2000148,2,"}, 
+  {"macx_swapoff","0x80,0x1000031,2,"}, 
+  {"setgid","0x80,0x20000b5,1,"}, 
+  {"guarded_write_np","0x80,0x20001e5,4,"}, 
+  {"psynch_rw_downgrade","0x80,0x200012b,5,"}, 
+  {"listen","0x80,0x200006a,2,"}, 
+  {"workq_open","0x80,0x200016f,0,"}, 
+  {"getdirentriesattr","0x80,0x20000de,8,"}, 
+  {"0x80.0x200000a","unlink"}, 
+  {"fmount","0x80,0x200020e,4,"}, 
+  {"shmsys","0x80,0x20000fd,4,"}, 
+  {"0x80.0x2000100","semop"}, 
+  {"lio_listio","0x80,0x2000140,4,"}, 
+  {"0x80.0x200000c","chdir"}, 
+  {"0x80.0x2000102","msgctl"}, 
+  {"0x80.0x200000e","mknod"}, 
+  {"0x80.0x2000103","msgget"}, 
+  {"getsockname","0x80,0x2000020,3,"}, 
+  {"0x80.0x200000d","fchdir"}, 
+  {"0x80.0x2000104","msgsnd"}, 
+  {"0x80.0x2000105","msgrcv"}, 
+  {"faccessat","0x80,0x20001d2,4,"}, 
+  {"0x80.0x200000f","chmod"}, 
+  {"0x80.0x2000106","shmat"}, 
+  {"0x80.0x2000107","shmctl"}, 
+  {"0x80.0x2000108","shmdt"}, 
+  {"unmount","0x80,0x200009f,2,"}, 
+  {"0x80.0x2000109","shmget"}, 
+  {"0x80.0x1000031","macx_swapoff"}, 
+  {"0x80.0x1000030","macx_swapon"}, 
+  {"0x80.0x1000033","macx_triggers"}, 
+  {"0x80.0x1000032","thread_get_special_reply_port"}, 
+  {"nfsclnt","0x80,0x20000f7,2,"}, 
+  {"0x80.0x1000035","macx_backing_store_recovery"}, 
+  {"0x80.0x1000034","macx_backing_store_suspend"}, 
+  {"sigreturn","0x80,0x20000b8,2,"}, 
+  {"necp_session_action","0x80,0x200020b,6,"}, 
+  {"fclonefileat","0x80,0x2000205,4,"}, 
+  {"__pthread_chdir","0x80,0x200015c,1,"}, 
+  {"mk_timer_cancel_trap","0x80,0x100005e,2,"}, 
+  {"auditctl","0x80,0x2000167,1,"}, 
+  {"socketpair","0x80,0x2000087,4,"}, 
+  {"csrctl","0x80,0x20001e3,3,"}, 
+  {"0x80.0x200001a","ptrace"}, 
+  {"removexattr","0x80,0x20000ee,3,"}, 
+  {"0x80.0x200001b","recvmsg"}, 
+  {"0x80.0x200001c","sendmsg"}, 
+  {"0x80.0x200001d","recvfrom"}, 
+  {"0x80.0x200001e","accept"}, 
+  {"0x80.0x200001f","getpeername"}, 
+  {"statfs64","0x80,0x2000159,2,"}, 
+  {"netagent_trigger","0x80,0x20001ea,2,"}, 
+  {"0x80.0x1000064","iokit_user_client_trap"}, 
+  {"necp_client_action","0x80,0x20001f6,6,"}, 
+  {"__mac_set_link","0x80,0x2000181,2,"}, 
+  {"acct","0x80,0x2000033,1,"}, 
+  {"__mac_get_file","0x80,0x200017e,2,"}, 
+  {"0x80.0x200014d","__pthread_canceled"}, 
+  {"0x80.0x200014e","__semwait_signal"}, 
+  {"0x80.0x2000203","ulock_wait"}, 
+  {"recvmsg","0x80,0x200001b,3,"}, 
+  {"0x80.0x200014a","__sigwait"}, 
+  {"0x80.0x200014b","__disable_threadsignal"}, 
+  {"0x80.0x2000206","fs_snapshot"}, 
+  {"0x80.0x200014c","__pthread_markcancel"}, 
+  {"waitid_nocancel","0x80,0x20001a0,4,"}, 
+  {"0x80.0x2000205","fclonefileat"}, 
+  {"0x80.0x2000204","ulock_wake"}, 
+  {"mach_msg_overwrite_trap","0x80,0x1000020,8,"}, 
+  {"setitimer","0x80,0x2000053,3,"}, 
+  {"shm_open","0x80,0x200010a,3,"}, 
+  {"0x80.0x2000209","abort_with_payload"}, 
+  {"0x80.0x2000208","terminate_with_payload"}, 
+  {"initgroups","0x80,0x20000f3,3,"}, 
+  {"pid_hibernate","0x80,0x20001b3,1,"}, 
+  {"0x80.0x2000122","getwgroups"}, 
+  {"0x80.0x2000123","mkfifo_extended"}, 
+  {"0x80.0x2000120","getsgroups"}, 
+  {"mach_timebase_info_trap","0x80,0x1000059,1,"}, 
+  {"sigpending","0x80,0x2000034,1,"}, 
+  {"0x80.0x2000121","setwgroups"}, 
+  {"pid_suspend","0x80,0x20001b1,1,"}, 
+  {"0x80.0x2000126","shared_region_check_np"}, 
+  {"utimes","0x80,0x200008a,2,"}, 
+  {"0x80.0x2000124","mkdir_extended"}, 
+  {"0x80.0x2000125","identitysvc"}, 
+  {"bsdthread_ctl","0x80,0x20001de,4,"}, 
+  {"__semwait_signal_nocancel","0x80,0x20001a7,6,"}, 
+  {"0x80.0x1000013","_kernelrpc_mach_port_mod_refs_trap"}, 
+  {"0x80.0x2000128","vm_pressure_monitor"}, 
+  {"revoke","0x80,0x2000038,1,"}, 
+  {"0x80.0x1000012","_kernelrpc_mach_port_deallocate_trap"}, 
+  {"0x80.0x2000129","psynch_rw_longrdlock"}, 
+  {"mk_timer_create_trap","0x80,0x100005b,0,"}, 
+  {"0x80.0x1000011","_kernelrpc_mach_port_destroy_trap"}, 
+  {"0x80.0x1000010","_kernelrpc_mach_port_allocate_trap"}, 
+  {"getauid","0x80,0x2000161,1,"}, 
+  {"0x80.0x1000017","_kernelrpc_mach_port_extract_member_trap"}, 
+  {"0x80.0x2000001","exit"}, 
+  {"0x80.0x1000016","_kernelrpc_mach_port_insert_member_trap"}, 
+  {"mlockall","0x80,0x2000144,1,"}, 
+  {"0x80.0x1000015","_kernelrpc_mach_port_insert_right_trap"}, 
+  {"0x80.0x200013c","aio_cancel"}, 
+  {"__mac_syscall","0x80,0x200017d,3,"}, 
+  {"0x80.0x2000003","read"}, 
+  {"0x80.0x1000014","_kernelrpc_mach_port_move_member_trap"}, 
+  {"0x80.0x200013b","aio_suspend"}, 
+  {"0x80.0x2000002","fork"}, 
+  {"0x80.0x200013a","aio_return"}, 
+  {"0x80.0x2000005","open"}, 
+  {"0x80.0x2000210","ntp_gettime"}, 
+  {"0x80.0x2000004","write"}, 
+  {"0x80.0x1000019","_kernelrpc_mach_port_destruct_trap"}, 
+  {"0x80.0x2000211","os_fault_with_payload"}, 
+  {"0x80.0x2000007","wait4"}, 
+  {"0x80.0x1000018","_kernelrpc_mach_port_construct_trap"}, 
+  {"0x80.0x200013f","aio_write"}, 
+  {"0x80.0x2000006","close"}, 
+  {"0x80.0x200013e","aio_read"}, 
+  {"0x80.0x2000009","link"}, 
+  {"0x80.0x200013d","aio_error"}, 
+  {"mprotect","0x80,0x200004a,3,"}, 
+  {"fsetxattr","0x80,0x20000ed,6,"}, 
+  {"mk_timer_arm_trap","0x80,0x100005d,2,"}, 
+  {"macx_triggers","0x80,0x1000033,4,"}, 
+  {"0x80.0x2000111","sem_post"}, 
+  {"0x80.0x2000110","sem_trywait"}, 
+  {"msgrcv","0x80,0x2000105,5,"}, 
+  {"0x80.0x2000112","sysctlbyname"}, 
+  {"searchfs","0x80,0x20000e1,6,"}, 
+  {"0x80.0x2000115","open_extended"}, 
+  {"kdebug_typefilter","0x80,0x20000b1,2,"}, 
+  {"umask_extended","0x80,0x2000116,2,"}, 
+  {"0x80.0x2000117","stat_extended"}, 
+  {"0x80.0x2000116","umask_extended"}, 
+  {"0x80.0x2000119","fstat_extended"}, 
+  {"0x80.0x2000118","lstat_extended"}, 
+  {"0x80.0x1000046","host_create_mach_voucher_trap"}, 
+  {"thread_switch","0x80,0x100003d,3,"}, 
+  {"msgget","0x80,0x2000103,2,"}, 
+  {"0x80.0x2000010","chown"}, 
+  {"memorystatus_get_level","0x80,0x20001c5,1,"}, 
+  {"0x80.0x200012b","psynch_rw_downgrade"}, 
+  {"0x80.0x2000012","getfsstat"}, 
+  {"0x80.0x200012c","psynch_rw_upgrade"}, 
+  {"0x80.0x2000014","getpid"}, 
+  {"0x80.0x200012a","psynch_rw_yieldwrlock"}, 
+  {"0x80.0x200012f","psynch_cvbroad"}, 
+  {"0x80.0x2000017","setuid"}, 
+  {"0x80.0x200012d","psynch_mutexwait"}, 
+  {"0x80.0x2000018","getuid"}, 
+  {"0x80.0x200012e","psynch_mutexdrop"}, 
+  {"0x80.0x2000019","geteuid"}, 
+  {"0x80.0x1000048","mach_voucher_extract_attr_recipe_trap"}, 
+  {"0x80.0x100001c","task_self_trap"}, 
+  {"0x80.0x100001b","thread_self_trap"}, 
+  {"psynch_rw_unlock2","0x80,0x2000135,5,"}, 
+  {"0x80.0x100001a","mach_reply_port"}, 
+  {"abort_with_payload","0x80,0x2000209,6,"}, 
+  {"_kernelrpc_mach_port_unguard_trap","0x80,0x100002a,3,"}, 
+  {"getrlimit","0x80,0x20000c2,2,"}, 
+  {"0x80.0x200004e","mincore"}, 
+  {"0x80.0x100001f","mach_msg_trap"}, 
+  {"0x80.0x2000144","mlockall"}, 
+  {"0x80.0x100001d","host_self_trap"}, 
+  {"waitevent","0x80,0x20000e8,2,"}, 
+  {"0x80.0x2000145","munlockall"}, 
+  {"0x80.0x200004f","getgroups"}, 
+  {"0x80.0x200004a","mprotect"}, 
+  {"0x80.0x2000147","issetugid"}, 
+  {"0x80.0x2000140","lio_listio"}, 
+  {"select_nocancel","0x80,0x2000197,5,"}, 
+  {"0x80.0x200004b","madvise"}, 
+  {"0x80.0x2000142","iopolicysys"}, 
+  {"0x80.0x2000143","process_policy"}, 
+  {"pselect","0x80,0x200018a,6,"}, 
+  {"readlink","0x80,0x200003a,3,"}, 
+  {"setxattr","0x80,0x20000ec,6,"}, 
+  {"__mac_set_proc","0x80,0x2000183,1,"}, 
+  {"0x80.0x2000148","__pthread_kill"}, 
+  {"0x80.0x2000149","__pthread_sigmask"}, 
+  {"stat64","0x80,0x2000152,2,"}, 
+  {"0x80.0x2000023","fchflags"}, 
+  {"semaphore_wait_trap","0x80,0x1000024,1,"}, 
+  {"0x80.0x2000022","chflags"}, 
+  {"0x80.0x200011a","chmod_extended"}, 
+  {"sem_trywait","0x80,0x2000110,1,"}, 
+  {"wait4","0x80,0x2000007,4,"}, 
+  {"0x80.0x2000021","access"}, 
+  {"0x80.0x2000020","getsockname"}, 
+  {"0x80.0x200011c","access_extended"}, 
+  {"fstatfs","0x80,0x200009e,2,"}, 
+  {"lstat64","0x80,0x2000154,2,"}, 
+  {"0x80.0x2000027","getppid"}, 
+  {"0x80.0x200011b","fchmod_extended"}, 
+  {"0x80.0x200011e","gettid"}, 
+  {"0x80.0x2000025","kill"}, 
+  {"0x80.0x200011d","settid"}, 
+  {"0x80.0x2000024","sync"}, 
+  {"0x80.0x200011f","setsgroups"}, 
+  {"0x80.0x2000029","dup"}, 
+  {"grab_pgo_data","0x80,0x20001ed,4,"}, 
+  {"0x80.0x200005d","select"}, 
+  {"0x80.0x2000133","psynch_rw_wrlock"}, 
+  {"0x80.0x200005f","fsync"}, 
+  {"0x80.0x2000132","psynch_rw_rdlock"}, 
+  {"0x80.0x2000131","psynch_cvwait"}, 
+  {"0x80.0x2000130","psynch_cvsignal"}, 
+  {"0x80.0x200005a","dup2"}, 
+  {"0x80.0x2000137","settid_with_pid"}, 
+  {"0x80.0x2000136","getsid"}, 
+  {"telemetry","0x80,0x20001c3,6,"}, 
+  {"0x80.0x200005c","fcntl"}, 
+  {"0x80.0x2000135","psynch_rw_unlock2"}, 
+  {"0x80.0x2000134","psynch_rw_unlock"}, 
+  {"stat_extended","0x80,0x2000117,4,"}, 
+  {"0x80.0x2000139","aio_fsync"}, 
+  {"0x80.0x2000138","psynch_cvclrprepost"}, 
+  {"thread_get_special_reply_port","0x80,0x1000032,0,"}, 
+  {"open","0x80,0x2000005,3,"}, 
+  {"guarded_close_np","0x80,0x20001ba,2,"}, 
+  {"0x80.0x2000032","setlogin"}, 
+  {"readv_nocancel","0x80,0x200019b,3,"}, 
+  {"0x80.0x2000033","acct"}, 
+  {"0x80.0x2000030","sigprocmask"}, 
+  {"0x80.0x2000031","getlogin"}, 
+  {"0x80.0x2000036","ioctl"}, 
+  {"0x80.0x2000037","reboot"}, 
+  {"guarded_kqueue_np","0x80,0x20001bb,2,"}, 
+  {"0x80.0x2000034","sigpending"}, 
+  {"0x80.0x2000035","sigaltstack"}, 
+  {"0x80.0x2000038","revoke"}, 
+  {"0x80.0x200018a","pselect"}, 
+  {"0x80.0x2000039","symlink"}, 
+  {"0x80.0x200018b","pselect_nocancel"}, 
+  {"0x80.0x200018c","read_nocancel"}, 
+  {"0x80.0x200018d","write_nocancel"}, 
+  {"0x80.0x200018e","open_nocancel"}, 
+  {"0x80.0x200018f","close_nocancel"}, 
+  {"psynch_cvbroad","0x80,0x200012f,7,"}, 
+  {"0x80.0x200002b","getegid"}, 
+  {"0x80.0x2000166","setaudit_addr"}, 
+  {"lstat_extended","0x80,0x2000118,4,"}, 
+  {"0x80.0x200002a","pipe"}, 
+  {"system_override","0x80,0x20001c6,2,"}, 
+  {"0x80.0x2000167","auditctl"}, 
+  {"0x80.0x2000165","getaudit_addr"}, 
+  {"work_interval_ctl","0x80,0x20001f3,4,"}, 
+  {"0x80.0x200002f","getgid"}, 
+  {"0x80.0x2000162","setauid"}, 
+  {"pfz_exit","0x80,0x100003a,0,"}, 
+  {"getgroups","0x80,0x200004f,2,"}, 
+  {"0x80.0x200002e","sigaction"}, 
+  {"macx_swapon","0x80,0x1000030,4,"}, 
+  {"quotactl","0x80,0x20000a5,4,"}, 
+  {"0x80.0x2000161","getauid"}, 
+  {"psynch_rw_longrdlock","0x80,0x2000129,5,"}, 
+  {"fileport_makefd","0x80,0x20001af,1,"}, 
+  {"0x80.0x2000168","bsdthread_create"}, 
+  {"0x80.0x2000169","bsdthread_terminate"}, 
+  {"_kernelrpc_mach_vm_purgable_control_trap","0x80,0x100000b,4,"}, 
+  {"0x80.0x200017f","__mac_set_file"}, 
+  {"0x80.0x200017e","__mac_get_file"}, 
+  {"0x80.0x2000041","msync"}, 
+  {"0x80.0x200017d","__mac_syscall"}, 
+  {"0x80.0x200017c","__mac_execve"}, 
+  {"0x80.0x2000042","vfork"}, 
+  {"microstackshot","0x80,0x20001ec,3,"}, 
+  {"0x80.0x1000059","mach_timebase_info_trap"}, 
+  {"persona","0x80,0x20001ee,5,"}, 
+  {"0x80.0x2000049","munmap"}, 
+  {"__mac_get_mount","0x80,0x20001a9,2,"}, 
+  {"aio_suspend","0x80,0x200013b,3,"}, 
+  {"0x80.0x200003b","execve"}, 
+  {"0x80.0x200003c","umask"}, 
+  {"0x80.0x2000155","stat64_extended"}, 
+  {"0x80.0x2000154","lstat64"}, 
+  {"0x80.0x200003a","readlink"}, 
+  {"0x80.0x2000157","fstat64_extended"}, 
+  {"__mac_get_pid","0x80,0x2000186,2,"}, 
+  {"accept_nocancel","0x80,0x2000194,3,"}, 
+  {"0x80.0x2000156","lstat64_extended"}, 
+  {"pselect_nocancel","0x80,0x200018b,6,"}, 
+  {"0x80.0x2000151","sendfile"}, 
+  {"0x80.0x200003d","chroot"}, 
+  {"0x80.0x2000150","proc_info"}, 
+  {"0x80.0x2000153","fstat64"}, 
+  {"0x80.0x2000152","stat64"}, 
+  {"lseek","0x80,0x20000c7,3,"}, 
+  {"lstat64_extended","0x80,0x2000156,4,"}, 
+  {"readv","0x80,0x2000078,3,"}, 
+  {"0x80.0x2000159","statfs64"}, 
+  {"0x80.0x2000158","getdirentries64"}, 
+  {"0x80.0x2000055","swapon"}, 
+  {"0x80.0x200016f","workq_open"}, 
+  {"setgroups","0x80,0x2000050,2,"}, 
+  {"0x80.0x2000056","getitimer"}, 
+  {"sigsuspend","0x80,0x200006f,1,"}, 
+  {"semaphore_signal_trap","0x80,0x1000021,1,"}, 
+  {"auditon","0x80,0x200015f,3,"}, 
+  {"0x80.0x2000050","setgroups"}, 
+  {"0x80.0x200016e","bsdthread_register"}, 
+  {"0x80.0x2000051","getpgrp"}, 
+  {"0x80.0x200016b","kevent"}, 
+  {"0x80.0x2000052","setpgid"}, 
+  {"0x80.0x200016c","lchown"}, 
+  {"0x80.0x2000053","setitimer"}, 
+  {"fstat64_extended","0x80,0x2000157,4,"}, 
+  {"0x80.0x200016a","kqueue"}, 
+  {"_kernelrpc_mach_port_insert_right_trap","0x80,0x1000015,4,"}, 
+  {"0x80.0x100005f","mk_timer_arm_leeway_trap"}, 
+  {"0x80.0x2000059","getdtablesize"}, 
+  {"pwrite_nocancel","0x80,0x200019f,4,"}, 
+  {"getsid","0x80,0x2000136,1,"}, 
+  {"0x80.0x100005e","mk_timer_cancel_trap"}, 
+  {"0x80.0x100005d","mk_timer_arm_trap"}, 
+  {"host_create_mach_voucher_trap","0x80,0x1000046,4,"}, 
+  {"0x80.0x100005c","mk_timer_destroy_trap"}, 
+  {"0x80.0x100005b","mk_timer_create_trap"}, 
+  {"chdir","0x80,0x200000c,1,"}, 
+  {"0x80.0x100005a","mach_wait_until_trap"}, 
+  {"0x80.0x200008a","utimes"}, 
+  {"proc_trace_log","0x80,0x20001dd,2,"}, 
+  {"0x80.0x2000180","__mac_get_link"}, 
+  {"0x80.0x200008c","adjtime"}, 
+  {"0x80.0x2000181","__mac_set_link"}, 
+  {"workq_kernreturn","0x80,0x2000170,4,"}, 
+  {"0x80.0x200008b","futimes"}, 
+  {"peeloff","0x80,0x20001c1,2,"}, 
+  {"0x80.0x2000182","__mac_get_proc"}, 
+  {"0x80.0x200008e","gethostuuid"}, 
+  {"0x80.0x2000183","__mac_set_proc"}, 
+  {"flistxattr","0x80,0x20000f1,4,"}, 
+  {"0x80.0x2000184","__mac_get_fd"}, 
+  {"umask","0x80,0x200003c,1,"}, 
+  {"__mac_get_link","0x80,0x2000180,2,"}, 
+  {"0x80.0x2000185","__mac_set_fd"}, 
+  {"pwrite","0x80,0x200009a,4,"}, 
+  {"0x80.0x2000186","__mac_get_pid"}, 
+  {"0x80.0x200015e","audit"}, 
+  {"macx_backing_store_recovery","0x80,0x1000035,1,"}, 
+  {"0x80.0x200015d","__pthread_fchdir"}, 
+  {"0x80.0x2000064","getpriority"}, 
+  {"0x80.0x200015f","auditon"}, 
+  {"munlockall","0x80,0x2000145,1,"}, 
+  {"0x80.0x2000062","connect"}, 
+  {"0x80.0x200015a","fstatfs64"}, 
+  {"0x80.0x2000061","socket"}, 
+  {"0x80.0x2000060","setpriority"}, 
+  {"0x80.0x200015c","__pthread_chdir"}, 
+  {"0x80.0x200015b","getfsstat64"}, 
+  {"mk_timer_destroy_trap","0x80,0x100005c,1,"}, 
+  {"stat64_extended","0x80,0x2000155,4,"}, 
+  {"aio_read","0x80,0x200013e,1,"}, 
+  {"vfork","0x80,0x2000042,0,"}, 
+  {"guarded_writev_np","0x80,0x20001e7,4,"}, 
+  {"0x80.0x2000069","setsockopt"}, 
+  {"0x80.0x2000068","bind"}, 
+  {"renameat","0x80,0x20001d1,4,"}, 
+  {"0x80.0x2000177","kevent_id"}, 
+  {"0x80.0x2000176","kevent_qos"}, 
+  {"0x80.0x2000175","ledger"}, 
+  {"host_self_trap","0x80,0x100001d,0,"}, 
+  {"mkdir","0x80,0x2000088,2,"}, 
+  {"0x80.0x2000174","thread_selfid"}, 
+  {"pid_resume","0x80,0x20001b2,1,"}, 
+  {"0x80.0x2000173","__old_semwait_signal_nocancel"}, 
+  {"0x80.0x2000172","__old_semwait_signal"}, 
+  {"kevent_qos","0x80,0x2000176,8,"}, 
+  {"0x80.0x2000171","kevent64"}, 
+  {"0x80.0x2000170","workq_kernreturn"}, 
+  {"0x80.0x200009a","pwrite"}, 
+  {"0x80.0x200009b","nfssvc"}, 
+  {"waitid","0x80,0x20000ad,4,"}, 
+  {"0x80.0x200009d","statfs"}, 
+  {"__mac_getfsstat","0x80,0x20001aa,5,"}, 
+  {"0x80.0x200009e","fstatfs"}, 
+  {"0x80.0x200009f","unmount"}, 
+  {"madvise","0x80,0x200004b,3,"}, 
+  {"0x80.0x2000076","getsockopt"}, 
+  {"mlock","0x80,0x20000cb,2,"}, 
+  {"0x80.0x2000074","gettimeofday"}, 
+  {"0x80.0x2000075","getrusage"}, 
+  {"mach_generate_activity_id","0x80,0x100002b,3,"}, 
+  {"pipe","0x80,0x200002a,0,"}, 
+  {"thread_selfcounts","0x80,0x20000ba,3,"}, 
+  {"getdtablesize","0x80,0x2000059,0,"}, 
+  {"0x80.0x2000078","readv"}, 
+  {"0x80.0x2000079","writev"}, 
+  {"__pthread_sigmask","0x80,0x2000149,3,"}, 
+  {"0x80.0x200006f","sigsuspend"}, 
+  {"ffsctl","0x80,0x20000f5,4,"}, 
+  {"0x80.0x200006a","listen"}, 
+  {"thread_self_trap","0x80,0x100001b,0,"}, 
+  {"mincore","0x80,0x200004e,3,"}, 
+  {"mremap_encrypted","0x80,0x20001e9,5,"}, 
+  {"identitysvc","0x80,0x2000125,2,"}, 
+  {"audit_session_port","0x80,0x20001b0,2,"}, 
+  {"0x80.0x2000089","rmdir"}, 
+  {"psynch_rw_yieldwrlock","0x80,0x200012a,5,"}, 
+  {"0x80.0x2000088","mkdir"}, 
+  {"recvfrom_nocancel","0x80,0x2000193,6,"}, 
+  {"csops","0x80,0x20000a9,4,"}, 
+  {"_kernelrpc_mach_vm_protect_trap","0x80,0x100000e,5,"}, 
+  {"select","0x80,0x200005d,5,"}, 
+  {"psynch_cvsignal","0x80,0x2000130,8,"}, 
+  {"dup","0x80,0x2000029,1,"}, 
+  {"0x80.0x2000080","rename"}, 
+  {"0x80.0x2000083","flock"}, 
+  {"0x80.0x2000085","sendto"}, 
+  {"mk_timer_arm_leeway_trap","0x80,0x100005f,4,"}, 
+  {"0x80.0x2000084","mkfifo"}, 
+  {"msgctl","0x80,0x2000102,3,"}, 
+  {"0x80.0x2000087","socketpair"}, 
+  {"fcntl_nocancel","0x80,0x2000196,3,"}, 
+  {"0x80.0x2000086","shutdown"}, 
+  {"0x80.0x200007f","setregid"}, 
+  {"0x80.0x2000199","connect_nocancel"}, 
+  {"0x80.0x2000198","fsync_nocancel"}, 
+  {"0x80.0x200007e","setreuid"}, 
+  {"0x80.0x200007b","fchown"}, 
+  {"shm_unlink","0x80,0x200010b,1,"}, 
+  {"0x80.0x200007c","fchmod"}, 
+  {"0x80.0x200007a","settimeofday"}, 
+  {"sem_open","0x80,0x200010c,4,"}, 
+  {"open_dprotected_np","0x80,0x20000d8,5,"}, 
+  {"0x80.0x2000191","recvmsg_nocancel"}, 
+  {"0x80.0x2000190","wait4_nocancel"}, 
+  {"0x80.0x2000193","recvfrom_nocancel"}, 
+  {"0x80.0x2000192","sendmsg_nocancel"}, 
+  {"0x80.0x2000195","msync_nocancel"}, 
+  {"getpgrp","0x80,0x2000051,0,"}, 
+  {"0x80.0x2000194","accept_nocancel"}, 
+  {"0x80.0x2000197","select_nocancel"}, 
+  {"__pthread_markcancel","0x80,0x200014c,1,"}, 
+  {"0x80.0x2000098","setprivexec"}, 
+  {"0x80.0x2000196","fcntl_nocancel"}, 
+  {"bsdthread_register","0x80,0x200016e,7,"}, 
+  {"0x80.0x2000099","pread"}, 
+  {"semget","0x80,0x20000ff,3,"}, 
+  {"mach_voucher_extract_attr_recipe_trap","0x80,0x1000048,4,"}, 
+  {"pread_nocancel","0x80,0x200019e,4,"}, 
+  {"fchown","0x80,0x200007b,3,"}, 
+  {"0x80.0x2000093","setsid"}, 
+  {"0x80.0x2000097","getpgid"}, 
+  {"sysctlbyname","0x80,0x2000112,6,"}, 
+  {"pid_for_task","0x80,0x100002e,2,"}, 
+  {"audit_session_join","0x80,0x20001ad,1,"}, 
+  {"coalition","0x80,0x20001ca,3,"}, 
+  {"psynch_cvclrprepost","0x80,0x2000138,7,"}, 
+  {"fork","0x80,0x2000002,0,"}, 
+  {"rmdir","0x80,0x2000089,1,"}, 
+  {"recvmsg_x","0x80,0x20001e0,4,"}, 
+  {"_kernelrpc_mach_port_extract_member_trap","0x80,0x1000017,3,"}, 
+  {"seteuid","0x80,0x20000b7,1,"}, 
+  {"chflags","0x80,0x2000022,2,"}, 
+  {"0x80.0x200019a","sigsuspend_nocancel"}, 
+  {"0x80.0x200019c","writev_nocancel"}, 
+  {"msgsys","0x80,0x20000fc,5,"}, 
+  {"0x80.0x200019b","readv_nocancel"}, 
+  {"0x80.0x200019e","pread_nocancel"}, 
+  {"0x80.0x200019d","sendto_nocancel"}, 
+  {"guarded_open_np","0x80,0x20001b9,5,"}, 
+  {"0x80.0x200019f","pwrite_nocancel"}, 
+  {"ioctl","0x80,0x2000036,3,"}, 
+  {"getpeername","0x80,0x200001f,3,"}, 
+  {"openbyid_np","0x80,0x20001df,3,"}, 
+  {"shared_region_check_np","0x80,0x2000126,1,"}, 
+  {"setrlimit","0x80,0x20000c3,2,"}, 
+  {"open_nocancel","0x80,0x200018e,3,"}, 
+  {"psynch_mutexwait","0x80,0x200012d,5,"}, 
+  {"_kernelrpc_mach_port_mod_refs_trap","0x80,0x1000013,4,"}, 
+  {"_kernelrpc_mach_port_guard_trap","0x80,0x1000029,4,"}, 
+  {"exit","0x80,0x2000001,1,"}, 
+  {"semaphore_timedwait_signal_trap","0x80,0x1000027,4,"}, 
+  {"swtch","0x80,0x100003c,0,"}, 
+  {"__old_semwait_signal_nocancel","0x80,0x2000173,5,"}, 
+  {"setattrlistat","0x80,0x200020c,6,"}, 
+  {"fstatat64","0x80,0x20001d6,4,"}, 
+  {"fchmod","0x80,0x200007c,2,"}, 
+  {"open_extended","0x80,0x2000115,6,"}, 
+  {"change_fdguard_np","0x80,0x20001bc,6,"}, 
+  {"aio_fsync","0x80,0x2000139,2,"}, 
+  {"semop","0x80,0x2000100,3,"}, 
+  {"socket_delegate","0x80,0x20001c2,4,"}, 
+  {"issetugid","0x80,0x2000147,0,"}, 
+  {"fdatasync","0x80,0x20000bb,1,"}, 
+  {"getfsstat64","0x80,0x200015b,3,"}, 
+  {"vm_pressure_monitor","0x80,0x2000128,3,"}, 
+  {"fchownat","0x80,0x20001d4,5,"}, 
+  {"sem_wait","0x80,0x200010f,1,"}, 
+  {"shared_region_map_and_slide_np","0x80,0x20001b6,6,"}, 
+  {"sem_close","0x80,0x200010d,1,"}, 
+  {"getsockopt","0x80,0x2000076,5,"}, 
+  {"execve","0x80,0x200003b,3,"}, 
+  {"chown","0x80,0x2000010,3,"}, 
+  {"mkfifo_extended","0x80,0x2000123,5,"}, 
+  {"statfs","0x80,0x200009d,2,"}, 
+  {"iopolicysys","0x80,0x2000142,2,"}, 
+  {"fremovexattr","0x80,0x20000ef,3,"}, 
+  {"ulock_wake","0x80,0x2000204,3,"}, 
+  {"sysctl","0x80,0x20000ca,6,"}, 
+  {"kdebug_trace","0x80,0x20000b4,5,"}, 
+  {"guarded_pwrite_np","0x80,0x20001e6,5,"}, 
+  {"task_name_for_pid","0x80,0x100002c,3,"}, 
+  {"clonefileat","0x80,0x20001ce,5,"}, 
+  {"__semwait_signal","0x80,0x200014e,6,"}, 
+  {"sigaction","0x80,0x200002e,3,"}, 
+  {"gettimeofday","0x80,0x2000074,3,"}, 
+  {"connect","0x80,0x2000062,3,"}, 
+  {"_kernelrpc_mach_vm_map_trap","0x80,0x100000f,6,"}, 
+  {"psynch_cvwait","0x80,0x2000131,8,"}, 
+  {"sem_unlink","0x80,0x200010e,1,"}, 
+  {"macx_backing_store_suspend","0x80,0x1000034,1,"}, 
+  {"settid","0x80,0x200011d,2,"}, 
+  {"access_extended","0x80,0x200011c,4,"}, 
+  {"sendmsg_x","0x80,0x20001e1,4,"}, 
+  {"getegid","0x80,0x200002b,0,"}, 
+  {"stat","0x80,0x20000bc,2,"}, 
+  {"futimes","0x80,0x200008b,2,"}, 
+  {"__mac_get_proc","0x80,0x2000182,1,"}, 
+  {"kas_info","0x80,0x20001b7,3,"}, 
+  {"geteuid","0x80,0x2000019,0,"}, 
+  {"posix_spawn","0x80,0x20000f4,5,"}, 
+  {"fcntl","0x80,0x200005c,3,"}, 
+  {"fchmodat","0x80,0x20001d3,4,"}, 
+  {"os_fault_with_payload","0x80,0x2000211,6,"}, 
+  {"clock_sleep_trap","0x80,0x100003e,5,"}, 
+  {"settid_with_pid","0x80,0x2000137,2,"}, 
+  {"wait4_nocancel","0x80,0x2000190,4,"}, 
+  {"mach_msg_trap","0x80,0x100001f,7,"}, 
+  {"psynch_rw_wrlock","0x80,0x2000133,5,"}, 
+  {"link","0x80,0x2000009,2,"}, 
+  {"pathconf","0x80,0x20000bf,2,"}, 
+  {"mkdirat","0x80,0x20001db,3,"}, 
+  {"msgsnd_nocancel","0x80,0x20001a2,4,"}, 
+  {"shmat","0x80,0x2000106,3,"}, 
+  {"nfssvc","0x80,0x200009b,2,"}, 
+  {"ledger","0x80,0x2000175,4,"}, 
+  {"mount","0x80,0x20000a7,4,"}, 
+  {"write","0x80,0x2000004,3,"}, 
+  {"getpriority","0x80,0x2000064,2,"}, 
+  {"getattrlist","0x80,0x20000dc,5,"}, 
+  {"sendfile","0x80,0x2000151,6,"}, 
+  {"csops_audittoken","0x80,0x20000aa,5,"}, 
+  {"read","0x80,0x2000003,3,"}, 
+  {"sfi_pidctl","0x80,0x20001c9,4,"}, 
+  {"flock","0x80,0x2000083,2,"}, 
+  {"0x80.0x20001bb","guarded_kqueue_np"}, 
+  {"0x80.0x20001bc","change_fdguard_np"}, 
+  {"gethostuuid","0x80,0x200008e,3,"}, 
+  {"0x80.0x20001ba","guarded_close_np"}, 
+  {"semctl","0x80,0x20000fe,4,"}, 
+  {"0x80.0x20001bf","connectx"}, 
+  {"0x80.0x20001bd","usrctl"}, 
+  {"connect_nocancel","0x80,0x2000199,3,"}, 
+  {"0x80.0x20001be","proc_rlimit_control"}, 
+  {"__disable_threadsignal","0x80,0x200014b,1,"}, 
+  {"fpathconf","0x80,0x20000c0,2,"}, 
+  {"write_nocancel","0x80,0x200018d,3,"}, 
+  {"__mac_mount","0x80,0x20001a8,5,"}, 
+  {"swapon","0x80,0x2000055,0,"}, 
+  {"delete","0x80,0x20000e2,1,"}, 
+  {"ntp_gettime","0x80,0x2000210,1,"}, 
+  {"semaphore_signal_all_trap","0x80,0x1000022,1,"}, 
+  {"fchmod_extended","0x80,0x200011b,5,"}, 
+  {"sendto","0x80,0x2000085,6,"}, 
+  {"0x80.0x20001aa","__mac_getfsstat"}, 
+  {"0x80.0x20001ac","audit_session_self"}, 
+  {"0x80.0x20001ab","fsgetpath"}, 
+  {"dup2","0x80,0x200005a,2,"}, 
+  {"0x80.0x20001ae","fileport_makeport"}, 
+  {"0x80.0x20001ad","audit_session_join"}, 
+  {"0x80.0x20001af","fileport_makefd"}, 
+  {"bind","0x80,0x2000068,3,"}, 
+  {"mknod","0x80,0x200000e,3,"}, 
+  {"getdirentries64","0x80,0x2000158,4,"}, 
+  {"setuid","0x80,0x2000017,1,"}, 
+  {"fstat","0x80,0x20000bd,2,"}, 
+  {"copyfile","0x80,0x20000e3,4,"}, 
+  {"0x80.0x20001b2","pid_resume"}, 
+  {"0x80.0x20001b3","pid_hibernate"}, 
+  {"0x80.0x20001b0","audit_session_port"}, 
+  {"0x80.0x20001b1","pid_suspend"}, 
+  {"0x80.0x20001b6","shared_region_map_and_slide_np"}, 
+  {"0x80.0x20001b7","kas_info"}, 
+  {"0x80.0x20001b4","pid_shutdown_sockets"}, 
+  {"0x80.0x20001b8","memorystatus_control"}, 
+  {"0x80.0x20001b9","guarded_open_np"}, 
+  {"getentropy","0x80,0x20001f4,2,"}, 
+  {"vfs_purge","0x80,0x20001c7,0,"}, 
+  {"_kernelrpc_mach_vm_allocate_trap","0x80,0x100000a,4,"}, 
+  {"setsockopt","0x80,0x2000069,5,"}, 
+  {"shmdt","0x80,0x2000108,1,"}, 
+  {"fstatfs64","0x80,0x200015a,2,"}, 
+  {"ulock_wait","0x80,0x2000203,4,"}, 
+  {"semsys","0x80,0x20000fb,5,"}, 
+  {"msync_nocancel","0x80,0x2000195,3,"}, 
+  {"ntp_adjtime","0x80,0x200020f,1,"}, 
+  {"0x80.0x20000bc","stat"}, 
+  {"0x80.0x20000bb","fdatasync"}, 
+  {"modwatch","0x80,0x20000e9,2,"}, 
+  {"0x80.0x20001a1","poll_nocancel"}, 
+  {"0x80.0x20000ba","thread_selfcounts"}, 
+  {"0x80.0x20001a0","waitid_nocancel"}, 
+  {"0x80.0x20001a3","msgrcv_nocancel"}, 
+  {"0x80.0x20001a2","msgsnd_nocancel"}, 
+  {"0x80.0x20000bf","pathconf"}, 
+  {"fsync_nocancel","0x80,0x2000198,1,"}, 
+  {"0x80.0x20001a5","aio_suspend_nocancel"}, 
+  {"0x80.0x20000be","lstat"}, 
+  {"0x80.0x20001a4","sem_wait_nocancel"}, 
+  {"0x80.0x20000bd","fstat"}, 
+  {"0x80.0x20001a7","__semwait_signal_nocancel"}, 
+  {"getattrlistat","0x80,0x20001dc,6,"}, 
+  {"setpgid","0x80,0x2000052,2,"}, 
+  {"0x80.0x20001a6","__sigwait_nocancel"}, 
+  {"0x80.0x20001a9","__mac_get_mount"}, 
+  {"0x80.0x20001a8","__mac_mount"}, 
+  {"msync","0x80,0x2000041,3,"}, 
+  {"0x80.0x20000a1","getfh"}, 
+  {"0x80.0x20000a5","quotactl"}, 
+  {"connectx","0x80,0x20001bf,8,"}, 
+  {"0x80.0x20000a7","mount"}, 
+  {"bsdthread_create","0x80,0x2000168,5,"}, 
+  {"0x80.0x20000a9","csops"}, 
+  {"kevent","0x80,0x200016b,6,"}, 
+  {"shutdown","0x80,0x2000086,2,"}, 
+  {"recvfrom","0x80,0x200001d,6,"}, 
+  {"0x80.0x20000cb","mlock"}, 
+  {"0x80.0x20000cc","munlock"}, 
+  {"0x80.0x20001d4","fchownat"}, 
+  {"0x80.0x20001d5","fstatat"}, 
+  {"0x80.0x20000ca","sysctl"}, 
+  {"0x80.0x20001d6","fstatat64"}, 
+  {"0x80.0x20001d7","linkat"}, 
+  {"0x80.0x20001d0","openat_nocancel"}, 
+  {"0x80.0x20000cd","undelete"}, 
+  {"0x80.0x20001d1","renameat"}, 
+  {"kdebug_trace64","0x80,0x20000b3,5,"}, 
+  {"0x80.0x20001d2","faccessat"}, 
+  {"0x80.0x20001d3","fchmodat"}, 
+  {"0x80.0x20001d8","unlinkat"}, 
+  {"0x80.0x20001d9","readlinkat"}, 
+  {"getdirentries","0x80,0x20000c4,4,"}, 
+  {"0x80.0x20000b3","kdebug_trace64"}, 
+  {"0x80.0x20000b2","kdebug_trace_string"}, 
+  {"unlink","0x80,0x200000a,1,"}, 
+  {"0x80.0x20000b1","kdebug_typefilter"}, 
+  {"accept","0x80,0x200001e,3,"}, 
+  {"0x80.0x20000b7","seteuid"}, 
+  {"0x80.0x20000b6","setegid"}, 
+  {"0x80.0x20000b5","setgid"}, 
+  {"linkat","0x80,0x20001d7,5,"}, 
+  {"0x80.0x20000b4","kdebug_trace"}, 
+  {"fstat_extended","0x80,0x2000119,4,"}, 
+  {"_kernelrpc_mach_port_deallocate_trap","0x80,0x1000012,2,"}, 
+  {"0x80.0x20000b8","sigreturn"}, 
+  {"chroot","0x80,0x200003d,1,"}, 
+  {"thread_selfid","0x80,0x2000174,0,"}, 
+  {"0x80.0x20001c3","telemetry"}, 
+  {"0x80.0x20001c2","socket_delegate"}, 
+  {"aio_error","0x80,0x200013d,1,"}, 
+  {"0x80.0x20001c1","peeloff"}, 
+  {"fsync","0x80,0x200005f,1,"}, 
+  {"0x80.0x20001c0","disconnectx"}, 
+  {"0x80.0x20001c7","vfs_purge"}, 
+  {"0x80.0x20001c6","system_override"}, 
+  {"0x80.0x20001c5","memorystatus_get_level"}, 
+  {"getppid","0x80,0x2000027,0,"}, 
+  {"kqueue","0x80,0x200016a,0,"}, 
+  {"0x80.0x20001c4","proc_uuid_policy"}, 
+  {"pread","0x80,0x2000099,4,"}, 
+  {"socket","0x80,0x2000061,3,"}, 
+  {"0x80.0x20001c9","sfi_pidctl"}, 
+  {"0x80.0x20001c8","sfi_ctl"}, 
+  {"setattrlist","0x80,0x20000dd,5,"}, 
+  {"0x80.0x20000c2","getrlimit"}, 
+  {"0x80.0x20000c3","setrlimit"}, 
+  {"0x80.0x20001ee","persona"}, 
+  {"0x80.0x20000c0","fpathconf"}, 
+  {"0x80.0x20001ed","grab_pgo_data"}, 
+  {"chmod_extended","0x80,0x200011a,5,"}, 
+  {"fs_snapshot","0x80,0x2000206,6,"}, 
+  {"fsgetpath","0x80,0x20001ab,4,"}, 
+  {"0x80.0x20000c7","lseek"}, 
+  {"0x80.0x20001ea","netagent_trigger"}, 
+  {"0x80.0x20000c4","getdirentries"}, 
+  {"0x80.0x20000c5","mmap"}, 
+  {"0x80.0x20001ec","microstackshot"}, 
+  {"0x80.0x20001eb","stack_snapshot_with_config"}, 
+  {"kdebug_trace_string","0x80,0x20000b2,3,"}, 
+  {"settimeofday","0x80,0x200007a,2,"}, 
+  {"semaphore_signal_thread_trap","0x80,0x1000023,2,"}, 
+  {"0x80.0x20000c8","truncate"}, 
+  {"guarded_open_dprotected_np","0x80,0x20001e4,7,"}, 
+  {"0x80.0x20000c9","ftruncate"}, 
+  {"necp_open","0x80,0x20001f5,1,"}, 
+  {"munlock","0x80,0x20000cc,2,"}, 
+  {"_kernelrpc_mach_port_destroy_trap","0x80,0x1000011,2,"}, 
+  {"0x80.0x20000aa","csops_audittoken"}, 
+  {"0x80.0x20001f6","necp_client_action"}, 
+  {"fstat64","0x80,0x2000153,2,"}, 
+  {"0x80.0x20001f4","getentropy"}, 
+  {"0x80.0x20000ad","waitid"}, 
+  {"0x80.0x20001f5","necp_open"}, 
+  {"openat","0x80,0x20001cf,4,"}, 
+  {"0x80.0x20001f3","work_interval_ctl"}, 
+  {"semaphore_wait_signal_trap","0x80,0x1000025,2,"}, 
+  {"sendmsg_nocancel","0x80,0x2000192,3,"}, 
+  {"aio_cancel","0x80,0x200013c,2,"}, 
+  {"getrusage","0x80,0x2000075,2,"}, 
+  {"renameatx_np","0x80,0x20001e8,5,"}, 
+  {"kevent64","0x80,0x2000171,7,"}, 
+  {"audit","0x80,0x200015e,2,"}, 
+  {"ftruncate","0x80,0x20000c9,2,"}, 
+  {"0x80.0x20001dd","proc_trace_log"}, 
+  {"0x80.0x20001de","bsdthread_ctl"}, 
+  {"0x80.0x20001df","openbyid_np"}, 
+  {"setsid","0x80,0x2000093,0,"}, 
+  {"psynch_rw_rdlock","0x80,0x2000132,5,"}, 
+  {"0x80.0x20001da","symlinkat"}, 
+  {"proc_uuid_policy","0x80,0x20001c4,4,"}, 
+  {"0x80.0x20001db","mkdirat"}, 
+  {"0x80.0x20001dc","getattrlistat"}, 
+  {"__pthread_canceled","0x80,0x200014d,1,"}, 
+  {"0x80.0x20000d8","open_dprotected_np"}, 
+  {"proc_info","0x80,0x2000150,6,"}, 
+  {"0x80.0x20000ff","semget"}, 
+  {"0x80.0x20001e5","guarded_write_np"}, 
+  {"poll_nocancel","0x80,0x20001a1,3,"}, 
+  {"0x80.0x20000fe","semctl"}, 
+  {"0x80.0x20001e4","guarded_open_dprotected_np"}, 
+  {"mkfifo","0x80,0x2000084,2,"}, 
+  {"0x80.0x20000fd","shmsys"}, 
+  {"0x80.0x20001e7","guarded_writev_np"}, 
+  {"0x80.0x20000fc","msgsys"}, 
+  {"0x80.0x20001e6","guarded_pwrite_np"}, 
+  {"__mac_execve","0x80,0x200017c,4,"}, 
+  {"0x80.0x20000fb","semsys"}, 
+  {"0x80.0x20001e1","sendmsg_x"}, 
+  {"0x80.0x20000fa","minherit"}, 
+  {"0x80.0x20001e0","recvmsg_x"}, 
+  {"0x80.0x20001e3","csrctl"}, 
+  {"rename","0x80,0x2000080,2,"}, 
+  {"0x80.0x20001e2","thread_selfusage"}, 
+  {"0x80.0x20001e9","mremap_encrypted"}, 
+  {"sigsuspend_nocancel","0x80,0x200019a,1,"}, 
+  {"exchangedata","0x80,0x20000df,3,"}, 
+  {"0x80.0x20001e8","renameatx_np"}, 
+  {"0x80.0x20000e4","fgetattrlist"}, 
+  {"0x80.0x20000e5","fsetattrlist"}, 
+  {"0x80.0x20001cc","necp_match_policy"}, 
+  {"0x80.0x20000e6","poll"}, 
+  {"0x80.0x20001cb","coalition_info"}, 
+  {"0x80.0x20000e7","watchevent"}, 
+  {"0x80.0x20001ca","coalition"}, 
+  {"__mac_get_fd","0x80,0x2000184,2,"}, 
+  {"__sigwait","0x80,0x200014a,2,"}, 
+  {"0x80.0x20000e1","searchfs"}, 
+  {"setaudit_addr","0x80,0x2000166,2,"}, 
+  {"0x80.0x20000e2","delete"}, 
+  {"0x80.0x20001cf","openat"}, 
+  {"getwgroups","0x80,0x2000122,2,"}, 
+  {"0x80.0x20000e3","copyfile"}, 
+  {"0x80.0x20001ce","clonefileat"}, 
+  {"0x80.0x20001cd","getattrlistbulk"}, 
+  {"setegid","0x80,0x20000b6,1,"}, 
+  {"mach_reply_port","0x80,0x100001a,0,"}, 
+  {"0x80.0x20000e8","waitevent"}, 
+  {"0x80.0x20000e9","modwatch"}, 
+  {"_kernelrpc_mach_port_allocate_trap","0x80,0x1000010,3,"}, 
+  {"shmctl","0x80,0x2000107,3,"}, 
+  {"lstat","0x80,0x20000be,2,"}, 
+  {"getaudit_addr","0x80,0x2000165,2,"}, 
+  {"getfh","0x80,0x20000a1,2,"}, 
+  {"fileport_makeport","0x80,0x20001ae,2,"}, 
+  {"thread_selfusage","0x80,0x20001e2,0,"}, 
+  {"__old_semwait_signal","0x80,0x2000172,5,"}, 
+  {NULL, NULL}
+};
+// 0x56029330a170
+// TODO
+typedef int (*GperfForeachCallback)(void *user, const char *k, const char *v);
+int gperf_darwin_x86_64_foreach(GperfForeachCallback cb, void *user) {
+  int i = 0; while (kvs[i].name) {
+  cb (user, kvs[i].name, kvs[i].value);
+  i++;}
+  return 0;
+}
+const char *gperf_darwin_x86_64_get(const char *s) {
+  int i = 0; while (kvs[i].name) {
+  if (!strcmp (s, kvs[i].name)) return kvs[i].value;
+  i++;}
+  return NULL;
+}
+#define sdb_hash_c_darwin_x86_64(x,y) gperf_darwin_x86_64_hash(x)
+const unsigned int gperf_darwin_x86_64_hash(const char *s) {
+  int sum = strlen (s);
+  while (*s) { sum += *s; s++; }
+  return sum;
+}
+struct {const char *name;void *get;void *hash;void *foreach;} gperf_darwin_x86_64 = {
+  .name = "darwin-x86-64",
+  .get = &gperf_darwin_x86_64_get,
+  .hash = &gperf_darwin_x86_64_hash,
+  .foreach = &gperf_darwin_x86_64_foreach
+};
+
+#if MAIN
+int main () {
+	const char *s = ((char*(*)(char*))gperf_darwin_x86_64.get)("foo");
+	printf ("%s\n", s);
+}
+#endif
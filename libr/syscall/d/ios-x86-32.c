@@ -0,0 +1,687 @@
+// SDB-CGEN V1.9.4
+// gcc -DMAIN=1 ios_x86_32.c ; ./a.out > ios_x86_32.h
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+struct kv { const char *name; const char *value; };
+static const struct kv kvs[] = {
+  {"adjtime","0x81,140,0,"}, 
+  {"access_extended","0x81,284,0,"}, 
+  {"revoke","0x81,56,0,"}, 
+  {"getauid","0x81,353,0,"}, 
+  {"setitimer","0x81,83,0,"}, 
+  {"0x81.118","getsockopt"}, 
+  {"fchmod","0x81,124,0,"}, 
+  {"fchmod_extended","0x81,283,0,"}, 
+  {"aio_suspend_nocancel","0x81,421,0,"}, 
+  {"getfsstat","0x81,18,3,pii"}, 
+  {"kevent64","0x81,369,7,"}, 
+  {"0x81.111","sigsuspend"}, 
+  {"0x81.116","gettimeofday"}, 
+  {"0x81.117","getrusage"}, 
+  {"getxattr","0x81,234,0,"}, 
+  {"link","0x81,9,2,zz"}, 
+  {"aio_write","0x81,319,0,"}, 
+  {"issetugid","0x81,327,0,"}, 
+  {"pid_shutdown_sockets","0x81,436,0,"}, 
+  {"0x81.408","fsync_nocancel"}, 
+  {"0x81.409","connect_nocancel"}, 
+  {"__mac_set_lctx","0x81,393,0,"}, 
+  {"recvmsg_nocancel","0x81,401,0,"}, 
+  {"0x81.406","fcntl_nocancel"}, 
+  {"0x81.407","select_nocancel"}, 
+  {"0x81.404","accept_nocancel"}, 
+  {"0x81.405","msync_nocancel"}, 
+  {"setprivexec","0x81,152,0,"}, 
+  {"0x81.402","sendmsg_nocancel"}, 
+  {"0x81.403","recvfrom_nocancel"}, 
+  {"0x81.400","wait4_nocancel"}, 
+  {"0x81.401","recvmsg_nocancel"}, 
+  {"sigaltstack","0x81,53,0,"}, 
+  {"0x81.169","csops"}, 
+  {"auditctl","0x81,359,0,"}, 
+  {"stack_snapshot","0x81,365,0,"}, 
+  {"0x81.165","quotactl"}, 
+  {"fstat64","0x81,339,0,"}, 
+  {"0x81.167","mount"}, 
+  {"__pthread_sigmask","0x81,329,0,"}, 
+  {"getlogin","0x81,49,0,"}, 
+  {"fork","0x81,2,0,"}, 
+  {"sendmsg_nocancel","0x81,402,0,"}, 
+  {"rename","0x81,128,0,"}, 
+  {"0x81.439","kas_info"}, 
+  {"0x81.438","shared_region_map_and_slide_np"}, 
+  {"getpgid","0x81,151,0,"}, 
+  {"0x81.435","pid_hibernate"}, 
+  {"0x81.434","pid_resume"}, 
+  {"connect_nocancel","0x81,409,0,"}, 
+  {"0x81.436","pid_shutdown_sockets"}, 
+  {"0x81.431","fileport_makefd"}, 
+  {"0x81.430","fileport_makeport"}, 
+  {"0x81.433","pid_suspend"}, 
+  {"shared_region_map_and_slide_np","0x81,438,0,"}, 
+  {"0x81.432","audit_session_port"}, 
+  {"gethostuuid","0x81,142,0,"}, 
+  {"getsgroups","0x81,288,0,"}, 
+  {"0x81.309","psynch_rw_unlock2"}, 
+  {"0x81.308","psynch_rw_unlock"}, 
+  {"0x81.170","170"}, 
+  {"0x81.173","waitid"}, 
+  {"0x81.280","lstat_extended"}, 
+  {"__mac_set_fd","0x81,389,0,"}, 
+  {"0x81.301","psynch_mutexwait"}, 
+  {"0x81.281","fstat_extended"}, 
+  {"0x81.300","psynch_rw_upgrade"}, 
+  {"0x81.282","chmod_extended"}, 
+  {"0x81.303","psynch_cvbroad"}, 
+  {"0x81.283","fchmod_extended"}, 
+  {"0x81.302","psynch_mutexdrop"}, 
+  {"0x81.284","access_extended"}, 
+  {"0x81.305","psynch_cvwait"}, 
+  {"0x81.285","settid"}, 
+  {"0x81.304","psynch_cvsignal"}, 
+  {"0x81.286","gettid"}, 
+  {"0x81.307","psynch_rw_wrlock"}, 
+  {"0x81.287","setsgroups"}, 
+  {"wait4_nocancel","0x81,400,0,"}, 
+  {"0x81.306","psynch_rw_rdlock"}, 
+  {"0x81.288","getsgroups"}, 
+  {"__disable_threadsignal","0x81,331,0,"}, 
+  {"psynch_rw_unlock2","0x81,309,0,"}, 
+  {"0x81.289","setwgroups"}, 
+  {"mlock","0x81,203,0,"}, 
+  {"__mac_get_proc","0x81,386,0,"}, 
+  {"sigsuspend_nocancel","0x81,410,0,"}, 
+  {"pipe","0x81,42,0,"}, 
+  {"0x81.147","setsid"}, 
+  {"wait4","0x81,7,3,"}, 
+  {"0x81.318","aio_read"}, 
+  {"0x81.319","aio_write"}, 
+  {"0x81.142","gethostuuid"}, 
+  {"psynch_cvsignal","0x81,304,0,"}, 
+  {"0x81.140","adjtime"}, 
+  {"0x81.310","getsid"}, 
+  {"0x81.311","settid_with_pid"}, 
+  {"0x81.312","psynch_cvclrprepost"}, 
+  {"setegid","0x81,182,0,"}, 
+  {"0x81.313","aio_fsync"}, 
+  {"setattrlist","0x81,221,0,"}, 
+  {"0x81.314","aio_return"}, 
+  {"0x81.315","aio_suspend"}, 
+  {"aio_read","0x81,318,0,"}, 
+  {"setpriority","0x81,96,0,"}, 
+  {"0x81.316","aio_cancel"}, 
+  {"0x81.417","poll_nocancel"}, 
+  {"0x81.317","aio_error"}, 
+  {"0x81.416","waitid_nocancel"}, 
+  {"0x81.415","pwrite_nocancel"}, 
+  {"0x81.414","pread_nocancel"}, 
+  {"getpid","0x81,20,0,"}, 
+  {"0x81.413","sendto_nocancel"}, 
+  {"0x81.412","writev_nocancel"}, 
+  {"0x81.411","readv_nocancel"}, 
+  {"0x81.410","sigsuspend_nocancel"}, 
+  {"fcntl_nocancel","0x81,406,0,"}, 
+  {"psynch_cvbroad","0x81,303,0,"}, 
+  {"fstat64_extended","0x81,343,0,"}, 
+  {"0x81.158","fstatfs"}, 
+  {"0x81.159","unmount"}, 
+  {"sem_init","0x81,275,0,"}, 
+  {"0x81.157","statfs"}, 
+  {"0x81.154","pwrite"}, 
+  {"getpriority","0x81,100,0,"}, 
+  {"sem_open","0x81,268,0,"}, 
+  {"__mac_syscall","0x81,381,0,"}, 
+  {"fsync","0x81,95,0,"}, 
+  {"0x81.39","getppid"}, 
+  {"getitimer","0x81,86,0,"}, 
+  {"sigreturn","0x81,184,0,"}, 
+  {"0x81.152","setprivexec"}, 
+  {"0x81.329","__pthread_sigmask"}, 
+  {"0x81.153","pread"}, 
+  {"fsetxattr","0x81,237,0,"}, 
+  {"0x81.328","__pthread_kill"}, 
+  {"0x81.151","getpgid"}, 
+  {"sem_wait_nocancel","0x81,420,0,"}, 
+  {"0x81.323","process_policy"}, 
+  {"0x81.31","getpeername"}, 
+  {"0x81.322","iopolicysys"}, 
+  {"0x81.30","accept"}, 
+  {"0x81.33","access"}, 
+  {"0x81.320","lio_listio"}, 
+  {"0x81.32","getsockname"}, 
+  {"0x81.327","issetugid"}, 
+  {"lstat_extended","0x81,280,0,"}, 
+  {"0x81.35","fchflags"}, 
+  {"pwrite","0x81,154,0,"}, 
+  {"0x81.34","chflags"}, 
+  {"0x81.325","munlockall"}, 
+  {"0x81.37","kill"}, 
+  {"0x81.324","mlockall"}, 
+  {"0x81.36","sync"}, 
+  {"readlink","0x81,58,0,"}, 
+  {"fileport_makefd","0x81,431,0,"}, 
+  {"lseek","0x81,199,0,"}, 
+  {"setxattr","0x81,236,0,"}, 
+  {"modwatch","0x81,233,0,"}, 
+  {"sem_destroy","0x81,276,0,"}, 
+  {"0x81.28","sendmsg"}, 
+  {"0x81.29","recvfrom"}, 
+  {"kdebug_trace","0x81,180,0,"}, 
+  {"0x81.338","stat64"}, 
+  {"0x81.339","fstat64"}, 
+  {"audit_session_join","0x81,429,0,"}, 
+  {"0x81.291","mkfifo_extended"}, 
+  {"0x81.332","__pthread_markcancel"}, 
+  {"0x81.290","getwgroups"}, 
+  {"0x81.20","getpid"}, 
+  {"setsid","0x81,147,0,"}, 
+  {"0x81.333","__pthread_canceled"}, 
+  {"0x81.330","__sigwait"}, 
+  {"0x81.292","mkdir_extended"}, 
+  {"0x81.331","__disable_threadsignal"}, 
+  {"waitid_nocancel","0x81,416,0,"}, 
+  {"0x81.23","setuid"}, 
+  {"0x81.336","proc_info"}, 
+  {"0x81.294","shared_region_check_np"}, 
+  {"0x81.24","getuid"}, 
+  {"0x81.297","psynch_rw_longrdlock"}, 
+  {"0x81.25","geteuid"}, 
+  {"poll_nocancel","0x81,417,0,"}, 
+  {"0x81.334","__semwait_signal"}, 
+  {"0x81.296","vm_pressure_monitor"}, 
+  {"0x81.26","ptrace"}, 
+  {"0x81.299","psynch_rw_downgrade"}, 
+  {"0x81.27","recvmsg"}, 
+  {"0x81.298","psynch_rw_yieldwrlock"}, 
+  {"__mac_getfsstat","0x81,426,0,"}, 
+  {"fsync_nocancel","0x81,408,0,"}, 
+  {"poll","0x81,230,0,"}, 
+  {"madvise","0x81,75,0,"}, 
+  {"0x81.9","link"}, 
+  {"statfs","0x81,157,0,"}, 
+  {"setaudit_addr","0x81,358,0,"}, 
+  {"0x81.2","fork"}, 
+  {"0x81.3","read"}, 
+  {"vm_pressure_monitor","0x81,296,0,"}, 
+  {"0x81.1","exit"}, 
+  {"0x81.18","getfsstat"}, 
+  {"0x81.349","__pthread_fchdir"}, 
+  {"0x81.6","close"}, 
+  {"0x81.348","__pthread_chdir"}, 
+  {"0x81.7","wait4"}, 
+  {"bind","0x81,104,0,"}, 
+  {"0x81.4","write"}, 
+  {"0x81.5","open"}, 
+  {"aio_fsync","0x81,313,0,"}, 
+  {"psynch_rw_wrlock","0x81,307,0,"}, 
+  {"0x81.345","statfs64"}, 
+  {"0x81.13","fchdir"}, 
+  {"0x81.344","getdirentries64"}, 
+  {"0x81.12","chdir"}, 
+  {"0x81.347","getfsstat64"}, 
+  {"0x81.346","fstatfs64"}, 
+  {"setlogin","0x81,50,0,"}, 
+  {"0x81.10","unlink"}, 
+  {"audit","0x81,350,0,"}, 
+  {"0x81.341","stat64_extended"}, 
+  {"0x81.340","lstat64"}, 
+  {"0x81.16","chown"}, 
+  {"0x81.343","fstat64_extended"}, 
+  {"0x81.15","chmod"}, 
+  {"0x81.342","lstat64_extended"}, 
+  {"0x81.14","mknod"}, 
+  {"audit_session_self","0x81,428,0,"}, 
+  {"psynch_rw_upgrade","0x81,300,0,"}, 
+  {"fchdir","0x81,13,1,i"}, 
+  {"kqueue","0x81,362,0,"}, 
+  {"umask_extended","0x81,278,0,"}, 
+  {"execve","0x81,59,0,"}, 
+  {"settid_with_pid","0x81,311,0,"}, 
+  {"__mac_set_proc","0x81,387,0,"}, 
+  {"mknod","0x81,14,3,zii"}, 
+  {"0x81.358","setaudit_addr"}, 
+  {"quotactl","0x81,165,0,"}, 
+  {"0x81.359","auditctl"}, 
+  {"__mac_get_fd","0x81,388,0,"}, 
+  {"0x81.354","setauid"}, 
+  {"fcntl","0x81,92,0,"}, 
+  {"0x81.357","getaudit_addr"}, 
+  {"flock","0x81,131,0,"}, 
+  {"0x81.350","audit"}, 
+  {"0x81.351","auditon"}, 
+  {"open_nocancel","0x81,398,0,"}, 
+  {"0x81.353","getauid"}, 
+  {"__mac_get_mount","0x81,425,0,"}, 
+  {"__old_semwait_signal_nocancel","0x81,371,0,"}, 
+  {"fgetattrlist","0x81,228,0,"}, 
+  {"settid","0x81,285,0,"}, 
+  {"__sigwait_nocancel","0x81,422,0,"}, 
+  {"settimeofday","0x81,122,0,"}, 
+  {"setpgid","0x81,82,0,"}, 
+  {"getsid","0x81,310,0,"}, 
+  {"0x81.79","getgroups"}, 
+  {"0x81.78","mincore"}, 
+  {"0x81.369","kevent64"}, 
+  {"0x81.368","workq_kernreturn"}, 
+  {"0x81.367","workq_open"}, 
+  {"0x81.75","madvise"}, 
+  {"0x81.366","bsdthread_register"}, 
+  {"0x81.74","mprotect"}, 
+  {"0x81.365","stack_snapshot"}, 
+  {"0x81.364","lchown"}, 
+  {"0x81.363","kevent"}, 
+  {"0x81.362","kqueue"}, 
+  {"0x81.361","bsdthread_terminate"}, 
+  {"0x81.73","munmap"}, 
+  {"0x81.360","bsdthread_create"}, 
+  {"setwgroups","0x81,289,0,"}, 
+  {"gettimeofday","0x81,116,0,"}, 
+  {"listen","0x81,106,0,"}, 
+  {"workq_kernreturn","0x81,368,0,"}, 
+  {"setreuid","0x81,126,0,"}, 
+  {"psynch_mutexdrop","0x81,302,0,"}, 
+  {"undelete","0x81,205,0,"}, 
+  {"guarded_close_np","0x81,442,0,"}, 
+  {"ioctl","0x81,54,0,"}, 
+  {"__mac_set_link","0x81,385,0,"}, 
+  {"searchfs","0x81,225,0,"}, 
+  {"connect","0x81,98,0,"}, 
+  {"close_nocancel","0x81,399,0,"}, 
+  {"getppid","0x81,39,0,"}, 
+  {"removexattr","0x81,238,0,"}, 
+  {"pathconf","0x81,191,0,"}, 
+  {"0x81.65","msync"}, 
+  {"mkcomplex","0x81,216,0,"}, 
+  {"0x81.66","vfork"}, 
+  {"0x81.372","thread_selfid"}, 
+  {"0x81.60","umask"}, 
+  {"0x81.373","ledger"}, 
+  {"0x81.61","chroot"}, 
+  {"0x81.370","__old_semwait_signal"}, 
+  {"read","0x81,3,3,"}, 
+  {"stat_extended","0x81,279,0,"}, 
+  {"0x81.371","__old_semwait_signal_nocancel"}, 
+  {"pid_suspend","0x81,433,0,"}, 
+  {"guarded_open_np","0x81,441,0,"}, 
+  {"recvfrom_nocancel","0x81,403,0,"}, 
+  {"chmod","0x81,15,2,zi"}, 
+  {"pread_nocancel","0x81,414,0,"}, 
+  {"sendto","0x81,133,0,"}, 
+  {"process_policy","0x81,323,0,"}, 
+  {"__pthread_chdir","0x81,348,0,"}, 
+  {"recvmsg","0x81,27,3,"}, 
+  {"0x81.59","execve"}, 
+  {"0x81.58","readlink"}, 
+  {"0x81.57","symlink"}, 
+  {"170","0x81,170,0,"}, 
+  {"0x81.56","revoke"}, 
+  {"0x81.55","reboot"}, 
+  {"psynch_rw_downgrade","0x81,299,0,"}, 
+  {"0x81.54","ioctl"}, 
+  {"_","0x81"}, 
+  {"fsctl","0x81,242,0,"}, 
+  {"0x81.53","sigaltstack"}, 
+  {"__mac_get_pid","0x81,390,0,"}, 
+  {"readv","0x81,120,0,"}, 
+  {"0x81.52","sigpending"}, 
+  {"0x81.51","acct"}, 
+  {"0x81.200","truncate"}, 
+  {"0x81.50","setlogin"}, 
+  {"0x81.201","ftruncate"}, 
+  {"geteuid","0x81,25,0,"}, 
+  {"0x81.202","__sysctl"}, 
+  {"0x81.203","mlock"}, 
+  {"0x81.204","munlock"}, 
+  {"0x81.205","undelete"}, 
+  {"seteuid","0x81,183,0,"}, 
+  {"getgroups","0x81,79,0,"}, 
+  {"getuid","0x81,24,0,"}, 
+  {"vfork","0x81,66,0,"}, 
+  {"sem_getvalue","0x81,274,0,"}, 
+  {"0x81.48","sigprocmask"}, 
+  {"0x81.49","getlogin"}, 
+  {"0x81.46","sigaction"}, 
+  {"__mac_get_link","0x81,384,0,"}, 
+  {"0x81.47","getgid"}, 
+  {"lstat64_extended","0x81,342,0,"}, 
+  {"flistxattr","0x81,241,0,"}, 
+  {"0x81.42","pipe"}, 
+  {"0x81.43","getegid"}, 
+  {"getfsstat64","0x81,347,0,"}, 
+  {"0x81.41","dup"}, 
+  {"aio_error","0x81,317,0,"}, 
+  {"fstat_extended","0x81,281,0,"}, 
+  {"umask","0x81,60,0,"}, 
+  {"__mac_set_file","0x81,383,0,"}, 
+  {"sigsuspend","0x81,111,0,"}, 
+  {"waitid","0x81,173,0,"}, 
+  {"listxattr","0x81,240,0,"}, 
+  {"getwgroups","0x81,290,0,"}, 
+  {"munmap","0x81,73,0,"}, 
+  {"chmod_extended","0x81,282,0,"}, 
+  {"psynch_rw_rdlock","0x81,306,0,"}, 
+  {"sendmsg","0x81,28,3,"}, 
+  {"0x81.228","fgetattrlist"}, 
+  {"0x81.229","fsetattrlist"}, 
+  {"accept_nocancel","0x81,404,0,"}, 
+  {"chown","0x81,16,3,zii"}, 
+  {"auditon","0x81,351,0,"}, 
+  {"0x81.222","getdirentriesattr"}, 
+  {"truncate","0x81,200,0,"}, 
+  {"0x81.223","exchangedata"}, 
+  {"setsockopt","0x81,105,0,"}, 
+  {"0x81.220","getattrlist"}, 
+  {"0x81.221","setattrlist"}, 
+  {"0x81.226","delete"}, 
+  {"chdir","0x81,12,1,z"}, 
+  {"0x81.227","copyfile"}, 
+  {"0x81.225","searchfs"}, 
+  {"ffsctl","0x81,245,0,"}, 
+  {"mprotect","0x81,74,0,"}, 
+  {"chroot","0x81,61,0,"}, 
+  {"bsdthread_terminate","0x81,361,0,"}, 
+  {"fstatfs","0x81,158,0,"}, 
+  {"__sigwait","0x81,330,0,"}, 
+  {"fsgetpath","0x81,427,0,"}, 
+  {"csops","0x81,169,0,"}, 
+  {"select_nocancel","0x81,407,0,"}, 
+  {"readv_nocancel","0x81,411,0,"}, 
+  {"getrusage","0x81,117,0,"}, 
+  {"getdirentriesattr","0x81,222,0,"}, 
+  {"__mac_get_file","0x81,382,0,"}, 
+  {"0x81.216","mkcomplex"}, 
+  {"write_nocancel","0x81,397,0,"}, 
+  {"accept","0x81,30,1,i"}, 
+  {"getdirentries64","0x81,344,0,"}, 
+  {"open","0x81,5,3,"}, 
+  {"setregid","0x81,127,0,"}, 
+  {"statfs64","0x81,345,0,"}, 
+  {"fchown","0x81,123,0,"}, 
+  {"ptrace","0x81,26,4,"}, 
+  {"iopolicysys","0x81,322,0,"}, 
+  {"__pthread_kill","0x81,328,0,"}, 
+  {"__semwait_signal","0x81,334,0,"}, 
+  {"munlockall","0x81,325,0,"}, 
+  {"__mac_execve","0x81,380,0,"}, 
+  {"swapon","0x81,85,0,"}, 
+  {"sem_unlink","0x81,270,0,"}, 
+  {"0x81.183","seteuid"}, 
+  {"0x81.182","setegid"}, 
+  {"0x81.244","posix_spawn"}, 
+  {"0x81.181","setgid"}, 
+  {"0x81.245","ffsctl"}, 
+  {"0x81.180","kdebug_trace"}, 
+  {"setgid","0x81,181,0,"}, 
+  {"0x81.187","fdatasync"}, 
+  {"0x81.240","listxattr"}, 
+  {"0x81.185","chud"}, 
+  {"0x81.241","flistxattr"}, 
+  {"getsockopt","0x81,118,0,"}, 
+  {"0x81.184","sigreturn"}, 
+  {"chud","0x81,185,0,"}, 
+  {"0x81.242","fsctl"}, 
+  {"getdirentries","0x81,196,0,"}, 
+  {"0x81.243","initgroups"}, 
+  {"msync","0x81,65,0,"}, 
+  {"0x81.189","fstat"}, 
+  {"0x81.188","stat"}, 
+  {"stat","0x81,188,0,"}, 
+  {"getattrlist","0x81,220,0,"}, 
+  {"__old_semwait_signal","0x81,370,0,"}, 
+  {"fpathconf","0x81,192,0,"}, 
+  {"mlockall","0x81,324,0,"}, 
+  {"lio_listio","0x81,320,0,"}, 
+  {"fstatfs64","0x81,346,0,"}, 
+  {"mount","0x81,167,0,"}, 
+  {"getsockname","0x81,32,0,"}, 
+  {"__mac_get_lcid","0x81,391,0,"}, 
+  {"mkfifo","0x81,132,0,"}, 
+  {"0x81.239","fremovexattr"}, 
+  {"0x81.238","removexattr"}, 
+  {"0x81.192","fpathconf"}, 
+  {"0x81.233","modwatch"}, 
+  {"0x81.190","lstat"}, 
+  {"0x81.232","waitevent"}, 
+  {"0x81.191","pathconf"}, 
+  {"__sysctl","0x81,202,0,"}, 
+  {"shm_open","0x81,266,0,"}, 
+  {"pread","0x81,153,0,"}, 
+  {"exchangedata","0x81,223,0,"}, 
+  {"0x81.231","watchevent"}, 
+  {"0x81.196","getdirentries"}, 
+  {"sigprocmask","0x81,48,0,"}, 
+  {"0x81.230","poll"}, 
+  {"0x81.197","mmap"}, 
+  {"0x81.237","fsetxattr"}, 
+  {"0x81.194","getrlimit"}, 
+  {"0x81.236","setxattr"}, 
+  {"0x81.195","setrlimit"}, 
+  {"0x81.235","fgetxattr"}, 
+  {"0x81.234","getxattr"}, 
+  {"stat64_extended","0x81,341,0,"}, 
+  {"0x81.199","lseek"}, 
+  {"lstat","0x81,190,0,"}, 
+  {"__pthread_markcancel","0x81,332,0,"}, 
+  {"shutdown","0x81,134,0,"}, 
+  {"psynch_cvclrprepost","0x81,312,0,"}, 
+  {"shm_unlink","0x81,267,0,"}, 
+  {"setlcid","0x81,394,0,"}, 
+  {"getpgrp","0x81,81,0,"}, 
+  {"fstat","0x81,189,0,"}, 
+  {"sem_post","0x81,273,0,"}, 
+  {"socket","0x81,97,0,"}, 
+  {"0x81.268","sem_open"}, 
+  {"0x81.269","sem_close"}, 
+  {"sync","0x81,36,0,"}, 
+  {"audit_session_port","0x81,432,0,"}, 
+  {"0x81.266","shm_open"}, 
+  {"0x81.267","shm_unlink"}, 
+  {"bsdthread_create","0x81,360,0,"}, 
+  {"sendto_nocancel","0x81,413,0,"}, 
+  {"sem_close","0x81,269,0,"}, 
+  {"mkdir_extended","0x81,292,0,"}, 
+  {"initgroups","0x81,243,0,"}, 
+  {"writev_nocancel","0x81,412,0,"}, 
+  {"unmount","0x81,159,0,"}, 
+  {"psynch_mutexwait","0x81,301,0,"}, 
+  {"mkfifo_extended","0x81,291,0,"}, 
+  {"ftruncate","0x81,201,0,"}, 
+  {"psynch_rw_unlock","0x81,308,0,"}, 
+  {"rmdir","0x81,137,0,"}, 
+  {"0x81.250","minherit"}, 
+  {"0x81.381","__mac_syscall"}, 
+  {"0x81.380","__mac_execve"}, 
+  {"getaudit_addr","0x81,357,0,"}, 
+  {"0x81.383","__mac_set_file"}, 
+  {"0x81.382","__mac_get_file"}, 
+  {"0x81.385","__mac_set_link"}, 
+  {"0x81.384","__mac_get_link"}, 
+  {"0x81.387","__mac_set_proc"}, 
+  {"lstat64","0x81,340,0,"}, 
+  {"0x81.386","__mac_get_proc"}, 
+  {"0x81.389","__mac_set_fd"}, 
+  {"__mac_get_lctx","0x81,392,0,"}, 
+  {"0x81.388","__mac_get_fd"}, 
+  {"fsetattrlist","0x81,229,0,"}, 
+  {"select","0x81,93,0,"}, 
+  {"acct","0x81,51,0,"}, 
+  {"pwrite_nocancel","0x81,415,0,"}, 
+  {"minherit","0x81,250,0,"}, 
+  {"mkdir","0x81,136,0,"}, 
+  {"futimes","0x81,139,0,"}, 
+  {"aio_cancel","0x81,316,0,"}, 
+  {"setsgroups","0x81,287,0,"}, 
+  {"mmap","0x81,197,0,"}, 
+  {"mincore","0x81,78,0,"}, 
+  {"0x81.390","__mac_get_pid"}, 
+  {"0x81.391","__mac_get_lcid"}, 
+  {"0x81.392","__mac_get_lctx"}, 
+  {"0x81.393","__mac_set_lctx"}, 
+  {"0x81.394","setlcid"}, 
+  {"bsdthread_register","0x81,366,0,"}, 
+  {"symlink","0x81,57,0,"}, 
+  {"fdatasync","0x81,187,0,"}, 
+  {"0x81.395","getlcid"}, 
+  {"0x81.396","read_nocancel"}, 
+  {"0x81.397","write_nocancel"}, 
+  {"0x81.398","open_nocancel"}, 
+  {"0x81.399","close_nocancel"}, 
+  {"thread_selfid","0x81,372,0,"}, 
+  {"__mac_mount","0x81,424,0,"}, 
+  {"msync_nocancel","0x81,405,0,"}, 
+  {"0x81.279","stat_extended"}, 
+  {"0x81.278","umask_extended"}, 
+  {"socketpair","0x81,135,0,"}, 
+  {"0x81.277","open_extended"}, 
+  {"0x81.276","sem_destroy"}, 
+  {"0x81.275","sem_init"}, 
+  {"0x81.274","sem_getvalue"}, 
+  {"waitevent","0x81,232,0,"}, 
+  {"0x81.273","sem_post"}, 
+  {"0x81.272","sem_trywait"}, 
+  {"0x81.271","sem_wait"}, 
+  {"delete","0x81,226,0,"}, 
+  {"0x81.270","sem_unlink"}, 
+  {"posix_spawn","0x81,244,0,"}, 
+  {"read_nocancel","0x81,396,0,"}, 
+  {"copyfile","0x81,227,0,"}, 
+  {"sem_trywait","0x81,272,0,"}, 
+  {"getpeername","0x81,31,0,"}, 
+  {"getdtablesize","0x81,89,0,"}, 
+  {"watchevent","0x81,231,0,"}, 
+  {"kill","0x81,37,0,"}, 
+  {"writev","0x81,121,0,"}, 
+  {"0x81.442","guarded_close_np"}, 
+  {"0x81.440","memorystatus_control"}, 
+  {"lchown","0x81,364,0,"}, 
+  {"0x81.441","guarded_open_np"}, 
+  {"aio_return","0x81,314,0,"}, 
+  {"__semwait_signal_nocancel","0x81,423,0,"}, 
+  {"0x81.128","rename"}, 
+  {"gettid","0x81,286,0,"}, 
+  {"fileport_makeport","0x81,430,0,"}, 
+  {"fchflags","0x81,35,0,"}, 
+  {"0x81.121","writev"}, 
+  {"0x81.120","readv"}, 
+  {"0x81.123","fchown"}, 
+  {"0x81.122","settimeofday"}, 
+  {"access","0x81,33,0,"}, 
+  {"recvfrom","0x81,29,3,"}, 
+  {"0x81.124","fchmod"}, 
+  {"workq_open","0x81,367,0,"}, 
+  {"0x81.127","setregid"}, 
+  {"0x81.126","setreuid"}, 
+  {"dup","0x81,41,0,"}, 
+  {"kas_info","0x81,439,0,"}, 
+  {"ledger","0x81,373,0,"}, 
+  {"__pthread_canceled","0x81,333,0,"}, 
+  {"getlcid","0x81,395,0,"}, 
+  {"unlink","0x81,10,1,z"}, 
+  {"sigaction","0x81,46,0,"}, 
+  {"close","0x81,6,1,"}, 
+  {"0x81.138","utimes"}, 
+  {"0x81.139","futimes"}, 
+  {"setauid","0x81,354,0,"}, 
+  {"munlock","0x81,204,0,"}, 
+  {"write","0x81,4,3,"}, 
+  {"setgroups","0x81,80,0,"}, 
+  {"stat64","0x81,338,0,"}, 
+  {"0x81.131","flock"}, 
+  {"0x81.132","mkfifo"}, 
+  {"0x81.93","select"}, 
+  {"0x81.133","sendto"}, 
+  {"0x81.92","fcntl"}, 
+  {"0x81.134","shutdown"}, 
+  {"reboot","0x81,55,0,"}, 
+  {"0x81.135","socketpair"}, 
+  {"setrlimit","0x81,195,0,"}, 
+  {"0x81.90","dup2"}, 
+  {"0x81.136","mkdir"}, 
+  {"setuid","0x81,23,1,i"}, 
+  {"0x81.97","socket"}, 
+  {"0x81.137","rmdir"}, 
+  {"0x81.96","setpriority"}, 
+  {"0x81.95","fsync"}, 
+  {"getegid","0x81,43,0,"}, 
+  {"aio_suspend","0x81,315,0,"}, 
+  {"0x81.428","audit_session_self"}, 
+  {"0x81.98","connect"}, 
+  {"0x81.429","audit_session_join"}, 
+  {"pid_resume","0x81,434,0,"}, 
+  {"utimes","0x81,138,0,"}, 
+  {"fremovexattr","0x81,239,0,"}, 
+  {"0x81.424","__mac_mount"}, 
+  {"0x81.425","__mac_get_mount"}, 
+  {"0x81.426","__mac_getfsstat"}, 
+  {"dup2","0x81,90,0,"}, 
+  {"0x81.427","fsgetpath"}, 
+  {"0x81.420","sem_wait_nocancel"}, 
+  {"0x81.421","aio_suspend_nocancel"}, 
+  {"0x81.422","__sigwait_nocancel"}, 
+  {"memorystatus_control","0x81,440,0,"}, 
+  {"0x81.423","__semwait_signal_nocancel"}, 
+  {"getgid","0x81,47,0,"}, 
+  {"exit","0x81,1,1,"}, 
+  {"proc_info","0x81,336,0,"}, 
+  {"chflags","0x81,34,0,"}, 
+  {"kevent","0x81,363,0,"}, 
+  {"0x81.82","setpgid"}, 
+  {"0x81.100","getpriority"}, 
+  {"0x81.83","setitimer"}, 
+  {"0x81.80","setgroups"}, 
+  {"0x81.106","listen"}, 
+  {"sem_wait","0x81,271,0,"}, 
+  {"getrlimit","0x81,194,0,"}, 
+  {"__pthread_fchdir","0x81,349,0,"}, 
+  {"0x81.81","getpgrp"}, 
+  {"0x81.105","setsockopt"}, 
+  {"0x81.86","getitimer"}, 
+  {"0x81.104","bind"}, 
+  {"fgetxattr","0x81,235,0,"}, 
+  {"shared_region_check_np","0x81,294,0,"}, 
+  {"open_extended","0x81,277,0,"}, 
+  {"0x81.85","swapon"}, 
+  {"psynch_cvwait","0x81,305,0,"}, 
+  {"0x81.89","getdtablesize"}, 
+  {"pid_hibernate","0x81,435,0,"}, 
+  {"psynch_rw_yieldwrlock","0x81,298,0,"}, 
+  {"psynch_rw_longrdlock","0x81,297,0,"}, 
+  {"sigpending","0x81,52,0,"}, 
+  {NULL, NULL}
+};
+// 0x556acf2a4170
+// TODO
+typedef int (*GperfForeachCallback)(void *user, const char *k, const char *v);
+int gperf_ios_x86_32_foreach(GperfForeachCallback cb, void *user) {
+  int i = 0; while (kvs[i].name) {
+  cb (user, kvs[i].name, kvs[i].value);
+  i++;}
+  return 0;
+}
+const char *gperf_ios_x86_32_get(const char *s) {
+  int i = 0; while (kvs[i].name) {
+  if (!strcmp (s, kvs[i].name)) return kvs[i].value;
+  i++;}
+  return NULL;
+}
+#define sdb_hash_c_ios_x86_32(x,y) gperf_ios_x86_32_hash(x)
+const unsigned int gperf_ios_x86_32_hash(const char *s) {
+  int sum = strlen (s);
+  while (*s) { sum += *s; s++; }
+  return sum;
+}
+struct {const char *name;void *get;void *hash;void *foreach;} gperf_ios_x86_32 = {
+  .name = "ios-x86-32",
+  .get = &gperf_ios_x86_32_get,
+  .hash = &gperf_ios_x86_32_hash,
+  .foreach = &gperf_ios_x86_32_foreach
+};
+
+#if MAIN
+int main () {
+	const char *s = ((char*(*)(char*))gperf_ios_x86_32.get)("foo");
+	printf ("%s\n", s);
+}
+#endif
@@ -0,0 +1,659 @@
+// SDB-CGEN V1.9.4
+// gcc -DMAIN=1 linux_arm_64.c ; ./a.out > linux_arm_64.h
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+struct kv { const char *name; const char *value; };
+static const struct kv kvs[] = {
+  {"0.141","getpriority"}, 
+  {"getsockopt","0,209,,"}, 
+  {"0.438","pidfd_getfd"}, 
+  {"0.439","faccessat2"}, 
+  {"setfsgid","0,152,,"}, 
+  {"0.434","pidfd_open"}, 
+  {"0.435","clone3"}, 
+  {"pidfd_send_signal","0,424,,"}, 
+  {"io_uring_register","0,427,,"}, 
+  {"0.436","close_range"}, 
+  {"pkey_free","0,290,,"}, 
+  {"0.437","openat2"}, 
+  {"mount","0,40,,"}, 
+  {"0.269","sendmmsg"}, 
+  {"sigaltstack","0,132,,"}, 
+  {"getsockname","0,204,,"}, 
+  {"0.430","fsopen"}, 
+  {"0.268","setns"}, 
+  {"memfd_create","0,279,,"}, 
+  {"0.431","fsconfig"}, 
+  {"0.267","syncfs"}, 
+  {"0.432","fsmount"}, 
+  {"0.266","clock_adjtime"}, 
+  {"0.433","fspick"}, 
+  {"0.265","open_by_handle_at"}, 
+  {"0.264","name_to_handle_at"}, 
+  {"memfd_secret","0,447,,"}, 
+  {"0.263","fanotify_mark"}, 
+  {"pread64","0,67,,"}, 
+  {"0.262","fanotify_init"}, 
+  {"nanosleep","0,101,,"}, 
+  {"0.261","prlimit64"}, 
+  {"setpriority","0,140,,"}, 
+  {"ioctl","0,29,,"}, 
+  {"fstat","0,80,,"}, 
+  {"0.260","wait4"}, 
+  {"0.179","sysinfo"}, 
+  {"0.178","gettid"}, 
+  {"readlinkat","0,78,,"}, 
+  {"0.175","geteuid"}, 
+  {"finit_module","0,273,,"}, 
+  {"0.174","getuid"}, 
+  {"0.177","getegid"}, 
+  {"rt_sigaction","0,134,,"}, 
+  {"sched_setaffinity","0,122,,"}, 
+  {"0.176","getgid"}, 
+  {"0.171","adjtimex"}, 
+  {"0.170","settimeofday"}, 
+  {"mount_setattr","0,442,,"}, 
+  {"0.173","getppid"}, 
+  {"recvmsg","0,212,,"}, 
+  {"0.172","getpid"}, 
+  {"getxattr","0,8,,"}, 
+  {"lseek","0,62,,"}, 
+  {"clone3","0,435,,"}, 
+  {"geteuid","0,175,0,"}, 
+  {"inotify_add_watch","0,27,,"}, 
+  {"sched_getaffinity","0,123,,"}, 
+  {"ftruncate","0,46,,"}, 
+  {"sched_getscheduler","0,120,,"}, 
+  {"statfs","0,43,,"}, 
+  {"0.278","getrandom"}, 
+  {"arch_specific_syscall","0,244,,"}, 
+  {"0.279","memfd_create"}, 
+  {"execve","0,221,,"}, 
+  {"0.276","renameat2"}, 
+  {"0.277","seccomp"}, 
+  {"0.274","sched_setattr"}, 
+  {"rt_sigtimedwait","0,137,,"}, 
+  {"0.275","sched_getattr"}, 
+  {"0.272","kcmp"}, 
+  {"sethostname","0,161,,"}, 
+  {"0.273","finit_module"}, 
+  {"fstatfs","0,44,,"}, 
+  {"fspick","0,433,,"}, 
+  {"0.270","process_vm_readv"}, 
+  {"0.271","process_vm_writev"}, 
+  {"swapoff","0,225,,"}, 
+  {"sync","0,81,,"}, 
+  {"umask","0,166,,"}, 
+  {"setreuid","0,145,,"}, 
+  {"semctl","0,191,,"}, 
+  {"bind","0,200,,"}, 
+  {"0.9","lgetxattr"}, 
+  {"0.8","getxattr"}, 
+  {"close_range","0,436,,"}, 
+  {"timer_getoverrun","0,109,,"}, 
+  {"0.3","io_cancel"}, 
+  {"brk","0,214,,"}, 
+  {"sync_file_range","0,84,,"}, 
+  {"0.2","io_submit"}, 
+  {"0.1","io_destroy"}, 
+  {"0.0","io_setup"}, 
+  {"mq_unlink","0,181,1,z"}, 
+  {"0.7","fsetxattr"}, 
+  {"0.6","lsetxattr"}, 
+  {"setdomainname","0,162,,"}, 
+  {"0.5","setxattr"}, 
+  {"perf_event_open","0,241,,"}, 
+  {"0.4","io_getevents"}, 
+  {"pidfd_getfd","0,438,,"}, 
+  {"clock_settime","0,112,,"}, 
+  {"fsetxattr","0,7,,"}, 
+  {"clock_gettime","0,113,,"}, 
+  {"0.159","setgroups"}, 
+  {"quotactl_fd","0,443,,"}, 
+  {"0.158","getgroups"}, 
+  {"0.157","setsid"}, 
+  {"setresgid","0,149,,"}, 
+  {"0.156","getsid"}, 
+  {"0.155","getpgid"}, 
+  {"mlock","0,228,,"}, 
+  {"0.154","setpgid"}, 
+  {"0.153","times"}, 
+  {"membarrier","0,283,,"}, 
+  {"0.152","setfsgid"}, 
+  {"utimensat","0,88,,"}, 
+  {"0.151","setfsuid"}, 
+  {"0.150","getresgid"}, 
+  {"fsconfig","0,431,,"}, 
+  {"getppid","0,173,0,"}, 
+  {"getitimer","0,102,,"}, 
+  {"prctl","0,167,,"}, 
+  {"clock_nanosleep","0,115,,"}, 
+  {"fadvise64","0,223,,"}, 
+  {"restart_syscall","0,128,,"}, 
+  {"pivot_root","0,41,,"}, 
+  {"listen","0,201,,"}, 
+  {"rt_tgsigqueueinfo","0,240,,"}, 
+  {"removexattr","0,14,,"}, 
+  {"0.83","fdatasync"}, 
+  {"0.82","fsync"}, 
+  {"0.81","sync"}, 
+  {"0.80","fstat"}, 
+  {"0.87","timerfd_gettime"}, 
+  {"0.86","timerfd_settime"}, 
+  {"pkey_alloc","0,289,,"}, 
+  {"0.85","timerfd_create"}, 
+  {"0.84","sync_file_range"}, 
+  {"munlockall","0,231,,"}, 
+  {"dup3","0,24,,"}, 
+  {"quotactl","0,60,,"}, 
+  {"0.89","acct"}, 
+  {"0.88","utimensat"}, 
+  {"sched_yield","0,124,,"}, 
+  {"msgget","0,186,,"}, 
+  {"pwritev2","0,287,,"}, 
+  {"setgid","0,144,,"}, 
+  {"get_robust_list","0,100,,"}, 
+  {"request_key","0,218,,"}, 
+  {"setpgid","0,154,,"}, 
+  {"setsockopt","0,208,,"}, 
+  {"fremovexattr","0,16,,"}, 
+  {"sendmsg","0,211,,"}, 
+  {"0.92","personality"}, 
+  {"set_robust_list","0,99,,"}, 
+  {"0.93","exit"}, 
+  {"rt_sigreturn","0,139,,"}, 
+  {"0.90","capget"}, 
+  {"0.91","capset"}, 
+  {"renameat2","0,276,,"}, 
+  {"0.96","set_tid_address"}, 
+  {"0.97","unshare"}, 
+  {"0.94","exit_group"}, 
+  {"0.95","waitid"}, 
+  {"syncfs","0,267,,"}, 
+  {"0.98","futex"}, 
+  {"0.99","set_robust_list"}, 
+  {"open_by_handle_at","0,265,,"}, 
+  {"nfsservctl","0,42,,"}, 
+  {"uname","0,160,,"}, 
+  {"futex","0,98,,"}, 
+  {"move_pages","0,239,,"}, 
+  {"gettimeofday","0,169,,"}, 
+  {"set_tid_address","0,96,,"}, 
+  {"faccessat2","0,439,,"}, 
+  {"epoll_create1","0,20,,"}, 
+  {"personality","0,92,,"}, 
+  {"0.281","execveat"}, 
+  {"0.280","bpf"}, 
+  {"0.283","membarrier"}, 
+  {"0.282","userfaultfd"}, 
+  {"kexec_file_load","0,294,,"}, 
+  {"clock_getres","0,114,,"}, 
+  {"0.285","copy_file_range"}, 
+  {"accept4","0,242,,"}, 
+  {"0.284","mlock2"}, 
+  {"ioprio_set","0,30,,"}, 
+  {"0.287","pwritev2"}, 
+  {"getresgid","0,150,,"}, 
+  {"0.286","preadv2"}, 
+  {"landlock_create_ruleset","0,444,,"}, 
+  {"io_getevents","0,4,,"}, 
+  {"0.289","pkey_alloc"}, 
+  {"0.288","pkey_mprotect"}, 
+  {"fgetxattr","0,10,,"}, 
+  {"mlockall","0,230,,"}, 
+  {"exit","0,93,1,i"}, 
+  {"ppoll","0,73,,"}, 
+  {"linkat","0,37,,"}, 
+  {"exit_group","0,94,,"}, 
+  {"getsid","0,156,,"}, 
+  {"llistxattr","0,12,,"}, 
+  {"pidfd_open","0,434,,"}, 
+  {"lsetxattr","0,6,,"}, 
+  {"mq_getsetattr","0,185,,"}, 
+  {"rt_sigpending","0,136,,"}, 
+  {"clock_adjtime","0,266,,"}, 
+  {"0.290","pkey_free"}, 
+  {"io_uring_setup","0,425,,"}, 
+  {"0.291","statx"}, 
+  {"0.292","io_pgetevents"}, 
+  {"0.293","rseq"}, 
+  {"0.294","kexec_file_load"}, 
+  {"sysinfo","0,179,0,"}, 
+  {"semop","0,193,,"}, 
+  {"ioprio_get","0,31,,"}, 
+  {"getuid","0,174,0,"}, 
+  {"0.182","mq_timedsend"}, 
+  {"munlock","0,229,,"}, 
+  {"0.183","mq_timedreceive"}, 
+  {"pipe2","0,59,,"}, 
+  {"0.180","mq_open"}, 
+  {"0.181","mq_unlink"}, 
+  {"0.186","msgget"}, 
+  {"0.187","msgctl"}, 
+  {"0.184","mq_notify"}, 
+  {"0.185","mq_getsetattr"}, 
+  {"fchdir","0,50,1,i"}, 
+  {"0.188","msgrcv"}, 
+  {"0.189","msgsnd"}, 
+  {"adjtimex","0,171,,"}, 
+  {"tee","0,77,,"}, 
+  {"recvfrom","0,207,,"}, 
+  {"prlimit64","0,261,,"}, 
+  {"bpf","0,280,,"}, 
+  {"writev","0,66,,"}, 
+  {"flock","0,32,,"}, 
+  {"signalfd4","0,74,,"}, 
+  {"swapon","0,224,,"}, 
+  {"getpeername","0,205,,"}, 
+  {"fsync","0,82,,"}, 
+  {"mq_open","0,180,,"}, 
+  {"gettid","0,178,0,"}, 
+  {"mq_timedreceive","0,183,,"}, 
+  {"io_pgetevents","0,292,,"}, 
+  {"pwritev","0,70,,"}, 
+  {"getrusage","0,165,,"}, 
+  {"getresuid","0,148,,"}, 
+  {"epoll_pwait2","0,441,,"}, 
+  {"accept","0,202,,"}, 
+  {"close","0,57,1,i"}, 
+  {"munmap","0,215,,"}, 
+  {"setregid","0,143,,"}, 
+  {"io_cancel","0,3,,"}, 
+  {"rseq","0,293,,"}, 
+  {"set_mempolicy","0,237,,"}, 
+  {"semget","0,190,,"}, 
+  {"mremap","0,216,,"}, 
+  {"acct","0,89,,"}, 
+  {"sched_get_priority_min","0,126,,"}, 
+  {"kcmp","0,272,,"}, 
+  {"readahead","0,213,,"}, 
+  {"0.29","ioctl"}, 
+  {"fchownat","0,54,,"}, 
+  {"0.28","inotify_rm_watch"}, 
+  {"timerfd_gettime","0,87,,"}, 
+  {"userfaultfd","0,282,,"}, 
+  {"init_module","0,105,,"}, 
+  {"fanotify_init","0,262,,"}, 
+  {"inotify_rm_watch","0,28,,"}, 
+  {"setresuid","0,147,,"}, 
+  {"migrate_pages","0,238,,"}, 
+  {"lgetxattr","0,9,,"}, 
+  {"0.21","epoll_ctl"}, 
+  {"read","0,63,3,ipi"}, 
+  {"0.20","epoll_create1"}, 
+  {"0.193","semop"}, 
+  {"0.23","dup"}, 
+  {"0.192","semtimedop"}, 
+  {"0.22","epoll_pwait"}, 
+  {"0.191","semctl"}, 
+  {"getegid","0,177,0,"}, 
+  {"0.25","fcntl"}, 
+  {"0.190","semget"}, 
+  {"seccomp","0,277,,"}, 
+  {"0.24","dup3"}, 
+  {"0.197","shmdt"}, 
+  {"0.27","inotify_add_watch"}, 
+  {"0.196","shmat"}, 
+  {"io_destroy","0,1,,"}, 
+  {"0.26","inotify_init1"}, 
+  {"0.195","shmctl"}, 
+  {"connect","0,203,,"}, 
+  {"0.194","shmget"}, 
+  {"execveat","0,281,,"}, 
+  {"0.199","socketpair"}, 
+  {"0.198","socket"}, 
+  {"chroot","0,51,1,z"}, 
+  {"setfsuid","0,151,,"}, 
+  {"mq_timedsend","0,182,,"}, 
+  {"splice","0,76,,"}, 
+  {"getpid","0,172,0,"}, 
+  {"sendfile","0,71,,"}, 
+  {"_","0x0"}, 
+  {"mmap","0,222,,"}, 
+  {"sched_setscheduler","0,119,,"}, 
+  {"rt_sigqueueinfo","0,138,,"}, 
+  {"0.38","renameat"}, 
+  {"0.39","umount2"}, 
+  {"fchmod","0,52,,"}, 
+  {"process_mrelease","0,448,,"}, 
+  {"0.30","ioprio_set"}, 
+  {"0.31","ioprio_get"}, 
+  {"0.32","flock"}, 
+  {"0.33","mknodat"}, 
+  {"pwrite64","0,68,,"}, 
+  {"0.34","mkdirat"}, 
+  {"getrandom","0,278,,"}, 
+  {"0.35","unlinkat"}, 
+  {"0.36","symlinkat"}, 
+  {"copy_file_range","0,285,,"}, 
+  {"0.37","linkat"}, 
+  {"pselect6","0,72,,"}, 
+  {"sendto","0,206,,"}, 
+  {"shmctl","0,195,,"}, 
+  {"delete_module","0,106,,"}, 
+  {"dup","0,23,,"}, 
+  {"io_submit","0,2,,"}, 
+  {"io_uring_enter","0,426,,"}, 
+  {"kill","0,129,,"}, 
+  {"fdatasync","0,83,,"}, 
+  {"setitimer","0,103,,"}, 
+  {"mlock2","0,284,,"}, 
+  {"timer_settime","0,110,,"}, 
+  {"fcntl","0,25,,"}, 
+  {"fstatat","0,79,,"}, 
+  {"getrlimit","0,163,,"}, 
+  {"process_madvise","0,440,,"}, 
+  {"epoll_pwait","0,22,,"}, 
+  {"landlock_add_rule","0,445,,"}, 
+  {"sched_setattr","0,274,,"}, 
+  {"wait4","0,260,,"}, 
+  {"setns","0,268,,"}, 
+  {"0.18","lookup_dcookie"}, 
+  {"0.19","eventfd2"}, 
+  {"setgroups","0,159,,"}, 
+  {"0.12","llistxattr"}, 
+  {"0.128","restart_syscall"}, 
+  {"renameat","0,38,,"}, 
+  {"0.13","flistxattr"}, 
+  {"0.129","kill"}, 
+  {"0.10","fgetxattr"}, 
+  {"0.11","listxattr"}, 
+  {"preadv2","0,286,,"}, 
+  {"0.16","fremovexattr"}, 
+  {"0.17","getcwd"}, 
+  {"0.14","removexattr"}, 
+  {"0.15","lremovexattr"}, 
+  {"write","0,64,3,izi"}, 
+  {"0.120","sched_getscheduler"}, 
+  {"0.121","sched_getparam"}, 
+  {"0.122","sched_setaffinity"}, 
+  {"0.123","sched_getaffinity"}, 
+  {"0.124","sched_yield"}, 
+  {"0.125","sched_get_priority_max"}, 
+  {"set_mempolicy_home_node","0,450,,"}, 
+  {"0.126","sched_get_priority_min"}, 
+  {"0.127","sched_rr_get_interval"}, 
+  {"getgroups","0,158,,"}, 
+  {"0.209","getsockopt"}, 
+  {"0.208","setsockopt"}, 
+  {"flistxattr","0,13,,"}, 
+  {"fchmodat","0,53,,"}, 
+  {"0.201","listen"}, 
+  {"capset","0,91,,"}, 
+  {"0.69","preadv"}, 
+  {"0.200","bind"}, 
+  {"0.68","pwrite64"}, 
+  {"0.203","connect"}, 
+  {"0.202","accept"}, 
+  {"0.205","getpeername"}, 
+  {"0.65","readv"}, 
+  {"0.204","getsockname"}, 
+  {"0.64","write"}, 
+  {"io_setup","0,0,,"}, 
+  {"0.207","recvfrom"}, 
+  {"lremovexattr","0,15,,"}, 
+  {"0.67","pread64"}, 
+  {"0.206","sendto"}, 
+  {"0.66","writev"}, 
+  {"0.61","getdents64"}, 
+  {"epoll_ctl","0,21,,"}, 
+  {"0.60","quotactl"}, 
+  {"0.63","read"}, 
+  {"0.62","lseek"}, 
+  {"mprotect","0,226,,"}, 
+  {"setsid","0,157,,"}, 
+  {"sched_setparam","0,118,,"}, 
+  {"0.218","request_key"}, 
+  {"0.219","keyctl"}, 
+  {"shmat","0,196,,"}, 
+  {"pkey_mprotect","0,288,,"}, 
+  {"recvmmsg","0,243,,"}, 
+  {"waitid","0,95,,"}, 
+  {"0.210","shutdown"}, 
+  {"getcpu","0,168,,"}, 
+  {"0.78","readlinkat"}, 
+  {"0.211","sendmsg"}, 
+  {"0.79","fstatat"}, 
+  {"0.212","recvmsg"}, 
+  {"0.213","readahead"}, 
+  {"msgsnd","0,189,,"}, 
+  {"0.214","brk"}, 
+  {"0.74","signalfd4"}, 
+  {"0.215","munmap"}, 
+  {"0.75","vmsplice"}, 
+  {"0.216","mremap"}, 
+  {"0.76","splice"}, 
+  {"0.217","add_key"}, 
+  {"0.108","timer_gettime"}, 
+  {"0.77","tee"}, 
+  {"0.109","timer_getoverrun"}, 
+  {"0.70","pwritev"}, 
+  {"capget","0,90,,"}, 
+  {"inotify_init1","0,26,,"}, 
+  {"0.71","sendfile"}, 
+  {"0.72","pselect6"}, 
+  {"0.73","ppoll"}, 
+  {"0.102","getitimer"}, 
+  {"0.103","setitimer"}, 
+  {"getcwd","0,17,,"}, 
+  {"0.100","get_robust_list"}, 
+  {"0.101","nanosleep"}, 
+  {"get_mempolicy","0,236,,"}, 
+  {"0.106","delete_module"}, 
+  {"0.107","timer_create"}, 
+  {"move_mount","0,429,,"}, 
+  {"clone","0,220,,"}, 
+  {"0.104","kexec_load"}, 
+  {"sched_getattr","0,275,,"}, 
+  {"0.105","init_module"}, 
+  {"statx","0,291,,"}, 
+  {"preadv","0,69,,"}, 
+  {"mknodat","0,33,,"}, 
+  {"0.229","munlock"}, 
+  {"symlinkat","0,36,,"}, 
+  {"0.228","mlock"}, 
+  {"getpgid","0,155,,"}, 
+  {"chdir","0,49,1,z"}, 
+  {"0.223","fadvise64"}, 
+  {"0.222","mmap"}, 
+  {"faccessat","0,48,,"}, 
+  {"0.221","execve"}, 
+  {"0.49","chdir"}, 
+  {"remap_file_pages","0,234,,"}, 
+  {"process_vm_readv","0,270,,"}, 
+  {"0.220","clone"}, 
+  {"rt_sigsuspend","0,133,,"}, 
+  {"0.48","faccessat"}, 
+  {"0.227","msync"}, 
+  {"0.47","fallocate"}, 
+  {"0.226","mprotect"}, 
+  {"0.139","rt_sigreturn"}, 
+  {"eventfd2","0,19,,"}, 
+  {"0.46","ftruncate"}, 
+  {"0.225","swapoff"}, 
+  {"0.138","rt_sigqueueinfo"}, 
+  {"0.45","truncate"}, 
+  {"0.44","fstatfs"}, 
+  {"0.224","swapon"}, 
+  {"0.43","statfs"}, 
+  {"0.42","nfsservctl"}, 
+  {"kexec_load","0,104,,"}, 
+  {"0.41","pivot_root"}, 
+  {"shmget","0,194,,"}, 
+  {"0.40","mount"}, 
+  {"getgid","0,176,0,"}, 
+  {"0.131","tgkill"}, 
+  {"name_to_handle_at","0,264,,"}, 
+  {"0.130","tkill"}, 
+  {"0.133","rt_sigsuspend"}, 
+  {"0.132","sigaltstack"}, 
+  {"0.135","rt_sigprocmask"}, 
+  {"fanotify_mark","0,263,,"}, 
+  {"0.134","rt_sigaction"}, 
+  {"0.137","rt_sigtimedwait"}, 
+  {"0.136","rt_sigpending"}, 
+  {"fsopen","0,430,,"}, 
+  {"0.449","futex_waitv"}, 
+  {"fallocate","0,47,,"}, 
+  {"0.448","process_mrelease"}, 
+  {"tgkill","0,131,,"}, 
+  {"getdents64","0,61,,"}, 
+  {"msgctl","0,187,,"}, 
+  {"0.238","migrate_pages"}, 
+  {"0.443","quotactl_fd"}, 
+  {"0.239","move_pages"}, 
+  {"0.442","mount_setattr"}, 
+  {"vhangup","0,58,,"}, 
+  {"0.441","epoll_pwait2"}, 
+  {"0.440","process_madvise"}, 
+  {"0.447","memfd_secret"}, 
+  {"mq_notify","0,184,,"}, 
+  {"0.446","landlock_restrict_self"}, 
+  {"0.232","mincore"}, 
+  {"umount2","0,39,,"}, 
+  {"0.445","landlock_add_rule"}, 
+  {"0.233","madvise"}, 
+  {"times","0,153,,"}, 
+  {"0.444","landlock_create_ruleset"}, 
+  {"0.58","vhangup"}, 
+  {"0.230","mlockall"}, 
+  {"0.59","pipe2"}, 
+  {"0.231","munlockall"}, 
+  {"0.56","openat"}, 
+  {"0.236","get_mempolicy"}, 
+  {"unshare","0,97,,"}, 
+  {"0.57","close"}, 
+  {"0.237","set_mempolicy"}, 
+  {"getpriority","0,141,,"}, 
+  {"0.54","fchownat"}, 
+  {"0.234","remap_file_pages"}, 
+  {"0.55","fchown"}, 
+  {"0.235","mbind"}, 
+  {"reboot","0,142,,"}, 
+  {"vmsplice","0,75,,"}, 
+  {"openat2","0,437,,"}, 
+  {"0.52","fchmod"}, 
+  {"0.53","fchmodat"}, 
+  {"0.168","getcpu"}, 
+  {"mbind","0,235,,"}, 
+  {"landlock_restrict_self","0,446,,"}, 
+  {"0.50","fchdir"}, 
+  {"0.169","gettimeofday"}, 
+  {"lookup_dcookie","0,18,,"}, 
+  {"0.51","chroot"}, 
+  {"semtimedop","0,192,,"}, 
+  {"sendmmsg","0,269,,"}, 
+  {"0.164","setrlimit"}, 
+  {"0.165","getrusage"}, 
+  {"0.166","umask"}, 
+  {"0.167","prctl"}, 
+  {"openat","0,56,,"}, 
+  {"0.160","uname"}, 
+  {"0.161","sethostname"}, 
+  {"timer_gettime","0,108,,"}, 
+  {"0.162","setdomainname"}, 
+  {"setrlimit","0,164,,"}, 
+  {"0.163","getrlimit"}, 
+  {"madvise","0,233,,"}, 
+  {"sched_get_priority_max","0,125,,"}, 
+  {"shmdt","0,197,,"}, 
+  {"mincore","0,232,,"}, 
+  {"rt_sigprocmask","0,135,,"}, 
+  {"timer_delete","0,111,,"}, 
+  {"sched_rr_get_interval","0,127,,"}, 
+  {"readv","0,65,,"}, 
+  {"0.450","set_mempolicy_home_node"}, 
+  {"0.244","arch_specific_syscall"}, 
+  {"keyctl","0,219,,"}, 
+  {"0.241","perf_event_open"}, 
+  {"sched_getparam","0,121,,"}, 
+  {"0.240","rt_tgsigqueueinfo"}, 
+  {"0.243","recvmmsg"}, 
+  {"0.242","accept4"}, 
+  {"0.119","sched_setscheduler"}, 
+  {"fchown","0,55,,"}, 
+  {"0.118","sched_setparam"}, 
+  {"fsmount","0,432,,"}, 
+  {"timerfd_create","0,85,,"}, 
+  {"timer_create","0,107,,"}, 
+  {"0.113","clock_gettime"}, 
+  {"0.112","clock_settime"}, 
+  {"0.111","timer_delete"}, 
+  {"0.110","timer_settime"}, 
+  {"listxattr","0,11,,"}, 
+  {"unlinkat","0,35,,"}, 
+  {"0.117","ptrace"}, 
+  {"0.116","syslog"}, 
+  {"0.115","clock_nanosleep"}, 
+  {"0.114","clock_getres"}, 
+  {"mkdirat","0,34,,"}, 
+  {"shutdown","0,210,,"}, 
+  {"0.429","move_mount"}, 
+  {"0.428","open_tree"}, 
+  {"tkill","0,130,,"}, 
+  {"timerfd_settime","0,86,,"}, 
+  {"0.425","io_uring_setup"}, 
+  {"0.424","pidfd_send_signal"}, 
+  {"socket","0,198,,"}, 
+  {"0.427","io_uring_register"}, 
+  {"0.426","io_uring_enter"}, 
+  {"process_vm_writev","0,271,,"}, 
+  {"ptrace","0,117,,"}, 
+  {"futex_waitv","0,449,,"}, 
+  {"socketpair","0,199,,"}, 
+  {"msync","0,227,,"}, 
+  {"open_tree","0,428,,"}, 
+  {"settimeofday","0,170,,"}, 
+  {"setxattr","0,5,,"}, 
+  {"truncate","0,45,,"}, 
+  {"syslog","0,116,,"}, 
+  {"0.148","getresuid"}, 
+  {"msgrcv","0,188,,"}, 
+  {"0.149","setresgid"}, 
+  {"0.146","setuid"}, 
+  {"0.147","setresuid"}, 
+  {"0.144","setgid"}, 
+  {"0.145","setreuid"}, 
+  {"setuid","0,146,,"}, 
+  {"0.142","reboot"}, 
+  {"0.143","setregid"}, 
+  {"add_key","0,217,,"}, 
+  {"0.140","setpriority"}, 
+  {NULL, NULL}
+};
+// 0x558db3584170
+// TODO
+typedef int (*GperfForeachCallback)(void *user, const char *k, const char *v);
+int gperf_linux_arm_64_foreach(GperfForeachCallback cb, void *user) {
+  int i = 0; while (kvs[i].name) {
+  cb (user, kvs[i].name, kvs[i].value);
+  i++;}
+  return 0;
+}
+const char *gperf_linux_arm_64_get(const char *s) {
+  int i = 0; while (kvs[i].name) {
+  if (!strcmp (s, kvs[i].name)) return kvs[i].value;
+  i++;}
+  return NULL;
+}
+#define sdb_hash_c_linux_arm_64(x,y) gperf_linux_arm_64_hash(x)
+const unsigned int gperf_linux_arm_64_hash(const char *s) {
+  int sum = strlen (s);
+  while (*s) { sum += *s; s++; }
+  return sum;
+}
+struct {const char *name;void *get;void *hash;void *foreach;} gperf_linux_arm_64 = {
+  .name = "linux-arm-64",
+  .get = &gperf_linux_arm_64_get,
+  .hash = &gperf_linux_arm_64_hash,
+  .foreach = &gperf_linux_arm_64_foreach
+};
+
+#if MAIN
+int main () {
+	const char *s = ((char*(*)(char*))gperf_linux_arm_64.get)("foo");
+	printf ("%s\n", s);
+}
+#endif
@@ -0,0 +1,769 @@
+// SDB-CGEN V1.9.4
+// gcc -DMAIN=1 linux_x86_64.c ; ./a.out > linux_x86_64.h
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+struct kv { const char *name; const char *value; };
+static const struct kv kvs[] = {
+  {"keyctl","0x80,250,5,"}, 
+  {"0x80.74","fsync"}, 
+  {"0x80.75","fdatasync"}, 
+  {"0x80.131","sigaltstack"}, 
+  {"0x80.76","truncate"}, 
+  {"setitimer","0x80,38,3,"}, 
+  {"0x80.130","rt_sigsuspend"}, 
+  {"0x80.269","faccessat"}, 
+  {"0x80.77","ftruncate"}, 
+  {"0x80.133","mknod"}, 
+  {"0x80.268","fchmodat"}, 
+  {"0x80.70","msgrcv"}, 
+  {"0x80.132","utime"}, 
+  {"0x80.267","readlinkat"}, 
+  {"0x80.71","msgctl"}, 
+  {"fchownat","0x80,260,5,"}, 
+  {"0x80.135","personality"}, 
+  {"0x80.266","symlinkat"}, 
+  {"0x80.72","fcntl"}, 
+  {"fchmod","0x80,91,2,"}, 
+  {"0x80.134","uselib"}, 
+  {"0x80.265","linkat"}, 
+  {"0x80.73","flock"}, 
+  {"0x80.137","statfs"}, 
+  {"0x80.264","renameat"}, 
+  {"0x80.136","ustat"}, 
+  {"0x80.263","unlinkat"}, 
+  {"0x80.262","newfstatat"}, 
+  {"io_getevents","0x80,208,4,"}, 
+  {"0x80.261","futimesat"}, 
+  {"0x80.260","fchownat"}, 
+  {"msgctl","0x80,71,3,"}, 
+  {"process_mrelease","0x80,448,,"}, 
+  {"getxattr","0x80,191,4,"}, 
+  {"link","0x80,86,2,zz"}, 
+  {"set_mempolicy","0x80,238,3,"}, 
+  {"pwritev2","0x80,328,6,"}, 
+  {"kcmp","0x80,312,5,"}, 
+  {"0x80.168","swapoff"}, 
+  {"0x80.49","bind"}, 
+  {"0x80.169","reboot"}, 
+  {"0x80.48","shutdown"}, 
+  {"timer_delete","0x80,226,1,"}, 
+  {"0x80.47","recvmsg"}, 
+  {"0x80.164","settimeofday"}, 
+  {"0x80.46","sendmsg"}, 
+  {"0x80.165","mount"}, 
+  {"0x80.45","recvfrom"}, 
+  {"0x80.166","umount2"}, 
+  {"sigaltstack","0x80,131,2,"}, 
+  {"0x80.278","vmsplice"}, 
+  {"0x80.44","sendto"}, 
+  {"0x80.167","swapon"}, 
+  {"0x80.279","move_pages"}, 
+  {"0x80.43","accept"}, 
+  {"semget","0x80,64,3,"}, 
+  {"0x80.160","setrlimit"}, 
+  {"0x80.276","tee"}, 
+  {"0x80.42","connect"}, 
+  {"0x80.161","chroot"}, 
+  {"0x80.277","sync_file_range"}, 
+  {"0x80.41","socket"}, 
+  {"0x80.162","sync"}, 
+  {"sched_getscheduler","0x80,145,1,"}, 
+  {"0x80.274","get_robust_list"}, 
+  {"0x80.40","sendfile"}, 
+  {"0x80.163","acct"}, 
+  {"0x80.275","splice"}, 
+  {"0x80.272","unshare"}, 
+  {"0x80.273","set_robust_list"}, 
+  {"0x80.270","pselect6"}, 
+  {"0x80.271","ppoll"}, 
+  {"get_robust_list","0x80,274,3,"}, 
+  {"time","0x80,201,1,"}, 
+  {"open_tree","0x80,428,,"}, 
+  {"mq_getsetattr","0x80,245,3,"}, 
+  {"sendmmsg","0x80,307,4,"}, 
+  {"fork","0x80,57,0,"}, 
+  {"perf_event_open","0x80,298,5,"}, 
+  {"rename","0x80,82,2,"}, 
+  {"getpgid","0x80,121,1,"}, 
+  {"linkat","0x80,265,5,"}, 
+  {"0x80.119","setresgid"}, 
+  {"inotify_init","0x80,253,0,"}, 
+  {"0x80.118","getresuid"}, 
+  {"epoll_wait","0x80,232,4,"}, 
+  {"0x80.58","vfork"}, 
+  {"semtimedop","0x80,220,4,"}, 
+  {"0x80.59","execve"}, 
+  {"0x80.56","clone"}, 
+  {"0x80.113","setreuid"}, 
+  {"0x80.57","fork"}, 
+  {"migrate_pages","0x80,256,4,"}, 
+  {"epoll_pwait2","0x80,441,,"}, 
+  {"0x80.112","setsid"}, 
+  {"0x80.54","setsockopt"}, 
+  {"0x80.111","getpgrp"}, 
+  {"0x80.55","getsockopt"}, 
+  {"0x80.110","getppid"}, 
+  {"set_tid_address","0x80,218,1,"}, 
+  {"0x80.308","setns"}, 
+  {"0x80.52","getpeername"}, 
+  {"sched_get_priority_max","0x80,146,1,"}, 
+  {"syslog","0x80,103,3,"}, 
+  {"0x80.117","setresuid"}, 
+  {"0x80.309","getcpu"}, 
+  {"0x80.53","socketpair"}, 
+  {"0x80.116","setgroups"}, 
+  {"0x80.50","listen"}, 
+  {"0x80.115","getgroups"}, 
+  {"0x80.51","getsockname"}, 
+  {"0x80.114","setregid"}, 
+  {"setdomainname","0x80,171,2,"}, 
+  {"shmat","0x80,30,3,"}, 
+  {"0x80.300","fanotify_init"}, 
+  {"userfaultfd","0x80,323,1,"}, 
+  {"0x80.301","fanotify_mark"}, 
+  {"move_mount","0x80,429,,"}, 
+  {"0x80.302","prlimit64"}, 
+  {"0x80.303","name_to_handle_at"}, 
+  {"copy_file_range","0x80,326,6,"}, 
+  {"0x80.304","open_by_handle_at"}, 
+  {"0x80.305","clock_adjtime"}, 
+  {"0x80.306","syncfs"}, 
+  {"faccessat2","0x80,439,,"}, 
+  {"0x80.307","sendmmsg"}, 
+  {"mq_timedsend","0x80,242,5,"}, 
+  {"rt_sigqueueinfo","0x80,129,3,"}, 
+  {"tee","0x80,276,4,"}, 
+  {"alarm","0x80,37,1,"}, 
+  {"futex","0x80,202,6,"}, 
+  {"0x80.148","sched_rr_get_interval"}, 
+  {"0x80.149","mlock"}, 
+  {"finit_module","0x80,313,3,"}, 
+  {"0x80.146","sched_get_priority_max"}, 
+  {"0x80.147","sched_get_priority_min"}, 
+  {"mlock","0x80,149,2,"}, 
+  {"0x80.144","sched_setscheduler"}, 
+  {"0x80.145","sched_getscheduler"}, 
+  {"0x80.142","sched_setparam"}, 
+  {"0x80.143","sched_getparam"}, 
+  {"0x80.140","getpriority"}, 
+  {"mknodat","0x80,259,4,"}, 
+  {"0x80.141","setpriority"}, 
+  {"pipe","0x80,22,1,"}, 
+  {"wait4","0x80,61,4,"}, 
+  {"set_mempolicy_home_node","0x80,450,,"}, 
+  {"sched_getparam","0x80,143,2,"}, 
+  {"0x80.449","futex_waitv"}, 
+  {"epoll_ctl_old","0x80,214,1,"}, 
+  {"0x80.448","process_mrelease"}, 
+  {"setpriority","0x80,141,3,"}, 
+  {"pivot_root","0x80,155,2,"}, 
+  {"getdents64","0x80,217,3,"}, 
+  {"0x80.179","quotactl"}, 
+  {"getpid","0x80,39,0,"}, 
+  {"0x80.443","quotactl_fd"}, 
+  {"0x80.178","query_module"}, 
+  {"0x80.442","mount_setattr"}, 
+  {"0x80.441","epoll_pwait2"}, 
+  {"0x80.440","process_madvise"}, 
+  {"0x80.175","init_module"}, 
+  {"0x80.447","memfd_secret"}, 
+  {"0x80.174","create_module"}, 
+  {"0x80.446","landlock_restrict_self"}, 
+  {"0x80.177","get_kernel_syms"}, 
+  {"0x80.445","landlock_add_rule"}, 
+  {"0x80.176","delete_module"}, 
+  {"0x80.444","landlock_create_ruleset"}, 
+  {"0x80.171","setdomainname"}, 
+  {"lsetxattr","0x80,189,5,"}, 
+  {"0x80.170","sethostname"}, 
+  {"0x80.328","pwritev2"}, 
+  {"0x80.173","ioperm"}, 
+  {"0x80.329","pkey_mprotect"}, 
+  {"0x80.172","iopl"}, 
+  {"move_pages","0x80,279,6,"}, 
+  {"symlinkat","0x80,266,3,"}, 
+  {"pkey_mprotect","0x80,329,4,"}, 
+  {"pkey_alloc","0x80,330,2,"}, 
+  {"io_uring_register","0x80,427,,"}, 
+  {"getpriority","0x80,140,2,"}, 
+  {"fsync","0x80,74,1,"}, 
+  {"0x80.322","execveat"}, 
+  {"getitimer","0x80,36,2,"}, 
+  {"0x80.323","userfaultfd"}, 
+  {"0x80.320","kexec_file_load"}, 
+  {"fsetxattr","0x80,190,5,"}, 
+  {"0x80.321","bpf"}, 
+  {"0x80.326","copy_file_range"}, 
+  {"0x80.327","preadv2"}, 
+  {"0x80.324","membarrier"}, 
+  {"0x80.325","mlock2"}, 
+  {"mount_setattr","0x80,442,,"}, 
+  {"arch_prctl","0x80,158,3,"}, 
+  {"0x80.450","set_mempolicy_home_node"}, 
+  {"readlink","0x80,89,3,"}, 
+  {"setfsuid","0x80,122,1,"}, 
+  {"lseek","0x80,8,3,"}, 
+  {"sched_setattr","0x80,314,3,"}, 
+  {"0x80.319","memfd_create"}, 
+  {"0x80.318","getrandom"}, 
+  {"vhangup","0x80,153,0,"}, 
+  {"pidfd_open","0x80,434,,"}, 
+  {"shmdt","0x80,67,1,"}, 
+  {"process_madvise","0x80,440,,"}, 
+  {"setxattr","0x80,188,5,"}, 
+  {"clock_gettime","0x80,228,2,"}, 
+  {"0x80.311","process_vm_writev"}, 
+  {"0x80.310","process_vm_readv"}, 
+  {"0x80.313","finit_module"}, 
+  {"0x80.312","kcmp"}, 
+  {"0x80.315","sched_getattr"}, 
+  {"nanosleep","0x80,35,2,"}, 
+  {"0x80.314","sched_setattr"}, 
+  {"0x80.317","seccomp"}, 
+  {"unshare","0x80,272,1,"}, 
+  {"0x80.316","renameat2"}, 
+  {"setsid","0x80,112,0,"}, 
+  {"umount2","0x80,166,2,"}, 
+  {"shmctl","0x80,31,3,"}, 
+  {"0x80.429","move_mount"}, 
+  {"0x80.428","open_tree"}, 
+  {"0x80.425","io_uring_setup"}, 
+  {"0x80.424","pidfd_send_signal"}, 
+  {"readlinkat","0x80,267,4,"}, 
+  {"0x80.159","adjtimex"}, 
+  {"set_thread_area","0x80,205,2,"}, 
+  {"shmget","0x80,29,3,"}, 
+  {"0x80.427","io_uring_register"}, 
+  {"0x80.158","arch_prctl"}, 
+  {"0x80.426","io_uring_enter"}, 
+  {"modify_ldt","0x80,154,3,"}, 
+  {"0x80.157","prctl"}, 
+  {"0x80.156","sysctl"}, 
+  {"poll","0x80,7,3,"}, 
+  {"0x80.155","pivot_root"}, 
+  {"init_module","0x80,175,3,"}, 
+  {"madvise","0x80,28,3,"}, 
+  {"0x80.154","modify_ldt"}, 
+  {"futimesat","0x80,261,3,"}, 
+  {"0x80.153","vhangup"}, 
+  {"0x80.152","munlockall"}, 
+  {"0x80.151","mlockall"}, 
+  {"0x80.150","munlock"}, 
+  {"getpmsg","0x80,181,1,"}, 
+  {"statfs","0x80,137,2,"}, 
+  {"getcpu","0x80,309,3,"}, 
+  {"pipe2","0x80,293,2,"}, 
+  {"bind","0x80,49,3,"}, 
+  {"0x80.438","pidfd_getfd"}, 
+  {"io_pgetevents","0x80,333,6,"}, 
+  {"0x80.439","faccessat2"}, 
+  {"getcwd","0x80,79,2,"}, 
+  {"0x80.434","pidfd_open"}, 
+  {"rt_sigpending","0x80,127,2,"}, 
+  {"0x80.435","clone3"}, 
+  {"tgkill","0x80,234,3,"}, 
+  {"0x80.436","close_range"}, 
+  {"0x80.437","openat2"}, 
+  {"0x80.430","fsopen"}, 
+  {"0x80.431","fsconfig"}, 
+  {"newfstatat","0x80,262,4,"}, 
+  {"fchdir","0x80,81,1,"}, 
+  {"0x80.432","fsmount"}, 
+  {"0x80.433","fspick"}, 
+  {"fsmount","0x80,432,,"}, 
+  {"execve","0x80,59,3,zzz"}, 
+  {"memfd_secret","0x80,447,,"}, 
+  {"fanotify_mark","0x80,301,5,"}, 
+  {"iopl","0x80,172,2,"}, 
+  {"mknod","0x80,133,3,"}, 
+  {"0x80.333","io_pgetevents"}, 
+  {"0x80.332","statx"}, 
+  {"0x80.331","pkey_free"}, 
+  {"0x80.330","pkey_alloc"}, 
+  {"prctl","0x80,157,5,"}, 
+  {"quotactl","0x80,179,4,"}, 
+  {"uselib","0x80,134,1,"}, 
+  {"unlinkat","0x80,263,3,"}, 
+  {"0x80.334","rseq"}, 
+  {"remap_file_pages","0x80,216,5,"}, 
+  {"fcntl","0x80,72,3,"}, 
+  {"flock","0x80,73,2,"}, 
+  {"restart_syscall","0x80,219,0,"}, 
+  {"settimeofday","0x80,164,2,"}, 
+  {"utimensat","0x80,280,4,"}, 
+  {"clone3","0x80,435,,"}, 
+  {"capset","0x80,126,2,"}, 
+  {"setpgid","0x80,109,2,"}, 
+  {"getsid","0x80,124,1,"}, 
+  {"fadvise64","0x80,221,4,"}, 
+  {"msgget","0x80,68,2,"}, 
+  {"vserver","0x80,236,1,"}, 
+  {"clone","0x80,56,4,"}, 
+  {"mbind","0x80,237,6,"}, 
+  {"create_module","0x80,174,1,"}, 
+  {"clock_adjtime","0x80,305,2,"}, 
+  {"exit_group","0x80,231,1,"}, 
+  {"setresgid","0x80,119,3,"}, 
+  {"utime","0x80,132,2,"}, 
+  {"gettimeofday","0x80,96,2,"}, 
+  {"semop","0x80,65,3,"}, 
+  {"listen","0x80,50,2,"}, 
+  {"recvmmsg","0x80,299,5,"}, 
+  {"sched_setaffinity","0x80,203,3,"}, 
+  {"mq_notify","0x80,244,2,"}, 
+  {"get_thread_area","0x80,211,2,"}, 
+  {"seccomp","0x80,317,3,"}, 
+  {"rt_tgsigqueueinfo","0x80,297,4,"}, 
+  {"accept4","0x80,288,4,"}, 
+  {"setreuid","0x80,113,2,"}, 
+  {"msgrcv","0x80,70,5,"}, 
+  {"uname","0x80,63,1,"}, 
+  {"pread64","0x80,17,4,"}, 
+  {"prlimit64","0x80,302,4,"}, 
+  {"ioctl","0x80,16,3,"}, 
+  {"epoll_ctl","0x80,233,4,"}, 
+  {"timer_getoverrun","0x80,225,1,"}, 
+  {"connect","0x80,42,3,"}, 
+  {"getppid","0x80,110,0,"}, 
+  {"removexattr","0x80,197,2,"}, 
+  {"lookup_dcookie","0x80,212,3,"}, 
+  {"execveat","0x80,322,5,"}, 
+  {"0x80.281","epoll_pwait"}, 
+  {"0x80.280","utimensat"}, 
+  {"mq_unlink","0x80,241,1,"}, 
+  {"0x80.283","timerfd_create"}, 
+  {"0x80.282","signalfd"}, 
+  {"0x80.285","fallocate"}, 
+  {"read","0x80,0,3,ipi"}, 
+  {"0x80.284","eventfd"}, 
+  {"0x80.287","timerfd_gettime"}, 
+  {"0x80.286","timerfd_settime"}, 
+  {"0x80.289","signalfd4"}, 
+  {"0x80.288","accept4"}, 
+  {"get_mempolicy","0x80,239,5,"}, 
+  {"chmod","0x80,90,2,"}, 
+  {"sendto","0x80,44,6,"}, 
+  {"sysinfo","0x80,99,1,"}, 
+  {"epoll_pwait","0x80,281,6,"}, 
+  {"preadv","0x80,295,5,"}, 
+  {"recvmsg","0x80,47,3,"}, 
+  {"epoll_create","0x80,213,1,"}, 
+  {"process_vm_writev","0x80,311,6,"}, 
+  {"0x80.290","eventfd2"}, 
+  {"0x80.291","epoll_create1"}, 
+  {"0x80.292","dup3"}, 
+  {"_","0x80"}, 
+  {"0x80.293","pipe2"}, 
+  {"readv","0x80,19,3,"}, 
+  {"0x80.294","inotify_init1"}, 
+  {"pause","0x80,34,0,"}, 
+  {"sysfs","0x80,139,3,"}, 
+  {"0x80.295","preadv"}, 
+  {"0x80.296","pwritev"}, 
+  {"geteuid","0x80,107,0,"}, 
+  {"0x80.297","rt_tgsigqueueinfo"}, 
+  {"open_by_handle_at","0x80,304,5,"}, 
+  {"0x80.298","perf_event_open"}, 
+  {"0x80.299","recvmmsg"}, 
+  {"timerfd_gettime","0x80,287,2,"}, 
+  {"rt_sigreturn","0x80,15,1,"}, 
+  {"clock_getres","0x80,229,2,"}, 
+  {"getgroups","0x80,115,2,"}, 
+  {"getuid","0x80,102,0,"}, 
+  {"fsconfig","0x80,431,,"}, 
+  {"epoll_wait_old","0x80,215,1,"}, 
+  {"vfork","0x80,58,0,"}, 
+  {"ustat","0x80,136,2,"}, 
+  {"flistxattr","0x80,196,3,"}, 
+  {"pidfd_send_signal","0x80,424,,"}, 
+  {"times","0x80,100,1,"}, 
+  {"fchmodat","0x80,268,3,"}, 
+  {"umask","0x80,95,1,"}, 
+  {"epoll_create1","0x80,291,1,"}, 
+  {"waitid","0x80,247,5,"}, 
+  {"listxattr","0x80,194,3,"}, 
+  {"getresgid","0x80,120,3,"}, 
+  {"munmap","0x80,11,1,"}, 
+  {"0x80.83","mkdir"}, 
+  {"sendmsg","0x80,46,3,"}, 
+  {"0x80.82","rename"}, 
+  {"0x80.81","fchdir"}, 
+  {"0x80.80","chdir"}, 
+  {"0x80.87","unlink"}, 
+  {"0x80.86","link"}, 
+  {"0x80.85","creat"}, 
+  {"0x80.84","rmdir"}, 
+  {"quotactl_fd","0x80,443,,"}, 
+  {"chown","0x80,92,3,"}, 
+  {"ioprio_set","0x80,251,3,"}, 
+  {"mq_timedreceive","0x80,243,5,"}, 
+  {"0x80.89","readlink"}, 
+  {"truncate","0x80,76,2,"}, 
+  {"0x80.88","symlink"}, 
+  {"setsockopt","0x80,54,5,"}, 
+  {"fanotify_init","0x80,300,2,"}, 
+  {"chdir","0x80,80,1,z"}, 
+  {"mq_open","0x80,240,4,"}, 
+  {"openat","0x80,257,4,"}, 
+  {"msgsnd","0x80,69,4,"}, 
+  {"timer_settime","0x80,223,4,"}, 
+  {"swapoff","0x80,168,1,"}, 
+  {"mprotect","0x80,10,3,"}, 
+  {"chroot","0x80,161,1,"}, 
+  {"fstatfs","0x80,138,2,"}, 
+  {"setns","0x80,308,2,"}, 
+  {"0x80.92","chown"}, 
+  {"0x80.93","fchown"}, 
+  {"0x80.90","chmod"}, 
+  {"io_uring_setup","0x80,425,,"}, 
+  {"0x80.91","fchmod"}, 
+  {"0x80.96","gettimeofday"}, 
+  {"0x80.97","getrlimit"}, 
+  {"0x80.94","lchown"}, 
+  {"0x80.95","umask"}, 
+  {"fspick","0x80,433,,"}, 
+  {"0x80.98","getrusage"}, 
+  {"sched_getattr","0x80,315,4,"}, 
+  {"setresuid","0x80,117,3,"}, 
+  {"0x80.99","sysinfo"}, 
+  {"sched_getaffinity","0x80,204,3,"}, 
+  {"getrusage","0x80,98,2,"}, 
+  {"brk","0x80,12,1,"}, 
+  {"creat","0x80,85,2,zx"}, 
+  {"mkdirat","0x80,258,3,"}, 
+  {"sched_yield","0x80,24,0,"}, 
+  {"accept","0x80,43,3,"}, 
+  {"open","0x80,2,3,zxx"}, 
+  {"vmsplice","0x80,278,4,"}, 
+  {"timer_gettime","0x80,224,2,"}, 
+  {"setregid","0x80,114,2,"}, 
+  {"fchown","0x80,93,3,"}, 
+  {"ptrace","0x80,101,4,"}, 
+  {"0x80.182","putpmsg"}, 
+  {"munlockall","0x80,152,0,"}, 
+  {"0x80.183","afs_syscall"}, 
+  {"io_setup","0x80,206,2,"}, 
+  {"0x80.180","nfsservctl"}, 
+  {"0x80.181","getpmsg"}, 
+  {"sendfile","0x80,40,4,"}, 
+  {"0x80.186","gettid"}, 
+  {"0x80.187","readahead"}, 
+  {"sync_file_range","0x80,277,4,"}, 
+  {"0x80.184","tuxcall"}, 
+  {"swapon","0x80,167,2,"}, 
+  {"0x80.185","security"}, 
+  {"preadv2","0x80,327,6,"}, 
+  {"0x80.188","setxattr"}, 
+  {"setgid","0x80,106,1,"}, 
+  {"0x80.189","lsetxattr"}, 
+  {"rt_sigtimedwait","0x80,128,4,"}, 
+  {"putpmsg","0x80,182,1,"}, 
+  {"getsockopt","0x80,55,5,"}, 
+  {"msync","0x80,26,3,"}, 
+  {"stat","0x80,4,2,"}, 
+  {"set_robust_list","0x80,273,2,"}, 
+  {"mlockall","0x80,151,1,"}, 
+  {"add_key","0x80,248,4,"}, 
+  {"pwritev","0x80,296,5,"}, 
+  {"personality","0x80,135,1,"}, 
+  {"mount","0x80,165,5,"}, 
+  {"getsockname","0x80,51,3,"}, 
+  {"rseq","0x80,334,4,"}, 
+  {"mremap","0x80,25,5,"}, 
+  {"rt_sigprocmask","0x80,14,3,"}, 
+  {"lstat","0x80,6,2,"}, 
+  {"pselect6","0x80,270,6,"}, 
+  {"pidfd_getfd","0x80,438,,"}, 
+  {"inotify_add_watch","0x80,254,3,"}, 
+  {"shutdown","0x80,48,2,"}, 
+  {"landlock_create_ruleset","0x80,444,,"}, 
+  {"landlock_restrict_self","0x80,446,,"}, 
+  {"setfsgid","0x80,123,1,"}, 
+  {"futex_waitv","0x80,449,,"}, 
+  {"delete_module","0x80,176,2,"}, 
+  {"getpgrp","0x80,111,0,"}, 
+  {"fstat","0x80,5,2,"}, 
+  {"socket","0x80,41,3,"}, 
+  {"request_key","0x80,249,4,"}, 
+  {"sync","0x80,162,0,"}, 
+  {"mlock2","0x80,325,3,"}, 
+  {"semctl","0x80,66,4,"}, 
+  {"signalfd4","0x80,289,4,"}, 
+  {"nfsservctl","0x80,180,1,"}, 
+  {"io_submit","0x80,209,3,"}, 
+  {"kexec_load","0x80,246,4,"}, 
+  {"afs_syscall","0x80,183,1,"}, 
+  {"sysctl","0x80,156,1,"}, 
+  {"0x80.193","fgetxattr"}, 
+  {"kexec_file_load","0x80,320,5,"}, 
+  {"security","0x80,185,1,"}, 
+  {"0x80.192","lgetxattr"}, 
+  {"0x80.191","getxattr"}, 
+  {"0x80.190","fsetxattr"}, 
+  {"0x80.197","removexattr"}, 
+  {"0x80.209","io_submit"}, 
+  {"sched_get_priority_min","0x80,147,1,"}, 
+  {"0x80.196","flistxattr"}, 
+  {"0x80.208","io_getevents"}, 
+  {"0x80.195","llistxattr"}, 
+  {"inotify_init1","0x80,294,1,"}, 
+  {"0x80.194","listxattr"}, 
+  {"fsopen","0x80,430,,"}, 
+  {"ftruncate","0x80,77,2,"}, 
+  {"0x80.199","fremovexattr"}, 
+  {"rmdir","0x80,84,1,"}, 
+  {"0x80.198","lremovexattr"}, 
+  {"0x80.201","time"}, 
+  {"0x80.200","tkill"}, 
+  {"0x80.203","sched_setaffinity"}, 
+  {"0x80.202","futex"}, 
+  {"0x80.205","set_thread_area"}, 
+  {"0x80.204","sched_getaffinity"}, 
+  {"rt_sigaction","0x80,13,3,"}, 
+  {"0x80.207","io_destroy"}, 
+  {"0x80.206","io_setup"}, 
+  {"syncfs","0x80,306,1,"}, 
+  {"select","0x80,23,5,"}, 
+  {"0x80.29","shmget"}, 
+  {"getrandom","0x80,318,3,pii"}, 
+  {"0x80.28","madvise"}, 
+  {"timerfd_settime","0x80,286,4,"}, 
+  {"ioprio_get","0x80,252,2,"}, 
+  {"close_range","0x80,436,3,"}, 
+  {"acct","0x80,163,1,"}, 
+  {"0x80.218","set_tid_address"}, 
+  {"0x80.219","restart_syscall"}, 
+  {"0x80.21","access"}, 
+  {"0x80.20","writev"}, 
+  {"0x80.23","select"}, 
+  {"0x80.22","pipe"}, 
+  {"0x80.25","mremap"}, 
+  {"0x80.24","sched_yield"}, 
+  {"mkdir","0x80,83,2,"}, 
+  {"0x80.210","io_cancel"}, 
+  {"0x80.27","mincore"}, 
+  {"0x80.211","get_thread_area"}, 
+  {"0x80.26","msync"}, 
+  {"0x80.212","lookup_dcookie"}, 
+  {"timerfd_create","0x80,283,2,"}, 
+  {"pwrite64","0x80,18,4,"}, 
+  {"0x80.213","epoll_create"}, 
+  {"mmap","0x80,9,6,"}, 
+  {"0x80.214","epoll_ctl_old"}, 
+  {"query_module","0x80,178,1,"}, 
+  {"0x80.215","epoll_wait_old"}, 
+  {"mincore","0x80,27,3,"}, 
+  {"eventfd2","0x80,290,2,"}, 
+  {"0x80.216","remap_file_pages"}, 
+  {"0x80.217","getdents64"}, 
+  {"symlink","0x80,88,2,"}, 
+  {"fdatasync","0x80,75,1,"}, 
+  {"capget","0x80,125,2,"}, 
+  {"timer_create","0x80,222,3,"}, 
+  {"fallocate","0x80,285,4,"}, 
+  {"rt_sigsuspend","0x80,130,2,"}, 
+  {"sched_rr_get_interval","0x80,148,2,"}, 
+  {"0x80.38","setitimer"}, 
+  {"0x80.39","getpid"}, 
+  {"openat2","0x80,437,,"}, 
+  {"0x80.229","clock_getres"}, 
+  {"0x80.30","shmat"}, 
+  {"0x80.228","clock_gettime"}, 
+  {"bpf","0x80,321,3,"}, 
+  {"0x80.31","shmctl"}, 
+  {"socketpair","0x80,53,4,"}, 
+  {"0x80.32","dup"}, 
+  {"0x80.33","dup2"}, 
+  {"0x80.34","pause"}, 
+  {"0x80.35","nanosleep"}, 
+  {"getdents","0x80,78,3,"}, 
+  {"0x80.223","timer_settime"}, 
+  {"0x80.36","getitimer"}, 
+  {"0x80.222","timer_create"}, 
+  {"0x80.37","alarm"}, 
+  {"0x80.221","fadvise64"}, 
+  {"lremovexattr","0x80,198,2,"}, 
+  {"0x80.220","semtimedop"}, 
+  {"0x80.227","clock_settime"}, 
+  {"0x80.226","timer_delete"}, 
+  {"0x80.225","timer_getoverrun"}, 
+  {"statx","0x80,332,5,"}, 
+  {"0x80.224","timer_gettime"}, 
+  {"getpeername","0x80,52,3,"}, 
+  {"kill","0x80,62,2,"}, 
+  {"0x80.128","rt_sigtimedwait"}, 
+  {"writev","0x80,20,3,"}, 
+  {"0x80.129","rt_sigqueueinfo"}, 
+  {"renameat2","0x80,316,5,"}, 
+  {"lchown","0x80,94,3,"}, 
+  {"0x80.238","set_mempolicy"}, 
+  {"0x80.239","get_mempolicy"}, 
+  {"0x80.120","getresgid"}, 
+  {"renameat","0x80,264,4,"}, 
+  {"0x80.121","getpgid"}, 
+  {"gettid","0x80,186,0,"}, 
+  {"0x80.122","setfsuid"}, 
+  {"0x80.123","setfsgid"}, 
+  {"0x80.124","getsid"}, 
+  {"tkill","0x80,200,2,"}, 
+  {"0x80.232","epoll_wait"}, 
+  {"0x80.125","capget"}, 
+  {"0x80.233","epoll_ctl"}, 
+  {"0x80.126","capset"}, 
+  {"0x80.230","clock_nanosleep"}, 
+  {"0x80.127","rt_sigpending"}, 
+  {"0x80.231","exit_group"}, 
+  {"0x80.236","vserver"}, 
+  {"0x80.237","mbind"}, 
+  {"0x80.234","tgkill"}, 
+  {"access","0x80,21,2,"}, 
+  {"0x80.235","utimes"}, 
+  {"recvfrom","0x80,45,6,"}, 
+  {"inotify_rm_watch","0x80,255,2,"}, 
+  {"dup","0x80,32,2,"}, 
+  {"memfd_create","0x80,319,2,"}, 
+  {"io_uring_enter","0x80,426,,"}, 
+  {"io_destroy","0x80,207,1,"}, 
+  {"0x80.18","pwrite64"}, 
+  {"signalfd","0x80,282,3,"}, 
+  {"0x80.19","readv"}, 
+  {"unlink","0x80,87,1,z"}, 
+  {"close","0x80,3,1,i"}, 
+  {"pkey_free","0x80,331,1,"}, 
+  {"0x80.9","mmap"}, 
+  {"0x80.12","brk"}, 
+  {"0x80.8","lseek"}, 
+  {"0x80.249","request_key"}, 
+  {"0x80.13","rt_sigaction"}, 
+  {"0x80.248","add_key"}, 
+  {"clock_nanosleep","0x80,230,4,"}, 
+  {"0x80.10","mprotect"}, 
+  {"0x80.11","munmap"}, 
+  {"munlock","0x80,150,2,"}, 
+  {"splice","0x80,275,6,"}, 
+  {"write","0x80,1,3,izi"}, 
+  {"0x80.16","ioctl"}, 
+  {"0x80.245","mq_getsetattr"}, 
+  {"0x80.17","pread64"}, 
+  {"0x80.3","close"}, 
+  {"0x80.244","mq_notify"}, 
+  {"0x80.14","rt_sigprocmask"}, 
+  {"io_cancel","0x80,210,3,"}, 
+  {"0x80.2","open"}, 
+  {"0x80.247","waitid"}, 
+  {"0x80.15","rt_sigreturn"}, 
+  {"setgroups","0x80,116,2,"}, 
+  {"0x80.1","write"}, 
+  {"0x80.246","kexec_load"}, 
+  {"process_vm_readv","0x80,310,6,"}, 
+  {"0x80.0","read"}, 
+  {"0x80.241","mq_unlink"}, 
+  {"sched_setparam","0x80,142,2,"}, 
+  {"0x80.7","poll"}, 
+  {"0x80.240","mq_open"}, 
+  {"sched_setscheduler","0x80,144,3,"}, 
+  {"0x80.6","lstat"}, 
+  {"0x80.243","mq_timedreceive"}, 
+  {"0x80.5","fstat"}, 
+  {"0x80.242","mq_timedsend"}, 
+  {"0x80.4","stat"}, 
+  {"reboot","0x80,169,4,"}, 
+  {"name_to_handle_at","0x80,303,5,"}, 
+  {"setrlimit","0x80,160,2,"}, 
+  {"setuid","0x80,105,1,"}, 
+  {"landlock_add_rule","0x80,445,,"}, 
+  {"getresuid","0x80,118,3,"}, 
+  {"getegid","0x80,108,0,"}, 
+  {"utimes","0x80,235,2,"}, 
+  {"fremovexattr","0x80,199,2,"}, 
+  {"membarrier","0x80,324,2,"}, 
+  {"ppoll","0x80,271,5,"}, 
+  {"0x80.108","getegid"}, 
+  {"0x80.69","msgsnd"}, 
+  {"0x80.109","setpgid"}, 
+  {"dup2","0x80,33,2,"}, 
+  {"0x80.68","msgget"}, 
+  {"dup3","0x80,292,3,"}, 
+  {"faccessat","0x80,269,3,"}, 
+  {"0x80.65","semop"}, 
+  {"0x80.258","mkdirat"}, 
+  {"0x80.64","semget"}, 
+  {"0x80.102","getuid"}, 
+  {"0x80.259","mknodat"}, 
+  {"0x80.67","shmdt"}, 
+  {"getgid","0x80,104,0,"}, 
+  {"0x80.103","syslog"}, 
+  {"0x80.66","semctl"}, 
+  {"exit","0x80,60,1,i"}, 
+  {"llistxattr","0x80,195,3,"}, 
+  {"0x80.100","times"}, 
+  {"0x80.61","wait4"}, 
+  {"eventfd","0x80,284,1,"}, 
+  {"0x80.101","ptrace"}, 
+  {"0x80.254","inotify_add_watch"}, 
+  {"clock_settime","0x80,227,2,"}, 
+  {"0x80.60","exit"}, 
+  {"0x80.106","setgid"}, 
+  {"sethostname","0x80,170,2,"}, 
+  {"0x80.255","inotify_rm_watch"}, 
+  {"0x80.63","uname"}, 
+  {"0x80.107","geteuid"}, 
+  {"0x80.256","migrate_pages"}, 
+  {"0x80.62","kill"}, 
+  {"lgetxattr","0x80,192,4,"}, 
+  {"0x80.104","getgid"}, 
+  {"0x80.257","openat"}, 
+  {"adjtimex","0x80,159,1,"}, 
+  {"0x80.105","setuid"}, 
+  {"0x80.250","keyctl"}, 
+  {"tuxcall","0x80,184,1,"}, 
+  {"0x80.251","ioprio_set"}, 
+  {"0x80.252","ioprio_get"}, 
+  {"0x80.253","inotify_init"}, 
+  {"get_kernel_syms","0x80,177,1,"}, 
+  {"getrlimit","0x80,97,2,"}, 
+  {"ioperm","0x80,173,3,"}, 
+  {"fgetxattr","0x80,193,4,"}, 
+  {"readahead","0x80,187,3,"}, 
+  {"0x80.139","sysfs"}, 
+  {"0x80.138","fstatfs"}, 
+  {"0x80.78","getdents"}, 
+  {"0x80.79","getcwd"}, 
+  {NULL, NULL}
+};
+// 0x55fc286f6170
+// TODO
+typedef int (*GperfForeachCallback)(void *user, const char *k, const char *v);
+int gperf_linux_x86_64_foreach(GperfForeachCallback cb, void *user) {
+  int i = 0; while (kvs[i].name) {
+  cb (user, kvs[i].name, kvs[i].value);
+  i++;}
+  return 0;
+}
+const char *gperf_linux_x86_64_get(const char *s) {
+  int i = 0; while (kvs[i].name) {
+  if (!strcmp (s, kvs[i].name)) return kvs[i].value;
+  i++;}
+  return NULL;
+}
+#define sdb_hash_c_linux_x86_64(x,y) gperf_linux_x86_64_hash(x)
+const unsigned int gperf_linux_x86_64_hash(const char *s) {
+  int sum = strlen (s);
+  while (*s) { sum += *s; s++; }
+  return sum;
+}
+struct {const char *name;void *get;void *hash;void *foreach;} gperf_linux_x86_64 = {
+  .name = "linux-x86-64",
+  .get = &gperf_linux_x86_64_get,
+  .hash = &gperf_linux_x86_64_hash,
+  .foreach = &gperf_linux_x86_64_foreach
+};
+
+#if MAIN
+int main () {
+	const char *s = ((char*(*)(char*))gperf_linux_x86_64.get)("foo");
+	printf ("%s\n", s);
+}
+#endif
@@ -0,0 +1,2494 @@
+// SDB-CGEN V1.9.4
+// gcc -DMAIN=1 windows_x86_32.c ; ./a.out > windows_x86_32.h
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+struct kv { const char *name; const char *value; };
+static const struct kv kvs[] = {
+  {"NtSetInformationFile","0x2e,0x0149,5,"}, 
+  {"NtGdiPolyDraw","0x2e,0x10f8,4,"}, 
+  {"0x2e.0x12f6","NtGdiDdDDIRender"}, 
+  {"NtUserManageGesturePluginWindow","0x2e,0x1295,2,"}, 
+  {"NtStopProfile","0x2e,0x016d,1,"}, 
+  {"NtQueueApcThread","0x2e,0x010d,5,"}, 
+  {"NtGdiCheckBitmapBits","0x2e,0x1010,8,"}, 
+  {"NtOpenEvent","0x2e,0x00b1,3,"}, 
+  {"NtGdiDdDDISetQueuedLimit","0x2e,0x130f,1,"}, 
+  {"NtGdiDdDDICheckVidPnExclusiveOwnership","0x2e,0x1320,1,"}, 
+  {"NtAccessCheck","0x2e,0x0001,8,"}, 
+  {"NtRollbackEnlistment","0x2e,0x0132,2,"}, 
+  {"NtUserGetImeInfoEx","0x2e,0x11ad,2,"}, 
+  {"NtUserSetWinEventHook","0x2e,0x124c,8,"}, 
+  {"NtUserCtxDisplayIOCtl","0x2e,0x127b,3,"}, 
+  {"NtQueryInformationPort","0x2e,0x00e9,5,"}, 
+  {"NtGdiCombineRgn","0x2e,0x1015,4,"}, 
+  {"NtUserUserPluginGrantAccess","0x2e,0x126c,3,"}, 
+  {"0x2e.0x128f","NtUserEndTouchOperation"}, 
+  {"0x2e.0x128e","NtUserSendTouchInput"}, 
+  {"0x2e.0x128d","NtUserIsTouchWindow"}, 
+  {"0x2e.0x128c","NtUserModifyWindowTouchCapability"}, 
+  {"0x2e.0x128b","NtUserSfmDestroyLogicalSurfaceBinding"}, 
+  {"0x2e.0x128a","NtUserSfmGetLogicalSurfaceBinding"}, 
+  {"NtWriteFileGather","0x2e,0x018d,9,"}, 
+  {"NtUserAlterWindowStyle","0x2e,0x113c,3,"}, 
+  {"NtCreateEnlistment","0x2e,0x003f,8,"}, 
+  {"NtUnloadDriver","0x2e,0x017b,1,"}, 
+  {"NtGdiGetBitmapDimension","0x2e,0x10a0,2,"}, 
+  {"NtGdiUpdateColors","0x2e,0x1138,1,"}, 
+  {"NtGdiSetPUMPDOBJ","0x2e,0x12d8,4,"}, 
+  {"0x2e.0x12d9","NtGdiBRUSHOBJ_DeleteRbrush"}, 
+  {"NtUserSetWindowStationUser","0x2e,0x124a,4,"}, 
+  {"0x2e.0x12d8","NtGdiSetPUMPDOBJ"}, 
+  {"0x2e.0x12d3","NtGdiGetDhpdev"}, 
+  {"0x2e.0x12d2","NtGdiPATHOBJ_bEnumClipLines"}, 
+  {"0x2e.0x12d1","NtGdiPATHOBJ_vEnumStartClipLines"}, 
+  {"0x2e.0x12d0","NtGdiPATHOBJ_vEnumStart"}, 
+  {"0x2e.0x12d7","NtGdiUpdateTransform"}, 
+  {"NtGdiGetDCObject","0x2e,0x10ae,2,"}, 
+  {"0x2e.0x12d6","NtGdiHT_Get8BPPMaskPalette"}, 
+  {"NtGdiCreateRoundRectRgn","0x2e,0x102d,6,"}, 
+  {"NtRollbackComplete","0x2e,0x0131,2,"}, 
+  {"0x2e.0x12d5","NtGdiHT_Get8BPPFormatPalette"}, 
+  {"0x2e.0x12d4","NtGdiEngCheckAbort"}, 
+  {"0x2e.0x129f","NtGdiEngDeletePalette"}, 
+  {"NtQueryKey","0x2e,0x00f4,5,"}, 
+  {"0x2e.0x129d","NtGdiEngComputeGlyphSet"}, 
+  {"0x2e.0x129e","NtGdiEngCopyBits"}, 
+  {"0x2e.0x129b","NtGdiEngCreateDeviceBitmap"}, 
+  {"0x2e.0x129c","NtGdiEngCreatePalette"}, 
+  {"0x2e.0x129a","NtGdiEngCreateDeviceSurface"}, 
+  {"0x2e.0x12be","NtGdiBRUSHOBJ_hGetColorTransform"}, 
+  {"0x2e.0x12bd","NtGdiBRUSHOBJ_pvGetRbrush"}, 
+  {"NtGdiD3dContextCreate","0x2e,0x1030,4,"}, 
+  {"NtGdiGetTextExtentExW","0x2e,0x10d7,8,"}, 
+  {"0x2e.0x12bf","NtGdiXFORMOBJ_bApplyXform"}, 
+  {"0x2e.0x12ba","NtGdiEngDeleteClip"}, 
+  {"NtSuspendThread","0x2e,0x016f,2,"}, 
+  {"0x2e.0x12bc","NtGdiBRUSHOBJ_pvAllocRbrush"}, 
+  {"0x2e.0x12bb","NtGdiBRUSHOBJ_ulGetBrushColor"}, 
+  {"NtGdiEnumFonts","0x2e,0x108a,8,"}, 
+  {"0x2e.0x12e8","NtGdiDdDDIDestroyContext"}, 
+  {"0x2e.0x12e9","NtGdiDdDDICreateSynchronizationObject"}, 
+  {"NtGdiBeginGdiRendering","0x2e,0x100c,2,"}, 
+  {"0x2e.0x12e2","NtGdiDdDDIDestroyAllocation"}, 
+  {"0x2e.0x12e3","NtGdiDdDDISetAllocationPriority"}, 
+  {"NtSaveKeyEx","0x2e,0x0136,3,"}, 
+  {"0x2e.0x12e0","NtGdiDdDDIQueryResourceInfo"}, 
+  {"NtGdiGetOutlineTextMetricsInternalW","0x2e,0x10c6,4,"}, 
+  {"0x2e.0x12e1","NtGdiDdDDIOpenResource"}, 
+  {"0x2e.0x12e6","NtGdiDdDDIDestroyDevice"}, 
+  {"NtGdiDdDDIAcquireKeyedMutex","0x2e,0x131c,1,"}, 
+  {"NtUserUpdateInstance","0x2e,0x1267,3,"}, 
+  {"NtUserIsTouchWindow","0x2e,0x128d,2,"}, 
+  {"0x2e.0x12e7","NtGdiDdDDICreateContext"}, 
+  {"NtGdiGetGlyphIndicesW","0x2e,0x10ba,5,"}, 
+  {"0x2e.0x12e4","NtGdiDdDDIQueryAllocationResidency"}, 
+  {"NtGdiGetSuggestedOPMProtectedOutputArraySize","0x2e,0x10d3,2,"}, 
+  {"0x2e.0x12e5","NtGdiDdDDICreateDevice"}, 
+  {"NtOpenKeyTransactedEx","0x2e,0x00ba,5,"}, 
+  {"NtTranslateFilePath","0x2e,0x0179,4,"}, 
+  {"NtUserSetSystemTimer","0x2e,0x1239,3,"}, 
+  {"0x2e.0x12cd","NtGdiSTROBJ_dwGetCodePage"}, 
+  {"0x2e.0x12ce","NtGdiPATHOBJ_vGetBounds"}, 
+  {"0x2e.0x12cf","NtGdiPATHOBJ_bEnum"}, 
+  {"0x2e.0x12ca","NtGdiSTROBJ_bEnumPositionsOnly"}, 
+  {"0x2e.0x12cb","NtGdiSTROBJ_bGetAdvanceWidths"}, 
+  {"0x2e.0x12cc","NtGdiSTROBJ_vEnumStart"}, 
+  {"0x2e.0x1287","NtUserSfmDxReportPendingBindingsToDwm"}, 
+  {"0x2e.0x1286","NtUserSfmDxQuerySwapChainBindingStatus"}, 
+  {"0x2e.0x1285","NtUserSfmDxSetSwapChainBindingStatus"}, 
+  {"NtGdiScaleViewportExtEx","0x2e,0x1109,6,"}, 
+  {"0x2e.0x1284","NtUserSfmDxReleaseSwapChain"}, 
+  {"0x2e.0x12b9","NtGdiEngCreateClip"}, 
+  {"0x2e.0x1283","NtUserSfmDxOpenSwapChain"}, 
+  {"0x2e.0x12b8","NtGdiEngDeletePath"}, 
+  {"NtUserDeferWindowPos","0x2e,0x116c,8,"}, 
+  {"0x2e.0x1282","NtUserSfmDxBindSwapChain"}, 
+  {"NtGdiEndPath","0x2e,0x1089,1,"}, 
+  {"0x2e.0x1281","NtUserGetWindowMinimizeRect"}, 
+  {"NtGdiDdDDICheckOcclusion","0x2e,0x1312,1,"}, 
+  {"0x2e.0x1280","NtUserDwmStopRedirection"}, 
+  {"0x2e.0x12b5","NtGdiCLIPOBJ_bEnum"}, 
+  {"0x2e.0x12b4","NtGdiXLATEOBJ_hGetColorTransform"}, 
+  {"0x2e.0x12b7","NtGdiCLIPOBJ_ppoGetPath"}, 
+  {"NtGdiEudcLoadUnloadLink","0x2e,0x108d,7,"}, 
+  {"0x2e.0x12b6","NtGdiCLIPOBJ_cEnumStart"}, 
+  {"NtGdiEnableEudc","0x2e,0x1085,1,"}, 
+  {"NtUserSendInput","0x2e,0x1218,3,"}, 
+  {"0x2e.0x12b1","NtGdiEngStretchBltROP"}, 
+  {"0x2e.0x12b0","NtGdiEngTextOut"}, 
+  {"0x2e.0x12b3","NtGdiXLATEOBJ_iXlate"}, 
+  {"0x2e.0x1289","NtUserSfmDxSetSwapChainStats"}, 
+  {"0x2e.0x12b2","NtGdiXLATEOBJ_cGetPalette"}, 
+  {"0x2e.0x1288","NtUserSfmDxGetSwapChainStats"}, 
+  {"NtSaveMergedKeys","0x2e,0x0137,3,"}, 
+  {"NtGdiGetLinkedUFIs","0x2e,0x10bf,3,"}, 
+  {"0x2e.0x12dc","NtGdiSfmGetNotificationTokens"}, 
+  {"0x2e.0x12db","NtGdiDrawStream"}, 
+  {"NtGdiDdDDIPresent","0x2e,0x12f5,1,"}, 
+  {"0x2e.0x12da","NtGdiUMPDEngFreeUserMem"}, 
+  {"NtReleaseSemaphore","0x2e,0x011d,3,"}, 
+  {"NtCreateTransactionManager","0x2e,0x005c,6,"}, 
+  {"0x2e.0x12df","NtGdiDdDDICreateAllocation"}, 
+  {"0x2e.0x12de","NtGdiHLSurfSetInformation"}, 
+  {"0x2e.0x12dd","NtGdiHLSurfGetInformation"}, 
+  {"NtGdiGetFontFileInfo","0x2e,0x10b8,5,"}, 
+  {"NtGdiDdDDILock","0x2e,0x12f0,1,"}, 
+  {"0x2e.0x1296","NtUserSetGestureConfig"}, 
+  {"NtQueryInformationWorkerFactory","0x2e,0x00f0,5,"}, 
+  {"0x2e.0x1297","NtUserGetGestureConfig"}, 
+  {"0x2e.0x1294","NtUserGetGestureExtArgs"}, 
+  {"0x2e.0x1295","NtUserManageGesturePluginWindow"}, 
+  {"0x2e.0x12c8","NtGdiFONTOBJ_cGetAllGlyphPlugins"}, 
+  {"0x2e.0x1292","NtUserInjectGesture"}, 
+  {"0x2e.0x12c9","NtGdiSTROBJ_bEnum"}, 
+  {"NtGdiBRUSHOBJ_pvAllocRbrush","0x2e,0x12bc,2,"}, 
+  {"0x2e.0x1293","NtUserGetGestureInfo"}, 
+  {"0x2e.0x1290","NtUserGetTouchInputInfo"}, 
+  {"0x2e.0x12c4","NtGdiFONTOBJ_pifi"}, 
+  {"NtDebugContinue","0x2e,0x0061,3,"}, 
+  {"0x2e.0x1291","NtUserChangeWindowMessageFilterEx"}, 
+  {"0x2e.0x12c5","NtGdiFONTOBJ_pfdg"}, 
+  {"NtGdiXLATEOBJ_hGetColorTransform","0x2e,0x12b4,1,"}, 
+  {"0x2e.0x12c6","NtGdiFONTOBJ_pQueryGlyphAttrs"}, 
+  {"0x2e.0x12c7","NtGdiFONTOBJ_pvTrueTypeFontFile"}, 
+  {"0x2e.0x12c0","NtGdiXFORMOBJ_iGetXform"}, 
+  {"NtUserSetImeInfoEx","0x2e,0x1226,1,"}, 
+  {"0x2e.0x12c1","NtGdiFONTOBJ_vGetInfo"}, 
+  {"0x2e.0x12c2","NtGdiFONTOBJ_pxoGetXform"}, 
+  {"0x2e.0x12c3","NtGdiFONTOBJ_cGetGlyphs"}, 
+  {"NtEnumerateValueKey","0x2e,0x0077,6,"}, 
+  {"0x2e.0x1298","NtGdiEngAssociateSurface"}, 
+  {"NtGdiDvpReleaseNotification","0x2e,0x1078,2,"}, 
+  {"0x2e.0x1299","NtGdiEngCreateBitmap"}, 
+  {"NtUserGetWindowPlacement","0x2e,0x11d1,2,"}, 
+  {"NtGdiFONTOBJ_pifi","0x2e,0x12c4,1,"}, 
+  {"NtUserGetAsyncKeyState","0x2e,0x1192,1,"}, 
+  {"0x2e.0x12eb","NtGdiDdDDIDestroySynchronizationObject"}, 
+  {"0x2e.0x12ec","NtGdiDdDDIWaitForSynchronizationObject"}, 
+  {"0x2e.0x124c","NtUserSetWinEventHook"}, 
+  {"0x2e.0x124b","NtUserSetWindowWord"}, 
+  {"NtGdiStrokePath","0x2e,0x1131,1,"}, 
+  {"0x2e.0x12ea","NtGdiDdDDIOpenSynchronizationObject"}, 
+  {"0x2e.0x124a","NtUserSetWindowStationUser"}, 
+  {"0x2e.0x12ef","NtGdiDdDDIQueryAdapterInfo"}, 
+  {"NtGdiD3dContextDestroyAll","0x2e,0x1032,1,"}, 
+  {"0x2e.0x12ed","NtGdiDdDDISignalSynchronizationObject"}, 
+  {"0x2e.0x124f","NtUserShowWindow"}, 
+  {"0x2e.0x12ee","NtGdiDdDDIGetRuntimeData"}, 
+  {"0x2e.0x124e","NtUserShowScrollBar"}, 
+  {"0x2e.0x124d","NtUserShowCaret"}, 
+  {"NtGdiDdAttachSurface","0x2e,0x1038,2,"}, 
+  {"0x2e.0x1269","NtUserGetLayeredWindowAttributes"}, 
+  {"NtGdiEngCreateDeviceSurface","0x2e,0x129a,4,"}, 
+  {"0x2e.0x1268","NtUserUpdateLayeredWindow"}, 
+  {"NtUserConsoleControl","0x2e,0x1160,3,"}, 
+  {"NtUserShowCaret","0x2e,0x124d,1,"}, 
+  {"NtGdiExcludeClipRect","0x2e,0x108e,5,"}, 
+  {"NtSetEaFile","0x2e,0x0142,4,"}, 
+  {"0x2e.0x1261","NtUserUnloadKeyboardLayout"}, 
+  {"0x2e.0x1260","NtUserUnhookWinEvent"}, 
+  {"0x2e.0x1263","NtUserUnregisterClass"}, 
+  {"0x2e.0x1262","NtUserUnlockWindowStation"}, 
+  {"NtWaitLowEventPair","0x2e,0x018a,1,"}, 
+  {"0x2e.0x1265","NtUserUnregisterHotKey"}, 
+  {"0x2e.0x1264","NtUserUnregisterUserApiHook"}, 
+  {"0x2e.0x1267","NtUserUpdateInstance"}, 
+  {"0x2e.0x1266","NtUserUpdateInputContext"}, 
+  {"NtUserHardErrorControl","0x2e,0x11d4,3,"}, 
+  {"0x2e.0x125b","NtUserCalcMenuBar"}, 
+  {"0x2e.0x125c","NtUserPaintMenuBar"}, 
+  {"0x2e.0x125a","NtUserCalculatePopupWindowPosition"}, 
+  {"NtGdiSetOPMSigningKeyAndSequenceNumbers","0x2e,0x1124,2,"}, 
+  {"0x2e.0x125f","NtUserUnhookWindowsHookEx"}, 
+  {"NtUserGetTopLevelWindow","0x2e,0x11c9,1,"}, 
+  {"NtSetHighWaitLowEventPair","0x2e,0x0146,1,"}, 
+  {"0x2e.0x125d","NtUserTranslateAccelerator"}, 
+  {"0x2e.0x125e","NtUserTranslateMessage"}, 
+  {"NtUserCheckAccessForIntegrityLevel","0x2e,0x1157,3,"}, 
+  {"NtUserSetWindowFNID","0x2e,0x1241,2,"}, 
+  {"0x2e.0x1278","NtUserRemoteRedrawRectangle"}, 
+  {"NtGdiDDCCIGetTimingReport","0x2e,0x132d,2,"}, 
+  {"0x2e.0x1279","NtUserRemoteRedrawScreen"}, 
+  {"NtGdiGetBoundsRect","0x2e,0x10a1,3,"}, 
+  {"0x2e.0x12a8","NtGdiEngStrokePath"}, 
+  {"0x2e.0x12a9","NtGdiEngFillPath"}, 
+  {"NtUserGetCursorFrameInfo","0x2e,0x11a2,4,"}, 
+  {"0x2e.0x12a6","NtGdiEngPlgBlt"}, 
+  {"0x2e.0x12a7","NtGdiEngMarkBandingSurface"}, 
+  {"0x2e.0x1270","NtUserVkKeyScanEx"}, 
+  {"0x2e.0x12a4","NtGdiEngBitBlt"}, 
+  {"0x2e.0x1271","NtUserWaitForInputIdle"}, 
+  {"0x2e.0x12a5","NtGdiEngStretchBlt"}, 
+  {"NtFlushVirtualMemory","0x2e,0x0080,4,"}, 
+  {"NtGdiEngStretchBlt","0x2e,0x12a5,11,"}, 
+  {"0x2e.0x1272","NtUserWaitForMsgAndEvent"}, 
+  {"0x2e.0x12a2","NtGdiEngUnlockSurface"}, 
+  {"NtUserOpenInputDesktop","0x2e,0x11f5,3,"}, 
+  {"0x2e.0x1273","NtUserWaitMessage"}, 
+  {"0x2e.0x12a3","NtGdiEngLockSurface"}, 
+  {"0x2e.0x1274","NtUserWindowFromPhysicalPoint"}, 
+  {"0x2e.0x12a0","NtGdiEngDeleteSurface"}, 
+  {"0x2e.0x1275","NtUserWindowFromPoint"}, 
+  {"0x2e.0x12a1","NtGdiEngEraseSurface"}, 
+  {"0x2e.0x1276","NtUserYieldTask"}, 
+  {"0x2e.0x1277","NtUserRemoteConnect"}, 
+  {"NtGdiPATHOBJ_vEnumStart","0x2e,0x12d0,1,"}, 
+  {"NtUserDrawIconEx","0x2e,0x117d,11,"}, 
+  {"NtReadFile","0x2e,0x0111,9,"}, 
+  {"0x2e.0x126a","NtUserSetLayeredWindowAttributes"}, 
+  {"NtUserInvalidateRgn","0x2e,0x11df,3,"}, 
+  {"NtCreatePort","0x2e,0x004d,5,"}, 
+  {"0x2e.0x126c","NtUserUserPluginGrantAccess"}, 
+  {"0x2e.0x126b","NtUserUpdatePerUserSystemParameters"}, 
+  {"NtUserWaitForInputIdle","0x2e,0x1271,3,"}, 
+  {"0x2e.0x126e","NtUserValidateRect"}, 
+  {"0x2e.0x126d","NtUserValidatePluginSecure"}, 
+  {"NtSetInformationThread","0x2e,0x014f,4,"}, 
+  {"0x2e.0x126f","NtUserValidateTimerCallback"}, 
+  {"NtUserCreateWindowEx","0x2e,0x1169,15,"}, 
+  {"NtAccessCheckByTypeAndAuditAlarm","0x2e,0x0004,16,"}, 
+  {"0x2e.0x1249","NtUserSetWindowsHookEx"}, 
+  {"0x2e.0x1248","NtUserSetWindowsHookAW"}, 
+  {"0x2e.0x1243","NtUserSetWindowPlacement"}, 
+  {"NtGdiDdGetMoCompFormats","0x2e,0x1054,2,"}, 
+  {"NtGdiGetCertificate","0x2e,0x10a2,4,"}, 
+  {"0x2e.0x1242","NtUserSetWindowLong"}, 
+  {"0x2e.0x1241","NtUserSetWindowFNID"}, 
+  {"0x2e.0x1240","NtUserSetWindowDisplayAffinity"}, 
+  {"NtCreateThread","0x2e,0x0057,8,"}, 
+  {"0x2e.0x1247","NtUserSetWindowRgnEx"}, 
+  {"NtQueryInformationToken","0x2e,0x00ed,5,"}, 
+  {"0x2e.0x1246","NtUserGetWindowRgnEx"}, 
+  {"0x2e.0x1245","NtUserSetWindowRgn"}, 
+  {"0x2e.0x1244","NtUserSetWindowPos"}, 
+  {"NtReleaseWorkerFactoryWorker","0x2e,0x011e,1,"}, 
+  {"NtUserTrackMouseEvent","0x2e,0x1258,1,"}, 
+  {"NtCreateWorkerFactory","0x2e,0x005f,10,"}, 
+  {"NtSetBootEntryOrder","0x2e,0x013a,2,"}, 
+  {"NtUserBeginPaint","0x2e,0x113f,2,"}, 
+  {"NtGdiGetCharWidthInfo","0x2e,0x10a8,2,"}, 
+  {"NtUserGetComboBoxInfo","0x2e,0x119e,2,"}, 
+  {"NtGdiDdGetDxPlugin","0x2e,0x104f,3,"}, 
+  {"NtUserGetAncestor","0x2e,0x1190,2,"}, 
+  {"0x2e.0x127a","NtUserRemoteStopScreenUpdates"}, 
+  {"0x2e.0x127b","NtUserCtxDisplayIOCtl"}, 
+  {"NtGdiCLIPOBJ_cEnumStart","0x2e,0x12b6,5,"}, 
+  {"0x2e.0x127c","NtUserRegisterSessionPort"}, 
+  {"NtUserSetChildWindowNoActivate","0x2e,0x121c,1,"}, 
+  {"0x2e.0x127d","NtUserUnregisterSessionPort"}, 
+  {"0x2e.0x127e","NtUserUpdateWindowTransform"}, 
+  {"NtGdiDdDDIOpenSynchronizationObject","0x2e,0x12ea,1,"}, 
+  {"0x2e.0x127f","NtUserDwmStartRedirection"}, 
+  {"NtUserKillTimer","0x2e,0x11e2,2,"}, 
+  {"0x2e.0x11d8","NtUserImpersonateDdeClientWindow"}, 
+  {"0x2e.0x11d9","NtUserInitialize"}, 
+  {"0x2e.0x1258","NtUserTrackMouseEvent"}, 
+  {"0x2e.0x1259","NtUserTrackPopupMenuEx"}, 
+  {"NtGdiCreateColorSpace","0x2e,0x101d,1,"}, 
+  {"NtQueryMultipleValueKey","0x2e,0x00f6,6,"}, 
+  {"0x2e.0x1252","NtUserSwitchDesktop"}, 
+  {"NtGdiDvpWaitForVideoPortSync","0x2e,0x1076,2,"}, 
+  {"NtUserGetControlColor","0x2e,0x11a0,4,"}, 
+  {"0x2e.0x11d0","NtUserGetWindowDisplayAffinity"}, 
+  {"0x2e.0x1253","NtUserSystemParametersInfo"}, 
+  {"NtGdiDvpUpdateVideoPort","0x2e,0x1075,4,"}, 
+  {"0x2e.0x11d1","NtUserGetWindowPlacement"}, 
+  {"NtGdiGetDeviceCaps","0x2e,0x10b0,2,"}, 
+  {"0x2e.0x1250","NtUserShowWindowAsync"}, 
+  {"NtSetInformationEnlistment","0x2e,0x0148,4,"}, 
+  {"0x2e.0x11d2","NtUserGetWOWClass"}, 
+  {"0x2e.0x1251","NtUserSoundSentry"}, 
+  {"0x2e.0x11d3","NtUserGhostWindowFromHungWindow"}, 
+  {"0x2e.0x1256","NtUserThunkedMenuItemInfo"}, 
+  {"0x2e.0x11d4","NtUserHardErrorControl"}, 
+  {"0x2e.0x1257","NtUserToUnicodeEx"}, 
+  {"NtGetDevicePowerState","0x2e,0x0089,2,"}, 
+  {"0x2e.0x11d5","NtUserHideCaret"}, 
+  {"NtQueryInformationFile","0x2e,0x00e7,5,"}, 
+  {"NtGdiModifyWorldTransform","0x2e,0x10ee,3,"}, 
+  {"0x2e.0x1254","NtUserTestForInteractiveUser"}, 
+  {"0x2e.0x11d6","NtUserHiliteMenuItem"}, 
+  {"0x2e.0x1255","NtUserThunkedMenuInfo"}, 
+  {"0x2e.0x11d7","NtUserHungWindowFromGhostWindow"}, 
+  {"NtGdiCreateRectRgn","0x2e,0x102c,4,"}, 
+  {"NtUserGetClipboardSequenceNumber","0x2e,0x119b,0,"}, 
+  {"NtUserGetUpdateRect","0x2e,0x11cb,3,"}, 
+  {"NtGdiPolyPolyDraw","0x2e,0x10f9,5,"}, 
+  {"NtUserGetPriorityClipboardFormat","0x2e,0x11bd,2,"}, 
+  {"0x2e.0x12af","NtGdiEngTransparentBlt"}, 
+  {"NtUserMoveWindow","0x2e,0x11ef,6,"}, 
+  {"0x2e.0x12ad","NtGdiEngAlphaBlend"}, 
+  {"0x2e.0x11fb","NtUserPhysicalToLogicalPoint"}, 
+  {"0x2e.0x120f","NtUserRegisterWindowMessage"}, 
+  {"0x2e.0x12ae","NtGdiEngGradientFill"}, 
+  {"0x2e.0x11fc","NtUserPostMessage"}, 
+  {"NtUserFindExistingCursorIcon","0x2e,0x118b,3,"}, 
+  {"0x2e.0x120e","NtUserRegisterTasklist"}, 
+  {"0x2e.0x12ab","NtGdiEngPaint"}, 
+  {"0x2e.0x120d","NtUserRegisterServicesProcess"}, 
+  {"0x2e.0x12ac","NtGdiEngLineTo"}, 
+  {"NtGdiSetVirtualResolution","0x2e,0x112a,5,"}, 
+  {"NtTerminateProcess","0x2e,0x0172,2,"}, 
+  {"0x2e.0x11fa","NtUserPeekMessage"}, 
+  {"0x2e.0x120c","NtUserRegisterRawInputDevices"}, 
+  {"0x2e.0x11ff","NtUserProcessConnect"}, 
+  {"0x2e.0x120b","NtUserRegisterHotKey"}, 
+  {"0x2e.0x12aa","NtGdiEngStrokeAndFillPath"}, 
+  {"0x2e.0x120a","NtUserRegisterUserApiHook"}, 
+  {"NtSaveKey","0x2e,0x0135,2,"}, 
+  {"0x2e.0x11fd","NtUserPostThreadMessage"}, 
+  {"0x2e.0x11fe","NtUserPrintWindow"}, 
+  {"0x2e.0x1229","NtUserSetInternalWindowPos"}, 
+  {"NtPulseEvent","0x2e,0x00d8,2,"}, 
+  {"NtUserEndPaint","0x2e,0x1184,2,"}, 
+  {"0x2e.0x1228","NtUserSetInformationThread"}, 
+  {"NtGdiHLSurfSetInformation","0x2e,0x12de,4,"}, 
+  {"0x2e.0x1225","NtUserSetImeHotKey"}, 
+  {"NtMakeTemporaryObject","0x2e,0x00a4,1,"}, 
+  {"NtPrePrepareEnlistment","0x2e,0x00d1,2,"}, 
+  {"0x2e.0x1224","NtUserSetFocus"}, 
+  {"NtGdiDestroyOPMProtectedOutput","0x2e,0x107f,1,"}, 
+  {"bInitRedirDev","0x2e,0x10e6,0,"}, 
+  {"0x2e.0x1227","NtUserSetImeOwnerWindow"}, 
+  {"NtSecureConnectPort","0x2e,0x0138,9,"}, 
+  {"0x2e.0x1226","NtUserSetImeInfoEx"}, 
+  {"0x2e.0x1221","NtUserSetCursor"}, 
+  {"NtGdiGetOPMRandomNumber","0x2e,0x10c5,2,"}, 
+  {"NtUserSetSystemCursor","0x2e,0x1237,2,"}, 
+  {"0x2e.0x1220","NtUserSetClipboardViewer"}, 
+  {"0x2e.0x1223","NtUserSetCursorIconData"}, 
+  {"0x2e.0x1222","NtUserSetCursorContents"}, 
+  {"NtGdiDdSetOverlayPosition","0x2e,0x1062,3,"}, 
+  {"NtUserPrintWindow","0x2e,0x11fe,3,"}, 
+  {"NtCreateKeyedEvent","0x2e,0x0047,4,"}, 
+  {"NtGdiDdFlip","0x2e,0x1049,5,"}, 
+  {"0x2e.0x121f","NtUserSetClipboardData"}, 
+  {"NtUserCallTwoParam","0x2e,0x114f,3,"}, 
+  {"0x2e.0x11ea","NtUserMessageCall"}, 
+  {"0x2e.0x121d","NtUserSetClassLong"}, 
+  {"NtUserTestForInteractiveUser","0x2e,0x1254,1,"}, 
+  {"NtEnableLastKnownGood","0x2e,0x0071,0,"}, 
+  {"0x2e.0x11ec","NtUserMNDragLeave"}, 
+  {"0x2e.0x121e","NtUserSetClassWord"}, 
+  {"NtGetNotificationResourceManager","0x2e,0x008e,7,"}, 
+  {"NtSetEvent","0x2e,0x0143,2,"}, 
+  {"0x2e.0x11eb","NtUserMinMaximize"}, 
+  {"0x2e.0x121b","NtUserSetCapture"}, 
+  {"0x2e.0x11ee","NtUserModifyUserStartupInfoFlags"}, 
+  {"0x2e.0x121c","NtUserSetChildWindowNoActivate"}, 
+  {"0x2e.0x11ed","NtUserMNDragOver"}, 
+  {"0x2e.0x121a","NtUserSetAppImeLevel"}, 
+  {"0x2e.0x11ef","NtUserMoveWindow"}, 
+  {"NtAccessCheckByTypeResultListAndAuditAlarm","0x2e,0x0006,16,"}, 
+  {"0x2e.0x11f8","NtUserPaintDesktop"}, 
+  {"0x2e.0x11f9","NtUserPaintMonitor"}, 
+  {"0x2e.0x1238","NtUserSetSystemMenu"}, 
+  {"0x2e.0x1239","NtUserSetSystemTimer"}, 
+  {"NtUserMagControl","0x2e,0x1334,2,"}, 
+  {"0x2e.0x1234","NtUserSetScrollInfo"}, 
+  {"0x2e.0x11f2","NtUserNotifyWinEvent"}, 
+  {"0x2e.0x1235","NtUserSetShellWindowEx"}, 
+  {"0x2e.0x11f3","NtUserOpenClipboard"}, 
+  {"0x2e.0x1236","NtUserSetSysColors"}, 
+  {"0x2e.0x11f0","NtUserNotifyIMEStatus"}, 
+  {"0x2e.0x1237","NtUserSetSystemCursor"}, 
+  {"0x2e.0x11f1","NtUserNotifyProcessCreate"}, 
+  {"0x2e.0x1230","NtUserSetParent"}, 
+  {"NtUserSoundSentry","0x2e,0x1251,0,"}, 
+  {"0x2e.0x11f6","NtUserOpenThreadDesktop"}, 
+  {"NtUserSetWindowPlacement","0x2e,0x1243,2,"}, 
+  {"0x2e.0x1231","NtUserSetProcessWindowStation"}, 
+  {"0x2e.0x11f7","NtUserOpenWindowStation"}, 
+  {"0x2e.0x1232","NtUserGetProp"}, 
+  {"0x2e.0x11f4","NtUserOpenDesktop"}, 
+  {"0x2e.0x1233","NtUserSetProp"}, 
+  {"0x2e.0x11f5","NtUserOpenInputDesktop"}, 
+  {"NtCommitComplete","0x2e,0x0034,2,"}, 
+  {"NtGdiColorCorrectPalette","0x2e,0x1014,6,"}, 
+  {"NtUserDestroyWindow","0x2e,0x1173,1,"}, 
+  {"NtGdiSetBoundsRect","0x2e,0x1113,3,"}, 
+  {"NtGdiStretchBlt","0x2e,0x112e,12,"}, 
+  {"0x2e.0x122e","NtUserSetMenuFlagRtoL"}, 
+  {"0x2e.0x122d","NtUserSetMenuDefaultItem"}, 
+  {"0x2e.0x11da","NtUserInitializeClientPfnArrays"}, 
+  {"0x2e.0x11db","NtUserInitTask"}, 
+  {"0x2e.0x122f","NtUserSetObjectInformation"}, 
+  {"0x2e.0x11dc","NtUserInternalGetWindowText"}, 
+  {"0x2e.0x122a","NtUserSetKeyboardState"}, 
+  {"0x2e.0x11dd","NtUserInternalGetWindowIcon"}, 
+  {"0x2e.0x11de","NtUserInvalidateRect"}, 
+  {"0x2e.0x122c","NtUserSetMenuContextHelpId"}, 
+  {"0x2e.0x11df","NtUserInvalidateRgn"}, 
+  {"0x2e.0x122b","NtUserSetMenu"}, 
+  {"NtGdiBRUSHOBJ_DeleteRbrush","0x2e,0x12d9,2,"}, 
+  {"NtQuerySystemTime","0x2e,0x0107,1,"}, 
+  {"0x2e.0x11e9","NtUserMenuItemFromPoint"}, 
+  {"0x2e.0x11e8","NtUserMapVirtualKeyEx"}, 
+  {"NtGdiMonoBitmap","0x2e,0x10ef,1,"}, 
+  {"NtUserModifyUserStartupInfoFlags","0x2e,0x11ee,2,"}, 
+  {"0x2e.0x1209","NtUserRegisterErrorReportingDialog"}, 
+  {"NtAccessCheckByType","0x2e,0x0003,11,"}, 
+  {"0x2e.0x1208","NtUserRegisterClassExWOW"}, 
+  {"0x2e.0x1207","NtUserRedrawWindow"}, 
+  {"0x2e.0x11e1","NtUserIsTopLevelWindow"}, 
+  {"0x2e.0x1206","NtUserRealWaitMessageEx"}, 
+  {"0x2e.0x11e0","NtUserIsClipboardFormatAvailable"}, 
+  {"0x2e.0x1205","NtUserRealInternalGetMessage"}, 
+  {"NtGdiSetSizeDevice","0x2e,0x112b,3,"}, 
+  {"0x2e.0x11e3","NtUserLoadKeyboardLayoutEx"}, 
+  {"0x2e.0x1204","NtUserRealChildWindowFromPoint"}, 
+  {"0x2e.0x11e2","NtUserKillTimer"}, 
+  {"0x2e.0x1203","NtUserQueryWindow"}, 
+  {"0x2e.0x11e5","NtUserLockWindowUpdate"}, 
+  {"0x2e.0x1202","NtUserQuerySendMessage"}, 
+  {"0x2e.0x11e4","NtUserLockWindowStation"}, 
+  {"0x2e.0x1201","NtUserQueryInputContext"}, 
+  {"0x2e.0x11e7","NtUserLogicalToPhysicalPoint"}, 
+  {"0x2e.0x1200","NtUserQueryInformationThread"}, 
+  {"0x2e.0x11e6","NtUserLockWorkStation"}, 
+  {"NtUserGetGuiResources","0x2e,0x11a8,2,"}, 
+  {"NtQueryPortInformationProcess","0x2e,0x00fc,0,"}, 
+  {"NtGdiD3dContextDestroy","0x2e,0x1031,1,"}, 
+  {"NtGdiDdDestroyMoComp","0x2e,0x1045,2,"}, 
+  {"NtGdiDdDDISetDisplayPrivateDriverFormat","0x2e,0x1316,1,"}, 
+  {"0x2e.0x123d","NtUserSetTimer"}, 
+  {"0x2e.0x123e","NtUserSetProcessDPIAware"}, 
+  {"0x2e.0x123f","NtUserSetWindowCompositionAttribute"}, 
+  {"NtGdiIntersectClipRect","0x2e,0x10e8,5,"}, 
+  {"NtGdiDdDDIInvalidateActiveVidPn","0x2e,0x1311,1,"}, 
+  {"NtUserFindWindowEx","0x2e,0x118c,5,"}, 
+  {"0x2e.0x123a","NtUserSetThreadDesktop"}, 
+  {"NtGdiDdDDICreateAllocation","0x2e,0x12df,1,"}, 
+  {"NtUserRegisterServicesProcess","0x2e,0x120d,1,"}, 
+  {"0x2e.0x123b","NtUserSetThreadLayoutPlugins"}, 
+  {"0x2e.0x123c","NtUserSetThreadState"}, 
+  {"NtUserDragObject","0x2e,0x1179,5,"}, 
+  {"NtGdiDdDestroyFullscreenSprite","0x2e,0x1330,2,"}, 
+  {"NtUserGetCursorInfo","0x2e,0x11a3,1,"}, 
+  {"0x2e.0x1218","NtUserSendInput"}, 
+  {"0x2e.0x1219","NtUserSetActiveWindow"}, 
+  {"0x2e.0x1216","NtUserScrollWindowEx"}, 
+  {"0x2e.0x1217","NtUserSelectPalette"}, 
+  {"NtUserGetMenuIndex","0x2e,0x11b7,2,"}, 
+  {"0x2e.0x1214","NtUserSBGetParms"}, 
+  {"0x2e.0x1215","NtUserScrollDC"}, 
+  {"NtGdiRoundRect","0x2e,0x1107,7,"}, 
+  {"0x2e.0x1212","NtUserRemoveProp"}, 
+  {"0x2e.0x1213","NtUserResolveDesktopForWOW"}, 
+  {"0x2e.0x1210","NtUserRemoveClipboardFormatListener"}, 
+  {"0x2e.0x1211","NtUserRemoveMenu"}, 
+  {"NtWriteFile","0x2e,0x018c,9,"}, 
+  {"NtUserDestroyCursor","0x2e,0x1170,2,"}, 
+  {"NtQuerySystemInformationEx","0x2e,0x0106,6,"}, 
+  {"NtUserSetLayeredWindowAttributes","0x2e,0x126a,4,"}, 
+  {"0x2e.0x11bf","NtUserGetRawInputBuffer"}, 
+  {"NtGdiGetAppClipBox","0x2e,0x109e,2,"}, 
+  {"0x2e.0x11bd","NtUserGetPriorityClipboardFormat"}, 
+  {"NtUserCreateDesktopEx","0x2e,0x1166,6,"}, 
+  {"0x2e.0x11be","NtUserGetProcessWindowStation"}, 
+  {"0x2e.0x11bb","NtUserGetObjectInformation"}, 
+  {"0x2e.0x11bc","NtUserGetOpenClipboardWindow"}, 
+  {"NtUserRegisterHotKey","0x2e,0x120b,4,"}, 
+  {"0x2e.0x11ba","NtUserGetMouseMovePointsEx"}, 
+  {"NtReplacePartitionUnit","0x2e,0x0125,3,"}, 
+  {"NtSetInformationObject","0x2e,0x014c,4,"}, 
+  {"NtResetWriteWatch","0x2e,0x012d,3,"}, 
+  {"NtUserGetClipboardData","0x2e,0x1198,2,"}, 
+  {"NtFsControlFile","0x2e,0x0086,10,"}, 
+  {"NtOpenSemaphore","0x2e,0x00c3,3,"}, 
+  {"NtAlpcDeletePortSection","0x2e,0x001c,3,"}, 
+  {"NtUserProcessConnect","0x2e,0x11ff,2,"}, 
+  {"NtGdiAnyLinkedFonts","0x2e,0x1009,0,"}, 
+  {"NtDelayExecution","0x2e,0x0062,2,"}, 
+  {"NtGdiPolyTextOutW","0x2e,0x10fa,4,"}, 
+  {"NtUserSetSystemMenu","0x2e,0x1238,2,"}, 
+  {"NtReadOnlyEnlistment","0x2e,0x0113,2,"}, 
+  {"0x2e.0x11ae","NtUserGetInputLocaleInfo"}, 
+  {"0x2e.0x11ad","NtUserGetImeInfoEx"}, 
+  {"NtThawRegistry","0x2e,0x0175,0,"}, 
+  {"NtRaiseHardError","0x2e,0x0110,6,"}, 
+  {"0x2e.0x11af","NtUserGetInternalWindowPos"}, 
+  {"NtGdiDdColorControl","0x2e,0x103d,2,"}, 
+  {"0x2e.0x11aa","NtUserGetIconInfo"}, 
+  {"0x2e.0x11ac","NtUserGetImeHotKey"}, 
+  {"NtGdiAddRemoteMMInstanceToDC","0x2e,0x1006,3,"}, 
+  {"NtOpenTransaction","0x2e,0x00ca,5,"}, 
+  {"0x2e.0x11ab","NtUserGetIconSize"}, 
+  {"NtOpenEventPair","0x2e,0x00b2,3,"}, 
+  {"0x2e.0x11b8","NtUserGetMenuItemRect"}, 
+  {"NtRenameTransactionManager","0x2e,0x0123,2,"}, 
+  {"0x2e.0x11b9","NtUserGetMessage"}, 
+  {"0x2e.0x11b6","NtUserGetMenuBarInfo"}, 
+  {"0x2e.0x11b7","NtUserGetMenuIndex"}, 
+  {"0x2e.0x11b4","NtUserGetKeyState"}, 
+  {"NtDeleteObjectAuditAlarm","0x2e,0x0068,3,"}, 
+  {"0x2e.0x11b5","NtUserGetListBoxInfo"}, 
+  {"NtGdiDvpDestroyVideoPort","0x2e,0x106b,2,"}, 
+  {"NtReleaseKeyedEvent","0x2e,0x011b,4,"}, 
+  {"NtImpersonateClientOfPort","0x2e,0x0092,2,"}, 
+  {"0x2e.0x11b2","NtUserGetKeyboardState"}, 
+  {"0x2e.0x11b3","NtUserGetKeyNameText"}, 
+  {"NtRemoveIoCompletionEx","0x2e,0x0120,6,"}, 
+  {"0x2e.0x11b0","NtUserGetKeyboardLayoutList"}, 
+  {"NtQueryIntervalProfile","0x2e,0x00f2,2,"}, 
+  {"0x2e.0x11b1","NtUserGetKeyboardLayoutName"}, 
+  {"NtCreateKey","0x2e,0x0046,7,"}, 
+  {"NtGdiDdDDIGetProcessSchedulingPriorityClass","0x2e,0x130c,2,"}, 
+  {"NtUserQueryInputContext","0x2e,0x1201,2,"}, 
+  {"NtQueryDebugFilterState","0x2e,0x00dc,2,"}, 
+  {"NtGdiEngComputeGlyphSet","0x2e,0x129d,3,"}, 
+  {"NtUserMagGetContextInformation","0x2e,0x1336,4,"}, 
+  {"NtUserSetClassLong","0x2e,0x121d,4,"}, 
+  {"NtUserDrawAnimatedRects","0x2e,0x117a,4,"}, 
+  {"0x2e.0x11a9","NtUserGetGUIThreadInfo"}, 
+  {"NtGdiGetMonitorID","0x2e,0x10c1,3,"}, 
+  {"0x2e.0x11a8","NtUserGetGuiResources"}, 
+  {"NtGdiDdDDIOpenAdapterFromHdc","0x2e,0x12f8,1,"}, 
+  {"0x2e.0x11a5","NtUserGetDCEx"}, 
+  {"NtGdiDdDDIQueryResourceInfo","0x2e,0x12e0,1,"}, 
+  {"0x2e.0x11a4","NtUserGetDC"}, 
+  {"NtGdiGetUFIPathname","0x2e,0x10dd,10,"}, 
+  {"0x2e.0x11a7","NtUserGetForegroundWindow"}, 
+  {"NtGdiDdDDIWaitForSynchronizationObject","0x2e,0x12ec,1,"}, 
+  {"NtWaitForDebugEvent","0x2e,0x0183,4,"}, 
+  {"0x2e.0x11a6","NtUserGetDoubleClickTime"}, 
+  {"NtAlpcImpersonateClientOfPort","0x2e,0x0021,3,"}, 
+  {"0x2e.0x11a1","NtUserGetCPD"}, 
+  {"0x2e.0x11a0","NtUserGetControlColor"}, 
+  {"0x2e.0x11a3","NtUserGetCursorInfo"}, 
+  {"0x2e.0x11a2","NtUserGetCursorFrameInfo"}, 
+  {"NtAlertThread","0x2e,0x000e,1,"}, 
+  {"NtRaiseException","0x2e,0x010f,3,"}, 
+  {"NtGdiDvpGetVideoPortOutputFormats","0x2e,0x1072,2,"}, 
+  {"NtGdiBRUSHOBJ_hGetColorTransform","0x2e,0x12be,1,"}, 
+  {"NtGdiMakeFontDir","0x2e,0x10eb,5,"}, 
+  {"NtGdiDdDDICheckExclusiveOwnership","0x2e,0x1315,0,"}, 
+  {"NtGdiGetTransform","0x2e,0x10da,3,"}, 
+  {"NtGdiSetLayout","0x2e,0x1123,3,"}, 
+  {"NtGdiDdBlt","0x2e,0x103a,3,"}, 
+  {"NtUserSetWindowPos","0x2e,0x1244,7,"}, 
+  {"NtCreateProcess","0x2e,0x004f,8,"}, 
+  {"NtSetInformationTransactionManager","0x2e,0x0152,4,"}, 
+  {"NtUserGetMenuItemRect","0x2e,0x11b8,4,"}, 
+  {"NtGdiGetNearestColor","0x2e,0x10c2,2,"}, 
+  {"NtUnloadKey","0x2e,0x017c,1,"}, 
+  {"NtUserSfmDxSetSwapChainStats","0x2e,0x1289,2,"}, 
+  {"NtUserSwitchDesktop","0x2e,0x1252,2,"}, 
+  {"NtUserSfmDxSetSwapChainBindingStatus","0x2e,0x1285,2,"}, 
+  {"NtQueryFullAttributesFile","0x2e,0x00e4,2,"}, 
+  {"NtTestAlert","0x2e,0x0174,0,"}, 
+  {"NtUserChangeDisplaySettings","0x2e,0x1151,4,"}, 
+  {"0x2e.0x11c9","NtUserGetTopLevelWindow"}, 
+  {"NtUserMenuItemFromPoint","0x2e,0x11e9,4,"}, 
+  {"0x2e.0x11c8","NtUserGetTitleBarInfo"}, 
+  {"0x2e.0x11c7","NtUserGetThreadState"}, 
+  {"NtGdiBRUSHOBJ_pvGetRbrush","0x2e,0x12bd,1,"}, 
+  {"NtGdiGetMiterLimit","0x2e,0x10c0,2,"}, 
+  {"0x2e.0x11c6","NtUserGetThreadDesktop"}, 
+  {"NtOpenKeyedEvent","0x2e,0x00b8,3,"}, 
+  {"0x2e.0x11c5","NtUserGetSystemMenu"}, 
+  {"0x2e.0x11c4","NtUserGetScrollBarInfo"}, 
+  {"0x2e.0x11c3","NtUserGetRegisteredRawInputDevices"}, 
+  {"0x2e.0x11c2","NtUserGetRawInputDeviceList"}, 
+  {"0x2e.0x11c1","NtUserGetRawInputDeviceInfo"}, 
+  {"0x2e.0x11c0","NtUserGetRawInputData"}, 
+  {"NtUserSetActiveWindow","0x2e,0x1219,1,"}, 
+  {"NtGdiGetCharSet","0x2e,0x10a6,1,"}, 
+  {"NtClose","0x2e,0x0032,1,"}, 
+  {"NtGdiDdDDICheckMonitorPowerState","0x2e,0x1314,1,"}, 
+  {"NtUserCheckWindowThreadDesktop","0x2e,0x1159,2,"}, 
+  {"NtUserSBGetParms","0x2e,0x1214,4,"}, 
+  {"NtUserGetClassName","0x2e,0x1197,3,"}, 
+  {"NtGdiEngDeletePalette","0x2e,0x129f,1,"}, 
+  {"NtGdiEngDeleteSurface","0x2e,0x12a0,1,"}, 
+  {"NtSinglePhaseReject","0x2e,0x016b,2,"}, 
+  {"NtGdiDdUnlock","0x2e,0x1064,2,"}, 
+  {"NtGdiDdGetAvailDriverMemory","0x2e,0x104b,2,"}, 
+  {"NtGdiBeginPath","0x2e,0x100d,1,"}, 
+  {"NtSetDefaultLocale","0x2e,0x013f,2,"}, 
+  {"NtSetSystemEnvironmentValueEx","0x2e,0x015d,5,"}, 
+  {"NtAccessCheckByTypeResultListAndAuditAlarmByPlugin","0x2e,0x0007,17,"}, 
+  {"NtGdiMirrorWindowOrg","0x2e,0x1122,1,"}, 
+  {"NtAccessCheckByTypeResultList","0x2e,0x0005,11,"}, 
+  {"NtGdiCreatePen","0x2e,0x102b,4,"}, 
+  {"NtGdiDdDDICreateKeyedMutex","0x2e,0x1319,1,"}, 
+  {"NtUserSfmDxReportPendingBindingsToDwm","0x2e,0x1287,0,"}, 
+  {"NtQueryDriverEntryOrder","0x2e,0x00e1,2,"}, 
+  {"NtGdiPtVisible","0x2e,0x10fc,3,"}, 
+  {"NtGdiDdDDISetVidPnSourceOwner","0x2e,0x12fd,1,"}, 
+  {"NtOpenObjectAuditAlarm","0x2e,0x00bc,12,"}, 
+  {"NtUserNotifyProcessCreate","0x2e,0x11f1,4,"}, 
+  {"NtUserRemoteStopScreenUpdates","0x2e,0x127a,0,"}, 
+  {"NtGdiCLIPOBJ_bEnum","0x2e,0x12b5,3,"}, 
+  {"NtOpenSession","0x2e,0x00c4,3,"}, 
+  {"NtGdiDdDDICreateDevice","0x2e,0x12e5,1,"}, 
+  {"NtUserInternalGetWindowText","0x2e,0x11dc,3,"}, 
+  {"NtCompressKey","0x2e,0x003a,1,"}, 
+  {"NtGdiGetRealizationInfo","0x2e,0x10cb,2,"}, 
+  {"NtUserDwmStartRedirection","0x2e,0x127f,1,"}, 
+  {"NtFilterToken","0x2e,0x0079,6,"}, 
+  {"NtGdiGetKerningPairs","0x2e,0x10be,3,"}, 
+  {"NtRollbackTransaction","0x2e,0x0133,2,"}, 
+  {"0x2e.0x11cf","NtUserGetWindowDC"}, 
+  {"0x2e.0x11ce","NtUserGetWindowCompositionAttribute"}, 
+  {"NtCancelSynchronousIoFile","0x2e,0x002f,3,"}, 
+  {"0x2e.0x11cd","NtUserGetWindowCompositionInfo"}, 
+  {"NtShutdownWorkerFactory","0x2e,0x0169,2,"}, 
+  {"0x2e.0x11cc","NtUserGetUpdateRgn"}, 
+  {"NtGdiFillRgn","0x2e,0x1097,3,"}, 
+  {"0x2e.0x11cb","NtUserGetUpdateRect"}, 
+  {"0x2e.0x11ca","NtUserGetUpdatedClipboardFormats"}, 
+  {"0x2e.0x108e","NtGdiExcludeClipRect"}, 
+  {"0x2e.0x108d","NtGdiEudcLoadUnloadLink"}, 
+  {"NtUserGetRegisteredRawInputDevices","0x2e,0x11c3,3,"}, 
+  {"0x2e.0x108f","NtGdiExtCreatePen"}, 
+  {"0x2e.0x108a","NtGdiEnumFonts"}, 
+  {"NtGdiCreateCompatibleDC","0x2e,0x1020,1,"}, 
+  {"NtGdiDdDDIQueryStatistics","0x2e,0x12fc,1,"}, 
+  {"0x2e.0x108c","NtGdiEqualRgn"}, 
+  {"0x2e.0x108b","NtGdiEnumObjects"}, 
+  {"NtGdiDdDDIOpenResource","0x2e,0x12e1,1,"}, 
+  {"NtGdiFlattenPath","0x2e,0x1098,1,"}, 
+  {"DxgStubContextDestroyAll","0x2e,0x1323,1,"}, 
+  {"NtUserSetClipboardData","0x2e,0x121f,3,"}, 
+  {"NtUserRedrawWindow","0x2e,0x1207,4,"}, 
+  {"NtGetMUIRegistryInfo","0x2e,0x008a,3,"}, 
+  {"NtUserGetClipboardViewer","0x2e,0x119c,0,"}, 
+  {"NtUserDrawMenuBarTemp","0x2e,0x117e,5,"}, 
+  {"NtGdiUpdateTransform","0x2e,0x12d7,1,"}, 
+  {"NtLockProductActivationKeys","0x2e,0x00a0,2,"}, 
+  {"0x2e.0x109d","NtGdiGetAndSetDCDword"}, 
+  {"0x2e.0x109e","NtGdiGetAppClipBox"}, 
+  {"0x2e.0x109f","NtGdiGetBitmapBits"}, 
+  {"NtUserDoSoundConnect","0x2e,0x1176,0,"}, 
+  {"0x2e.0x109a","NtGdiForceUFIMapping"}, 
+  {"NtUserSetCursorIconData","0x2e,0x1223,4,"}, 
+  {"0x2e.0x109b","NtGdiFrameRgn"}, 
+  {"0x2e.0x109c","NtGdiFullscreenControl"}, 
+  {"NtPrepareEnlistment","0x2e,0x00cf,2,"}, 
+  {"NtUserSetObjectInformation","0x2e,0x122f,4,"}, 
+  {"NtSignalAndWaitForSingleObject","0x2e,0x016a,4,"}, 
+  {"NtGdiSetPixelFormat","0x2e,0x1126,2,"}, 
+  {"NtGdiDdGetMoCompGuids","0x2e,0x1053,2,"}, 
+  {"NtGdiQueryFontAssocInfo","0x2e,0x10fe,1,"}, 
+  {"NtGdiDdDDIGetPresentQueueEvent","0x2e,0x12ff,2,"}, 
+  {"NtGdiDvpFlipVideoPort","0x2e,0x106c,4,"}, 
+  {"NtUserHwndSetRedirectionInfo","0x2e,0x1338,4,"}, 
+  {"NtGdiSetDIBitsToDeviceInternal","0x2e,0x1119,16,"}, 
+  {"NtUserCreateWindowStation","0x2e,0x116a,8,"}, 
+  {"NtUserQuerySendMessage","0x2e,0x1202,1,"}, 
+  {"NtUnlockVirtualMemory","0x2e,0x0180,4,"}, 
+  {"NtGdiDdDDIFlipOverlay","0x2e,0x1302,1,"}, 
+  {"NtUserRemoveMenu","0x2e,0x1211,3,"}, 
+  {"NtGdiSelectFont","0x2e,0x110e,2,"}, 
+  {"0x2e.0x1085","NtGdiEnableEudc"}, 
+  {"NtGdiHfontCreate","0x2e,0x10e4,5,"}, 
+  {"0x2e.0x1084","NtGdiEllipse"}, 
+  {"0x2e.0x1087","NtGdiEndGdiRendering"}, 
+  {"0x2e.0x1086","NtGdiEndDoc"}, 
+  {"0x2e.0x1081","NtGdiDoBanding"}, 
+  {"0x2e.0x1080","NtGdiGetPerBandInfo"}, 
+  {"0x2e.0x1083","NtGdiDrawEscape"}, 
+  {"0x2e.0x1082","NtGdiDoPalette"}, 
+  {"NtUserGetDCEx","0x2e,0x11a5,3,"}, 
+  {"NtAcceptConnectPort","0x2e,0x0000,6,"}, 
+  {"0x2e.0x1089","NtGdiEndPath"}, 
+  {"0x2e.0x1088","NtGdiEndPage"}, 
+  {"NtGdiAbortDoc","0x2e,0x1000,1,"}, 
+  {"NtGdiSetMagicColors","0x2e,0x111e,3,"}, 
+  {"NtUserRemoteConnect","0x2e,0x1277,3,"}, 
+  {"NtWaitForSingleObject","0x2e,0x0187,3,"}, 
+  {"NtSetInformationJobObject","0x2e,0x014a,4,"}, 
+  {"NtGdiExtCreateRegion","0x2e,0x1090,3,"}, 
+  {"0x2e.0x1094","NtGdiExtSelectClipRgn"}, 
+  {"0x2e.0x1095","NtGdiExtTextOutW"}, 
+  {"0x2e.0x1096","NtGdiFillPath"}, 
+  {"0x2e.0x1097","NtGdiFillRgn"}, 
+  {"0x2e.0x1090","NtGdiExtCreateRegion"}, 
+  {"NtGdiDescribePixelFormat","0x2e,0x107e,4,"}, 
+  {"0x2e.0x1091","NtGdiExtEscape"}, 
+  {"NtRequestWaitReplyPort","0x2e,0x012b,3,"}, 
+  {"NtUserEnumDisplayDevices","0x2e,0x1185,4,"}, 
+  {"0x2e.0x1092","NtGdiExtFloodFill"}, 
+  {"0x2e.0x1093","NtGdiExtGetObjectW"}, 
+  {"NtGdiPtInRegion","0x2e,0x10fb,3,"}, 
+  {"0x2e.0x1098","NtGdiFlattenPath"}, 
+  {"NtUserCloseDesktop","0x2e,0x115e,1,"}, 
+  {"NtGdiXLATEOBJ_iXlate","0x2e,0x12b3,2,"}, 
+  {"0x2e.0x1099","NtGdiFlush"}, 
+  {"NtGdiGetStockObject","0x2e,0x10d1,1,"}, 
+  {"NtGdiGetEudcTimeStampEx","0x2e,0x10b5,3,"}, 
+  {"NtGdiDdDDIDestroyDevice","0x2e,0x12e6,1,"}, 
+  {"NtUserGetClipboardOwner","0x2e,0x119a,0,"}, 
+  {"NtGdiDdQueryMoCompStatus","0x2e,0x1059,2,"}, 
+  {"NtUserInvalidateRect","0x2e,0x11de,3,"}, 
+  {"NtOpenPrivateNamespace","0x2e,0x00bd,4,"}, 
+  {"0x2e.0x104a","NtGdiDdFlipToGDISurface"}, 
+  {"0x2e.0x104c","NtGdiDdGetBltStatus"}, 
+  {"0x2e.0x104b","NtGdiDdGetAvailDriverMemory"}, 
+  {"NtGdiCreateClientObj","0x2e,0x101c,1,"}, 
+  {"NtUserBuildPropList","0x2e,0x1145,4,"}, 
+  {"0x2e.0x104e","NtGdiDdGetDriverInfo"}, 
+  {"0x2e.0x104d","NtGdiDdGetDC"}, 
+  {"NtGdiGetCharABCWidthsW","0x2e,0x10a4,6,"}, 
+  {"0x2e.0x104f","NtGdiDdGetDxPlugin"}, 
+  {"NtUserSetProp","0x2e,0x1233,3,"}, 
+  {"NtGdiGetWidthTable","0x2e,0x10e2,7,"}, 
+  {"NtUserEnumDisplaySettings","0x2e,0x1187,4,"}, 
+  {"NtUserDdeInitialize","0x2e,0x116b,5,"}, 
+  {"NtGdiGetDCforBitmap","0x2e,0x10ad,1,"}, 
+  {"NtUserMinMaximize","0x2e,0x11eb,3,"}, 
+  {"NtUserUpdateLayeredWindow","0x2e,0x1268,10,"}, 
+  {"NtGdiDdDDIDestroyKeyedMutex","0x2e,0x131b,1,"}, 
+  {"NtGdiDdDDICreateOverlay","0x2e,0x1300,1,"}, 
+  {"NtCreateNamedPipeFile","0x2e,0x004b,14,"}, 
+  {"NtUserGetUpdateRgn","0x2e,0x11cc,3,"}, 
+  {"NtGdiGetPixel","0x2e,0x10c8,3,"}, 
+  {"0x2e.0x105a","NtGdiDdReenableDirectDrawObject"}, 
+  {"0x2e.0x105b","NtGdiDdReleaseDC"}, 
+  {"0x2e.0x105c","NtGdiDdRenderMoComp"}, 
+  {"NtTraceControl","0x2e,0x0177,6,"}, 
+  {"NtFlushInstallUILanguage","0x2e,0x007c,2,"}, 
+  {"0x2e.0x105d","NtGdiDdResetVisrgn"}, 
+  {"0x2e.0x105e","NtGdiDdSetColorKey"}, 
+  {"NtReplyWaitReceivePort","0x2e,0x0127,4,"}, 
+  {"0x2e.0x105f","NtGdiDdSetExclusiveMode"}, 
+  {"0x2e.0x009e","NtLoadKeyEx"}, 
+  {"NtQueryInstallUILanguage","0x2e,0x00f1,1,"}, 
+  {"0x2e.0x009d","NtLoadKey2"}, 
+  {"NtGdiEngCreateDeviceBitmap","0x2e,0x129b,4,"}, 
+  {"0x2e.0x009f","NtLockFile"}, 
+  {"NtUserSetProcessWindowStation","0x2e,0x1231,1,"}, 
+  {"NtAlpcCreateResourceReserve","0x2e,0x0019,4,"}, 
+  {"0x2e.0x009a","NtListenPort"}, 
+  {"NtUserCallHwnd","0x2e,0x1146,2,"}, 
+  {"NtDeleteDriverEntry","0x2e,0x0065,1,"}, 
+  {"0x2e.0x009c","NtLoadKey"}, 
+  {"0x2e.0x009b","NtLoadDriver"}, 
+  {"NtUserSetInformationThread","0x2e,0x1228,4,"}, 
+  {"NtOpenThreadTokenEx","0x2e,0x00c8,5,"}, 
+  {"NtUserGetUpdatedClipboardFormats","0x2e,0x11ca,3,"}, 
+  {"NtRecoverTransactionManager","0x2e,0x0118,1,"}, 
+  {"NtGdiEngEraseSurface","0x2e,0x12a1,3,"}, 
+  {"NtGdiStartPage","0x2e,0x112d,1,"}, 
+  {"NtGdiTransparentBlt","0x2e,0x1134,11,"}, 
+  {"0x2e.0x1049","NtGdiDdFlip"}, 
+  {"0x2e.0x1048","NtGdiDdEndMoCompFrame"}, 
+  {"NtGdiEngTransparentBlt","0x2e,0x12af,8,"}, 
+  {"0x2e.0x008d","NtGetNlsSectionPtr"}, 
+  {"0x2e.0x008e","NtGetNotificationResourceManager"}, 
+  {"NtGdiAddRemoteFontToDC","0x2e,0x1003,4,"}, 
+  {"0x2e.0x008f","NtGetPlugPlayEvent"}, 
+  {"NtWaitHighEventPair","0x2e,0x0189,1,"}, 
+  {"0x2e.0x1041","NtGdiDdCreateMoComp"}, 
+  {"0x2e.0x008a","NtGetMUIRegistryInfo"}, 
+  {"0x2e.0x1040","NtGdiDdCreateD3DBuffer"}, 
+  {"NtUserGetInternalWindowPos","0x2e,0x11af,3,"}, 
+  {"0x2e.0x008b","NtGetNextProcess"}, 
+  {"0x2e.0x1043","NtGdiDdDeleteDirectDrawObject"}, 
+  {"0x2e.0x008c","NtGetNextThread"}, 
+  {"0x2e.0x1042","NtGdiDdCreateSurfaceObject"}, 
+  {"0x2e.0x1045","NtGdiDdDestroyMoComp"}, 
+  {"0x2e.0x1044","NtGdiDdDeleteSurfaceObject"}, 
+  {"NtGdiAddFontMemResourceEx","0x2e,0x1004,5,"}, 
+  {"0x2e.0x1047","NtGdiDdDestroyD3DBuffer"}, 
+  {"0x2e.0x1046","NtGdiDdDestroySurface"}, 
+  {"NtGdiDdDDIEscape","0x2e,0x12fb,1,"}, 
+  {"NtUserDeleteMenu","0x2e,0x116e,3,"}, 
+  {"NtAreMappedFilesTheSame","0x2e,0x002a,2,"}, 
+  {"NtUserGetRawInputBuffer","0x2e,0x11bf,3,"}, 
+  {"NtGdiD3dDrawPrimitives2","0x2e,0x1034,7,"}, 
+  {"NtUserGetTitleBarInfo","0x2e,0x11c8,2,"}, 
+  {"NtQueryLicenseValue","0x2e,0x00f5,5,"}, 
+  {"0x2e.0x1058","NtGdiDdQueryDirectDrawObject"}, 
+  {"0x2e.0x1059","NtGdiDdQueryMoCompStatus"}, 
+  {"NtGdiGetColorSpaceforBitmap","0x2e,0x10aa,1,"}, 
+  {"NtWaitForMultipleObjects","0x2e,0x0185,5,"}, 
+  {"NtGdiSelectClipPath","0x2e,0x110d,2,"}, 
+  {"NtFlushWriteBuffer","0x2e,0x0081,0,"}, 
+  {"NtLockRegistryKey","0x2e,0x00a1,1,"}, 
+  {"NtQueryInformationTransactionManager","0x2e,0x00ef,5,"}, 
+  {"NtQueryBootEntryOrder","0x2e,0x00da,2,"}, 
+  {"0x2e.0x1050","NtGdiDdGetFlipStatus"}, 
+  {"NtRollforwardTransactionManager","0x2e,0x0134,2,"}, 
+  {"0x2e.0x1051","NtGdiDdGetInternalMoCompInfo"}, 
+  {"0x2e.0x1052","NtGdiDdGetMoCompBuffInfo"}, 
+  {"0x2e.0x1053","NtGdiDdGetMoCompGuids"}, 
+  {"0x2e.0x1054","NtGdiDdGetMoCompFormats"}, 
+  {"0x2e.0x1055","NtGdiDdGetScanLine"}, 
+  {"0x2e.0x1056","NtGdiDdLock"}, 
+  {"0x2e.0x1057","NtGdiDdLockD3D"}, 
+  {"0x2e.0x0095","NtInitializeRegistry"}, 
+  {"0x2e.0x0094","NtInitializeNlsFiles"}, 
+  {"0x2e.0x0097","NtIsProcessInJob"}, 
+  {"0x2e.0x0096","NtInitiatePowerAction"}, 
+  {"NtGdiChangeGhostFont","0x2e,0x10df,2,"}, 
+  {"0x2e.0x0091","NtImpersonateAnonymousToken"}, 
+  {"0x2e.0x100e","NtGdiBitBlt"}, 
+  {"0x2e.0x0090","NtGetWriteWatch"}, 
+  {"0x2e.0x100d","NtGdiBeginPath"}, 
+  {"0x2e.0x0093","NtImpersonateThread"}, 
+  {"NtCancelIoFile","0x2e,0x002d,2,"}, 
+  {"0x2e.0x0092","NtImpersonateClientOfPort"}, 
+  {"0x2e.0x100f","NtGdiCancelDC"}, 
+  {"0x2e.0x100a","NtGdiFontIsLinked"}, 
+  {"0x2e.0x100c","NtGdiBeginGdiRendering"}, 
+  {"NtGdiDDCCISaveCurrentSettings","0x2e,0x132a,1,"}, 
+  {"0x2e.0x100b","NtGdiArcInternal"}, 
+  {"0x2e.0x0099","NtIsUILanguageComitted"}, 
+  {"0x2e.0x0098","NtIsSystemResumeAutomatic"}, 
+  {"0x2e.0x1069","NtGdiDvpColorControl"}, 
+  {"NtGdiDdCreateSurfaceObject","0x2e,0x1042,6,"}, 
+  {"0x2e.0x1068","NtGdiDvpCanCreateVideoPort"}, 
+  {"NtIsProcessInJob","0x2e,0x0097,2,"}, 
+  {"0x2e.0x1063","NtGdiDdUnattachSurface"}, 
+  {"0x2e.0x1062","NtGdiDdSetOverlayPosition"}, 
+  {"0x2e.0x1061","NtGdiDdCreateSurfaceEx"}, 
+  {"0x2e.0x1060","NtGdiDdSetGammaRamp"}, 
+  {"0x2e.0x1067","NtGdiDdWaitForVerticalBlank"}, 
+  {"0x2e.0x1066","NtGdiDdUpdateOverlay"}, 
+  {"0x2e.0x1065","NtGdiDdUnlockD3D"}, 
+  {"0x2e.0x1064","NtGdiDdUnlock"}, 
+  {"NtUserScrollDC","0x2e,0x1215,7,"}, 
+  {"NtQueryInformationAtom","0x2e,0x00e5,5,"}, 
+  {"NtUserSfmDxGetSwapChainStats","0x2e,0x1288,2,"}, 
+  {"0x2e.0x0084","NtFreezeRegistry"}, 
+  {"0x2e.0x0085","NtFreezeTransactions"}, 
+  {"NtQueryTimer","0x2e,0x0108,5,"}, 
+  {"0x2e.0x0086","NtFsControlFile"}, 
+  {"0x2e.0x0087","NtGetContextThread"}, 
+  {"0x2e.0x0080","NtFlushVirtualMemory"}, 
+  {"0x2e.0x101d","NtGdiCreateColorSpace"}, 
+  {"NtUserWindowFromPhysicalPoint","0x2e,0x1274,2,"}, 
+  {"0x2e.0x0081","NtFlushWriteBuffer"}, 
+  {"0x2e.0x101e","NtGdiCreateColorTransform"}, 
+  {"NtDeleteValueKey","0x2e,0x006a,2,"}, 
+  {"0x2e.0x0082","NtFreeUserPhysicalPages"}, 
+  {"NtGdiDdDDISignalSynchronizationObject","0x2e,0x12ed,1,"}, 
+  {"0x2e.0x101f","NtGdiCreateCompatibleBitmap"}, 
+  {"0x2e.0x0083","NtFreeVirtualMemory"}, 
+  {"NtLoadDriver","0x2e,0x009b,1,"}, 
+  {"NtGdiSetMetaRgn","0x2e,0x111f,1,"}, 
+  {"0x2e.0x101a","NtGdiCreateBitmap"}, 
+  {"NtUserInjectGesture","0x2e,0x1292,5,"}, 
+  {"0x2e.0x101b","NtGdiCreateBitmapFromDxSurface"}, 
+  {"0x2e.0x101c","NtGdiCreateClientObj"}, 
+  {"0x2e.0x0088","NtGetCurrentProcessorNumber"}, 
+  {"0x2e.0x0089","NtGetDevicePowerState"}, 
+  {"NtUserPaintDesktop","0x2e,0x11f8,1,"}, 
+  {"NtUserRegisterErrorReportingDialog","0x2e,0x1209,2,"}, 
+  {"0x2e.0x1078","NtGdiDvpReleaseNotification"}, 
+  {"NtGdiDdDDIGetOverlayState","0x2e,0x131f,1,"}, 
+  {"0x2e.0x1079","NtGdiDxgGenericThunk"}, 
+  {"NtUserSendTouchInput","0x2e,0x128e,4,"}, 
+  {"0x2e.0x1072","NtGdiDvpGetVideoPortOutputFormats"}, 
+  {"NtGdiFONTOBJ_cGetGlyphs","0x2e,0x12c3,5,"}, 
+  {"0x2e.0x1073","NtGdiDvpGetVideoPortConnectInfo"}, 
+  {"0x2e.0x1070","NtGdiDvpGetVideoPortInputFormats"}, 
+  {"NtUserSetWindowRgn","0x2e,0x1245,3,"}, 
+  {"0x2e.0x1071","NtGdiDvpGetVideoPortLine"}, 
+  {"0x2e.0x005a","NtCreateToken"}, 
+  {"0x2e.0x1076","NtGdiDvpWaitForVideoPortSync"}, 
+  {"0x2e.0x1077","NtGdiDvpAcquireNotification"}, 
+  {"0x2e.0x005c","NtCreateTransactionManager"}, 
+  {"0x2e.0x1074","NtGdiDvpGetVideoSignalStatus"}, 
+  {"0x2e.0x005b","NtCreateTransaction"}, 
+  {"0x2e.0x1075","NtGdiDvpUpdateVideoPort"}, 
+  {"0x2e.0x005e","NtCreateWaitablePort"}, 
+  {"0x2e.0x005d","NtCreateUserProcess"}, 
+  {"NtUserRegisterWindowMessage","0x2e,0x120f,1,"}, 
+  {"0x2e.0x005f","NtCreateWorkerFactory"}, 
+  {"NtReleaseMutant","0x2e,0x011c,2,"}, 
+  {"0x2e.0x106c","NtGdiDvpFlipVideoPort"}, 
+  {"0x2e.0x106b","NtGdiDvpDestroyVideoPort"}, 
+  {"0x2e.0x106a","NtGdiDvpCreateVideoPort"}, 
+  {"NtSetSystemPowerState","0x2e,0x015f,3,"}, 
+  {"NtUserGetWindowMinimizeRect","0x2e,0x1281,2,"}, 
+  {"0x2e.0x106f","NtGdiDvpGetVideoPortFlipStatus"}, 
+  {"NtQueryValueKey","0x2e,0x010a,6,"}, 
+  {"0x2e.0x106e","NtGdiDvpGetVideoPortField"}, 
+  {"0x2e.0x106d","NtGdiDvpGetVideoPortBandwidth"}, 
+  {"NtUserSetParent","0x2e,0x1230,2,"}, 
+  {"NtPrivilegeObjectAuditAlarm","0x2e,0x00d4,6,"}, 
+  {"NtUserSetCursor","0x2e,0x1221,1,"}, 
+  {"0x2e.0x1009","NtGdiAnyLinkedFonts"}, 
+  {"0x2e.0x1008","NtGdiAngleArc"}, 
+  {"NtGdiSelectPen","0x2e,0x110f,2,"}, 
+  {"NtGdiDdGetScanLine","0x2e,0x1055,2,"}, 
+  {"NtUserDrawCaption","0x2e,0x117b,4,"}, 
+  {"0x2e.0x1005","NtGdiRemoveMergeFont"}, 
+  {"0x2e.0x1004","NtGdiAddFontMemResourceEx"}, 
+  {"0x2e.0x1007","NtGdiAlphaBlend"}, 
+  {"0x2e.0x1006","NtGdiAddRemoteMMInstanceToDC"}, 
+  {"NtSetLdtEntries","0x2e,0x0157,6,"}, 
+  {"0x2e.0x1001","NtGdiAbortPath"}, 
+  {"0x2e.0x004a","NtCreateMutant"}, 
+  {"0x2e.0x1000","NtGdiAbortDoc"}, 
+  {"0x2e.0x004b","NtCreateNamedPipeFile"}, 
+  {"0x2e.0x1003","NtGdiAddRemoteFontToDC"}, 
+  {"0x2e.0x004c","NtCreatePagingFile"}, 
+  {"0x2e.0x1002","NtGdiAddFontResourceW"}, 
+  {"NtCreateKeyTransacted","0x2e,0x0048,8,"}, 
+  {"0x2e.0x004d","NtCreatePort"}, 
+  {"0x2e.0x004e","NtCreatePrivateNamespace"}, 
+  {"NtUserSfmDxBindSwapChain","0x2e,0x1282,3,"}, 
+  {"0x2e.0x004f","NtCreateProcess"}, 
+  {"NtGdiDdDDIRender","0x2e,0x12f6,1,"}, 
+  {"NtUserExcludeUpdateRgn","0x2e,0x1189,2,"}, 
+  {"NtSetLowEventPair","0x2e,0x0158,1,"}, 
+  {"0x2e.0x107b","NtGdiDeleteColorSpace"}, 
+  {"NtUserModifyWindowTouchCapability","0x2e,0x128c,3,"}, 
+  {"0x2e.0x107c","NtGdiDeleteColorTransform"}, 
+  {"NtQuerySection","0x2e,0x00fe,5,"}, 
+  {"0x2e.0x107a","NtGdiDeleteClientObj"}, 
+  {"0x2e.0x107f","NtGdiDestroyOPMProtectedOutput"}, 
+  {"NtUserSetShellWindowEx","0x2e,0x1235,2,"}, 
+  {"0x2e.0x107d","NtGdiDeleteObjectApp"}, 
+  {"0x2e.0x107e","NtGdiDescribePixelFormat"}, 
+  {"NtRestoreKey","0x2e,0x012e,3,"}, 
+  {"NtUserCallMsgFilter","0x2e,0x114b,2,"}, 
+  {"0x2e.0x1018","NtGdiConfigureOPMProtectedOutput"}, 
+  {"NtUserGetGUIThreadInfo","0x2e,0x11a9,2,"}, 
+  {"NtGdiSetBitmapBits","0x2e,0x1111,3,"}, 
+  {"0x2e.0x1019","NtGdiConvertMetafileRect"}, 
+  {"NtGetContextThread","0x2e,0x0087,2,"}, 
+  {"0x2e.0x1014","NtGdiColorCorrectPalette"}, 
+  {"0x2e.0x1015","NtGdiCombineRgn"}, 
+  {"NtGdiD3dValidateTextureStageState","0x2e,0x1033,1,"}, 
+  {"0x2e.0x1016","NtGdiCombineTransform"}, 
+  {"NtPrivilegeCheck","0x2e,0x00d2,3,"}, 
+  {"0x2e.0x1017","NtGdiComputeXformCoefficients"}, 
+  {"0x2e.0x1010","NtGdiCheckBitmapBits"}, 
+  {"NtGdiDdDeleteSurfaceObject","0x2e,0x1044,1,"}, 
+  {"0x2e.0x1011","NtGdiCloseFigure"}, 
+  {"NtOpenProcess","0x2e,0x00be,4,"}, 
+  {"NtQueryObject","0x2e,0x00f8,5,"}, 
+  {"0x2e.0x1012","NtGdiClearBitmapAttributes"}, 
+  {"0x2e.0x1013","NtGdiClearBrushAttributes"}, 
+  {"0x2e.0x0059","NtCreateTimer"}, 
+  {"NtGdiGetPath","0x2e,0x10c7,4,"}, 
+  {"NtGdiFONTOBJ_vGetInfo","0x2e,0x12c1,3,"}, 
+  {"0x2e.0x0058","NtCreateThreadEx"}, 
+  {"NtUserGhostWindowFromHungWindow","0x2e,0x11d3,1,"}, 
+  {"NtGdiEngAssociateSurface","0x2e,0x1298,3,"}, 
+  {"NtUserGetRawInputDeviceInfo","0x2e,0x11c1,4,"}, 
+  {"NtGdiDdBeginMoCompFrame","0x2e,0x1039,2,"}, 
+  {"0x2e.0x0051","NtCreateProfile"}, 
+  {"0x2e.0x0050","NtCreateProcessEx"}, 
+  {"0x2e.0x0053","NtCreateResourceManager"}, 
+  {"0x2e.0x0052","NtCreateProfileEx"}, 
+  {"NtQueryTimerResolution","0x2e,0x0109,3,"}, 
+  {"NtGdiMakeInfoDC","0x2e,0x10ec,2,"}, 
+  {"0x2e.0x0055","NtCreateSemaphore"}, 
+  {"NtUserGetCPD","0x2e,0x11a1,3,"}, 
+  {"0x2e.0x0054","NtCreateSection"}, 
+  {"0x2e.0x0057","NtCreateThread"}, 
+  {"NtGdiUMPDEngFreeUserMem","0x2e,0x12da,1,"}, 
+  {"0x2e.0x0056","NtCreateSymbolicLinkObject"}, 
+  {"NtUserGetLayeredWindowAttributes","0x2e,0x1269,4,"}, 
+  {"0x2e.0x1029","NtGdiCreatePaletteInternal"}, 
+  {"0x2e.0x1028","NtGdiCreateOPMProtectedOutputs"}, 
+  {"0x2e.0x1027","NtGdiCreateMetafileDC"}, 
+  {"NtUserSetThreadLayoutPlugins","0x2e,0x123b,2,"}, 
+  {"0x2e.0x1026","NtGdiCreateHatchBrushInternal"}, 
+  {"0x2e.0x1025","NtGdiCreateHalftonePalette"}, 
+  {"0x2e.0x1024","NtGdiCreateEllipticRgn"}, 
+  {"NtGdiDdReleaseDC","0x2e,0x105b,1,"}, 
+  {"0x2e.0x1023","NtGdiCreateDIBSection"}, 
+  {"0x2e.0x1022","NtGdiCreateDIBitmapInternal"}, 
+  {"0x2e.0x1021","NtGdiCreateDIBBrush"}, 
+  {"0x2e.0x1020","NtGdiCreateCompatibleDC"}, 
+  {"NtCreatePrivateNamespace","0x2e,0x004e,4,"}, 
+  {"NtGdiDdEndMoCompFrame","0x2e,0x1048,2,"}, 
+  {"NtGdiSetMiterLimit","0x2e,0x1120,3,"}, 
+  {"0x2e.0x0048","NtCreateKeyTransacted"}, 
+  {"NtUserGetOpenClipboardWindow","0x2e,0x11bc,0,"}, 
+  {"0x2e.0x0049","NtCreateMailslotFile"}, 
+  {"NtGdiSetColorSpace","0x2e,0x1117,2,"}, 
+  {"NtUserGetGestureConfig","0x2e,0x1297,6,"}, 
+  {"NtUserUpdateInputContext","0x2e,0x1266,3,"}, 
+  {"NtGdiFrameRgn","0x2e,0x109b,5,"}, 
+  {"NtOpenIoCompletion","0x2e,0x00b4,3,"}, 
+  {"0x2e.0x0040","NtCreateEvent"}, 
+  {"0x2e.0x0041","NtCreateEventPair"}, 
+  {"0x2e.0x0042","NtCreateFile"}, 
+  {"NtUserGetForegroundWindow","0x2e,0x11a7,0,"}, 
+  {"0x2e.0x0043","NtCreateIoCompletion"}, 
+  {"0x2e.0x0044","NtCreateJobObject"}, 
+  {"0x2e.0x0045","NtCreateJobSet"}, 
+  {"NtGdiGetTextMetricsW","0x2e,0x10d9,3,"}, 
+  {"0x2e.0x0046","NtCreateKey"}, 
+  {"0x2e.0x0047","NtCreateKeyedEvent"}, 
+  {"NtUserScrollWindowEx","0x2e,0x1216,8,"}, 
+  {"0x2e.0x1038","NtGdiDdAttachSurface"}, 
+  {"0x2e.0x1039","NtGdiDdBeginMoCompFrame"}, 
+  {"NtGdiCreateCompatibleBitmap","0x2e,0x101f,3,"}, 
+  {"0x2e.0x1036","NtGdiDdAddAttachedSurface"}, 
+  {"0x2e.0x1037","NtGdiDdAlphaBlt"}, 
+  {"0x2e.0x1034","NtGdiD3dDrawPrimitives2"}, 
+  {"0x2e.0x1035","NtGdiDdGetDriverState"}, 
+  {"0x2e.0x1032","NtGdiD3dContextDestroyAll"}, 
+  {"0x2e.0x001e","NtAlpcDeleteSectionView"}, 
+  {"0x2e.0x1033","NtGdiD3dValidateTextureStageState"}, 
+  {"0x2e.0x001d","NtAlpcDeleteResourceReserve"}, 
+  {"0x2e.0x1030","NtGdiD3dContextCreate"}, 
+  {"0x2e.0x1031","NtGdiD3dContextDestroy"}, 
+  {"0x2e.0x001f","NtAlpcDeleteSecurityContext"}, 
+  {"0x2e.0x001a","NtAlpcCreateSectionView"}, 
+  {"0x2e.0x001c","NtAlpcDeletePortSection"}, 
+  {"0x2e.0x001b","NtAlpcCreateSecurityContext"}, 
+  {"0x2e.0x0079","NtFilterToken"}, 
+  {"NtGdiSTROBJ_bGetAdvanceWidths","0x2e,0x12cb,4,"}, 
+  {"0x2e.0x0078","NtExtendSection"}, 
+  {"NtFlushProcessWriteBuffers","0x2e,0x007f,0,"}, 
+  {"NtFreezeTransactions","0x2e,0x0085,2,"}, 
+  {"NtGdiEngAlphaBlend","0x2e,0x12ad,7,"}, 
+  {"0x2e.0x102f","NtGdiCreateSolidBrush"}, 
+  {"NtGdiDdQueryDirectDrawObject","0x2e,0x1058,11,"}, 
+  {"0x2e.0x102e","NtGdiCreateServerMetaFile"}, 
+  {"0x2e.0x102d","NtGdiCreateRoundRectRgn"}, 
+  {"0x2e.0x102c","NtGdiCreateRectRgn"}, 
+  {"0x2e.0x0073","NtEnumerateDriverEntries"}, 
+  {"0x2e.0x102b","NtGdiCreatePen"}, 
+  {"NtSetDriverEntryOrder","0x2e,0x0141,2,"}, 
+  {"0x2e.0x0072","NtEnumerateBootEntries"}, 
+  {"0x2e.0x102a","NtGdiCreatePatternBrushInternal"}, 
+  {"0x2e.0x0071","NtEnableLastKnownGood"}, 
+  {"NtDisplayString","0x2e,0x006d,1,"}, 
+  {"0x2e.0x0070","NtDuplicateToken"}, 
+  {"0x2e.0x0077","NtEnumerateValueKey"}, 
+  {"NtGdiResetDC","0x2e,0x1104,5,"}, 
+  {"0x2e.0x0076","NtEnumerateTransactionObject"}, 
+  {"0x2e.0x0075","NtEnumerateSystemEnvironmentValuesEx"}, 
+  {"NtUserRealInternalGetMessage","0x2e,0x1205,6,"}, 
+  {"0x2e.0x0074","NtEnumerateKey"}, 
+  {"NtGdiOffsetRgn","0x2e,0x10f2,3,"}, 
+  {"NtUserSetImeHotKey","0x2e,0x1225,5,"}, 
+  {"NtGdiSfmGetNotificationTokens","0x2e,0x12dc,3,"}, 
+  {"0x2e.0x000d","NtAlertResumeThread"}, 
+  {"0x2e.0x000e","NtAlertThread"}, 
+  {"NtQuerySystemEnvironmentValueEx","0x2e,0x0104,5,"}, 
+  {"NtUserSetSysColors","0x2e,0x1236,4,"}, 
+  {"0x2e.0x000f","NtAllocateLocallyUniqueId"}, 
+  {"NtPropagationComplete","0x2e,0x00d5,4,"}, 
+  {"NtGdiPATHOBJ_bEnumClipLines","0x2e,0x12d2,3,"}, 
+  {"0x2e.0x000a","NtAddDriverEntry"}, 
+  {"NtOpenTransactionManager","0x2e,0x00cb,6,"}, 
+  {"NtCreateSymbolicLinkObject","0x2e,0x0056,4,"}, 
+  {"0x2e.0x000b","NtAdjustGroupsToken"}, 
+  {"0x2e.0x000c","NtAdjustPrivilegesToken"}, 
+  {"0x2e.0x0068","NtDeleteObjectAuditAlarm"}, 
+  {"0x2e.0x0069","NtDeletePrivateNamespace"}, 
+  {"0x2e.0x103f","NtGdiDdCreateSurface"}, 
+  {"0x2e.0x103d","NtGdiDdColorControl"}, 
+  {"NtGdiDdRenderMoComp","0x2e,0x105c,2,"}, 
+  {"0x2e.0x103e","NtGdiDdCreateDirectDrawObject"}, 
+  {"0x2e.0x103b","NtGdiDdCanCreateSurface"}, 
+  {"0x2e.0x0062","NtDelayExecution"}, 
+  {"NtUserPostMessage","0x2e,0x11fc,4,"}, 
+  {"0x2e.0x103c","NtGdiDdCanCreateD3DBuffer"}, 
+  {"0x2e.0x0063","NtDeleteAtom"}, 
+  {"0x2e.0x0060","NtDebugActiveProcess"}, 
+  {"0x2e.0x103a","NtGdiDdBlt"}, 
+  {"0x2e.0x0061","NtDebugContinue"}, 
+  {"NtGdiEngDeletePath","0x2e,0x12b8,1,"}, 
+  {"NtUserGetGestureInfo","0x2e,0x1293,2,"}, 
+  {"0x2e.0x0066","NtDeleteFile"}, 
+  {"0x2e.0x0067","NtDeleteKey"}, 
+  {"NtUserIsClipboardFormatAvailable","0x2e,0x11e0,1,"}, 
+  {"NtAlpcCancelMessage","0x2e,0x0015,3,"}, 
+  {"0x2e.0x0064","NtDeleteBootEntry"}, 
+  {"0x2e.0x0065","NtDeleteDriverEntry"}, 
+  {"NtGdiInvertRgn","0x2e,0x10e9,2,"}, 
+  {"NtUserGetRawInputDeviceList","0x2e,0x11c2,3,"}, 
+  {"NtGdiDdGetMoCompBuffInfo","0x2e,0x1052,2,"}, 
+  {"NtFreezeRegistry","0x2e,0x0084,1,"}, 
+  {"NtGdiDvpGetVideoSignalStatus","0x2e,0x1074,2,"}, 
+  {"NtUserSfmDxReleaseSwapChain","0x2e,0x1284,2,"}, 
+  {"NtAccessCheckAndAuditAlarm","0x2e,0x0002,11,"}, 
+  {"0x2e.0x007c","NtFlushInstallUILanguage"}, 
+  {"0x2e.0x007b","NtFlushBuffersFile"}, 
+  {"NtGetNextProcess","0x2e,0x008b,5,"}, 
+  {"0x2e.0x007a","NtFindAtom"}, 
+  {"0x2e.0x007f","NtFlushProcessWriteBuffers"}, 
+  {"NtUserSetAppImeLevel","0x2e,0x121a,2,"}, 
+  {"0x2e.0x007e","NtFlushKey"}, 
+  {"0x2e.0x007d","NtFlushInstructionCache"}, 
+  {"NtGdiGetETM","0x2e,0x10b4,2,"}, 
+  {"NtAlpcAcceptConnectPort","0x2e,0x0014,9,"}, 
+  {"NtUserCallOneParam","0x2e,0x114e,2,"}, 
+  {"NtGdiCreateEllipticRgn","0x2e,0x1024,4,"}, 
+  {"0x2e.0x0019","NtAlpcCreateResourceReserve"}, 
+  {"0x2e.0x0018","NtAlpcCreatePortSection"}, 
+  {"NtUserCallHwndLock","0x2e,0x1147,2,"}, 
+  {"NtUserChildWindowFromPointEx","0x2e,0x115b,4,"}, 
+  {"0x2e.0x0015","NtAlpcCancelMessage"}, 
+  {"NtGdiExtFloodFill","0x2e,0x1092,5,"}, 
+  {"0x2e.0x0014","NtAlpcAcceptConnectPort"}, 
+  {"0x2e.0x0017","NtAlpcCreatePort"}, 
+  {"NtUserUpdatePerUserSystemParameters","0x2e,0x126b,1,"}, 
+  {"NtUserSetCapture","0x2e,0x121b,1,"}, 
+  {"0x2e.0x0016","NtAlpcConnectPort"}, 
+  {"0x2e.0x0011","NtAllocateUserPhysicalPages"}, 
+  {"0x2e.0x0010","NtAllocateReserveObject"}, 
+  {"NtUserWaitMessage","0x2e,0x1273,0,"}, 
+  {"0x2e.0x0013","NtAllocateVirtualMemory"}, 
+  {"0x2e.0x0012","NtAllocateUuids"}, 
+  {"NtRenameKey","0x2e,0x0122,2,"}, 
+  {"NtGdiStrokeAndFillPath","0x2e,0x1130,1,"}, 
+  {"0x2e.0x006b","NtDeviceIoControlFile"}, 
+  {"0x2e.0x006c","NtDisableLastKnownGood"}, 
+  {"NtNotifyChangeSession","0x2e,0x00ae,8,"}, 
+  {"0x2e.0x006a","NtDeleteValueKey"}, 
+  {"NtGdiGetOPMInformation","0x2e,0x10bd,3,"}, 
+  {"0x2e.0x006f","NtDuplicateObject"}, 
+  {"0x2e.0x006d","NtDisplayString"}, 
+  {"0x2e.0x006e","NtDrawText"}, 
+  {"NtUserUnhookWindowsHookEx","0x2e,0x125f,1,"}, 
+  {"NtFlushInstructionCache","0x2e,0x007d,3,"}, 
+  {"NtUserFlashWindowEx","0x2e,0x118d,1,"}, 
+  {"0x2e.0x0008","NtAddAtom"}, 
+  {"0x2e.0x0009","NtAddBootEntry"}, 
+  {"0x2e.0x0004","NtAccessCheckByTypeAndAuditAlarm"}, 
+  {"0x2e.0x0005","NtAccessCheckByTypeResultList"}, 
+  {"0x2e.0x0006","NtAccessCheckByTypeResultListAndAuditAlarm"}, 
+  {"0x2e.0x0007","NtAccessCheckByTypeResultListAndAuditAlarmByPlugin"}, 
+  {"0x2e.0x0000","NtAcceptConnectPort"}, 
+  {"0x2e.0x0001","NtAccessCheck"}, 
+  {"NtQueryInformationEnlistment","0x2e,0x00e6,5,"}, 
+  {"0x2e.0x0002","NtAccessCheckAndAuditAlarm"}, 
+  {"0x2e.0x0003","NtAccessCheckByType"}, 
+  {"NtMapUserPhysicalPagesScatter","0x2e,0x00a7,3,"}, 
+  {"NtSetUuidSeed","0x2e,0x0165,1,"}, 
+  {"NtSetInformationTransaction","0x2e,0x0151,4,"}, 
+  {"NtUserGetKeyboardLayoutName","0x2e,0x11b1,1,"}, 
+  {"NtGdiBitBlt","0x2e,0x100e,11,"}, 
+  {"NtMapCMFModule","0x2e,0x00a5,6,"}, 
+  {"NtGdiEngCheckAbort","0x2e,0x12d4,1,"}, 
+  {"NtGdiDdLock","0x2e,0x1056,3,"}, 
+  {"NtGdiBRUSHOBJ_ulGetBrushColor","0x2e,0x12bb,1,"}, 
+  {"NtQueryVirtualMemory","0x2e,0x010b,6,"}, 
+  {"0x2e.0x0039","NtCompleteConnectPort"}, 
+  {"0x2e.0x0038","NtCompareTokens"}, 
+  {"0x2e.0x0037","NtCompactKeys"}, 
+  {"0x2e.0x0036","NtCommitTransaction"}, 
+  {"0x2e.0x0035","NtCommitEnlistment"}, 
+  {"NtGdiDdSetColorKey","0x2e,0x105e,2,"}, 
+  {"0x2e.0x0034","NtCommitComplete"}, 
+  {"NtGdiSwapBuffers","0x2e,0x1132,1,"}, 
+  {"0x2e.0x0033","NtCloseObjectAuditAlarm"}, 
+  {"0x2e.0x0032","NtClose"}, 
+  {"0x2e.0x0031","NtClearEvent"}, 
+  {"0x2e.0x0030","NtCancelTimer"}, 
+  {"NtUserRealChildWindowFromPoint","0x2e,0x1204,3,"}, 
+  {"0x2e.0x0190","NtYieldExecution"}, 
+  {"NtUserCloseClipboard","0x2e,0x115d,0,"}, 
+  {"NtUserGetListBoxInfo","0x2e,0x11b5,1,"}, 
+  {"NtUserFillWindow","0x2e,0x118a,4,"}, 
+  {"NtGdiDeleteObjectApp","0x2e,0x107d,1,"}, 
+  {"NtPowerInformation","0x2e,0x00cd,5,"}, 
+  {"NtGdiGetServerMetaFileBits","0x2e,0x10ce,7,"}, 
+  {"NtResumeProcess","0x2e,0x012f,1,"}, 
+  {"NtGdiWidenPath","0x2e,0x1139,1,"}, 
+  {"0x2e.0x018e","NtWriteRequestData"}, 
+  {"0x2e.0x018d","NtWriteFileGather"}, 
+  {"NtUserEndTouchOperation","0x2e,0x128f,1,"}, 
+  {"NtUserDisplayConfigGetDeviceInfo","0x2e,0x1155,1,"}, 
+  {"NtGetNlsSectionPtr","0x2e,0x008d,5,"}, 
+  {"0x2e.0x018f","NtWriteVirtualMemory"}, 
+  {"0x2e.0x018a","NtWaitLowEventPair"}, 
+  {"NtUserChangeWindowMessageFilterEx","0x2e,0x1291,4,"}, 
+  {"NtCreateTimer","0x2e,0x0059,4,"}, 
+  {"NtGdiMaskBlt","0x2e,0x10ed,13,"}, 
+  {"0x2e.0x018c","NtWriteFile"}, 
+  {"0x2e.0x0028","NtAlpcSetInformation"}, 
+  {"0x2e.0x018b","NtWorkerFactoryWorkerReady"}, 
+  {"NtAlpcQueryInformation","0x2e,0x0024,5,"}, 
+  {"0x2e.0x0029","NtApphelpCacheControl"}, 
+  {"0x2e.0x0026","NtAlpcRevokeSecurityContext"}, 
+  {"NtExtendSection","0x2e,0x0078,2,"}, 
+  {"NtUserPhysicalToLogicalPoint","0x2e,0x11fb,2,"}, 
+  {"0x2e.0x0027","NtAlpcSendWaitReceivePort"}, 
+  {"0x2e.0x0024","NtAlpcQueryInformation"}, 
+  {"NtGdiDdAddAttachedSurface","0x2e,0x1036,3,"}, 
+  {"0x2e.0x0025","NtAlpcQueryInformationMessage"}, 
+  {"0x2e.0x0022","NtAlpcOpenSenderProcess"}, 
+  {"0x2e.0x0023","NtAlpcOpenSenderThread"}, 
+  {"0x2e.0x0020","NtAlpcDisconnectPort"}, 
+  {"NtGdiGetRegionData","0x2e,0x10cc,3,"}, 
+  {"0x2e.0x0021","NtAlpcImpersonateClientOfPort"}, 
+  {"NtUserInitialize","0x2e,0x11d9,2,"}, 
+  {"0x2e.0x003f","NtCreateEnlistment"}, 
+  {"0x2e.0x003e","NtCreateDirectoryObject"}, 
+  {"NtUserSetGestureConfig","0x2e,0x1296,5,"}, 
+  {"0x2e.0x003d","NtCreateDebugObject"}, 
+  {"0x2e.0x003c","NtContinue"}, 
+  {"0x2e.0x003b","NtConnectPort"}, 
+  {"NtSuspendProcess","0x2e,0x016e,1,"}, 
+  {"0x2e.0x003a","NtCompressKey"}, 
+  {"NtGdiExtSelectClipRgn","0x2e,0x1094,3,"}, 
+  {"NtGdiDdDDICloseAdapter","0x2e,0x12f9,1,"}, 
+  {"NtQueueApcThreadEx","0x2e,0x010e,6,"}, 
+  {"0x2e.0x130f","NtGdiDdDDISetQueuedLimit"}, 
+  {"NtUserSetImeOwnerWindow","0x2e,0x1227,2,"}, 
+  {"NtGdiGetUFI","0x2e,0x10db,6,"}, 
+  {"0x2e.0x130d","NtGdiDdDDIReleaseProcessVidPnSourceOwners"}, 
+  {"NtGdiResizePalette","0x2e,0x1105,2,"}, 
+  {"0x2e.0x130e","NtGdiDdDDIGetScanLine"}, 
+  {"NtGdiGetNumberOfPhysicalMonitors","0x2e,0x1324,2,"}, 
+  {"0x2e.0x130b","NtGdiDdDDISetProcessSchedulingPriorityClass"}, 
+  {"0x2e.0x002f","NtCancelSynchronousIoFile"}, 
+  {"0x2e.0x130c","NtGdiDdDDIGetProcessSchedulingPriorityClass"}, 
+  {"NtUserQueryDisplayConfig","0x2e,0x1154,6,"}, 
+  {"0x2e.0x002d","NtCancelIoFile"}, 
+  {"0x2e.0x130a","NtGdiDdDDIGetContextSchedulingPriority"}, 
+  {"NtImpersonateAnonymousToken","0x2e,0x0091,1,"}, 
+  {"0x2e.0x002e","NtCancelIoFileEx"}, 
+  {"0x2e.0x002b","NtAssignProcessToJobObject"}, 
+  {"0x2e.0x002c","NtCallbackReturn"}, 
+  {"NtGdiDdCreateSurface","0x2e,0x103f,8,"}, 
+  {"0x2e.0x002a","NtAreMappedFilesTheSame"}, 
+  {"0x2e.0x1328","NtGdiDDCCIGetVCPFeature"}, 
+  {"0x2e.0x1329","NtGdiDDCCISetVCPFeature"}, 
+  {"NtUserShowSystemCursor","0x2e,0x1333,1,"}, 
+  {"0x2e.0x1324","NtGdiGetNumberOfPhysicalMonitors"}, 
+  {"NtGdiExtEscape","0x2e,0x1091,8,"}, 
+  {"NtGdiSetFontEnumeration","0x2e,0x111a,1,"}, 
+  {"0x2e.0x1325","NtGdiGetPhysicalMonitors"}, 
+  {"0x2e.0x1326","NtGdiGetPhysicalMonitorDescription"}, 
+  {"0x2e.0x1327","NtGdiDestroyPhysicalMonitor"}, 
+  {"NtCreateThreadEx","0x2e,0x0058,11,"}, 
+  {"NtCreateToken","0x2e,0x005a,13,"}, 
+  {"0x2e.0x1320","NtGdiDdDDICheckVidPnExclusiveOwnership"}, 
+  {"0x2e.0x1321","NtGdiDdDDICheckSharedResourceAccess"}, 
+  {"NtLockVirtualMemory","0x2e,0x00a2,4,"}, 
+  {"0x2e.0x1322","DxgStubEndMoCompFrame"}, 
+  {"NtQueryBootOptions","0x2e,0x00db,2,"}, 
+  {"NtGdiDdDDIWaitForIdle","0x2e,0x1313,1,"}, 
+  {"0x2e.0x1323","DxgStubContextDestroyAll"}, 
+  {"NtQueryPerformanceCounter","0x2e,0x00fb,2,"}, 
+  {"NtGdiDdDDISetContextSchedulingPriority","0x2e,0x1309,1,"}, 
+  {"NtGdiGetRandomRgn","0x2e,0x10c9,3,"}, 
+  {"NtQueryVolumeInformationFile","0x2e,0x010c,5,"}, 
+  {"0x2e.0x0185","NtWaitForMultipleObjects"}, 
+  {"0x2e.0x0184","NtWaitForKeyedEvent"}, 
+  {"NtDuplicateObject","0x2e,0x006f,7,"}, 
+  {"0x2e.0x0187","NtWaitForSingleObject"}, 
+  {"0x2e.0x0186","NtWaitForMultipleObjects32"}, 
+  {"0x2e.0x0181","NtUnmapViewOfSection"}, 
+  {"0x2e.0x0180","NtUnlockVirtualMemory"}, 
+  {"NtUserDisplayConfigSetDeviceInfo","0x2e,0x1156,1,"}, 
+  {"0x2e.0x0183","NtWaitForDebugEvent"}, 
+  {"0x2e.0x0182","NtVdmControl"}, 
+  {"NtSetValueKey","0x2e,0x0166,6,"}, 
+  {"NtUserMNDragLeave","0x2e,0x11ec,0,"}, 
+  {"0x2e.0x0189","NtWaitHighEventPair"}, 
+  {"NtUserGetDC","0x2e,0x11a4,1,"}, 
+  {"0x2e.0x0188","NtWaitForWorkViaWorkerFactory"}, 
+  {"NtGdiDeleteColorTransform","0x2e,0x107c,2,"}, 
+  {"NtUserThunkedMenuItemInfo","0x2e,0x1256,6,"}, 
+  {"0x2e.0x017b","NtUnloadDriver"}, 
+  {"0x2e.0x017c","NtUnloadKey"}, 
+  {"0x2e.0x017a","NtUmsThreadYield"}, 
+  {"0x2e.0x017f","NtUnlockFile"}, 
+  {"0x2e.0x017d","NtUnloadKey2"}, 
+  {"0x2e.0x017e","NtUnloadKeyEx"}, 
+  {"0x2e.0x0158","NtSetLowEventPair"}, 
+  {"NtGdiDvpAcquireNotification","0x2e,0x1077,3,"}, 
+  {"0x2e.0x0159","NtSetLowWaitHighEventPair"}, 
+  {"NtGdiGetFontFileData","0x2e,0x10b7,5,"}, 
+  {"0x2e.0x132d","NtGdiDDCCIGetTimingReport"}, 
+  {"NtUserSetThreadDesktop","0x2e,0x123a,1,"}, 
+  {"0x2e.0x132e","NtGdiDdCreateFullscreenSprite"}, 
+  {"0x2e.0x132f","NtGdiDdNotifyFullscreenSpriteUpdate"}, 
+  {"NtGdiPATHOBJ_vGetBounds","0x2e,0x12ce,2,"}, 
+  {"0x2e.0x0150","NtSetInformationToken"}, 
+  {"0x2e.0x0151","NtSetInformationTransaction"}, 
+  {"0x2e.0x132a","NtGdiDDCCISaveCurrentSettings"}, 
+  {"0x2e.0x0152","NtSetInformationTransactionManager"}, 
+  {"0x2e.0x132b","NtGdiDDCCIGetCapabilitiesStringLength"}, 
+  {"0x2e.0x0153","NtSetInformationWorkerFactory"}, 
+  {"0x2e.0x132c","NtGdiDDCCIGetCapabilitiesString"}, 
+  {"NtUserInitTask","0x2e,0x11db,12,"}, 
+  {"0x2e.0x0154","NtSetIntervalProfile"}, 
+  {"0x2e.0x0155","NtSetIoCompletion"}, 
+  {"NtGdiDdDDIDestroyOverlay","0x2e,0x1303,1,"}, 
+  {"0x2e.0x0156","NtSetIoCompletionEx"}, 
+  {"0x2e.0x0157","NtSetLdtEntries"}, 
+  {"NtCreateProcessEx","0x2e,0x0050,9,"}, 
+  {"NtSetIoCompletion","0x2e,0x0155,5,"}, 
+  {"0x2e.0x1308","NtGdiDdDDIDestroyDCFromMemory"}, 
+  {"0x2e.0x1309","NtGdiDdDDISetContextSchedulingPriority"}, 
+  {"NtModifyDriverEntry","0x2e,0x00aa,1,"}, 
+  {"0x2e.0x1306","NtGdiDdDDIGetDeviceState"}, 
+  {"0x2e.0x1307","NtGdiDdDDICreateDCFromMemory"}, 
+  {"0x2e.0x1304","NtGdiDdDDIWaitForVerticalBlankEvent"}, 
+  {"0x2e.0x1305","NtGdiDdDDISetGammaRamp"}, 
+  {"NtGdiDdDDISetGammaRamp","0x2e,0x1305,1,"}, 
+  {"0x2e.0x014a","NtSetInformationJobObject"}, 
+  {"0x2e.0x1302","NtGdiDdDDIFlipOverlay"}, 
+  {"0x2e.0x1303","NtGdiDdDDIDestroyOverlay"}, 
+  {"0x2e.0x014c","NtSetInformationObject"}, 
+  {"NtLoadKey","0x2e,0x009c,2,"}, 
+  {"0x2e.0x1300","NtGdiDdDDICreateOverlay"}, 
+  {"0x2e.0x014b","NtSetInformationKey"}, 
+  {"0x2e.0x1301","NtGdiDdDDIUpdateOverlay"}, 
+  {"0x2e.0x014e","NtSetInformationResourceManager"}, 
+  {"0x2e.0x014d","NtSetInformationProcess"}, 
+  {"NtIsSystemResumeAutomatic","0x2e,0x0098,0,"}, 
+  {"NtSetIntervalProfile","0x2e,0x0154,2,"}, 
+  {"NtGdiGetDCDword","0x2e,0x10ac,3,"}, 
+  {"NtAssignProcessToJobObject","0x2e,0x002b,2,"}, 
+  {"0x2e.0x014f","NtSetInformationThread"}, 
+  {"NtLockFile","0x2e,0x009f,10,"}, 
+  {"NtGdiSTROBJ_bEnumPositionsOnly","0x2e,0x12ca,3,"}, 
+  {"NtUserRegisterSessionPort","0x2e,0x127c,2,"}, 
+  {"NtCreateDirectoryObject","0x2e,0x003e,3,"}, 
+  {"NtGdiDvpGetVideoPortBandwidth","0x2e,0x106d,2,"}, 
+  {"NtUserHiliteMenuItem","0x2e,0x11d6,4,"}, 
+  {"NtGdiGetEmbUFI","0x2e,0x10dc,7,"}, 
+  {"NtUserResolveDesktopForWOW","0x2e,0x1213,1,"}, 
+  {"NtUserGetWindowCompositionInfo","0x2e,0x11cd,2,"}, 
+  {"0x2e.0x1338","NtUserHwndSetRedirectionInfo"}, 
+  {"NtAlpcDeleteSectionView","0x2e,0x001e,3,"}, 
+  {"NtOpenMutant","0x2e,0x00bb,3,"}, 
+  {"NtGetPlugPlayEvent","0x2e,0x008f,4,"}, 
+  {"0x2e.0x1335","NtUserMagSetContextInformation"}, 
+  {"0x2e.0x1334","NtUserMagControl"}, 
+  {"0x2e.0x1337","NtUserHwndQueryRedirectionInfo"}, 
+  {"NtGdiGetRgnBox","0x2e,0x10cd,2,"}, 
+  {"0x2e.0x1336","NtUserMagGetContextInformation"}, 
+  {"0x2e.0x1331","DxEngVisRgnUniq"}, 
+  {"NtReplyPort","0x2e,0x0126,2,"}, 
+  {"0x2e.0x015a","NtSetQuotaInformationFile"}, 
+  {"0x2e.0x1330","NtGdiDdDestroyFullscreenSprite"}, 
+  {"0x2e.0x015b","NtSetSecurityObject"}, 
+  {"0x2e.0x1333","NtUserShowSystemCursor"}, 
+  {"0x2e.0x015c","NtSetSystemEnvironmentValue"}, 
+  {"0x2e.0x1332","NtUserSetMirrorRendering"}, 
+  {"0x2e.0x015d","NtSetSystemEnvironmentValueEx"}, 
+  {"0x2e.0x015e","NtSetSystemInformation"}, 
+  {"NtGdiDvpCreateVideoPort","0x2e,0x106a,2,"}, 
+  {"NtResumeThread","0x2e,0x0130,2,"}, 
+  {"0x2e.0x015f","NtSetSystemPowerState"}, 
+  {"NtGdiDdCreateSurfaceEx","0x2e,0x1061,3,"}, 
+  {"0x2e.0x0178","NtTraceEvent"}, 
+  {"0x2e.0x0179","NtTranslateFilePath"}, 
+  {"NtGdiDdDDIOpenAdapterFromDeviceName","0x2e,0x12f7,1,"}, 
+  {"0x2e.0x0172","NtTerminateProcess"}, 
+  {"NtUserHungWindowFromGhostWindow","0x2e,0x11d7,1,"}, 
+  {"0x2e.0x0173","NtTerminateThread"}, 
+  {"0x2e.0x0170","NtSystemDebugControl"}, 
+  {"NtGdiDdDDIConfigureSharedResource","0x2e,0x131e,1,"}, 
+  {"0x2e.0x0171","NtTerminateJobObject"}, 
+  {"0x2e.0x0176","NtThawTransactions"}, 
+  {"0x2e.0x0177","NtTraceControl"}, 
+  {"0x2e.0x0174","NtTestAlert"}, 
+  {"0x2e.0x0175","NtThawRegistry"}, 
+  {"NtUserDefSetText","0x2e,0x116d,2,"}, 
+  {"NtGdiCreateBitmapFromDxSurface","0x2e,0x101b,5,"}, 
+  {"NtUserDestroyInputContext","0x2e,0x1171,1,"}, 
+  {"NtUserPostThreadMessage","0x2e,0x11fd,4,"}, 
+  {"NtUserGetThreadState","0x2e,0x11c7,1,"}, 
+  {"NtUserEvent","0x2e,0x1188,1,"}, 
+  {"NtUserEndMenu","0x2e,0x1183,0,"}, 
+  {"NtGdiMoveTo","0x2e,0x10f0,4,"}, 
+  {"0x2e.0x0149","NtSetInformationFile"}, 
+  {"NtOpenFile","0x2e,0x00b3,6,"}, 
+  {"0x2e.0x0148","NtSetInformationEnlistment"}, 
+  {"NtGdiGetFontUnicodeRanges","0x2e,0x10e1,2,"}, 
+  {"0x2e.0x0141","NtSetDriverEntryOrder"}, 
+  {"0x2e.0x0140","NtSetDefaultUILanguage"}, 
+  {"0x2e.0x0143","NtSetEvent"}, 
+  {"NtUserPaintMenuBar","0x2e,0x125c,6,"}, 
+  {"0x2e.0x0142","NtSetEaFile"}, 
+  {"NtGdiGetCertificateSize","0x2e,0x10a3,3,"}, 
+  {"0x2e.0x0145","NtSetHighEventPair"}, 
+  {"0x2e.0x0144","NtSetEventBoostPriority"}, 
+  {"NtSetInformationKey","0x2e,0x014b,4,"}, 
+  {"NtGdiGetGlyphOutline","0x2e,0x10bc,8,"}, 
+  {"0x2e.0x0147","NtSetInformationDebugObject"}, 
+  {"NtQueryInformationProcess","0x2e,0x00ea,5,"}, 
+  {"0x2e.0x0146","NtSetHighWaitLowEventPair"}, 
+  {"NtRecoverResourceManager","0x2e,0x0117,1,"}, 
+  {"NtUserBlockInput","0x2e,0x1141,1,"}, 
+  {"NtUserEnumDisplayMonitors","0x2e,0x1186,4,"}, 
+  {"0x2e.0x1319","NtGdiDdDDICreateKeyedMutex"}, 
+  {"0x2e.0x1318","NtGdiDdDDISharedPrimaryUnLockNotification"}, 
+  {"NtRemoveIoCompletion","0x2e,0x011f,5,"}, 
+  {"0x2e.0x1317","NtGdiDdDDISharedPrimaryLockNotification"}, 
+  {"0x2e.0x1316","NtGdiDdDDISetDisplayPrivateDriverFormat"}, 
+  {"0x2e.0x1315","NtGdiDdDDICheckExclusiveOwnership"}, 
+  {"0x2e.0x1314","NtGdiDdDDICheckMonitorPowerState"}, 
+  {"0x2e.0x013f","NtSetDefaultLocale"}, 
+  {"0x2e.0x1313","NtGdiDdDDIWaitForIdle"}, 
+  {"0x2e.0x1312","NtGdiDdDDICheckOcclusion"}, 
+  {"0x2e.0x013d","NtSetDebugFilterState"}, 
+  {"0x2e.0x1311","NtGdiDdDDIInvalidateActiveVidPn"}, 
+  {"NtUserDisableThreadIme","0x2e,0x1174,1,"}, 
+  {"0x2e.0x013e","NtSetDefaultHardErrorPort"}, 
+  {"0x2e.0x1310","NtGdiDdDDIPollDisplayChildren"}, 
+  {"0x2e.0x013b","NtSetBootOptions"}, 
+  {"NtGdiExtCreatePen","0x2e,0x108f,11,"}, 
+  {"0x2e.0x013c","NtSetContextThread"}, 
+  {"0x2e.0x013a","NtSetBootEntryOrder"}, 
+  {"NtQuerySecurityObject","0x2e,0x0100,5,"}, 
+  {"NtUserQueryWindow","0x2e,0x1203,2,"}, 
+  {"NtGdiDdResetVisrgn","0x2e,0x105d,2,"}, 
+  {"NtGdiDoPalette","0x2e,0x1082,6,"}, 
+  {"NtGdiDdCreateFullscreenSprite","0x2e,0x132e,4,"}, 
+  {"0x2e.0x0118","NtRecoverTransactionManager"}, 
+  {"0x2e.0x0119","NtRegisterProtocolAddressInformation"}, 
+  {"NtUserCalculatePopupWindowPosition","0x2e,0x125a,5,"}, 
+  {"NtUserShowScrollBar","0x2e,0x124e,3,"}, 
+  {"NtGdiFlush","0x2e,0x1099,0,"}, 
+  {"0x2e.0x0114","NtReadRequestData"}, 
+  {"NtUserGetSystemMenu","0x2e,0x11c5,2,"}, 
+  {"0x2e.0x0115","NtReadVirtualMemory"}, 
+  {"0x2e.0x0116","NtRecoverEnlistment"}, 
+  {"0x2e.0x0117","NtRecoverResourceManager"}, 
+  {"0x2e.0x0110","NtRaiseHardError"}, 
+  {"NtQueryEvent","0x2e,0x00e3,5,"}, 
+  {"0x2e.0x0111","NtReadFile"}, 
+  {"NtCancelIoFileEx","0x2e,0x002e,3,"}, 
+  {"0x2e.0x0112","NtReadFileScatter"}, 
+  {"0x2e.0x0113","NtReadOnlyEnlistment"}, 
+  {"NtCreateWaitablePort","0x2e,0x005e,5,"}, 
+  {"NtGdiDdDDISharedPrimaryLockNotification","0x2e,0x1317,1,"}, 
+  {"0x2e.0x010e","NtQueueApcThreadEx"}, 
+  {"0x2e.0x010d","NtQueueApcThread"}, 
+  {"0x2e.0x010f","NtRaiseException"}, 
+  {"NtUserSetWindowLong","0x2e,0x1242,4,"}, 
+  {"0x2e.0x010a","NtQueryValueKey"}, 
+  {"0x2e.0x010c","NtQueryVolumeInformationFile"}, 
+  {"0x2e.0x010b","NtQueryVirtualMemory"}, 
+  {"0x2e.0x0169","NtShutdownWorkerFactory"}, 
+  {"0x2e.0x0168","NtShutdownSystem"}, 
+  {"NtUserInitializeClientPfnArrays","0x2e,0x11da,4,"}, 
+  {"0x2e.0x131f","NtGdiDdDDIGetOverlayState"}, 
+  {"0x2e.0x131e","NtGdiDdDDIConfigureSharedResource"}, 
+  {"NtGdiGetNearestPaletteIndex","0x2e,0x10c3,2,"}, 
+  {"0x2e.0x131d","NtGdiDdDDIReleaseKeyedMutex"}, 
+  {"NtGdiGetBitmapBits","0x2e,0x109f,3,"}, 
+  {"0x2e.0x0163","NtSetTimerEx"}, 
+  {"0x2e.0x131c","NtGdiDdDDIAcquireKeyedMutex"}, 
+  {"NtGdiGetTextExtent","0x2e,0x10d6,5,"}, 
+  {"0x2e.0x0162","NtSetTimer"}, 
+  {"0x2e.0x131b","NtGdiDdDDIDestroyKeyedMutex"}, 
+  {"0x2e.0x0161","NtSetThreadExecutionState"}, 
+  {"0x2e.0x131a","NtGdiDdDDIOpenKeyedMutex"}, 
+  {"0x2e.0x0160","NtSetSystemTime"}, 
+  {"0x2e.0x0167","NtSetVolumeInformationFile"}, 
+  {"0x2e.0x0166","NtSetValueKey"}, 
+  {"0x2e.0x0165","NtSetUuidSeed"}, 
+  {"0x2e.0x0164","NtSetTimerResolution"}, 
+  {"NtGdiDdFlipToGDISurface","0x2e,0x104a,2,"}, 
+  {"NtGdiRemoveMergeFont","0x2e,0x1005,2,"}, 
+  {"NtGdiSetDeviceGammaRamp","0x2e,0x1118,2,"}, 
+  {"NtQueryDirectoryFile","0x2e,0x00df,11,"}, 
+  {"NtUserCallHwndOpt","0x2e,0x1148,2,"}, 
+  {"NtUserUnregisterClass","0x2e,0x1263,3,"}, 
+  {"0x2e.0x011d","NtReleaseSemaphore"}, 
+  {"0x2e.0x011e","NtReleaseWorkerFactoryWorker"}, 
+  {"NtGdiDdDDISetAllocationPriority","0x2e,0x12e3,1,"}, 
+  {"NtGdiStartDoc","0x2e,0x112c,4,"}, 
+  {"0x2e.0x011f","NtRemoveIoCompletion"}, 
+  {"NtUserRemoteRedrawRectangle","0x2e,0x1278,4,"}, 
+  {"NtUserCreateCaret","0x2e,0x1165,4,"}, 
+  {"0x2e.0x011a","NtRegisterThreadTerminatePort"}, 
+  {"0x2e.0x011b","NtReleaseKeyedEvent"}, 
+  {"0x2e.0x011c","NtReleaseMutant"}, 
+  {"NtDrawText","0x2e,0x006e,1,"}, 
+  {"NtUserGetKeyNameText","0x2e,0x11b3,3,"}, 
+  {"NtGdiDdReenableDirectDrawObject","0x2e,0x105a,2,"}, 
+  {"NtGdiDvpColorControl","0x2e,0x1069,2,"}, 
+  {"NtUserHwndQueryRedirectionInfo","0x2e,0x1337,4,"}, 
+  {"0x2e.0x0138","NtSecureConnectPort"}, 
+  {"0x2e.0x0139","NtSerializeBoot"}, 
+  {"NtAdjustGroupsToken","0x2e,0x000b,6,"}, 
+  {"0x2e.0x0136","NtSaveKeyEx"}, 
+  {"0x2e.0x0137","NtSaveMergedKeys"}, 
+  {"0x2e.0x0134","NtRollforwardTransactionManager"}, 
+  {"0x2e.0x0135","NtSaveKey"}, 
+  {"NtGdiDdDDISetProcessSchedulingPriorityClass","0x2e,0x130b,2,"}, 
+  {"0x2e.0x0132","NtRollbackEnlistment"}, 
+  {"0x2e.0x0133","NtRollbackTransaction"}, 
+  {"0x2e.0x0130","NtResumeThread"}, 
+  {"0x2e.0x0131","NtRollbackComplete"}, 
+  {"NtGdiRestoreDC","0x2e,0x1106,2,"}, 
+  {"NtQueryIoCompletion","0x2e,0x00f3,5,"}, 
+  {"0x2e.0x016c","NtStartProfile"}, 
+  {"NtUserBuildHwndList","0x2e,0x1143,7,"}, 
+  {"0x2e.0x016b","NtSinglePhaseReject"}, 
+  {"NtGdiDdDDIGetSharedPrimaryPlugin","0x2e,0x12fa,1,"}, 
+  {"0x2e.0x016a","NtSignalAndWaitForSingleObject"}, 
+  {"0x2e.0x016f","NtSuspendThread"}, 
+  {"0x2e.0x016e","NtSuspendProcess"}, 
+  {"0x2e.0x016d","NtStopProfile"}, 
+  {"NtUserOpenDesktop","0x2e,0x11f4,3,"}, 
+  {"NtPrivilegedServiceAuditAlarm","0x2e,0x00d3,5,"}, 
+  {"NtUserValidatePluginSecure","0x2e,0x126d,1,"}, 
+  {"NtGdiSTROBJ_vEnumStart","0x2e,0x12cc,1,"}, 
+  {"0x2e.0x0109","NtQueryTimerResolution"}, 
+  {"0x2e.0x0108","NtQueryTimer"}, 
+  {"0x2e.0x0105","NtQuerySystemInformation"}, 
+  {"0x2e.0x0104","NtQuerySystemEnvironmentValueEx"}, 
+  {"0x2e.0x0107","NtQuerySystemTime"}, 
+  {"0x2e.0x0106","NtQuerySystemInformationEx"}, 
+  {"0x2e.0x0101","NtQuerySemaphore"}, 
+  {"NtGdiDeleteColorSpace","0x2e,0x107b,1,"}, 
+  {"0x2e.0x0100","NtQuerySecurityObject"}, 
+  {"0x2e.0x0103","NtQuerySystemEnvironmentValue"}, 
+  {"0x2e.0x0102","NtQuerySymbolicLinkObject"}, 
+  {"NtGdiDvpCanCreateVideoPort","0x2e,0x1068,2,"}, 
+  {"NtOpenProcessToken","0x2e,0x00bf,3,"}, 
+  {"NtAllocateVirtualMemory","0x2e,0x0013,6,"}, 
+  {"NtCommitEnlistment","0x2e,0x0035,2,"}, 
+  {"NtGdiDeleteClientObj","0x2e,0x107a,1,"}, 
+  {"NtGdiDDCCIGetVCPFeature","0x2e,0x1328,5,"}, 
+  {"NtSetQuotaInformationFile","0x2e,0x015a,4,"}, 
+  {"NtClearEvent","0x2e,0x0031,1,"}, 
+  {"NtUserGetMouseMovePointsEx","0x2e,0x11ba,5,"}, 
+  {"NtCompareTokens","0x2e,0x0038,3,"}, 
+  {"NtGdiEngPaint","0x2e,0x12ab,5,"}, 
+  {"NtQueryInformationResourceManager","0x2e,0x00eb,5,"}, 
+  {"NtSetTimer","0x2e,0x0162,7,"}, 
+  {"NtGdiDdGetFlipStatus","0x2e,0x1050,2,"}, 
+  {"NtUserNotifyWinEvent","0x2e,0x11f2,4,"}, 
+  {"NtGdiOpenDCW","0x2e,0x10f3,8,"}, 
+  {"NtCompactKeys","0x2e,0x0037,2,"}, 
+  {"NtUnloadKey2","0x2e,0x017d,2,"}, 
+  {"NtAllocateUserPhysicalPages","0x2e,0x0011,3,"}, 
+  {"NtUserInternalGetWindowIcon","0x2e,0x11dd,2,"}, 
+  {"NtSetInformationToken","0x2e,0x0150,4,"}, 
+  {"NtGdiDdCreateDirectDrawObject","0x2e,0x103e,1,"}, 
+  {"NtUserSetWindowWord","0x2e,0x124b,3,"}, 
+  {"NtOpenKeyTransacted","0x2e,0x00b9,4,"}, 
+  {"NtGdiExtTextOutW","0x2e,0x1095,9,"}, 
+  {"NtEnumerateBootEntries","0x2e,0x0072,2,"}, 
+  {"0x2e.0x0129","NtReplyWaitReplyPort"}, 
+  {"NtGdiDdDDISharedPrimaryUnLockNotification","0x2e,0x1318,1,"}, 
+  {"0x2e.0x0128","NtReplyWaitReceivePortEx"}, 
+  {"0x2e.0x0127","NtReplyWaitReceivePort"}, 
+  {"NtGdiDdSetGammaRamp","0x2e,0x1060,3,"}, 
+  {"0x2e.0x0126","NtReplyPort"}, 
+  {"0x2e.0x0125","NtReplacePartitionUnit"}, 
+  {"0x2e.0x0124","NtReplaceKey"}, 
+  {"NtOpenEnlistment","0x2e,0x00b0,5,"}, 
+  {"NtLoadKeyEx","0x2e,0x009e,8,"}, 
+  {"0x2e.0x0123","NtRenameTransactionManager"}, 
+  {"0x2e.0x118d","NtUserFlashWindowEx"}, 
+  {"0x2e.0x0122","NtRenameKey"}, 
+  {"NtGdiDestroyPhysicalMonitor","0x2e,0x1327,1,"}, 
+  {"0x2e.0x118e","NtUserFrostCrashedWindow"}, 
+  {"NtUserTranslateMessage","0x2e,0x125e,2,"}, 
+  {"0x2e.0x0121","NtRemoveProcessDebug"}, 
+  {"0x2e.0x118f","NtUserGetAltTabInfo"}, 
+  {"NtUserBuildHimcList","0x2e,0x1142,4,"}, 
+  {"0x2e.0x0120","NtRemoveIoCompletionEx"}, 
+  {"NtUserRegisterClassExWOW","0x2e,0x1208,7,"}, 
+  {"NtGdiDdDDIDestroyContext","0x2e,0x12e8,1,"}, 
+  {"0x2e.0x118a","NtUserFillWindow"}, 
+  {"0x2e.0x118b","NtUserFindExistingCursorIcon"}, 
+  {"0x2e.0x118c","NtUserFindWindowEx"}, 
+  {"NtUserGetClassInfoEx","0x2e,0x1196,5,"}, 
+  {"NtWriteRequestData","0x2e,0x018e,6,"}, 
+  {"NtPlugPlayControl","0x2e,0x00cc,3,"}, 
+  {"NtUserSetMenu","0x2e,0x122b,3,"}, 
+  {"NtStartProfile","0x2e,0x016c,1,"}, 
+  {"NtNotifyChangeDirectoryFile","0x2e,0x00ab,9,"}, 
+  {"NtGdiCancelDC","0x2e,0x100f,1,"}, 
+  {"NtGdiCreatePaletteInternal","0x2e,0x1029,2,"}, 
+  {"NtUserSetDisplayConfig","0x2e,0x1153,5,"}, 
+  {"NtEnumerateSystemEnvironmentValuesEx","0x2e,0x0075,3,"}, 
+  {"NtReplaceKey","0x2e,0x0124,3,"}, 
+  {"NtSetDefaultUILanguage","0x2e,0x0140,1,"}, 
+  {"NtGdiDdDDICreateContext","0x2e,0x12e7,1,"}, 
+  {"NtGdiLineTo","0x2e,0x10ea,3,"}, 
+  {"NtLoadKey2","0x2e,0x009d,3,"}, 
+  {"NtUserIsTopLevelWindow","0x2e,0x11e1,1,"}, 
+  {"NtGdiDdGetBltStatus","0x2e,0x104c,2,"}, 
+  {"NtGdiSetSystemPaletteUse","0x2e,0x1128,2,"}, 
+  {"NtGdiDdDDIGetPresentHistory","0x2e,0x12fe,1,"}, 
+  {"NtCreateEvent","0x2e,0x0040,5,"}, 
+  {"NtSetInformationWorkerFactory","0x2e,0x0153,4,"}, 
+  {"NtQuerySystemInformation","0x2e,0x0105,4,"}, 
+  {"0x2e.0x012f","NtResumeProcess"}, 
+  {"0x2e.0x012e","NtRestoreKey"}, 
+  {"0x2e.0x012d","NtResetWriteWatch"}, 
+  {"0x2e.0x012c","NtResetEvent"}, 
+  {"NtGdiFullscreenControl","0x2e,0x109c,5,"}, 
+  {"0x2e.0x012b","NtRequestWaitReplyPort"}, 
+  {"NtGdiEngDeleteClip","0x2e,0x12ba,1,"}, 
+  {"NtUserSetMenuContextHelpId","0x2e,0x122c,2,"}, 
+  {"0x2e.0x012a","NtRequestPort"}, 
+  {"NtCreateProfileEx","0x2e,0x0052,10,"}, 
+  {"NtGdiDdGetDriverInfo","0x2e,0x104e,2,"}, 
+  {"NtGdiClearBitmapAttributes","0x2e,0x1012,2,"}, 
+  {"NtGdiCreateHalftonePalette","0x2e,0x1025,1,"}, 
+  {"NtGdiEngUnlockSurface","0x2e,0x12a2,1,"}, 
+  {"NtGdiGetStats","0x2e,0x10d0,5,"}, 
+  {"0x2e.0x1184","NtUserEndPaint"}, 
+  {"0x2e.0x1185","NtUserEnumDisplayDevices"}, 
+  {"0x2e.0x1186","NtUserEnumDisplayMonitors"}, 
+  {"0x2e.0x1187","NtUserEnumDisplaySettings"}, 
+  {"NtUserGetClipCursor","0x2e,0x119d,1,"}, 
+  {"0x2e.0x1180","NtUserEnableMenuItem"}, 
+  {"0x2e.0x1181","NtUserEnableScrollBar"}, 
+  {"0x2e.0x1182","NtUserEndDeferWindowPosEx"}, 
+  {"0x2e.0x1183","NtUserEndMenu"}, 
+  {"NtUserLockWindowStation","0x2e,0x11e4,1,"}, 
+  {"0x2e.0x1188","NtUserEvent"}, 
+  {"0x2e.0x1189","NtUserExcludeUpdateRgn"}, 
+  {"NtUserGetWindowDC","0x2e,0x11cf,1,"}, 
+  {"NtAllocateLocallyUniqueId","0x2e,0x000f,1,"}, 
+  {"NtUserThunkedMenuInfo","0x2e,0x1255,2,"}, 
+  {"NtUserQueryInformationThread","0x2e,0x1200,4,"}, 
+  {"NtGdiUnrealizeObject","0x2e,0x1137,1,"}, 
+  {"NtGdiCloseFigure","0x2e,0x1011,1,"}, 
+  {"NtUserGetInputLocaleInfo","0x2e,0x11ae,2,"}, 
+  {"NtGdiFONTOBJ_cGetAllGlyphPlugins","0x2e,0x12c8,2,"}, 
+  {"NtGdiScaleWindowExtEx","0x2e,0x110a,6,"}, 
+  {"NtGdiCreateColorTransform","0x2e,0x101e,8,"}, 
+  {"NtOpenDirectoryObject","0x2e,0x00af,3,"}, 
+  {"NtOpenKeyEx","0x2e,0x00b7,4,"}, 
+  {"NtUserCalcMenuBar","0x2e,0x125b,5,"}, 
+  {"NtUserConvertMemPlugin","0x2e,0x1161,2,"}, 
+  {"NtSetInformationResourceManager","0x2e,0x014e,4,"}, 
+  {"NtUserGetMessage","0x2e,0x11b9,4,"}, 
+  {"NtRecoverEnlistment","0x2e,0x0116,2,"}, 
+  {"NtUserCallHwndParam","0x2e,0x1149,3,"}, 
+  {"NtGdiSetTextJustification","0x2e,0x1129,3,"}, 
+  {"NtCreateUserProcess","0x2e,0x005d,11,"}, 
+  {"NtUserWaitForMsgAndEvent","0x2e,0x1272,1,"}, 
+  {"0x2e.0x114a","NtUserCallHwndParamLock"}, 
+  {"NtSetSystemTime","0x2e,0x0160,2,"}, 
+  {"0x2e.0x114b","NtUserCallMsgFilter"}, 
+  {"0x2e.0x114c","NtUserCallNextHookEx"}, 
+  {"0x2e.0x114d","NtUserCallNoParam"}, 
+  {"NtGdiCreateDIBBrush","0x2e,0x1021,6,"}, 
+  {"0x2e.0x114e","NtUserCallOneParam"}, 
+  {"0x2e.0x114f","NtUserCallTwoParam"}, 
+  {"NtAlpcOpenSenderProcess","0x2e,0x0022,6,"}, 
+  {"NtUserGetMenuBarInfo","0x2e,0x11b6,4,"}, 
+  {"NtQueryQuotaInformationFile","0x2e,0x00fd,9,"}, 
+  {"NtUserCreateLocalMemPlugin","0x2e,0x1168,4,"}, 
+  {"NtAlpcCreateSecurityContext","0x2e,0x001b,3,"}, 
+  {"NtUserOpenWindowStation","0x2e,0x11f7,2,"}, 
+  {"NtUserFrostCrashedWindow","0x2e,0x118e,2,"}, 
+  {"NtUserClipCursor","0x2e,0x115c,1,"}, 
+  {"NtGdiDdCreateMoComp","0x2e,0x1041,2,"}, 
+  {"NtGdiCombineTransform","0x2e,0x1016,3,"}, 
+  {"0x2e.0x1195","NtUserGetCaretPos"}, 
+  {"NtUserGetObjectInformation","0x2e,0x11bb,5,"}, 
+  {"0x2e.0x1194","NtUserGetCaretBlinkTime"}, 
+  {"0x2e.0x1197","NtUserGetClassName"}, 
+  {"NtCreateResourceManager","0x2e,0x0053,7,"}, 
+  {"0x2e.0x1196","NtUserGetClassInfoEx"}, 
+  {"0x2e.0x1191","NtUserGetAppImeLevel"}, 
+  {"NtGdiEllipse","0x2e,0x1084,5,"}, 
+  {"0x2e.0x1190","NtUserGetAncestor"}, 
+  {"0x2e.0x1193","NtUserGetAtomName"}, 
+  {"NtGdiDdGetDriverState","0x2e,0x1035,1,"}, 
+  {"0x2e.0x1192","NtUserGetAsyncKeyState"}, 
+  {"NtGdiDdDDIReleaseProcessVidPnSourceOwners","0x2e,0x130d,1,"}, 
+  {"0x2e.0x1199","NtUserGetClipboardFormatName"}, 
+  {"NtUserGetAtomName","0x2e,0x1193,2,"}, 
+  {"0x2e.0x1198","NtUserGetClipboardData"}, 
+  {"NtAlpcConnectPort","0x2e,0x0016,11,"}, 
+  {"NtGdiEngTextOut","0x2e,0x12b0,10,"}, 
+  {"NtGdiSetColorAdjustment","0x2e,0x1116,2,"}, 
+  {"NtGdiGetDeviceWidth","0x2e,0x1121,1,"}, 
+  {"NtGdiDdDDIGetContextSchedulingPriority","0x2e,0x130a,1,"}, 
+  {"NtGdiCreatePatternBrushInternal","0x2e,0x102a,3,"}, 
+  {"NtInitializeNlsFiles","0x2e,0x0094,3,"}, 
+  {"NtGdiDrawEscape","0x2e,0x1083,4,"}, 
+  {"NtEnumerateTransactionObject","0x2e,0x0076,5,"}, 
+  {"NtUserGetScrollBarInfo","0x2e,0x11c4,3,"}, 
+  {"NtUserCreateInputContext","0x2e,0x1167,1,"}, 
+  {"NtUserBitBltSysBmp","0x2e,0x1140,8,"}, 
+  {"NtOpenSymbolicLinkObject","0x2e,0x00c5,3,"}, 
+  {"NtCreateSection","0x2e,0x0054,7,"}, 
+  {"NtGdiAbortPath","0x2e,0x1001,1,"}, 
+  {"NtGdiGetTextCharsetInfo","0x2e,0x10d5,3,"}, 
+  {"0x2e.0x1148","NtUserCallHwndOpt"}, 
+  {"NtOpenThreadToken","0x2e,0x00c7,4,"}, 
+  {"0x2e.0x1149","NtUserCallHwndParam"}, 
+  {"NtUserLoadKeyboardLayoutEx","0x2e,0x11e3,8,"}, 
+  {"NtGdiFONTOBJ_pQueryGlyphAttrs","0x2e,0x12c6,2,"}, 
+  {"NtGdiGetGlyphIndicesWInternal","0x2e,0x10bb,6,"}, 
+  {"NtUserDestroyMenu","0x2e,0x1172,1,"}, 
+  {"NtUserValidateRect","0x2e,0x126e,2,"}, 
+  {"NtShutdownSystem","0x2e,0x0168,1,"}, 
+  {"0x2e.0x1140","NtUserBitBltSysBmp"}, 
+  {"0x2e.0x1141","NtUserBlockInput"}, 
+  {"0x2e.0x1142","NtUserBuildHimcList"}, 
+  {"0x2e.0x1143","NtUserBuildHwndList"}, 
+  {"NtCommitTransaction","0x2e,0x0036,2,"}, 
+  {"0x2e.0x1144","NtUserBuildNameList"}, 
+  {"NtGdiSetBitmapDimension","0x2e,0x1112,4,"}, 
+  {"0x2e.0x1145","NtUserBuildPropList"}, 
+  {"0x2e.0x1146","NtUserCallHwnd"}, 
+  {"NtGdiDdDDIDestroySynchronizationObject","0x2e,0x12eb,1,"}, 
+  {"NtGdiGetTextFaceW","0x2e,0x10d8,4,"}, 
+  {"0x2e.0x1147","NtUserCallHwndLock"}, 
+  {"0x2e.0x119e","NtUserGetComboBoxInfo"}, 
+  {"0x2e.0x119d","NtUserGetClipCursor"}, 
+  {"0x2e.0x119f","NtUserGetControlBrush"}, 
+  {"NtGdiSetFontXform","0x2e,0x111b,3,"}, 
+  {"0x2e.0x119a","NtUserGetClipboardOwner"}, 
+  {"NtUserRemoteRedrawScreen","0x2e,0x1279,0,"}, 
+  {"NtUserRealWaitMessageEx","0x2e,0x1206,2,"}, 
+  {"NtYieldExecution","0x2e,0x0190,0,"}, 
+  {"0x2e.0x119c","NtUserGetClipboardViewer"}, 
+  {"NtGdiDdDDIOpenKeyedMutex","0x2e,0x131a,1,"}, 
+  {"0x2e.0x119b","NtUserGetClipboardSequenceNumber"}, 
+  {"NtGdiGradientFill","0x2e,0x10e3,6,"}, 
+  {"NtGdiDvpGetVideoPortInputFormats","0x2e,0x1070,2,"}, 
+  {"NtUserEnableScrollBar","0x2e,0x1181,3,"}, 
+  {"NtUserAddClipboardFormatListener","0x2e,0x113b,1,"}, 
+  {"NtUserDoSoundDisconnect","0x2e,0x1177,0,"}, 
+  {"NtCreateEventPair","0x2e,0x0041,3,"}, 
+  {"NtGdiPATHOBJ_bEnum","0x2e,0x12cf,2,"}, 
+  {"NtGdiInitSpool","0x2e,0x10e7,0,"}, 
+  {"NtGdiDvpGetVideoPortFlipStatus","0x2e,0x106f,2,"}, 
+  {"NtGdiDdDeleteDirectDrawObject","0x2e,0x1043,1,"}, 
+  {"NtAlpcCreatePortSection","0x2e,0x0018,6,"}, 
+  {"0x2e.0x110d","NtGdiSelectClipPath"}, 
+  {"NtGdiGetFontResourceInfoInternalW","0x2e,0x10b9,7,"}, 
+  {"0x2e.0x110e","NtGdiSelectFont"}, 
+  {"0x2e.0x110f","NtGdiSelectPen"}, 
+  {"NtDeleteAtom","0x2e,0x0063,1,"}, 
+  {"0x2e.0x110a","NtGdiScaleWindowExtEx"}, 
+  {"0x2e.0x110b","NtGdiSelectBitmap"}, 
+  {"NtUserDispatchMessage","0x2e,0x1175,1,"}, 
+  {"0x2e.0x110c","NtGdiSelectBrush"}, 
+  {"NtGdiSaveDC","0x2e,0x1108,1,"}, 
+  {"NtUserCloseWindowStation","0x2e,0x115f,1,"}, 
+  {"0x2e.0x1168","NtUserCreateLocalMemPlugin"}, 
+  {"0x2e.0x1169","NtUserCreateWindowEx"}, 
+  {"NtResetEvent","0x2e,0x012c,2,"}, 
+  {"0x2e.0x1162","NtUserCopyAcceleratorTable"}, 
+  {"0x2e.0x1163","NtUserCountClipboardFormats"}, 
+  {"NtUserCheckDesktopByThreadId","0x2e,0x1158,1,"}, 
+  {"0x2e.0x1160","NtUserConsoleControl"}, 
+  {"0x2e.0x1161","NtUserConvertMemPlugin"}, 
+  {"NtReadFileScatter","0x2e,0x0112,9,"}, 
+  {"NtUserSetWindowDisplayAffinity","0x2e,0x1240,2,"}, 
+  {"0x2e.0x1166","NtUserCreateDesktopEx"}, 
+  {"0x2e.0x1167","NtUserCreateInputContext"}, 
+  {"0x2e.0x1164","NtUserCreateAcceleratorTable"}, 
+  {"NtGdiGetPhysicalMonitorDescription","0x2e,0x1326,3,"}, 
+  {"NtUserUnregisterSessionPort","0x2e,0x127d,0,"}, 
+  {"0x2e.0x1165","NtUserCreateCaret"}, 
+  {"NtAllocateReserveObject","0x2e,0x0010,3,"}, 
+  {"NtAlpcRevokeSecurityContext","0x2e,0x0026,3,"}, 
+  {"NtGdiDvpGetVideoPortLine","0x2e,0x1071,2,"}, 
+  {"NtGdiDdGetDC","0x2e,0x104d,2,"}, 
+  {"0x2e.0x117c","NtUserDrawCaptionTemp"}, 
+  {"0x2e.0x117b","NtUserDrawCaption"}, 
+  {"NtGdiRemoveFontMemResourceEx","0x2e,0x1103,1,"}, 
+  {"0x2e.0x117a","NtUserDrawAnimatedRects"}, 
+  {"NtUserLockWorkStation","0x2e,0x11e6,0,"}, 
+  {"0x2e.0x117f","NtUserEmptyClipboard"}, 
+  {"0x2e.0x117e","NtUserDrawMenuBarTemp"}, 
+  {"NtUserUnloadKeyboardLayout","0x2e,0x1261,1,"}, 
+  {"0x2e.0x117d","NtUserDrawIconEx"}, 
+  {"NtGdiDdDDICreateSynchronizationObject","0x2e,0x12e9,1,"}, 
+  {"0x2e.0x1159","NtUserCheckWindowThreadDesktop"}, 
+  {"0x2e.0x1158","NtUserCheckDesktopByThreadId"}, 
+  {"NtDeleteKey","0x2e,0x0067,1,"}, 
+  {"NtSetSecurityObject","0x2e,0x015b,3,"}, 
+  {"NtUserSetFocus","0x2e,0x1224,1,"}, 
+  {"NtUserGetTouchInputInfo","0x2e,0x1290,4,"}, 
+  {"NtUserSetTimer","0x2e,0x123d,4,"}, 
+  {"0x2e.0x1151","NtUserChangeDisplaySettings"}, 
+  {"0x2e.0x1150","NtUserChangeClipboardChain"}, 
+  {"NtTerminateJobObject","0x2e,0x0171,2,"}, 
+  {"0x2e.0x1153","NtUserSetDisplayConfig"}, 
+  {"0x2e.0x1152","NtUserGetDisplayConfigBufferSizes"}, 
+  {"0x2e.0x1155","NtUserDisplayConfigGetDeviceInfo"}, 
+  {"0x2e.0x1154","NtUserQueryDisplayConfig"}, 
+  {"0x2e.0x1157","NtUserCheckAccessForIntegrityLevel"}, 
+  {"0x2e.0x1156","NtUserDisplayConfigSetDeviceInfo"}, 
+  {"NtGdiDdGetInternalMoCompInfo","0x2e,0x1051,2,"}, 
+  {"NtPropagationFailed","0x2e,0x00d6,3,"}, 
+  {"NtGdiClearBrushAttributes","0x2e,0x1013,2,"}, 
+  {"NtGdiCreateServerMetaFile","0x2e,0x102e,6,"}, 
+  {"0x2e.0x116b","NtUserDdeInitialize"}, 
+  {"NtGdiEngCreateClip","0x2e,0x12b9,0,"}, 
+  {"0x2e.0x116c","NtUserDeferWindowPos"}, 
+  {"NtGdiEngLineTo","0x2e,0x12ac,9,"}, 
+  {"0x2e.0x116a","NtUserCreateWindowStation"}, 
+  {"0x2e.0x116f","NtUserDestroyAcceleratorTable"}, 
+  {"NtQueryDirectoryObject","0x2e,0x00e0,7,"}, 
+  {"NtGdiGetEmbedFonts","0x2e,0x10de,0,"}, 
+  {"NtUserGetAltTabInfo","0x2e,0x118f,6,"}, 
+  {"0x2e.0x116d","NtUserDefSetText"}, 
+  {"0x2e.0x116e","NtUserDeleteMenu"}, 
+  {"NtCreatePagingFile","0x2e,0x004c,4,"}, 
+  {"0x2e.0x1108","NtGdiSaveDC"}, 
+  {"0x2e.0x1109","NtGdiScaleViewportExtEx"}, 
+  {"NtUserGetDisplayConfigBufferSizes","0x2e,0x1152,3,"}, 
+  {"NtGdiOffsetClipRgn","0x2e,0x10f1,3,"}, 
+  {"0x2e.0x1104","NtGdiResetDC"}, 
+  {"0x2e.0x1105","NtGdiResizePalette"}, 
+  {"0x2e.0x1106","NtGdiRestoreDC"}, 
+  {"0x2e.0x1107","NtGdiRoundRect"}, 
+  {"0x2e.0x1100","NtGdiRectInRegion"}, 
+  {"0x2e.0x1101","NtGdiRectVisible"}, 
+  {"0x2e.0x1102","NtGdiRemoveFontResourceW"}, 
+  {"0x2e.0x1103","NtGdiRemoveFontMemResourceEx"}, 
+  {"NtGdiEqualRgn","0x2e,0x108c,2,"}, 
+  {"0x2e.0x115a","NtUserCheckMenuItem"}, 
+  {"NtGdiSetIcmMode","0x2e,0x111c,3,"}, 
+  {"0x2e.0x115c","NtUserClipCursor"}, 
+  {"0x2e.0x115b","NtUserChildWindowFromPointEx"}, 
+  {"0x2e.0x115e","NtUserCloseDesktop"}, 
+  {"0x2e.0x115d","NtUserCloseClipboard"}, 
+  {"0x2e.0x115f","NtUserCloseWindowStation"}, 
+  {"NtFreeVirtualMemory","0x2e,0x0083,4,"}, 
+  {"0x2e.0x10d9","NtGdiGetTextMetricsW"}, 
+  {"0x2e.0x10d8","NtGdiGetTextFaceW"}, 
+  {"0x2e.0x1179","NtUserDragObject"}, 
+  {"0x2e.0x1178","NtUserDragDetect"}, 
+  {"NtGetWriteWatch","0x2e,0x0090,7,"}, 
+  {"0x2e.0x1173","NtUserDestroyWindow"}, 
+  {"0x2e.0x10d1","NtGdiGetStockObject"}, 
+  {"0x2e.0x1172","NtUserDestroyMenu"}, 
+  {"NtGdiGetStringBitmapW","0x2e,0x10d2,5,"}, 
+  {"NtSetHighEventPair","0x2e,0x0145,1,"}, 
+  {"NtGdiGetObjectBitmapPlugin","0x2e,0x10c4,2,"}, 
+  {"0x2e.0x10d0","NtGdiGetStats"}, 
+  {"0x2e.0x1171","NtUserDestroyInputContext"}, 
+  {"0x2e.0x10d3","NtGdiGetSuggestedOPMProtectedOutputArraySize"}, 
+  {"0x2e.0x1170","NtUserDestroyCursor"}, 
+  {"0x2e.0x10d2","NtGdiGetStringBitmapW"}, 
+  {"0x2e.0x1177","NtUserDoSoundDisconnect"}, 
+  {"0x2e.0x10d5","NtGdiGetTextCharsetInfo"}, 
+  {"0x2e.0x1176","NtUserDoSoundConnect"}, 
+  {"0x2e.0x10d4","NtGdiGetSystemPaletteUse"}, 
+  {"0x2e.0x1175","NtUserDispatchMessage"}, 
+  {"NtUserCopyAcceleratorTable","0x2e,0x1162,3,"}, 
+  {"0x2e.0x10d7","NtGdiGetTextExtentExW"}, 
+  {"0x2e.0x1174","NtUserDisableThreadIme"}, 
+  {"0x2e.0x10d6","NtGdiGetTextExtent"}, 
+  {"NtUserGetWindowDisplayAffinity","0x2e,0x11d0,2,"}, 
+  {"NtUserGetAppImeLevel","0x2e,0x1191,1,"}, 
+  {"NtUserVkKeyScanEx","0x2e,0x1270,3,"}, 
+  {"NtGdiDdDDISetDisplayMode","0x2e,0x12f3,1,"}, 
+  {"NtCreateSemaphore","0x2e,0x0055,5,"}, 
+  {"NtPrepareComplete","0x2e,0x00ce,2,"}, 
+  {"NtGdiPlgBlt","0x2e,0x10f7,11,"}, 
+  {"NtGdiDdDestroySurface","0x2e,0x1046,2,"}, 
+  {"0x2e.0x10fc","NtGdiPtVisible"}, 
+  {"0x2e.0x10fb","NtGdiPtInRegion"}, 
+  {"NtUserGetProcessWindowStation","0x2e,0x11be,0,"}, 
+  {"0x2e.0x10fa","NtGdiPolyTextOutW"}, 
+  {"NtGdiDxgGenericThunk","0x2e,0x1079,6,"}, 
+  {"0x2e.0x10ff","NtGdiRectangle"}, 
+  {"NtWaitForKeyedEvent","0x2e,0x0184,4,"}, 
+  {"0x2e.0x10fe","NtGdiQueryFontAssocInfo"}, 
+  {"0x2e.0x10fd","NtGdiQueryFonts"}, 
+  {"NtGdiGetAndSetDCDword","0x2e,0x109d,4,"}, 
+  {"0x2e.0x10e8","NtGdiIntersectClipRect"}, 
+  {"NtDeletePrivateNamespace","0x2e,0x0069,1,"}, 
+  {"0x2e.0x10e9","NtGdiInvertRgn"}, 
+  {"0x2e.0x1128","NtGdiSetSystemPaletteUse"}, 
+  {"NtUserGetIconSize","0x2e,0x11ab,4,"}, 
+  {"NtGdiSetBrushOrg","0x2e,0x1115,4,"}, 
+  {"0x2e.0x1129","NtGdiSetTextJustification"}, 
+  {"0x2e.0x1126","NtGdiSetPixelFormat"}, 
+  {"NtGdiEngBitBlt","0x2e,0x12a4,11,"}, 
+  {"0x2e.0x10e0","NtGdiAddEmbFontToDC"}, 
+  {"0x2e.0x1127","NtGdiSetRectRgn"}, 
+  {"NtDeleteBootEntry","0x2e,0x0064,1,"}, 
+  {"0x2e.0x10e1","NtGdiGetFontUnicodeRanges"}, 
+  {"0x2e.0x1124","NtGdiSetOPMSigningKeyAndSequenceNumbers"}, 
+  {"NtUserTranslateAccelerator","0x2e,0x125d,3,"}, 
+  {"0x2e.0x10e2","NtGdiGetWidthTable"}, 
+  {"0x2e.0x1125","NtGdiSetPixel"}, 
+  {"NtGdiDdDDIPollDisplayChildren","0x2e,0x1310,1,"}, 
+  {"0x2e.0x10e3","NtGdiGradientFill"}, 
+  {"0x2e.0x1122","NtGdiMirrorWindowOrg"}, 
+  {"0x2e.0x10e4","NtGdiHfontCreate"}, 
+  {"0x2e.0x1123","NtGdiSetLayout"}, 
+  {"NtGdiDdDDIReleaseKeyedMutex","0x2e,0x131d,1,"}, 
+  {"0x2e.0x10e5","NtGdiIcmBrushInfo"}, 
+  {"0x2e.0x1120","NtGdiSetMiterLimit"}, 
+  {"0x2e.0x10e6","bInitRedirDev"}, 
+  {"0x2e.0x1121","NtGdiGetDeviceWidth"}, 
+  {"NtGdiDdUpdateOverlay","0x2e,0x1066,3,"}, 
+  {"0x2e.0x10e7","NtGdiInitSpool"}, 
+  {"NtSetBootOptions","0x2e,0x013b,2,"}, 
+  {"NtUserSfmGetLogicalSurfaceBinding","0x2e,0x128a,4,"}, 
+  {"NtGdiTransformPoints","0x2e,0x1133,5,"}, 
+  {"NtGdiDdUnlockD3D","0x2e,0x1065,2,"}, 
+  {"NtOpenResourceManager","0x2e,0x00c1,5,"}, 
+  {"NtOpenKey","0x2e,0x00b6,3,"}, 
+  {"NtQueryAttributesFile","0x2e,0x00d9,2,"}, 
+  {"NtGdiEngLockSurface","0x2e,0x12a3,1,"}, 
+  {"0x2e.0x113f","NtUserBeginPaint"}, 
+  {"NtUserValidateTimerCallback","0x2e,0x126f,1,"}, 
+  {"0x2e.0x113e","NtUserAttachThreadInput"}, 
+  {"NtCreateDebugObject","0x2e,0x003d,4,"}, 
+  {"0x2e.0x113d","NtUserAssociateInputContext"}, 
+  {"0x2e.0x113c","NtUserAlterWindowStyle"}, 
+  {"0x2e.0x113b","NtUserAddClipboardFormatListener"}, 
+  {"NtGdiSTROBJ_dwGetCodePage","0x2e,0x12cd,1,"}, 
+  {"NtAlpcCreatePort","0x2e,0x0017,3,"}, 
+  {"0x2e.0x113a","NtUserActivateKeyboardLayout"}, 
+  {"NtUserCallNoParam","0x2e,0x114d,1,"}, 
+  {"NtSetTimerEx","0x2e,0x0163,4,"}, 
+  {"NtGdiDvpGetVideoPortField","0x2e,0x106e,2,"}, 
+  {"NtGdiRemoveFontResourceW","0x2e,0x1102,6,"}, 
+  {"0x2e.0x10f9","NtGdiPolyPolyDraw"}, 
+  {"0x2e.0x10f8","NtGdiPolyDraw"}, 
+  {"0x2e.0x1119","NtGdiSetDIBitsToDeviceInternal"}, 
+  {"NtUserGetWOWClass","0x2e,0x11d2,2,"}, 
+  {"0x2e.0x1118","NtGdiSetDeviceGammaRamp"}, 
+  {"NtAlpcQueryInformationMessage","0x2e,0x0025,6,"}, 
+  {"0x2e.0x1115","NtGdiSetBrushOrg"}, 
+  {"0x2e.0x10f3","NtGdiOpenDCW"}, 
+  {"0x2e.0x1114","NtGdiSetBrushAttributes"}, 
+  {"NtGdiCreateHatchBrushInternal","0x2e,0x1026,3,"}, 
+  {"0x2e.0x10f2","NtGdiOffsetRgn"}, 
+  {"0x2e.0x1117","NtGdiSetColorSpace"}, 
+  {"NtUnlockFile","0x2e,0x017f,5,"}, 
+  {"0x2e.0x10f1","NtGdiOffsetClipRgn"}, 
+  {"0x2e.0x1116","NtGdiSetColorAdjustment"}, 
+  {"0x2e.0x10f0","NtGdiMoveTo"}, 
+  {"NtGdiRectangle","0x2e,0x10ff,5,"}, 
+  {"0x2e.0x1111","NtGdiSetBitmapBits"}, 
+  {"0x2e.0x10f7","NtGdiPlgBlt"}, 
+  {"0x2e.0x1110","NtGdiSetBitmapAttributes"}, 
+  {"NtUserGetControlBrush","0x2e,0x119f,3,"}, 
+  {"0x2e.0x10f6","NtGdiPathToRegion"}, 
+  {"0x2e.0x1113","NtGdiSetBoundsRect"}, 
+  {"DxEngVisRgnUniq","0x2e,0x1331,0,"}, 
+  {"0x2e.0x10f5","NtGdiPolyPatBlt"}, 
+  {"0x2e.0x1112","NtGdiSetBitmapDimension"}, 
+  {"0x2e.0x10f4","NtGdiPatBlt"}, 
+  {"NtGdiXFORMOBJ_bApplyXform","0x2e,0x12bf,5,"}, 
+  {"NtGdiPatBlt","0x2e,0x10f4,6,"}, 
+  {"NtCreateIoCompletion","0x2e,0x0043,4,"}, 
+  {"NtGdiSTROBJ_bEnum","0x2e,0x12c9,3,"}, 
+  {"NtGdiEngCopyBits","0x2e,0x129e,6,"}, 
+  {"0x2e.0x112f","NtGdiStretchDIBitsInternal"}, 
+  {"0x2e.0x10da","NtGdiGetTransform"}, 
+  {"0x2e.0x112d","NtGdiStartPage"}, 
+  {"0x2e.0x10dc","NtGdiGetEmbUFI"}, 
+  {"0x2e.0x112e","NtGdiStretchBlt"}, 
+  {"0x2e.0x10db","NtGdiGetUFI"}, 
+  {"0x2e.0x112b","NtGdiSetSizeDevice"}, 
+  {"0x2e.0x10de","NtGdiGetEmbedFonts"}, 
+  {"0x2e.0x112c","NtGdiStartDoc"}, 
+  {"0x2e.0x10dd","NtGdiGetUFIPathname"}, 
+  {"NtReplyWaitReplyPort","0x2e,0x0129,2,"}, 
+  {"0x2e.0x112a","NtGdiSetVirtualResolution"}, 
+  {"0x2e.0x10df","NtGdiChangeGhostFont"}, 
+  {"NtGdiCreateDIBSection","0x2e,0x1023,9,"}, 
+  {"NtGdiIcmBrushInfo","0x2e,0x10e5,8,"}, 
+  {"NtGdiGetSystemPaletteUse","0x2e,0x10d4,1,"}, 
+  {"NtUmsThreadYield","0x2e,0x017a,1,"}, 
+  {"NtCancelTimer","0x2e,0x0030,2,"}, 
+  {"NtUserSetWindowRgnEx","0x2e,0x1247,3,"}, 
+  {"NtGdiPATHOBJ_vEnumStartClipLines","0x2e,0x12d1,4,"}, 
+  {"NtGdiDdDDICreateDCFromMemory","0x2e,0x1307,1,"}, 
+  {"NtUserUpdateWindowTransform","0x2e,0x127e,3,"}, 
+  {"NtUserGetGestureExtArgs","0x2e,0x1294,3,"}, 
+  {"NtQueryInformationTransaction","0x2e,0x00ee,5,"}, 
+  {"NtGdiGetPerBandInfo","0x2e,0x1080,2,"}, 
+  {"NtAlpcSetInformation","0x2e,0x0028,4,"}, 
+  {"0x2e.0x111e","NtGdiSetMagicColors"}, 
+  {"0x2e.0x111d","NtGdiSetLinkedUFIs"}, 
+  {"0x2e.0x10ea","NtGdiLineTo"}, 
+  {"NtUserAssociateInputContext","0x2e,0x113d,3,"}, 
+  {"0x2e.0x10eb","NtGdiMakeFontDir"}, 
+  {"0x2e.0x111f","NtGdiSetMetaRgn"}, 
+  {"0x2e.0x10ec","NtGdiMakeInfoDC"}, 
+  {"0x2e.0x111a","NtGdiSetFontEnumeration"}, 
+  {"0x2e.0x10ed","NtGdiMaskBlt"}, 
+  {"0x2e.0x10ee","NtGdiModifyWorldTransform"}, 
+  {"0x2e.0x111c","NtGdiSetIcmMode"}, 
+  {"0x2e.0x10ef","NtGdiMonoBitmap"}, 
+  {"0x2e.0x111b","NtGdiSetFontXform"}, 
+  {"NtWorkerFactoryWorkerReady","0x2e,0x018b,1,"}, 
+  {"NtContinue","0x2e,0x003c,2,"}, 
+  {"NtSetInformationProcess","0x2e,0x014d,4,"}, 
+  {"NtGdiDDCCISetVCPFeature","0x2e,0x1329,3,"}, 
+  {"0x2e.0x1139","NtGdiWidenPath"}, 
+  {"NtApphelpCacheControl","0x2e,0x0029,2,"}, 
+  {"0x2e.0x1138","NtGdiUpdateColors"}, 
+  {"NtGdiDdDDIGetRuntimeData","0x2e,0x12ee,1,"}, 
+  {"0x2e.0x1137","NtGdiUnrealizeObject"}, 
+  {"0x2e.0x1136","NtGdiUMPDEngFreeUserMem"}, 
+  {"NtUserBuildNameList","0x2e,0x1144,4,"}, 
+  {"0x2e.0x1135","DxgStubEndMoCompFrame"}, 
+  {"0x2e.0x1134","NtGdiTransparentBlt"}, 
+  {"0x2e.0x1133","NtGdiTransformPoints"}, 
+  {"0x2e.0x1132","NtGdiSwapBuffers"}, 
+  {"0x2e.0x1131","NtGdiStrokePath"}, 
+  {"0x2e.0x1130","NtGdiStrokeAndFillPath"}, 
+  {"NtGdiArcInternal","0x2e,0x100b,10,"}, 
+  {"NtUserCreateAcceleratorTable","0x2e,0x1164,2,"}, 
+  {"NtGdiConfigureOPMProtectedOutput","0x2e,0x1018,4,"}, 
+  {"0x2e.0x10bf","NtGdiGetLinkedUFIs"}, 
+  {"0x2e.0x10be","NtGdiGetKerningPairs"}, 
+  {"0x2e.0x10bd","NtGdiGetOPMInformation"}, 
+  {"0x2e.0x10bc","NtGdiGetGlyphOutline"}, 
+  {"0x2e.0x10bb","NtGdiGetGlyphIndicesWInternal"}, 
+  {"0x2e.0x10ba","NtGdiGetGlyphIndicesW"}, 
+  {"NtGdiDdDDIGetDisplayModeList","0x2e,0x12f2,1,"}, 
+  {"NtRegisterProtocolAddressInformation","0x2e,0x0119,5,"}, 
+  {"NtAlpcSendWaitReceivePort","0x2e,0x0027,8,"}, 
+  {"NtUserSetKeyboardState","0x2e,0x122a,1,"}, 
+  {"0x2e.0x10a8","NtGdiGetCharWidthInfo"}, 
+  {"NtGdiSetBitmapAttributes","0x2e,0x1110,2,"}, 
+  {"0x2e.0x10a9","NtGdiGetColorAdjustment"}, 
+  {"NtUserShowWindowAsync","0x2e,0x1250,2,"}, 
+  {"0x2e.0x10a4","NtGdiGetCharABCWidthsW"}, 
+  {"0x2e.0x10a5","NtGdiGetCharacterPlacementW"}, 
+  {"0x2e.0x10a6","NtGdiGetCharSet"}, 
+  {"0x2e.0x10a7","NtGdiGetCharWidthW"}, 
+  {"NtGdiEngGradientFill","0x2e,0x12ae,10,"}, 
+  {"0x2e.0x10a0","NtGdiGetBitmapDimension"}, 
+  {"NtDisableLastKnownGood","0x2e,0x006c,0,"}, 
+  {"0x2e.0x10a1","NtGdiGetBoundsRect"}, 
+  {"0x2e.0x10a2","NtGdiGetCertificate"}, 
+  {"0x2e.0x10a3","NtGdiGetCertificateSize"}, 
+  {"NtGdiPolyPatBlt","0x2e,0x10f5,5,"}, 
+  {"0x2e.0x00e9","NtQueryInformationPort"}, 
+  {"0x2e.0x00e8","NtQueryInformationJobObject"}, 
+  {"NtGdiComputeXformCoefficients","0x2e,0x1017,1,"}, 
+  {"NtProtectVirtualMemory","0x2e,0x00d7,5,"}, 
+  {"NtGdiEndPage","0x2e,0x1088,1,"}, 
+  {"NtWriteVirtualMemory","0x2e,0x018f,5,"}, 
+  {"0x2e.0x10cf","DxgStubDvpUpdateVideoPort"}, 
+  {"NtGdiStretchDIBitsInternal","0x2e,0x112f,16,"}, 
+  {"0x2e.0x10cd","NtGdiGetRgnBox"}, 
+  {"0x2e.0x10ce","NtGdiGetServerMetaFileBits"}, 
+  {"NtGdiDdCanCreateSurface","0x2e,0x103b,2,"}, 
+  {"0x2e.0x10cb","NtGdiGetRealizationInfo"}, 
+  {"0x2e.0x00e1","NtQueryDriverEntryOrder"}, 
+  {"NtGdiSelectBitmap","0x2e,0x110b,2,"}, 
+  {"0x2e.0x10cc","NtGdiGetRegionData"}, 
+  {"0x2e.0x00e0","NtQueryDirectoryObject"}, 
+  {"0x2e.0x00e3","NtQueryEvent"}, 
+  {"0x2e.0x10ca","NtGdiGetRasterizerCaps"}, 
+  {"0x2e.0x00e2","NtQueryEaFile"}, 
+  {"NtReadVirtualMemory","0x2e,0x0115,5,"}, 
+  {"0x2e.0x00e5","NtQueryInformationAtom"}, 
+  {"0x2e.0x00e4","NtQueryFullAttributesFile"}, 
+  {"0x2e.0x00e7","NtQueryInformationFile"}, 
+  {"0x2e.0x00e6","NtQueryInformationEnlistment"}, 
+  {"0x2e.0x10b9","NtGdiGetFontResourceInfoInternalW"}, 
+  {"0x2e.0x10b8","NtGdiGetFontFileInfo"}, 
+  {"0x2e.0x10b7","NtGdiGetFontFileData"}, 
+  {"0x2e.0x10b6","NtGdiGetFontData"}, 
+  {"NtUserPaintMonitor","0x2e,0x11f9,3,"}, 
+  {"0x2e.0x10b5","NtGdiGetEudcTimeStampEx"}, 
+  {"0x2e.0x10b4","NtGdiGetETM"}, 
+  {"NtUserDrawCaptionTemp","0x2e,0x117c,7,"}, 
+  {"NtTraceEvent","0x2e,0x0178,4,"}, 
+  {"0x2e.0x10b3","NtGdiGetDIBitsInternal"}, 
+  {"0x2e.0x10b2","NtGdiGetDeviceCapsAll"}, 
+  {"0x2e.0x10b1","NtGdiGetDeviceGammaRamp"}, 
+  {"NtUserDragDetect","0x2e,0x1178,3,"}, 
+  {"NtUserCallNextHookEx","0x2e,0x114c,4,"}, 
+  {"NtGdiGetRasterizerCaps","0x2e,0x10ca,2,"}, 
+  {"0x2e.0x10b0","NtGdiGetDeviceCaps"}, 
+  {"NtGdiPathToRegion","0x2e,0x10f6,1,"}, 
+  {"NtThawTransactions","0x2e,0x0176,0,"}, 
+  {"NtGdiDdCreateD3DBuffer","0x2e,0x1040,8,"}, 
+  {"NtGdiHLSurfGetInformation","0x2e,0x12dd,4,"}, 
+  {"0x2e.0x00d8","NtPulseEvent"}, 
+  {"0x2e.0x00d9","NtQueryAttributesFile"}, 
+  {"NtUserSelectPalette","0x2e,0x1217,3,"}, 
+  {"0x2e.0x00d0","NtPrePrepareComplete"}, 
+  {"0x2e.0x00d1","NtPrePrepareEnlistment"}, 
+  {"0x2e.0x00d2","NtPrivilegeCheck"}, 
+  {"NtUserSfmDxOpenSwapChain","0x2e,0x1283,4,"}, 
+  {"0x2e.0x00d3","NtPrivilegedServiceAuditAlarm"}, 
+  {"0x2e.0x00d4","NtPrivilegeObjectAuditAlarm"}, 
+  {"NtGdiDdDDIDestroyAllocation","0x2e,0x12e2,1,"}, 
+  {"0x2e.0x00d5","NtPropagationComplete"}, 
+  {"0x2e.0x00d6","NtPropagationFailed"}, 
+  {"0x2e.0x00d7","NtProtectVirtualMemory"}, 
+  {"0x2e.0x10c8","NtGdiGetPixel"}, 
+  {"0x2e.0x10c9","NtGdiGetRandomRgn"}, 
+  {"0x2e.0x10c6","NtGdiGetOutlineTextMetricsInternalW"}, 
+  {"0x2e.0x10c7","NtGdiGetPath"}, 
+  {"0x2e.0x10c4","NtGdiGetObjectBitmapPlugin"}, 
+  {"NtNotifyChangeKey","0x2e,0x00ac,10,"}, 
+  {"0x2e.0x10c5","NtGdiGetOPMRandomNumber"}, 
+  {"NtGetCurrentProcessorNumber","0x2e,0x0088,0,"}, 
+  {"0x2e.0x10c2","NtGdiGetNearestColor"}, 
+  {"0x2e.0x00fb","NtQueryPerformanceCounter"}, 
+  {"0x2e.0x10c3","NtGdiGetNearestPaletteIndex"}, 
+  {"0x2e.0x00fc","NtQueryPortInformationProcess"}, 
+  {"0x2e.0x10c0","NtGdiGetMiterLimit"}, 
+  {"NtAlpcDisconnectPort","0x2e,0x0020,2,"}, 
+  {"0x2e.0x10c1","NtGdiGetMonitorID"}, 
+  {"0x2e.0x00fa","NtQueryOpenSubKeysEx"}, 
+  {"0x2e.0x00ff","NtQuerySecurityAttributesToken"}, 
+  {"0x2e.0x00fd","NtQueryQuotaInformationFile"}, 
+  {"0x2e.0x00fe","NtQuerySection"}, 
+  {"NtGdiEngStrokeAndFillPath","0x2e,0x12aa,10,"}, 
+  {"NtUserSfmDestroyLogicalSurfaceBinding","0x2e,0x128b,1,"}, 
+  {"NtUserPeekMessage","0x2e,0x11fa,5,"}, 
+  {"0x2e.0x10ad","NtGdiGetDCforBitmap"}, 
+  {"0x2e.0x10ae","NtGdiGetDCObject"}, 
+  {"0x2e.0x10af","NtGdiGetDCPoint"}, 
+  {"NtRemoveProcessDebug","0x2e,0x0121,2,"}, 
+  {"NtGdiGetDeviceCapsAll","0x2e,0x10b2,2,"}, 
+  {"NtGdiDoBanding","0x2e,0x1081,4,"}, 
+  {"0x2e.0x10aa","NtGdiGetColorSpaceforBitmap"}, 
+  {"NtQueryEaFile","0x2e,0x00e2,9,"}, 
+  {"0x2e.0x10ab","NtGdiGetCOPPCompatibleOPMInformation"}, 
+  {"0x2e.0x10ac","NtGdiGetDCDword"}, 
+  {"NtFreeUserPhysicalPages","0x2e,0x0082,3,"}, 
+  {"NtGdiDdLockD3D","0x2e,0x1057,2,"}, 
+  {"NtGdiEngCreatePalette","0x2e,0x129c,6,"}, 
+  {"NtUserCheckMenuItem","0x2e,0x115a,3,"}, 
+  {"NtGdiDdSetExclusiveMode","0x2e,0x105f,2,"}, 
+  {"0x2e.0x00ea","NtQueryInformationProcess"}, 
+  {"0x2e.0x00ec","NtQueryInformationThread"}, 
+  {"0x2e.0x00eb","NtQueryInformationResourceManager"}, 
+  {"NtOpenTimer","0x2e,0x00c9,3,"}, 
+  {"0x2e.0x00ee","NtQueryInformationTransaction"}, 
+  {"0x2e.0x00ed","NtQueryInformationToken"}, 
+  {"0x2e.0x00ef","NtQueryInformationTransactionManager"}, 
+  {"NtCreateJobSet","0x2e,0x0045,3,"}, 
+  {"NtUserSetCursorContents","0x2e,0x1222,2,"}, 
+  {"0x2e.0x00f8","NtQueryObject"}, 
+  {"0x2e.0x00f9","NtQueryOpenSubKeys"}, 
+  {"NtQuerySemaphore","0x2e,0x0101,5,"}, 
+  {"0x2e.0x00f2","NtQueryIntervalProfile"}, 
+  {"NtSetSystemInformation","0x2e,0x015e,3,"}, 
+  {"NtGdiXFORMOBJ_iGetXform","0x2e,0x12c0,2,"}, 
+  {"0x2e.0x00f3","NtQueryIoCompletion"}, 
+  {"NtCreateFile","0x2e,0x0042,11,"}, 
+  {"0x2e.0x00f0","NtQueryInformationWorkerFactory"}, 
+  {"0x2e.0x00f1","NtQueryInstallUILanguage"}, 
+  {"NtUserMagSetContextInformation","0x2e,0x1335,4,"}, 
+  {"NtUserSetInternalWindowPos","0x2e,0x1229,4,"}, 
+  {"0x2e.0x00f6","NtQueryMultipleValueKey"}, 
+  {"0x2e.0x00f7","NtQueryMutant"}, 
+  {"0x2e.0x00f4","NtQueryKey"}, 
+  {"0x2e.0x00f5","NtQueryLicenseValue"}, 
+  {"NtUserCountClipboardFormats","0x2e,0x1163,0,"}, 
+  {"NtAddDriverEntry","0x2e,0x000a,2,"}, 
+  {"NtSetThreadExecutionState","0x2e,0x0161,2,"}, 
+  {"NtUserTrackPopupMenuEx","0x2e,0x1259,6,"}, 
+  {"NtSerializeBoot","0x2e,0x0139,0,"}, 
+  {"NtReplyWaitReceivePortEx","0x2e,0x0128,5,"}, 
+  {"0x2e.0x00da","NtQueryBootEntryOrder"}, 
+  {"0x2e.0x00db","NtQueryBootOptions"}, 
+  {"0x2e.0x00dc","NtQueryDebugFilterState"}, 
+  {"0x2e.0x00dd","NtQueryDefaultLocale"}, 
+  {"0x2e.0x00de","NtQueryDefaultUILanguage"}, 
+  {"NtGdiEngStrokePath","0x2e,0x12a8,8,"}, 
+  {"0x2e.0x00df","NtQueryDirectoryFile"}, 
+  {"NtUserLockWindowUpdate","0x2e,0x11e5,1,"}, 
+  {"0x2e.0x00a9","NtModifyBootEntry"}, 
+  {"NtGdiSetRectRgn","0x2e,0x1127,5,"}, 
+  {"NtGdiSetBrushAttributes","0x2e,0x1114,2,"}, 
+  {"0x2e.0x00a8","NtMapViewOfSection"}, 
+  {"0x2e.0x00a5","NtMapCMFModule"}, 
+  {"NtUserDwmStopRedirection","0x2e,0x1280,0,"}, 
+  {"NtGdiDdDDIUnlock","0x2e,0x12f1,1,"}, 
+  {"0x2e.0x00a4","NtMakeTemporaryObject"}, 
+  {"NtUserSetMirrorRendering","0x2e,0x1332,2,"}, 
+  {"NtSetEventBoostPriority","0x2e,0x0144,1,"}, 
+  {"0x2e.0x00a7","NtMapUserPhysicalPagesScatter"}, 
+  {"0x2e.0x00a6","NtMapUserPhysicalPages"}, 
+  {"0x2e.0x00a1","NtLockRegistryKey"}, 
+  {"0x2e.0x00a0","NtLockProductActivationKeys"}, 
+  {"NtRequestPort","0x2e,0x012a,2,"}, 
+  {"NtGdiGetCharacterPlacementW","0x2e,0x10a5,6,"}, 
+  {"0x2e.0x00a3","NtMakePermanentObject"}, 
+  {"0x2e.0x00a2","NtLockVirtualMemory"}, 
+  {"NtOpenThread","0x2e,0x00c6,4,"}, 
+  {"NtGdiEngPlgBlt","0x2e,0x12a6,11,"}, 
+  {"NtGdiCLIPOBJ_ppoGetPath","0x2e,0x12b7,1,"}, 
+  {"0x2e.0x00cf","NtPrepareEnlistment"}, 
+  {"NtQueryInformationThread","0x2e,0x00ec,5,"}, 
+  {"0x2e.0x00ce","NtPrepareComplete"}, 
+  {"NtGdiXLATEOBJ_cGetPalette","0x2e,0x12b2,4,"}, 
+  {"NtAllocateUuids","0x2e,0x0012,4,"}, 
+  {"0x2e.0x00cd","NtPowerInformation"}, 
+  {"0x2e.0x00cc","NtPlugPlayControl"}, 
+  {"NtUnmapViewOfSection","0x2e,0x0181,2,"}, 
+  {"0x2e.0x00cb","NtOpenTransactionManager"}, 
+  {"0x2e.0x00ca","NtOpenTransaction"}, 
+  {"NtGdiFONTOBJ_pfdg","0x2e,0x12c5,1,"}, 
+  {"NtQueryMutant","0x2e,0x00f7,5,"}, 
+  {"NtEnumerateDriverEntries","0x2e,0x0073,2,"}, 
+  {"NtUserSetScrollInfo","0x2e,0x1234,4,"}, 
+  {"NtAdjustPrivilegesToken","0x2e,0x000c,6,"}, 
+  {"NtUserGetKeyState","0x2e,0x11b4,1,"}, 
+  {"NtFlushBuffersFile","0x2e,0x007b,2,"}, 
+  {"NtUserGetWindowRgnEx","0x2e,0x1246,3,"}, 
+  {"NtGdiEnumObjects","0x2e,0x108b,4,"}, 
+  {"NtGdiDdDDICheckSharedResourceAccess","0x2e,0x1321,1,"}, 
+  {"NtUserSetThreadState","0x2e,0x123c,2,"}, 
+  {"NtQueryDefaultUILanguage","0x2e,0x00de,1,"}, 
+  {"NtUserRemoveClipboardFormatListener","0x2e,0x1210,1,"}, 
+  {"NtQuerySecurityAttributesToken","0x2e,0x00ff,6,"}, 
+  {"NtSetIoCompletionEx","0x2e,0x0156,6,"}, 
+  {"NtSetContextThread","0x2e,0x013c,2,"}, 
+  {"NtGdiCreateMetafileDC","0x2e,0x1027,1,"}, 
+  {"0x2e.0x00bf","NtOpenProcessToken"}, 
+  {"0x2e.0x00bd","NtOpenPrivateNamespace"}, 
+  {"NtGdiSelectBrush","0x2e,0x110c,2,"}, 
+  {"0x2e.0x00be","NtOpenProcess"}, 
+  {"NtUserYieldTask","0x2e,0x1276,0,"}, 
+  {"0x2e.0x00bb","NtOpenMutant"}, 
+  {"NtUserSetMenuDefaultItem","0x2e,0x122d,3,"}, 
+  {"0x2e.0x00bc","NtOpenObjectAuditAlarm"}, 
+  {"NtGdiRectVisible","0x2e,0x1101,2,"}, 
+  {"NtUserSetWindowsHookAW","0x2e,0x1248,3,"}, 
+  {"0x2e.0x00ba","NtOpenKeyTransactedEx"}, 
+  {"NtGdiHT_Get8BPPFormatPalette","0x2e,0x12d5,4,"}, 
+  {"NtFlushKey","0x2e,0x007e,1,"}, 
+  {"NtGdiDdDDIGetScanLine","0x2e,0x130e,1,"}, 
+  {"0x2e.0x00c9","NtOpenTimer"}, 
+  {"NtUserSetWindowCompositionAttribute","0x2e,0x123f,2,"}, 
+  {"0x2e.0x00c8","NtOpenThreadTokenEx"}, 
+  {"0x2e.0x00c7","NtOpenThreadToken"}, 
+  {"0x2e.0x00c6","NtOpenThread"}, 
+  {"NtGetNextThread","0x2e,0x008c,6,"}, 
+  {"0x2e.0x00c5","NtOpenSymbolicLinkObject"}, 
+  {"0x2e.0x00c4","NtOpenSession"}, 
+  {"0x2e.0x00c3","NtOpenSemaphore"}, 
+  {"0x2e.0x00c2","NtOpenSection"}, 
+  {"NtGdiGetDhpdev","0x2e,0x12d3,1,"}, 
+  {"0x2e.0x00c1","NtOpenResourceManager"}, 
+  {"NtSetTimerResolution","0x2e,0x0164,3,"}, 
+  {"NtUserRegisterRawInputDevices","0x2e,0x120c,3,"}, 
+  {"0x2e.0x00c0","NtOpenProcessTokenEx"}, 
+  {"NtGdiGetCOPPCompatibleOPMInformation","0x2e,0x10ab,3,"}, 
+  {"NtGdiFONTOBJ_pxoGetXform","0x2e,0x12c2,1,"}, 
+  {"NtSetDefaultHardErrorPort","0x2e,0x013e,1,"}, 
+  {"NtCreateJobObject","0x2e,0x0044,3,"}, 
+  {"NtSetVolumeInformationFile","0x2e,0x0167,5,"}, 
+  {"0x2e.0x00ae","NtNotifyChangeSession"}, 
+  {"NtUserGetClipboardFormatName","0x2e,0x1199,3,"}, 
+  {"NtUserMessageCall","0x2e,0x11ea,7,"}, 
+  {"0x2e.0x00ad","NtNotifyChangeMultipleKeys"}, 
+  {"0x2e.0x00af","NtOpenDirectoryObject"}, 
+  {"NtSetLowWaitHighEventPair","0x2e,0x0159,1,"}, 
+  {"0x2e.0x00aa","NtModifyDriverEntry"}, 
+  {"NtQueryDefaultLocale","0x2e,0x00dd,2,"}, 
+  {"0x2e.0x00ac","NtNotifyChangeKey"}, 
+  {"0x2e.0x00ab","NtNotifyChangeDirectoryFile"}, 
+  {"NtOpenSection","0x2e,0x00c2,3,"}, 
+  {"NtUserWindowFromPoint","0x2e,0x1275,2,"}, 
+  {"0x2e.0x00b8","NtOpenKeyedEvent"}, 
+  {"NtGdiEndDoc","0x2e,0x1086,1,"}, 
+  {"0x2e.0x00b9","NtOpenKeyTransacted"}, 
+  {"NtUserUnregisterUserApiHook","0x2e,0x1264,0,"}, 
+  {"0x2e.0x00b6","NtOpenKey"}, 
+  {"0x2e.0x00b7","NtOpenKeyEx"}, 
+  {"NtGdiAngleArc","0x2e,0x1008,6,"}, 
+  {"0x2e.0x00b4","NtOpenIoCompletion"}, 
+  {"0x2e.0x00b5","NtOpenJobObject"}, 
+  {"0x2e.0x00b2","NtOpenEventPair"}, 
+  {"0x2e.0x00b3","NtOpenFile"}, 
+  {"NtUserGetProp","0x2e,0x1232,2,"}, 
+  {"0x2e.0x00b0","NtOpenEnlistment"}, 
+  {"0x2e.0x00b1","NtOpenEvent"}, 
+  {"NtOpenJobObject","0x2e,0x00b5,3,"}, 
+  {"NtDuplicateToken","0x2e,0x0070,6,"}, 
+  {"NtVdmControl","0x2e,0x0182,2,"}, 
+  {"NtSetInformationDebugObject","0x2e,0x0147,5,"}, 
+  {"NtGdiDdAlphaBlt","0x2e,0x1037,3,"}, 
+  {"NtListenPort","0x2e,0x009a,2,"}, 
+  {"NtUserImpersonateDdeClientWindow","0x2e,0x11d8,2,"}, 
+  {"NtQuerySymbolicLinkObject","0x2e,0x0102,3,"}, 
+  {"NtUserSetMenuFlagRtoL","0x2e,0x122e,1,"}, 
+  {"NtAlpcDeleteResourceReserve","0x2e,0x001d,3,"}, 
+  {"NtUserSetProcessDPIAware","0x2e,0x123e,0,"}, 
+  {"NtGdiDdDDIGetMultisampleMethodList","0x2e,0x12f4,1,"}, 
+  {"NtGdiDrawStream","0x2e,0x12db,3,"}, 
+  {"NtUserActivateKeyboardLayout","0x2e,0x113a,2,"}, 
+  {"NtGdiDdDDIGetDeviceState","0x2e,0x1306,1,"}, 
+  {"NtCreateTransaction","0x2e,0x005b,10,"}, 
+  {"NtCreateMutant","0x2e,0x004a,4,"}, 
+  {"NtGdiHT_Get8BPPMaskPalette","0x2e,0x12d6,6,"}, 
+  {"NtUserShowWindow","0x2e,0x124f,2,"}, 
+  {"NtUserGetImeHotKey","0x2e,0x11ac,4,"}, 
+  {"NtDebugActiveProcess","0x2e,0x0060,2,"}, 
+  {"NtGdiRectInRegion","0x2e,0x1100,2,"}, 
+  {"NtUserGetRawInputData","0x2e,0x11c0,5,"}, 
+  {"NtUserEnableMenuItem","0x2e,0x1180,3,"}, 
+  {"NtUserGetIconInfo","0x2e,0x11aa,6,"}, 
+  {"NtUserNotifyIMEStatus","0x2e,0x11f0,3,"}, 
+  {"NtOpenProcessTokenEx","0x2e,0x00c0,4,"}, 
+  {"NtGdiFONTOBJ_pvTrueTypeFontFile","0x2e,0x12c7,2,"}, 
+  {"NtGdiGetCharWidthW","0x2e,0x10a7,6,"}, 
+  {"NtGdiAddEmbFontToDC","0x2e,0x10e0,2,"}, 
+  {"NtGdiDdDDIDestroyDCFromMemory","0x2e,0x1308,1,"}, 
+  {"NtDeviceIoControlFile","0x2e,0x006b,10,"}, 
+  {"NtWaitForWorkViaWorkerFactory","0x2e,0x0188,2,"}, 
+  {"NtGdiDvpGetVideoPortConnectInfo","0x2e,0x1073,2,"}, 
+  {"NtAlertResumeThread","0x2e,0x000d,2,"}, 
+  {"NtGdiDdWaitForVerticalBlank","0x2e,0x1067,2,"}, 
+  {"NtGdiCreateBitmap","0x2e,0x101a,5,"}, 
+  {"NtAddBootEntry","0x2e,0x0009,2,"}, 
+  {"NtCallbackReturn","0x2e,0x002c,3,"}, 
+  {"NtGdiSetLinkedUFIs","0x2e,0x111d,3,"}, 
+  {"NtNotifyChangeMultipleKeys","0x2e,0x00ad,12,"}, 
+  {"NtUserToUnicodeEx","0x2e,0x1257,7,"}, 
+  {"NtAlpcOpenSenderThread","0x2e,0x0023,6,"}, 
+  {"NtGdiCreateOPMProtectedOutputs","0x2e,0x1028,5,"}, 
+  {"NtAlpcCreateSectionView","0x2e,0x001a,3,"}, 
+  {"NtPrePrepareComplete","0x2e,0x00d0,2,"}, 
+  {"NtGdiFontIsLinked","0x2e,0x100a,1,"}, 
+  {"NtUserUnlockWindowStation","0x2e,0x1262,1,"}, 
+  {"NtUnloadKeyEx","0x2e,0x017e,2,"}, 
+  {"NtAlpcDeleteSecurityContext","0x2e,0x001f,3,"}, 
+  {"NtMapUserPhysicalPages","0x2e,0x00a6,3,"}, 
+  {"NtGdiCreateDIBitmapInternal","0x2e,0x1022,11,"}, 
+  {"NtCompleteConnectPort","0x2e,0x0039,1,"}, 
+  {"NtUserSetWindowsHookEx","0x2e,0x1249,6,"}, 
+  {"NtUserSystemParametersInfo","0x2e,0x1253,4,"}, 
+  {"NtGdiGetColorAdjustment","0x2e,0x10a9,2,"}, 
+  {"NtUserGetWindowCompositionAttribute","0x2e,0x11ce,2,"}, 
+  {"NtGdiEndGdiRendering","0x2e,0x1087,3,"}, 
+  {"NtEnumerateKey","0x2e,0x0074,6,"}, 
+  {"NtUserRegisterUserApiHook","0x2e,0x120a,4,"}, 
+  {"NtUserGetThreadDesktop","0x2e,0x11c6,1,"}, 
+  {"NtDeleteFile","0x2e,0x0066,1,"}, 
+  {"NtUserEndDeferWindowPosEx","0x2e,0x1182,2,"}, 
+  {"NtUserLogicalToPhysicalPoint","0x2e,0x11e7,2,"}, 
+  {"NtUserSetClassWord","0x2e,0x121e,3,"}, 
+  {"NtQueryInformationJobObject","0x2e,0x00e8,5,"}, 
+  {"NtGdiForceUFIMapping","0x2e,0x109a,2,"}, 
+  {"NtUserSetClipboardViewer","0x2e,0x1220,1,"}, 
+  {"NtUserMapVirtualKeyEx","0x2e,0x11e8,4,"}, 
+  {"NtGdiDdCanCreateD3DBuffer","0x2e,0x103c,2,"}, 
+  {"NtQueryOpenSubKeysEx","0x2e,0x00fa,4,"}, 
+  {"NtGdiGetDIBitsInternal","0x2e,0x10b3,9,"}, 
+  {"NtGdiGetDCPoint","0x2e,0x10af,3,"}, 
+  {"NtGdiSetPixel","0x2e,0x1125,4,"}, 
+  {"NtGdiGetFontData","0x2e,0x10b6,5,"}, 
+  {"NtGdiDdDestroyD3DBuffer","0x2e,0x1047,1,"}, 
+  {"DxgStubDvpUpdateVideoPort","0x2e,0x10cf,4,"}, 
+  {"NtUserRegisterTasklist","0x2e,0x120e,1,"}, 
+  {"NtSystemDebugControl","0x2e,0x0170,6,"}, 
+  {"NtUserUnhookWinEvent","0x2e,0x1260,1,"}, 
+  {"NtGdiEngStretchBltROP","0x2e,0x12b1,13,"}, 
+  {"NtIsUILanguageComitted","0x2e,0x0099,0,"}, 
+  {"NtGdiDDCCIGetCapabilitiesString","0x2e,0x132c,3,"}, 
+  {"NtUserSfmDxQuerySwapChainBindingStatus","0x2e,0x1286,3,"}, 
+  {"NtGdiConvertMetafileRect","0x2e,0x1019,2,"}, 
+  {"NtUserRemoveProp","0x2e,0x1212,2,"}, 
+  {"NtUserGetDoubleClickTime","0x2e,0x11a6,0,"}, 
+  {"NtAddAtom","0x2e,0x0008,3,"}, 
+  {"NtUserCallHwndParamLock","0x2e,0x114a,3,"}, 
+  {"NtUserOpenThreadDesktop","0x2e,0x11f6,4,"}, 
+  {"NtFindAtom","0x2e,0x007a,3,"}, 
+  {"NtUserDestroyAcceleratorTable","0x2e,0x116f,1,"}, 
+  {"NtGdiExtGetObjectW","0x2e,0x1093,3,"}, 
+  {"NtQuerySystemEnvironmentValue","0x2e,0x0103,4,"}, 
+  {"NtUserOpenClipboard","0x2e,0x11f3,2,"}, 
+  {"NtUserEmptyClipboard","0x2e,0x117f,0,"}, 
+  {"NtGdiDdDDIUpdateOverlay","0x2e,0x1301,1,"}, 
+  {"NtConnectPort","0x2e,0x003b,8,"}, 
+  {"NtGdiGetDeviceGammaRamp","0x2e,0x10b1,2,"}, 
+  {"NtUserMNDragOver","0x2e,0x11ed,2,"}, 
+  {"NtGdiDDCCIGetCapabilitiesStringLength","0x2e,0x132b,2,"}, 
+  {"NtCreateProfile","0x2e,0x0051,9,"}, 
+  {"NtQueryOpenSubKeys","0x2e,0x00f9,2,"}, 
+  {"NtMapViewOfSection","0x2e,0x00a8,10,"}, 
+  {"NtUserChangeClipboardChain","0x2e,0x1150,2,"}, 
+  {"NtMakePermanentObject","0x2e,0x00a3,1,"}, 
+  {"NtWaitForMultipleObjects32","0x2e,0x0186,5,"}, 
+  {"NtGdiEngCreateBitmap","0x2e,0x1299,6,"}, 
+  {"NtSetSystemEnvironmentValue","0x2e,0x015c,2,"}, 
+  {"NtGdiDdUnattachSurface","0x2e,0x1063,2,"}, 
+  {"NtUserGetCaretBlinkTime","0x2e,0x1194,0,"}, 
+  {"NtUserGetCaretPos","0x2e,0x1195,1,"}, 
+  {"NtGdiGetPhysicalMonitors","0x2e,0x1325,4,"}, 
+  {"NtTerminateThread","0x2e,0x0173,2,"}, 
+  {"NtSetDebugFilterState","0x2e,0x013d,3,"}, 
+  {"NtCreateMailslotFile","0x2e,0x0049,8,"}, 
+  {"NtGdiDdNotifyFullscreenSpriteUpdate","0x2e,0x132f,2,"}, 
+  {"NtModifyBootEntry","0x2e,0x00a9,1,"}, 
+  {"NtUserGetKeyboardState","0x2e,0x11b2,1,"}, 
+  {"0x2e.0x12fa","NtGdiDdDDIGetSharedPrimaryPlugin"}, 
+  {"NtInitializeRegistry","0x2e,0x0095,1,"}, 
+  {"0x2e.0x12fc","NtGdiDdDDIQueryStatistics"}, 
+  {"0x2e.0x12fb","NtGdiDdDDIEscape"}, 
+  {"NtImpersonateThread","0x2e,0x0093,3,"}, 
+  {"0x2e.0x12fe","NtGdiDdDDIGetPresentHistory"}, 
+  {"NtGdiDdDDIWaitForVerticalBlankEvent","0x2e,0x1304,1,"}, 
+  {"0x2e.0x12fd","NtGdiDdDDISetVidPnSourceOwner"}, 
+  {"0x2e.0x12ff","NtGdiDdDDIGetPresentQueueEvent"}, 
+  {"NtGdiCreateSolidBrush","0x2e,0x102f,2,"}, 
+  {"NtGdiEngFillPath","0x2e,0x12a9,7,"}, 
+  {"NtUserHideCaret","0x2e,0x11d5,1,"}, 
+  {"NtGdiQueryFonts","0x2e,0x10fd,3,"}, 
+  {"NtUserAttachThreadInput","0x2e,0x113e,3,"}, 
+  {"NtGdiEngMarkBandingSurface","0x2e,0x12a7,1,"}, 
+  {"NtGdiFillPath","0x2e,0x1096,1,"}, 
+  {"NtInitiatePowerAction","0x2e,0x0096,4,"}, 
+  {"NtGdiDdDDIQueryAllocationResidency","0x2e,0x12e4,1,"}, 
+  {"NtReadRequestData","0x2e,0x0114,6,"}, 
+  {"NtUserUnregisterHotKey","0x2e,0x1265,2,"}, 
+  {"NtGdiAlphaBlend","0x2e,0x1007,12,"}, 
+  {"NtRegisterThreadTerminatePort","0x2e,0x011a,1,"}, 
+  {"0x2e.0x12f9","NtGdiDdDDICloseAdapter"}, 
+  {"0x2e.0x12f8","NtGdiDdDDIOpenAdapterFromHdc"}, 
+  {"NtUserGetKeyboardLayoutList","0x2e,0x11b0,2,"}, 
+  {"DxgStubEndMoCompFrame","0x2e,0x1322,2,"}, 
+  {"0x2e.0x12f1","NtGdiDdDDIUnlock"}, 
+  {"NtCloseObjectAuditAlarm","0x2e,0x0033,3,"}, 
+  {"0x2e.0x12f0","NtGdiDdDDILock"}, 
+  {"NtGdiDdDDIQueryAdapterInfo","0x2e,0x12ef,1,"}, 
+  {"0x2e.0x12f3","NtGdiDdDDISetDisplayMode"}, 
+  {"0x2e.0x12f2","NtGdiDdDDIGetDisplayModeList"}, 
+  {"0x2e.0x12f5","NtGdiDdDDIPresent"}, 
+  {"0x2e.0x12f4","NtGdiDdDDIGetMultisampleMethodList"}, 
+  {"NtGdiAddFontResourceW","0x2e,0x1002,6,"}, 
+  {"0x2e.0x12f7","NtGdiDdDDIOpenAdapterFromDeviceName"}, 
+  {NULL, NULL}
+};
+// 0x55bd6992f170
+// TODO
+typedef int (*GperfForeachCallback)(void *user, const char *k, const char *v);
+int gperf_windows_x86_32_foreach(GperfForeachCallback cb, void *user) {
+  int i = 0; while (kvs[i].name) {
+  cb (user, kvs[i].name, kvs[i].value);
+  i++;}
+  return 0;
+}
+const char *gperf_windows_x86_32_get(const char *s) {
+  int i = 0; while (kvs[i].name) {
+  if (!strcmp (s, kvs[i].name)) return kvs[i].value;
+  i++;}
+  return NULL;
+}
+#define sdb_hash_c_windows_x86_32(x,y) gperf_windows_x86_32_hash(x)
+const unsigned int gperf_windows_x86_32_hash(const char *s) {
+  int sum = strlen (s);
+  while (*s) { sum += *s; s++; }
+  return sum;
+}
+struct {const char *name;void *get;void *hash;void *foreach;} gperf_windows_x86_32 = {
+  .name = "windows-x86-32",
+  .get = &gperf_windows_x86_32_get,
+  .hash = &gperf_windows_x86_32_hash,
+  .foreach = &gperf_windows_x86_32_foreach
+};
+
+#if MAIN
+int main () {
+	const char *s = ((char*(*)(char*))gperf_windows_x86_32.get)("foo");
+	printf ("%s\n", s);
+}
+#endif
@@ -0,0 +1,299 @@
+// SDB-CGEN V1.9.4
+// gcc -DMAIN=1 iso8859_1.c ; ./a.out > iso8859_1.h
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+struct kv { const char *name; const char *value; };
+static const struct kv kvs[] = {
+  {"0xf1","ñ"}, 
+  {"0x72","r"}, 
+  {"0xf0","ð"}, 
+  {"0x73","s"}, 
+  {"0xf7","÷"}, 
+  {"0x70","p"}, 
+  {"0xf6","ö"}, 
+  {"0x71","q"}, 
+  {"0xf5","õ"}, 
+  {"0x76","v"}, 
+  {"0xf4","ô"}, 
+  {"0x77","w"}, 
+  {"0x74","t"}, 
+  {"0x75","u"}, 
+  {"0x8e","[ss2]"}, 
+  {"0xea","ê"}, 
+  {"0x8d","[ri]"}, 
+  {"0xeb","ë"}, 
+  {"0xec","ì"}, 
+  {"0x1d","[gs]"}, 
+  {"0x8f","[ss3]"}, 
+  {"0xed","í"}, 
+  {"0x1e","[rs]"}, 
+  {"0x8a","[vts]"}, 
+  {"0xee","î"}, 
+  {"0x1f","[us]"}, 
+  {"0xef","ï"}, 
+  {"0x8c","[plu]"}, 
+  {"0x8b","[pld]"}, 
+  {"0x1a","[sub]"}, 
+  {"0x1b","[esc]"}, 
+  {"0x1c","[fs]"}, 
+  {"0x09","[ht]"}, 
+  {"0x08","[bs]"}, 
+  {"0x05","[enq]"}, 
+  {"0x04","[eot]"}, 
+  {"0x07","[bel]"}, 
+  {"0x06","[ack]"}, 
+  {"0x01","[stx]"}, 
+  {"0x00","[nul]"}, 
+  {"0x03","[etx]"}, 
+  {"0x02","[sot]"}, 
+  {"0x9d","[osc]"}, 
+  {"0x9e","[pm]"}, 
+  {"0xbf","¿"}, 
+  {"0x9f","[apc]"}, 
+  {"0xbe","¾"}, 
+  {"0x027","&"}, 
+  {"0xbd","½"}, 
+  {"0x6c","l"}, 
+  {"0x026","&"}, 
+  {"0xbc","¼"}, 
+  {"0x6b","k"}, 
+  {"0x025","%"}, 
+  {"0x9a","[sci]"}, 
+  {"0xbb","»"}, 
+  {"0x6a","j"}, 
+  {"0x9b","[csi]"}, 
+  {"0xba","º"}, 
+  {"0x9c","[st]"}, 
+  {"0x6f","o"}, 
+  {"0x6e","n"}, 
+  {"0x6d","m"}, 
+  {"0x18","[can]"}, 
+  {"0x85","[nel]"}, 
+  {"0x19","[em]"}, 
+  {"0x84","[ind]"}, 
+  {"0x87","[esa]"}, 
+  {"0x86","[ssa]"}, 
+  {"0x14","[dc4]"}, 
+  {"0x81","[hop]"}, 
+  {"0x15","[nak]"}, 
+  {"0x80","[pad]"}, 
+  {"0x16","[syn]"}, 
+  {"0x83","[nbh]"}, 
+  {"0x17","[etb]"}, 
+  {"0x82","[bhp]"}, 
+  {"0x10","[dle]"}, 
+  {"0x11","[dc1]"}, 
+  {"0x12","[dc2]"}, 
+  {"0x13","[dc3]"}, 
+  {"0x89","[htj]"}, 
+  {"0x88","[hts]"}, 
+  {"0xcf","Ï"}, 
+  {"0xcd","Í"}, 
+  {"0xce","Î"}, 
+  {"0x7b","{"}, 
+  {"0xcb","Ë"}, 
+  {"0x7c","|"}, 
+  {"0xcc","Ì"}, 
+  {"0x7a","z"}, 
+  {"0xca","Ê"}, 
+  {"0x7f","[del]"}, 
+  {"0x7d","}"}, 
+  {"0x7e","~"}, 
+  {"0xa8","¨"}, 
+  {"0xa9","©"}, 
+  {"0x94","[cch]"}, 
+  {"0xa4","¤"}, 
+  {"0x95","[mw]"}, 
+  {"0xa5","¥"}, 
+  {"0x29",")"}, 
+  {"0x96","[spa]"}, 
+  {"0xa6","¦"}, 
+  {"0x28","("}, 
+  {"0x97","[epa]"}, 
+  {"0xa7","§"}, 
+  {"0x90","[dcs]"}, 
+  {"0xa0","[nbsp]"}, 
+  {"0x91","[pu1]"}, 
+  {"0xa1","¡"}, 
+  {"0x92","[pu2]"}, 
+  {"0xa2","¢"}, 
+  {"0x24","$"}, 
+  {"0x93","[sts]"}, 
+  {"0xa3","£"}, 
+  {"0x23","#"}, 
+  {"0x22","\""}, 
+  {"0x21","!"}, 
+  {"0x20","[sp]"}, 
+  {"0x98","[sos]"}, 
+  {"0x99","[sgci]"}, 
+  {"0xb9","¹"}, 
+  {"0xb8","¸"}, 
+  {"0xb7","·"}, 
+  {"0xb6","¶"}, 
+  {"0x38","8"}, 
+  {"0xb5","µ"}, 
+  {"0x39","9"}, 
+  {"0xb4","´"}, 
+  {"0x36","6"}, 
+  {"0xb3","³"}, 
+  {"0x37","7"}, 
+  {"0xb2","²"}, 
+  {"0x34","4"}, 
+  {"0xb1","±"}, 
+  {"0x35","5"}, 
+  {"0xb0","°"}, 
+  {"0x32","2"}, 
+  {"0x33","3"}, 
+  {"0x30","0"}, 
+  {"0x31","1"}, 
+  {"0xad","shy"}, 
+  {"0xae","®"}, 
+  {"0xaf","¯"}, 
+  {"0xaa","ª"}, 
+  {"0xab","«"}, 
+  {"0xac","¬"}, 
+  {"0x4a","J"}, 
+  {"0x4c","L"}, 
+  {"0x4b","K"}, 
+  {"0x4e","N"}, 
+  {"0x4d","M"}, 
+  {"0xc8","È"}, 
+  {"0x4f","O"}, 
+  {"0xc9","É"}, 
+  {"0xc6","Æ"}, 
+  {"0xc7","Ç"}, 
+  {"0xc4","Ä"}, 
+  {"0xc5","Å"}, 
+  {"0xc2","Â"}, 
+  {"0xc3","Ã"}, 
+  {"0xc0","À"}, 
+  {"0xc1","Á"}, 
+  {"0x2f","/"}, 
+  {"0x2e","."}, 
+  {"0x2d","-"}, 
+  {"0x2c",","}, 
+  {"0x2b","+"}, 
+  {"0x5a","Z"}, 
+  {"0x2a","*"}, 
+  {"0x5b","["}, 
+  {"0x5d","]"}, 
+  {"0x5e","^"}, 
+  {"0x5f","_"}, 
+  {"0x49","I"}, 
+  {"0x48","H"}, 
+  {"0x41","A"}, 
+  {"0x40","@"}, 
+  {"0x43","C"}, 
+  {"0x42","B"}, 
+  {"0x45","E"}, 
+  {"0x44","D"}, 
+  {"0x47","G"}, 
+  {"0x46","F"}, 
+  {"0x3f","?"}, 
+  {"0x3d","="}, 
+  {"0xfc","ü"}, 
+  {"0x3e",">"}, 
+  {"0xfb","û"}, 
+  {"0x3b",";"}, 
+  {"0xfa","ú"}, 
+  {"0x3c","<"}, 
+  {"0x3a",":"}, 
+  {"0xff","ÿ"}, 
+  {"0xfe","þ"}, 
+  {"0xfd","ý"}, 
+  {"0xd9","Ù"}, 
+  {"0xd8","Ø"}, 
+  {"0x58","X"}, 
+  {"0x59","Y"}, 
+  {"0xd1","Ñ"}, 
+  {"0xd0","Ð"}, 
+  {"0xd3","Ó"}, 
+  {"0xd2","Ò"}, 
+  {"0x50","P"}, 
+  {"0xd5","Õ"}, 
+  {"0x51","Q"}, 
+  {"0xd4","Ô"}, 
+  {"0x52","R"}, 
+  {"0xd7","×"}, 
+  {"0x53","S"}, 
+  {"0xd6","Ö"}, 
+  {"0x54","T"}, 
+  {"0x55","U"}, 
+  {"0x56","V"}, 
+  {"0x57","W"}, 
+  {"0xe8","è"}, 
+  {"0xe9","é"}, 
+  {"0x69","i"}, 
+  {"0x68","h"}, 
+  {"0xe0","à"}, 
+  {"0xe1","á"}, 
+  {"0xe2","â"}, 
+  {"0xe3","ã"}, 
+  {"0x63","c"}, 
+  {"0xe4","ä"}, 
+  {"0x62","b"}, 
+  {"0xe5","å"}, 
+  {"0x61","a"}, 
+  {"0xe6","æ"}, 
+  {"0x60","`"}, 
+  {"0xe7","ç"}, 
+  {"0x67","g"}, 
+  {"0x66","f"}, 
+  {"0x65","e"}, 
+  {"0x64","d"}, 
+  {"0xda","Ú"}, 
+  {"0xdc","Ü"}, 
+  {"0xdb","Û"}, 
+  {"0x0e","[so]"}, 
+  {"0xde","Þ"}, 
+  {"0x0d","[cr]"}, 
+  {"0xdd","Ý"}, 
+  {"0x0f","[si]"}, 
+  {"0x0a","[lf]"}, 
+  {"0xdf","ß"}, 
+  {"0x0c","[ff]"}, 
+  {"0x0b","[vt]"}, 
+  {"0xf9","ù"}, 
+  {"0xf8","ø"}, 
+  {"0x78","x"}, 
+  {"0x79","y"}, 
+  {"0xf3","ó"}, 
+  {"0xf2","ò"}, 
+  {NULL, NULL}
+};
+// 0x559642a29170
+// TODO
+typedef int (*GperfForeachCallback)(void *user, const char *k, const char *v);
+int gperf_iso8859_1_foreach(GperfForeachCallback cb, void *user) {
+  int i = 0; while (kvs[i].name) {
+  cb (user, kvs[i].name, kvs[i].value);
+  i++;}
+  return 0;
+}
+const char *gperf_iso8859_1_get(const char *s) {
+  int i = 0; while (kvs[i].name) {
+  if (!strcmp (s, kvs[i].name)) return kvs[i].value;
+  i++;}
+  return NULL;
+}
+#define sdb_hash_c_iso8859_1(x,y) gperf_iso8859_1_hash(x)
+const unsigned int gperf_iso8859_1_hash(const char *s) {
+  int sum = strlen (s);
+  while (*s) { sum += *s; s++; }
+  return sum;
+}
+struct {const char *name;void *get;void *hash;void *foreach;} gperf_iso8859_1 = {
+  .name = "iso8859_1",
+  .get = &gperf_iso8859_1_get,
+  .hash = &gperf_iso8859_1_hash,
+  .foreach = &gperf_iso8859_1_foreach
+};
+
+#if MAIN
+int main () {
+	const char *s = ((char*(*)(char*))gperf_iso8859_1.get)("foo");
+	printf ("%s\n", s);
+}
+#endif
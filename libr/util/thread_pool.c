@@ -0,0 +1,365 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+#include <r_th.h>
+#include <r_util.h>
+
+// Every worker owns a deque: it pushes and pops its own tasks from the bottom
+// while idle workers steal the oldest ones from the top of the others. The
+// deques are guarded by a lock each, the pool lock is only taken to update
+// the counters and to sleep when there is nothing to do.
+
+typedef struct r_th_pool_queue_t {
+	RThreadPool *pool;
+	int id;
+	RThreadLock *lock;
+	RThreadFuture **tasks; // ring buffer
+	int head;
+	int count;
+	int size;
+} RThreadPoolQueue;
+
+// worker running in this thread, NULL outside of the pools
+static R_TH_LOCAL RThreadPoolQueue *self = NULL;
+
+R_API int r_th_ncpus(void) {
+#if !WANT_THREADS
+	return 1;
+#elif R2__WINDOWS__
+	SYSTEM_INFO si;
+	GetSystemInfo (&si);
+	return R_MAX ((int)si.dwNumberOfProcessors, 1);
+#elif defined(_SC_NPROCESSORS_ONLN)
+	long n = sysconf (_SC_NPROCESSORS_ONLN);
+	return (n > 0)? (int)n: 1;
+#else
+	return 1;
+#endif
+}
+
+static bool queue_push(RThreadPoolQueue *q, RThreadFuture *f) {
+	r_th_lock_enter (q->lock);
+	if (q->count == q->size) {
+		int size = q->size? q->size * 2: 64;
+		RThreadFuture **tasks = malloc (size * sizeof (RThreadFuture *));
+		if (!tasks) {
+			r_th_lock_leave (q->lock);
+			return false;
+		}
+		int i;
+		for (i = 0; i < q->count; i++) {
+			tasks[i] = q->tasks[(q->head + i) % q->size];
+		}
+		free (q->tasks);
+		q->tasks = tasks;
+		q->head = 0;
+		q->size = size;
+	}
+	q->tasks[(q->head + q->count) % q->size] = f;
+	q->count++;
+	r_th_lock_leave (q->lock);
+	return true;
+}
+
+// newest task, used by the owner of the queue
+static RThreadFuture *queue_pop(RThreadPoolQueue *q) {
+	RThreadFuture *f = NULL;
+	r_th_lock_enter (q->lock);
+	if (q->count > 0) {
+		q->count--;
+		f = q->tasks[(q->head + q->count) % q->size];
+	}
+	r_th_lock_leave (q->lock);
+	return f;
+}
+
+// oldest task, used by the other workers
+static RThreadFuture *queue_steal(RThreadPoolQueue *q) {
+	RThreadFuture *f = NULL;
+	r_th_lock_enter (q->lock);
+	if (q->count > 0) {
+		f = q->tasks[q->head];
+		q->head = (q->head + 1) % q->size;
+		q->count--;
+	}
+	r_th_lock_leave (q->lock);
+	return f;
+}
+
+static RThreadFuture *pool_take(RThreadPool *pool) {
+	RThreadFuture *f = NULL;
+	int i, id = 0;
+	if (self && self->pool == pool) {
+		id = self->id;
+		f = queue_pop (self);
+	}
+	for (i = 0; !f && i < pool->size; i++) {
+		f = queue_steal (&pool->queues[(id + i) % pool->size]);
+	}
+	if (f) {
+		r_th_lock_enter (pool->lock);
+		pool->pending--;
+		r_th_lock_leave (pool->lock);
+	}
+	return f;
+}
+
+static void pool_run(RThreadPool *pool, RThreadFuture *f) {
+	f->result = f->fun (f->user);
+	r_th_lock_enter (pool->lock);
+	f->done = true;
+	if (pool->waiters > 0) {
+		r_th_cond_signal_all (pool->done);
+	}
+	r_th_lock_leave (pool->lock);
+}
+
+static RThreadFunctionRet pool_worker(RThread *th) {
+	RThreadPoolQueue *q = th->user;
+	RThreadPool *pool = q->pool;
+	self = q;
+	while (true) {
+		RThreadFuture *f = pool_take (pool);
+		if (f) {
+			pool_run (pool, f);
+			continue;
+		}
+		r_th_lock_enter (pool->lock);
+		while (!pool->pending && !pool->stop) {
+			r_th_cond_wait (pool->work, pool->lock);
+		}
+		bool stop = pool->stop && !pool->pending;
+		r_th_lock_leave (pool->lock);
+		if (stop) {
+			break;
+		}
+	}
+	self = NULL;
+	return R_TH_STOP;
+}
+
+// called with pool->lock held
+static void pool_start(RThreadPool *pool) {
+	int i;
+	pool->started = true;
+	for (i = 0; i < pool->size; i++) {
+		pool->threads[i] = r_th_new (pool_worker, &pool->queues[i], 0);
+		if (!pool->threads[i]) {
+			R_LOG_WARN ("Cannot spawn worker %d", i);
+		}
+	}
+}
+
+static bool pool_push(RThreadPool *pool, RThreadFuture *f) {
+	RThreadPoolQueue *q;
+	if (self && self->pool == pool) {
+		// nested tasks stay in the worker that spawned them
+		q = self;
+	} else {
+		r_th_lock_enter (pool->lock);
+		if (!pool->started) {
+			pool_start (pool);
+		}
+		q = &pool->queues[pool->next++ % pool->size];
+		r_th_lock_leave (pool->lock);
+	}
+	if (!queue_push (q, f)) {
+		return false;
+	}
+	r_th_lock_enter (pool->lock);
+	pool->pending++;
+	r_th_cond_signal (pool->work);
+	r_th_lock_leave (pool->lock);
+	return true;
+}
+
+// size <= 0 means one worker per cpu, they are spawned on the first submit
+R_API RThreadPool *r_th_pool_new(int size) {
+	RThreadPool *pool = R_NEW0 (RThreadPool);
+	if (!pool) {
+		return NULL;
+	}
+#if WANT_THREADS
+	if (size <= 0) {
+		size = r_th_ncpus ();
+	}
+#else
+	// tasks run in the thread that waits for them
+	size = 0;
+#endif
+	pool->lock = r_th_lock_new (false);
+	pool->work = r_th_cond_new ();
+	pool->done = r_th_cond_new ();
+	pool->queues = R_NEWS0 (RThreadPoolQueue, R_MAX (size, 1));
+	pool->threads = R_NEWS0 (RThread *, R_MAX (size, 1));
+	if (!pool->lock || !pool->work || !pool->done || !pool->queues || !pool->threads) {
+		r_th_pool_free (pool);
+		return NULL;
+	}
+	int i;
+	for (i = 0; i < size; i++) {
+		RThreadPoolQueue *q = &pool->queues[i];
+		q->pool = pool;
+		q->id = i;
+		q->lock = r_th_lock_new (false);
+		if (!q->lock) {
+			r_th_pool_free (pool);
+			return NULL;
+		}
+		pool->size++;
+	}
+	return pool;
+}
+
+// pending tasks are completed before the workers are stopped
+R_API void r_th_pool_free(RThreadPool *pool) {
+	if (!pool) {
+		return;
+	}
+	int i;
+	if (pool->lock) {
+		r_th_lock_enter (pool->lock);
+		pool->stop = true;
+		if (pool->work) {
+			r_th_cond_signal_all (pool->work);
+		}
+		r_th_lock_leave (pool->lock);
+	}
+	for (i = 0; i < pool->size; i++) {
+		RThread *th = pool->threads[i];
+		if (th) {
+			r_th_wait (th);
+			r_th_free (th);
+		}
+	}
+	if (pool->pending > 0) {
+		// no worker could be spawned, drain the queues from here
+		RThreadFuture *f;
+		while ((f = pool_take (pool))) {
+			pool_run (pool, f);
+		}
+	}
+	for (i = 0; i < pool->size; i++) {
+		r_th_lock_free (pool->queues[i].lock);
+		free (pool->queues[i].tasks);
+	}
+	r_th_cond_free (pool->work);
+	r_th_cond_free (pool->done);
+	r_th_lock_free (pool->lock);
+	free (pool->queues);
+	free (pool->threads);
+	free (pool);
+}
+
+static void future_init(RThreadFuture *f, RThreadPool *pool, RThreadPoolFunction fun, void *user) {
+	f->pool = pool;
+	f->fun = fun;
+	f->user = user;
+	if (!pool || pool->size < 1 || !pool_push (pool, f)) {
+		// nowhere to queue it, run it now
+		f->pool = NULL;
+		f->result = fun (user);
+		f->done = true;
+	}
+}
+
+// Queue fun (user) in the pool, it runs in the caller thread when pool is NULL
+R_API RThreadFuture *r_th_pool_submit(RThreadPool *pool, RThreadPoolFunction fun, void *user) {
+	r_return_val_if_fail (fun, NULL);
+	RThreadFuture *f = R_NEW0 (RThreadFuture);
+	if (f) {
+		f->owned = true;
+		future_init (f, pool, fun, user);
+	}
+	return f;
+}
+
+// Returns the value of the task, the caller runs other queued tasks meanwhile
+R_API void *r_th_future_wait(RThreadFuture *f) {
+	r_return_val_if_fail (f, NULL);
+	RThreadPool *pool = f->pool;
+	if (!pool) {
+		return f->result;
+	}
+	while (true) {
+		r_th_lock_enter (pool->lock);
+		bool done = f->done;
+		r_th_lock_leave (pool->lock);
+		if (done) {
+			break;
+		}
+		RThreadFuture *g = pool_take (pool);
+		if (g) {
+			pool_run (pool, g);
+			continue;
+		}
+		// nothing is queued, so the task is already running somewhere
+		r_th_lock_enter (pool->lock);
+		if (!f->done) {
+			pool->waiters++;
+			r_th_cond_wait (pool->done, pool->lock);
+			pool->waiters--;
+		}
+		r_th_lock_leave (pool->lock);
+	}
+	return f->result;
+}
+
+R_API void r_th_future_free(RThreadFuture *f) {
+	if (f) {
+		r_th_future_wait (f);
+		if (f->owned) {
+			free (f);
+		}
+	}
+}
+
+typedef struct {
+	RThreadFuture f;
+	RThreadForCallback cb;
+	void *user;
+	size_t from;
+	size_t to;
+} ForTask;
+
+static void *for_task(void *user) {
+	ForTask *t = user;
+	t->cb (t->user, t->from, t->to);
+	return NULL;
+}
+
+// Call cb for every slice of at most grain items in [from, to) and wait for
+// all of them, a grain of 0 splits the range in a few slices per worker
+R_API bool r_th_parallel_for(RThreadPool *pool, size_t from, size_t to, size_t grain, RThreadForCallback cb, void *user) {
+	r_return_val_if_fail (cb && from <= to, false);
+	const size_t n = to - from;
+	if (!n) {
+		return true;
+	}
+	const int size = pool? pool->size: 0;
+	if (!grain) {
+		grain = R_MAX (n / R_MAX (size * 4, 1), 1);
+	}
+	if (size < 2 || n <= grain) {
+		cb (user, from, to);
+		return true;
+	}
+	const size_t ntasks = (n + grain - 1) / grain;
+	ForTask *tasks = R_NEWS0 (ForTask, ntasks);
+	if (!tasks) {
+		return false;
+	}
+	size_t i;
+	for (i = 0; i < ntasks; i++) {
+		ForTask *t = &tasks[i];
+		t->cb = cb;
+		t->user = user;
+		t->from = from + i * grain;
+		t->to = R_MIN (t->from + grain, to);
+		future_init (&t->f, pool, for_task, t);
+	}
+	for (i = 0; i < ntasks; i++) {
+		r_th_future_wait (&tasks[i].f);
+	}
+	free (tasks);
+	return true;
+}
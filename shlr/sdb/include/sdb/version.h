@@ -0,0 +1 @@
+#define SDB_VERSION "1.9.4"
@@ -0,0 +1,253 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+// Measure the time spent by zfs scanning the functions with several FLIRT
+// signature files, one file after the other or all of them at once
+
+#include <r_core.h>
+
+#define FCNS 20000
+#define FILES 8
+#define FCNSZ 0x100
+#define PATSZ 32
+#define VARIANT 0x100
+
+typedef struct {
+	ut16 key[PATSZ]; // pattern bytes or VARIANT
+	ut8 crc_length;
+	ut16 crc16;
+	ut16 length;
+	char name[32];
+} Sig;
+
+static double now(void) {
+	return r_time_now_mono () / 1000000.0;
+}
+
+static ut64 rnd(ut64 *seed) {
+	*seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	return *seed >> 33;
+}
+
+// the crc16 of flair tools, as in libr/anal/flirt.c
+static ut16 crc16(const ut8 *p, size_t len) {
+	ut32 crc = 0xFFFF;
+	if (!len) {
+		return 0;
+	}
+	while (len--) {
+		ut32 data = *p++;
+		int i;
+		for (i = 0; i < 8; i++) {
+			crc = ((crc ^ data) & 1)? (crc >> 1) ^ 0x8408: crc >> 1;
+			data >>= 1;
+		}
+	}
+	crc = ~crc;
+	return (ut16)((crc << 8) | ((crc >> 8) & 0xff));
+}
+
+static void w8(RBuffer *b, ut32 v) {
+	ut8 c = v;
+	r_buf_write (b, &c, 1);
+}
+
+static void wmulti(RBuffer *b, ut32 v) {
+	if (v < 0x80) {
+		w8 (b, v);
+	} else if (v < 0x4000) {
+		w8 (b, 0x80 | (v >> 8));
+		w8 (b, v);
+	} else if (v < 0x20000000) {
+		w8 (b, 0xc0 | (v >> 24));
+		w8 (b, v >> 16);
+		w8 (b, v >> 8);
+		w8 (b, v);
+	} else {
+		w8 (b, 0xe0);
+		w8 (b, v >> 24);
+		w8 (b, v >> 16);
+		w8 (b, v >> 8);
+		w8 (b, v);
+	}
+}
+
+static int sig_cmp(const void *a, const void *b) {
+	const Sig *sa = *(const Sig **)a, *sb = *(const Sig **)b;
+	return memcmp (sa->key, sb->key, sizeof (sa->key));
+}
+
+// write the patterns from depth d as a radix tree, the children differ at their first byte
+static void write_tree(RBuffer *b, Sig **sigs, int n, int d) {
+	if (d == PATSZ) {
+		int i;
+		w8 (b, 0);
+		for (i = 0; i < n; i++) {
+			const Sig *s = sigs[i];
+			w8 (b, s->crc_length);
+			w8 (b, s->crc16 >> 8);
+			w8 (b, s->crc16);
+			w8 (b, 0x80 | (s->length >> 8));
+			w8 (b, s->length);
+			w8 (b, 0); // offset of the public function
+			r_buf_write (b, (const ut8 *)s->name, strlen (s->name));
+			w8 (b, (i + 1 < n)? 0x10: 0);
+		}
+		return;
+	}
+	int i, j, nodes = 0;
+	for (i = 0; i < n; i = j) {
+		for (j = i + 1; j < n && sigs[j]->key[d] == sigs[i]->key[d]; j++) {
+		}
+		nodes++;
+	}
+	wmulti (b, nodes);
+	for (i = 0; i < n; i = j) {
+		for (j = i + 1; j < n && sigs[j]->key[d] == sigs[i]->key[d]; j++) {
+		}
+		// the common prefix of a sorted run is the one of its first and last items
+		int len = 1;
+		while (d + len < PATSZ && sigs[i]->key[d + len] == sigs[j - 1]->key[d + len]) {
+			len++;
+		}
+		ut32 mask = 0;
+		int k;
+		for (k = 0; k < len; k++) {
+			if (sigs[i]->key[d + k] == VARIANT) {
+				mask |= 1U << (len - 1 - k);
+			}
+		}
+		w8 (b, len);
+		if (len < 16) {
+			w8 (b, 0x80 | (mask >> 8));
+			w8 (b, mask);
+		} else {
+			wmulti (b, mask);
+		}
+		for (k = 0; k < len; k++) {
+			if (sigs[i]->key[d + k] != VARIANT) {
+				w8 (b, sigs[i]->key[d + k]);
+			}
+		}
+		write_tree (b, sigs + i, j - i, d + len);
+	}
+}
+
+static bool write_sig(const char *file, Sig **sigs, int n) {
+	RBuffer *b = r_buf_new ();
+	ut8 hdr[6 + 1 + 1 + 4 + 2 + 2 + 2 + 2 + 2 + 12 + 1 + 2 + 4] = {0};
+	memcpy (hdr, "IDASGN", 6);
+	hdr[6] = 6; // version
+	hdr[34] = 5; // library_name_len
+	r_buf_write (b, hdr, sizeof (hdr));
+	r_buf_write (b, (const ut8 *)"bench", 5);
+	qsort (sigs, n, sizeof (Sig *), sig_cmp);
+	write_tree (b, sigs, n, 0);
+	ut64 size;
+	const ut8 *data = r_buf_data (b, &size);
+	bool ret = r_file_dump (file, data, size, false);
+	r_buf_free (b);
+	return ret;
+}
+
+static void addfcn(RCore *core, ut64 at, const ut8 *buf, int size) {
+	r_io_write_at (core->io, at, buf, size);
+	r_core_cmdf (core, "af+ 0x%"PFMT64x" fcn.%08"PFMT64x, at, at);
+	r_core_cmdf (core, "afb+ 0x%"PFMT64x" 0x%"PFMT64x" %d", at, at, size);
+}
+
+int main(int argc, char **argv) {
+	const bool all = argc > 1 && !strcmp (argv[1], "all");
+	const int threads = (argc > 2)? atoi (argv[2]): 1;
+	const int n = (argc > 3)? atoi (argv[3]): FCNS;
+	if (n < FILES) {
+		return 1;
+	}
+	RCore *core = r_core_new ();
+	Sig *sigs = R_NEWS0 (Sig, n + n / 2);
+	Sig **file_sigs = R_NEWS (Sig *, n);
+	if (!core || !sigs || !file_sigs) {
+		return 1;
+	}
+	r_config_set (core->config, "asm.arch", "null");
+	r_config_set_i (core->config, "zign.threads", threads);
+	r_core_cmdf (core, "o malloc://%d", n * FCNSZ);
+	// three of each four functions are in one of the files, with four bytes relocated
+	ut64 seed = 0x1337;
+	ut8 buf[FCNSZ];
+	int i, j, f;
+	for (i = 0; i < n; i++) {
+		const int size = 0x40 + rnd (&seed) % (FCNSZ - 0x40);
+		for (j = 0; j < size; j++) {
+			buf[j] = (j < 4)? rnd (&seed) % 4: rnd (&seed); // most functions share a prologue
+		}
+		addfcn (core, (ut64)i * FCNSZ, buf, size);
+		Sig *s = &sigs[i];
+		for (j = 0; j < PATSZ; j++) {
+			s->key[j] = (j >= 5 && j < 9)? VARIANT: buf[j];
+		}
+		s->crc_length = R_MIN (size - PATSZ, 0xff);
+		s->crc16 = crc16 (buf + PATSZ, s->crc_length);
+		s->length = size;
+		snprintf (s->name, sizeof (s->name), "f_%d", i);
+	}
+	// and the files have half as many modules that are not in the binary
+	for (i = n; i < n + n / 2; i++) {
+		Sig *s = &sigs[i];
+		for (j = 0; j < PATSZ; j++) {
+			s->key[j] = (j < 4)? rnd (&seed) % 4: rnd (&seed);
+		}
+		s->crc_length = 0x20;
+		s->crc16 = rnd (&seed);
+		s->length = FCNSZ;
+		snprintf (s->name, sizeof (s->name), "x_%d", i);
+	}
+	RList *files = r_list_newf (free);
+	for (f = 0; f < FILES; f++) {
+		int m = 0;
+		for (i = 0; i < n + n / 2; i++) {
+			if ((i / 4) % FILES == f && (i >= n || i % 4 != 3)) {
+				file_sigs[m++] = &sigs[i];
+			}
+		}
+		char *file = r_str_newf ("flirt-bench-%d.sig", f);
+		if (!write_sig (file, file_sigs, m)) {
+			return 1;
+		}
+		r_list_append (files, file);
+	}
+	RListIter *iter;
+	char *file;
+	double t = now ();
+	if (all) {
+		r_sign_flirt_scan_files (core->anal, files);
+	} else {
+		r_list_foreach (files, iter, file) {
+			r_sign_flirt_scan (core->anal, file);
+		}
+	}
+	t = now () - t;
+	int good = 0, bad = 0;
+	RAnalFunction *fcn;
+	r_list_foreach (core->anal->fcns, iter, fcn) {
+		if (!r_str_startswith (fcn->name, "flirt.")) {
+			continue;
+		}
+		char *name = r_str_newf ("flirt.f_%d", (int)(fcn->addr / FCNSZ));
+		if (!strcmp (fcn->name, name) && (fcn->addr / FCNSZ) % 4 != 3) {
+			good++;
+		} else {
+			bad++;
+		}
+		free (name);
+	}
+	printf ("flirt   %d fcns %d files %s %d threads %8.3fs\n", n, FILES, all? "all": "each", threads, t);
+	printf ("right   %d wrong %d (of %d)\n", good, bad, n - n / 4);
+	r_list_foreach (files, iter, file) {
+		r_file_rm (file);
+	}
+	r_list_free (files);
+	free (file_sigs);
+	free (sigs);
+	r_core_free (core);
+	return 0;
+}
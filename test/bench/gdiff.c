@@ -0,0 +1,162 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+// Measure the time spent by r_core_gdiff (radiff2 -C) pairing the functions of two
+// builds, the second one with the functions moved, some of them changed or missing
+
+#include <r_core.h>
+
+#define FCNS 20000
+#define FCNSZ 0x100
+
+static double now(void) {
+	return r_time_now_mono () / 1000000.0;
+}
+
+static ut64 rnd(ut64 *seed) {
+	*seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	return *seed >> 33;
+}
+
+static RCore *newcore(int n) {
+	RCore *core = r_core_new ();
+	if (core) {
+		r_config_set (core->config, "asm.arch", "null");
+		r_core_cmdf (core, "o malloc://%d", n * FCNSZ);
+	}
+	return core;
+}
+
+static void addfcn(RCore *core, ut64 at, const char *name, const ut8 *buf, int size) {
+	r_io_write_at (core->io, at, buf, size);
+	r_core_cmdf (core, "af+ 0x%"PFMT64x" %s", at, name);
+	const int nbbs = 1 + (size / 0x40);
+	const int bbsz = size / nbbs;
+	int j;
+	for (j = 0; j < nbbs; j++) {
+		const ut64 bb = at + j * bbsz;
+		const int sz = (j + 1 < nbbs)? bbsz: size - j * bbsz;
+		if (j + 1 < nbbs) {
+			r_core_cmdf (core, "afb+ 0x%"PFMT64x" 0x%"PFMT64x" %d 0x%"PFMT64x, at, bb, sz, bb + sz);
+		} else {
+			r_core_cmdf (core, "afb+ 0x%"PFMT64x" 0x%"PFMT64x" %d", at, bb, sz);
+		}
+	}
+}
+
+int main(int argc, char **argv) {
+	const int n = (argc > 1)? atoi (argv[1]): FCNS;
+	if (n < 20) {
+		return 1;
+	}
+	const int extra = n / 20;
+	RCore *a = newcore (n);
+	RCore *b = newcore (n + extra);
+	int *slot = R_NEWS (int, n + extra);
+	int *size = R_NEWS (int, n);
+	ut8 *code = malloc ((size_t)n * FCNSZ);
+	if (!a || !b || !slot || !size || !code) {
+		return 1;
+	}
+	// the second build has the functions in another order
+	ut64 seed = 0x1337;
+	int i, j;
+	for (i = 0; i < n + extra; i++) {
+		slot[i] = i;
+	}
+	for (i = n + extra - 1; i > 0; i--) {
+		j = rnd (&seed) % (i + 1);
+		int t = slot[i];
+		slot[i] = slot[j];
+		slot[j] = t;
+	}
+	ut8 buf[FCNSZ];
+	for (i = 0; i < n; i++) {
+		size[i] = 0x40 + rnd (&seed) % (FCNSZ - 0x40);
+		ut8 *c = code + (size_t)i * FCNSZ;
+		for (j = 0; j < size[i]; j++) {
+			c[j] = rnd (&seed);
+		}
+		if (i % 50 == 49) {
+			// some stubs are identical
+			memcpy (c, code, R_MIN (size[i], size[0]));
+			size[i] = size[0];
+		}
+		// stripped, with a few symbols
+		char *name = (i % 10 == 5)? r_str_newf ("sym.func_%d", i): r_str_newf ("fcn.%08x", i * FCNSZ);
+		addfcn (a, (ut64)i * FCNSZ, name, c, size[i]);
+		free (name);
+		const ut64 at = (ut64)slot[i] * FCNSZ;
+		memcpy (buf, c, size[i]);
+		switch (i % 20) {
+		case 0: // removed
+			continue;
+		case 1: // rewritten
+			for (j = 0; j < size[i]; j++) {
+				buf[j] = rnd (&seed);
+			}
+			break;
+		case 2:
+		case 3:
+		case 4: // patched
+			for (j = 0; j < size[i]; j++) {
+				if (!(rnd (&seed) % 16)) {
+					buf[j] = rnd (&seed);
+				}
+			}
+			break;
+		}
+		name = (i % 10 == 5)? r_str_newf ("sym.func_%d", i): r_str_newf ("fcn.%08"PFMT64x, at);
+		addfcn (b, at, name, buf, size[i]);
+		free (name);
+	}
+	for (i = n; i < n + extra; i++) {
+		const int sz = 0x40 + rnd (&seed) % (FCNSZ - 0x40);
+		for (j = 0; j < sz; j++) {
+			buf[j] = rnd (&seed);
+		}
+		char *name = r_str_newf ("fcn.%08x", slot[i] * FCNSZ);
+		addfcn (b, (ut64)slot[i] * FCNSZ, name, buf, sz);
+		free (name);
+	}
+	// every function calls two others from its first block
+	for (i = 0; i < n; i++) {
+		for (j = 0; j < 2; j++) {
+			const int to = rnd (&seed) % n;
+			r_anal_xrefs_set (a->anal, (ut64)i * FCNSZ, (ut64)to * FCNSZ, R_ANAL_REF_TYPE_CALL);
+			if (i % 20 && to % 20) {
+				r_anal_xrefs_set (b->anal, (ut64)slot[i] * FCNSZ, (ut64)slot[to] * FCNSZ, R_ANAL_REF_TYPE_CALL);
+			}
+		}
+	}
+	double t = now ();
+	r_core_gdiff (a, b);
+	t = now () - t;
+	int match = 0, unmatch = 0, good = 0, bad = 0;
+	RListIter *iter;
+	RAnalFunction *fcn;
+	r_list_foreach (a->anal->fcns, iter, fcn) {
+		i = fcn->addr / FCNSZ;
+		if (fcn->diff->type == R_ANAL_DIFF_TYPE_NULL) {
+			continue;
+		}
+		if (fcn->diff->type == R_ANAL_DIFF_TYPE_MATCH) {
+			match++;
+		} else {
+			unmatch++;
+		}
+		if (fcn->diff->addr == (ut64)slot[i] * FCNSZ && i % 20) {
+			good++;
+		} else if (i % 50 != 49) {
+			bad++;
+		}
+	}
+	printf ("gdiff   %d fcns %8.3fs\n", n, t);
+	printf ("paired  %d match %d unmatch %d\n", match + unmatch, match, unmatch);
+	printf ("right   %d wrong %d (of %d)\n", good, bad, n - n / 20);
+	free (slot);
+	free (size);
+	free (code);
+	r_core_free (a);
+	r_core_free (b);
+	return 0;
+}
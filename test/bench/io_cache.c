@@ -0,0 +1,73 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+// Measure the read latency of io.cache after lots of small writes
+
+#include <r_io.h>
+
+#define WRITES 1000000
+#define READS 200000
+
+static double now(void) {
+	return r_time_now_mono () / 1000000.0;
+}
+
+static ut64 rss(void) {
+	ut64 kb = 0;
+	char *s = r_file_slurp ("/proc/self/status", NULL);
+	if (s) {
+		const char *p = strstr (s, "VmRSS:");
+		if (p) {
+			kb = r_num_get (NULL, p + 6);
+		}
+		free (s);
+	}
+	return kb;
+}
+
+static void bench(const char *name, int writes, bool coalesce, ut64 limit) {
+	const ut64 size = (ut64)writes * 4;
+	RIO *io = r_io_new ();
+	char *uri = r_str_newf ("malloc://%"PFMT64u, size);
+	r_io_open_at (io, uri, R_PERM_RW, 0644, 0);
+	free (uri);
+	io->cache.mode = R_PERM_RW;
+	io->cache.coalesce = coalesce;
+	io->cache.limit = limit;
+	ut64 base = rss ();
+	double t = now ();
+	int i;
+	for (i = 0; i < writes; i++) {
+		ut32 v = i;
+		r_io_cache_write_at (io, (ut64)i * 4, (const ut8 *)&v, sizeof (v));
+	}
+	t = now () - t;
+	RIOCacheLayer *layer = r_list_last (io->cache.layers);
+	printf ("%-10s write %8d  %8.3fs  %6.0f ns/write  %6d items  %"PFMT64u" KB\n", name,
+		writes, t, t * 1e9 / writes, r_pvector_length (layer->vec), rss () - base);
+	ut8 buf[64];
+	ut64 seed = 0x1337;
+	t = now ();
+	for (i = 0; i < READS; i++) {
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		r_io_read_at (io, (seed >> 33) % (size - sizeof (buf)), buf, sizeof (buf));
+	}
+	t = now () - t;
+	printf ("%-10s read  %8d  %8.3fs  %6.0f ns/read\n", name, READS, t, t * 1e9 / READS);
+	r_io_free (io);
+}
+
+int main(int argc, char **argv) {
+	const char *mode = (argc > 1)? argv[1]: "items";
+	const int writes = (argc > 2)? atoi (argv[2]): WRITES;
+	if (writes < 16) {
+		return 1;
+	}
+	if (!strcmp (mode, "coalesce")) {
+		bench (mode, writes, true, 0);
+	} else if (!strcmp (mode, "limit")) {
+		bench (mode, writes, false, 4 * 1024 * 1024);
+	} else {
+		bench ("items", writes, false, 0);
+	}
+	return 0;
+}
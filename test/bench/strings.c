@@ -0,0 +1,100 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+// Measure the time and memory spent finding the strings of a big raw blob
+
+#include <r_bin.h>
+
+#define SIZE_MB 256
+
+static double now(void) {
+	return r_time_now_mono () / 1000000.0;
+}
+
+static ut64 rss(void) {
+	ut64 kb = 0;
+	char *s = r_file_slurp ("/proc/self/status", NULL);
+	if (s) {
+		const char *p = strstr (s, "VmRSS:");
+		if (p) {
+			kb = r_num_get (NULL, p + 6);
+		}
+		free (s);
+	}
+	return kb;
+}
+
+// mostly binary data and padding with a few ascii and wide strings, like a firmware image
+static ut8 *blob_new(ut64 size) {
+	static const char *words[] = { "/etc/init.d/rcS", "Copyright (c) 2023", "%s: invalid argument\n", "eth0" };
+	ut8 *buf = calloc (size, 1);
+	if (!buf) {
+		return NULL;
+	}
+	ut64 seed = 0x1337;
+	ut64 i = 0;
+	while (i + 256 < size) {
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		const int n = (seed >> 33) % 200;
+		switch ((seed >> 20) % 32) {
+		case 0:
+			i += n * 8; // zero padding
+			break;
+		case 1: {
+			const char *w = words[(seed >> 40) % 4];
+			size_t j, len = strlen (w);
+			for (j = 0; j < len; j++) {
+				buf[i + j * 2] = w[j];
+			}
+			i += len * 2 + 2;
+			break;
+		}
+		case 2: {
+			const char *w = words[(seed >> 40) % 4];
+			strcpy ((char *)buf + i, w);
+			i += strlen (w) + 1;
+			break;
+		}
+		default: {
+			int j;
+			for (j = 0; j < n; j++) {
+				seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+				buf[i + j] = (seed >> 56) | 0x80;
+			}
+			i += n;
+			break;
+		}
+		}
+	}
+	return buf;
+}
+
+int main(int argc, char **argv) {
+	const int threads = (argc > 1)? atoi (argv[1]): 1;
+	const ut64 size = (ut64)((argc > 2)? atoi (argv[2]): SIZE_MB) * 1024 * 1024;
+	ut8 *data = blob_new (size);
+	RBin *bin = r_bin_new ();
+	RIO *io = r_io_new ();
+	if (!data || !bin || !io) {
+		return 1;
+	}
+	r_io_bind (io, &bin->iob);
+	bin->strthreads = threads;
+	RBuffer *b = r_buf_new_with_pointers (data, size, true);
+	RBinFileOptions opt;
+	r_bin_file_options_init (&opt, -1, 0, 0, 0);
+	if (!r_bin_open_buf (bin, b, &opt)) {
+		return 1;
+	}
+	RBinFile *bf = r_bin_cur (bin);
+	ut64 base = rss ();
+	double t = now ();
+	RList *list = r_bin_raw_strings (bf, 4);
+	t = now () - t;
+	printf ("threads %d  %"PFMT64u" MB  %8.3fs  %6.0f MB/s  %d strings  %"PFMT64u" KB\n",
+		threads, size >> 20, t, (size >> 20) / t, r_list_length (list), rss () - base);
+	r_list_free (list);
+	r_buf_free (b);
+	r_bin_free (bin);
+	r_io_free (io);
+	return 0;
+}
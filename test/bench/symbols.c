@@ -0,0 +1,150 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+// Measure the time and the allocations spent loading and filtering the symbols of an ELF with 2M of them
+
+#include <r_bin.h>
+
+#define NSYMS (2 * 1024 * 1024)
+#define TEXT_ADDR 0x400000
+
+// count every allocation made by the process, glibc only
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t n, size_t size);
+extern void *__libc_realloc(void *p, size_t size);
+static ut64 allocs = 0;
+
+void *malloc(size_t size) {
+	allocs++;
+	return __libc_malloc (size);
+}
+
+void *calloc(size_t n, size_t size) {
+	allocs++;
+	return __libc_calloc (n, size);
+}
+
+void *realloc(void *p, size_t size) {
+	allocs++;
+	return __libc_realloc (p, size);
+}
+
+static double now(void) {
+	return r_time_now_mono () / 1000000.0;
+}
+
+static void put_shdr(ut8 *p, ut32 name, ut32 type, ut64 flags, ut64 addr, ut64 off, ut64 size, ut32 link, ut32 info, ut64 align, ut64 entsize) {
+	r_write_le32 (p, name);
+	r_write_le32 (p + 4, type);
+	r_write_le64 (p + 8, flags);
+	r_write_le64 (p + 16, addr);
+	r_write_le64 (p + 24, off);
+	r_write_le64 (p + 32, size);
+	r_write_le32 (p + 40, link);
+	r_write_le32 (p + 44, info);
+	r_write_le64 (p + 48, align);
+	r_write_le64 (p + 56, entsize);
+}
+
+// ELF64 relocatable object with a .text section and n function symbols, one in 16 reuses a name
+static ut8 *elf_new(ut32 n, ut64 *size) {
+	const char shstr[] = "\0.text\0.symtab\0.strtab\0.shstrtab\0";
+	const ut64 text_size = (ut64)n * 4;
+	RStrBuf *sb = r_strbuf_new ("");
+	ut32 *names = R_NEWS (ut32, n);
+	if (!sb || !names) {
+		return NULL;
+	}
+	r_strbuf_append_n (sb, "", 1);
+	ut32 i;
+	for (i = 0; i < n; i++) {
+		names[i] = r_strbuf_length (sb);
+		if (i % 16) {
+			r_strbuf_appendf (sb, "function_%u", i);
+		} else {
+			r_strbuf_appendf (sb, "dup_%u", (i / 16) % 1024);
+		}
+		r_strbuf_append_n (sb, "", 1);
+	}
+	const ut64 text_off = 64;
+	const ut64 sym_off = text_off + text_size;
+	const ut64 sym_size = (ut64)(n + 1) * 24;
+	const ut64 str_off = sym_off + sym_size;
+	const ut64 str_size = r_strbuf_length (sb);
+	const ut64 shstr_off = str_off + str_size;
+	const ut64 sh_off = R_ROUND (shstr_off + sizeof (shstr), 8);
+	*size = sh_off + 5 * 64;
+	ut8 *buf = calloc (*size, 1);
+	if (!buf) {
+		return NULL;
+	}
+	memcpy (buf, "\x7f" "ELF\x02\x01\x01", 7);
+	r_write_le16 (buf + 16, 1); // ET_REL
+	r_write_le16 (buf + 18, 62); // x86-64
+	r_write_le32 (buf + 20, 1);
+	r_write_le64 (buf + 40, sh_off);
+	r_write_le16 (buf + 52, 64);
+	r_write_le16 (buf + 58, 64);
+	r_write_le16 (buf + 60, 5);
+	r_write_le16 (buf + 62, 4);
+	memset (buf + text_off, 0xc3, text_size);
+	for (i = 0; i < n; i++) {
+		ut8 *sym = buf + sym_off + (i + 1) * 24;
+		r_write_le32 (sym, names[i]);
+		sym[4] = 0x12; // STB_GLOBAL, STT_FUNC
+		r_write_le16 (sym + 6, 1);
+		r_write_le64 (sym + 8, i * 4);
+		r_write_le64 (sym + 16, 4);
+	}
+	memcpy (buf + str_off, r_strbuf_get (sb), str_size);
+	memcpy (buf + shstr_off, shstr, sizeof (shstr));
+	ut8 *sh = buf + sh_off;
+	put_shdr (sh + 64, 1, 1, 6, TEXT_ADDR, text_off, text_size, 0, 0, 16, 0);
+	put_shdr (sh + 128, 7, 2, 0, 0, sym_off, sym_size, 3, 1, 8, 24);
+	put_shdr (sh + 192, 15, 3, 0, 0, str_off, str_size, 0, 0, 1, 0);
+	put_shdr (sh + 256, 23, 3, 0, 0, shstr_off, sizeof (shstr), 0, 0, 1, 0);
+	r_strbuf_free (sb);
+	free (names);
+	return buf;
+}
+
+int main(int argc, char **argv) {
+	const ut32 n = (argc > 1)? atoi (argv[1]): NSYMS;
+	ut64 size = 0;
+	ut8 *data = elf_new (n, &size);
+	RBin *bin = r_bin_new ();
+	RIO *io = r_io_new ();
+	if (!data || !bin || !io) {
+		return 1;
+	}
+	r_io_bind (io, &bin->iob);
+	RBuffer *b = r_buf_new_with_pointers (data, size, true);
+	RBinFileOptions opt;
+	r_bin_file_options_init (&opt, -1, 0, 0, 0);
+	if (!r_bin_open_buf (bin, b, &opt)) {
+		return 1;
+	}
+	RBinFile *bf = r_bin_cur (bin);
+
+	ut64 a = allocs;
+	double t = now ();
+	RList *symbols = r_bin_get_symbols (bin);
+	t = now () - t;
+	printf ("load    %d symbols  %8.3fs  %10"PFMT64u" allocs\n", r_list_length (symbols), t, allocs - a);
+
+	a = allocs;
+	t = now ();
+	r_bin_filter_symbols (bf, symbols);
+	t = now () - t;
+	RListIter *iter;
+	RBinSymbol *sym;
+	int dups = 0;
+	r_list_foreach (symbols, iter, sym) {
+		dups += sym->dup_count > 0;
+	}
+	printf ("filter  %d dups     %8.3fs  %10"PFMT64u" allocs\n", dups, t, allocs - a);
+
+	r_buf_free (b);
+	r_bin_free (bin);
+	r_io_free (io);
+	return 0;
+}
@@ -0,0 +1,65 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+// Measure the cost of dispatching tasks to the thread pool
+
+#include <r_util.h>
+
+#define TASKS 200000
+
+static void *nop(void *user) {
+	return user;
+}
+
+static void sum(void *user, size_t from, size_t to) {
+	// keep the loop body small, this measures the dispatch not the work
+	volatile size_t n = 0;
+	size_t i;
+	for (i = from; i < to; i++) {
+		n += i;
+	}
+}
+
+static double now(void) {
+	return r_time_now_mono () / 1000000.0;
+}
+
+static void bench_submit(RThreadPool *pool) {
+	RThreadFuture **fs = R_NEWS (RThreadFuture *, TASKS);
+	if (!fs) {
+		return;
+	}
+	double t = now ();
+	int i;
+	for (i = 0; i < TASKS; i++) {
+		fs[i] = r_th_pool_submit (pool, nop, NULL);
+	}
+	for (i = 0; i < TASKS; i++) {
+		r_th_future_free (fs[i]);
+	}
+	t = now () - t;
+	printf ("submit+wait  %7d tasks  %8.3fs  %6.0f ns/task\n", TASKS, t, t * 1e9 / TASKS);
+	free (fs);
+}
+
+static void bench_for(RThreadPool *pool, size_t grain) {
+	const size_t n = (size_t)TASKS * grain;
+	double t = now ();
+	r_th_parallel_for (pool, 0, n, grain, sum, NULL);
+	t = now () - t;
+	printf ("parallel_for %7d tasks  %8.3fs  %6.0f ns/task (grain %d)\n",
+		TASKS, t, t * 1e9 / TASKS, (int)grain);
+}
+
+int main(int argc, char **argv) {
+	int threads = (argc > 1)? atoi (argv[1]): 0;
+	RThreadPool *pool = r_th_pool_new (threads);
+	if (!pool) {
+		return 1;
+	}
+	printf ("threads: %d\n", pool->size);
+	bench_submit (pool);
+	bench_for (pool, 1);
+	bench_for (pool, 64);
+	r_th_pool_free (pool);
+	return 0;
+}
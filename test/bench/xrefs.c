@@ -0,0 +1,84 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+// Measure the memory and time spent storing and querying code references
+
+#include <r_anal.h>
+
+#define REFS 2000000
+#define TARGETS 50000
+
+static double now(void) {
+	return r_time_now_mono () / 1000000.0;
+}
+
+static ut64 rss(void) {
+	ut64 kb = 0;
+	char *s = r_file_slurp ("/proc/self/status", NULL);
+	if (s) {
+		const char *p = strstr (s, "VmRSS:");
+		if (p) {
+			kb = r_num_get (NULL, p + 6);
+		}
+		free (s);
+	}
+	return kb;
+}
+
+static bool count_cb(void *user, const RAnalRef *ref) {
+	(*(ut64 *)user)++;
+	return true;
+}
+
+int main(int argc, char **argv) {
+	const int refs = (argc > 1)? atoi (argv[1]): REFS;
+	RAnal *anal = r_anal_new ();
+	if (!anal || refs < 1) {
+		return 1;
+	}
+	ut64 base = rss ();
+	ut64 seed = 0x1337;
+	double t = now ();
+	int i;
+	for (i = 0; i < refs; i++) {
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		const ut64 from = 0x400000 + (ut64)i * 4;
+		const ut64 to = 0x400000 + ((seed >> 33) % TARGETS) * 0x40;
+		r_anal_xrefs_set (anal, from, to, (i & 3)? R_ANAL_REF_TYPE_CALL: R_ANAL_REF_TYPE_DATA);
+	}
+	t = now () - t;
+	printf ("set    %8d refs  %8.3fs  %6.0f ns/ref  %"PFMT64u" KB\n",
+		refs, t, t * 1e9 / refs, rss () - base);
+	ut64 n = 0;
+	t = now ();
+	for (i = 0; i < TARGETS; i++) {
+		RList *list = r_anal_xrefs_get (anal, 0x400000 + (ut64)i * 0x40);
+		n += r_list_length (list);
+		r_list_free (list);
+	}
+	t = now () - t;
+	printf ("get    %8d addrs %8.3fs  %6.0f ns/addr (%"PFMT64u" xrefs)\n",
+		TARGETS, t, t * 1e9 / TARGETS, n);
+	n = 0;
+	t = now ();
+	for (i = 0; i < TARGETS; i++) {
+		r_anal_xrefs_foreach (anal, 0x400000 + (ut64)i * 0x40, count_cb, &n);
+	}
+	t = now () - t;
+	printf ("iter   %8d addrs %8.3fs  %6.0f ns/addr (%"PFMT64u" xrefs)\n",
+		TARGETS, t, t * 1e9 / TARGETS, n);
+	t = now ();
+	for (i = 0; i < refs; i += 2) {
+		const ut64 from = 0x400000 + (ut64)i * 4;
+		RList *list = r_anal_refs_get (anal, from);
+		RAnalRef *ref = list? r_list_first (list): NULL;
+		if (ref) {
+			r_anal_xref_del (anal, ref->at, ref->addr);
+		}
+		r_list_free (list);
+	}
+	t = now () - t;
+	printf ("del    %8d refs  %8.3fs  %6.0f ns/ref (%"PFMT64u" left)\n",
+		refs / 2, t, t * 2e9 / refs, r_anal_xrefs_count (anal));
+	r_anal_free (anal);
+	return 0;
+}
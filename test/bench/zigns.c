@@ -0,0 +1,79 @@
+/* radare - LGPL - Copyright 2023 - pancake */
+
+// Measure the time spent generating the zignatures of every function and matching them back
+
+#include <r_core.h>
+
+#define FCNS 20000
+#define FCNSZ 0x100
+
+static double now(void) {
+	return r_time_now_mono () / 1000000.0;
+}
+
+static int match_cb(RSignItem *it, RAnalFunction *fcn, RSignType *types, void *user, RList *col) {
+	(*(int *)user)++;
+	return 1;
+}
+
+int main(int argc, char **argv) {
+	const int n = (argc > 1)? atoi (argv[1]): FCNS;
+	const int threads = (argc > 2)? atoi (argv[2]): 1;
+	RCore *core = r_core_new ();
+	if (!core || n < 1) {
+		return 1;
+	}
+	r_config_set (core->config, "asm.arch", "null");
+	r_config_set_i (core->config, "zign.threads", threads);
+	r_core_cmdf (core, "o malloc://%d", n * FCNSZ);
+	r_core_cmd0 (core, "wr $s @ 0");
+	// every function is split in one to eight blocks, some of them with two successors
+	ut64 seed = 0x1337;
+	int i, j;
+	for (i = 0; i < n; i++) {
+		const ut64 at = (ut64)i * FCNSZ;
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		const int nbbs = 1 + (seed >> 33) % 8;
+		const int bbsz = FCNSZ / nbbs;
+		r_core_cmdf (core, "af+ 0x%"PFMT64x" fcn.%d", at, i);
+		for (j = 0; j < nbbs; j++) {
+			const ut64 bb = at + j * bbsz;
+			if (j + 2 < nbbs && (seed >> (j + 8)) & 1) {
+				r_core_cmdf (core, "afb+ 0x%"PFMT64x" 0x%"PFMT64x" %d 0x%"PFMT64x" 0x%"PFMT64x,
+					at, bb, bbsz, bb + bbsz, bb + 2 * bbsz);
+			} else if (j + 1 < nbbs) {
+				r_core_cmdf (core, "afb+ 0x%"PFMT64x" 0x%"PFMT64x" %d 0x%"PFMT64x, at, bb, bbsz, bb + bbsz);
+			} else {
+				r_core_cmdf (core, "afb+ 0x%"PFMT64x" 0x%"PFMT64x" %d", at, bb, bbsz);
+			}
+		}
+	}
+	double t = now ();
+	const int count = r_sign_all_functions (core->anal, false);
+	printf ("zg      %d zigns    %8.3fs\n", count, now () - t);
+	r_sign_delete (core->anal, "*");
+
+	// added one by one, unlike zg, so no zignature suggests the next function
+	t = now ();
+	RListIter *iter;
+	RAnalFunction *fcn;
+	r_list_foreach (core->anal->fcns, iter, fcn) {
+		r_sign_add_func (core->anal, fcn, NULL);
+	}
+	printf ("zaf     %d zigns    %8.3fs\n", r_sign_space_count_for (core->anal, NULL), now () - t);
+
+	int hits = 0;
+	RSignSearchMetrics sm = {
+		.stypes = { R_SIGN_BYTES, R_SIGN_GRAPH, R_SIGN_BBHASH, R_SIGN_END },
+		.mincc = 0,
+		.minsz = 16,
+		.anal = core->anal,
+		.user = &hits,
+		.cb = match_cb,
+	};
+	t = now ();
+	r_sign_metric_search (core->anal, &sm);
+	printf ("search  %d hits     %8.3fs\n", hits, now () - t);
+	r_core_free (core);
+	return 0;
+}
@@ -0,0 +1,98 @@
+#include <r_bin.h>
+#include "minunit.h"
+
+bool test_r_bin_addrline_lookup(void) {
+	RBinAddrLineStore *s = r_bin_addrline_store_new ();
+	mu_assert_notnull (s, "store");
+	ut32 i;
+	// added backwards to exercise the sorting, more than one block worth of rows
+	for (i = 1000; i > 0; i--) {
+		const char *file = (i % 2)? "/src/odd.c": "/src/even.c";
+		mu_assert_true (r_bin_addrline_add (s, 0x1000 + i * 4, file, i, i % 7), "add");
+	}
+	mu_assert_eq (r_bin_addrline_count (s), 1000, "count");
+
+	RBinAddrline row;
+	mu_assert_true (r_bin_addrline_get (s, 0x1000 + 333 * 4, &row), "get");
+	mu_assert_streq (row.file, "/src/odd.c", "file");
+	mu_assert_eq (row.line, 333, "line");
+	mu_assert_eq (row.column, 333 % 7, "column");
+	mu_assert_false (r_bin_addrline_get (s, 0x1001, &row), "no row between addresses");
+	mu_assert_false (r_bin_addrline_get (s, 0, &row), "no row before the first");
+
+	// add keeps the first row, set replaces it
+	r_bin_addrline_add (s, 0x1000 + 4, "/src/other.c", 1, 0);
+	mu_assert_true (r_bin_addrline_get (s, 0x1000 + 4, &row), "get first");
+	mu_assert_streq (row.file, "/src/odd.c", "add does not replace");
+	r_bin_addrline_set (s, 0x1000 + 4, "/src/other.c", 1, 0);
+	mu_assert_true (r_bin_addrline_get (s, 0x1000 + 4, &row), "get first");
+	mu_assert_streq (row.file, "/src/other.c", "set replaces");
+
+	mu_assert_true (r_bin_addrline_find (s, "/src/even.c", 500, &row), "find by path");
+	mu_assert_eq (row.addr, 0x1000 + 500 * 4, "find addr");
+	mu_assert_true (r_bin_addrline_find (s, "odd.c", 999, &row), "find by basename");
+	mu_assert_eq (row.addr, 0x1000 + 999 * 4, "find basename addr");
+	mu_assert_false (r_bin_addrline_find (s, "odd.c", 500, &row), "no such line");
+
+	mu_assert_true (r_bin_addrline_del (s, 0x1000 + 8), "del");
+	mu_assert_false (r_bin_addrline_get (s, 0x1000 + 8, &row), "deleted");
+	mu_assert_eq (r_bin_addrline_count (s), 999, "count after del");
+	r_bin_addrline_store_free (s);
+	mu_end;
+}
+
+static bool count_cb(void *user, const RBinAddrline *row) {
+	ut64 *last = user;
+	if (row->addr <= last[0] && last[1]) {
+		return false;
+	}
+	last[0] = row->addr;
+	last[1]++;
+	return true;
+}
+
+bool test_r_bin_addrline_serialize(void) {
+	RBinAddrLineStore *s = r_bin_addrline_store_new ();
+	ut32 i;
+	for (i = 0; i < 300; i++) {
+		r_bin_addrline_add (s, 0x400000 + i * 3, (i % 3)? "a.c": "b.c", i + 1, 0);
+	}
+	r_bin_addrline_set (s, 0x10, "some note", R_BIN_ADDRLINE_TEXT, 0);
+	ut32 size = 0;
+	ut8 *buf = r_bin_addrline_serialize (s, &size);
+	mu_assert_notnull (buf, "serialize");
+
+	RBinAddrLineStore *d = r_bin_addrline_store_new ();
+	mu_assert_true (r_bin_addrline_unserialize (d, buf, size), "unserialize");
+	mu_assert_eq (r_bin_addrline_count (d), 301, "count");
+	RBinAddrline row;
+	mu_assert_true (r_bin_addrline_get (d, 0x400000 + 150 * 3, &row), "get");
+	mu_assert_streq (row.file, "b.c", "file");
+	mu_assert_eq (row.line, 151, "line");
+	mu_assert_true (r_bin_addrline_get (d, 0x10, &row), "get text");
+	mu_assert_eq (row.line, R_BIN_ADDRLINE_TEXT, "text row");
+	ut64 last[2] = {0};
+	mu_assert_true (r_bin_addrline_foreach (d, count_cb, last), "rows are sorted");
+	mu_assert_eq (last[1], 301, "foreach count");
+	RList *files = r_bin_addrline_files (d);
+	mu_assert_eq (r_list_length (files), 2, "text notes are not files");
+	r_list_free (files);
+
+	buf[size - 1] ^= 0xff;
+	mu_assert_false (r_bin_addrline_unserialize (d, buf, size - 1), "truncated");
+	mu_assert_eq (r_bin_addrline_count (d), 0, "reset on failure");
+	free (buf);
+	r_bin_addrline_store_free (d);
+	r_bin_addrline_store_free (s);
+	mu_end;
+}
+
+int all_tests() {
+	mu_run_test (test_r_bin_addrline_lookup);
+	mu_run_test (test_r_bin_addrline_serialize);
+	return tests_passed != tests_run;
+}
+
+int main(int argc, char **argv) {
+	return all_tests ();
+}
@@ -18,8 +18,109 @@ bool test_r_anal_xrefs_count() {
 	mu_end;
 }
 
+bool test_r_anal_xrefs_get() {
+	RAnal *anal = r_anal_new ();
+	r_anal_xrefs_set (anal, 0x200, 0x100, R_ANAL_REF_TYPE_CALL);
+	r_anal_xrefs_set (anal, 0x180, 0x100, R_ANAL_REF_TYPE_JUMP);
+	r_anal_xrefs_set (anal, 0x200, 0x100, R_ANAL_REF_TYPE_DATA);
+	r_anal_xrefs_set (anal, 0x180, 0x9000, R_ANAL_REF_TYPE_DATA);
+	RList *list = r_anal_xrefs_get (anal, 0x100);
+	mu_assert_eq (r_list_length (list), 2, "xrefs to 0x100");
+	RAnalRef *ref = r_list_get_n (list, 0);
+	mu_assert_eq (ref->addr, 0x180, "sorted by source");
+	mu_assert_eq (ref->at, 0x100, "destination");
+	ref = r_list_get_n (list, 1);
+	mu_assert_eq (ref->addr, 0x200, "second source");
+	mu_assert_eq (R_ANAL_REF_TYPE_MASK (ref->type), R_ANAL_REF_TYPE_DATA, "last type wins");
+	r_list_free (list);
+	list = r_anal_refs_get (anal, 0x180);
+	mu_assert_eq (r_list_length (list), 2, "refs from 0x180");
+	ref = r_list_get_n (list, 1);
+	mu_assert_eq (ref->addr, 0x9000, "far destination");
+	r_list_free (list);
+	mu_assert_true (r_anal_xref_del (anal, 0x180, 0x100), "delete");
+	mu_assert_false (r_anal_xref_del (anal, 0x180, 0x100), "delete twice");
+	mu_assert_eq (r_anal_xrefs_count (anal), 2, "count after delete");
+	mu_assert_null (r_anal_xrefs_get (anal, 0x180), "no xrefs");
+	r_anal_free (anal);
+	mu_end;
+}
+
+#define RANDOM_REFS 20000
+
+static bool collect_cb(void *user, const RAnalRef *ref) {
+	r_vector_push ((RVector *)user, (void *)ref);
+	return true;
+}
+
+static int model_cmp(const void *a, const void *b) {
+	const RAnalRef *ra = a, *rb = b;
+	if (ra->at != rb->at) {
+		return (ra->at < rb->at)? -1: 1;
+	}
+	return (ra->addr < rb->addr)? -1: (ra->addr > rb->addr);
+}
+
+bool test_r_anal_xrefs_random() {
+	RAnal *anal = r_anal_new ();
+	// model of the destinations table, indexed by source
+	ut64 *to = calloc (RANDOM_REFS, sizeof (ut64));
+	ut64 seed = 31337;
+	int i, n = 0;
+	for (i = 0; i < RANDOM_REFS * 2; i++) {
+		seed = seed * 6364136223846793005ULL + 1;
+		const int from = (seed >> 33) % RANDOM_REFS;
+		const ut64 dst = 0x1000 + ((seed >> 20) % 512) * 0x10;
+		if (to[from]) {
+			r_anal_xref_del (anal, 0x100000 + from, to[from]);
+			n--;
+		}
+		if (i & 7) {
+			to[from] = dst;
+			r_anal_xrefs_set (anal, 0x100000 + from, dst, R_ANAL_REF_TYPE_CODE);
+			n++;
+		} else {
+			to[from] = 0;
+		}
+		if (!(i % 5000)) {
+			// reads force the pending records to be merged
+			mu_assert_eq (r_anal_xrefs_count (anal), n, "count");
+		}
+	}
+	mu_assert_eq (r_anal_xrefs_count (anal), n, "final count");
+	RVector model, got;
+	r_vector_init (&model, sizeof (RAnalRef), NULL, NULL);
+	r_vector_init (&got, sizeof (RAnalRef), NULL, NULL);
+	for (i = 0; i < RANDOM_REFS; i++) {
+		if (to[i]) {
+			RAnalRef r = { .addr = 0x100000 + i, .at = to[i] };
+			r_vector_push (&model, &r);
+		}
+	}
+	qsort (model.a, model.len, sizeof (RAnalRef), model_cmp);
+	mu_assert_true (r_anal_xrefs_foreach (anal, UT64_MAX, collect_cb, &got), "foreach");
+	mu_assert_eq (got.len, model.len, "same number of xrefs");
+	bool ok = true;
+	for (i = 0; i < model.len; i++) {
+		RAnalRef *a = r_vector_index_ptr (&model, i);
+		RAnalRef *b = r_vector_index_ptr (&got, i);
+		ok &= a->at == b->at && a->addr == b->addr;
+	}
+	mu_assert_true (ok, "xrefs match the model");
+	r_vector_clear (&got);
+	mu_assert_true (r_anal_refs_foreach (anal, 0x100000 + 7, collect_cb, &got), "refs from one address");
+	mu_assert_eq (got.len, to[7]? 1: 0, "refs from one address");
+	r_vector_fini (&model);
+	r_vector_fini (&got);
+	free (to);
+	r_anal_free (anal);
+	mu_end;
+}
+
 int all_tests() {
 	mu_run_test (test_r_anal_xrefs_count);
+	mu_run_test (test_r_anal_xrefs_get);
+	mu_run_test (test_r_anal_xrefs_random);
 	return tests_passed != tests_run;
 }
 
@@ -417,10 +417,58 @@ bool test_dwarf2_big_endian(void) {
 	mu_end;
 }
 
+bool test_dwarf_cu_index(void) {
+	RBin *bin = r_bin_new ();
+	RIO *io = r_io_new ();
+	r_io_bind (io, &bin->iob);
+
+	RBinFileOptions opt = {0};
+	bool res = r_bin_open (bin, "bins/elf/dwarf4_many_comp_units.elf", &opt);
+	mu_assert ("dwarf4_many_comp_units.elf binary could not be opened", res);
+
+	RBinDwarfDebugAbbrev *da = r_bin_dwarf_parse_abbrev (bin, MODE);
+	RBinDwarfDebugInfo *info = r_bin_dwarf_parse_info (da, bin, MODE);
+	mu_assert_notnull (info, "Failed parsing of debug_info");
+
+	// a single slot cache forces every lookup to decode its unit again
+	RBinDwarfCuIndex *ci = r_bin_dwarf_cu_index_new (bin, 8, 1);
+	mu_assert_notnull (ci, "Failed indexing debug_info");
+	mu_assert_eq (r_vector_length (&ci->units), info->count, "Wrong number of indexed units");
+	size_t i, j;
+	for (i = 0; i < info->count; i++) {
+		RBinDwarfCompUnit *cu = &info->comp_units[i];
+		ut64 low_pc = UT64_MAX;
+		for (j = 0; j < cu->dies[0].count; j++) {
+			if (cu->dies[0].attr_values[j].attr_name == DW_AT_low_pc) {
+				low_pc = cu->dies[0].attr_values[j].address;
+			}
+		}
+		mu_assert_neq (low_pc, UT64_MAX, "Unit without low_pc");
+		int unit = r_bin_dwarf_cu_index_find (ci, low_pc);
+		mu_assert_neq (unit, -1, "Address not covered by the index");
+		RBinDwarfCuEntry *e = r_vector_index_ptr (&ci->units, unit);
+		mu_assert_eq (e->offset, cu->offset, "Address resolved to the wrong unit");
+		const RBinDwarfDebugInfo *lazy = r_bin_dwarf_cu_index_get (ci, unit);
+		mu_assert_notnull (lazy, "Failed decoding unit");
+		mu_assert_eq (lazy->count, 1, "Decoded more than one unit");
+		mu_assert_eq (lazy->comp_units[0].offset, cu->offset, "Wrong unit offset");
+		mu_assert_eq (lazy->comp_units[0].count, cu->count, "Wrong number of DIEs");
+	}
+	mu_assert_eq (r_bin_dwarf_cu_index_find (ci, 0), -1, "Address 0 belongs to no unit");
+
+	r_bin_dwarf_cu_index_free (ci);
+	r_bin_dwarf_free_debug_info (info);
+	r_bin_dwarf_free_debug_abbrev (da);
+	r_bin_free (bin);
+	r_io_free (io);
+	mu_end;
+}
+
 bool all_tests() {
 	mu_run_test (test_dwarf3_c);
 	mu_run_test (test_dwarf4_cpp_multiple_modules);
 	mu_run_test (test_dwarf2_big_endian);
+	mu_run_test (test_dwarf_cu_index);
 	return tests_passed != tests_run;
 }
 
@@ -276,6 +276,157 @@ bool test_r_io_priority2(void) {
 	mu_end;
 }
 
+bool test_r_io_peek(void) {
+	RIO *io = r_io_new ();
+	io->va = true;
+	r_io_open_at (io, "malloc://16", R_PERM_RW, 0644, 0x1000);
+	r_io_open_at (io, "malloc://16", R_PERM_RW, 0644, 0x1010);
+	r_io_write_at (io, 0x1000, (const ut8 *)"0123456789abcdefABCDEFGHIJKLMNOP", 32);
+	const ut8 *ptr = NULL;
+	mu_assert_true (r_io_peek_at (io, 0x1004, 8, &ptr), "peek inside one map");
+	mu_assert_memeq (ptr, (const ut8 *)"456789ab", 8, "peeked bytes");
+	mu_assert_false (r_io_peek_at (io, 0x100c, 8, &ptr), "peek across two maps");
+	mu_assert_null (ptr, "no pointer when it fails");
+	mu_assert_false (r_io_peek_at (io, 0x2000, 8, &ptr), "peek unmapped");
+	r_io_cache_write_at (io, 0x1012, (const ut8 *)"zz", 2);
+	mu_assert_false (r_io_peek_at (io, 0x1010, 4, &ptr), "peek shadowed by the cache");
+	mu_assert_true (r_io_peek_at (io, 0x1014, 4, &ptr), "peek next to the cache");
+	mu_assert_memeq (ptr, (const ut8 *)"EFGH", 4, "peeked bytes next to the cache");
+	io->va = false;
+	mu_assert_true (r_io_peek_at (io, 4, 4, &ptr), "physical peek");
+	mu_assert_memeq (ptr, (const ut8 *)"4567", 4, "physical peek uses the current desc");
+	r_io_free (io);
+
+	char *file = r_file_temp ("peek");
+	r_file_dump (file, (const ut8 *)"radare2", 7, false);
+	io = r_io_new ();
+	io->va = true;
+	r_io_open_at (io, file, R_PERM_R, 0644, 0x100);
+	mu_assert_true (r_io_peek_at (io, 0x102, 3, &ptr), "peek a read-only file");
+	mu_assert_memeq (ptr, (const ut8 *)"dar", 3, "peeked file bytes");
+	r_io_free (io);
+	io = r_io_new ();
+	io->va = true;
+	r_io_open_at (io, file, R_PERM_RW, 0644, 0x100);
+	mu_assert_false (r_io_peek_at (io, 0x102, 3, &ptr), "writable files are remapped on write");
+	r_io_free (io);
+	r_file_rm (file);
+	free (file);
+	mu_end;
+}
+
+bool test_r_io_cache_coalesce(void) {
+	RIO *io = r_io_new ();
+	r_io_open_at (io, "malloc://0x3000", R_PERM_RW, 0644, 0);
+	io->cache.mode = R_PERM_RW;
+	io->cache.coalesce = true;
+	int i;
+	for (i = 0; i < 0x3000; i += 4) {
+		r_io_cache_write_at (io, i, (const ut8 *)"ABCD", 4);
+	}
+	RIOCacheLayer *layer = r_list_last (io->cache.layers);
+	mu_assert_eq (r_pvector_length (layer->vec), 3, "one item per page");
+	// sparse writes keep the bytes in between
+	r_io_cache_write_at (io, 0x10, (const ut8 *)"xx", 2);
+	ut8 buf[8];
+	r_io_read_at (io, 0xe, buf, sizeof (buf));
+	mu_assert_memeq (buf, (const ut8 *)"CDxxCDAB", sizeof (buf), "overlapped write");
+	mu_assert_eq (r_pvector_length (layer->vec), 3, "overlapped write is merged");
+	r_io_cache_write_at (io, 0xffe, (const ut8 *)"1234", 4);
+	r_io_read_at (io, 0xffc, buf, sizeof (buf));
+	mu_assert_memeq (buf, (const ut8 *)"AB1234CD", sizeof (buf), "write across pages");
+	mu_assert_eq (r_pvector_length (layer->vec), 4, "writes across pages are not merged");
+	r_io_free (io);
+	mu_end;
+}
+
+bool test_r_io_cache_spill(void) {
+	RIO *io = r_io_new ();
+	r_io_open_at (io, "malloc://0x10000", R_PERM_RW, 0644, 0);
+	io->cache.mode = R_PERM_RW;
+	io->cache.limit = 0x1000;
+	ut8 data[0x100];
+	int i;
+	for (i = 0; i < 0x100; i++) {
+		memset (data, i, sizeof (data));
+		r_io_cache_write_at (io, i * 0x100, data, sizeof (data));
+	}
+	mu_assert_notnull (io->cache.spill, "spill file");
+	mu_assert_true (io->cache.size <= io->cache.limit, "memory is bounded");
+	RIOCacheLayer *layer = r_list_first (io->cache.layers);
+	RIOCacheItem *ci = r_pvector_at (layer->vec, 0);
+	mu_assert_true (ci->spilled, "oldest item is spilled");
+	ut8 buf[4];
+	r_io_read_at (io, 0x1fe, buf, sizeof (buf));
+	mu_assert_memeq (buf, (const ut8 *)"\x01\x01\x02\x02", sizeof (buf), "read spilled items");
+	r_io_cache_invalidate (io, 0x100, 0x1ff, false);
+	r_io_read_at (io, 0x1fe, buf, sizeof (buf));
+	mu_assert_memeq (buf, (const ut8 *)"\x00\x00\x02\x02", sizeof (buf), "invalidate spilled items");
+	char *file = strdup (io->cache.spill_file);
+	r_io_cache_reset (io);
+	mu_assert_false (r_file_exists (file), "spill file is removed");
+	free (file);
+	r_io_free (io);
+	mu_end;
+}
+
+// what io.cache.size must be, the in-memory bytes of all the items
+static ut64 cache_mem(RIO *io) {
+	ut64 size = 0;
+	RListIter *liter;
+	RIOCacheLayer *layer;
+	r_list_foreach (io->cache.layers, liter, layer) {
+		void **iter;
+		r_pvector_foreach (layer->vec, iter) {
+			RIOCacheItem *ci = *iter;
+			size += ci->spilled? 0: 2 * r_itv_size (ci->itv);
+		}
+	}
+	return size;
+}
+
+bool test_r_io_cache_size(void) {
+	RIO *io = r_io_new ();
+	r_io_open_at (io, "malloc://0x1000", R_PERM_RW, 0644, 0);
+	io->cache.mode = R_PERM_RW;
+	io->cache.limit = 0x400;
+	ut8 data[0x80];
+	int i;
+	for (i = 0; i < 64; i++) {
+		memset (data, i, sizeof (data));
+		r_io_cache_write_at (io, 0x100, data, sizeof (data));
+		mu_assert_eq (io->cache.size, cache_mem (io), "size of the same range written again");
+		mu_assert_true (io->cache.size <= io->cache.limit, "rewrites are bounded");
+	}
+	ut8 buf[2];
+	r_io_read_at (io, 0x17f, buf, sizeof (buf));
+	mu_assert_memeq (buf, (const ut8 *)"\x3f\x00", sizeof (buf), "last write wins");
+	r_io_cache_invalidate (io, 0x110, 0x11f, false);
+	mu_assert_eq (io->cache.size, cache_mem (io), "size after splitting the items");
+	r_io_cache_invalidate (io, 0x170, 0x1ff, false);
+	mu_assert_eq (io->cache.size, cache_mem (io), "size after trimming the items");
+	r_io_cache_invalidate (io, 0x100, 0x10f, false);
+	mu_assert_eq (io->cache.size, cache_mem (io), "size after trimming the start");
+	r_io_cache_invalidate (io, 0, 0xfff, false);
+	mu_assert_eq (io->cache.size, 0, "size after dropping the items");
+	r_io_cache_write_at (io, 0x200, data, sizeof (data));
+	r_io_cache_undo (io);
+	mu_assert_eq (io->cache.size, 0, "size after undo");
+	r_io_cache_push (io);
+	r_io_cache_write_at (io, 0x200, data, sizeof (data));
+	r_io_cache_pop (io);
+	mu_assert_eq (io->cache.size, 0, "size after pop");
+	// merged writes only count the bytes that the item grows
+	io->cache.coalesce = true;
+	for (i = 0; i < 64; i++) {
+		r_io_cache_write_at (io, 0x300 + i, data, 0x10);
+		mu_assert_eq (io->cache.size, cache_mem (io), "size of the merged writes");
+	}
+	mu_assert_eq (io->cache.size, 2 * (64 + 0xf), "one item for the merged writes");
+	r_io_free (io);
+	mu_end;
+}
+
 int all_tests() {
 	mu_run_test(test_r_io_cache);
 	mu_run_test(test_r_io_mapsplit);
@@ -286,6 +437,10 @@ int all_tests() {
 	//mu_run_test(test_r_io_priority);
 	// mu_run_test(test_r_io_priority2);
 	mu_run_test(test_va_malloc_zero);
+	mu_run_test(test_r_io_peek);
+	mu_run_test(test_r_io_cache_coalesce);
+	mu_run_test(test_r_io_cache_spill);
+	mu_run_test(test_r_io_cache_size);
 	return tests_passed != tests_run;
 }
 
@@ -0,0 +1,151 @@
+#include <r_search.h>
+#include <r_io.h>
+#include "minunit.h"
+
+static int hit_cb(RSearchKeyword *kw, void *user, ut64 addr) {
+	RStrBuf *sb = user;
+	r_strbuf_appendf (sb, "%d:0x%"PFMT64x" ", kw->kwidx, addr);
+	return 1;
+}
+
+static char *search_hits(RSearch *rs, const ut8 *buf, int len, int bsize) {
+	RStrBuf *sb = r_strbuf_new ("");
+	r_search_set_callback (rs, hit_cb, sb);
+	r_search_begin (rs);
+	int i;
+	for (i = 0; i < len; i += bsize) {
+		r_search_update (rs, i, buf + i, R_MIN (bsize, len - i));
+	}
+	return r_strbuf_drain (sb);
+}
+
+bool test_r_search_keywords(void) {
+	const char *data = "hello world, hello radare, hola mundo";
+	RSearch *rs = r_search_new (R_SEARCH_KEYWORD);
+	r_search_kw_add (rs, r_search_keyword_new_str ("hello", NULL, NULL, false));
+	r_search_kw_add (rs, r_search_keyword_new_str ("radare", NULL, NULL, false));
+	r_search_kw_add (rs, r_search_keyword_new_str ("lo", NULL, NULL, false));
+	char *res = search_hits (rs, (const ut8 *)data, strlen (data), 0x100);
+	mu_assert_streq (res, "0:0x0 0:0xd 1:0x13 2:0x3 2:0x10 ", "hits are reported per keyword");
+	free (res);
+	// keywords split across block boundaries
+	res = search_hits (rs, (const ut8 *)data, strlen (data), 4);
+	mu_assert_streq (res, "0:0x0 2:0x3 0:0xd 2:0x10 1:0x13 ", "hits across blocks");
+	free (res);
+	r_search_free (rs);
+	mu_end;
+}
+
+bool test_r_search_keywords_mask(void) {
+	const ut8 data[] = { 0x90, 0x55, 0x48, 0x89, 0xe5, 0x90, 0x55, 0x48, 0x8b, 0xe5, 0x30, 0x41 };
+	RSearch *rs = r_search_new (R_SEARCH_KEYWORD);
+	r_search_kw_add (rs, r_search_keyword_new_hex ("554889e5", "ffff00ff", NULL));
+	r_search_kw_add (rs, r_search_keyword_new_hex ("0041", "0fff", NULL));
+	char *res = search_hits (rs, data, sizeof (data), 0x100);
+	mu_assert_streq (res, "0:0x1 0:0x6 1:0xa ", "masked keywords");
+	free (res);
+	r_search_free (rs);
+	mu_end;
+}
+
+bool test_r_search_keywords_icase(void) {
+	const char *data = "AAaaA Radare RADARE";
+	RSearch *rs = r_search_new (R_SEARCH_KEYWORD);
+	r_search_kw_add (rs, r_search_keyword_new_str ("radare", NULL, NULL, true));
+	r_search_kw_add (rs, r_search_keyword_new_str ("aa", NULL, NULL, false));
+	char *res = search_hits (rs, (const ut8 *)data, strlen (data), 0x100);
+	mu_assert_streq (res, "0:0x6 0:0xd 1:0x2 ", "case insensitive keyword");
+	free (res);
+	r_search_free (rs);
+	mu_end;
+}
+
+bool test_r_search_keywords_overlap(void) {
+	const char *data = "aaaa";
+	RSearch *rs = r_search_new (R_SEARCH_KEYWORD);
+	rs->contiguous = true;
+	r_search_kw_add (rs, r_search_keyword_new_str ("aa", NULL, NULL, false));
+	char *res = search_hits (rs, (const ut8 *)data, strlen (data), 0x100);
+	mu_assert_streq (res, "0:0x0 0:0x2 ", "non overlapping hits");
+	free (res);
+	rs->overlap = true;
+	res = search_hits (rs, (const ut8 *)data, strlen (data), 0x100);
+	mu_assert_streq (res, "0:0x0 0:0x1 0:0x2 ", "overlapping hits");
+	free (res);
+	r_search_free (rs);
+	mu_end;
+}
+
+static bool not_breaked(void) {
+	return false;
+}
+
+static char *search_read_hits(RSearch *rs, RIO *io, RThreadPool *pool, int threads) {
+	RStrBuf *sb = r_strbuf_new ("");
+	r_search_set_callback (rs, hit_cb, sb);
+	r_search_begin (rs);
+	rs->pool = pool;
+	rs->threads = threads;
+	rs->nhits = 0;
+	r_search_update_read (rs, 0, r_io_size (io));
+	return r_strbuf_drain (sb);
+}
+
+bool test_r_search_keywords_threads(void) {
+	const int size = 0x340000;
+	const ut64 at[] = { 0x10, 0xffffd, 0x100008, 0x1ffffe, 0x33fffa };
+	ut8 *data = calloc (1, size);
+	int i;
+	for (i = 0; i < R_ARRAY_SIZE (at); i++) {
+		memcpy (data + at[i], "radare", 6);
+	}
+	memcpy (data + 0x2ffffe, "aaaa", 4);
+	RIO *io = r_io_new ();
+	r_io_open (io, "malloc://0x340000", R_PERM_RW, 0);
+	r_io_write_at (io, 0, data, size);
+	RSearch *rs = r_search_new (R_SEARCH_KEYWORD);
+	r_io_bind (io, &rs->iob);
+	rs->consb.is_breaked = not_breaked;
+	rs->contiguous = true;
+	r_search_kw_add (rs, r_search_keyword_new_str ("radare", NULL, NULL, false));
+	r_search_kw_add (rs, r_search_keyword_new_str ("aa", NULL, NULL, false));
+	const char *exp = "0:0x10 0:0xffffd 0:0x100008 0:0x1ffffe 1:0x2ffffe 1:0x300000 0:0x33fffa ";
+	RThreadPool *pool = r_th_pool_new (4);
+	char *res = search_read_hits (rs, io, pool, 0);
+	mu_assert_streq (res, exp, "hits across chunks");
+	free (res);
+	res = search_read_hits (rs, io, pool, 2);
+	mu_assert_streq (res, exp, "hits across chunks with less workers than the pool");
+	free (res);
+	res = search_read_hits (rs, io, NULL, 0);
+	mu_assert_streq (res, exp, "hits without a pool");
+	free (res);
+	rs->overlap = true;
+	res = search_read_hits (rs, io, pool, 0);
+	mu_assert_streq (res, "0:0x10 0:0xffffd 0:0x100008 0:0x1ffffe 1:0x2ffffe 1:0x2fffff 1:0x300000 0:0x33fffa ",
+		"overlapping hits across chunks");
+	free (res);
+	rs->overlap = false;
+	rs->maxhits = 3;
+	res = search_read_hits (rs, io, pool, 0);
+	mu_assert_streq (res, "0:0x10 0:0xffffd 0:0x100008 ", "maxhits stops the threaded scan");
+	free (res);
+	r_th_pool_free (pool);
+	r_search_free (rs);
+	r_io_free (io);
+	free (data);
+	mu_end;
+}
+
+int all_tests() {
+	mu_run_test (test_r_search_keywords);
+	mu_run_test (test_r_search_keywords_mask);
+	mu_run_test (test_r_search_keywords_icase);
+	mu_run_test (test_r_search_keywords_overlap);
+	mu_run_test (test_r_search_keywords_threads);
+	return tests_passed != tests_run;
+}
+
+int main(int argc, char **argv) {
+	return all_tests ();
+}
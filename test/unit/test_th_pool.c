@@ -0,0 +1,86 @@
+#include <r_util.h>
+#include "minunit.h"
+
+static void *square(void *user) {
+	size_t n = (size_t)user;
+	return (void *)(n * n);
+}
+
+static void mark(void *user, size_t from, size_t to) {
+	ut8 *seen = user;
+	size_t i;
+	for (i = from; i < to; i++) {
+		seen[i]++;
+	}
+}
+
+typedef struct {
+	RThreadPool *pool;
+	ut8 *seen;
+} Nested;
+
+static void nested(void *user, size_t from, size_t to) {
+	Nested *n = user;
+	size_t i;
+	for (i = from; i < to; i++) {
+		r_th_parallel_for (n->pool, i * 100, (i + 1) * 100, 10, mark, n->seen);
+	}
+}
+
+bool test_r_th_pool_futures(void) {
+	RThreadPool *pool = r_th_pool_new (4);
+	mu_assert_notnull (pool, "pool");
+	mu_assert_eq (pool->size, 4, "pool size");
+	RThreadFuture *fs[64];
+	size_t i;
+	for (i = 0; i < 64; i++) {
+		fs[i] = r_th_pool_submit (pool, square, (void *)i);
+	}
+	bool ok = true;
+	for (i = 0; i < 64; i++) {
+		ok &= (size_t)r_th_future_wait (fs[i]) == i * i;
+		r_th_future_free (fs[i]);
+	}
+	mu_assert_true (ok, "future results");
+	r_th_pool_free (pool);
+	// without a pool the task runs right away
+	RThreadFuture *f = r_th_pool_submit (NULL, square, (void *)(size_t)3);
+	mu_assert_eq ((size_t)r_th_future_wait (f), 9, "inline future");
+	r_th_future_free (f);
+	mu_end;
+}
+
+bool test_r_th_parallel_for(void) {
+	RThreadPool *pool = r_th_pool_new (4);
+	ut8 *seen = calloc (1, 10000);
+	mu_assert_true (r_th_parallel_for (pool, 0, 10000, 7, mark, seen), "parallel for");
+	mu_assert_true (r_th_parallel_for (pool, 0, 10000, 0, mark, seen), "automatic grain");
+	size_t i;
+	bool ok = true;
+	for (i = 0; i < 10000; i++) {
+		ok &= seen[i] == 2;
+	}
+	mu_assert_true (ok, "every index is visited once per loop");
+	memset (seen, 0, 10000);
+	// loops inside the tasks must not starve the pool
+	Nested n = { pool, seen };
+	mu_assert_true (r_th_parallel_for (pool, 0, 100, 1, nested, &n), "nested parallel for");
+	ok = true;
+	for (i = 0; i < 10000; i++) {
+		ok &= seen[i] == 1;
+	}
+	mu_assert_true (ok, "nested loops");
+	free (seen);
+	r_th_pool_free (pool);
+	mu_end;
+}
+
+int all_tests() {
+	mu_run_test (test_r_th_pool_futures);
+	mu_run_test (test_r_th_parallel_for);
+	return tests_passed != tests_run;
+}
+
+int main(int argc, char **argv) {
+	return all_tests ();
+}